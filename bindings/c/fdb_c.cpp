@@ -48,6 +48,7 @@ int g_api_version = 0;
 #define DB(d) ((IDatabase*)d)
 #define TENANT(t) ((ITenant*)t)
 #define TXN(t) ((ITransaction*)t)
+#define RSTREAM(rs) ((ITransactionRangeStream*)rs)
 
 // Legacy (pre API version 610)
 #define CLUSTER(c) ((char*)c)
@@ -319,6 +320,13 @@ extern "C" DLLEXPORT fdb_error_t fdb_future_get_key_array(FDBFuture* f, FDBKey c
 	                 *out_count = na.size(););
 }
 
+extern "C" DLLEXPORT fdb_error_t fdb_future_detach_result(FDBFuture* f, FDBResult** out_result) {
+	// Copying the Standalone shares the underlying arena rather than the data, so the returned
+	// result keeps the key-value memory alive after the future is destroyed
+	CATCH_AND_RETURN(Standalone<RangeResultRef> rrr = TSAV(Standalone<RangeResultRef>, f)->get();
+	                 *out_result = (FDBResult*)(ThreadResult<Standalone<RangeResultRef>>(rrr).extractPtr()););
+}
+
 extern "C" DLLEXPORT void fdb_result_destroy(FDBResult* r) {
 	CATCH_AND_DIE(TSAVB(r)->cancel(););
 }
@@ -702,6 +710,42 @@ extern "C" DLLEXPORT FDBFuture* fdb_transaction_get_mapped_range(FDBTransaction*
 	                    .extractPtr());
 }
 
+extern "C" DLLEXPORT FDBRangeStream* fdb_transaction_get_range_stream(FDBTransaction* tr,
+                                                                      uint8_t const* begin_key_name,
+                                                                      int begin_key_name_length,
+                                                                      fdb_bool_t begin_or_equal,
+                                                                      int begin_offset,
+                                                                      uint8_t const* end_key_name,
+                                                                      int end_key_name_length,
+                                                                      fdb_bool_t end_or_equal,
+                                                                      int end_offset,
+                                                                      fdb_bool_t snapshot) {
+	return (FDBRangeStream*)(TXN(tr)
+	                             ->getRangeStream(KeySelectorRef(KeyRef(begin_key_name, begin_key_name_length),
+	                                                             begin_or_equal,
+	                                                             begin_offset),
+	                                              KeySelectorRef(KeyRef(end_key_name, end_key_name_length),
+	                                                             end_or_equal,
+	                                                             end_offset),
+	                                              snapshot)
+	                             .extractPtr());
+}
+
+extern "C" DLLEXPORT FDBFuture* fdb_range_stream_next_fragment(FDBRangeStream* rs) {
+	return (FDBFuture*)(RSTREAM(rs)->nextFragment().extractPtr());
+}
+
+extern "C" DLLEXPORT void fdb_range_stream_cancel(FDBRangeStream* rs) {
+	CATCH_AND_DIE(RSTREAM(rs)->cancel(););
+}
+
+extern "C" DLLEXPORT void fdb_range_stream_destroy(FDBRangeStream* rs) {
+	try {
+		RSTREAM(rs)->delref();
+	} catch (...) {
+	}
+}
+
 FDBFuture* fdb_transaction_get_range_selector_v13(FDBTransaction* tr,
                                                   uint8_t const* begin_key_name,
                                                   int begin_key_name_length,
@@ -262,6 +262,14 @@ DLLEXPORT WARN_UNUSED_RESULT fdb_error_t fdb_future_get_keyrange_array(FDBFuture
                                                                        FDBKeyRange const** out_ranges,
                                                                        int* out_count);
 
+#if FDB_API_VERSION >= 720
+/* Transfers ownership of a range read result out of the future without copying the data. The
+   returned FDBResult keeps the key-value memory alive independently of the future, so the future
+   may be destroyed immediately; the result must later be freed with fdb_result_destroy() and read
+   with fdb_result_get_keyvalue_array(). */
+DLLEXPORT WARN_UNUSED_RESULT fdb_error_t fdb_future_detach_result(FDBFuture* f, FDBResult** out_result);
+#endif
+
 /* FDBResult is a synchronous computation result, as opposed to a future that is asynchronous. */
 DLLEXPORT void fdb_result_destroy(FDBResult* r);
 
@@ -410,6 +418,35 @@ DLLEXPORT WARN_UNUSED_RESULT FDBFuture* fdb_transaction_get_mapped_range(FDBTran
                                                                          fdb_bool_t snapshot,
                                                                          fdb_bool_t reverse);
 
+#if FDB_API_VERSION >= 720
+/*
+ * A streaming alternative to fdb_transaction_get_range for reading large amounts of data.
+ * The client fetches fragments from all shards covering the range in parallel, merges them
+ * back into key order and hands them out one fdb_range_stream_next_fragment call at a time;
+ * each fragment future resolves to a keyvalue array whose more flag is nonzero while further
+ * fragments remain. At most one fragment future may be outstanding at a time, and the stream
+ * must be destroyed before the transaction. Streamed reads do not observe the transaction's
+ * own uncommitted writes, so they require either snapshot reads or the
+ * FDB_TR_OPTION_READ_YOUR_WRITES_DISABLE transaction option.
+ */
+DLLEXPORT WARN_UNUSED_RESULT FDBRangeStream* fdb_transaction_get_range_stream(FDBTransaction* tr,
+                                                                              uint8_t const* begin_key_name,
+                                                                              int begin_key_name_length,
+                                                                              fdb_bool_t begin_or_equal,
+                                                                              int begin_offset,
+                                                                              uint8_t const* end_key_name,
+                                                                              int end_key_name_length,
+                                                                              fdb_bool_t end_or_equal,
+                                                                              int end_offset,
+                                                                              fdb_bool_t snapshot);
+
+DLLEXPORT WARN_UNUSED_RESULT FDBFuture* fdb_range_stream_next_fragment(FDBRangeStream* rs);
+
+DLLEXPORT void fdb_range_stream_cancel(FDBRangeStream* rs);
+
+DLLEXPORT void fdb_range_stream_destroy(FDBRangeStream* rs);
+#endif
+
 DLLEXPORT void fdb_transaction_set(FDBTransaction* tr,
                                    uint8_t const* key_name,
                                    int key_name_length,
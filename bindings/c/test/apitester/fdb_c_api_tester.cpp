@@ -102,7 +102,7 @@ void printProgramUsage(const char* execName) {
 	       "                 Sets the LogGroup field with the specified value for all\n"
 	       "                 events in the trace output (defaults to `default').\n"
 	       "  --trace-format FORMAT\n"
-	       "                 Select the format of the log files. xml (the default) and json\n"
+	       "                 Select the format of the log files. xml (the default), json, and binary\n"
 	       "                 are supported. Has no effect unless --log is specified.\n"
 	       "  --knob-KNOBNAME KNOBVALUE\n"
 	       "                 Changes a knob option. KNOBNAME should be lowercase.\n"
@@ -50,7 +50,7 @@ void printConvertUsage() {
 	          << "                  Sets the LogGroup field with the specified value for all\n"
 	          << "                  events in the trace output (defaults to `default').\n"
 	          << "  --trace-format FORMAT\n"
-	          << "                  Select the format of the trace files. xml (the default) and json are supported.\n"
+	          << "                  Select the format of the trace files. xml (the default), json, and binary are supported.\n"
 	          << "                  Has no effect unless --log is specified.\n"
 	          << "  --build-flags   Print build information and exit.\n"
 	          << "  -h, --help      Display this help and exit.\n"
@@ -970,7 +970,7 @@ static void printAgentUsage(bool devhelp) {
 	       "                 Sets the LogGroup field with the specified value for all\n"
 	       "                 events in the trace output (defaults to `default').\n");
 	printf("  --trace-format FORMAT\n"
-	       "                 Select the format of the trace files. xml (the default) and json are supported.\n"
+	       "                 Select the format of the trace files. xml (the default), json, and binary are supported.\n"
 	       "                 Has no effect unless --log is specified.\n");
 	printf("  -m SIZE, --memory SIZE\n"
 	       "                 Memory limit. The default value is 8GiB. When specified\n"
@@ -1090,7 +1090,7 @@ static void printBackupUsage(bool devhelp) {
 	       "                 Sets the LogGroup field with the specified value for all\n"
 	       "                 events in the trace output (defaults to `default').\n");
 	printf("  --trace-format FORMAT\n"
-	       "                 Select the format of the trace files. xml (the default) and json are supported.\n"
+	       "                 Select the format of the trace files. xml (the default), json, and binary are supported.\n"
 	       "                 Has no effect unless --log is specified.\n");
 	printf("  --max-cleanup-seconds SECONDS\n"
 	       "                 Specifies the amount of time a backup or DR needs to be stale before cleanup will\n"
@@ -1164,7 +1164,7 @@ static void printRestoreUsage(bool devhelp) {
 	       "                 Sets the LogGroup field with the specified value for all\n"
 	       "                 events in the trace output (defaults to `default').\n");
 	printf("  --trace-format FORMAT\n"
-	       "                 Select the format of the trace files. xml (the default) and json are supported.\n"
+	       "                 Select the format of the trace files. xml (the default), json, and binary are supported.\n"
 	       "                 Has no effect unless --log is specified.\n");
 	printf("  --incremental\n"
 	       "                 Performs incremental restore without the base backup.\n"
@@ -1228,7 +1228,7 @@ static void printDBAgentUsage(bool devhelp) {
 	       "                 Sets the LogGroup field with the specified value for all\n"
 	       "                 events in the trace output (defaults to `default').\n");
 	printf("  --trace-format FORMAT\n"
-	       "                 Select the format of the trace files. xml (the default) and json are supported.\n"
+	       "                 Select the format of the trace files. xml (the default), json, and binary are supported.\n"
 	       "                 Has no effect unless --log is specified.\n");
 	printf("  -m, --memory SIZE\n"
 	       "                 Memory limit. The default value is 8GiB. When specified\n"
@@ -1281,7 +1281,7 @@ static void printDBBackupUsage(bool devhelp) {
 	       "                 Sets the LogGroup field with the specified value for all\n"
 	       "                 events in the trace output (defaults to `default').\n");
 	printf("  --trace-format FORMAT\n"
-	       "                 Select the format of the trace files. xml (the default) and json are supported.\n"
+	       "                 Select the format of the trace files. xml (the default), json, and binary are supported.\n"
 	       "                 Has no effect unless --log is specified.\n");
 	printf("  -h, --help     Display this help and exit.\n");
 	printf("\n"
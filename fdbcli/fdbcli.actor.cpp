@@ -461,7 +461,7 @@ static void printProgramUsage(const char* name) {
 	       "                 Sets the LogGroup field with the specified value for all\n"
 	       "                 events in the trace output (defaults to `default').\n"
 	       "  --trace-format FORMAT\n"
-	       "                 Select the format of the log files. xml (the default) and json\n"
+	       "                 Select the format of the log files. xml (the default), json, and binary\n"
 	       "                 are supported. Has no effect unless --log is specified.\n"
 	       "  --exec CMDS    Immediately executes the semicolon separated CLI commands\n"
 	       "                 and then exits.\n"
@@ -504,10 +504,13 @@ void initHelp() {
 	    "clear a key from the database",
 	    "Clear succeeds even if the specified key is not present, but may fail because of conflicts." ESCAPINGK);
 	helpMap["clearrange"] = CommandHelp(
-	    "clearrange <BEGINKEY> <ENDKEY>",
+	    "clearrange <BEGINKEY> <ENDKEY> [--chunked]",
 	    "clear a range of keys from the database",
 	    "All keys between BEGINKEY (inclusive) and ENDKEY (exclusive) are cleared from the database. This command will "
-	    "succeed even if the specified range is empty, but may fail because of conflicts." ESCAPINGK);
+	    "succeed even if the specified range is empty, but may fail because of conflicts. With `--chunked', the range "
+	    "is split into chunks that are cleared and committed in separate transactions, with progress printed after "
+	    "each chunk. A chunked clear is not atomic and cannot be used inside a transaction, but large clears make "
+	    "forward progress instead of repeatedly conflicting with concurrent writers." ESCAPINGK);
 	helpMap["exit"] = CommandHelp("exit", "exit the CLI", "");
 	helpMap["quit"] = CommandHelp();
 	helpMap["waitconnected"] = CommandHelp();
@@ -731,6 +734,56 @@ Reference<ITransaction> getTransaction(Reference<IDatabase> db,
 	return tr;
 }
 
+// Clears a key range in multiple transactions, one chunk of roughly CHUNKED_CLEAR_RANGE_BYTES at a time. Each
+// chunk is committed and retried independently, so large clears make steady forward progress instead of
+// repeatedly conflicting with concurrent writers. The clear is not atomic across chunks.
+ACTOR Future<Void> clearRangeChunked(Reference<IDatabase> db,
+                                     Reference<ITenant> tenant,
+                                     FdbOptions* options,
+                                     KeyRange range) {
+	state const int64_t CHUNKED_CLEAR_RANGE_BYTES = 100000000;
+	state Reference<ITransaction> tr;
+	state Standalone<VectorRef<KeyRef>> splitPoints;
+	loop {
+		getTransaction(db, tenant, tr, options, false);
+		try {
+			state ThreadFuture<Standalone<VectorRef<KeyRef>>> splitsF =
+			    tr->getRangeSplitPoints(range, CHUNKED_CLEAR_RANGE_BYTES);
+			Standalone<VectorRef<KeyRef>> splits = wait(safeThreadFutureToFuture(splitsF));
+			splitPoints = splits;
+			break;
+		} catch (Error& e) {
+			wait(safeThreadFutureToFuture(tr->onError(e)));
+		}
+	}
+
+	// The split points include the range endpoints; fall back to a single chunk if we got fewer than two
+	if (splitPoints.size() < 2) {
+		splitPoints = Standalone<VectorRef<KeyRef>>();
+		splitPoints.push_back_deep(splitPoints.arena(), range.begin);
+		splitPoints.push_back_deep(splitPoints.arena(), range.end);
+	}
+
+	state int totalChunks = splitPoints.size() - 1;
+	state int chunk = 0;
+	for (; chunk < totalChunks; ++chunk) {
+		state KeyRange chunkRange = KeyRangeRef(splitPoints[chunk], splitPoints[chunk + 1]);
+		loop {
+			getTransaction(db, tenant, tr, options, false);
+			try {
+				tr->clear(chunkRange);
+				wait(safeThreadFutureToFuture(tr->commit()));
+				break;
+			} catch (Error& e) {
+				wait(safeThreadFutureToFuture(tr->onError(e)));
+			}
+		}
+		fmt::print("Cleared chunk {0}/{1} (through `{2}')\n", chunk + 1, totalChunks, printable(chunkRange.end));
+	}
+	fmt::print("Range cleared in {0} transaction(s)\n", totalChunks);
+	return Void();
+}
+
 std::string newCompletion(const char* base, const char* name) {
 	return format("%s%s ", base, name);
 }
@@ -1768,7 +1821,15 @@ ACTOR Future<int> cli(CLIOptions opt, LineNoise* plinenoise) {
 						continue;
 					}
 
-					if (tokens.size() != 3) {
+					if (tokens.size() == 4 && tokencmp(tokens[3], "--chunked")) {
+						if (intrans) {
+							fprintf(stderr, "ERROR: chunked clears cannot be run inside a transaction\n");
+							is_error = true;
+						} else {
+							wait(makeInterruptable(
+							    clearRangeChunked(db, tenant, options, KeyRangeRef(tokens[1], tokens[2]))));
+						}
+					} else if (tokens.size() != 3) {
 						printUsage(tokens[0]);
 						is_error = true;
 					} else {
@@ -23,7 +23,9 @@
 #include "flow/IAsyncFile.h"
 #include "fdbclient/ActorLineageProfiler.h"
 #include "fdbclient/NameLineage.h"
+#include "fdbclient/PriorityLineage.h"
 #include <msgpack.hpp>
+#include <cmath>
 #include <memory>
 #include <typeindex>
 #include <boost/endian/conversion.hpp>
@@ -199,6 +201,25 @@ std::shared_ptr<Sample> SampleCollectorT::collect() {
 	return sample;
 }
 
+// (Re)allocates the sample ring to hold windowSize seconds of samples at the configured sampling frequency,
+// keeping the newest samples. Called only when either parameter changes; collection itself then runs with a
+// fixed-size ring and simply drops the oldest sample when full.
+void SampleCollection_t::resizeRing() {
+	Lock _{ mutex };
+	size_t capacity = std::max<size_t>(1, size_t(ceil(windowSize.load() * samplingFrequency.load())));
+	if (capacity == data.size()) {
+		return;
+	}
+	std::vector<std::shared_ptr<Sample>> newData(capacity);
+	size_t keep = std::min(ringSize, capacity);
+	for (size_t i = 0; i < keep; ++i) {
+		newData[keep - 1 - i] = data[(ringBegin + ringSize - 1 - i) % data.size()];
+	}
+	data.swap(newData);
+	ringBegin = 0;
+	ringSize = keep;
+}
+
 void SampleCollection_t::collect(const Reference<ActorLineage>& lineage) {
 	ASSERT(lineage.isValid());
 	_currentLineage = lineage;
@@ -206,18 +227,16 @@ void SampleCollection_t::collect(const Reference<ActorLineage>& lineage) {
 	ASSERT(sample);
 	{
 		Lock _{ mutex };
-		data.emplace_back(sample);
-	}
-	auto min = std::min(data.back()->time - windowSize, data.back()->time);
-	double oldest = data.front()->time;
-	// we don't need to check for data.empty() in this loop (or the inner loop) as we know that we will end
-	// up with at least one entry which is the most recent sample
-	while (oldest < min) {
-		Lock _{ mutex };
-		// we remove at most 10 elements at a time. This is so we don't block the main thread for too long.
-		for (int i = 0; i < 10 && oldest < min; ++i) {
-			data.pop_front();
-			oldest = data.front()->time;
+		if (data.empty()) {
+			data.resize(1);
+		}
+		if (ringSize == data.size()) {
+			// The ring is full; the new sample replaces the oldest one
+			data[ringBegin] = sample;
+			ringBegin = (ringBegin + 1) % data.size();
+		} else {
+			data[(ringBegin + ringSize) % data.size()] = sample;
+			++ringSize;
 		}
 	}
 	// TODO: Should only call ingest when deleting from memory
@@ -228,7 +247,8 @@ std::vector<std::shared_ptr<Sample>> SampleCollection_t::get(double from /*= 0.0
                                                              double to /*= std::numeric_limits<double>::max()*/) const {
 	Lock _{ mutex };
 	std::vector<std::shared_ptr<Sample>> res;
-	for (const auto& sample : data) {
+	for (size_t i = 0; i < ringSize; ++i) {
+		const auto& sample = data[(ringBegin + i) % data.size()];
 		if (sample->time > to) {
 			break;
 		} else if (sample->time >= from) {
@@ -246,6 +266,9 @@ void sample(LineageReference* lineagePtr) {
 		lineagePtr->allocate();
 	}
 	(*lineagePtr)->modify(&NameLineage::actorName) = lineagePtr->actorName();
+	// Record the task priority the run loop was executing on the network thread, before handing the lineage to
+	// the profiler thread
+	(*lineagePtr)->modify(&PriorityLineage::priority) = static_cast<int64_t>(g_network->getCurrentTask());
 	boost::asio::post(ActorLineageProfiler::instance().context(),
 	                  [lineage = LineageReference::addRef(lineagePtr->getPtr())]() {
 		                  SampleCollection::instance().collect(lineage);
@@ -386,6 +409,7 @@ void samplingProfilerUpdateFrequency(std::optional<std::any> freq) {
 		frequency = std::any_cast<double>(freq.value());
 	}
 	TraceEvent(SevInfo, "SamplingProfilerUpdateFrequency").detail("Frequency", frequency);
+	SampleCollection::instance().setSamplingFrequency(frequency);
 	ActorLineageProfiler::instance().setFrequency(frequency);
 }
 
@@ -253,6 +253,9 @@ std::pair<Version, uint32_t> decodeBKMutationLogKey(Key key) {
 	    bigEndian32(*(int32_t*)(key.begin() + backupLogPrefixBytes + sizeof(UID) + sizeof(uint8_t) + sizeof(int64_t))));
 }
 
+// Decodes a mutation log value (the concatenated parts of one version's mutations) into `result`. The decoded
+// mutations reference the source bytes in `value` (or prefix-rewritten copies in `arena`) rather than copying
+// them, so the caller must keep the memory behind `value` alive as long as `result`, e.g. with arena.dependsOn().
 void decodeBackupLogValue(Arena& arena,
                           VectorRef<MutationRef>& result,
                           int& mutationSize,
@@ -298,7 +301,6 @@ void decodeBackupLogValue(Arena& arena,
 			ASSERT(offset + len1 + len2 <= value.size() && isValidMutationType(type));
 
 			MutationRef logValue;
-			Arena tempArena;
 			logValue.type = type;
 			logValue.param1 = value.substr(offset, len1);
 			offset += len1;
@@ -317,10 +319,10 @@ void decodeBackupLogValue(Arena& arena,
 								logValue.param1 = logValue.param1.removePrefix(removePrefix);
 							}
 							if (addPrefix.size()) {
-								logValue.param1 = logValue.param1.withPrefix(addPrefix, tempArena);
+								logValue.param1 = logValue.param1.withPrefix(addPrefix, arena);
 							}
-							logValue.param2 = addPrefix == StringRef() ? normalKeys.end : strinc(addPrefix, tempArena);
-							result.push_back_deep(arena, logValue);
+							logValue.param2 = addPrefix == StringRef() ? normalKeys.end : strinc(addPrefix, arena);
+							result.push_back(arena, logValue);
 							mutationSize += logValue.expectedSize();
 						} else {
 							logValue.param1 = std::max(r.range().begin, range.begin);
@@ -330,10 +332,10 @@ void decodeBackupLogValue(Arena& arena,
 								logValue.param2 = logValue.param2.removePrefix(removePrefix);
 							}
 							if (addPrefix.size()) {
-								logValue.param1 = logValue.param1.withPrefix(addPrefix, tempArena);
-								logValue.param2 = logValue.param2.withPrefix(addPrefix, tempArena);
+								logValue.param1 = logValue.param1.withPrefix(addPrefix, arena);
+								logValue.param2 = logValue.param2.withPrefix(addPrefix, arena);
 							}
-							result.push_back_deep(arena, logValue);
+							result.push_back(arena, logValue);
 							mutationSize += logValue.expectedSize();
 						}
 					}
@@ -346,9 +348,9 @@ void decodeBackupLogValue(Arena& arena,
 						logValue.param1 = logValue.param1.removePrefix(removePrefix);
 					}
 					if (addPrefix.size()) {
-						logValue.param1 = logValue.param1.withPrefix(addPrefix, tempArena);
+						logValue.param1 = logValue.param1.withPrefix(addPrefix, arena);
 					}
-					result.push_back_deep(arena, logValue);
+					result.push_back(arena, logValue);
 					mutationSize += logValue.expectedSize();
 				}
 			}
@@ -604,10 +606,13 @@ ACTOR Future<int> dumpData(Database cx,
                            Key rangeBegin,
                            PromiseStream<Future<Void>> addActor,
                            FlowLock* commitLock,
-                           Reference<KeyRangeMap<Version>> keyVersion) {
+                           Reference<KeyRangeMap<Version>> keyVersion,
+                           Future<Void> sendPermit,
+                           Promise<Void> sendDone) {
 	state Version lastVersion = invalidVersion;
 	state bool endOfStream = false;
 	state int totalBytes = 0;
+	state bool permitTaken = false;
 	loop {
 		state CommitTransactionRequest req;
 		state Version newBeginVersion = invalidVersion;
@@ -617,18 +622,36 @@ ACTOR Future<int> dumpData(Database cx,
 				RCGroup group = waitNext(results.getFuture());
 				lock->release(group.items.expectedSize());
 
-				BinaryWriter bw(Unversioned());
-				for (int i = 0; i < group.items.size(); ++i) {
-					bw.serializeBytes(group.items[i].value);
+				// The decoded mutations reference the source bytes rather than copying them, so the request
+				// arena must keep the decoded buffer alive until the commit is sent.
+				if (group.items.size() == 1) {
+					// The common case: this version's mutations fit in a single part, so decode them in place
+					// instead of reassembling the parts into a contiguous buffer first.
+					req.arena.dependsOn(group.items.arena());
+					decodeBackupLogValue(req.arena,
+					                     req.transaction.mutations,
+					                     mutationSize,
+					                     group.items[0].value,
+					                     addPrefix,
+					                     removePrefix,
+					                     group.groupKey,
+					                     keyVersion);
+				} else {
+					BinaryWriter bw(Unversioned());
+					for (int i = 0; i < group.items.size(); ++i) {
+						bw.serializeBytes(group.items[i].value);
+					}
+					Standalone<StringRef> value = bw.toValue();
+					req.arena.dependsOn(value.arena());
+					decodeBackupLogValue(req.arena,
+					                     req.transaction.mutations,
+					                     mutationSize,
+					                     value,
+					                     addPrefix,
+					                     removePrefix,
+					                     group.groupKey,
+					                     keyVersion);
 				}
-				decodeBackupLogValue(req.arena,
-				                     req.transaction.mutations,
-				                     mutationSize,
-				                     bw.toValue(),
-				                     addPrefix,
-				                     removePrefix,
-				                     group.groupKey,
-				                     keyVersion);
 				newBeginVersion = group.groupKey + 1;
 				if (mutationSize >= CLIENT_KNOBS->BACKUP_LOG_WRITE_BATCH_MAX_SIZE) {
 					break;
@@ -638,8 +661,6 @@ ACTOR Future<int> dumpData(Database cx,
 					if (endVersion.present() && endVersion.get() > lastVersion && endVersion.get() > newBeginVersion) {
 						newBeginVersion = endVersion.get();
 					}
-					if (newBeginVersion == invalidVersion)
-						return totalBytes;
 					endOfStream = true;
 					break;
 				}
@@ -647,6 +668,14 @@ ACTOR Future<int> dumpData(Database cx,
 			}
 		}
 
+		if (newBeginVersion == invalidVersion) {
+			// drained without anything to commit; just pass the send permit along
+			ASSERT(endOfStream);
+			wait(sendPermit);
+			sendDone.send(Void());
+			return totalBytes;
+		}
+
 		Key applyBegin = uid.withPrefix(applyMutationsBeginRange.begin);
 		Key versionKey = BinaryWriter::toValue(newBeginVersion, Unversioned());
 		Key rangeEnd = getApplyKey(newBeginVersion, uid);
@@ -662,11 +691,19 @@ ACTOR Future<int> dumpData(Database cx,
 		req.transaction.read_snapshot = committedVersion->get();
 		req.flags = req.flags | CommitTransactionRequest::FLAG_IS_LOCK_AWARE;
 
+		if (!permitTaken) {
+			// wait for the previous range to finish sending its commits, so that version blocks
+			// reach the proxy in version order even when several ranges are decoded in parallel
+			wait(sendPermit);
+			permitTaken = true;
+		}
+
 		totalBytes += mutationSize;
 		wait(commitLock->take(TaskPriority::DefaultYield, mutationSize));
 		addActor.send(commitLock->releaseWhen(success(commit.getReply(req)), mutationSize));
 
 		if (endOfStream) {
+			sendDone.send(Void());
 			return totalBytes;
 		}
 	}
@@ -763,23 +800,44 @@ ACTOR Future<Void> applyMutations(Database cx,
 			}
 
 			maxBytes = std::max<int>(maxBytes * CLIENT_KNOBS->APPLY_MAX_DECAY_RATE, CLIENT_KNOBS->APPLY_MIN_LOCK_BYTES);
-			for (idx = 0; idx < ranges.size(); ++idx) {
-				int bytes = wait(dumpData(cx,
-				                          results[idx],
-				                          locks[idx],
-				                          uid,
-				                          addPrefix,
-				                          removePrefix,
-				                          commit,
-				                          committedVersion,
-				                          idx == ranges.size() - 1 ? newEndVersion : Optional<Version>(),
-				                          ranges[idx].begin,
-				                          addActor,
-				                          &commitLock,
-				                          keyVersion));
-				maxBytes = std::max<int>(CLIENT_KNOBS->APPLY_MAX_INCREASE_FACTOR * bytes, maxBytes);
+
+			// Decode up to APPLY_PARALLEL_RANGES version blocks at a time. A chain of send permits
+			// keeps the commit requests flowing to the proxy in version order: each range may only
+			// start sending once the previous range has sent everything it has.
+			state size_t windowBegin = 0;
+			state size_t windowEnd;
+			state std::vector<Future<int>> dumps;
+			while (windowBegin < ranges.size()) {
+				windowEnd = std::min<size_t>(windowBegin + std::max(1, CLIENT_KNOBS->APPLY_PARALLEL_RANGES),
+				                             ranges.size());
+				dumps.clear();
+				Future<Void> sendPermit = Void();
+				for (idx = windowBegin; idx < windowEnd; ++idx) {
+					Promise<Void> sendDone;
+					dumps.push_back(dumpData(cx,
+					                         results[idx],
+					                         locks[idx],
+					                         uid,
+					                         addPrefix,
+					                         removePrefix,
+					                         commit,
+					                         committedVersion,
+					                         idx == ranges.size() - 1 ? newEndVersion : Optional<Version>(),
+					                         ranges[idx].begin,
+					                         addActor,
+					                         &commitLock,
+					                         keyVersion,
+					                         sendPermit,
+					                         sendDone));
+					sendPermit = sendDone.getFuture();
+				}
+				wait(success(waitForAll(dumps)) || error);
 				if (error.isError())
 					throw error.getError();
+				for (const auto& dump : dumps) {
+					maxBytes = std::max<int>(CLIENT_KNOBS->APPLY_MAX_INCREASE_FACTOR * dump.get(), maxBytes);
+				}
+				windowBegin = windowEnd;
 			}
 
 			wait(coalesceKeyVersionCache(
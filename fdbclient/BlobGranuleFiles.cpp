@@ -1364,22 +1364,94 @@ struct MergeStreamNext {
 	int dataIdx;
 };
 
-// the sort order is logically lower by key, and then higher by streamIdx
-// because a priority queue is backwards, we invert that
-struct OrderForPriorityQueue {
+// the merge order is logically lower by key, and then higher by streamIdx, so that equal keys are
+// produced with the highest-precedence stream first
+//
+// A tournament (loser) tree does exactly one leaf-to-root path of ceil(log2(k)) comparisons per
+// element produced, where a binary heap costs up to twice that for the pop+push pair. All key
+// comparisons skip the prefix shared by the granule's entire key range.
+struct MergeLoserTree {
+	static constexpr int16_t SENTINEL = std::numeric_limits<int16_t>::max();
+
+	const std::vector<Standalone<VectorRef<ParsedDeltaBoundaryRef>>>& streams;
 	int commonPrefixLen;
-	OrderForPriorityQueue(int commonPrefixLen) : commonPrefixLen(commonPrefixLen) {}
+	int16_t k;
+	std::vector<int16_t> losers; // internal nodes of the tournament; losers[0] holds the overall winner
+	std::vector<MergeStreamNext> cursor; // current element of each stream
+	std::vector<bool> exhausted;
+
+	MergeLoserTree(const std::vector<Standalone<VectorRef<ParsedDeltaBoundaryRef>>>& streams, int commonPrefixLen)
+	  : streams(streams), commonPrefixLen(commonPrefixLen), k(streams.size()) {
+		losers.assign(std::max<int>(k, 1), SENTINEL);
+		cursor.resize(k);
+		exhausted.resize(k);
+		for (int16_t i = 0; i < k; i++) {
+			cursor[i].streamIdx = i;
+			cursor[i].dataIdx = 0;
+			exhausted[i] = streams[i].empty();
+			if (!exhausted[i]) {
+				cursor[i].key = streams[i][0].key;
+			}
+		}
+		// play each leaf into the tree; the sentinel wins every match, so the real entries settle
+		// into their loser positions as they displace it
+		for (int16_t i = 0; i < k; i++) {
+			adjust(i);
+		}
+	}
 
-	bool operator()(MergeStreamNext const& a, MergeStreamNext const& b) const {
-		int keyCmp = a.key.compareSuffix(b.key, commonPrefixLen);
+	// whether stream a's current element should be produced before stream b's
+	bool beats(int16_t a, int16_t b) const {
+		if (a == SENTINEL) {
+			return true;
+		}
+		if (b == SENTINEL) {
+			return false;
+		}
+		if (exhausted[a]) {
+			return false;
+		}
+		if (exhausted[b]) {
+			return true;
+		}
+		int keyCmp = cursor[a].key.compareSuffix(cursor[b].key, commonPrefixLen);
 		if (keyCmp != 0) {
-			return keyCmp > 0; // reverse
+			return keyCmp < 0;
 		}
-		return a.streamIdx < b.streamIdx;
+		return a > b;
 	}
-};
 
-typedef std::priority_queue<MergeStreamNext, std::vector<MergeStreamNext>, OrderForPriorityQueue> MergePQ;
+	// replay the matches on the path from leaf s to the root, leaving losers behind and carrying
+	// the winner up
+	void adjust(int16_t s) {
+		for (int t = (s + k) >> 1; t > 0; t >>= 1) {
+			if (beats(losers[t], s)) {
+				std::swap(losers[t], s);
+			}
+		}
+		losers[0] = s;
+	}
+
+	bool empty() const { return losers[0] == SENTINEL || exhausted[losers[0]]; }
+
+	// only valid when !empty()
+	KeyRef peekKey() const { return cursor[losers[0]].key; }
+
+	// produce the winner and advance its stream
+	MergeStreamNext pop() {
+		int16_t w = losers[0];
+		MergeStreamNext item = cursor[w];
+		if (item.dataIdx + 1 < streams[w].size()) {
+			cursor[w].dataIdx++;
+			cursor[w].key = streams[w][cursor[w].dataIdx].key;
+		} else {
+			exhausted[w] = true;
+			cursor[w].key = KeyRef();
+		}
+		adjust(w);
+		return item;
+	}
+};
 
 static RangeResult mergeDeltaStreams(const BlobGranuleChunkRef& chunk,
                                      const std::vector<Standalone<VectorRef<ParsedDeltaBoundaryRef>>>& streams,
@@ -1390,7 +1462,7 @@ static RangeResult mergeDeltaStreams(const BlobGranuleChunkRef& chunk,
 	int prefixLen = commonPrefixLength(chunk.keyRange.begin, chunk.keyRange.end);
 
 	// next element for each stream
-	MergePQ next = MergePQ(OrderForPriorityQueue(prefixLen));
+	MergeLoserTree next(streams, prefixLen);
 
 	// efficiently find the highest stream's active clear
 	std::set<int16_t, std::greater<int16_t>> activeClears;
@@ -1407,12 +1479,6 @@ static RangeResult mergeDeltaStreams(const BlobGranuleChunkRef& chunk,
 		if (streams[i].empty()) {
 			// single clear that entirely encases partial read bounds
 			ASSERT(clearActive[i]);
-		} else {
-			MergeStreamNext item;
-			item.key = streams[i][0].key;
-			item.streamIdx = i;
-			item.dataIdx = 0;
-			next.push(item);
 		}
 	}
 
@@ -1421,13 +1487,11 @@ static RangeResult mergeDeltaStreams(const BlobGranuleChunkRef& chunk,
 	cur.reserve(streams.size());
 	while (!next.empty()) {
 		cur.clear();
-		cur.push_back(next.top());
-		next.pop();
+		cur.push_back(next.pop());
 
-		// next.top().key == cur.front().key but with suffix comparison
-		while (!next.empty() && cur.front().key.compareSuffix(next.top().key, prefixLen) == 0) {
-			cur.push_back(next.top());
-			next.pop();
+		// next.peekKey() == cur.front().key but with suffix comparison
+		while (!next.empty() && cur.front().key.compareSuffix(next.peekKey(), prefixLen) == 0) {
+			cur.push_back(next.pop());
 		}
 
 		// un-set clears and find latest value for key (if present)
@@ -1455,7 +1519,7 @@ static RangeResult mergeDeltaStreams(const BlobGranuleChunkRef& chunk,
 			}
 		}
 
-		// advance streams and start clearAfter
+		// start clearAfter; the streams were already advanced as they were popped
 		for (auto& it : cur) {
 			if (streams[it.streamIdx][it.dataIdx].clearAfter) {
 				clearActive[it.streamIdx] = true;
@@ -1464,11 +1528,6 @@ static RangeResult mergeDeltaStreams(const BlobGranuleChunkRef& chunk,
 			}
 			// TODO: implement skipping if large clear!!
 			// if (maxClearIdx > it.streamIdx) - skip
-			it.dataIdx++;
-			if (it.dataIdx < streams[it.streamIdx].size()) {
-				it.key = streams[it.streamIdx][it.dataIdx].key;
-				next.push(it);
-			}
 		}
 	}
 
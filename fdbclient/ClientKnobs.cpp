@@ -94,8 +94,14 @@ void ClientKnobs::initialize(Randomize randomize) {
 	init( LOCATION_CACHE_EVICTION_SIZE_SIM,         10 ); if( randomize && BUGGIFY ) LOCATION_CACHE_EVICTION_SIZE_SIM = 3;
 	init( LOCATION_CACHE_ENDPOINT_FAILURE_GRACE_PERIOD,     60 );
 	init( LOCATION_CACHE_FAILED_ENDPOINT_RETRY_INTERVAL,    60 );
+	init( LOCATION_CACHE_PERSIST_FILE,                      "" );
+	init( LOCATION_CACHE_PERSIST_INTERVAL,                 300 ); if( randomize && BUGGIFY ) LOCATION_CACHE_PERSIST_INTERVAL = 10.0;
+	init( LOCATION_CACHE_PERSIST_MAX_AGE,                21600 ); if( randomize && BUGGIFY ) LOCATION_CACHE_PERSIST_MAX_AGE = 60.0;
 	init( TENANT_CACHE_EVICTION_SIZE,           100000 );
 	init( TENANT_CACHE_EVICTION_SIZE_SIM,           10 ); if( randomize && BUGGIFY ) TENANT_CACHE_EVICTION_SIZE_SIM = 3;
+	init( ENABLE_CLIENT_READ_CACHE,              false ); // opt-in: cached reads can be stale by up to READ_CACHE_VERSION_VALIDITY
+	init( READ_CACHE_MAX_ENTRIES,               100000 ); if( randomize && BUGGIFY ) READ_CACHE_MAX_ENTRIES = 10;
+	init( READ_CACHE_VERSION_VALIDITY,             2e6 ); if( randomize && BUGGIFY ) READ_CACHE_VERSION_VALIDITY = 1000;
 
 	init( GET_RANGE_SHARD_LIMIT,                     2 );
 	init( WARM_RANGE_SHARD_LIMIT,                  100 );
@@ -103,12 +109,15 @@ void ClientKnobs::initialize(Randomize randomize) {
 	init( SHARD_COUNT_LIMIT,                        80 ); if( randomize && BUGGIFY ) SHARD_COUNT_LIMIT = 3;
 	init( STORAGE_METRICS_UNFAIR_SPLIT_LIMIT,  2.0/3.0 );
 	init( STORAGE_METRICS_TOO_MANY_SHARDS_DELAY,  15.0 );
+	init( SPECIAL_KEY_METRICS_CACHE_TTL,           1.0 ); if( randomize && BUGGIFY ) SPECIAL_KEY_METRICS_CACHE_TTL = 0.001;
 	init( AGGREGATE_HEALTH_METRICS_MAX_STALENESS,  0.5 );
 	init( DETAILED_HEALTH_METRICS_MAX_STALENESS,   5.0 );
 	init( MID_SHARD_SIZE_MAX_STALENESS,           10.0 );
 	init( TAG_ENCODE_KEY_SERVERS,                false ); if( randomize && BUGGIFY ) TAG_ENCODE_KEY_SERVERS = true;
 	init( RANGESTREAM_FRAGMENT_SIZE,               1e6 );
 	init( RANGESTREAM_BUFFERED_FRAGMENTS_LIMIT,     20 );
+	init( ENABLE_RANGE_PREFETCH,                  true ); if( randomize && BUGGIFY ) ENABLE_RANGE_PREFETCH = false;
+	init( ENABLE_ATOMIC_OP_COALESCING,            true ); if( randomize && BUGGIFY ) ENABLE_ATOMIC_OP_COALESCING = false;
 	init( QUARANTINE_TSS_ON_MISMATCH,             true ); if( randomize && BUGGIFY ) QUARANTINE_TSS_ON_MISMATCH = false; // if true, a tss mismatch will put the offending tss in quarantine. If false, it will just be killed
 	init( CHANGE_FEED_EMPTY_BATCH_TIME,          0.005 );
 	init( SHARD_ENCODE_LOCATION_METADATA,        false ); if( randomize && BUGGIFY )  SHARD_ENCODE_LOCATION_METADATA = true;
@@ -123,6 +132,9 @@ void ClientKnobs::initialize(Randomize randomize) {
 	init( NO_RECENT_UPDATES_DURATION,             20.0 ); if( randomize && BUGGIFY ) NO_RECENT_UPDATES_DURATION = 0.1;
 	init( FAST_WATCH_TIMEOUT,                     20.0 ); if( randomize && BUGGIFY ) FAST_WATCH_TIMEOUT = 1.0;
 	init( WATCH_TIMEOUT,                          30.0 ); if( randomize && BUGGIFY ) WATCH_TIMEOUT = 20.0;
+	init( ENABLE_WATCH_MULTIPLEXING,              true ); if( randomize && BUGGIFY ) ENABLE_WATCH_MULTIPLEXING = false;
+	init( WATCH_MUX_BATCH_DELAY,                  0.01 ); if( randomize && BUGGIFY ) WATCH_MUX_BATCH_DELAY = deterministicRandom()->random01();
+	init( WATCH_MUX_MAX_WATCHES,                  1000 ); if( randomize && BUGGIFY ) WATCH_MUX_MAX_WATCHES = deterministicRandom()->randomInt(1, 4);
 
 	// Core
 	init( CORE_VERSIONSPERSECOND,		           1e6 );
@@ -145,6 +157,7 @@ void ClientKnobs::initialize(Randomize randomize) {
 	init( TASKBUCKET_CHECK_ACTIVE_AMOUNT,           10 );
 	init( TASKBUCKET_TIMEOUT_VERSIONS,     60*CORE_VERSIONSPERSECOND ); if( randomize && BUGGIFY ) TASKBUCKET_TIMEOUT_VERSIONS = 30*CORE_VERSIONSPERSECOND;
 	init( TASKBUCKET_MAX_TASK_KEYS,               1000 ); if( randomize && BUGGIFY ) TASKBUCKET_MAX_TASK_KEYS = 20;
+	init( TASKBUCKET_WATCH_TASK_COUNT,            true ); if( randomize && BUGGIFY ) TASKBUCKET_WATCH_TASK_COUNT = false;
 
 	//Backup
 	init( BACKUP_LOCAL_FILE_WRITE_BLOCK,     1024*1024 );
@@ -181,6 +194,8 @@ void ClientKnobs::initialize(Randomize randomize) {
 	init( SIM_BACKUP_TASKS_PER_AGENT,               10 );
 	init( BACKUP_RANGEFILE_BLOCK_SIZE,      1024 * 1024);
 	init( BACKUP_LOGFILE_BLOCK_SIZE,        1024 * 1024);
+	init( BACKUP_COMPRESSED_LOG_LENGTHS,         false ); if( randomize && BUGGIFY ) BACKUP_COMPRESSED_LOG_LENGTHS = true;
+	init( BACKUP_PREFIX_COMPRESSED_SNAPSHOTS,    false ); if( randomize && BUGGIFY ) BACKUP_PREFIX_COMPRESSED_SNAPSHOTS = true;
 	init( BACKUP_DISPATCH_ADDTASK_SIZE,             50 );
 	init( RESTORE_DISPATCH_ADDTASK_SIZE,           150 );
 	init( RESTORE_DISPATCH_BATCH_SIZE,           30000 ); if( randomize && BUGGIFY ) RESTORE_DISPATCH_BATCH_SIZE = 20;
@@ -190,6 +205,7 @@ void ClientKnobs::initialize(Randomize randomize) {
 	init( APPLY_BLOCK_SIZE,     LOG_RANGE_BLOCK_SIZE/5 );
 	init( APPLY_MAX_DECAY_RATE,                   0.99 );
 	init( APPLY_MAX_INCREASE_FACTOR,               1.1 );
+	init( APPLY_PARALLEL_RANGES,                     4 ); if( randomize && BUGGIFY ) APPLY_PARALLEL_RANGES = deterministicRandom()->randomInt(1, 8);
 	init( BACKUP_ERROR_DELAY,                     10.0 );
 	init( BACKUP_STATUS_DELAY,                    40.0 );
 	init( BACKUP_STATUS_JITTER,                   0.05 );
@@ -215,6 +231,7 @@ void ClientKnobs::initialize(Randomize randomize) {
 	init( BLOBSTORE_CONNECT_TRIES,                  10 );
 	init( BLOBSTORE_CONNECT_TIMEOUT,                10 );
 	init( BLOBSTORE_MAX_CONNECTION_LIFE,           120 );
+	init( BLOBSTORE_MAX_CONNECTION_POOL_SIZE,       64 );
 	init( BLOBSTORE_REQUEST_TRIES,                  10 );
 	init( BLOBSTORE_REQUEST_TIMEOUT_MIN,            60 );
 
@@ -254,9 +271,11 @@ void ClientKnobs::initialize(Randomize randomize) {
 		CSI_SIZE_LIMIT = deterministicRandom()->randomInt(1024 * 1024, 100 * 1024 * 1024); // 1 MB - 100 MB
 	}
 	init(CSI_STATUS_DELAY,						  10.0  );
+	init( TRANSACTION_PROFILE_RING_SIZE,            256 ); if( randomize && BUGGIFY ) TRANSACTION_PROFILE_RING_SIZE = deterministicRandom()->randomInt(0, 8);
 
 	init( CONSISTENCY_CHECK_RATE_LIMIT_MAX,        50e6 ); // Limit in per sec
 	init( CONSISTENCY_CHECK_ONE_ROUND_TARGET_COMPLETION_TIME,	7 * 24 * 60 * 60 ); // 7 days
+	init( CONSISTENCY_CHECK_SHARD_SAMPLE_FACTOR,      1 ); // 1 of every this many shards is checked per round; >1 gives a cheap sampled audit each round (shards are reshuffled every round, so repeated rounds still cover everything)
 
 	//fdbcli
 	init( CLI_CONNECT_PARALLELISM,                  400 );
@@ -283,6 +302,7 @@ void ClientKnobs::initialize(Randomize randomize) {
 	// multi-version client control
 	init( MVC_CLIENTLIB_CHUNK_SIZE,              8*1024 );
 	init( MVC_CLIENTLIB_CHUNKS_PER_TRANSACTION,      32 );
+	init( MVC_LOCAL_TRANSACTION_FASTPATH,          true ); if( randomize && BUGGIFY ) MVC_LOCAL_TRANSACTION_FASTPATH = false;
 
 	// Blob granules
 	init( BG_MAX_GRANULE_PARALLELISM,                10 );
@@ -492,7 +492,27 @@ Value makePadding(int size) {
 //   just be padding anyway.
 struct RangeFileWriter {
 	RangeFileWriter(Reference<IBackupFile> file = Reference<IBackupFile>(), int blockSize = 0)
-	  : file(file), blockSize(blockSize), blockEnd(0), fileVersion(BACKUP_AGENT_SNAPSHOT_FILE_VERSION) {}
+	  : file(file), blockSize(blockSize), blockEnd(0),
+	    fileVersion(CLIENT_KNOBS->BACKUP_PREFIX_COMPRESSED_SNAPSHOTS ? BACKUP_AGENT_SNAPSHOT_FILE_VERSION_V2
+	                                                                 : BACKUP_AGENT_SNAPSHOT_FILE_VERSION) {}
+
+	// Appends a key in the v2 encoding: the length of the prefix shared with the previously
+	// appended key in this block, then the length delimited suffix
+	ACTOR static Future<Void> appendPrefixCompressedKey(RangeFileWriter* self, Key k) {
+		state uint32_t prefixLenBuf = bigEndian32(commonPrefixLength(self->blockPrevKey, k));
+		wait(self->file->append(&prefixLenBuf, sizeof(prefixLenBuf)));
+		wait(self->file->appendStringRefWithLen(k.substr(bigEndian32(prefixLenBuf))));
+		self->blockPrevKey = k;
+		return Void();
+	}
+
+	// Appends a key in whichever encoding this writer's file version uses
+	Future<Void> appendKey(Key k) {
+		if (fileVersion == BACKUP_AGENT_SNAPSHOT_FILE_VERSION_V2) {
+			return appendPrefixCompressedKey(this, k);
+		}
+		return file->appendStringRefWithLen(k);
+	}
 
 	// Handles the first block and internal blocks.  Ends current block if needed.
 	// The final flag is used in simulation to pad the file's final block to a whole block size
@@ -515,10 +535,13 @@ struct RangeFileWriter {
 		// write Header
 		wait(self->file->append((uint8_t*)&self->fileVersion, sizeof(self->fileVersion)));
 
+		// Each block is decoded independently, so the prefix compression chain restarts
+		self->blockPrevKey = Key();
+
 		// If this is NOT the first block then write duplicate stuff needed from last block
 		if (self->blockEnd > self->blockSize) {
-			wait(self->file->appendStringRefWithLen(self->lastKey));
-			wait(self->file->appendStringRefWithLen(self->lastKey));
+			wait(self->appendKey(self->lastKey));
+			wait(self->appendKey(self->lastKey));
 			wait(self->file->appendStringRefWithLen(self->lastValue));
 		}
 
@@ -545,11 +568,20 @@ struct RangeFileWriter {
 		return Void();
 	}
 
+	// Worst case encoded size of a key, assuming it shares no prefix with its predecessor
+	int keySizeNeeded(int keySize) const {
+		int size = sizeof(uint32_t) + keySize;
+		if (fileVersion == BACKUP_AGENT_SNAPSHOT_FILE_VERSION_V2) {
+			size += sizeof(uint32_t);
+		}
+		return size;
+	}
+
 	// Start a new block if needed, then write the key and value
 	ACTOR static Future<Void> writeKV_impl(RangeFileWriter* self, Key k, Value v) {
-		int toWrite = sizeof(int32_t) + k.size() + sizeof(int32_t) + v.size();
+		int toWrite = self->keySizeNeeded(k.size()) + sizeof(int32_t) + v.size();
 		wait(self->newBlockIfNeeded(toWrite));
-		wait(self->file->appendStringRefWithLen(k));
+		wait(self->appendKey(k));
 		wait(self->file->appendStringRefWithLen(v));
 		self->lastKey = k;
 		self->lastValue = v;
@@ -560,9 +592,9 @@ struct RangeFileWriter {
 
 	// Write begin key or end key.
 	ACTOR static Future<Void> writeKey_impl(RangeFileWriter* self, Key k) {
-		int toWrite = sizeof(uint32_t) + k.size();
+		int toWrite = self->keySizeNeeded(k.size());
 		wait(self->newBlockIfNeeded(toWrite));
-		wait(self->file->appendStringRefWithLen(k));
+		wait(self->appendKey(k));
 		return Void();
 	}
 
@@ -576,8 +608,24 @@ private:
 	uint32_t fileVersion;
 	Key lastKey;
 	Key lastValue;
+	Key blockPrevKey; // the previously appended key in the current block, for prefix compression
 };
 
+// Reads a prefix compressed key from a v2 range file block: the length of the prefix shared with
+// the previous key in the block, then the length delimited suffix. The reconstructed key is
+// copied into arena.
+static KeyRef consumePrefixCompressedKey(StringRefReader& reader, KeyRef prevKey, Arena& arena) {
+	uint32_t prefixLen = reader.consumeNetworkUInt32();
+	if (prefixLen > prevKey.size())
+		throw restore_corrupted_data();
+	uint32_t suffixLen = reader.consumeNetworkUInt32();
+	const uint8_t* suffix = reader.consume(suffixLen);
+	StringRef k = makeString(prefixLen + suffixLen, arena);
+	memcpy(mutateString(k), prevKey.begin(), prefixLen);
+	memcpy(mutateString(k) + prefixLen, suffix, suffixLen);
+	return k;
+}
+
 ACTOR Future<Standalone<VectorRef<KeyValueRef>>> decodeRangeFileBlock(Reference<IAsyncFile> file,
                                                                       int64_t offset,
                                                                       int len) {
@@ -592,35 +640,67 @@ ACTOR Future<Standalone<VectorRef<KeyValueRef>>> decodeRangeFileBlock(Reference<
 	state StringRefReader reader(buf, restore_corrupted_data());
 
 	try {
-		// Read header, currently only decoding BACKUP_AGENT_SNAPSHOT_FILE_VERSION
-		if (reader.consume<int32_t>() != BACKUP_AGENT_SNAPSHOT_FILE_VERSION)
+		// Read header, decoding either the plain or the prefix compressed snapshot block format
+		int32_t fileVersion = reader.consume<int32_t>();
+		if (fileVersion != BACKUP_AGENT_SNAPSHOT_FILE_VERSION &&
+		    fileVersion != BACKUP_AGENT_SNAPSHOT_FILE_VERSION_V2)
 			throw restore_unsupported_file_version();
 
-		// Read begin key, if this fails then block was invalid.
-		uint32_t kLen = reader.consumeNetworkUInt32();
-		const uint8_t* k = reader.consume(kLen);
-		results.push_back(results.arena(), KeyValueRef(KeyRef(k, kLen), ValueRef()));
+		if (fileVersion == BACKUP_AGENT_SNAPSHOT_FILE_VERSION) {
+			// Read begin key, if this fails then block was invalid.
+			uint32_t kLen = reader.consumeNetworkUInt32();
+			const uint8_t* k = reader.consume(kLen);
+			results.push_back(results.arena(), KeyValueRef(KeyRef(k, kLen), ValueRef()));
 
-		// Read kv pairs and end key
-		while (1) {
-			// Read a key.
-			kLen = reader.consumeNetworkUInt32();
-			k = reader.consume(kLen);
+			// Read kv pairs and end key
+			while (1) {
+				// Read a key.
+				kLen = reader.consumeNetworkUInt32();
+				k = reader.consume(kLen);
 
-			// If eof reached or first value len byte is 0xFF then a valid block end was reached.
-			if (reader.eof() || *reader.rptr == 0xFF) {
-				results.push_back(results.arena(), KeyValueRef(KeyRef(k, kLen), ValueRef()));
-				break;
+				// If eof reached or first value len byte is 0xFF then a valid block end was reached.
+				if (reader.eof() || *reader.rptr == 0xFF) {
+					results.push_back(results.arena(), KeyValueRef(KeyRef(k, kLen), ValueRef()));
+					break;
+				}
+
+				// Read a value, which must exist or the block is invalid
+				uint32_t vLen = reader.consumeNetworkUInt32();
+				const uint8_t* v = reader.consume(vLen);
+				results.push_back(results.arena(), KeyValueRef(KeyRef(k, kLen), ValueRef(v, vLen)));
+
+				// If eof reached or first byte of next key len is 0xFF then a valid block end was reached.
+				if (reader.eof() || *reader.rptr == 0xFF)
+					break;
 			}
+		} else {
+			// V2: keys are stored as (shared prefix length, suffix); the chain starts from the
+			// empty key at the beginning of each block.
 
-			// Read a value, which must exist or the block is invalid
-			uint32_t vLen = reader.consumeNetworkUInt32();
-			const uint8_t* v = reader.consume(vLen);
-			results.push_back(results.arena(), KeyValueRef(KeyRef(k, kLen), ValueRef(v, vLen)));
+			// Read begin key, if this fails then block was invalid.
+			KeyRef k = consumePrefixCompressedKey(reader, KeyRef(), results.arena());
+			results.push_back(results.arena(), KeyValueRef(k, ValueRef()));
 
-			// If eof reached or first byte of next key len is 0xFF then a valid block end was reached.
-			if (reader.eof() || *reader.rptr == 0xFF)
-				break;
+			// Read kv pairs and end key
+			while (1) {
+				// Read a key.
+				k = consumePrefixCompressedKey(reader, k, results.arena());
+
+				// If eof reached or first value len byte is 0xFF then a valid block end was reached.
+				if (reader.eof() || *reader.rptr == 0xFF) {
+					results.push_back(results.arena(), KeyValueRef(k, ValueRef()));
+					break;
+				}
+
+				// Read a value, which must exist or the block is invalid
+				uint32_t vLen = reader.consumeNetworkUInt32();
+				const uint8_t* v = reader.consume(vLen);
+				results.push_back(results.arena(), KeyValueRef(k, ValueRef(v, vLen)));
+
+				// If eof reached or first byte of next prefix len is 0xFF then a valid block end was reached.
+				if (reader.eof() || *reader.rptr == 0xFF)
+					break;
+			}
 		}
 
 		// Make sure any remaining bytes in the block are 0xFF
@@ -644,15 +724,38 @@ ACTOR Future<Standalone<VectorRef<KeyValueRef>>> decodeRangeFileBlock(Reference<
 
 // Very simple format compared to KeyRange files.
 // Header, [Key, Value]... Key len
+// Lengths are fixed width big endian in BACKUP_AGENT_MLOG_VERSION blocks and CompressedInt
+// encoded in BACKUP_AGENT_MLOG_VERSION_VARINT blocks, chosen at writer creation.
 struct LogFileWriter {
 	LogFileWriter(Reference<IBackupFile> file = Reference<IBackupFile>(), int blockSize = 0)
-	  : file(file), blockSize(blockSize), blockEnd(0) {}
+	  : file(file), blockSize(blockSize), blockEnd(0),
+	    blockVersion(CLIENT_KNOBS->BACKUP_COMPRESSED_LOG_LENGTHS ? BACKUP_AGENT_MLOG_VERSION_VARINT
+	                                                             : BACKUP_AGENT_MLOG_VERSION) {}
 
 	// Start a new block if needed, then write the key and value
 	ACTOR static Future<Void> writeKV_impl(LogFileWriter* self, Key k, Value v) {
-		// If key and value do not fit in this block, end it and start a new one
-		int toWrite = sizeof(int32_t) + k.size() + sizeof(int32_t) + v.size();
-		if (self->file->size() + toWrite > self->blockEnd) {
+		// Serialize the whole record so its exact size is known for the block fit check below.
+		// A CompressedInt encoded length never starts with 0xFF (that would imply a length of
+		// at least 2^50) so the 0xFF padding and block end detection still work.
+		state Value record;
+		{
+			BinaryWriter wr(Unversioned());
+			if (self->blockVersion == BACKUP_AGENT_MLOG_VERSION_VARINT) {
+				wr << CompressedInt<uint32_t>(k.size());
+				wr.serializeBytes(k);
+				wr << CompressedInt<uint32_t>(v.size());
+				wr.serializeBytes(v);
+			} else {
+				wr << bigEndian32((uint32_t)k.size());
+				wr.serializeBytes(k);
+				wr << bigEndian32((uint32_t)v.size());
+				wr.serializeBytes(v);
+			}
+			record = wr.toValue();
+		}
+
+		// If the record does not fit in this block, end it and start a new one
+		if (self->file->size() + record.size() > self->blockEnd) {
 			// Write padding if needed
 			int bytesLeft = self->blockEnd - self->file->size();
 			if (bytesLeft > 0) {
@@ -664,11 +767,10 @@ struct LogFileWriter {
 			self->blockEnd += self->blockSize;
 
 			// write the block header
-			wait(self->file->append((uint8_t*)&BACKUP_AGENT_MLOG_VERSION, sizeof(BACKUP_AGENT_MLOG_VERSION)));
+			wait(self->file->append((uint8_t*)&self->blockVersion, sizeof(self->blockVersion)));
 		}
 
-		wait(self->file->appendStringRefWithLen(k));
-		wait(self->file->appendStringRefWithLen(v));
+		wait(self->file->append(record.begin(), record.size()));
 
 		// At this point we should be in whatever the current block is or the block size is too small
 		if (self->file->size() > self->blockEnd)
@@ -684,6 +786,7 @@ struct LogFileWriter {
 
 private:
 	int64_t blockEnd;
+	uint32_t blockVersion;
 };
 
 ACTOR Future<Standalone<VectorRef<KeyValueRef>>> decodeMutationLogFileBlock(Reference<IAsyncFile> file,
@@ -698,9 +801,11 @@ ACTOR Future<Standalone<VectorRef<KeyValueRef>>> decodeMutationLogFileBlock(Refe
 	state StringRefReader reader(buf, restore_corrupted_data());
 
 	try {
-		// Read header, currently only decoding version BACKUP_AGENT_MLOG_VERSION
-		if (reader.consume<int32_t>() != BACKUP_AGENT_MLOG_VERSION)
+		// Read header, decoding versions BACKUP_AGENT_MLOG_VERSION and BACKUP_AGENT_MLOG_VERSION_VARINT
+		uint32_t version = (uint32_t)reader.consume<int32_t>();
+		if (version != BACKUP_AGENT_MLOG_VERSION && version != BACKUP_AGENT_MLOG_VERSION_VARINT)
 			throw restore_unsupported_file_version();
+		bool varintLengths = version == BACKUP_AGENT_MLOG_VERSION_VARINT;
 
 		// Read k/v pairs.  Block ends either at end of last value exactly or with 0xFF as first key len byte.
 		while (1) {
@@ -709,9 +814,9 @@ ACTOR Future<Standalone<VectorRef<KeyValueRef>>> decodeMutationLogFileBlock(Refe
 				break;
 
 			// Read key and value.  If anything throws then there is a problem.
-			uint32_t kLen = reader.consumeNetworkUInt32();
+			uint32_t kLen = varintLengths ? reader.consumeCompressedUInt() : reader.consumeNetworkUInt32();
 			const uint8_t* k = reader.consume(kLen);
-			uint32_t vLen = reader.consumeNetworkUInt32();
+			uint32_t vLen = varintLengths ? reader.consumeCompressedUInt() : reader.consumeNetworkUInt32();
 			const uint8_t* v = reader.consume(vLen);
 
 			results.push_back(results.arena(), KeyValueRef(KeyRef(k, kLen), ValueRef(v, vLen)));
@@ -1185,12 +1290,28 @@ struct BackupRangeTaskFunc : BackupTaskFuncBase {
 		if (beginKey == endKey)
 			return Void();
 
-		// Find out if there is a shard boundary in(beginKey, endKey)
-		Standalone<VectorRef<KeyRef>> keys = wait(runRYWTransaction(
-		    cx, [=](Reference<ReadYourWritesTransaction> tr) { return getBlockOfShards(tr, beginKey, endKey, 1); }));
-		if (keys.size() > 0) {
-			Params.addBackupRangeTasks().set(task, true);
-			return Void();
+		// Find out if there is a shard boundary in (beginKey, endKey). The snapshot dispatcher creates tasks
+		// aligned to the shard boundaries it read at dispatch time, so the client's location cache can usually
+		// answer this without a read of the shard map. The cache can be stale, but so can a shard map read by
+		// the time the range is actually read, and a wrong answer here only affects read locality and task
+		// sizing, not correctness.
+		state bool checkedShardBoundary = false;
+		std::vector<KeyRangeLocationInfo> cachedLocations;
+		if (cx->getCachedLocations(
+		        Optional<TenantNameRef>(), KeyRangeRef(beginKey, endKey), cachedLocations, 2, Reverse::False)) {
+			checkedShardBoundary = true;
+			if (cachedLocations.size() > 1) {
+				Params.addBackupRangeTasks().set(task, true);
+				return Void();
+			}
+		}
+		if (!checkedShardBoundary) {
+			Standalone<VectorRef<KeyRef>> keys = wait(runRYWTransaction(
+			    cx, [=](Reference<ReadYourWritesTransaction> tr) { return getBlockOfShards(tr, beginKey, endKey, 1); }));
+			if (keys.size() > 0) {
+				Params.addBackupRangeTasks().set(task, true);
+				return Void();
+			}
 		}
 
 		// Read everything from beginKey to endKey, write it to an output file, run the output file processor, and
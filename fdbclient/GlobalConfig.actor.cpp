@@ -37,6 +37,39 @@ const KeyRef transactionTagSampleCost = LiteralStringRef("config/transaction_tag
 const KeyRef samplingFrequency = LiteralStringRef("visibility/sampling/frequency");
 const KeyRef samplingWindow = LiteralStringRef("visibility/sampling/window");
 
+const KeyRef traceSeverityPrefix = LiteralStringRef("trace/severity/");
+const KeyRef traceRateLimitPrefix = LiteralStringRef("trace/rate_limit/");
+
+void traceSeverityUpdated(KeyRef key, std::optional<std::any> value) {
+	std::string type = key.removePrefix(traceSeverityPrefix).toString();
+	if (!value.has_value()) {
+		clearTraceTypeSeverity(type);
+	} else if (auto* severity = std::any_cast<int64_t>(&value.value())) {
+		setTraceTypeSeverity(type, *severity);
+	} else {
+		TraceEvent(SevWarnAlways, "InvalidTraceSeverityValue").detail("TraceType", type);
+	}
+}
+
+void traceRateLimitUpdated(KeyRef key, std::optional<std::any> value) {
+	std::string type = key.removePrefix(traceRateLimitPrefix).toString();
+	if (!value.has_value()) {
+		clearTraceTypeRateLimit(type);
+		return;
+	}
+	double eventsPerSecond;
+	if (auto* i = std::any_cast<int64_t>(&value.value())) {
+		eventsPerSecond = *i;
+	} else if (auto* d = std::any_cast<double>(&value.value())) {
+		eventsPerSecond = *d;
+	} else {
+		TraceEvent(SevWarnAlways, "InvalidTraceRateLimitValue").detail("TraceType", type);
+		return;
+	}
+	// Allow up to one second worth of events back-to-back after a quiet period
+	setTraceTypeRateLimit(type, eventsPerSecond, std::max(1.0, eventsPerSecond));
+}
+
 GlobalConfig::GlobalConfig(DatabaseContext* cx) : cx(cx), lastUpdate(0) {}
 
 void GlobalConfig::applyChanges(Transaction& tr,
@@ -100,6 +133,10 @@ void GlobalConfig::trigger(KeyRef key, std::function<void(std::optional<std::any
 	callbacks.emplace(key, std::move(fn));
 }
 
+void GlobalConfig::triggerRange(KeyRef prefix, std::function<void(KeyRef, std::optional<std::any>)> fn) {
+	rangeCallbacks.emplace_back(prefix, std::move(fn));
+}
+
 void GlobalConfig::insert(KeyRef key, ValueRef value) {
 	// TraceEvent(SevInfo, "GlobalConfigInsert").detail("Key", key).detail("Value", value);
 	data.erase(key);
@@ -129,6 +166,11 @@ void GlobalConfig::insert(KeyRef key, ValueRef value) {
 		if (callbacks.find(stableKey) != callbacks.end()) {
 			callbacks[stableKey](data[stableKey]->value);
 		}
+		for (const auto& [prefix, fn] : rangeCallbacks) {
+			if (stableKey.startsWith(prefix)) {
+				fn(stableKey, data[stableKey]->value);
+			}
+		}
 	} catch (Error& e) {
 		TraceEvent(SevWarn, "GlobalConfigTupleParseError").detail("What", e.what());
 	}
@@ -146,6 +188,11 @@ void GlobalConfig::erase(KeyRangeRef range) {
 			if (callbacks.find(it->first) != callbacks.end()) {
 				callbacks[it->first](std::nullopt);
 			}
+			for (const auto& [prefix, fn] : rangeCallbacks) {
+				if (it->first.startsWith(prefix)) {
+					fn(it->first, std::nullopt);
+				}
+			}
 			it = data.erase(it);
 		} else {
 			++it;
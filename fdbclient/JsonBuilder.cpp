@@ -28,6 +28,31 @@ JsonBuilderObject JsonBuilder::makeMessage(const char* name, const char* descrip
 	return out;
 }
 
+Standalone<StringRef> JsonBuilder::toStringRef() const {
+	Standalone<StringRef> result = makeString(getFinalLength());
+	uint8_t* wptr = mutateString(result);
+	for (auto& it : jsonText) {
+		memcpy(wptr, it.begin(), it.size());
+		wptr += it.size();
+	}
+	const char* end = getEnd();
+	memcpy(wptr, end, strlen(end));
+	return result;
+}
+
+JsonString JsonBuilder::fromRawJson(Standalone<StringRef> const& json) {
+	JsonString result;
+	if (json.size() == 0) {
+		return result;
+	}
+	result.type = RAW;
+	result.elements = 1;
+	result.bytes = json.size();
+	result.jsonText.back() = VString((char*)json.begin(), json.size());
+	result.arena.dependsOn(json.arena());
+	return result;
+}
+
 // dst must have at least len + 3 bytes available (".e" becomes "0.0e0")
 // Returns bytes written, or 0 on failure.
 int JsonBuilder::coerceAsciiNumberToJSON(const char* s, int len, char* dst) {
@@ -23,6 +23,7 @@
 #include "fdbclient/CommitTransaction.h"
 #include "fdbclient/FDBTypes.h"
 #include "fdbclient/ReadYourWrites.h"
+#include "flow/UnitTest.h"
 #include "flow/actorcompiler.h" // has to be last include
 
 void KeyRangeActorMap::getRangesAffectedByInsertion(const KeyRangeRef& keys, std::vector<KeyRange>& affectedRanges) {
@@ -254,3 +255,39 @@ Future<Void> krmSetRangeCoalescing(Reference<ReadYourWritesTransaction> const& t
                                    Value const& value) {
 	return holdWhile(tr, krmSetRangeCoalescing_(tr.getPtr(), mapPrefix, range, maxRange, value));
 }
+
+TEST_CASE("/fdbclient/keyrangemap/snapshot") {
+	KeyRangeMap<int> map(0);
+	map.insert(KeyRangeRef("b"_sr, "d"_sr), 1);
+	map.insert(KeyRangeRef("d"_sr, "f"_sr), 2);
+	map.insert(KeyRangeRef("h"_sr, "j"_sr), 3);
+
+	KeyRangeMapSnapshot<int> snapshot;
+	ASSERT(!snapshot.upToDate(map));
+	snapshot.rebuild(map);
+	ASSERT(snapshot.upToDate(map));
+
+	// The snapshot must agree with the map for every boundary and interior key
+	for (auto& key : { ""_sr, "a"_sr, "b"_sr, "c"_sr, "d"_sr, "e"_sr, "f"_sr, "g"_sr, "h"_sr, "i"_sr, "j"_sr }) {
+		auto r = map.rangeContaining(key);
+		int i = snapshot.rangeContaining(key);
+		ASSERT(snapshot.rangeAt(i) == r.range());
+		ASSERT(snapshot.valueAt(i) == r.value());
+
+		auto rb = map.rangeContainingKeyBefore(key);
+		int ib = snapshot.rangeContainingKeyBefore(key);
+		ASSERT(snapshot.rangeAt(ib) == rb.range());
+		ASSERT(snapshot.valueAt(ib) == rb.value());
+	}
+
+	// Any mutation invalidates the snapshot
+	map.insert(KeyRangeRef("j"_sr, "k"_sr), 4);
+	ASSERT(!snapshot.upToDate(map));
+	snapshot.rebuild(map);
+	ASSERT(snapshot.upToDate(map));
+	ASSERT(snapshot.valueAt(snapshot.rangeContaining("j"_sr)) == 4);
+
+	return Void();
+}
+
+void forceLinkKeyRangeMapTests() {}
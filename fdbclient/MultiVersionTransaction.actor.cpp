@@ -25,6 +25,7 @@
 #include "fdbclient/FDBOptions.g.h"
 #include "fdbclient/FDBTypes.h"
 #include "fdbclient/GenericManagementAPI.actor.h"
+#include "fdbclient/Knobs.h"
 #include "fdbclient/MultiVersionTransaction.h"
 #include "fdbclient/MultiVersionAssignmentVars.h"
 #include "fdbclient/ClientVersion.h"
@@ -192,6 +193,42 @@ ThreadFuture<MappedRangeResult> DLTransaction::getMappedRange(const KeySelectorR
 	});
 }
 
+Reference<ITransactionRangeStream> DLTransaction::getRangeStream(const KeySelectorRef& begin,
+                                                                 const KeySelectorRef& end,
+                                                                 bool snapshot) {
+	if (!api->transactionGetRangeStream) {
+		// Loaded client library predates the streaming API
+		throw unsupported_operation();
+	}
+
+	FdbCApi::FDBRangeStream* stream = api->transactionGetRangeStream(tr,
+	                                                                 begin.getKey().begin(),
+	                                                                 begin.getKey().size(),
+	                                                                 begin.orEqual,
+	                                                                 begin.offset,
+	                                                                 end.getKey().begin(),
+	                                                                 end.getKey().size(),
+	                                                                 end.orEqual,
+	                                                                 end.offset,
+	                                                                 snapshot);
+	return makeReference<DLTransactionRangeStream>(api, stream);
+}
+
+ThreadFuture<RangeResult> DLTransactionRangeStream::nextFragment() {
+	FdbCApi::FDBFuture* f = api->rangeStreamNextFragment(stream);
+
+	return toThreadFuture<RangeResult>(api, f, [](FdbCApi::FDBFuture* f, FdbCApi* api) {
+		const FdbCApi::FDBKeyValue* kvs;
+		int count;
+		FdbCApi::fdb_bool_t more;
+		FdbCApi::fdb_error_t error = api->futureGetKeyValueArray(f, &kvs, &count, &more);
+		ASSERT(!error);
+
+		// The memory for this is stored in the FDBFuture and is released when the future gets destroyed
+		return RangeResult(RangeResultRef(VectorRef<KeyValueRef>((KeyValueRef*)kvs, count), more), Arena());
+	});
+}
+
 ThreadFuture<Standalone<VectorRef<const char*>>> DLTransaction::getAddressesForKey(const KeyRef& key) {
 	FdbCApi::FDBFuture* f = api->transactionGetAddressesForKey(tr, key.begin(), key.size());
 
@@ -696,6 +733,12 @@ void DLApi::init() {
 	loadClientFunction(&api->transactionGetRange, lib, fdbCPath, "fdb_transaction_get_range", headerVersion >= 0);
 	loadClientFunction(
 	    &api->transactionGetMappedRange, lib, fdbCPath, "fdb_transaction_get_mapped_range", headerVersion >= 710);
+	loadClientFunction(
+	    &api->transactionGetRangeStream, lib, fdbCPath, "fdb_transaction_get_range_stream", headerVersion >= 720);
+	loadClientFunction(
+	    &api->rangeStreamNextFragment, lib, fdbCPath, "fdb_range_stream_next_fragment", headerVersion >= 720);
+	loadClientFunction(&api->rangeStreamCancel, lib, fdbCPath, "fdb_range_stream_cancel", headerVersion >= 720);
+	loadClientFunction(&api->rangeStreamDestroy, lib, fdbCPath, "fdb_range_stream_destroy", headerVersion >= 720);
 	loadClientFunction(
 	    &api->transactionGetVersionstamp, lib, fdbCPath, "fdb_transaction_get_versionstamp", headerVersion >= 410);
 	loadClientFunction(&api->transactionSet, lib, fdbCPath, "fdb_transaction_set", headerVersion >= 0);
@@ -1034,6 +1077,38 @@ ThreadFuture<MappedRangeResult> MultiVersionTransaction::getMappedRange(const Ke
 	return abortableFuture(f, tr.onChange);
 }
 
+ThreadFuture<RangeResult> MultiVersionTransactionRangeStream::nextFragment() {
+	if (creationError.present()) {
+		return ThreadFuture<RangeResult>(creationError.get());
+	}
+	if (!underlying) {
+		// There was no connected client when the stream was created; wait for the version monitor
+		// to switch clients, at which point the caller retries through onError
+		return abortableFuture(ThreadFuture<RangeResult>(Never()), onChange);
+	}
+	return abortableFuture(underlying->nextFragment(), onChange);
+}
+
+Reference<ITransactionRangeStream> MultiVersionTransaction::getRangeStream(const KeySelectorRef& begin,
+                                                                           const KeySelectorRef& end,
+                                                                           bool snapshot) {
+	auto tr = getTransaction();
+	if (!tr.transaction) {
+		return makeReference<MultiVersionTransactionRangeStream>(
+		    Reference<ITransaction>(), Reference<ITransactionRangeStream>(), tr.onChange, Optional<Error>());
+	}
+
+	try {
+		return makeReference<MultiVersionTransactionRangeStream>(
+		    tr.transaction, tr.transaction->getRangeStream(begin, end, snapshot), tr.onChange, Optional<Error>());
+	} catch (Error& e) {
+		// e.g. the loaded client library predates the streaming API; surface the error through the
+		// fragment futures rather than throwing across the C boundary
+		return makeReference<MultiVersionTransactionRangeStream>(
+		    tr.transaction, Reference<ITransactionRangeStream>(), tr.onChange, Optional<Error>(e));
+	}
+}
+
 ThreadFuture<Standalone<StringRef>> MultiVersionTransaction::getVersionstamp() {
 	auto tr = getTransaction();
 	auto f = tr.transaction ? tr.transaction->getVersionstamp() : makeTimeout<Standalone<StringRef>>();
@@ -1496,6 +1571,17 @@ Reference<ITenant> MultiVersionDatabase::openTenant(TenantNameRef tenantName) {
 }
 
 Reference<ITransaction> MultiVersionDatabase::createTransaction() {
+	// With no external client libraries loaded, the connection can never be handed off to a different
+	// client, so the multi-version wrapper only adds a lock acquisition and an abortable future
+	// allocation to every operation. Hand out transactions from the wrapped database directly; it
+	// already carries the database-level transaction defaults set through setOption.
+	if (CLIENT_KNOBS->MVC_LOCAL_TRANSACTION_FASTPATH && !MultiVersionApi::api->hasExternalClients()) {
+		auto currentDb = dbState->dbVar->get();
+		if (currentDb.value) {
+			return currentDb.value->createTransaction();
+		}
+	}
+
 	return Reference<ITransaction>(new MultiVersionTransaction(Reference<MultiVersionDatabase>::addRef(this),
 	                                                           Optional<Reference<MultiVersionTenant>>(),
 	                                                           dbState->transactionDefaultOptions));
@@ -1956,6 +2042,11 @@ Reference<ClientInfo> MultiVersionApi::getLocalClient() {
 	return localClient;
 }
 
+bool MultiVersionApi::hasExternalClients() {
+	MutexHolder holder(lock);
+	return !externalClientDescriptions.empty();
+}
+
 void MultiVersionApi::selectApiVersion(int apiVersion) {
 	if (!localClient) {
 		localClient = makeReference<ClientInfo>(getLocalClientAPI());
@@ -183,6 +183,10 @@ void DatabaseContext::addTssMapping(StorageServerInterface const& ssi, StorageSe
 		                             TSSEndpointData(tssi.id(), tssi.getValue.getEndpoint(), metrics));
 		queueModel.updateTssEndpoint(ssi.getKey.getEndpoint().token.first(),
 		                             TSSEndpointData(tssi.id(), tssi.getKey.getEndpoint(), metrics));
+		queueModel.updateTssEndpoint(ssi.getMultipleKeys.getEndpoint().token.first(),
+		                             TSSEndpointData(tssi.id(), tssi.getMultipleKeys.getEndpoint(), metrics));
+		queueModel.updateTssEndpoint(ssi.getMultipleValues.getEndpoint().token.first(),
+		                             TSSEndpointData(tssi.id(), tssi.getMultipleValues.getEndpoint(), metrics));
 		queueModel.updateTssEndpoint(ssi.getKeyValues.getEndpoint().token.first(),
 		                             TSSEndpointData(tssi.id(), tssi.getKeyValues.getEndpoint(), metrics));
 		queueModel.updateTssEndpoint(ssi.getMappedKeyValues.getEndpoint().token.first(),
@@ -209,6 +213,8 @@ void DatabaseContext::removeTssMapping(StorageServerInterface const& ssi) {
 		tssMapping.erase(result);
 		queueModel.removeTssEndpoint(ssi.getValue.getEndpoint().token.first());
 		queueModel.removeTssEndpoint(ssi.getKey.getEndpoint().token.first());
+		queueModel.removeTssEndpoint(ssi.getMultipleKeys.getEndpoint().token.first());
+		queueModel.removeTssEndpoint(ssi.getMultipleValues.getEndpoint().token.first());
 		queueModel.removeTssEndpoint(ssi.getKeyValues.getEndpoint().token.first());
 		queueModel.removeTssEndpoint(ssi.getMappedKeyValues.getEndpoint().token.first());
 		queueModel.removeTssEndpoint(ssi.getKeyValuesStream.getEndpoint().token.first());
@@ -467,6 +473,16 @@ void DatabaseContext::validateVersion(Version version) const {
 	ASSERT(version > 0 || version == latestVersion);
 }
 
+void DatabaseContext::recordTransactionProfile(const std::string& identifier, StringRef chunk) {
+	if (CLIENT_KNOBS->TRANSACTION_PROFILE_RING_SIZE <= 0) {
+		return;
+	}
+	transactionProfileRing.push_back({ transactionProfileSeq++, identifier, Standalone<StringRef>(chunk) });
+	while (transactionProfileRing.size() > (size_t)CLIENT_KNOBS->TRANSACTION_PROFILE_RING_SIZE) {
+		transactionProfileRing.pop_front();
+	}
+}
+
 void validateOptionValuePresent(Optional<StringRef> value) {
 	if (!value.present()) {
 		throw invalid_option_value();
@@ -595,8 +611,100 @@ ACTOR Future<Void> tssLogger(DatabaseContext* cx) {
 	}
 }
 
+// On-disk snapshot format for the optional persisted location cache (see LOCATION_CACHE_PERSIST_FILE).
+// Only the serializable projection of each cache entry (the range and its storage server interfaces)
+// is written; LocationInfo holds live endpoint state and is rebuilt through setCachedLocation() when
+// the snapshot is loaded. Entries that went stale while the snapshot sat on disk are corrected by the
+// normal wrong_shard_server invalidation path on first use.
+struct PersistedLocationCacheEntry {
+	constexpr static FileIdentifier file_identifier = 13331401;
+
+	KeyRange range;
+	std::vector<StorageServerInterface> servers;
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, range, servers);
+	}
+};
+
+struct PersistedLocationCache {
+	constexpr static FileIdentifier file_identifier = 13331402;
+
+	Key clusterKey;
+	double writeTime = 0;
+	std::vector<PersistedLocationCacheEntry> entries;
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, clusterKey, writeTime, entries);
+	}
+};
+
+static void persistLocationCache(DatabaseContext* cx) {
+	if (!cx->getConnectionRecord()) {
+		return;
+	}
+	PersistedLocationCache snapshot;
+	snapshot.clusterKey = cx->getConnectionRecord()->getConnectionString().clusterKeyName();
+	snapshot.writeTime = g_network->timer();
+	for (auto& r : cx->locationCache.ranges()) {
+		// Storage cache interfaces are registered through a different path; don't persist them
+		if (!r.value() || r.value()->hasCaches) {
+			continue;
+		}
+		PersistedLocationCacheEntry entry;
+		entry.range = KeyRange(r.range());
+		for (int i = 0; i < r.value()->size(); i++) {
+			entry.servers.push_back(r.value()->getInterface(i));
+		}
+		snapshot.entries.push_back(std::move(entry));
+	}
+	try {
+		Value serialized = ObjectWriter::toValue(snapshot, IncludeVersion());
+		atomicReplace(CLIENT_KNOBS->LOCATION_CACHE_PERSIST_FILE, serialized.toString(), false);
+		TraceEvent("LocationCachePersisted", cx->dbId).detail("Entries", snapshot.entries.size());
+	} catch (Error& e) {
+		// A failed snapshot only costs a later process a cold cache
+		TraceEvent(SevWarnAlways, "LocationCachePersistError", cx->dbId)
+		    .error(e)
+		    .detail("File", CLIENT_KNOBS->LOCATION_CACHE_PERSIST_FILE);
+	}
+}
+
+static void loadPersistedLocationCache(DatabaseContext* cx) {
+	std::string const& path = CLIENT_KNOBS->LOCATION_CACHE_PERSIST_FILE;
+	if (!cx->getConnectionRecord() || !fileExists(path)) {
+		return;
+	}
+	try {
+		std::string bytes = readFileBytes(path, 100 << 20);
+		PersistedLocationCache snapshot =
+		    ObjectReader::fromStringRef<PersistedLocationCache>(StringRef(bytes), IncludeVersion());
+		if (snapshot.clusterKey != cx->getConnectionRecord()->getConnectionString().clusterKeyName()) {
+			TraceEvent(SevWarn, "LocationCacheSnapshotWrongCluster", cx->dbId)
+			    .detail("SnapshotClusterKey", snapshot.clusterKey)
+			    .detail("ClusterKey", cx->getConnectionRecord()->getConnectionString().clusterKeyName());
+			return;
+		}
+		if (g_network->timer() - snapshot.writeTime > CLIENT_KNOBS->LOCATION_CACHE_PERSIST_MAX_AGE) {
+			TraceEvent("LocationCacheSnapshotTooOld", cx->dbId)
+			    .detail("AgeSeconds", g_network->timer() - snapshot.writeTime);
+			return;
+		}
+		for (auto& entry : snapshot.entries) {
+			cx->setCachedLocation(Optional<TenantNameRef>(), TenantMapEntry(), entry.range, entry.servers);
+		}
+		TraceEvent("LocationCacheSnapshotLoaded", cx->dbId).detail("Entries", snapshot.entries.size());
+	} catch (Error& e) {
+		// An unreadable or incompatible snapshot is equivalent to a cold cache
+		TraceEvent(SevWarn, "LocationCacheSnapshotLoadError", cx->dbId).error(e).detail("File", path);
+	}
+}
+
 ACTOR Future<Void> databaseLogger(DatabaseContext* cx) {
 	state double lastLogged = 0;
+	state double lastPersisted = now();
 	loop {
 		wait(delay(CLIENT_KNOBS->SYSTEM_MONITOR_INTERVAL, TaskPriority::FlushTrace));
 
@@ -611,6 +719,7 @@ ACTOR Future<Void> databaseLogger(DatabaseContext* cx) {
 			    .detail("Internal", cx->internal);
 
 			cx->cc.logToTraceEvent(ev);
+			cx->queueModel.cc.logToTraceEvent(ev);
 
 			ev.detail("LocationCacheEntryCount", cx->locationCache.size());
 			ev.detail("MeanLatency", cx->latencies.mean())
@@ -634,6 +743,16 @@ ACTOR Future<Void> databaseLogger(DatabaseContext* cx) {
 			    .detail("MedianBytesPerCommit", cx->bytesPerCommit.median())
 			    .detail("MaxBytesPerCommit", cx->bytesPerCommit.max())
 			    .detail("NumLocalityCacheEntries", cx->locationCache.size());
+			auto formatSkew = [](const int64_t* buckets) {
+				std::string s;
+				for (int i = 0; i < DatabaseContext::WORKLOAD_SKEW_BUCKETS; i++) {
+					if (i)
+						s += ',';
+					s += std::to_string(buckets[i]);
+				}
+				return s;
+			};
+			ev.detail("ReadKeySkew", formatSkew(cx->readKeySkew)).detail("WriteKeySkew", formatSkew(cx->writeKeySkew));
 			if (cx->anyBlobGranuleRequests) {
 				ev.detail("MeanBGLatency", cx->bgLatencies.mean())
 				    .detail("MedianBGLatency", cx->bgLatencies.median())
@@ -652,6 +771,14 @@ ACTOR Future<Void> databaseLogger(DatabaseContext* cx) {
 		cx->bytesPerCommit.clear();
 		cx->bgLatencies.clear();
 		cx->bgGranulesPerRequest.clear();
+		std::fill(cx->readKeySkew, cx->readKeySkew + DatabaseContext::WORKLOAD_SKEW_BUCKETS, 0);
+		std::fill(cx->writeKeySkew, cx->writeKeySkew + DatabaseContext::WORKLOAD_SKEW_BUCKETS, 0);
+
+		if (!CLIENT_KNOBS->LOCATION_CACHE_PERSIST_FILE.empty() &&
+		    now() - lastPersisted > CLIENT_KNOBS->LOCATION_CACHE_PERSIST_INTERVAL) {
+			persistLocationCache(cx);
+			lastPersisted = now();
+		}
 
 		lastLogged = now();
 	}
@@ -1277,6 +1404,7 @@ void DatabaseContext::registerSpecialKeysImpl(SpecialKeySpace::MODULE module,
 
 ACTOR Future<RangeResult> getWorkerInterfaces(Reference<IClusterConnectionRecord> clusterRecord);
 ACTOR Future<Optional<Value>> getJSON(Database db);
+ACTOR Future<Optional<Value>> getRecruitmentDryRun(Reference<IClusterConnectionRecord> clusterRecord);
 
 struct WorkerInterfacesSpecialKeyImpl : SpecialKeyRangeReadImpl {
 	Future<RangeResult> getRange(ReadYourWritesTransaction* ryw,
@@ -1465,8 +1593,10 @@ DatabaseContext::DatabaseContext(Reference<AsyncVar<Reference<IClusterConnection
     transactionImmediateReadVersionsCompleted("ImmediatePriorityReadVersionsCompleted", cc),
     transactionLogicalReads("LogicalUncachedReads", cc), transactionPhysicalReads("PhysicalReadRequests", cc),
     transactionPhysicalReadsCompleted("PhysicalReadRequestsCompleted", cc),
+    transactionReadCacheHits("ReadCacheHits", cc), transactionReadCacheMisses("ReadCacheMisses", cc),
     transactionGetKeyRequests("GetKeyRequests", cc), transactionGetValueRequests("GetValueRequests", cc),
     transactionGetRangeRequests("GetRangeRequests", cc),
+    transactionGetRangePrefetches("GetRangePrefetches", cc),
     transactionGetMappedRangeRequests("GetMappedRangeRequests", cc),
     transactionGetRangeStreamRequests("GetRangeStreamRequests", cc), transactionWatchRequests("WatchRequests", cc),
     transactionGetAddressesForKeyRequests("GetAddressesForKeyRequests", cc), transactionBytesRead("BytesRead", cc),
@@ -1474,6 +1604,7 @@ DatabaseContext::DatabaseContext(Reference<AsyncVar<Reference<IClusterConnection
     transactionCommittedMutations("CommittedMutations", cc),
     transactionCommittedMutationBytes("CommittedMutationBytes", cc), transactionSetMutations("SetMutations", cc),
     transactionClearMutations("ClearMutations", cc), transactionAtomicMutations("AtomicMutations", cc),
+    transactionAtomicOpsCoalesced("AtomicOpsCoalesced", cc),
     transactionsCommitStarted("CommitStarted", cc), transactionsCommitCompleted("CommitCompleted", cc),
     transactionKeyServerLocationRequests("KeyServerLocationRequests", cc),
     transactionKeyServerLocationRequestsCompleted("KeyServerLocationRequestsCompleted", cc),
@@ -1511,6 +1642,9 @@ DatabaseContext::DatabaseContext(Reference<AsyncVar<Reference<IClusterConnection
 	                                             : CLIENT_KNOBS->LOCATION_CACHE_EVICTION_SIZE;
 	tenantCacheSize = g_network->isSimulated() ? CLIENT_KNOBS->TENANT_CACHE_EVICTION_SIZE_SIM
 	                                           : CLIENT_KNOBS->TENANT_CACHE_EVICTION_SIZE;
+	if (!CLIENT_KNOBS->LOCATION_CACHE_PERSIST_FILE.empty()) {
+		loadPersistedLocationCache(this);
+	}
 
 	getValueSubmitted.init(LiteralStringRef("NativeAPI.GetValueSubmitted"));
 	getValueCompleted.init(LiteralStringRef("NativeAPI.GetValueCompleted"));
@@ -1633,6 +1767,18 @@ DatabaseContext::DatabaseContext(Reference<AsyncVar<Reference<IClusterConnection
 		    std::make_unique<CoordinatorsAutoImpl>(
 		        singleKeyRange(LiteralStringRef("auto_coordinators"))
 		            .withPrefix(SpecialKeySpace::getModuleRange(SpecialKeySpace::MODULE::MANAGEMENT).begin)));
+		registerSpecialKeysImpl(
+		    SpecialKeySpace::MODULE::MANAGEMENT,
+		    SpecialKeySpace::IMPLTYPE::READONLY,
+		    std::make_unique<SingleSpecialKeyImpl>(
+		        LiteralStringRef("recruitment_dry_run")
+		            .withPrefix(SpecialKeySpace::getModuleRange(SpecialKeySpace::MODULE::MANAGEMENT).begin),
+		        [](ReadYourWritesTransaction* ryw) -> Future<Optional<Value>> {
+			        if (ryw->getDatabase().getPtr() && ryw->getDatabase()->getConnectionRecord()) {
+				        return getRecruitmentDryRun(ryw->getDatabase()->getConnectionRecord());
+			        }
+			        return Optional<Value>();
+		        }));
 		registerSpecialKeysImpl(
 		    SpecialKeySpace::MODULE::MANAGEMENT,
 		    SpecialKeySpace::IMPLTYPE::READWRITE,
@@ -1664,6 +1810,10 @@ DatabaseContext::DatabaseContext(Reference<AsyncVar<Reference<IClusterConnection
 		    std::make_unique<DataDistributionImpl>(
 		        KeyRangeRef(LiteralStringRef("data_distribution/"), LiteralStringRef("data_distribution0"))
 		            .withPrefix(SpecialKeySpace::getModuleRange(SpecialKeySpace::MODULE::MANAGEMENT).begin)));
+		registerSpecialKeysImpl(SpecialKeySpace::MODULE::TRANSACTIONPROFILE,
+		                        SpecialKeySpace::IMPLTYPE::READONLY,
+		                        std::make_unique<TransactionProfileRingImpl>(
+		                            SpecialKeySpace::getModuleRange(SpecialKeySpace::MODULE::TRANSACTIONPROFILE)));
 		registerSpecialKeysImpl(
 		    SpecialKeySpace::MODULE::ACTORLINEAGE,
 		    SpecialKeySpace::IMPLTYPE::READONLY,
@@ -1686,6 +1836,12 @@ DatabaseContext::DatabaseContext(Reference<AsyncVar<Reference<IClusterConnection
 		registerSpecialKeysImpl(SpecialKeySpace::MODULE::METRICS,
 		                        SpecialKeySpace::IMPLTYPE::READONLY,
 		                        std::make_unique<DDStatsRangeImpl>(ddStatsRange));
+		registerSpecialKeysImpl(SpecialKeySpace::MODULE::METRICS,
+		                        SpecialKeySpace::IMPLTYPE::READONLY,
+		                        std::make_unique<HotKeyMetricsImpl>(hotKeyMetricsRange));
+		registerSpecialKeysImpl(SpecialKeySpace::MODULE::METRICS,
+		                        SpecialKeySpace::IMPLTYPE::READONLY,
+		                        std::make_unique<ShardCountsImpl>(shardCountsRange));
 		registerSpecialKeysImpl(
 		    SpecialKeySpace::MODULE::METRICS,
 		    SpecialKeySpace::IMPLTYPE::READONLY,
@@ -1764,8 +1920,10 @@ DatabaseContext::DatabaseContext(const Error& err)
     transactionImmediateReadVersionsCompleted("ImmediatePriorityReadVersionsCompleted", cc),
     transactionLogicalReads("LogicalUncachedReads", cc), transactionPhysicalReads("PhysicalReadRequests", cc),
     transactionPhysicalReadsCompleted("PhysicalReadRequestsCompleted", cc),
+    transactionReadCacheHits("ReadCacheHits", cc), transactionReadCacheMisses("ReadCacheMisses", cc),
     transactionGetKeyRequests("GetKeyRequests", cc), transactionGetValueRequests("GetValueRequests", cc),
     transactionGetRangeRequests("GetRangeRequests", cc),
+    transactionGetRangePrefetches("GetRangePrefetches", cc),
     transactionGetMappedRangeRequests("GetMappedRangeRequests", cc),
     transactionGetRangeStreamRequests("GetRangeStreamRequests", cc), transactionWatchRequests("WatchRequests", cc),
     transactionGetAddressesForKeyRequests("GetAddressesForKeyRequests", cc), transactionBytesRead("BytesRead", cc),
@@ -1773,6 +1931,7 @@ DatabaseContext::DatabaseContext(const Error& err)
     transactionCommittedMutations("CommittedMutations", cc),
     transactionCommittedMutationBytes("CommittedMutationBytes", cc), transactionSetMutations("SetMutations", cc),
     transactionClearMutations("ClearMutations", cc), transactionAtomicMutations("AtomicMutations", cc),
+    transactionAtomicOpsCoalesced("AtomicOpsCoalesced", cc),
     transactionsCommitStarted("CommitStarted", cc), transactionsCommitCompleted("CommitCompleted", cc),
     transactionKeyServerLocationRequests("KeyServerLocationRequests", cc),
     transactionKeyServerLocationRequestsCompleted("KeyServerLocationRequestsCompleted", cc),
@@ -1956,6 +2115,7 @@ void DatabaseContext::invalidateCache(const KeyRef& tenantPrefix, const KeyRef&
 	} else {
 		locationCache.rangeContaining(resolvedKey)->value() = Reference<LocationInfo>();
 	}
+	readCacheInvalidate(resolvedKey);
 }
 
 void DatabaseContext::invalidateCache(const KeyRef& tenantPrefix, const KeyRangeRef& keys) {
@@ -1969,6 +2129,48 @@ void DatabaseContext::invalidateCache(const KeyRef& tenantPrefix, const KeyRange
 	Key begin = rs.begin().begin(),
 	    end = rs.end().begin(); // insert invalidates rs, so can't be passed a mere reference into it
 	locationCache.insert(KeyRangeRef(begin, end), Reference<LocationInfo>());
+	readCacheInvalidate(resolvedKeys);
+}
+
+Optional<Optional<Value>> DatabaseContext::readCacheLookup(const KeyRef& resolvedKey, Version readVersion) {
+	auto it = readCache.find(resolvedKey);
+	if (it == readCache.end()) {
+		return Optional<Optional<Value>>();
+	}
+	// Never serve a value newer than the reader's snapshot, and stop serving once the reader has
+	// advanced past the validity window
+	if (it->second.version > readVersion ||
+	    readVersion - it->second.version > CLIENT_KNOBS->READ_CACHE_VERSION_VALIDITY) {
+		return Optional<Optional<Value>>();
+	}
+	return Optional<Optional<Value>>(it->second.value);
+}
+
+void DatabaseContext::readCacheUpdate(const KeyRef& resolvedKey, const Optional<Value>& value, Version readVersion) {
+	// Naive cache eviction just erases the entire cache when it gets full, mirroring the tenant
+	// cache; hot-key workloads repopulate the working set within a handful of reads.
+	if ((int)readCache.size() >= CLIENT_KNOBS->READ_CACHE_MAX_ENTRIES) {
+		readCache.clear();
+	}
+
+	auto& entry = readCache[Key(resolvedKey)];
+	if (readVersion < entry.version) {
+		// An older read completing late must not regress a fresher entry
+		return;
+	}
+	entry.value = value;
+	entry.version = readVersion;
+}
+
+void DatabaseContext::readCacheInvalidate(const KeyRef& resolvedKey) {
+	auto it = readCache.find(resolvedKey);
+	if (it != readCache.end()) {
+		readCache.erase(it);
+	}
+}
+
+void DatabaseContext::readCacheInvalidate(const KeyRangeRef& resolvedKeys) {
+	readCache.erase(readCache.lower_bound(resolvedKeys.begin), readCache.lower_bound(resolvedKeys.end));
 }
 
 void DatabaseContext::setFailedEndpointOnHealthyServer(const Endpoint& endpoint) {
@@ -2132,6 +2334,24 @@ ACTOR static Future<Void> switchConnectionRecordImpl(Reference<IClusterConnectio
 	clearedClientInfo.commitProxies.clear();
 	clearedClientInfo.grvProxies.clear();
 	clearedClientInfo.id = deterministicRandom()->randomUniqueID();
+
+	// If this connection string was prewarmed, seed the new cluster's proxies from the standby
+	// monitor so the first GRV does not have to wait for leader resolution.
+	if (self->standbyConnRecord && self->standbyConnRecord->get()->getConnectionString().toString() ==
+	                                  connRecord->getConnectionString().toString()) {
+		ClientDBInfo standbyInfo = self->standbyClientInfo->get();
+		if (standbyInfo.commitProxies.size() && standbyInfo.grvProxies.size()) {
+			CODE_PROBE(true, "Switching connection record to a prewarmed cluster");
+			TraceEvent("SwitchConnectionRecordPrewarmed")
+			    .detail("CommitProxies", standbyInfo.commitProxies.size())
+			    .detail("GrvProxies", standbyInfo.grvProxies.size());
+			clearedClientInfo.commitProxies = standbyInfo.commitProxies;
+			clearedClientInfo.grvProxies = standbyInfo.grvProxies;
+		}
+		// The main monitor takes over for this cluster now
+		self->prewarmConnection(Reference<IClusterConnectionRecord>());
+	}
+
 	self->clientInfo->set(clearedClientInfo);
 	self->connectionRecord->set(connRecord);
 
@@ -2167,6 +2387,29 @@ Future<Void> DatabaseContext::switchConnectionRecord(Reference<IClusterConnectio
 	return switchConnectionRecordImpl(standby, this);
 }
 
+void DatabaseContext::prewarmConnection(Reference<IClusterConnectionRecord> standby) {
+	if (!standby) {
+		standbyInfoMonitor = Future<Void>();
+		standbyConnRecord.clear();
+		standbyClientInfo.clear();
+		standbyCoordinator.clear();
+		return;
+	}
+	ASSERT(switchable);
+	TraceEvent("PrewarmConnectionRecord")
+	    .detail("ClusterFile", standby->toString())
+	    .detail("ConnectionString", standby->getConnectionString().toString());
+	standbyConnRecord = makeReference<AsyncVar<Reference<IClusterConnectionRecord>>>();
+	standbyConnRecord->set(standby);
+	standbyClientInfo = makeReference<AsyncVar<ClientDBInfo>>();
+	standbyCoordinator = makeReference<AsyncVar<Optional<ClientLeaderRegInterface>>>();
+	standbyInfoMonitor = monitorProxies(standbyConnRecord,
+	                                    standbyClientInfo,
+	                                    standbyCoordinator,
+	                                    networkOptions.supportedVersions,
+	                                    StringRef(networkOptions.traceLogGroup));
+}
+
 Future<Void> DatabaseContext::connectionFileChanged() {
 	return connectionFileChangedTrigger.onTrigger();
 }
@@ -2287,6 +2530,8 @@ Database Database::createDatabase(Reference<IClusterConnectionRecord> connRecord
 	                             std::addressof(clientInfo->get()));
 	database->globalConfig->trigger(samplingFrequency, samplingProfilerUpdateFrequency);
 	database->globalConfig->trigger(samplingWindow, samplingProfilerUpdateWindow);
+	database->globalConfig->triggerRange(traceSeverityPrefix, traceSeverityUpdated);
+	database->globalConfig->triggerRange(traceRateLimitPrefix, traceRateLimitUpdated);
 
 	TraceEvent("ConnectToDatabase", database->dbId)
 	    .detail("Version", FDB_VT_VERSION)
@@ -3304,10 +3549,24 @@ ACTOR Future<Optional<Value>> getValue(Reference<TransactionState> trState,
 	span.addAttribute("key"_sr, key);
 	trState->cx->validateVersion(ver);
 
+	state bool useReadCache = CLIENT_KNOBS->ENABLE_CLIENT_READ_CACHE && key < systemKeys.begin;
+	state Key cacheKey;
 	loop {
 		state KeyRangeLocationInfo locationInfo =
 		    wait(getKeyLocation(trState, key, &StorageServerInterface::getValue, Reverse::False, useTenant, ver));
 
+		if (useReadCache) {
+			cacheKey = locationInfo.tenantEntry.prefix.empty() ? key : key.withPrefix(locationInfo.tenantEntry.prefix);
+			Optional<Optional<Value>> cached = trState->cx->readCacheLookup(cacheKey, ver);
+			if (cached.present()) {
+				++trState->cx->transactionReadCacheHits;
+				++trState->cx->transactionKeysRead;
+				trState->cx->transactionBytesRead += cached.get().present() ? cached.get().get().size() : 0;
+				return cached.get();
+			}
+			++trState->cx->transactionReadCacheMisses;
+		}
+
 		state Optional<UID> getValueID = Optional<UID>();
 		state uint64_t startTime;
 		state double startTimeD;
@@ -3386,7 +3645,19 @@ ACTOR Future<Optional<Value>> getValue(Reference<TransactionState> trState,
 
 			trState->cx->transactionBytesRead += reply.value.present() ? reply.value.get().size() : 0;
 			++trState->cx->transactionKeysRead;
-			return reply.value;
+			Optional<Value> result;
+			if (reply.value.present()) {
+				// The value may point into the reply packet's arena; a small value
+				// would pin all of it, so copy it out unless it is the dominant
+				// occupant (see Arena::adopt).
+				Value value;
+				value.contents() = value.arena().adopt(reply.value.get(), reply.value.get().arena());
+				result = value;
+			}
+			if (useReadCache) {
+				trState->cx->readCacheUpdate(cacheKey, result, ver);
+			}
+			return result;
 		} catch (Error& e) {
 			trState->cx->getValueCompleted->latency = timer_int() - startTime;
 			trState->cx->getValueCompleted->log();
@@ -3526,6 +3797,412 @@ ACTOR Future<Key> getKey(Reference<TransactionState> trState,
 	}
 }
 
+// Resolves one shard's worth of selectors with a single GetMultipleKeysRequest, returning the
+// per-selector updated selectors from the reply. Throws wrong_shard_server (et al.) to the caller,
+// which re-locates and regroups; replicas from before the batched endpoint existed answer with
+// broken_promise, which is handled here by falling back to individual getKey resolution.
+ACTOR Future<std::vector<KeySelector>> getMultipleKeysBatch(Reference<TransactionState> trState,
+                                                            SpanContext spanContext,
+                                                            Version version,
+                                                            std::vector<KeySelector> sels,
+                                                            KeyRangeLocationInfo locationInfo) {
+	state VersionVector ssLatestCommitVersions;
+	trState->cx->getLatestCommitVersions(locationInfo.locations, version, trState, ssLatestCommitVersions);
+
+	state GetMultipleKeysRequest req;
+	req.spanContext = spanContext;
+	req.tenantInfo = trState->getTenantInfo();
+	req.version = version;
+	req.tags = trState->cx->sampleReadTags() ? trState->options.readTags : Optional<TagSet>();
+	req.ssLatestCommitVersions = ssLatestCommitVersions;
+	for (auto const& sel : sels) {
+		req.sels.push_back_deep(req.arena, sel);
+	}
+
+	try {
+		++trState->cx->transactionPhysicalReads;
+		state GetMultipleKeysReply reply;
+		try {
+			choose {
+				when(wait(trState->cx->connectionFileChanged())) { throw transaction_too_old(); }
+				when(GetMultipleKeysReply _reply =
+				         wait(loadBalance(trState->cx.getPtr(),
+				                          locationInfo.locations,
+				                          &StorageServerInterface::getMultipleKeys,
+				                          req,
+				                          TaskPriority::DefaultPromiseEndpoint,
+				                          AtMostOnce::False,
+				                          trState->cx->enableLocalityLoadBalance ? &trState->cx->queueModel
+				                                                                 : nullptr))) {
+					reply = _reply;
+				}
+			}
+			++trState->cx->transactionPhysicalReadsCompleted;
+		} catch (Error&) {
+			++trState->cx->transactionPhysicalReadsCompleted;
+			throw;
+		}
+		ASSERT(reply.sels.size() == sels.size());
+		std::vector<KeySelector> updated;
+		updated.reserve(reply.sels.size());
+		for (auto const& s : reply.sels) {
+			updated.push_back(KeySelector(s, reply.arena));
+		}
+		return updated;
+	} catch (Error& e) {
+		if (e.code() != error_code_broken_promise) {
+			throw;
+		}
+		CODE_PROBE(true, "getMultipleKeys fell back to single selector resolution");
+	}
+
+	state std::vector<Future<Key>> singles;
+	singles.reserve(sels.size());
+	for (auto const& sel : sels) {
+		singles.push_back(getKey(trState, sel, Future<Version>(version)));
+	}
+	wait(waitForAll(singles));
+	std::vector<KeySelector> resolved;
+	resolved.reserve(singles.size());
+	for (auto const& f : singles) {
+		Key k = f.get();
+		resolved.push_back(KeySelector(KeySelectorRef(k, true, 0), k.arena()));
+	}
+	return resolved;
+}
+
+ACTOR Future<std::vector<Key>> getMultipleKeys(Reference<TransactionState> trState,
+                                               std::vector<KeySelector> selectors,
+                                               Future<Version> fVersion) {
+	wait(success(fVersion));
+	state Version version = fVersion.get();
+	state Span span("NAPI:getMultipleKeys"_loc, trState->spanContext);
+	state std::vector<KeySelector> sels = selectors;
+	state std::vector<Key> result = std::vector<Key>(sels.size());
+	state std::vector<bool> resolved = std::vector<bool>(sels.size(), false);
+
+	loop {
+		// The same edge handling getKey() performs per iteration, applied to every selector.
+		state std::vector<int> pending = std::vector<int>();
+		for (int i = 0; i < sels.size(); i++) {
+			if (resolved[i]) {
+				continue;
+			}
+			KeySelector& k = sels[i];
+			if (k.getKey() == allKeys.end) {
+				if (k.offset > 0) {
+					result[i] = allKeys.end;
+					resolved[i] = true;
+					continue;
+				}
+				k.orEqual = false;
+			} else if (k.getKey() == allKeys.begin && k.offset <= 0) {
+				result[i] = Key();
+				resolved[i] = true;
+				continue;
+			}
+			pending.push_back(i);
+		}
+		if (pending.empty()) {
+			return result;
+		}
+
+		state std::vector<Future<KeyRangeLocationInfo>> locationFutures =
+		    std::vector<Future<KeyRangeLocationInfo>>();
+		locationFutures.reserve(pending.size());
+		for (int i : pending) {
+			locationFutures.push_back(getKeyLocation(trState,
+			                                         Key(sels[i].getKey(), sels[i].arena()),
+			                                         &StorageServerInterface::getMultipleKeys,
+			                                         Reverse{ sels[i].isBackward() },
+			                                         UseTenant::True,
+			                                         version));
+		}
+		wait(waitForAll(locationFutures));
+
+		// Group the unresolved selectors by shard and resolve each group in one round trip.
+		state std::vector<std::vector<int>> groups = std::vector<std::vector<int>>();
+		state std::vector<KeyRangeLocationInfo> groupLocations = std::vector<KeyRangeLocationInfo>();
+		std::map<Key, int> groupIndex;
+		for (int j = 0; j < pending.size(); j++) {
+			const KeyRangeLocationInfo& loc = locationFutures[j].get();
+			auto it = groupIndex.find(loc.range.begin);
+			if (it == groupIndex.end()) {
+				it = groupIndex.emplace(loc.range.begin, (int)groups.size()).first;
+				groups.push_back(std::vector<int>());
+				groupLocations.push_back(loc);
+			}
+			groups[it->second].push_back(pending[j]);
+		}
+		if (groups.size() < pending.size()) {
+			CODE_PROBE(true, "Multiple key selectors resolved by one batched request");
+		}
+
+		state std::vector<Future<std::vector<KeySelector>>> batches = std::vector<Future<std::vector<KeySelector>>>();
+		batches.reserve(groups.size());
+		for (int g = 0; g < groups.size(); g++) {
+			std::vector<KeySelector> groupSels;
+			groupSels.reserve(groups[g].size());
+			for (int i : groups[g]) {
+				groupSels.push_back(sels[i]);
+			}
+			batches.push_back(getMultipleKeysBatch(trState, span.context, version, groupSels, groupLocations[g]));
+		}
+		wait(waitForAllReady(batches));
+
+		state bool gotWrongShard = false;
+		state bool gotUnknownTenant = false;
+		for (int g = 0; g < groups.size(); g++) {
+			if (batches[g].isError()) {
+				Error e = batches[g].getError();
+				if (e.code() == error_code_wrong_shard_server || e.code() == error_code_all_alternatives_failed) {
+					for (int i : groups[g]) {
+						trState->cx->invalidateCache(
+						    groupLocations[g].tenantEntry.prefix, sels[i].getKey(), Reverse{ sels[i].isBackward() });
+					}
+					gotWrongShard = true;
+				} else if (e.code() == error_code_unknown_tenant) {
+					ASSERT(trState->tenant().present());
+					trState->cx->invalidateCachedTenant(trState->tenant().get());
+					gotUnknownTenant = true;
+				} else {
+					TraceEvent(SevInfo, "GetMultipleKeysError").error(e).detail("SelCount", groups[g].size());
+					throw e;
+				}
+			} else {
+				const std::vector<KeySelector>& updated = batches[g].get();
+				ASSERT(updated.size() == groups[g].size());
+				for (int j = 0; j < updated.size(); j++) {
+					int i = groups[g][j];
+					sels[i] = updated[j];
+					if (!sels[i].offset && sels[i].orEqual) {
+						result[i] = Key(sels[i].getKey(), sels[i].arena());
+						resolved[i] = true;
+					}
+					// Selectors whose offsets crossed the shard boundary come back partially
+					// advanced and go around the loop again against the next shard.
+				}
+			}
+		}
+		if (gotWrongShard) {
+			wait(delay(CLIENT_KNOBS->WRONG_SHARD_SERVER_DELAY, trState->taskID));
+		} else if (gotUnknownTenant) {
+			wait(delay(CLIENT_KNOBS->UNKNOWN_TENANT_RETRY_DELAY, trState->taskID));
+		}
+	}
+}
+
+ACTOR Future<std::vector<Key>> getMultipleKeysAndConflictRanges(
+    Reference<TransactionState> trState,
+    std::vector<KeySelector> selectors,
+    Future<Version> version,
+    std::vector<Promise<std::pair<Key, Key>>> conflictRanges) {
+	try {
+		state std::vector<Key> res = wait(getMultipleKeys(trState, selectors, version));
+		ASSERT(res.size() == selectors.size());
+		for (int i = 0; i < selectors.size(); i++) {
+			KeySelector const& k = selectors[i];
+			if (k.offset <= 0)
+				conflictRanges[i].send(
+				    std::make_pair(res[i], k.orEqual ? keyAfter(k.getKey()) : Key(k.getKey(), k.arena())));
+			else
+				conflictRanges[i].send(
+				    std::make_pair(k.orEqual ? keyAfter(k.getKey()) : Key(k.getKey(), k.arena()), keyAfter(res[i])));
+		}
+		return res;
+	} catch (Error& e) {
+		for (auto& c : conflictRanges) {
+			if (c.canBeSet()) {
+				c.send(std::make_pair(Key(), Key()));
+			}
+		}
+		throw;
+	}
+}
+
+// Reads one shard's worth of keys with a single GetMultipleValuesRequest, returning the
+// per-key values from the reply in request order. Throws wrong_shard_server (et al.) to the
+// caller, which re-locates and regroups; replicas from before the batched endpoint existed answer
+// with broken_promise, which is handled here by falling back to individual getValue reads.
+ACTOR Future<std::vector<Optional<Value>>> getMultipleValuesBatch(Reference<TransactionState> trState,
+                                                                  SpanContext spanContext,
+                                                                  Version version,
+                                                                  std::vector<Key> keys,
+                                                                  KeyRangeLocationInfo locationInfo) {
+	state VersionVector ssLatestCommitVersions;
+	trState->cx->getLatestCommitVersions(locationInfo.locations, version, trState, ssLatestCommitVersions);
+
+	state GetMultipleValuesRequest req;
+	req.spanContext = spanContext;
+	req.tenantInfo = trState->getTenantInfo();
+	req.version = version;
+	req.tags = trState->cx->sampleReadTags() ? trState->options.readTags : Optional<TagSet>();
+	req.debugID = trState->debugID;
+	req.ssLatestCommitVersions = ssLatestCommitVersions;
+	for (auto const& key : keys) {
+		req.keys.push_back_deep(req.arena, key);
+	}
+
+	try {
+		++trState->cx->transactionPhysicalReads;
+		state GetMultipleValuesReply reply;
+		try {
+			choose {
+				when(wait(trState->cx->connectionFileChanged())) { throw transaction_too_old(); }
+				when(GetMultipleValuesReply _reply =
+				         wait(loadBalance(trState->cx.getPtr(),
+				                          locationInfo.locations,
+				                          &StorageServerInterface::getMultipleValues,
+				                          req,
+				                          TaskPriority::DefaultPromiseEndpoint,
+				                          AtMostOnce::False,
+				                          trState->cx->enableLocalityLoadBalance ? &trState->cx->queueModel
+				                                                                 : nullptr))) {
+					reply = _reply;
+				}
+			}
+			++trState->cx->transactionPhysicalReadsCompleted;
+		} catch (Error&) {
+			++trState->cx->transactionPhysicalReadsCompleted;
+			throw;
+		}
+		ASSERT(reply.values.size() == keys.size());
+		trState->cx->transactionKeysRead += keys.size();
+		std::vector<Optional<Value>> values;
+		values.reserve(reply.values.size());
+		for (auto const& v : reply.values) {
+			if (v.present()) {
+				trState->cx->transactionBytesRead += v.get().size();
+				values.push_back(Optional<Value>(Value(v.get(), reply.arena)));
+			} else {
+				values.push_back(Optional<Value>());
+			}
+		}
+		return values;
+	} catch (Error& e) {
+		if (e.code() != error_code_broken_promise) {
+			throw;
+		}
+		CODE_PROBE(true, "getMultipleValues fell back to single reads");
+	}
+
+	state std::vector<Future<Optional<Value>>> singles;
+	singles.reserve(keys.size());
+	for (auto const& key : keys) {
+		singles.push_back(getValue(trState, key, Future<Version>(version), UseTenant::True));
+	}
+	wait(waitForAll(singles));
+	std::vector<Optional<Value>> resolved;
+	resolved.reserve(singles.size());
+	for (auto const& f : singles) {
+		resolved.push_back(f.get());
+	}
+	return resolved;
+}
+
+ACTOR Future<std::vector<Optional<Value>>> getMultipleValues(Reference<TransactionState> trState,
+                                                             std::vector<Key> keys,
+                                                             Future<Version> fVersion) {
+	wait(success(fVersion));
+	state Version version = fVersion.get();
+	state Span span("NAPI:getMultipleValues"_loc, trState->spanContext);
+	trState->cx->validateVersion(version);
+	state std::vector<Optional<Value>> result = std::vector<Optional<Value>>(keys.size());
+	state std::vector<bool> resolved = std::vector<bool>(keys.size(), false);
+
+	for (int i = 0; i < (int)keys.size(); i++) {
+		// There are no keys in the database with size greater than the max key size
+		if (keys[i].size() > getMaxReadKeySize(keys[i])) {
+			resolved[i] = true;
+		}
+	}
+
+	loop {
+		state std::vector<int> pending = std::vector<int>();
+		for (int i = 0; i < (int)keys.size(); i++) {
+			if (!resolved[i]) {
+				pending.push_back(i);
+			}
+		}
+		if (pending.empty()) {
+			return result;
+		}
+
+		state std::vector<Future<KeyRangeLocationInfo>> locationFutures =
+		    std::vector<Future<KeyRangeLocationInfo>>();
+		locationFutures.reserve(pending.size());
+		for (int i : pending) {
+			locationFutures.push_back(getKeyLocation(
+			    trState, keys[i], &StorageServerInterface::getMultipleValues, Reverse::False, UseTenant::True, version));
+		}
+		wait(waitForAll(locationFutures));
+
+		// Group the unread keys by shard and read each group in one round trip.
+		state std::vector<std::vector<int>> groups = std::vector<std::vector<int>>();
+		state std::vector<KeyRangeLocationInfo> groupLocations = std::vector<KeyRangeLocationInfo>();
+		std::map<Key, int> groupIndex;
+		for (int j = 0; j < (int)pending.size(); j++) {
+			const KeyRangeLocationInfo& loc = locationFutures[j].get();
+			auto it = groupIndex.find(loc.range.begin);
+			if (it == groupIndex.end()) {
+				it = groupIndex.emplace(loc.range.begin, (int)groups.size()).first;
+				groups.push_back(std::vector<int>());
+				groupLocations.push_back(loc);
+			}
+			groups[it->second].push_back(pending[j]);
+		}
+		if (groups.size() < pending.size()) {
+			CODE_PROBE(true, "Multiple keys read by one batched getValue request");
+		}
+
+		state std::vector<Future<std::vector<Optional<Value>>>> batches =
+		    std::vector<Future<std::vector<Optional<Value>>>>();
+		batches.reserve(groups.size());
+		for (int g = 0; g < (int)groups.size(); g++) {
+			std::vector<Key> groupKeys;
+			groupKeys.reserve(groups[g].size());
+			for (int i : groups[g]) {
+				groupKeys.push_back(keys[i]);
+			}
+			batches.push_back(getMultipleValuesBatch(trState, span.context, version, groupKeys, groupLocations[g]));
+		}
+		wait(waitForAllReady(batches));
+
+		state bool gotWrongShard = false;
+		state bool gotUnknownTenant = false;
+		for (int g = 0; g < (int)groups.size(); g++) {
+			if (batches[g].isError()) {
+				Error e = batches[g].getError();
+				if (e.code() == error_code_wrong_shard_server || e.code() == error_code_all_alternatives_failed) {
+					for (int i : groups[g]) {
+						trState->cx->invalidateCache(groupLocations[g].tenantEntry.prefix, keys[i]);
+					}
+					gotWrongShard = true;
+				} else if (e.code() == error_code_unknown_tenant) {
+					ASSERT(trState->tenant().present());
+					trState->cx->invalidateCachedTenant(trState->tenant().get());
+					gotUnknownTenant = true;
+				} else {
+					TraceEvent(SevInfo, "GetMultipleValuesError").error(e).detail("KeyCount", groups[g].size());
+					throw e;
+				}
+			} else {
+				const std::vector<Optional<Value>>& values = batches[g].get();
+				ASSERT(values.size() == groups[g].size());
+				for (int j = 0; j < (int)values.size(); j++) {
+					result[groups[g][j]] = values[j];
+					resolved[groups[g][j]] = true;
+				}
+			}
+		}
+		if (gotWrongShard) {
+			wait(delay(CLIENT_KNOBS->WRONG_SHARD_SERVER_DELAY, trState->taskID));
+		} else if (gotUnknownTenant) {
+			wait(delay(CLIENT_KNOBS->UNKNOWN_TENANT_RETRY_DELAY, trState->taskID));
+		}
+	}
+}
+
 ACTOR Future<Version> waitForCommittedVersion(Database cx, Version version, SpanContext spanContext) {
 	state Span span("NAPI:waitForCommittedVersion"_loc, spanContext);
 	try {
@@ -3593,9 +4270,89 @@ ACTOR Future<Void> readVersionBatcher(
     FutureStream<std::pair<Promise<GetReadVersionReply>, Optional<UID>>> versionStream,
     uint32_t flags);
 
+// Sends one accumulated cohort of watches to a storage server for its shard as a single
+// WatchValuesRequest and demultiplexes the per-entry notifications back to the waiting watchers.
+// Errors on the stream are broadcast to every watcher that has not fired yet, so the existing
+// per-watch retry logic in watchValue() applies unchanged.
+ACTOR Future<Void> dispatchWatchMuxCohort(Database cx,
+                                          std::pair<int64_t, Key> cohortKey,
+                                          KeyRangeLocationInfo locationInfo,
+                                          Reference<WatchMuxCohort> cohort) {
+	wait(delay(CLIENT_KNOBS->WATCH_MUX_BATCH_DELAY));
+	auto it = cx->watchMuxCohorts.find(cohortKey);
+	if (it != cx->watchMuxCohorts.end() && it->second == cohort) {
+		cx->watchMuxCohorts.erase(it);
+	}
+	CODE_PROBE(cohort->params.size() > 1, "Multiple watches multiplexed onto one storage request");
+	state WatchValuesRequest req;
+	req.spanContext = cohort->params[0]->spanContext;
+	req.tenantInfo = cohort->params[0]->tenant;
+	req.tags = cx->sampleReadTags() ? Optional<TagSet>(cohort->params[0]->tags) : Optional<TagSet>();
+	req.debugID = cohort->params[0]->debugID;
+	for (int i = 0; i < (int)cohort->params.size(); i++) {
+		req.entries.push_back_deep(
+		    req.arena,
+		    WatchValuesEntryRef(cohort->params[i]->key, cohort->params[i]->value, cohort->versions[i]));
+	}
+	try {
+		state ReplyPromiseStream<WatchValuesStreamReply> replyStream =
+		    locationInfo.locations
+		        ->get(deterministicRandom()->randomInt(0, locationInfo.locations->size()),
+		              &StorageServerInterface::watchValues)
+		        .getReplyStream(req);
+		state int remaining = cohort->fired.size();
+		while (remaining > 0) {
+			WatchValuesStreamReply rep = waitNext(replyStream.getFuture());
+			if (rep.index >= 0 && rep.index < (int)cohort->fired.size() && cohort->fired[rep.index].canBeSet()) {
+				cohort->fired[rep.index].send(rep.version);
+				remaining--;
+			}
+		}
+	} catch (Error& e) {
+		if (e.code() == error_code_actor_cancelled) {
+			throw;
+		}
+		// The server closes the stream with end_of_stream only after every entry has fired; if it
+		// closes earlier, time the remaining watchers out so they re-register through the normal
+		// retry loop.
+		Error err = e.code() == error_code_end_of_stream ? timed_out() : e;
+		for (auto& p : cohort->fired) {
+			if (p.canBeSet()) {
+				p.sendError(err);
+			}
+		}
+	}
+	return Void();
+}
+
+// Joins (or forms) the cohort of watches for this shard and waits for the multiplexed stream to
+// report the version at which this watch fired.
+ACTOR Future<Version> watchValueMux(Database cx,
+                                    KeyRangeLocationInfo locationInfo,
+                                    Reference<const WatchParameters> parameters,
+                                    Version version) {
+	state std::pair<int64_t, Key> cohortKey(parameters->tenant.tenantId, locationInfo.range.begin);
+	state Reference<WatchMuxCohort> cohort;
+	auto it = cx->watchMuxCohorts.find(cohortKey);
+	if (it != cx->watchMuxCohorts.end() && (int)it->second->params.size() < CLIENT_KNOBS->WATCH_MUX_MAX_WATCHES) {
+		cohort = it->second;
+	} else {
+		cohort = makeReference<WatchMuxCohort>();
+		cx->watchMuxCohorts[cohortKey] = cohort;
+		cohort->dispatcher = dispatchWatchMuxCohort(cx, cohortKey, locationInfo, cohort);
+	}
+	state Promise<Version> fired;
+	cohort->params.push_back(parameters);
+	cohort->versions.push_back(version);
+	cohort->fired.push_back(fired);
+	Version ver = wait(fired.getFuture());
+	return ver;
+}
+
 ACTOR Future<Version> watchValue(Database cx, Reference<const WatchParameters> parameters) {
 	state Span span("NAPI:watchValue"_loc, parameters->spanContext);
 	state Version ver = parameters->version;
+	state bool useMux = CLIENT_KNOBS->ENABLE_WATCH_MULTIPLEXING;
 	cx->validateVersion(parameters->version);
 	ASSERT(parameters->version != latestVersion);
 
@@ -3622,22 +4379,31 @@ ACTOR Future<Version> watchValue(Database cx, Reference<const WatchParameters> p
 				                      "NativeAPI.watchValue.Before"); //.detail("TaskID", g_network->getCurrentTask());
 			}
 			state WatchValueReply resp;
-			choose {
-				when(WatchValueReply r = wait(
-				         loadBalance(cx.getPtr(),
-				                     locationInfo.locations,
-				                     &StorageServerInterface::watchValue,
-				                     WatchValueRequest(span.context,
-				                                       parameters->tenant,
-				                                       parameters->key,
-				                                       parameters->value,
-				                                       ver,
-				                                       cx->sampleReadTags() ? parameters->tags : Optional<TagSet>(),
-				                                       watchValueID),
-				                     TaskPriority::DefaultPromiseEndpoint))) {
-					resp = r;
+			if (useMux) {
+				choose {
+					when(Version muxVersion = wait(watchValueMux(cx, locationInfo, parameters, ver))) {
+						resp = WatchValueReply{ muxVersion };
+					}
+					when(wait(cx->connectionRecord ? cx->connectionRecord->onChange() : Never())) { wait(Never()); }
+				}
+			} else {
+				choose {
+					when(WatchValueReply r = wait(
+					         loadBalance(cx.getPtr(),
+					                     locationInfo.locations,
+					                     &StorageServerInterface::watchValue,
+					                     WatchValueRequest(span.context,
+					                                       parameters->tenant,
+					                                       parameters->key,
+					                                       parameters->value,
+					                                       ver,
+					                                       cx->sampleReadTags() ? parameters->tags : Optional<TagSet>(),
+					                                       watchValueID),
+					                     TaskPriority::DefaultPromiseEndpoint))) {
+						resp = r;
+					}
+					when(wait(cx->connectionRecord ? cx->connectionRecord->onChange() : Never())) { wait(Never()); }
 				}
-				when(wait(cx->connectionRecord ? cx->connectionRecord->onChange() : Never())) { wait(Never()); }
 			}
 			if (watchValueID.present()) {
 				g_traceBatch.addEvent("WatchValueDebug", watchValueID.get().first(), "NativeAPI.watchValue.After");
@@ -3672,6 +4438,11 @@ ACTOR Future<Version> watchValue(Database cx, Reference<const WatchParameters> p
 				                                           // it was cancelled
 				CODE_PROBE(true, "A watch timed out");
 				wait(delay(CLIENT_KNOBS->FUTURE_VERSION_RETRY_DELAY, parameters->taskID));
+			} else if (e.code() == error_code_broken_promise && useMux) {
+				// The storage server predates the multiplexed watch endpoint; fall back to
+				// individual watch requests against it
+				CODE_PROBE(true, "Multiplexed watch fell back to single watch requests");
+				useMux = false;
 			} else {
 				state Error err = e;
 				wait(delay(CLIENT_KNOBS->FUTURE_VERSION_RETRY_DELAY, parameters->taskID));
@@ -5172,6 +5943,12 @@ void Transaction::operator=(Transaction&& r) noexcept {
 	extraConflictRanges = std::move(r.extraConflictRanges);
 	commitResult = std::move(r.commitResult);
 	committing = std::move(r.committing);
+	rangePrefetch = std::move(r.rangePrefetch);
+	lastRangeResult = std::move(r.lastRangeResult);
+	lastRangeEnd = std::move(r.lastRangeEnd);
+	lastRangeLimits = r.lastRangeLimits;
+	lastRangeSnapshot = r.lastRangeSnapshot;
+	latestAtomicOps = std::move(r.latestAtomicOps);
 	backoff = r.backoff;
 	watches = r.watches;
 }
@@ -5179,6 +5956,10 @@ void Transaction::operator=(Transaction&& r) noexcept {
 void Transaction::flushTrLogsIfEnabled() {
 	if (trState && trState->trLogInfo && trState->trLogInfo->logsAdded && trState->trLogInfo->trLogWriter.getData()) {
 		ASSERT(trState->trLogInfo->flushed == false);
+		trState->cx->recordTransactionProfile(
+		    trState->trLogInfo->identifier,
+		    StringRef((const uint8_t*)trState->trLogInfo->trLogWriter.getData(),
+		              trState->trLogInfo->trLogWriter.getLength()));
 		trState->cx->clientStatusUpdater.inStatusQ.push_back(
 		    { trState->trLogInfo->identifier, std::move(trState->trLogInfo->trLogWriter) });
 		trState->trLogInfo->flushed = true;
@@ -5203,6 +5984,7 @@ void Transaction::setVersion(Version v) {
 Future<Optional<Value>> Transaction::get(const Key& key, Snapshot snapshot) {
 	++trState->cx->transactionLogicalReads;
 	++trState->cx->transactionGetValueRequests;
+	trState->cx->recordKeySkew(trState->cx->readKeySkew, key);
 	// ASSERT (key < allKeys.end);
 
 	// There are no keys in the database with size greater than the max key size
@@ -5260,6 +6042,25 @@ Future<Optional<Value>> Transaction::get(const Key& key, Snapshot snapshot) {
 	return getValue(trState, key, ver, useTenant);
 }
 
+Future<std::vector<Optional<Value>>> Transaction::getMultipleValues(const std::vector<Key>& keys, Snapshot snapshot) {
+	trState->cx->transactionLogicalReads += keys.size();
+	trState->cx->transactionGetValueRequests += keys.size();
+	if (keys.empty()) {
+		return std::vector<Optional<Value>>();
+	}
+
+	if (!snapshot) {
+		for (auto const& key : keys) {
+			// There are no keys in the database with size greater than the max key size
+			if (key.size() <= getMaxReadKeySize(key)) {
+				tr.transaction.read_conflict_ranges.push_back(tr.arena, singleKeyRange(key, tr.arena));
+			}
+		}
+	}
+
+	return ::getMultipleValues(trState, keys, getReadVersion());
+}
+
 void Watch::setWatch(Future<Void> watchFuture) {
 	this->watchFuture = watchFuture;
 
@@ -5449,6 +6250,23 @@ Future<Key> Transaction::getKey(const KeySelector& key, Snapshot snapshot) {
 	return getKeyAndConflictRange(trState, key, getReadVersion(), conflictRange);
 }
 
+Future<std::vector<Key>> Transaction::getMultipleKeys(const std::vector<KeySelector>& selectors, Snapshot snapshot) {
+	trState->cx->transactionLogicalReads += selectors.size();
+	trState->cx->transactionGetKeyRequests += selectors.size();
+	if (selectors.empty()) {
+		return std::vector<Key>();
+	}
+	if (snapshot) {
+		return ::getMultipleKeys(trState, selectors, getReadVersion());
+	}
+
+	std::vector<Promise<std::pair<Key, Key>>> conflictRanges(selectors.size());
+	for (auto& c : conflictRanges) {
+		extraConflictRanges.push_back(c.getFuture());
+	}
+	return getMultipleKeysAndConflictRanges(trState, selectors, getReadVersion(), conflictRanges);
+}
+
 template <class GetKeyValuesFamilyRequest>
 void increaseCounterForRequest(Database cx) {
 	if constexpr (std::is_same<GetKeyValuesFamilyRequest, GetKeyValuesRequest>::value) {
@@ -5460,6 +6278,34 @@ void increaseCounterForRequest(Database cx) {
 	}
 }
 
+// Waits for one batch of a sequential scan and speculatively requests the batch after it with the
+// same end selector and limits, so the next getRange() call of the scan finds its result already
+// in flight. Parks forever once the scan has nothing left to read ahead; the caller drops the
+// returned future (cancelling the actor) when the iteration pattern is broken or the transaction
+// is reset.
+ACTOR Future<Transaction::RangePrefetch> issueRangePrefetch(Reference<TransactionState> trState,
+                                                            Future<Version> fVersion,
+                                                            Future<RangeResult> previousBatch,
+                                                            KeySelector end,
+                                                            GetRangeLimits limits,
+                                                            Snapshot snapshot) {
+	state RangeResult prev = wait(previousBatch);
+	if (!prev.more || prev.empty() || prev.readThrough.present()) {
+		wait(Never());
+	}
+	Transaction::RangePrefetch pf;
+	pf.begin = KeySelector(firstGreaterThan(prev.back().key), prev.arena());
+	pf.begin.removeOrEqual(pf.begin.arena());
+	pf.end = end;
+	pf.limits = limits;
+	pf.snapshot = snapshot;
+	Promise<std::pair<Key, Key>> conflictRange;
+	pf.conflictRange = conflictRange.getFuture();
+	pf.result = getRange<GetKeyValuesRequest, GetKeyValuesReply, RangeResult>(
+	    trState, fVersion, pf.begin, pf.end, ""_sr, limits, conflictRange, MATCH_INDEX_ALL, snapshot, Reverse::False);
+	return pf;
+}
+
 template <class GetKeyValuesFamilyRequest, class GetKeyValuesFamilyReply, class RangeResultFamily>
 Future<RangeResultFamily> Transaction::getRangeInternal(const KeySelector& begin,
                                                         const KeySelector& end,
@@ -5470,6 +6316,7 @@ Future<RangeResultFamily> Transaction::getRangeInternal(const KeySelector& begin
                                                         Reverse reverse) {
 	++trState->cx->transactionLogicalReads;
 	increaseCounterForRequest<GetKeyValuesFamilyRequest>(trState->cx);
+	trState->cx->recordKeySkew(trState->cx->readKeySkew, begin.getKey());
 
 	if (limits.isReached())
 		return RangeResultFamily();
@@ -5502,13 +6349,64 @@ Future<RangeResultFamily> Transaction::getRangeInternal(const KeySelector& begin
 		// you don't want RYW, you may use ReadYourWrites APIs with RYW disabled.)
 		throw unsupported_operation();
 	}
+	if constexpr (std::is_same_v<GetKeyValuesFamilyRequest, GetKeyValuesRequest>) {
+		if (CLIENT_KNOBS->ENABLE_RANGE_PREFETCH && !reverse) {
+			if (rangePrefetch.isValid() && rangePrefetch.isReady() && !rangePrefetch.isError()) {
+				RangePrefetch pf = rangePrefetch.get();
+				if (pf.begin == b && pf.end == e && pf.snapshot == snapshot && pf.limits.rows == limits.rows &&
+				    pf.limits.minRows == limits.minRows && pf.limits.bytes == limits.bytes) {
+					// This call continues the scan exactly where the previous batch left off, so the
+					// speculative request issued when that batch arrived is the answer. Chain the
+					// read-ahead to the batch after this one.
+					CODE_PROBE(true, "getRange served by sequential prefetch");
+					++trState->cx->transactionGetRangePrefetches;
+					rangePrefetch = issueRangePrefetch(trState, getReadVersion(), pf.result, e, limits, snapshot);
+					if (!snapshot) {
+						extraConflictRanges.push_back(pf.conflictRange);
+					}
+					lastRangeResult = pf.result;
+					lastRangeEnd = e;
+					lastRangeLimits = limits;
+					lastRangeSnapshot = snapshot;
+					return pf.result;
+				}
+				// The iteration pattern was broken; drop the speculative batch. Its conflict range
+				// was never registered, so the unconsumed read does not affect this transaction.
+				rangePrefetch = Future<RangePrefetch>();
+			}
+		}
+	}
+
 	Promise<std::pair<Key, Key>> conflictRange;
 	if (!snapshot) {
 		extraConflictRanges.push_back(conflictRange.getFuture());
 	}
 
-	return ::getRange<GetKeyValuesFamilyRequest, GetKeyValuesFamilyReply, RangeResultFamily>(
+	Future<RangeResultFamily> result = ::getRange<GetKeyValuesFamilyRequest, GetKeyValuesFamilyReply, RangeResultFamily>(
 	    trState, getReadVersion(), b, e, mapper, limits, conflictRange, matchIndex, snapshot, reverse);
+
+	if constexpr (std::is_same_v<GetKeyValuesFamilyRequest, GetKeyValuesRequest>) {
+		if (CLIENT_KNOBS->ENABLE_RANGE_PREFETCH && !reverse) {
+			if (!rangePrefetch.isValid() && lastRangeResult.isValid() && lastRangeResult.isReady() &&
+			    !lastRangeResult.isError() && e == lastRangeEnd && snapshot == lastRangeSnapshot &&
+			    limits.rows == lastRangeLimits.rows && limits.minRows == lastRangeLimits.minRows &&
+			    limits.bytes == lastRangeLimits.bytes) {
+				RangeResult const& prev = lastRangeResult.get();
+				if (prev.more && !prev.empty() && !prev.readThrough.present() && !b.orEqual && b.offset == 1 &&
+				    b.getKey() == keyAfter(prev.back().key)) {
+					// Second consecutive batch of a forward scan: start reading one batch ahead.
+					CODE_PROBE(true, "Sequential getRange scan detected");
+					rangePrefetch = issueRangePrefetch(trState, getReadVersion(), result, e, limits, snapshot);
+				}
+			}
+			lastRangeResult = result;
+			lastRangeEnd = e;
+			lastRangeLimits = limits;
+			lastRangeSnapshot = snapshot;
+		}
+	}
+
+	return result;
 }
 
 Future<RangeResult> Transaction::getRange(const KeySelector& begin,
@@ -5626,6 +6524,7 @@ void Transaction::makeSelfConflicting() {
 
 void Transaction::set(const KeyRef& key, const ValueRef& value, AddConflictRange addConflictRange) {
 	++trState->cx->transactionSetMutations;
+	trState->cx->recordKeySkew(trState->cx->writeKeySkew, key);
 	if (key.size() > getMaxWriteKeySize(key, trState->options.rawAccess))
 		throw key_too_large();
 	if (value.size() > CLIENT_KNOBS->VALUE_SIZE_LIMIT)
@@ -5636,12 +6535,48 @@ void Transaction::set(const KeyRef& key, const ValueRef& value, AddConflictRange
 	auto r = singleKeyRange(key, req.arena);
 	auto v = ValueRef(req.arena, value);
 	t.mutations.emplace_back(req.arena, MutationRef::SetValue, r.begin, v);
+	if (!latestAtomicOps.empty()) {
+		latestAtomicOps.erase(r.begin);
+	}
 
 	if (addConflictRange) {
 		t.write_conflict_ranges.push_back(req.arena, r);
 	}
 }
 
+// Attempts to fold an atomic op into the latest pending mutation on the same key, mirroring the
+// coalescing WriteMap performs for read-your-writes transactions. Returns true if the op was folded
+// and no new mutation needs to be added; otherwise records the index the caller is about to use.
+bool Transaction::coalesceAtomicOp(KeyRef key, MutationRef::Type operationType, ValueRef operand) {
+	if (operationType == MutationRef::SetVersionstampedKey) {
+		// every stamped key is distinct, so there is nothing to fold
+		return false;
+	}
+	auto& t = tr.transaction;
+	auto res = latestAtomicOps.emplace(key, t.mutations.size());
+	if (!res.second) {
+		MutationRef& prev = t.mutations[res.first->second];
+		if (operationType == MutationRef::SetVersionstampedValue &&
+		    prev.type == MutationRef::SetVersionstampedValue) {
+			// the last stamped value wins outright
+			prev.param2 = operand;
+			++trState->cx->transactionAtomicOpsCoalesced;
+			return true;
+		}
+		if (prev.type == operationType && operationType != MutationRef::CompareAndClear &&
+		    operationType != MutationRef::SetVersionstampedValue &&
+		    !(isNonAssociativeOp(operationType) && prev.param2.size() != operand.size())) {
+			RYWMutation folded = WriteMap::coalesce(
+			    RYWMutation(prev.param2, prev.type), RYWMutation(operand, operationType), tr.arena);
+			prev.param2 = folded.value.get();
+			++trState->cx->transactionAtomicOpsCoalesced;
+			return true;
+		}
+		res.first->second = t.mutations.size();
+	}
+	return false;
+}
+
 void Transaction::atomicOp(const KeyRef& key,
                            const ValueRef& operand,
                            MutationRef::Type operationType,
@@ -5664,7 +6599,11 @@ void Transaction::atomicOp(const KeyRef& key,
 	auto r = singleKeyRange(key, req.arena);
 	auto v = ValueRef(req.arena, operand);
 
-	t.mutations.emplace_back(req.arena, operationType, r.begin, v);
+	if (CLIENT_KNOBS->ENABLE_ATOMIC_OP_COALESCING && coalesceAtomicOp(r.begin, operationType, v)) {
+		CODE_PROBE(true, "NativeAPI atomic operation coalesced");
+	} else {
+		t.mutations.emplace_back(req.arena, operationType, r.begin, v);
+	}
 
 	if (addConflictRange && operationType != MutationRef::SetVersionstampedKey)
 		t.write_conflict_ranges.push_back(req.arena, r);
@@ -5674,6 +6613,7 @@ void Transaction::atomicOp(const KeyRef& key,
 
 void Transaction::clear(const KeyRangeRef& range, AddConflictRange addConflictRange) {
 	++trState->cx->transactionClearMutations;
+	trState->cx->recordKeySkew(trState->cx->writeKeySkew, range.begin);
 	auto& req = tr;
 	auto& t = req.transaction;
 
@@ -5696,12 +6636,16 @@ void Transaction::clear(const KeyRangeRef& range, AddConflictRange addConflictRa
 		return;
 
 	t.mutations.emplace_back(req.arena, MutationRef::ClearRange, r.begin, r.end);
+	if (!latestAtomicOps.empty()) {
+		latestAtomicOps.erase(latestAtomicOps.lower_bound(r.begin), latestAtomicOps.lower_bound(r.end));
+	}
 
 	if (addConflictRange)
 		t.write_conflict_ranges.push_back(req.arena, r);
 }
 void Transaction::clear(const KeyRef& key, AddConflictRange addConflictRange) {
 	++trState->cx->transactionClearMutations;
+	trState->cx->recordKeySkew(trState->cx->writeKeySkew, key);
 	// There aren't any keys in the database with size larger than the max key size
 	if (key.size() > getMaxClearKeySize(key)) {
 		return;
@@ -5716,6 +6660,9 @@ void Transaction::clear(const KeyRef& key, AddConflictRange addConflictRange) {
 	data[key.size()] = 0;
 	t.mutations.emplace_back(
 	    req.arena, MutationRef::ClearRange, KeyRef(data, key.size()), KeyRef(data, key.size() + 1));
+	if (!latestAtomicOps.empty()) {
+		latestAtomicOps.erase(KeyRef(data, key.size()));
+	}
 	if (addConflictRange)
 		t.write_conflict_ranges.emplace_back(req.arena, KeyRef(data, key.size()), KeyRef(data, key.size() + 1));
 }
@@ -5807,6 +6754,7 @@ void TransactionOptions::clear() {
 	useGrvCache = false;
 	skipGrvCache = false;
 	rawAccess = false;
+	grvCacheMaxStaleness = 0.0;
 }
 
 TransactionOptions::TransactionOptions() {
@@ -5830,6 +6778,9 @@ void Transaction::resetImpl(bool generateNewSpan) {
 	extraConflictRanges.clear();
 	commitResult = Promise<Void>();
 	committing = Future<Void>();
+	rangePrefetch = Future<RangePrefetch>();
+	lastRangeResult = Future<RangeResult>();
+	latestAtomicOps.clear();
 	cancelWatches();
 }
 
@@ -6240,6 +7191,19 @@ ACTOR static Future<Void> tryCommit(Reference<TransactionState> trState,
 					trState->cx->transactionCommittedMutations += req.transaction.mutations.size();
 					trState->cx->transactionCommittedMutationBytes += req.transaction.mutations.expectedSize();
 
+					if (CLIENT_KNOBS->ENABLE_CLIENT_READ_CACHE) {
+						// Our own writes become visible to later transactions immediately, so
+						// cached values for mutated keys must not outlive this commit. Mutations
+						// carry the tenant prefix at this point, matching the cache's keying.
+						for (auto const& m : req.transaction.mutations) {
+							if (m.type == MutationRef::ClearRange) {
+								trState->cx->readCacheInvalidate(KeyRangeRef(m.param1, m.param2));
+							} else {
+								trState->cx->readCacheInvalidate(m.param1);
+							}
+						}
+					}
+
 					if (commitID.present())
 						g_traceBatch.addEvent("CommitDebug", commitID.get().first(), "NativeAPI.commit.After");
 
@@ -6673,6 +7637,13 @@ void Transaction::setOption(FDBTransactionOptions::Option option, Optional<Strin
 		validateOptionValueNotPresent(value);
 		trState->options.skipGrvCache = true;
 		break;
+	case FDBTransactionOptions::GRV_CACHE_MAX_STALENESS:
+		trState->options.grvCacheMaxStaleness =
+		    extractIntOption(value, 0, std::numeric_limits<int>::max()) / 1000.0;
+		if (trState->numErrors == 0) {
+			trState->options.useGrvCache = true;
+		}
+		break;
 	case FDBTransactionOptions::READ_SYSTEM_KEYS:
 	case FDBTransactionOptions::ACCESS_SYSTEM_KEYS:
 	case FDBTransactionOptions::RAW_ACCESS:
@@ -6984,7 +7955,11 @@ Future<Version> Transaction::getReadVersion(uint32_t flags) {
 			Version rv = trState->cx->getCachedReadVersion();
 			double lastTime = trState->cx->getLastGrvTime();
 			double requestTime = now();
-			if (requestTime - lastTime <= CLIENT_KNOBS->MAX_VERSION_CACHE_LAG && rv != Version(0)) {
+			// A per-transaction bound overrides the knob; bounds tighter than the background
+			// updater's refresh cadence simply fall through to a proxy GRV.
+			double maxCacheLag = trState->options.grvCacheMaxStaleness > 0.0 ? trState->options.grvCacheMaxStaleness
+			                                                                : CLIENT_KNOBS->MAX_VERSION_CACHE_LAG;
+			if (requestTime - lastTime <= maxCacheLag && rv != Version(0)) {
 				ASSERT(!debug_checkVersionTime(rv, requestTime, "CheckStaleness"));
 				readVersion = rv;
 				return readVersion;
@@ -7436,6 +8411,56 @@ ACTOR Future<Standalone<VectorRef<ReadHotRangeWithMetrics>>> getReadHotRanges(Da
 	}
 }
 
+ACTOR Future<Standalone<VectorRef<HotKeyWithMetrics>>> getHotKeys(Database cx, KeyRange keys) {
+	state Span span("NAPI:GetHotKeys"_loc);
+	loop {
+		std::vector<KeyRangeLocationInfo> locations =
+		    wait(getKeyRangeLocations(cx,
+		                              TenantInfo(),
+		                              keys,
+		                              CLIENT_KNOBS->STORAGE_METRICS_SHARD_LIMIT,
+		                              Reverse::False,
+		                              &StorageServerInterface::getHotKeys,
+		                              span.context,
+		                              Optional<UID>(),
+		                              UseProvisionalProxies::False,
+		                              latestVersion));
+		try {
+			state int nLocs = locations.size();
+			state std::vector<Future<GetHotKeysReply>> fReplies(nLocs);
+			KeyRef partBegin, partEnd;
+			for (int i = 0; i < nLocs; i++) {
+				// Clip each request to the shard boundaries; the servers use the requested range to filter
+				// their server-wide hot key index, so this also deduplicates between shards on one server
+				partBegin = (i == 0) ? keys.begin : locations[i].range.begin;
+				partEnd = (i == nLocs - 1) ? keys.end : locations[i].range.end;
+				GetHotKeysRequest req(KeyRangeRef(partBegin, partEnd));
+				fReplies[i] = loadBalance(locations[i].locations->locations(),
+				                          &StorageServerInterface::getHotKeys,
+				                          req,
+				                          TaskPriority::DataDistribution);
+			}
+
+			wait(waitForAll(fReplies));
+
+			Standalone<VectorRef<HotKeyWithMetrics>> results;
+			for (int i = 0; i < nLocs; i++) {
+				results.append(
+				    results.arena(), fReplies[i].get().hotKeys.begin(), fReplies[i].get().hotKeys.size());
+				results.arena().dependsOn(fReplies[i].get().hotKeys.arena());
+			}
+			return results;
+		} catch (Error& e) {
+			if (e.code() != error_code_wrong_shard_server && e.code() != error_code_all_alternatives_failed) {
+				TraceEvent(SevError, "GetHotKeysError").error(e);
+				throw;
+			}
+			cx->invalidateCache(Key(), keys);
+			wait(delay(CLIENT_KNOBS->WRONG_SHARD_SERVER_DELAY, TaskPriority::DataDistribution));
+		}
+	}
+}
+
 ACTOR Future<std::pair<Optional<StorageMetrics>, int>> waitStorageMetrics(Database cx,
                                                                           KeyRange keys,
                                                                           StorageMetrics min,
@@ -7546,10 +8571,31 @@ ACTOR Future<Standalone<VectorRef<DDMetricsRef>>> waitDataDistributionMetricsLis
 	}
 }
 
+ACTOR Future<std::vector<ShardCountEntry>> waitShardCountsList(Database cx) {
+	loop {
+		choose {
+			when(wait(cx->onProxiesChanged())) {}
+			when(ErrorOr<GetShardCountsReply> rep =
+			         wait(errorOr(basicLoadBalance(cx->getCommitProxies(UseProvisionalProxies::False),
+			                                       &CommitProxyInterface::getShardCounts,
+			                                       GetShardCountsRequest())))) {
+				if (rep.isError()) {
+					throw rep.getError();
+				}
+				return rep.get().counts;
+			}
+		}
+	}
+}
+
 Future<Standalone<VectorRef<ReadHotRangeWithMetrics>>> DatabaseContext::getReadHotRanges(KeyRange const& keys) {
 	return ::getReadHotRanges(Database(Reference<DatabaseContext>::addRef(this)), keys);
 }
 
+Future<Standalone<VectorRef<HotKeyWithMetrics>>> DatabaseContext::getHotKeys(KeyRange const& keys) {
+	return ::getHotKeys(Database(Reference<DatabaseContext>::addRef(this)), keys);
+}
+
 ACTOR Future<Standalone<VectorRef<KeyRef>>> getRangeSplitPoints(Reference<TransactionState> trState,
                                                                 KeyRange keys,
                                                                 int64_t chunkSize,
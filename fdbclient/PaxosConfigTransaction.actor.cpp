@@ -240,45 +240,108 @@ public:
 };
 
 class PaxosConfigTransactionImpl {
+	// A get() waiting to be sent as part of a batched read
+	struct PendingGet {
+		ConfigKey key;
+		Promise<Optional<Value>> value;
+		explicit PendingGet(ConfigKey const& key) : key(key) {}
+	};
+
 	std::vector<ConfigTransactionInterface> ctis;
 	GetGenerationQuorum getGenerationQuorum;
 	CommitQuorum commitQuorum;
+	std::vector<PendingGet> pendingGets;
+	ActorCollection getBatchActors{ false };
+	// The replica that most recently served a read for this transaction; reads stick to it (it is
+	// known to be live and up to date) until it fails, at which point a fresh replica is chosen
+	// from those that agreed on the generation
+	Optional<ConfigTransactionInterface> readReplicaHint;
 	int numRetries{ 0 };
 	Optional<UID> dID;
 	Database cx;
 
-	ACTOR static Future<Optional<Value>> get(PaxosConfigTransactionImpl* self, Key key) {
-		state ConfigKey configKey = ConfigKey::decodeKey(key);
-		loop {
-			try {
-				state ConfigGeneration generation = wait(self->getGenerationQuorum.getGeneration());
-				state std::vector<ConfigTransactionInterface> readReplicas =
-				    self->getGenerationQuorum.getReadReplicas();
-				std::vector<Future<Void>> fs;
-				for (ConfigTransactionInterface& readReplica : readReplicas) {
-					if (readReplica.hostname.present()) {
-						fs.push_back(tryInitializeRequestStream(
-						    &readReplica.get, readReplica.hostname.get(), WLTOKEN_CONFIGTXN_GET));
+	static ConfigTransactionGetRequest getBatchRequest(ConfigGeneration generation,
+	                                                   std::vector<PendingGet> const& batch) {
+		ConfigTransactionGetRequest req(generation, batch[0].key);
+		for (int i = 1; i < batch.size(); ++i) {
+			req.additionalKeys.push_back(batch[i].key);
+		}
+		return req;
+	}
+
+	// Coalesces all get()s issued in the same run loop iteration into one batched request, sent to
+	// the cached read replica, so that a multi-knob configuration check costs a single round trip
+	// rather than one quorum read per knob.
+	ACTOR static Future<Void> flushGets(PaxosConfigTransactionImpl* self) {
+		wait(delay(0)); // let gets issued in the same run loop iteration accumulate
+		state std::vector<PendingGet> batch = std::move(self->pendingGets);
+		self->pendingGets.clear();
+		ASSERT(!batch.empty());
+		try {
+			loop {
+				try {
+					state ConfigGeneration generation = wait(self->getGenerationQuorum.getGeneration());
+					state std::vector<ConfigTransactionInterface> readReplicas =
+					    self->getGenerationQuorum.getReadReplicas();
+					std::vector<Future<Void>> fs;
+					for (ConfigTransactionInterface& readReplica : readReplicas) {
+						if (readReplica.hostname.present()) {
+							fs.push_back(tryInitializeRequestStream(
+							    &readReplica.get, readReplica.hostname.get(), WLTOKEN_CONFIGTXN_GET));
+						}
 					}
+					wait(waitForAll(fs));
+					if (!self->readReplicaHint.present() ||
+					    std::find(readReplicas.begin(), readReplicas.end(), self->readReplicaHint.get()) ==
+					        readReplicas.end()) {
+						self->readReplicaHint =
+						    readReplicas[deterministicRandom()->randomInt(0, readReplicas.size())];
+					}
+					state ConfigTransactionGetReply reply =
+					    wait(timeoutError(self->readReplicaHint.get().get.getReply(getBatchRequest(generation, batch)),
+					                      CLIENT_KNOBS->GET_KNOB_TIMEOUT));
+					state std::vector<Optional<KnobValue>> values;
+					values.push_back(reply.value);
+					values.insert(values.end(), reply.additionalValues.begin(), reply.additionalValues.end());
+					if (values.size() != batch.size()) {
+						// The replica predates batched gets; fall back to one read per knob
+						state int i;
+						values.resize(1);
+						for (i = 1; i < batch.size(); ++i) {
+							ConfigTransactionGetReply singleReply = wait(timeoutError(
+							    self->readReplicaHint.get().get.getReply(
+							        ConfigTransactionGetRequest{ generation, batch[i].key }),
+							    CLIENT_KNOBS->GET_KNOB_TIMEOUT));
+							values.push_back(singleReply.value);
+						}
+					}
+					for (int j = 0; j < batch.size(); ++j) {
+						if (values[j].present()) {
+							batch[j].value.send(values[j].get().toValue());
+						} else {
+							batch[j].value.send(Optional<Value>{});
+						}
+					}
+					return Void();
+				} catch (Error& e) {
+					if (e.code() != error_code_timed_out && e.code() != error_code_broken_promise) {
+						throw;
+					}
+					// The cached replica may be dead or lagging; pick a fresh one on retry
+					self->readReplicaHint = Optional<ConfigTransactionInterface>{};
+					self->reset();
 				}
-				wait(waitForAll(fs));
-				state Reference<ConfigTransactionInfo> configNodes(new ConfigTransactionInfo(readReplicas));
-				ConfigTransactionGetReply reply =
-				    wait(timeoutError(basicLoadBalance(configNodes,
-				                                       &ConfigTransactionInterface::get,
-				                                       ConfigTransactionGetRequest{ generation, configKey }),
-				                      CLIENT_KNOBS->GET_KNOB_TIMEOUT));
-				if (reply.value.present()) {
-					return reply.value.get().toValue();
-				} else {
-					return Optional<Value>{};
-				}
-			} catch (Error& e) {
-				if (e.code() != error_code_timed_out && e.code() != error_code_broken_promise) {
-					throw;
+			}
+		} catch (Error& e) {
+			if (e.code() == error_code_actor_cancelled) {
+				throw;
+			}
+			for (auto& pending : batch) {
+				if (pending.value.canBeSet()) {
+					pending.value.sendError(e);
 				}
-				self->reset();
 			}
+			return Void();
 		}
 	}
 
@@ -375,7 +438,13 @@ public:
 
 	void clear(KeyRef key) { commitQuorum.clear(key); }
 
-	Future<Optional<Value>> get(Key const& key) { return get(this, key); }
+	Future<Optional<Value>> get(Key const& key) {
+		if (pendingGets.empty()) {
+			getBatchActors.add(flushGets(this));
+		}
+		pendingGets.emplace_back(ConfigKey::decodeKey(key));
+		return pendingGets.back().value.getFuture();
+	}
 
 	Future<RangeResult> getRange(KeyRangeRef keys) {
 		if (keys == configClassKeys) {
@@ -1534,6 +1534,47 @@ ACTOR Future<RangeResult> getWorkerInterfaces(Reference<IClusterConnectionRecord
 	}
 }
 
+// Asks the cluster controller for the role layout a fresh recruitment would produce and renders it as JSON;
+// see RecruitmentDryRunRequest.
+ACTOR Future<Optional<Value>> getRecruitmentDryRun(Reference<IClusterConnectionRecord> connRecord) {
+	state Reference<AsyncVar<Optional<ClusterInterface>>> clusterInterface(new AsyncVar<Optional<ClusterInterface>>);
+	state Future<Void> leaderMon = monitorLeader<ClusterInterface>(connRecord, clusterInterface);
+
+	loop {
+		choose {
+			when(RecruitmentDryRunReply reply =
+			         wait(clusterInterface->get().present()
+			                  ? brokenPromiseToNever(clusterInterface->get().get().recruitmentDryRun.getReply(
+			                        RecruitmentDryRunRequest()))
+			                  : Never())) {
+				StatusObject result;
+				if (!reply.errorMsg.empty()) {
+					result["error"] = reply.errorMsg;
+					return getValueFromJSON(result);
+				}
+				if (reply.dcId.present()) {
+					result["dc_id"] = reply.dcId.get().toString();
+				}
+				auto addressArray = [](const std::vector<NetworkAddress>& addresses) {
+					StatusArray array;
+					for (const auto& address : addresses) {
+						array.push_back(address.toString());
+					}
+					return array;
+				};
+				result["tlogs"] = addressArray(reply.tLogs);
+				result["satellite_tlogs"] = addressArray(reply.satelliteTLogs);
+				result["commit_proxies"] = addressArray(reply.commitProxies);
+				result["grv_proxies"] = addressArray(reply.grvProxies);
+				result["resolvers"] = addressArray(reply.resolvers);
+				result["backup_workers"] = addressArray(reply.backupWorkers);
+				return getValueFromJSON(result);
+			}
+			when(wait(clusterInterface->onChange())) {}
+		}
+	}
+}
+
 Future<Optional<Value>> ReadYourWritesTransaction::get(const Key& key, Snapshot snapshot) {
 	CODE_PROBE(true, "ReadYourWritesTransaction::get");
 
@@ -1682,6 +1723,46 @@ Future<RangeResult> ReadYourWritesTransaction::getRange(const KeySelector& begin
 	return getRange(begin, end, GetRangeLimits(limit), snapshot, reverse);
 }
 
+// Streams the range directly from the storage servers as ordered fragments. Streamed reads do not
+// observe this transaction's uncommitted writes, so they require either snapshot isolation or
+// read-your-writes to be disabled. All errors, including those from the guards below, are
+// delivered through the results stream so that consumers only need to watch one channel.
+Future<Void> ReadYourWritesTransaction::getRangeStream(PromiseStream<Standalone<RangeResultRef>> const& results,
+                                                       KeySelector const& begin,
+                                                       KeySelector const& end,
+                                                       Snapshot snapshot) {
+	auto fail = [&results](Error e) -> Future<Void> {
+		results.sendError(e);
+		return e;
+	};
+
+	if (specialKeys.contains(begin.getKey()) && specialKeys.begin <= end.getKey() &&
+	    end.getKey() <= specialKeys.end) {
+		CODE_PROBE(true, "Special key space range stream");
+		return fail(client_invalid_operation());
+	}
+
+	if (checkUsedDuringCommit()) {
+		return fail(used_during_commit());
+	}
+
+	if (resetPromise.isSet()) {
+		return fail(resetPromise.getFuture().getError());
+	}
+
+	KeyRef maxKey = getMaxReadKey();
+	if (begin.getKey() > maxKey || end.getKey() > maxKey) {
+		return fail(key_outside_legal_range());
+	}
+
+	if (!snapshot && !options.readYourWritesDisabled) {
+		CODE_PROBE(true, "Range stream rejected under serializable read-your-writes");
+		return fail(client_invalid_operation());
+	}
+
+	return tr.getRangeStream(results, begin, end, GetRangeLimits(), snapshot, Reverse::False);
+}
+
 Future<MappedRangeResult> ReadYourWritesTransaction::getMappedRange(KeySelector begin,
                                                                     KeySelector end,
                                                                     Key mapper,
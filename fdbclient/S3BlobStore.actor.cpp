@@ -74,6 +74,7 @@ S3BlobStoreEndpoint::BlobKnobs::BlobKnobs() {
 	connect_tries = CLIENT_KNOBS->BLOBSTORE_CONNECT_TRIES;
 	connect_timeout = CLIENT_KNOBS->BLOBSTORE_CONNECT_TIMEOUT;
 	max_connection_life = CLIENT_KNOBS->BLOBSTORE_MAX_CONNECTION_LIFE;
+	max_connection_pool_size = CLIENT_KNOBS->BLOBSTORE_MAX_CONNECTION_POOL_SIZE;
 	request_tries = CLIENT_KNOBS->BLOBSTORE_REQUEST_TRIES;
 	request_timeout_min = CLIENT_KNOBS->BLOBSTORE_REQUEST_TIMEOUT_MIN;
 	requests_per_second = CLIENT_KNOBS->BLOBSTORE_REQUESTS_PER_SECOND;
@@ -106,6 +107,7 @@ bool S3BlobStoreEndpoint::BlobKnobs::set(StringRef name, int value) {
 	TRY_PARAM(connect_tries, ct);
 	TRY_PARAM(connect_timeout, cto);
 	TRY_PARAM(max_connection_life, mcl);
+	TRY_PARAM(max_connection_pool_size, mcps);
 	TRY_PARAM(request_tries, rt);
 	TRY_PARAM(request_timeout_min, rtom);
 	// TODO: For backward compatibility because request_timeout was renamed to request_timeout_min
@@ -148,6 +150,7 @@ std::string S3BlobStoreEndpoint::BlobKnobs::getURLParameters() const {
 	_CHECK_PARAM(connect_tries, ct);
 	_CHECK_PARAM(connect_timeout, cto);
 	_CHECK_PARAM(max_connection_life, mcl);
+	_CHECK_PARAM(max_connection_pool_size, mcps);
 	_CHECK_PARAM(request_tries, rt);
 	_CHECK_PARAM(request_timeout_min, rto);
 	_CHECK_PARAM(requests_per_second, rps);
@@ -712,10 +715,10 @@ Future<Void> S3BlobStoreEndpoint::updateSecret() {
 }
 
 ACTOR Future<S3BlobStoreEndpoint::ReusableConnection> connect_impl(Reference<S3BlobStoreEndpoint> b) {
-	// First try to get a connection from the pool
+	// First try to get a connection from the pool, most recently used first
 	while (!b->connectionPool.empty()) {
 		S3BlobStoreEndpoint::ReusableConnection rconn = b->connectionPool.front();
-		b->connectionPool.pop();
+		b->connectionPool.pop_front();
 
 		// If the connection expires in the future then return it
 		if (rconn.expirationTime > now()) {
@@ -763,9 +766,10 @@ Future<S3BlobStoreEndpoint::ReusableConnection> S3BlobStoreEndpoint::connect() {
 }
 
 void S3BlobStoreEndpoint::returnConnection(ReusableConnection& rconn) {
-	// If it expires in the future then add it to the pool in the front
-	if (rconn.expirationTime > now())
-		connectionPool.push(rconn);
+	// If it expires in the future then add it to the front of the pool so the most recently used
+	// connection is reused first, letting idle connections at the back expire out of the pool
+	if (rconn.expirationTime > now() && (int)connectionPool.size() < knobs.max_connection_pool_size)
+		connectionPool.push_front(rconn);
 	rconn.conn = Reference<IConnection>();
 }
 
@@ -284,6 +284,17 @@ const KeyRef JSONSchemas::statusSchema = LiteralStringRef(R"statusSchema(
                   "read_latency_bands":{
                      "$map": 1
                   },
+                  "read_latency_bands_by_range":[
+                     {
+                        "begin":"",
+                        "end":"",
+                        "count":0,
+                        "filtered":0,
+                        "bands":{
+                           "$map": 1
+                        }
+                     }
+                  ],
                   "commit_latency_bands":{
                      "$map": 1
                   },
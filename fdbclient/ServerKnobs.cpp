@@ -37,6 +37,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( MAX_VERSIONS_IN_FLIGHT_FORCED,         6e5 * VERSIONS_PER_SECOND ); //one week of versions
 	init( ENABLE_VERSION_VECTOR,                               false );
 	init( ENABLE_VERSION_VECTOR_TLOG_UNICAST,                  false );
+	init( VERSION_VECTOR_MAX_SIZE,                              1000 ); if( randomize && BUGGIFY ) VERSION_VECTOR_MAX_SIZE = 10;
 
         bool buggifyShortReadWindow = randomize && BUGGIFY && !ENABLE_VERSION_VECTOR;
 	init( MAX_READ_TRANSACTION_LIFE_VERSIONS,      5 * VERSIONS_PER_SECOND ); if (randomize && BUGGIFY) MAX_READ_TRANSACTION_LIFE_VERSIONS = VERSIONS_PER_SECOND; else if (buggifyShortReadWindow) MAX_READ_TRANSACTION_LIFE_VERSIONS = std::max<int>(1, 0.1 * VERSIONS_PER_SECOND); else if( randomize && BUGGIFY ) MAX_READ_TRANSACTION_LIFE_VERSIONS = 10 * VERSIONS_PER_SECOND;
@@ -57,6 +58,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( DESIRED_UPDATE_BYTES,                2*DESIRED_TOTAL_BYTES );
 	init( UPDATE_DELAY,                                        0.001 );
 	init( MAXIMUM_PEEK_BYTES,                                   10e6 );
+	init( LOG_ROUTER_PEEK_MAX_BYTES,           8*DESIRED_TOTAL_BYTES ); if( randomize && BUGGIFY ) LOG_ROUTER_PEEK_MAX_BYTES = DESIRED_TOTAL_BYTES;
 	init( APPLY_MUTATION_BYTES,                                  1e6 );
 	init( RECOVERY_DATA_BYTE_LIMIT,                           100000 );
 	init( BUGGIFY_RECOVERY_DATA_LIMIT,                          1000 );
@@ -75,21 +77,27 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( TLOG_MESSAGE_BLOCK_OVERHEAD_FACTOR,      double(TLOG_MESSAGE_BLOCK_BYTES) / (TLOG_MESSAGE_BLOCK_BYTES - MAX_MESSAGE_SIZE) ); //1.0121466709838096006362758832473
 	init( PEEK_TRACKER_EXPIRATION_TIME,                          600 ); if( randomize && BUGGIFY ) PEEK_TRACKER_EXPIRATION_TIME = deterministicRandom()->coinflip() ? 0.1 : 120;
 	init( PEEK_USING_STREAMING,                                false ); if( randomize && isSimulated && BUGGIFY ) PEEK_USING_STREAMING = true;
+	init( PEEK_USING_STREAMING_LOCAL,                           true ); if( randomize && BUGGIFY ) PEEK_USING_STREAMING_LOCAL = false;
 	init( PARALLEL_GET_MORE_REQUESTS,                             32 ); if( randomize && BUGGIFY ) PARALLEL_GET_MORE_REQUESTS = 2;
 	init( MULTI_CURSOR_PRE_FETCH_LIMIT,                           10 );
 	init( MAX_QUEUE_COMMIT_BYTES,                               15e6 ); if( randomize && BUGGIFY ) MAX_QUEUE_COMMIT_BYTES = 5000;
+	init( TLOG_QUEUE_COMMIT_PIPELINE_DEPTH,                        4 ); if( randomize && BUGGIFY ) TLOG_QUEUE_COMMIT_PIPELINE_DEPTH = deterministicRandom()->randomInt(1, 10);
 	init( DESIRED_OUTSTANDING_MESSAGES,                         5000 ); if( randomize && BUGGIFY ) DESIRED_OUTSTANDING_MESSAGES = deterministicRandom()->randomInt(0,100);
 	init( DESIRED_GET_MORE_DELAY,                              0.005 );
 	init( CONCURRENT_LOG_ROUTER_READS,                             5 ); if( randomize && BUGGIFY ) CONCURRENT_LOG_ROUTER_READS = 1;
 	init( LOG_ROUTER_PEEK_FROM_SATELLITES_PREFERRED,               1 ); if( randomize && BUGGIFY ) LOG_ROUTER_PEEK_FROM_SATELLITES_PREFERRED = 0;
 	init( DISK_QUEUE_ADAPTER_MIN_SWITCH_TIME,                    1.0 );
 	init( DISK_QUEUE_ADAPTER_MAX_SWITCH_TIME,                    5.0 );
+	init( DISK_QUEUE_ADAPTER_PEEK_AHEAD_BYTES,                   4e6 ); if( randomize && BUGGIFY ) DISK_QUEUE_ADAPTER_PEEK_AHEAD_BYTES = 0;
 	init( TLOG_SPILL_REFERENCE_MAX_PEEK_MEMORY_BYTES,            2e9 ); if ( randomize && BUGGIFY ) TLOG_SPILL_REFERENCE_MAX_PEEK_MEMORY_BYTES = 2e6;
 	init( TLOG_SPILL_REFERENCE_MAX_BATCHES_PER_PEEK,           100 ); if ( randomize && BUGGIFY ) TLOG_SPILL_REFERENCE_MAX_BATCHES_PER_PEEK = 1;
 	init( TLOG_SPILL_REFERENCE_MAX_BYTES_PER_BATCH,           16<<10 ); if ( randomize && BUGGIFY ) TLOG_SPILL_REFERENCE_MAX_BYTES_PER_BATCH = 500;
+	init( TLOG_SPILL_REFERENCE_CARRY_PARTIAL_BATCH,             true ); if ( randomize && BUGGIFY ) TLOG_SPILL_REFERENCE_CARRY_PARTIAL_BATCH = false;
 	init( DISK_QUEUE_FILE_EXTENSION_BYTES,                    10<<20 ); // BUGGIFYd per file within the DiskQueue
 	init( DISK_QUEUE_FILE_SHRINK_BYTES,                      100<<20 ); // BUGGIFYd per file within the DiskQueue
 	init( DISK_QUEUE_MAX_TRUNCATE_BYTES,                     2LL<<30 ); if ( randomize && BUGGIFY ) DISK_QUEUE_MAX_TRUNCATE_BYTES = 0;
+	init( DISK_QUEUE_PREALLOCATE_EXTENTS,                       true ); if ( randomize && BUGGIFY ) DISK_QUEUE_PREALLOCATE_EXTENTS = false;
+	init( DISK_QUEUE_RECOVERY_READ_AHEAD,                       true ); if ( randomize && BUGGIFY ) DISK_QUEUE_RECOVERY_READ_AHEAD = false;
 	init( TLOG_DEGRADED_DURATION,                                5.0 );
 	init( MAX_CACHE_VERSIONS,                                   10e6 );
 	init( TLOG_IGNORE_POP_AUTO_ENABLE_DELAY,                   300.0 );
@@ -116,6 +124,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( ENABLE_DETAILED_TLOG_POP_TRACE,                      false ); if ( randomize && BUGGIFY ) ENABLE_DETAILED_TLOG_POP_TRACE = true;
 	init( PEEK_BATCHING_EMPTY_MSG,                             false ); if ( randomize && BUGGIFY ) PEEK_BATCHING_EMPTY_MSG = true;
 	init( PEEK_BATCHING_EMPTY_MSG_INTERVAL,                    0.001 ); if ( randomize && BUGGIFY ) PEEK_BATCHING_EMPTY_MSG_INTERVAL = 0.01;
+	init( TLOG_BACKLOG_PEEK_VERSION_LAG,                         2e6 ); if ( randomize && BUGGIFY ) TLOG_BACKLOG_PEEK_VERSION_LAG = deterministicRandom()->coinflip() ? 0 : 1000;
 
 	// disk snapshot max timeout, to be put in TLog, storage and coordinator nodes
 	init( MAX_FORKED_PROCESS_OUTPUT,                            1024 );
@@ -135,6 +144,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( DD_QUEUE_LOGGING_INTERVAL,                             5.0 );
 	init( RELOCATION_PARALLELISM_PER_SOURCE_SERVER,                2 ); if( randomize && BUGGIFY ) RELOCATION_PARALLELISM_PER_SOURCE_SERVER = 1;
 	init( RELOCATION_PARALLELISM_PER_DEST_SERVER,                 10 ); if( randomize && BUGGIFY ) RELOCATION_PARALLELISM_PER_DEST_SERVER = 1; // Note: if this is smaller than FETCH_KEYS_PARALLELISM, this will artificially reduce performance. The current default of 10 is probably too high but is set conservatively for now.
+	init( RELOCATION_PARALLELISM_PER_SOURCE_SERVER_DRAIN,          4 ); if( randomize && BUGGIFY ) RELOCATION_PARALLELISM_PER_SOURCE_SERVER_DRAIN = deterministicRandom()->coinflip() ? 0 : 1;
 	init( DD_QUEUE_MAX_KEY_SERVERS,                              100 ); if( randomize && BUGGIFY ) DD_QUEUE_MAX_KEY_SERVERS = 1;
 	init( DD_REBALANCE_PARALLELISM,                               50 );
 	init( DD_REBALANCE_RESET_AMOUNT,                              30 );
@@ -266,6 +276,16 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( DD_SHARD_SIZE_GRANULARITY,                         5000000 );
 	init( DD_SHARD_SIZE_GRANULARITY_SIM,                      500000 ); if( randomize && BUGGIFY ) DD_SHARD_SIZE_GRANULARITY_SIM = 0;
 	init( DD_MOVE_KEYS_PARALLELISM,                               15 ); if( randomize && BUGGIFY ) DD_MOVE_KEYS_PARALLELISM = 1;
+	init( DD_INITIAL_SCAN_PARALLELISM,                             8 ); if( randomize && BUGGIFY ) DD_INITIAL_SCAN_PARALLELISM = deterministicRandom()->randomInt(1, 4);
+	init( DD_MOVE_COALESCE_LIMIT,                                  8 ); if( randomize && BUGGIFY ) DD_MOVE_COALESCE_LIMIT = deterministicRandom()->coinflip() ? 1 : 64;
+	init( DD_FAST_READ_HOT_SPLIT,                               true ); if( randomize && BUGGIFY ) DD_FAST_READ_HOT_SPLIT = false;
+	init( DD_STORAGE_CACHE_ASSIGNMENT,                         false ); if( randomize && BUGGIFY ) DD_STORAGE_CACHE_ASSIGNMENT = true;
+	init( DD_STORAGE_CACHE_MAX_RANGES,                           100 ); if( randomize && BUGGIFY ) DD_STORAGE_CACHE_MAX_RANGES = 2;
+	init( DD_STORAGE_CACHE_COOLDOWN,                           600.0 ); if( randomize && BUGGIFY ) DD_STORAGE_CACHE_COOLDOWN = 10.0;
+	init( DD_MOVE_BYTES_IN_FLIGHT_BUDGET,                        2e9 ); if( randomize && BUGGIFY ) DD_MOVE_BYTES_IN_FLIGHT_BUDGET = deterministicRandom()->coinflip() ? 0 : 100e6;
+	init( DD_LOAD_AWARE_PLACEMENT,                                 1 ); if( randomize && BUGGIFY ) DD_LOAD_AWARE_PLACEMENT = deterministicRandom()->randomInt(0, 3);
+	init( DD_LOAD_SCORE_READ_SATURATION,                       100e9 );
+	init( DD_LOAD_SCORE_WEIGHT,                                  1.0 ); if( randomize && BUGGIFY ) DD_LOAD_SCORE_WEIGHT = 10.0;
 	init( DD_FETCH_SOURCE_PARALLELISM,                          1000 ); if( randomize && BUGGIFY ) DD_FETCH_SOURCE_PARALLELISM = 1;
 	init( DD_MERGE_LIMIT,                                       2000 ); if( randomize && BUGGIFY ) DD_MERGE_LIMIT = 2;
 	init( DD_SHARD_METRICS_TIMEOUT,                             60.0 ); if( randomize && BUGGIFY ) DD_SHARD_METRICS_TIMEOUT = 0.1;
@@ -321,6 +341,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( SQLITE_READER_THREADS,                                  64 );  // number of read threads
 	init( SQLITE_WRITE_WINDOW_SECONDS,                            -1 );
 	init( SQLITE_CURSOR_MAX_LIFETIME_BYTES,                      1e6 ); if (buggifySmallShards || simulationMediumShards) SQLITE_CURSOR_MAX_LIFETIME_BYTES = MIN_SHARD_BYTES; if( randomize && BUGGIFY ) SQLITE_CURSOR_MAX_LIFETIME_BYTES = 0;
+	init( SQLITE_INLINE_CACHED_READS,                          false ); if( randomize && BUGGIFY ) SQLITE_INLINE_CACHED_READS = true;
 	init( SQLITE_WRITE_WINDOW_LIMIT,                              -1 );
 	if( randomize && BUGGIFY ) {
 		// Choose an window between .01 and 1.01 seconds.
@@ -376,6 +397,11 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	int64_t memtableBytes = isSimulated ? 32 * 1024 : 512 * 1024 * 1024;
 	init( ROCKSDB_MEMTABLE_BYTES,                      memtableBytes );
 	init( ROCKSDB_UNSAFE_AUTO_FSYNC,                           false );
+	// If true, skip the RocksDB WAL and gate commit durability on periodic memtable flushes instead. Relies on the
+	// FDB transaction logs retaining mutations until commits are acknowledged, which updateStorage guarantees.
+	init( ROCKSDB_DISABLE_WAL,                                 false ); if( randomize && BUGGIFY ) ROCKSDB_DISABLE_WAL = deterministicRandom()->coinflip() ? false : true;
+	init( ROCKSDB_DISABLE_WAL_FLUSH_INTERVAL,                    1.0 );
+	init( ROCKSDB_DISABLE_WAL_FLUSH_BYTES,          64 * 1024 * 1024 );
 	init( ROCKSDB_PERIODIC_COMPACTION_SECONDS,                     0 );
 	init( ROCKSDB_PREFIX_LEN,                                      0 );
 	init( ROCKSDB_BLOCK_CACHE_SIZE,                                0 );
@@ -391,6 +417,8 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( ROCKSDB_HISTOGRAMS_SAMPLE_RATE,                      0.001 ); if( randomize && BUGGIFY ) ROCKSDB_HISTOGRAMS_SAMPLE_RATE = 0;
 	init( ROCKSDB_READ_RANGE_ITERATOR_REFRESH_TIME,             30.0 ); if( randomize && BUGGIFY ) ROCKSDB_READ_RANGE_ITERATOR_REFRESH_TIME = 0.1;
 	init( ROCKSDB_READ_RANGE_REUSE_ITERATORS,                   true ); if( randomize && BUGGIFY ) ROCKSDB_READ_RANGE_REUSE_ITERATORS = deterministicRandom()->coinflip() ? true : false;
+	// Maximum number of physical shards a sharded rocksdb range read is fanned out over in parallel. Set to 0 or 1 to read shards sequentially in a single reader thread.
+	init( ROCKSDB_READ_RANGE_SHARD_FANOUT,                         0 ); if( randomize && BUGGIFY ) ROCKSDB_READ_RANGE_SHARD_FANOUT = deterministicRandom()->randomInt(2, 5);
 	// Set to 0 to disable rocksdb write rate limiting. Rate limiter unit: bytes per second.
 	init( ROCKSDB_WRITE_RATE_LIMITER_BYTES_PER_SEC,                0 );
 	// If true, enables dynamic adjustment of ROCKSDB_WRITE_RATE_LIMITER_BYTES according to the recent demand of background IO.
@@ -442,10 +470,15 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( COMMIT_TRANSACTION_BATCH_INTERVAL_MAX,                0.020 );
 	init( COMMIT_TRANSACTION_BATCH_INTERVAL_LATENCY_FRACTION,     0.1 );
 	init( COMMIT_TRANSACTION_BATCH_INTERVAL_SMOOTHER_ALPHA,       0.1 );
+	init( COMMIT_BATCH_LATENCY_TARGET,                            0.0 ); if( randomize && BUGGIFY ) COMMIT_BATCH_LATENCY_TARGET = 0.1; // 0 means use COMMIT_TRANSACTION_BATCH_INTERVAL_LATENCY_FRACTION instead
+	init( COMMIT_BATCH_LATENCY_CONTROL_INTERVAL,                  5.0 );
+	init( COMMIT_BATCH_LATENCY_CONTROL_STEP,                      0.1 );
 	init( COMMIT_TRANSACTION_BATCH_COUNT_MAX,                   32768 ); if( randomize && BUGGIFY ) COMMIT_TRANSACTION_BATCH_COUNT_MAX = 1000; // Do NOT increase this number beyond 32768, as CommitIds only budget 2 bytes for storing transaction id within each batch
 	init( COMMIT_BATCHES_MEM_BYTES_HARD_LIMIT,              8LL << 30 ); if (randomize && BUGGIFY) COMMIT_BATCHES_MEM_BYTES_HARD_LIMIT = deterministicRandom()->randomInt64(100LL << 20,  8LL << 30);
 	init( COMMIT_BATCHES_MEM_FRACTION_OF_TOTAL,                   0.5 );
 	init( COMMIT_BATCHES_MEM_TO_TOTAL_MEM_SCALE_FACTOR,           5.0 );
+	init( KEY_SERVERS_DECODE_CACHE_SIZE,                         1000 ); if( randomize && BUGGIFY ) KEY_SERVERS_DECODE_CACHE_SIZE = deterministicRandom()->coinflip() ? 0 : 10;
+	init( COMMIT_LARGE_TRANSACTION_BYTES,                     1000000 ); if( randomize && BUGGIFY ) COMMIT_LARGE_TRANSACTION_BYTES = deterministicRandom()->coinflip() ? 0 : 1000;
 
 	// these settings disable batch bytes scaling.  Try COMMIT_TRANSACTION_BATCH_BYTES_MAX=1e6, COMMIT_TRANSACTION_BATCH_BYTES_SCALE_BASE=50000, COMMIT_TRANSACTION_BATCH_BYTES_SCALE_POWER=0.5?
 	init( COMMIT_TRANSACTION_BATCH_BYTES_MIN,                  100000 );
@@ -454,6 +487,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( COMMIT_TRANSACTION_BATCH_BYTES_SCALE_POWER,             0.0 );
 
 	init( RESOLVER_COALESCE_TIME,                                1.0 );
+	init( RESOLVER_READ_CHECK_THREADS,                             0 ); // number of worker threads for parallel read-conflict checking; 0 keeps the serial path
 	init( BUGGIFIED_ROW_LIMIT,                  APPLY_MUTATION_BYTES ); if( randomize && BUGGIFY ) BUGGIFIED_ROW_LIMIT = deterministicRandom()->randomInt(3, 30);
 	init( PROXY_SPIN_DELAY,                                     0.01 );
 	init( UPDATE_REMOTE_LOG_VERSION_INTERVAL,                    2.0 );
@@ -529,6 +563,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( CC_PRUNE_CLIENTS_INTERVAL,                            60.0 );
 	init( CC_CHANGE_DELAY,                                       0.1 );
 	init( CC_CLASS_DELAY,                                       0.01 );
+	init( CC_COORDINATOR_RESOLVE_CACHE_TTL,                     60.0 ); if( randomize && BUGGIFY ) CC_COORDINATOR_RESOLVE_CACHE_TTL = 0.0;
 	init( WAIT_FOR_GOOD_RECRUITMENT_DELAY,                       1.0 );
 	init( WAIT_FOR_GOOD_REMOTE_RECRUITMENT_DELAY,                5.0 );
 	init( ATTEMPT_RECRUITMENT_DELAY,                           0.035 );
@@ -624,6 +659,11 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( STORAGE_HARD_LIMIT_VERSION_OVERAGE, VERSIONS_PER_SECOND / 4.0 );
 	init( STORAGE_DURABILITY_LAG_HARD_MAX,                    2000e6 ); if( smallStorageTarget ) STORAGE_DURABILITY_LAG_HARD_MAX = 100e6;
 	init( STORAGE_DURABILITY_LAG_SOFT_MAX,                     250e6 ); if( smallStorageTarget ) STORAGE_DURABILITY_LAG_SOFT_MAX = 10e6;
+	// Aligned below the rocksdb soft/hard pending compaction limits so that ratekeeper backs off before the
+	// storage engine starts stalling writes itself. Only LSM engines report nonzero compaction debt.
+	init( COMPACTION_DEBT_TARGET_BYTES,                         32e9 ); if( smallStorageTarget ) COMPACTION_DEBT_TARGET_BYTES = 10e6;
+	init( COMPACTION_DEBT_SPRING_BYTES,                          8e9 ); if( smallStorageTarget ) COMPACTION_DEBT_SPRING_BYTES = 2500e3;
+	init( COMPACTION_L0_TARGET_FILES,                             16 );
 
 	//FIXME: Low priority reads are disabled by assigning very high knob values, reduce knobs for 7.0
 	init( LOW_PRIORITY_STORAGE_QUEUE_BYTES,                    775e8 ); if( smallStorageTarget ) LOW_PRIORITY_STORAGE_QUEUE_BYTES = 1750e3;
@@ -674,10 +714,15 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( TAG_THROTTLE_EXPIRED_CLEANUP_INTERVAL,                30.0 ); if(randomize && BUGGIFY) TAG_THROTTLE_EXPIRED_CLEANUP_INTERVAL = 1.0;
 	init( AUTO_TAG_THROTTLING_ENABLED,                          true ); if(randomize && BUGGIFY) AUTO_TAG_THROTTLING_ENABLED = false;
 	init( SS_THROTTLE_TAGS_TRACKED,                                1 ); if(randomize && BUGGIFY) SS_THROTTLE_TAGS_TRACKED = deterministicRandom()->randomInt(1, 10);
+	init( SS_HOT_KEYS_TRACKED,                                    10 ); if(randomize && BUGGIFY) SS_HOT_KEYS_TRACKED = deterministicRandom()->randomInt(1, 5);
+	init( SS_HOT_KEY_SKETCH_WIDTH,                              2048 ); if(randomize && BUGGIFY) SS_HOT_KEY_SKETCH_WIDTH = 4;
 	init( GLOBAL_TAG_THROTTLING,                               false );
 	init( GLOBAL_TAG_THROTTLING_MIN_RATE,                        1.0 );
 	init( GLOBAL_TAG_THROTTLING_FOLDING_TIME,                   10.0 );
 	init( GLOBAL_TAG_THROTTLING_TRACE_INTERVAL,                  5.0 );
+	init( GLOBAL_TAG_THROTTLING_PI_KP,                           0.5 ); if(randomize && BUGGIFY) GLOBAL_TAG_THROTTLING_PI_KP = 0.0;
+	init( GLOBAL_TAG_THROTTLING_PI_KI,                           0.1 );
+	init( GLOBAL_TAG_THROTTLING_BURST_WINDOW,                    2.0 ); if(randomize && BUGGIFY) GLOBAL_TAG_THROTTLING_BURST_WINDOW = 0.0;
 
 	//Storage Metrics
 	init( STORAGE_METRICS_AVERAGE_INTERVAL,                    120.0 );
@@ -690,6 +735,8 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( EMPTY_READ_PENALTY,                                   20 ); // 20 bytes
 	init( DD_SHARD_COMPARE_LIMIT,                               1000 );
 	init( READ_SAMPLING_ENABLED,                                false ); if ( randomize && BUGGIFY ) READ_SAMPLING_ENABLED = true;// enable/disable read sampling
+	init( COLD_RANGE_REPORT_INTERVAL,                              0 ); if ( randomize && BUGGIFY ) COLD_RANGE_REPORT_INTERVAL = 10.0;
+	init( COLD_SHARD_READ_BYTES_PER_KSECOND,                    10e6 );
 
 	//Storage Server
 	init( STORAGE_LOGGING_DELAY,                                 5.0 );
@@ -697,14 +744,18 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( FUTURE_VERSION_DELAY,                                  1.0 );
 	init( STORAGE_LIMIT_BYTES,                                500000 );
 	init( BUGGIFY_LIMIT_BYTES,                                  1000 );
-	init( FETCH_USING_STREAMING,                               false ); if( randomize && isSimulated && BUGGIFY ) FETCH_USING_STREAMING = true; //Determines if fetch keys uses streaming reads
+	init( FETCH_USING_STREAMING,                                true ); if( randomize && isSimulated && BUGGIFY ) FETCH_USING_STREAMING = false; //Determines if fetch keys uses streaming reads
 	init( FETCH_BLOCK_BYTES,                                     2e6 );
+	init( FETCH_KEYS_WRITE_BATCH_KEYS,                           100 ); if( randomize && BUGGIFY ) FETCH_KEYS_WRITE_BATCH_KEYS = 1;
 	init( FETCH_KEYS_PARALLELISM_BYTES,                          4e6 ); if( randomize && BUGGIFY ) FETCH_KEYS_PARALLELISM_BYTES = 3e6;
 	init( FETCH_KEYS_PARALLELISM,                                  2 );
 	init( FETCH_KEYS_PARALLELISM_FULL,                            10 );
 	init( FETCH_KEYS_LOWER_PRIORITY,                               0 );
+	init( FETCH_KEYS_SERVE_PREFIX_READS,                        true ); if( randomize && BUGGIFY ) FETCH_KEYS_SERVE_PREFIX_READS = false;
 	init( FETCH_CHANGEFEED_PARALLELISM,                            4 );
 	init( SERVE_FETCH_CHECKPOINT_PARALLELISM,                      4 );
+	init( CHANGE_FEED_DISK_READS_PARALLELISM,                     16 ); if( randomize && BUGGIFY ) CHANGE_FEED_DISK_READS_PARALLELISM = deterministicRandom()->randomInt(1, 3);
+	init( STORAGESERVER_READ_CONCURRENCY,                         64 ); if( randomize && BUGGIFY ) STORAGESERVER_READ_CONCURRENCY = deterministicRandom()->randomInt(2, 16);
 	init( BUGGIFY_BLOCK_BYTES,                                 10000 );
 	init( STORAGE_RECOVERY_VERSION_LAG_LIMIT,				2 * MAX_READ_TRANSACTION_LIFE_VERSIONS );
 	init( STORAGE_COMMIT_BYTES,                             10000000 ); if( randomize && BUGGIFY ) STORAGE_COMMIT_BYTES = 2000000;
@@ -712,11 +763,19 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( STORAGE_DURABILITY_LAG_REJECT_THRESHOLD,              0.25 );
 	init( STORAGE_DURABILITY_LAG_MIN_RATE,                       0.1 );
 	init( STORAGE_COMMIT_INTERVAL,                               0.5 ); if( randomize && BUGGIFY ) STORAGE_COMMIT_INTERVAL = 2.0;
+	init( STORAGE_COMMIT_PACING_ENABLED,                        true ); if( randomize && BUGGIFY ) STORAGE_COMMIT_PACING_ENABLED = false;
+	init( STORAGE_COMMIT_PACING_TARGET_READ_LATENCY,            0.05 ); if( randomize && BUGGIFY ) STORAGE_COMMIT_PACING_TARGET_READ_LATENCY = 0.002;
+	init( STORAGE_COMMIT_PACING_MIN_FACTOR,                     0.25 ); if( randomize && BUGGIFY ) STORAGE_COMMIT_PACING_MIN_FACTOR = 1.0;
+	init( STORAGE_COMMIT_PACING_LATENCY_EFOLD,                   2.0 );
+	init( STORAGE_SPILL_QUEUE_ENABLED,                         false ); if( randomize && BUGGIFY ) STORAGE_SPILL_QUEUE_ENABLED = true;
+	init( STORAGE_SPILL_QUEUE_THRESHOLD_BYTES,                 500e6 ); if( randomize && BUGGIFY ) STORAGE_SPILL_QUEUE_THRESHOLD_BYTES = 100e3;
+	init( STORAGE_SPILL_QUEUE_MAX_BYTES,                        10e9 ); if( randomize && BUGGIFY ) STORAGE_SPILL_QUEUE_MAX_BYTES = 1e6;
 	init( UPDATE_SHARD_VERSION_INTERVAL,                        0.25 ); if( randomize && BUGGIFY ) UPDATE_SHARD_VERSION_INTERVAL = 1.0;
 	init( BYTE_SAMPLING_FACTOR,                                  250 ); //cannot buggify because of differences in restarting tests
 	init( BYTE_SAMPLING_OVERHEAD,                                100 );
 	init( MAX_STORAGE_SERVER_WATCH_BYTES,                      100e6 ); if( randomize && BUGGIFY ) MAX_STORAGE_SERVER_WATCH_BYTES = 10e3;
 	init( MAX_BYTE_SAMPLE_CLEAR_MAP_SIZE,                        1e9 ); if( randomize && BUGGIFY ) MAX_BYTE_SAMPLE_CLEAR_MAP_SIZE = 1e3;
+	init( MAX_DEFERRED_BYTE_SAMPLE_OPS,                         25e3 ); if( randomize && BUGGIFY ) MAX_DEFERRED_BYTE_SAMPLE_OPS = 1;
 	init( LONG_BYTE_SAMPLE_RECOVERY_DELAY,                      60.0 );
 	init( BYTE_SAMPLE_LOAD_PARALLELISM,                            8 ); if( randomize && BUGGIFY ) BYTE_SAMPLE_LOAD_PARALLELISM = 1;
 	init( BYTE_SAMPLE_LOAD_DELAY,                                0.0 ); if( randomize && BUGGIFY ) BYTE_SAMPLE_LOAD_DELAY = 0.1;
@@ -731,6 +790,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( TAG_MEASUREMENT_INTERVAL,                        30.0 ); if( randomize && BUGGIFY ) TAG_MEASUREMENT_INTERVAL = 1.0;
 	init( READ_COST_BYTE_FACTOR,                          16384 ); if( randomize && BUGGIFY ) READ_COST_BYTE_FACTOR = 4096;
 	init( PREFIX_COMPRESS_KVS_MEM_SNAPSHOTS,                    true ); if( randomize && BUGGIFY ) PREFIX_COMPRESS_KVS_MEM_SNAPSHOTS = false;
+	init( KVS_MEM_SNAPSHOT_YIELD_BYTES,                          1e6 ); if( randomize && BUGGIFY ) KVS_MEM_SNAPSHOT_YIELD_BYTES = deterministicRandom()->randomInt(1 << 8, 1 << 14);
 	init( REPORT_DD_METRICS,                                    true );
 	init( DD_METRICS_REPORT_INTERVAL,                           30.0 );
 	init( FETCH_KEYS_TOO_LONG_TIME_CRITERIA,                   300.0 );
@@ -743,6 +803,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( QUICK_GET_VALUE_FALLBACK,                             true );
 	init( QUICK_GET_KEY_VALUES_FALLBACK,                        true );
 	init( MAX_PARALLEL_QUICK_GET_VALUE,                           50 ); if ( randomize && BUGGIFY ) MAX_PARALLEL_QUICK_GET_VALUE = deterministicRandom()->randomInt(1, 100);
+	init( MAX_PARALLEL_REMOTE_QUICK_GET,                         256 ); if ( randomize && BUGGIFY ) MAX_PARALLEL_REMOTE_QUICK_GET = deterministicRandom()->randomInt(1, 20);
 	init( QUICK_GET_KEY_VALUES_LIMIT,                           2000 );
 	init( QUICK_GET_KEY_VALUES_LIMIT_BYTES,                      1e7 );
 	init( STORAGE_SERVER_SHARD_AWARE,                           true );
@@ -773,6 +834,11 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( PEER_TIMEOUT_PERCENTAGE_DEGRADATION_THRESHOLD,         0.1 );
 	init( PEER_DEGRADATION_CONNECTION_FAILURE_COUNT,               1 );
 	init( WORKER_HEALTH_REPORT_RECENT_DESTROYED_PEER,           true );
+	init( ENABLE_IO_HEALTH_PROBER,                             false ); if( randomize && BUGGIFY ) ENABLE_IO_HEALTH_PROBER = true;
+	init( IO_HEALTH_PROBE_INTERVAL,                              5.0 ); if( randomize && BUGGIFY ) IO_HEALTH_PROBE_INTERVAL = 1.0;
+	init( IO_HEALTH_PROBE_LATENCY_SLO,                           1.0 );
+	init( IO_HEALTH_PROBE_TIMEOUT,                               5.0 );
+	init( IO_HEALTH_PROBE_DEGRADED_COUNT,                          3 );
 
 	// Test harness
 	init( WORKER_POLL_DELAY,                                     1.0 );
@@ -796,6 +862,7 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 
 	// Status
 	init( STATUS_MIN_TIME_BETWEEN_REQUESTS,                      0.0 );
+	init( STATUS_CACHE_TTL,                                      0.0 ); if( randomize && BUGGIFY ) STATUS_CACHE_TTL = 2.0;
 	init( MAX_STATUS_REQUESTS_PER_SECOND,                      256.0 );
 	init( CONFIGURATION_ROWS_TO_FETCH,                         20000 );
 	init( DISABLE_DUPLICATE_LOG_WARNING,                       false );
@@ -868,10 +935,12 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( REDWOOD_EXTENT_CONCURRENT_READS,                         4 );
 	init( REDWOOD_KVSTORE_CONCURRENT_READS,                       64 );
 	init( REDWOOD_KVSTORE_RANGE_PREFETCH,                       true );
+	init( REDWOOD_KVSTORE_RANGE_PREFETCH_MAX_FACTOR,               8 ); if( randomize && BUGGIFY ) { REDWOOD_KVSTORE_RANGE_PREFETCH_MAX_FACTOR = deterministicRandom()->randomInt(1, 20); }
 	init( REDWOOD_PAGE_REBUILD_MAX_SLACK,                       0.33 );
 	init( REDWOOD_LAZY_CLEAR_BATCH_SIZE_PAGES,                    10 );
 	init( REDWOOD_LAZY_CLEAR_MIN_PAGES,                            0 );
 	init( REDWOOD_LAZY_CLEAR_MAX_PAGES,                          1e6 );
+	init( REDWOOD_LAZY_CLEAR_MAX_PAGES_PER_SECOND,                 0 ); if( randomize && BUGGIFY ) { REDWOOD_LAZY_CLEAR_MAX_PAGES_PER_SECOND = deterministicRandom()->randomInt(100, 10000); }
 	init( REDWOOD_REMAP_CLEANUP_WINDOW_BYTES, 4LL * 1024 * 1024 * 1024 );
 	init( REDWOOD_REMAP_CLEANUP_TOLERANCE_RATIO,                0.05 );
 	init( REDWOOD_PAGEFILE_GROWTH_SIZE_PAGES,                  20000 ); if( randomize && BUGGIFY ) { REDWOOD_PAGEFILE_GROWTH_SIZE_PAGES = deterministicRandom()->randomInt(200, 1000); }
@@ -879,10 +948,21 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( REDWOOD_HISTOGRAM_INTERVAL,                           30.0 );
 	init( REDWOOD_EVICT_UPDATED_PAGES,                          true ); if( randomize && BUGGIFY ) { REDWOOD_EVICT_UPDATED_PAGES = false; }
 	init( REDWOOD_DECODECACHE_REUSE_MIN_HEIGHT,                    2 ); if( randomize && BUGGIFY ) { REDWOOD_DECODECACHE_REUSE_MIN_HEIGHT = deterministicRandom()->randomInt(1, 7); }
+	init( REDWOOD_DEFRAG_ENABLED,                              false ); if( randomize && BUGGIFY ) { REDWOOD_DEFRAG_ENABLED = true; }
+	init( REDWOOD_DEFRAG_INTERVAL,                              30.0 ); if( randomize && BUGGIFY ) { REDWOOD_DEFRAG_INTERVAL = deterministicRandom()->random01() * 5 + 1; }
+	init( REDWOOD_DEFRAG_BUSY_OPS_PER_SECOND,                   1000 ); if( randomize && BUGGIFY ) { REDWOOD_DEFRAG_BUSY_OPS_PER_SECOND = 1e9; }
+	init( REDWOOD_DEFRAG_PAGES_PER_PASS,                         256 ); if( randomize && BUGGIFY ) { REDWOOD_DEFRAG_PAGES_PER_PASS = deterministicRandom()->randomInt(1, 10); }
+	init( REDWOOD_DEFRAG_MIN_FILL_RATIO,                         0.3 ); if( randomize && BUGGIFY ) { REDWOOD_DEFRAG_MIN_FILL_RATIO = 0.9; }
+	init( REDWOOD_PAGE_ENCODE_THREADS,                             0 ); if( randomize && BUGGIFY ) { REDWOOD_PAGE_ENCODE_THREADS = deterministicRandom()->randomInt(0, 3); }
+	init( REDWOOD_SCAN_CACHE_FRACTION,                           0.0 ); if( randomize && BUGGIFY ) { REDWOOD_SCAN_CACHE_FRACTION = deterministicRandom()->random01() * 0.5; }
+	init( REDWOOD_PAGE_COMPRESSION_ENABLED,                    false ); if( randomize && BUGGIFY ) { REDWOOD_PAGE_COMPRESSION_ENABLED = true; }
+	init( REDWOOD_HISTORY_RETENTION_SECONDS,                       0 ); if( randomize && BUGGIFY ) { REDWOOD_HISTORY_RETENTION_SECONDS = deterministicRandom()->random01() * 60; }
 
 	// Server request latency measurement
 	init( LATENCY_SAMPLE_SIZE,                                100000 );
 	init( LATENCY_METRICS_LOGGING_INTERVAL,                     60.0 );
+	init( LATENCY_BAND_RANGES_LOGGED,                              4 );
+	init( LATENCY_BAND_RANGES_TRACKED,                          1000 ); if( randomize && BUGGIFY ) LATENCY_BAND_RANGES_TRACKED = 2;
 
 	// Cluster recovery
 	init ( CLUSTER_RECOVERY_EVENT_NAME_PREFIX,              "Master" );
@@ -926,7 +1006,12 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( BG_MERGE_CANDIDATE_THRESHOLD_SECONDS, isSimulated ? 20.0 : 30 * 60 ); if (randomize && BUGGIFY) BG_MERGE_CANDIDATE_THRESHOLD_SECONDS = 5.0;
 	init( BG_MERGE_CANDIDATE_DELAY_SECONDS, BG_MERGE_CANDIDATE_THRESHOLD_SECONDS / 10.0 );
 
+	init( BG_ENABLE_LOAD_BALANCING,                             true ); if (randomize && BUGGIFY) BG_ENABLE_LOAD_BALANCING = false;
+	init( BG_LOAD_BALANCE_INTERVAL,                             10.0 ); if (randomize && BUGGIFY) BG_LOAD_BALANCE_INTERVAL = 1.0;
+	init( BG_LOAD_BALANCE_MAX_MOVES,                              10 ); if (randomize && BUGGIFY) BG_LOAD_BALANCE_MAX_MOVES = 1;
+
 	init( BLOB_WORKER_INITIAL_SNAPSHOT_PARALLELISM,                8 ); if( randomize && BUGGIFY ) BLOB_WORKER_INITIAL_SNAPSHOT_PARALLELISM = 1;
+	init( BLOB_WORKER_RESNAPSHOT_PARALLELISM,                     40 ); if( randomize && BUGGIFY ) BLOB_WORKER_RESNAPSHOT_PARALLELISM = deterministicRandom()->randomInt(1, 3);
 	init( BLOB_WORKER_TIMEOUT,                                  10.0 ); if( randomize && BUGGIFY ) BLOB_WORKER_TIMEOUT = 1.0;
 	init( BLOB_WORKER_REQUEST_TIMEOUT,                           5.0 ); if( randomize && BUGGIFY ) BLOB_WORKER_REQUEST_TIMEOUT = 1.0;
 	init( BLOB_WORKERLIST_FETCH_INTERVAL,                        1.0 );
@@ -937,6 +1022,8 @@ void ServerKnobs::initialize(Randomize randomize, ClientKnobs* clientKnobs, IsSi
 	init( BLOB_MANAGER_STATUS_EXP_BACKOFF_MAX,                   5.0 );
 	init( BLOB_MANAGER_STATUS_EXP_BACKOFF_EXPONENT,              1.5 );
 	init( BLOB_MANAGER_CONCURRENT_MERGE_CHECKS,                   64 ); if( randomize && BUGGIFY ) BLOB_MANAGER_CONCURRENT_MERGE_CHECKS = 1 << deterministicRandom()->randomInt(0, 7);
+	init( BLOB_MANAGER_PURGE_BATCH_SIZE,                          64 ); if( randomize && BUGGIFY ) BLOB_MANAGER_PURGE_BATCH_SIZE = deterministicRandom()->randomInt(1, 5);
+	init( BLOB_MANAGER_CONCURRENT_PURGE_DELETES,                 100 ); if( randomize && BUGGIFY ) BLOB_MANAGER_CONCURRENT_PURGE_DELETES = 1 << deterministicRandom()->randomInt(0, 4);
 
 	init( BGCC_TIMEOUT,                   isSimulated ? 10.0 : 120.0 );
 	init( BGCC_MIN_INTERVAL,                isSimulated ? 1.0 : 10.0 );
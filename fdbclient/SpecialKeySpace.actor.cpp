@@ -74,6 +74,9 @@ std::unordered_map<SpecialKeySpace::MODULE, KeyRange> SpecialKeySpace::moduleToB
 	  KeyRangeRef(LiteralStringRef("\xff\xff/global_config/"), LiteralStringRef("\xff\xff/global_config0")) },
 	{ SpecialKeySpace::MODULE::TRACING,
 	  KeyRangeRef(LiteralStringRef("\xff\xff/tracing/"), LiteralStringRef("\xff\xff/tracing0")) },
+	{ SpecialKeySpace::MODULE::TRANSACTIONPROFILE,
+	  KeyRangeRef(LiteralStringRef("\xff\xff/transaction_profile/"),
+	              LiteralStringRef("\xff\xff/transaction_profile0")) },
 	{ SpecialKeySpace::MODULE::ACTORLINEAGE,
 	  KeyRangeRef(LiteralStringRef("\xff\xff/actor_lineage/"), LiteralStringRef("\xff\xff/actor_lineage0")) },
 	{ SpecialKeySpace::MODULE::ACTOR_PROFILER_CONF,
@@ -739,14 +742,84 @@ ACTOR Future<RangeResult> ddMetricsGetRangeActor(ReadYourWritesTransaction* ryw,
 	}
 }
 
-DDStatsRangeImpl::DDStatsRangeImpl(KeyRangeRef kr) : SpecialKeyRangeAsyncImpl(kr) {}
+DDStatsRangeImpl::DDStatsRangeImpl(KeyRangeRef kr) : SpecialKeyRangeCachedImpl(kr) {}
 
-Future<RangeResult> DDStatsRangeImpl::getRange(ReadYourWritesTransaction* ryw,
-                                               KeyRangeRef kr,
-                                               GetRangeLimits limitsHint) const {
+Future<RangeResult> DDStatsRangeImpl::getRangeUncached(ReadYourWritesTransaction* ryw,
+                                                       KeyRangeRef kr,
+                                                       GetRangeLimits limitsHint) const {
 	return ddMetricsGetRangeActor(ryw, kr);
 }
 
+uint64_t DDStatsRangeImpl::cacheGeneration(ReadYourWritesTransaction* ryw) const {
+	// Monitoring tools poll these metrics at high frequency; identical output is served from
+	// the retained arena until the TTL window rolls over
+	return (uint64_t)(now() / CLIENT_KNOBS->SPECIAL_KEY_METRICS_CACHE_TTL);
+}
+
+ACTOR Future<RangeResult> shardCountsGetRangeActor(ReadYourWritesTransaction* ryw, KeyRangeRef kr) {
+	// The aggregation runs on a commit proxy over its key-to-server map, so the client receives one row
+	// per storage server and team rather than the raw shard mapping
+	std::vector<ShardCountEntry> counts = wait(waitShardCountsList(ryw->getDatabase()));
+	RangeResult result;
+	for (const auto& entry : counts) {
+		KeyRef key = entry.name.withPrefix(shardCountsRange.begin, result.arena());
+		if (!kr.contains(key)) {
+			continue;
+		}
+		json_spirit::mObject statsObj;
+		statsObj["shards"] = entry.shards;
+		std::string statsString =
+		    json_spirit::write_string(json_spirit::mValue(statsObj), json_spirit::Output_options::raw_utf8);
+		ValueRef bytes(result.arena(), statsString);
+		result.push_back(result.arena(), KeyValueRef(key, bytes));
+	}
+	return result;
+}
+
+ShardCountsImpl::ShardCountsImpl(KeyRangeRef kr) : SpecialKeyRangeCachedImpl(kr) {}
+
+Future<RangeResult> ShardCountsImpl::getRangeUncached(ReadYourWritesTransaction* ryw,
+                                                      KeyRangeRef kr,
+                                                      GetRangeLimits limitsHint) const {
+	return shardCountsGetRangeActor(ryw, kr);
+}
+
+uint64_t ShardCountsImpl::cacheGeneration(ReadYourWritesTransaction* ryw) const {
+	// The underlying counts only move as fast as data distribution; serve repeated polls from cache
+	// within the TTL window
+	return (uint64_t)(now() / CLIENT_KNOBS->SPECIAL_KEY_METRICS_CACHE_TTL);
+}
+
+ACTOR Future<RangeResult> hotKeyMetricsGetRangeActor(ReadYourWritesTransaction* ryw, KeyRangeRef kr) {
+	auto keys = kr.removePrefix(hotKeyMetricsRange.begin);
+	Standalone<VectorRef<HotKeyWithMetrics>> hotKeys = wait(ryw->getDatabase()->getHotKeys(keys));
+	// Each storage server reports its own top keys in heap order, so the concatenated replies must be
+	// sorted to satisfy the key ordering contract of getRange
+	std::vector<HotKeyWithMetrics> sorted(hotKeys.begin(), hotKeys.end());
+	std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.key < b.key; });
+	RangeResult result;
+	for (const auto& hotKey : sorted) {
+		KeyRef key = hotKey.key.withPrefix(hotKeyMetricsRange.begin, result.arena());
+		// Use json string encoded in utf-8 to encode the values, easy for adding more fields in the future
+		json_spirit::mObject statsObj;
+		statsObj["read_cost_per_sec"] = hotKey.readRate;
+		statsObj["write_cost_per_sec"] = hotKey.writeRate;
+		std::string statsString =
+		    json_spirit::write_string(json_spirit::mValue(statsObj), json_spirit::Output_options::raw_utf8);
+		ValueRef value(result.arena(), statsString);
+		result.push_back(result.arena(), KeyValueRef(key, value));
+	}
+	return result;
+}
+
+HotKeyMetricsImpl::HotKeyMetricsImpl(KeyRangeRef kr) : SpecialKeyRangeReadImpl(kr) {}
+
+Future<RangeResult> HotKeyMetricsImpl::getRange(ReadYourWritesTransaction* ryw,
+                                                KeyRangeRef kr,
+                                                GetRangeLimits limitsHint) const {
+	return hotKeyMetricsGetRangeActor(ryw, kr);
+}
+
 Key SpecialKeySpace::getManagementApiCommandOptionSpecialKey(const std::string& command, const std::string& option) {
 	Key prefix = LiteralStringRef("options/").withPrefix(moduleToBoundary[MODULE::MANAGEMENT].begin);
 	auto pair = command + "/" + option;
@@ -2298,6 +2371,30 @@ Future<RangeResult> ActorLineageImpl::getRange(ReadYourWritesTransaction* ryw,
 	return actorLineageGetRangeActor(ryw, getKeyRange().begin, kr);
 }
 
+TransactionProfileRingImpl::TransactionProfileRingImpl(KeyRangeRef kr) : SpecialKeyRangeReadImpl(kr) {}
+
+Future<RangeResult> TransactionProfileRingImpl::getRange(ReadYourWritesTransaction* ryw,
+                                                         KeyRangeRef kr,
+                                                         GetRangeLimits limitsHint) const {
+	RangeResult result;
+	KeyRef prefix = getKeyRange().begin;
+	// The ring is ordered by sequence number and the zero-padded hex encoding preserves that order,
+	// so entries can be appended in ring order and filtered against kr directly.
+	for (const auto& entry : ryw->getDatabase()->transactionProfileRing) {
+		Key key = Key(format("%016llx/", (unsigned long long)entry.seq) + entry.identifier).withPrefix(prefix);
+		if (!kr.contains(key)) {
+			continue;
+		}
+		result.push_back_deep(result.arena(), KeyValueRef(key, entry.chunk));
+		limitsHint.decrement(result.back());
+		if (limitsHint.isReached()) {
+			result.more = true;
+			break;
+		}
+	}
+	return result;
+}
+
 namespace {
 std::string_view to_string_view(StringRef sr) {
 	return std::string_view(reinterpret_cast<const char*>(sr.begin()), sr.size());
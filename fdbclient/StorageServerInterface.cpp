@@ -55,31 +55,71 @@ void TSS_traceMismatch(TraceEvent& event,
 	    .detail("TSSReply", tss.value.present() ? traceChecksumValue(tss.value.get()) : "missing");
 }
 
-// key selector reads
+// batched point reads
 template <>
-bool TSS_doCompare(const GetKeyReply& src, const GetKeyReply& tss) {
-	// This process is a bit complicated. Since the tss and ss can return different results if neighboring shards to
-	// req.sel.key are currently being moved, We validate that the results are the same IF the returned key selectors
-	// are final. Otherwise, we only mark the request as a mismatch if the difference between the two returned key
-	// selectors could ONLY be because of different results from the storage engines. We can afford to only partially
-	// check key selectors that start in a TSS shard and end in a non-TSS shard because the other read queries and the
-	// consistency check will eventually catch a misbehaving storage engine.
+bool TSS_doCompare(const GetMultipleValuesReply& src, const GetMultipleValuesReply& tss) {
+	if (src.values.size() != tss.values.size()) {
+		return false;
+	}
+	for (int i = 0; i < src.values.size(); i++) {
+		if (src.values[i].present() != tss.values[i].present() ||
+		    (src.values[i].present() && src.values[i].get() != tss.values[i].get())) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template <>
+const char* TSS_mismatchTraceName(const GetMultipleValuesRequest& req) {
+	return "TSSMismatchGetMultipleValues";
+}
+
+template <>
+void TSS_traceMismatch(TraceEvent& event,
+                       const GetMultipleValuesRequest& req,
+                       const GetMultipleValuesReply& src,
+                       const GetMultipleValuesReply& tss) {
+	event.detail("KeyCount", req.keys.size())
+	    .detail("Tenant", req.tenantInfo.name)
+	    .detail("Version", req.version)
+	    .detail("SSReplyCount", src.values.size())
+	    .detail("TSSReplyCount", tss.values.size());
+	for (int i = 0; i < src.values.size() && i < tss.values.size(); i++) {
+		if (src.values[i].present() != tss.values[i].present() ||
+		    (src.values[i].present() && src.values[i].get() != tss.values[i].get())) {
+			event.detail("Key", req.keys[i].printable())
+			    .detail("SSReply", src.values[i].present() ? traceChecksumValue(src.values[i].get()) : "missing")
+			    .detail("TSSReply", tss.values[i].present() ? traceChecksumValue(tss.values[i].get()) : "missing");
+			break;
+		}
+	}
+}
+
+// key selector reads
+// This process is a bit complicated. Since the tss and ss can return different results if neighboring shards to
+// the requested key are currently being moved, We validate that the results are the same IF the returned key
+// selectors are final. Otherwise, we only mark the request as a mismatch if the difference between the two returned
+// key selectors could ONLY be because of different results from the storage engines. We can afford to only partially
+// check key selectors that start in a TSS shard and end in a non-TSS shard because the other read queries and the
+// consistency check will eventually catch a misbehaving storage engine.
+static bool compareUpdatedKeySelectors(const KeySelectorRef& src, const KeySelectorRef& tss) {
 	bool matches = true;
-	if (src.sel.orEqual == tss.sel.orEqual && src.sel.offset == tss.sel.offset) {
+	if (src.orEqual == tss.orEqual && src.offset == tss.offset) {
 		// full matching case
-		if (src.sel.offset == 0 && src.sel.orEqual) {
+		if (src.offset == 0 && src.orEqual) {
 			// found exact key, should be identical
-			matches = src.sel.getKey() == tss.sel.getKey();
+			matches = src.getKey() == tss.getKey();
 		}
 		// if the query doesn't return the final key, there is an edge case where the ss and tss have different shard
 		// boundaries, so they pass different shard boundary keys back for the same offset
-	} else if (src.sel.getKey() == tss.sel.getKey()) {
+	} else if (src.getKey() == tss.getKey()) {
 		// There is one case with a positive offset where the shard boundary the incomplete query stopped at is the next
 		// key in the shard that the complete query returned. This is not possible with a negative offset because the
 		// shard boundary is exclusive backwards
-		if (src.sel.offset == 0 && src.sel.orEqual && tss.sel.offset == 1 && !tss.sel.orEqual) {
+		if (src.offset == 0 && src.orEqual && tss.offset == 1 && !tss.orEqual) {
 			// case where ss was complete and tss was incomplete
-		} else if (tss.sel.offset == 0 && tss.sel.orEqual && src.sel.offset == 1 && !src.sel.orEqual) {
+		} else if (tss.offset == 0 && tss.orEqual && src.offset == 1 && !src.orEqual) {
 			// case where tss was complete and ss was incomplete
 		} else {
 			matches = false;
@@ -87,16 +127,21 @@ bool TSS_doCompare(const GetKeyReply& src, const GetKeyReply& tss) {
 	} else {
 		// ss/tss returned different keys, and different offsets and/or orEqual
 		// here we just validate that ordering of the keys matches the ordering of the offsets
-		bool tssKeyLarger = src.sel.getKey() < tss.sel.getKey();
+		bool tssKeyLarger = src.getKey() < tss.getKey();
 		// the only case offsets are equal and orEqual aren't equal is the case with a negative offset,
 		// where one response has <=0 with the actual result and the other has <0 with the shard upper boundary.
 		// So whichever one has the actual result should have the lower key.
-		bool tssOffsetLarger = (src.sel.offset == tss.sel.offset) ? tss.sel.orEqual : src.sel.offset < tss.sel.offset;
+		bool tssOffsetLarger = (src.offset == tss.offset) ? tss.orEqual : src.offset < tss.offset;
 		matches = tssKeyLarger != tssOffsetLarger;
 	}
 	return matches;
 }
 
+template <>
+bool TSS_doCompare(const GetKeyReply& src, const GetKeyReply& tss) {
+	return compareUpdatedKeySelectors(src.sel, tss.sel);
+}
+
 template <>
 const char* TSS_mismatchTraceName(const GetKeyRequest& req) {
 	return "TSSMismatchGetKey";
@@ -115,6 +160,58 @@ void TSS_traceMismatch(TraceEvent& event, const GetKeyRequest& req, const GetKey
 	            format("%s%s:%d", tss.sel.orEqual ? "=" : "", tss.sel.getKey().printable().c_str(), tss.sel.offset));
 }
 
+// batched key selector reads
+template <>
+bool TSS_doCompare(const GetMultipleKeysReply& src, const GetMultipleKeysReply& tss) {
+	if (src.sels.size() != tss.sels.size()) {
+		return false;
+	}
+	for (int i = 0; i < src.sels.size(); i++) {
+		if (!compareUpdatedKeySelectors(src.sels[i], tss.sels[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template <>
+const char* TSS_mismatchTraceName(const GetMultipleKeysRequest& req) {
+	return "TSSMismatchGetMultipleKeys";
+}
+
+template <>
+void TSS_traceMismatch(TraceEvent& event,
+                       const GetMultipleKeysRequest& req,
+                       const GetMultipleKeysReply& src,
+                       const GetMultipleKeysReply& tss) {
+	event.detail("SelCount", req.sels.size())
+	    .detail("Tenant", req.tenantInfo.name)
+	    .detail("Version", req.version)
+	    .detail("SSReplyCount", src.sels.size())
+	    .detail("TSSReplyCount", tss.sels.size());
+	for (int i = 0; i < src.sels.size() && i < tss.sels.size(); i++) {
+		if (!compareUpdatedKeySelectors(src.sels[i], tss.sels[i])) {
+			event
+			    .detail("KeySelector",
+			            format("%s%s:%d",
+			                   req.sels[i].orEqual ? "=" : "",
+			                   req.sels[i].getKey().printable().c_str(),
+			                   req.sels[i].offset))
+			    .detail("SSReply",
+			            format("%s%s:%d",
+			                   src.sels[i].orEqual ? "=" : "",
+			                   src.sels[i].getKey().printable().c_str(),
+			                   src.sels[i].offset))
+			    .detail("TSSReply",
+			            format("%s%s:%d",
+			                   tss.sels[i].orEqual ? "=" : "",
+			                   tss.sels[i].getKey().printable().c_str(),
+			                   tss.sels[i].offset));
+			break;
+		}
+	}
+}
+
 // range reads
 template <>
 bool TSS_doCompare(const GetKeyValuesReply& src, const GetKeyValuesReply& tss) {
@@ -417,6 +514,12 @@ void TSSMetrics::recordLatency(const GetKeyRequest& req, double ssLatency, doubl
 	TSSgetKeyLatency.addSample(tssLatency);
 }
 
+template <>
+void TSSMetrics::recordLatency(const GetMultipleKeysRequest& req, double ssLatency, double tssLatency) {
+	SSgetKeyLatency.addSample(ssLatency);
+	TSSgetKeyLatency.addSample(tssLatency);
+}
+
 template <>
 void TSSMetrics::recordLatency(const GetKeyValuesRequest& req, double ssLatency, double tssLatency) {
 	SSgetKeyValuesLatency.addSample(ssLatency);
@@ -364,6 +364,12 @@ const Value storageCacheServerValue(const StorageServerInterface& ssi) {
 const KeyRangeRef ddStatsRange = KeyRangeRef(LiteralStringRef("\xff\xff/metrics/data_distribution_stats/"),
                                              LiteralStringRef("\xff\xff/metrics/data_distribution_stats/\xff\xff"));
 
+const KeyRangeRef hotKeyMetricsRange = KeyRangeRef(LiteralStringRef("\xff\xff/metrics/hot_keys/"),
+                                                   LiteralStringRef("\xff\xff/metrics/hot_keys/\xff\xff"));
+
+const KeyRangeRef shardCountsRange = KeyRangeRef(LiteralStringRef("\xff\xff/metrics/shard_counts/"),
+                                                 LiteralStringRef("\xff\xff/metrics/shard_counts/\xff\xff"));
+
 //    "\xff/storageCache/[[begin]]" := "[[vector<uint16_t>]]"
 const KeyRangeRef storageCacheKeys(LiteralStringRef("\xff/storageCache/"), LiteralStringRef("\xff/storageCache0"));
 const KeyRef storageCachePrefix = storageCacheKeys.begin;
@@ -1044,6 +1050,7 @@ const KeyRangeRef fdbClientInfoPrefixRange(LiteralStringRef("\xff\x02/fdbClientI
 
 // ConsistencyCheck settings
 const KeyRef fdbShouldConsistencyCheckBeSuspended = LiteralStringRef("\xff\x02/ConsistencyCheck/Suspend");
+const KeyRef fdbConsistencyCheckProgressKey = LiteralStringRef("\xff\x02/ConsistencyCheck/Progress");
 
 // Request latency measurement key
 const KeyRef latencyBandConfigKey = LiteralStringRef("\xff\x02/latencyBandConfig");
@@ -475,6 +475,23 @@ public:
 		return true;
 	}
 
+	// Returns once a task has been added to the bucket, as signalled by the task count key changing.
+	// Used to wake idle dispatchers without repeatedly probing the task keyspace.
+	ACTOR static Future<Void> watchTaskAdded(Database cx, Reference<TaskBucket> taskBucket) {
+		state Reference<ReadYourWritesTransaction> tr(new ReadYourWritesTransaction(cx));
+		loop {
+			try {
+				taskBucket->setOptions(tr);
+				state Future<Void> watchFuture = taskBucket->watchTaskCount(tr);
+				wait(tr->commit());
+				wait(watchFuture);
+				return Void();
+			} catch (Error& e) {
+				wait(tr->onError(e));
+			}
+		}
+	}
+
 	ACTOR static Future<Void> dispatch(Database cx,
 	                                   Reference<TaskBucket> taskBucket,
 	                                   Reference<FutureBucket> futureBucket,
@@ -532,7 +549,7 @@ public:
 			++taskBucket->dispatchSlotChecksComplete;
 
 			// Wait for a task to be done.  Also, if we have any slots available then stop waiting after pollDelay at
-			// the latest.
+			// the latest, or as soon as a task is added if watching is enabled.
 			Future<Void> w = ready(waitForAny(tasks));
 			if (!availableSlots.empty()) {
 				if (*pollDelay > 600) {
@@ -540,6 +557,11 @@ public:
 				}
 				w = w ||
 				    delay(*pollDelay * (0.9 + deterministicRandom()->random01() / 5)); // Jittered by 20 %, so +/- 10%
+				if (CLIENT_KNOBS->TASKBUCKET_WATCH_TASK_COUNT) {
+					// The poll delay remains as a backstop, since requeued timed out tasks do not
+					// change the task count.
+					w = w || watchTaskAdded(cx, taskBucket);
+				}
 			}
 			wait(w);
 
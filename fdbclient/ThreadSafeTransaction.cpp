@@ -321,6 +321,64 @@ ThreadFuture<RangeResult> ThreadSafeTransaction::getRange(const KeySelectorRef&
 	});
 }
 
+Reference<ITransactionRangeStream> ThreadSafeTransaction::getRangeStream(const KeySelectorRef& begin,
+                                                                         const KeySelectorRef& end,
+                                                                         bool snapshot) {
+	return makeReference<ThreadSafeTransactionRangeStream>(
+	    Reference<ThreadSafeTransaction>::addRef(this), tr, begin, end, snapshot);
+}
+
+ThreadSafeTransactionRangeStream::ThreadSafeTransactionRangeStream(Reference<ThreadSafeTransaction> owner,
+                                                                   ISingleThreadTransaction* tr,
+                                                                   const KeySelectorRef& begin,
+                                                                   const KeySelectorRef& end,
+                                                                   bool snapshot)
+  : owner(owner), state(new StreamState()) {
+	KeySelector b = begin;
+	KeySelector e = end;
+
+	StreamState* ss = state;
+	onMainThreadVoid([tr, ss, b, e, snapshot]() {
+		// Guard failures and transaction errors are reported through ss->results, so the reader
+		// future's own error (if any) is intentionally ignored
+		ss->reader = tr->getRangeStream(ss->results, b, e, Snapshot{ snapshot });
+	});
+}
+
+ThreadSafeTransactionRangeStream::~ThreadSafeTransactionRangeStream() {
+	StreamState* ss = state;
+	onMainThreadVoid([ss]() {
+		ss->reader.cancel();
+		delete ss;
+	});
+}
+
+ThreadFuture<RangeResult> ThreadSafeTransactionRangeStream::nextFragment() {
+	StreamState* ss = state;
+	return onMainThread([ss]() -> Future<RangeResult> {
+		return map(errorOr(waitAndForward(ss->results.getFuture())),
+		           [](ErrorOr<Standalone<RangeResultRef>> f) -> RangeResult {
+			           if (f.isError()) {
+				           if (f.getError().code() != error_code_end_of_stream) {
+					           throw f.getError();
+				           }
+				           // The stream is exhausted; report it with an empty terminating fragment
+				           return RangeResult();
+			           }
+			           RangeResult fragment = f.get();
+			           // Fragment boundaries are an implementation detail of the shard layout;
+			           // 'more' on this interface means only that more fragments follow
+			           fragment.more = true;
+			           return fragment;
+		           });
+	});
+}
+
+void ThreadSafeTransactionRangeStream::cancel() {
+	StreamState* ss = state;
+	onMainThreadVoid([ss]() { ss->reader.cancel(); });
+}
+
 ThreadFuture<MappedRangeResult> ThreadSafeTransaction::getMappedRange(const KeySelectorRef& begin,
                                                                       const KeySelectorRef& end,
                                                                       const StringRef& mapper,
@@ -375,6 +375,44 @@ TEST_CASE("/fdbclient/VersionVector/testI") {
 	return Void();
 }
 
+TEST_CASE("/fdbclient/VersionVector/compact") {
+	Arena arena;
+	TestContextArena context{ arena };
+
+	VersionVector serializedVV;
+	serializedVV.setVersion(Tag(0, 1), 1000);
+	serializedVV.setVersion(Tag(0, 2), 2000);
+	serializedVV.setVersion(Tag(1, 3), 3000);
+	serializedVV.setVersion(Tag(1, 4), 4000);
+
+	// Entries at or below the compaction version are dropped; the rest (and maxVersion) survive.
+	serializedVV.compact(2000);
+	ASSERT(serializedVV.size() == 2);
+	ASSERT(!serializedVV.hasVersion(Tag(0, 1)));
+	ASSERT(!serializedVV.hasVersion(Tag(0, 2)));
+	ASSERT(serializedVV.getVersion(Tag(1, 3)) == 3000);
+	ASSERT(serializedVV.getVersion(Tag(1, 4)) == 4000);
+	ASSERT(serializedVV.getMaxVersion() == 4000);
+
+	// Serialization must be consistent after compaction (the cached encoded size is invalidated).
+	size_t size = dynamic_size_traits<VersionVector>::size(serializedVV, context);
+
+	uint8_t* buf = context.allocate(size);
+	dynamic_size_traits<VersionVector>::save(buf, serializedVV, context);
+
+	VersionVector deserializedVV;
+	dynamic_size_traits<VersionVector>::load(buf, size, deserializedVV, context);
+
+	ASSERT(serializedVV.compare(deserializedVV));
+
+	// Compacting everything leaves an empty vector that still carries maxVersion.
+	serializedVV.compact(4000);
+	ASSERT(serializedVV.empty());
+	ASSERT(serializedVV.getMaxVersion() == 4000);
+
+	return Void();
+}
+
 } // namespace unit_tests
 
 void forceLinkVersionVectorTests() {}
@@ -0,0 +1,192 @@
+/*
+ * VersionstampedQueue.actor.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include "fdbclient/VersionstampedQueue.h"
+#include "flow/UnitTest.h"
+#include "flow/actorcompiler.h" // This must be the last #include.
+
+VersionstampedQueue::VersionstampedQueue(Subspace subspace, int shards) : subspace(subspace), shards(shards) {
+	ASSERT(shards > 0 && shards <= 256);
+}
+
+Key VersionstampedQueue::encodeKey(int shard, uint16_t index) const {
+	ASSERT(shard >= 0 && shard < shards);
+	BinaryWriter wr(Unversioned());
+	wr.serializeBytes(subspace.key());
+	wr << uint8_t(shard);
+	int32_t offset = wr.getLength();
+	uint8_t stamp[VERSIONSTAMP_TUPLE_SIZE] = {}; // first 10 bytes are filled in by the resolver
+	stamp[10] = uint8_t(index >> 8);
+	stamp[11] = uint8_t(index & 0xff);
+	wr.serializeBytes(stamp, VERSIONSTAMP_TUPLE_SIZE);
+	wr << offset; // trailing little-endian position of the versionstamp, consumed by the atomic op
+	return wr.toValue();
+}
+
+Versionstamp VersionstampedQueue::decodeKey(KeyRef key) const {
+	ASSERT(key.size() >= VERSIONSTAMP_TUPLE_SIZE);
+	return Versionstamp(key.substr(key.size() - VERSIONSTAMP_TUPLE_SIZE));
+}
+
+KeyRange VersionstampedQueue::shardRange(int shard) const {
+	BinaryWriter wr(Unversioned());
+	wr.serializeBytes(subspace.key());
+	wr << uint8_t(shard);
+	Key begin = wr.toValue();
+	return prefixRange(begin);
+}
+
+void VersionstampedQueue::enqueue(Reference<ReadYourWritesTransaction> tr, ValueRef value, uint16_t index) {
+	int shard = deterministicRandom()->randomInt(0, shards);
+	tr->atomicOp(encodeKey(shard, index), value, MutationRef::SetVersionstampedKey);
+}
+
+void VersionstampedQueue::enqueueBatch(Reference<ReadYourWritesTransaction> tr,
+                                       VectorRef<ValueRef> values,
+                                       uint16_t firstIndex) {
+	// One shard per batch keeps the batch contiguous; the versionstamp already makes it unique
+	int shard = deterministicRandom()->randomInt(0, shards);
+	for (int i = 0; i < values.size(); ++i) {
+		tr->atomicOp(encodeKey(shard, firstIndex + i), values[i], MutationRef::SetVersionstampedKey);
+	}
+}
+
+namespace {
+
+// Merges per-shard reads, each already sorted by key and therefore by (versionstamp, index), into
+// global commit order
+std::vector<VersionstampedQueue::Entry> mergeShards(VersionstampedQueue* self,
+                                                    std::vector<RangeResult> const& shardResults,
+                                                    int limit) {
+	std::vector<VersionstampedQueue::Entry> entries;
+	for (const auto& result : shardResults) {
+		for (const auto& kv : result) {
+			entries.emplace_back(self->decodeKey(kv.key), Value(kv.value));
+		}
+	}
+	std::sort(entries.begin(), entries.end(), [](auto const& a, auto const& b) {
+		return memcmp(a.version.begin(), b.version.begin(), VERSIONSTAMP_TUPLE_SIZE) < 0;
+	});
+	if ((int)entries.size() > limit) {
+		entries.resize(limit);
+	}
+	return entries;
+}
+
+ACTOR Future<std::vector<VersionstampedQueue::Entry>> peekActor(VersionstampedQueue* self,
+                                                                Reference<ReadYourWritesTransaction> tr,
+                                                                int firstShard,
+                                                                int lastShard,
+                                                                int limit,
+                                                                bool remove) {
+	// Read all shards in parallel. Each read's conflict range only covers the scanned prefix of its
+	// shard; concurrently committed entries get larger versionstamps and land beyond it, so producers
+	// never abort this transaction.
+	state std::vector<Future<RangeResult>> reads;
+	state int shard;
+	for (shard = firstShard; shard <= lastShard; ++shard) {
+		reads.push_back(tr->getRange(self->shardRange(shard), limit));
+	}
+	wait(waitForAll(reads));
+
+	state std::vector<RangeResult> shardResults;
+	for (auto& f : reads) {
+		shardResults.push_back(f.get());
+	}
+	std::vector<VersionstampedQueue::Entry> entries = mergeShards(self, shardResults, limit);
+
+	if (remove && !entries.empty()) {
+		// Clear exactly the keys handed back; anything past the returned prefix stays queued
+		for (const auto& result : shardResults) {
+			for (const auto& kv : result) {
+				if (memcmp(self->decodeKey(kv.key).begin(), entries.back().version.begin(), VERSIONSTAMP_TUPLE_SIZE) <=
+				    0) {
+					tr->clear(singleKeyRange(kv.key));
+				}
+			}
+		}
+	}
+	return entries;
+}
+
+} // namespace
+
+Future<std::vector<VersionstampedQueue::Entry>> VersionstampedQueue::peek(Reference<ReadYourWritesTransaction> tr,
+                                                                          int limit) {
+	return peekActor(this, tr, 0, shards - 1, limit, false);
+}
+
+Future<std::vector<VersionstampedQueue::Entry>> VersionstampedQueue::pop(Reference<ReadYourWritesTransaction> tr,
+                                                                         int limit) {
+	return peekActor(this, tr, 0, shards - 1, limit, true);
+}
+
+Future<std::vector<VersionstampedQueue::Entry>> VersionstampedQueue::peekShard(Reference<ReadYourWritesTransaction> tr,
+                                                                               int shard,
+                                                                               int limit) {
+	ASSERT(shard >= 0 && shard < shards);
+	return peekActor(this, tr, shard, shard, limit, false);
+}
+
+Future<std::vector<VersionstampedQueue::Entry>> VersionstampedQueue::popShard(Reference<ReadYourWritesTransaction> tr,
+                                                                              int shard,
+                                                                              int limit) {
+	ASSERT(shard >= 0 && shard < shards);
+	return peekActor(this, tr, shard, shard, limit, true);
+}
+
+ACTOR static Future<bool> isEmptyActor(VersionstampedQueue* self, Reference<ReadYourWritesTransaction> tr) {
+	std::vector<VersionstampedQueue::Entry> entries = wait(peekActor(self, tr, 0, self->getShards() - 1, 1, false));
+	return entries.empty();
+}
+
+Future<bool> VersionstampedQueue::isEmpty(Reference<ReadYourWritesTransaction> tr) {
+	return isEmptyActor(this, tr);
+}
+
+TEST_CASE("/fdbclient/VersionstampedQueue/keyLayout") {
+	VersionstampedQueue queue(Subspace("queue"_sr), 4);
+
+	Key k = queue.encodeKey(2, 0x0102);
+	// prefix + shard + 12-byte versionstamp tuple + 4-byte offset
+	ASSERT(k.size() == 5 + 1 + VERSIONSTAMP_TUPLE_SIZE + 4);
+	ASSERT(k.startsWith("queue\x02"_sr));
+	int32_t offset = *(const int32_t*)(k.end() - 4);
+	ASSERT(offset == 6);
+
+	// Simulate the resolver stamping the key, then decode
+	Key committed = k.substr(0, k.size() - 4);
+	uint8_t* bytes = mutateString(committed);
+	for (int i = 0; i < 10; ++i) {
+		bytes[offset + i] = uint8_t(i + 1);
+	}
+	Versionstamp v = queue.decodeKey(committed);
+	ASSERT(v.getUserVersion() == 0x0102);
+	ASSERT(v.getVersion() == 0x0102030405060708ll);
+
+	// Within one transaction, higher indices must sort later
+	Key k2 = queue.encodeKey(2, 0x0103);
+	ASSERT(k.substr(0, k.size() - 4) < k2.substr(0, k2.size() - 4));
+	return Void();
+}
+
+void forceLinkVersionstampedQueueTests() {}
@@ -334,12 +334,15 @@ WriteMap::iterator& WriteMap::iterator::operator--() {
 
 void WriteMap::iterator::skip(
     KeyRef key) { // Changes *this to the segment containing key (so that beginKey()<=key && key < endKey())
-	finger.clear();
-
-	if (key == allKeys.end)
+	if (key == allKeys.end) {
+		finger.clear();
 		PTreeImpl::last(tree, at, finger);
-	else
-		PTreeImpl::upper_bound(tree, at, key, finger);
+	} else {
+		// The finger left behind by a previous skip() or ++ is reused as a search hint, so the
+		// repeated nearby skips issued while merging a read against a large write set avoid
+		// descending from the root each time.
+		PTreeImpl::upper_bound_hint(tree, at, key, finger);
+	}
 	endLen = finger.size();
 	beginLen = PTreeImpl::halfPrevious(at, finger);
 
@@ -142,17 +142,36 @@ class SampleCollection_t {
 	SampleCollector _collector;
 	mutable std::mutex mutex;
 	std::atomic<double> windowSize = 0.0;
-	std::deque<std::shared_ptr<Sample>> data;
+	std::atomic<unsigned> samplingFrequency = 0;
+	// Preallocated ring holding windowSize seconds of samples at the configured sampling frequency, so
+	// steady-state collection never allocates or frees ring slots on the sampling path
+	std::vector<std::shared_ptr<Sample>> data;
+	size_t ringBegin = 0; // index of the oldest sample
+	size_t ringSize = 0;
 	ProfilerConfig config;
 	Reference<ActorLineage> _currentLineage;
 
+	void resizeRing();
+
 public:
 	/**
 	 * Define how many samples the collection shoul keep. The window size is defined by time dimension.
 	 *
 	 * \param duration How long a sample should be kept in the collection.
 	 */
-	void setWindowSize(double duration) { windowSize.store(duration); }
+	void setWindowSize(double duration) {
+		windowSize.store(duration);
+		resizeRing();
+	}
+	/**
+	 * Tell the collection how often samples are taken, so the ring can be sized to hold one window's worth.
+	 *
+	 * \param frequency The sampling frequency in Hz.
+	 */
+	void setSamplingFrequency(unsigned frequency) {
+		samplingFrequency.store(frequency);
+		resizeRing();
+	}
 	/**
 	 * By default returns reference counted pointers of all samples. A window can be defined in terms of absolute time.
 	 *
@@ -26,6 +26,7 @@
 #define FDBCLIENT_BACKUP_AGENT_ACTOR_H
 
 #include "flow/flow.h"
+#include "flow/CompressedInt.h"
 #include "fdbclient/NativeAPI.actor.h"
 #include "fdbclient/TaskBucket.h"
 #include "fdbclient/Notified.h"
@@ -992,6 +993,19 @@ struct StringRefReader {
 	int32_t consumeNetworkInt32() { return (int32_t)bigEndian32((uint32_t)consume<int32_t>()); }
 	uint32_t consumeNetworkUInt32() { return bigEndian32(consume<uint32_t>()); }
 
+	// Consumes a CompressedInt encoded unsigned integer and returns it.
+	uint32_t consumeCompressedUInt() {
+		BinaryReader r(rptr, end - rptr, Unversioned());
+		CompressedInt<uint32_t> len;
+		try {
+			r >> len;
+		} catch (Error&) {
+			throw failure_error;
+		}
+		rptr = end - r.remainingBytes();
+		return len.value;
+	}
+
 	// Convert big Endian value (e.g., encoded in log file) into a littleEndian uint64_t value.
 	int64_t consumeNetworkInt64() { return (int64_t)bigEndian64((uint32_t)consume<int64_t>()); }
 	uint64_t consumeNetworkUInt64() { return bigEndian64(consume<uint64_t>()); }
@@ -61,12 +61,22 @@ protected:
 // Mutation log version written by old FileBackupAgent
 static const uint32_t BACKUP_AGENT_MLOG_VERSION = 2001;
 
+// Same record layout as BACKUP_AGENT_MLOG_VERSION except key and value lengths are
+// CompressedInt encoded instead of fixed-width big endian, written when
+// CLIENT_KNOBS->BACKUP_COMPRESSED_LOG_LENGTHS is set
+static const uint32_t BACKUP_AGENT_MLOG_VERSION_VARINT = 2002;
+
 // Mutation log version written by BackupWorker
 static const uint32_t PARTITIONED_MLOG_VERSION = 4110;
 
 // Snapshot file version written by FileBackupAgent
 static const uint32_t BACKUP_AGENT_SNAPSHOT_FILE_VERSION = 1001;
 
+// Same block layout as BACKUP_AGENT_SNAPSHOT_FILE_VERSION except each key is stored as the length
+// of the prefix it shares with the previous key in the block followed by the length delimited
+// suffix, written when CLIENT_KNOBS->BACKUP_PREFIX_COMPRESSED_SNAPSHOTS is set
+static const uint32_t BACKUP_AGENT_SNAPSHOT_FILE_VERSION_V2 = 1002;
+
 struct LogFile {
 	Version beginVersion;
 	Version endVersion;
@@ -92,8 +92,16 @@ public:
 	int LOCATION_CACHE_EVICTION_SIZE_SIM;
 	double LOCATION_CACHE_ENDPOINT_FAILURE_GRACE_PERIOD;
 	double LOCATION_CACHE_FAILED_ENDPOINT_RETRY_INTERVAL;
+	std::string LOCATION_CACHE_PERSIST_FILE; // if non-empty, snapshot the location cache to this file and reload
+	                                         // it at startup (validated by cluster key and snapshot age)
+	double LOCATION_CACHE_PERSIST_INTERVAL; // seconds between location cache snapshots
+	double LOCATION_CACHE_PERSIST_MAX_AGE; // snapshots older than this are discarded at load
 	int TENANT_CACHE_EVICTION_SIZE;
 	int TENANT_CACHE_EVICTION_SIZE_SIM;
+	bool ENABLE_CLIENT_READ_CACHE; // opt-in read-through cache for point reads; cached values may be
+	                               // stale by up to READ_CACHE_VERSION_VALIDITY versions
+	int READ_CACHE_MAX_ENTRIES;
+	int64_t READ_CACHE_VERSION_VALIDITY; // how many versions past its read version a cached value is served
 
 	int GET_RANGE_SHARD_LIMIT;
 	int WARM_RANGE_SHARD_LIMIT;
@@ -101,12 +109,15 @@ public:
 	int SHARD_COUNT_LIMIT;
 	double STORAGE_METRICS_UNFAIR_SPLIT_LIMIT;
 	double STORAGE_METRICS_TOO_MANY_SHARDS_DELAY;
+	double SPECIAL_KEY_METRICS_CACHE_TTL; // how long \xff\xff/metrics reads are served from the retained cache
 	double AGGREGATE_HEALTH_METRICS_MAX_STALENESS;
 	double DETAILED_HEALTH_METRICS_MAX_STALENESS;
 	double MID_SHARD_SIZE_MAX_STALENESS;
 	bool TAG_ENCODE_KEY_SERVERS;
 	int64_t RANGESTREAM_FRAGMENT_SIZE;
 	int RANGESTREAM_BUFFERED_FRAGMENTS_LIMIT;
+	bool ENABLE_RANGE_PREFETCH; // speculatively request the next batch of a sequential getRange scan
+	bool ENABLE_ATOMIC_OP_COALESCING; // fold commutative atomic ops on the same key together before commit
 	bool QUARANTINE_TSS_ON_MISMATCH;
 	double CHANGE_FEED_EMPTY_BATCH_TIME;
 	bool SHARD_ENCODE_LOCATION_METADATA;
@@ -122,6 +133,9 @@ public:
 	double NO_RECENT_UPDATES_DURATION;
 	double FAST_WATCH_TIMEOUT;
 	double WATCH_TIMEOUT;
+	bool ENABLE_WATCH_MULTIPLEXING; // register watches that share a shard through one streaming storage request
+	double WATCH_MUX_BATCH_DELAY; // how long a cohort of watches accumulates before being dispatched as one request
+	int WATCH_MUX_MAX_WATCHES; // maximum number of watches carried by one multiplexed request
 
 	double IS_ACCEPTABLE_DELAY;
 
@@ -147,6 +161,7 @@ public:
 	int TASKBUCKET_CHECK_ACTIVE_AMOUNT;
 	int TASKBUCKET_TIMEOUT_VERSIONS;
 	int TASKBUCKET_MAX_TASK_KEYS;
+	bool TASKBUCKET_WATCH_TASK_COUNT; // wake idle dispatchers with a watch on the task count instead of waiting out the poll delay
 
 	// Backup
 	int BACKUP_LOCAL_FILE_WRITE_BLOCK;
@@ -182,6 +197,8 @@ public:
 	int SIM_BACKUP_TASKS_PER_AGENT;
 	int BACKUP_RANGEFILE_BLOCK_SIZE;
 	int BACKUP_LOGFILE_BLOCK_SIZE;
+	bool BACKUP_COMPRESSED_LOG_LENGTHS; // Write mutation log record lengths as CompressedInt instead of fixed width
+	bool BACKUP_PREFIX_COMPRESSED_SNAPSHOTS; // Write range file blocks with prefix compressed keys (v2 snapshot format)
 	int BACKUP_DISPATCH_ADDTASK_SIZE;
 	int RESTORE_DISPATCH_ADDTASK_SIZE;
 	int RESTORE_DISPATCH_BATCH_SIZE;
@@ -191,6 +208,7 @@ public:
 	int APPLY_BLOCK_SIZE;
 	double APPLY_MAX_DECAY_RATE;
 	double APPLY_MAX_INCREASE_FACTOR;
+	int APPLY_PARALLEL_RANGES; // how many version-block ranges decode concurrently while applying mutation logs
 	double BACKUP_ERROR_DELAY;
 	double BACKUP_STATUS_DELAY;
 	double BACKUP_STATUS_JITTER;
@@ -219,12 +237,14 @@ public:
 	double CSI_SAMPLING_PROBABILITY;
 	int64_t CSI_SIZE_LIMIT;
 	double CSI_STATUS_DELAY;
+	int TRANSACTION_PROFILE_RING_SIZE; // sampled transaction profiles kept in memory for \xff\xff/transaction_profile/
 
 	bool HTTP_REQUEST_AWS_V4_HEADER; // setting this knob to true will enable AWS V4 style header.
 	std::string BLOBSTORE_ENCRYPTION_TYPE;
 	int BLOBSTORE_CONNECT_TRIES;
 	int BLOBSTORE_CONNECT_TIMEOUT;
 	int BLOBSTORE_MAX_CONNECTION_LIFE;
+	int BLOBSTORE_MAX_CONNECTION_POOL_SIZE;
 	int BLOBSTORE_REQUEST_TRIES;
 	int BLOBSTORE_REQUEST_TIMEOUT_MIN;
 	int BLOBSTORE_REQUESTS_PER_SECOND;
@@ -247,6 +267,7 @@ public:
 
 	int CONSISTENCY_CHECK_RATE_LIMIT_MAX;
 	int CONSISTENCY_CHECK_ONE_ROUND_TARGET_COMPLETION_TIME;
+	int CONSISTENCY_CHECK_SHARD_SAMPLE_FACTOR;
 
 	// fdbcli
 	int CLI_CONNECT_PARALLELISM;
@@ -273,6 +294,8 @@ public:
 	// multi-version client control
 	int MVC_CLIENTLIB_CHUNK_SIZE;
 	int MVC_CLIENTLIB_CHUNKS_PER_TRANSACTION;
+	bool MVC_LOCAL_TRANSACTION_FASTPATH; // hand out local client transactions directly when no external clients
+	                                     // are loaded, skipping the per-operation multi-version wrapper
 
 	// Blob Granules
 	int BG_MAX_GRANULE_PARALLELISM;
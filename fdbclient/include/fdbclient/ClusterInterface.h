@@ -24,6 +24,7 @@
 
 #include "fdbclient/FDBTypes.h"
 #include "fdbrpc/FailureMonitor.h"
+#include "fdbclient/DatabaseConfiguration.h"
 #include "fdbclient/Status.h"
 #include "fdbclient/CommitProxyInterface.h"
 #include "fdbclient/ClientWorkerInterface.h"
@@ -40,6 +41,7 @@ struct ClusterInterface {
 	RequestStream<struct MoveShardRequest> moveShard;
 	RequestStream<struct RepairSystemDataRequest> repairSystemData;
 	RequestStream<struct SplitShardRequest> splitShard;
+	RequestStream<struct RecruitmentDryRunRequest> recruitmentDryRun;
 
 	bool operator==(ClusterInterface const& r) const { return id() == r.id(); }
 	bool operator!=(ClusterInterface const& r) const { return id() != r.id(); }
@@ -51,7 +53,7 @@ struct ClusterInterface {
 		       databaseStatus.getFuture().isReady() || ping.getFuture().isReady() ||
 		       getClientWorkers.getFuture().isReady() || forceRecovery.getFuture().isReady() ||
 		       moveShard.getFuture().isReady() || repairSystemData.getFuture().isReady() ||
-		       splitShard.getFuture().isReady();
+		       splitShard.getFuture().isReady() || recruitmentDryRun.getFuture().isReady();
 	}
 
 	void initEndpoints() {
@@ -64,6 +66,7 @@ struct ClusterInterface {
 		moveShard.getEndpoint(TaskPriority::ClusterController);
 		repairSystemData.getEndpoint(TaskPriority::ClusterController);
 		splitShard.getEndpoint(TaskPriority::ClusterController);
+		recruitmentDryRun.getEndpoint(TaskPriority::ClusterController);
 	}
 
 	template <class Ar>
@@ -77,7 +80,8 @@ struct ClusterInterface {
 		           forceRecovery,
 		           moveShard,
 		           repairSystemData,
-		           splitShard);
+		           splitShard,
+		           recruitmentDryRun);
 	}
 };
 
@@ -323,4 +327,42 @@ struct SplitShardRequest {
 		serializer(ar, shard, num, reply);
 	}
 };
+
+// The role placement a recruitment would produce, by worker address. If recruitment would fail (e.g. with
+// no_more_servers), errorMsg holds the error name and the role lists are empty.
+struct RecruitmentDryRunReply {
+	constexpr static FileIdentifier file_identifier = 6907477;
+	Optional<Key> dcId; // the datacenter the layout was planned for
+	std::vector<NetworkAddress> tLogs;
+	std::vector<NetworkAddress> satelliteTLogs;
+	std::vector<NetworkAddress> commitProxies;
+	std::vector<NetworkAddress> grvProxies;
+	std::vector<NetworkAddress> resolvers;
+	std::vector<NetworkAddress> backupWorkers;
+	std::string errorMsg;
+
+	RecruitmentDryRunReply() {}
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, dcId, tLogs, satelliteTLogs, commitProxies, grvProxies, resolvers, backupWorkers, errorMsg);
+	}
+};
+
+// Asks the cluster controller to plan a recruitment for the given configuration (or the cluster's current
+// configuration if none is given) against the currently registered workers, without recruiting anything.
+// Used to validate topology and configuration changes before they are applied.
+struct RecruitmentDryRunRequest {
+	constexpr static FileIdentifier file_identifier = 6907478;
+	Optional<DatabaseConfiguration> configuration;
+	ReplyPromise<RecruitmentDryRunReply> reply;
+
+	RecruitmentDryRunRequest() {}
+	explicit RecruitmentDryRunRequest(DatabaseConfiguration const& configuration) : configuration(configuration) {}
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, configuration, reply);
+	}
+};
 #endif
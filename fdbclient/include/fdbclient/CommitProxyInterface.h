@@ -59,6 +59,7 @@ struct CommitProxyInterface {
 	RequestStream<struct ProxySnapRequest> proxySnapReq;
 	RequestStream<struct ExclusionSafetyCheckRequest> exclusionSafetyCheckReq;
 	RequestStream<struct GetDDMetricsRequest> getDDMetrics;
+	RequestStream<struct GetShardCountsRequest> getShardCounts;
 
 	UID id() const { return commit.getEndpoint().token; }
 	std::string toString() const { return id().shortString(); }
@@ -85,6 +86,7 @@ struct CommitProxyInterface {
 			exclusionSafetyCheckReq =
 			    RequestStream<struct ExclusionSafetyCheckRequest>(commit.getEndpoint().getAdjustedEndpoint(8));
 			getDDMetrics = RequestStream<struct GetDDMetricsRequest>(commit.getEndpoint().getAdjustedEndpoint(9));
+			getShardCounts = RequestStream<struct GetShardCountsRequest>(commit.getEndpoint().getAdjustedEndpoint(10));
 		}
 	}
 
@@ -101,6 +103,7 @@ struct CommitProxyInterface {
 		streams.push_back(proxySnapReq.getReceiver());
 		streams.push_back(exclusionSafetyCheckReq.getReceiver());
 		streams.push_back(getDDMetrics.getReceiver());
+		streams.push_back(getShardCounts.getReceiver());
 		FlowTransport::transport().addEndpoints(streams);
 	}
 };
@@ -499,6 +502,47 @@ struct GetDDMetricsReply {
 	}
 };
 
+// One aggregated shard-count row, e.g. "server/<uid>" or "team/<uid>,<uid>,<uid>", computed on a commit
+// proxy from its authoritative key-to-server map. Fleet tooling reads these instead of pulling every row
+// of \xff/keyServers to the client.
+struct ShardCountEntry {
+	constexpr static FileIdentifier file_identifier = 9921342;
+	Key name;
+	int64_t shards = 0;
+
+	ShardCountEntry() {}
+	ShardCountEntry(Key const& name, int64_t shards) : name(name), shards(shards) {}
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, name, shards);
+	}
+};
+
+struct GetShardCountsReply {
+	constexpr static FileIdentifier file_identifier = 7732548;
+	std::vector<ShardCountEntry> counts; // sorted by name
+
+	GetShardCountsReply() {}
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, counts);
+	}
+};
+
+struct GetShardCountsRequest {
+	constexpr static FileIdentifier file_identifier = 11432156;
+	ReplyPromise<struct GetShardCountsReply> reply;
+
+	GetShardCountsRequest() {}
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, reply);
+	}
+};
+
 struct GetDDMetricsRequest {
 	constexpr static FileIdentifier file_identifier = 14536812;
 	KeyRange keys;
@@ -81,12 +81,15 @@ struct ConfigTransactionGetGenerationRequest {
 struct ConfigTransactionGetReply {
 	static constexpr FileIdentifier file_identifier = 2034110;
 	Optional<KnobValue> value;
+	// Values for ConfigTransactionGetRequest::additionalKeys, in the same order. A node that does
+	// not understand batched gets leaves this empty; clients must fall back to per-key reads.
+	std::vector<Optional<KnobValue>> additionalValues;
 	ConfigTransactionGetReply() = default;
 	explicit ConfigTransactionGetReply(Optional<KnobValue> const& value) : value(value) {}
 
 	template <class Ar>
 	void serialize(Ar& ar) {
-		serializer(ar, value);
+		serializer(ar, value, additionalValues);
 	}
 };
 
@@ -94,6 +97,9 @@ struct ConfigTransactionGetRequest {
 	static constexpr FileIdentifier file_identifier = 923040;
 	ConfigGeneration generation;
 	ConfigKey key;
+	// Extra keys to read at the same generation, so a multi-knob read is a single round trip.
+	// Appended to the message (rather than replacing "key") to stay wire-compatible.
+	std::vector<ConfigKey> additionalKeys;
 	ReplyPromise<ConfigTransactionGetReply> reply;
 
 	ConfigTransactionGetRequest() = default;
@@ -102,7 +108,7 @@ struct ConfigTransactionGetRequest {
 
 	template <class Ar>
 	void serialize(Ar& ar) {
-		serializer(ar, generation, key, reply);
+		serializer(ar, generation, key, reply, additionalKeys);
 	}
 };
 
@@ -26,6 +26,7 @@
 #include "fdbclient/GlobalConfig.actor.h"
 #include "fdbclient/StorageServerInterface.h"
 #include "flow/genericactors.actor.h"
+#include <deque>
 #include <vector>
 #include <unordered_map>
 #pragma once
@@ -156,6 +157,17 @@ public:
 	  : watchFuture(watchPromise.getFuture()), parameters(parameters) {}
 };
 
+// A batch of watches from this client that target the same (tenant, shard) and are multiplexed
+// onto a single streaming storage request. A cohort accumulates for
+// CLIENT_KNOBS->WATCH_MUX_BATCH_DELAY after its first watch arrives and is then dispatched as one
+// WatchValuesRequest; the dispatcher demultiplexes per-entry notifications into `fired`.
+struct WatchMuxCohort : public ReferenceCounted<WatchMuxCohort> {
+	std::vector<Reference<const WatchParameters>> params;
+	std::vector<Version> versions;
+	std::vector<Promise<Version>> fired;
+	Future<Void> dispatcher;
+};
+
 struct MutationAndVersionStream {
 	Standalone<MutationsAndVersionRef> next;
 	PromiseStream<Standalone<MutationsAndVersionRef>> results;
@@ -309,6 +321,7 @@ public:
 	                                                          Optional<int> const& minSplitBytes = {});
 
 	Future<Standalone<VectorRef<ReadHotRangeWithMetrics>>> getReadHotRanges(KeyRange const& keys);
+	Future<Standalone<VectorRef<HotKeyWithMetrics>>> getHotKeys(KeyRange const& keys);
 
 	// Returns the protocol version reported by the coordinator this client is connected to
 	// If an expected version is given, the future won't return until the protocol version is different than expected
@@ -352,6 +365,12 @@ public:
 	// switchConnectionRecord guarantees that any read with a version from the old cluster will not be attempted on the
 	// new cluster.
 	Future<Void> switchConnectionRecord(Reference<IClusterConnectionRecord> standby);
+
+	// Begin (or replace) background monitoring of the standby cluster's leader and proxies, so that
+	// a later switchConnectionRecord to the same connection string starts from warm proxy state
+	// instead of waiting for coordinator resolution. Passing a null reference stops prewarming.
+	void prewarmConnection(Reference<IClusterConnectionRecord> standby);
+
 	Future<Void> connectionFileChanged();
 	IsSwitchable switchable{ false };
 
@@ -451,6 +470,21 @@ public:
 	};
 	ClientStatusUpdater clientStatusUpdater;
 
+	// Ring of recently flushed sampled transaction profiles, readable through
+	// \xff\xff/transaction_profile/. Each entry holds the serialized FdbClientLogEvents chunk of one
+	// sampled transaction, keyed by a monotonically increasing sequence number. Bounded by
+	// CLIENT_KNOBS->TRANSACTION_PROFILE_RING_SIZE; entries are only produced for transactions that
+	// the existing client sampling (client_txn_sample_rate) selected, so the steady-state cost is
+	// one buffer copy per sampled transaction.
+	struct TransactionProfileEntry {
+		uint64_t seq;
+		std::string identifier;
+		Standalone<StringRef> chunk;
+	};
+	std::deque<TransactionProfileEntry> transactionProfileRing;
+	uint64_t transactionProfileSeq = 0;
+	void recordTransactionProfile(const std::string& identifier, StringRef chunk);
+
 	// Cache of location information
 	int locationCacheSize;
 	int tenantCacheSize;
@@ -458,6 +492,21 @@ public:
 	std::unordered_map<Endpoint, EndpointFailureInfo> failedEndpointsOnHealthyServersInfo;
 	std::unordered_map<TenantName, TenantMapEntry> tenantCache;
 
+	// Opt-in read-through cache for point reads (ENABLE_CLIENT_READ_CACHE), keyed by the resolved
+	// (tenant-prefixed) key. An entry is served to readers whose read version is at or above the
+	// version the value was read at, but no more than READ_CACHE_VERSION_VALIDITY versions past it.
+	// Entries are dropped on shard movement (invalidateCache) and for keys mutated by this client's
+	// own commits; reads served from the cache may be stale by up to the validity window.
+	struct ReadCacheEntry {
+		Optional<Value> value;
+		Version version = invalidVersion;
+	};
+	std::map<Key, ReadCacheEntry, std::less<>> readCache;
+	Optional<Optional<Value>> readCacheLookup(const KeyRef& resolvedKey, Version readVersion);
+	void readCacheUpdate(const KeyRef& resolvedKey, const Optional<Value>& value, Version readVersion);
+	void readCacheInvalidate(const KeyRef& resolvedKey);
+	void readCacheInvalidate(const KeyRangeRef& resolvedKeys);
+
 	std::map<UID, StorageServerInfo*> server_interf;
 	std::map<UID, BlobWorkerInterface> blobWorker_interf; // blob workers don't change endpoints for the same ID
 
@@ -497,9 +546,12 @@ public:
 	Counter transactionLogicalReads;
 	Counter transactionPhysicalReads;
 	Counter transactionPhysicalReadsCompleted;
+	Counter transactionReadCacheHits;
+	Counter transactionReadCacheMisses;
 	Counter transactionGetKeyRequests;
 	Counter transactionGetValueRequests;
 	Counter transactionGetRangeRequests;
+	Counter transactionGetRangePrefetches;
 	Counter transactionGetMappedRangeRequests;
 	Counter transactionGetRangeStreamRequests;
 	Counter transactionWatchRequests;
@@ -512,6 +564,7 @@ public:
 	Counter transactionSetMutations;
 	Counter transactionClearMutations;
 	Counter transactionAtomicMutations;
+	Counter transactionAtomicOpsCoalesced;
 	Counter transactionsCommitStarted;
 	Counter transactionsCommitCompleted;
 	Counter transactionKeyServerLocationRequests;
@@ -532,9 +585,25 @@ public:
 	ContinuousSample<double> latencies, readLatencies, commitLatencies, GRVLatencies, mutationsPerCommit,
 	    bytesPerCommit, bgLatencies, bgGranulesPerRequest;
 
+	// Coarse key-locality sketch of this client's traffic since the last metrics interval: counts of point
+	// reads, range read starts, and mutations by key hash bucket. Captures workload skew compactly without
+	// recording raw keys, so a production workload's shape can be re-created by a load generator (e.g. the
+	// ReadWrite workload's hotKeyFraction/hotTrafficFraction options).
+	constexpr static int WORKLOAD_SKEW_BUCKETS = 16;
+	int64_t readKeySkew[WORKLOAD_SKEW_BUCKETS] = {};
+	int64_t writeKeySkew[WORKLOAD_SKEW_BUCKETS] = {};
+	void recordKeySkew(int64_t* buckets, KeyRef const& key) {
+		buckets[std::hash<StringRef>{}(key) % WORKLOAD_SKEW_BUCKETS]++;
+	}
+
 	int outstandingWatches;
 	int maxOutstandingWatches;
 
+	// Cohorts of watches awaiting dispatch to a storage server, keyed by tenant id and shard begin
+	// key. Only used when CLIENT_KNOBS->ENABLE_WATCH_MULTIPLEXING is set; a cohort removes itself
+	// from this map when it is dispatched.
+	std::map<std::pair<int64_t, Key>, Reference<WatchMuxCohort>> watchMuxCohorts;
+
 	// Manage any shared state that may be used by MVC
 	DatabaseSharedState* sharedStatePtr;
 	Future<DatabaseSharedState*> initSharedState();
@@ -573,6 +642,13 @@ public:
 	Future<Void> clientInfoMonitor;
 	Future<Void> connected;
 
+	// Standby connection prewarming state, set by prewarmConnection and consumed by
+	// switchConnectionRecord
+	Reference<AsyncVar<Reference<IClusterConnectionRecord>>> standbyConnRecord;
+	Reference<AsyncVar<ClientDBInfo>> standbyClientInfo;
+	Reference<AsyncVar<Optional<ClientLeaderRegInterface>>> standbyCoordinator;
+	Future<Void> standbyInfoMonitor;
+
 	// An AsyncVar that reports the coordinator this DatabaseContext is interacting with
 	Reference<AsyncVar<Optional<ClientLeaderRegInterface>> const> coordinator;
 
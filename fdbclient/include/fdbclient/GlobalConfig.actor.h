@@ -53,6 +53,15 @@ extern const KeyRef transactionTagSampleCost;
 extern const KeyRef samplingFrequency;
 extern const KeyRef samplingWindow;
 
+extern const KeyRef traceSeverityPrefix;
+extern const KeyRef traceRateLimitPrefix;
+
+// Handlers for the trace control global configuration keys. The suffix of the key names the
+// trace event type; `trace/severity/<Type>` holds an integer severity threshold (see Severity
+// in flow/Trace.h) and `trace/rate_limit/<Type>` holds the allowed events per second.
+void traceSeverityUpdated(KeyRef key, std::optional<std::any> value);
+void traceRateLimitUpdated(KeyRef key, std::optional<std::any> value);
+
 // Structure used to hold the values stored by global configuration. The arena
 // is used as memory to store both the key and the value (the value is only
 // stored in the arena if it is an object; primitives are just copied).
@@ -147,6 +156,12 @@ public:
 	// control of global configuration.
 	void trigger(KeyRef key, std::function<void(std::optional<std::any>)> fn);
 
+	// Calls \ref fn whenever any key beginning with \ref prefix is changed or cleared. \ref fn
+	// is passed the changed key (with the prefix still attached) and its updated value, or an
+	// empty optional if the key has been cleared. The key reference is only valid for the
+	// duration of the call.
+	void triggerRange(KeyRef prefix, std::function<void(KeyRef, std::optional<std::any>)> fn);
+
 private:
 	// The functions below only affect the local copy of the global
 	// configuration keyspace! To insert or remove values across all nodes you
@@ -176,6 +191,7 @@ private:
 	Version lastUpdate;
 	// The key should be a global config string literal key (see the top of this class).
 	std::unordered_map<KeyRef, std::function<void(std::optional<std::any>)>> callbacks;
+	std::vector<std::pair<Key, std::function<void(KeyRef, std::optional<std::any>)>>> rangeCallbacks;
 };
 
 #include "flow/unactorcompiler.h"
@@ -31,6 +31,22 @@
 
 struct VersionVector;
 
+// A handle to an in-progress streaming range read created by ITransaction::getRangeStream.
+// Fragments are delivered in key order with out-of-order shard deliveries already merged by the
+// client; each fragment reports more == true until the stream is exhausted, which is signaled by
+// an empty terminating fragment with more == false. Destroying the handle cancels the stream.
+class ITransactionRangeStream {
+public:
+	virtual ~ITransactionRangeStream() {}
+
+	// Returns the next fragment of the range. At most one fragment may be outstanding at a time.
+	virtual ThreadFuture<RangeResult> nextFragment() = 0;
+	virtual void cancel() = 0;
+
+	virtual void addref() = 0;
+	virtual void delref() = 0;
+};
+
 // An interface that represents a transaction created by a client
 class ITransaction {
 public:
@@ -63,6 +79,12 @@ public:
 	                                           GetRangeLimits limits,
 	                                           bool snapshot = false,
 	                                           bool reverse = false) = 0;
+	// Begins a streaming read of the range, fetching fragments from all shards in parallel while
+	// respecting the client's buffered-fragment limit. Streamed reads bypass this transaction's
+	// uncommitted writes.
+	virtual Reference<ITransactionRangeStream> getRangeStream(const KeySelectorRef& begin,
+	                                                          const KeySelectorRef& end,
+	                                                          bool snapshot = false) = 0;
 	virtual ThreadFuture<MappedRangeResult> getMappedRange(const KeySelectorRef& begin,
 	                                                       const KeySelectorRef& end,
 	                                                       const StringRef& mapper,
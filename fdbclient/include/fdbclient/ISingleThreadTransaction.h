@@ -70,6 +70,17 @@ public:
 	                                     GetRangeLimits limits,
 	                                     Snapshot = Snapshot::False,
 	                                     Reverse = Reverse::False) = 0;
+	// Streams the requested range to results as ordered fragments, terminated by an end_of_stream
+	// error. Streamed reads do not observe this transaction's uncommitted writes; transaction
+	// implementations that cannot stream reject the read through the results stream.
+	virtual Future<Void> getRangeStream(PromiseStream<Standalone<RangeResultRef>> const& results,
+	                                    KeySelector const& begin,
+	                                    KeySelector const& end,
+	                                    Snapshot = Snapshot::False) {
+		Error e = unsupported_operation();
+		results.sendError(e);
+		return e;
+	}
 	virtual Future<MappedRangeResult> getMappedRange(KeySelector begin,
 	                                                 KeySelector end,
 	                                                 Key mapper,
@@ -18,7 +18,7 @@ class JsonBuilderObjectSetter;
 // Default value is null, as in the JSON type
 class JsonBuilder {
 protected:
-	enum EType { NULLVALUE, OBJECT, ARRAY };
+	enum EType { NULLVALUE, OBJECT, ARRAY, RAW };
 
 	typedef VectorRef<char> VString;
 
@@ -47,6 +47,17 @@ public:
 
 	static int coerceAsciiNumberToJSON(const char* s, int len, char* dst);
 
+	// Flatten the JSON text into one contiguous string, including the closing characters.
+	// Useful for caching a finished subtree compactly (without retaining this builder's
+	// arena); splice the cached bytes back into a document with fromRawJson().
+	Standalone<StringRef> toStringRef() const;
+
+	// Make a value from previously serialized JSON text, e.g. from toStringRef() or
+	// getJson().  The text is spliced into documents without being copied or re-serialized,
+	// so unchanged subtrees of a periodically rebuilt document can be reused across builds.
+	// The text is not validated and must be a complete JSON value.
+	static JsonString fromRawJson(Standalone<StringRef> const& json);
+
 protected:
 	EType type;
 	Arena arena;
@@ -217,6 +228,7 @@ protected:
 			return "}";
 		case ARRAY:
 			return "]";
+		case RAW:
 		default:
 			return "";
 		};
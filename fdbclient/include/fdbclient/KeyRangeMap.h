@@ -41,12 +41,15 @@ public:
 	  : RangeMap<Key, Val, KeyRangeRef, Metric, MetricFunc>(endKey, v), mapEnd(endKey) {}
 	void operator=(KeyRangeMap&& r) noexcept {
 		mapEnd = std::move(r.mapEnd);
+		mapVersion = r.mapVersion;
 		RangeMap<Key, Val, KeyRangeRef, Metric, MetricFunc>::operator=(std::move(r));
 	}
 	void insert(const KeyRangeRef& keys, const Val& value) {
+		++mapVersion;
 		RangeMap<Key, Val, KeyRangeRef, Metric, MetricFunc>::insert(keys, value);
 	}
 	void insert(const KeyRef& key, const Val& value) {
+		++mapVersion;
 		RangeMap<Key, Val, KeyRangeRef, Metric, MetricFunc>::insert(singleKeyRange(key), value);
 	}
 	std::vector<KeyRangeWith<Val>> getAffectedRangesAfterInsertion(const KeyRangeRef& keys,
@@ -55,6 +58,7 @@ public:
 	    const KeyRangeRef&
 	        keys) // Returns ranges, the first of which begins at keys.begin and the last of which ends at keys.end
 	{
+		++mapVersion;
 		MapPair<Key, Val> valueBeforeRange(
 		    keys.begin, RangeMap<Key, Val, KeyRangeRef, Metric>::rangeContaining(keys.begin).value());
 		MapPair<Key, Val> valueAfterRange(keys.end,
@@ -66,19 +70,29 @@ public:
 	}
 
 	void rawErase(KeyRange const& range) {
+		++mapVersion;
 		RangeMap<Key, Val, KeyRangeRef, Metric, MetricFunc>::map.erase(
 		    RangeMap<Key, Val, KeyRangeRef, Metric, MetricFunc>::map.lower_bound(range.begin),
 		    RangeMap<Key, Val, KeyRangeRef, Metric, MetricFunc>::map.lower_bound(range.end));
 	}
 	void rawInsert(Key const& key, Val const& value) {
+		++mapVersion;
 		MapPair<Key, Val> pair(key, value);
 		RangeMap<Key, Val, KeyRangeRef, Metric, MetricFunc>::map.insert(
 		    pair, true, RangeMap<Key, Val, KeyRangeRef, Metric, MetricFunc>::mf(pair));
 	}
 	void rawInsert(const std::vector<std::pair<MapPair<Key, Val>, Metric>>& pairs) {
+		++mapVersion;
 		RangeMap<Key, Val, KeyRangeRef, Metric, MetricFunc>::map.insert(pairs);
 	}
+	// Incremented by every mutation made through this interface, so read-mostly consumers (see
+	// KeyRangeMapSnapshot) can tell whether the map has changed. In-place changes to values through iterators
+	// and mutations made directly through the RangeMap interface are not counted.
+	uint64_t getMapVersion() const { return mapVersion; }
 	Key mapEnd;
+
+private:
+	uint64_t mapVersion = 0;
 };
 
 template <class Val, class Metric = int, class MetricFunc = ConstantMetric<Metric>>
@@ -109,6 +123,55 @@ public:
 	Key mapEnd;
 };
 
+// A frozen, flat-array view of a KeyRangeMap for read-mostly consumers. Lookups are a binary search over a
+// contiguous boundary vector instead of a walk of the underlying tree, which is considerably more cache
+// friendly for maps that are queried constantly but change rarely (e.g. the commit proxy's keyServers view).
+// A snapshot is only valid for the map version it was built from; callers use upToDate() and rebuild() to
+// refresh it after the map has changed. Maps mutated in ways getMapVersion() does not track (see KeyRangeMap)
+// cannot be served from snapshots.
+template <class Val>
+class KeyRangeMapSnapshot {
+public:
+	template <class Metric, class MetricFunc>
+	bool upToDate(KeyRangeMap<Val, Metric, MetricFunc> const& map) const {
+		return sourceVersion == map.getMapVersion();
+	}
+
+	template <class Metric, class MetricFunc>
+	void rebuild(KeyRangeMap<Val, Metric, MetricFunc>& map) {
+		boundaries.clear();
+		values.clear();
+		for (auto r : map.ranges()) {
+			boundaries.push_back(r.begin());
+			values.push_back(r.value());
+		}
+		boundaries.push_back(map.mapEnd);
+		sourceVersion = map.getMapVersion();
+	}
+
+	int size() const { return values.size(); }
+
+	// Returns the index of the range containing key, clamped to the last range for keys at or past the map end.
+	int rangeContaining(const KeyRef& key) const {
+		return std::upper_bound(boundaries.begin(), boundaries.end() - 1, key) - boundaries.begin() - 1;
+	}
+
+	// Returns the index of the range containing the highest key strictly less than key, like
+	// RangeMap::rangeContainingKeyBefore.
+	int rangeContainingKeyBefore(const KeyRef& key) const {
+		int i = rangeContaining(key);
+		return i > 0 && boundaries[i] == key ? i - 1 : i;
+	}
+
+	KeyRangeRef rangeAt(int i) const { return KeyRangeRef(boundaries[i], boundaries[i + 1]); }
+	const Val& valueAt(int i) const { return values[i]; }
+
+private:
+	std::vector<Key> boundaries; // begin keys of each range, plus the map end key
+	std::vector<Val> values; // values[i] applies to [boundaries[i], boundaries[i+1])
+	uint64_t sourceVersion = std::numeric_limits<uint64_t>::max();
+};
+
 class KeyRangeActorMap {
 public:
 	void getRangesAffectedByInsertion(const KeyRangeRef& keys, std::vector<KeyRange>& affectedRanges);
@@ -38,6 +38,7 @@ struct FdbCApi : public ThreadSafeReferenceCounted<FdbCApi> {
 	typedef struct FDB_database FDBDatabase;
 	typedef struct FDB_tenant FDBTenant;
 	typedef struct FDB_transaction FDBTransaction;
+	typedef struct FDB_rangestream FDBRangeStream;
 
 	typedef int fdb_error_t;
 	typedef int fdb_bool_t;
@@ -237,6 +238,19 @@ struct FdbCApi : public ThreadSafeReferenceCounted<FdbCApi> {
 	                                        int matchIndex,
 	                                        fdb_bool_t snapshot,
 	                                        fdb_bool_t reverse);
+	FDBRangeStream* (*transactionGetRangeStream)(FDBTransaction* tr,
+	                                             uint8_t const* beginKeyName,
+	                                             int beginKeyNameLength,
+	                                             fdb_bool_t beginOrEqual,
+	                                             int beginOffset,
+	                                             uint8_t const* endKeyName,
+	                                             int endKeyNameLength,
+	                                             fdb_bool_t endOrEqual,
+	                                             int endOffset,
+	                                             fdb_bool_t snapshot);
+	FDBFuture* (*rangeStreamNextFragment)(FDBRangeStream* rs);
+	void (*rangeStreamCancel)(FDBRangeStream* rs);
+	void (*rangeStreamDestroy)(FDBRangeStream* rs);
 	FDBFuture* (*transactionGetVersionstamp)(FDBTransaction* tr);
 
 	void (*transactionSet)(FDBTransaction* tr,
@@ -362,6 +376,9 @@ public:
 	                                   GetRangeLimits limits,
 	                                   bool snapshot = false,
 	                                   bool reverse = false) override;
+	Reference<ITransactionRangeStream> getRangeStream(const KeySelectorRef& begin,
+	                                                  const KeySelectorRef& end,
+	                                                  bool snapshot = false) override;
 	ThreadFuture<MappedRangeResult> getMappedRange(const KeySelectorRef& begin,
 	                                               const KeySelectorRef& end,
 	                                               const StringRef& mapper,
@@ -417,6 +434,25 @@ private:
 	FdbCApi::FDBTransaction* const tr;
 };
 
+// Wraps a range stream handle produced by an external client library
+class DLTransactionRangeStream final : public ITransactionRangeStream,
+                                       public ThreadSafeReferenceCounted<DLTransactionRangeStream> {
+public:
+	DLTransactionRangeStream(Reference<FdbCApi> api, FdbCApi::FDBRangeStream* stream)
+	  : api(api), stream(stream) {}
+	~DLTransactionRangeStream() override { api->rangeStreamDestroy(stream); }
+
+	ThreadFuture<RangeResult> nextFragment() override;
+	void cancel() override { api->rangeStreamCancel(stream); }
+
+	void addref() override { ThreadSafeReferenceCounted<DLTransactionRangeStream>::addref(); }
+	void delref() override { ThreadSafeReferenceCounted<DLTransactionRangeStream>::delref(); }
+
+private:
+	const Reference<FdbCApi> api;
+	FdbCApi::FDBRangeStream* const stream;
+};
+
 class DLTenant : public ITenant, ThreadSafeReferenceCounted<DLTenant> {
 public:
 	DLTenant(Reference<FdbCApi> api, FdbCApi::FDBTenant* tenant) : api(api), tenant(tenant) {}
@@ -524,6 +560,35 @@ class MultiVersionTenant;
 // An implementation of ITransaction that wraps a transaction created either locally or through a dynamically loaded
 // external client. When needed (e.g on cluster version change), the MultiVersionTransaction can automatically replace
 // its wrapped transaction with one from another client.
+// Wraps the active client's range stream. A stream cannot be transparently restarted on a
+// different client, so fragment futures abort with cluster_version_changed if the protocol
+// version changes mid-stream and the caller is expected to retry through onError.
+class MultiVersionTransactionRangeStream final : public ITransactionRangeStream,
+                                                 public ThreadSafeReferenceCounted<MultiVersionTransactionRangeStream> {
+public:
+	MultiVersionTransactionRangeStream(Reference<ITransaction> tr,
+	                                   Reference<ITransactionRangeStream> underlying,
+	                                   ThreadFuture<Void> onChange,
+	                                   Optional<Error> creationError)
+	  : tr(tr), underlying(underlying), onChange(onChange), creationError(creationError) {}
+
+	ThreadFuture<RangeResult> nextFragment() override;
+	void cancel() override {
+		if (underlying) {
+			underlying->cancel();
+		}
+	}
+
+	void addref() override { ThreadSafeReferenceCounted<MultiVersionTransactionRangeStream>::addref(); }
+	void delref() override { ThreadSafeReferenceCounted<MultiVersionTransactionRangeStream>::delref(); }
+
+private:
+	const Reference<ITransaction> tr; // keeps the wrapped transaction alive while streaming
+	const Reference<ITransactionRangeStream> underlying;
+	ThreadFuture<Void> onChange;
+	const Optional<Error> creationError;
+};
+
 class MultiVersionTransaction : public ITransaction, ThreadSafeReferenceCounted<MultiVersionTransaction> {
 public:
 	MultiVersionTransaction(Reference<MultiVersionDatabase> db,
@@ -556,6 +621,9 @@ public:
 	                                   GetRangeLimits limits,
 	                                   bool snapshot = false,
 	                                   bool reverse = false) override;
+	Reference<ITransactionRangeStream> getRangeStream(const KeySelectorRef& begin,
+	                                                  const KeySelectorRef& end,
+	                                                  bool snapshot = false) override;
 	ThreadFuture<MappedRangeResult> getMappedRange(const KeySelectorRef& begin,
 	                                               const KeySelectorRef& end,
 	                                               const StringRef& mapper,
@@ -934,6 +1002,10 @@ public:
 	static MultiVersionApi* api;
 
 	Reference<ClientInfo> getLocalClient();
+
+	// True if any external client libraries have been configured. When none are present, the
+	// protocol version can never be served by anything other than the local client.
+	bool hasExternalClients();
 	void runOnExternalClients(int threadId,
 	                          std::function<void(Reference<ClientInfo>)>,
 	                          bool runOnFailedClients = false);
@@ -161,6 +161,10 @@ struct TransactionOptions {
 	bool skipGrvCache : 1;
 	bool rawAccess : 1;
 
+	// Staleness bound in seconds for reads served from the GRV cache; 0 means the
+	// MAX_VERSION_CACHE_LAG knob applies. Setting it implies useGrvCache.
+	double grvCacheMaxStaleness;
+
 	TransactionPriority priority;
 
 	TagSet tags; // All tags set on transaction
@@ -301,8 +305,16 @@ public:
 	Optional<Version> getCachedReadVersion() const;
 
 	[[nodiscard]] Future<Optional<Value>> get(const Key& key, Snapshot = Snapshot::False);
+	// Reads several keys at once; keys that lie on the same shard are sent to the storage servers
+	// in one batched request. Results are in the same order as the input.
+	[[nodiscard]] Future<std::vector<Optional<Value>>> getMultipleValues(const std::vector<Key>& keys,
+	                                                                     Snapshot = Snapshot::False);
 	[[nodiscard]] Future<Void> watch(Reference<Watch> watch);
 	[[nodiscard]] Future<Key> getKey(const KeySelector& key, Snapshot = Snapshot::False);
+	// Resolves several key selectors at once; selectors whose keys lie on the same shard are sent
+	// to the storage servers in one batched request. Results are in the same order as the input.
+	[[nodiscard]] Future<std::vector<Key>> getMultipleKeys(const std::vector<KeySelector>& selectors,
+	                                                       Snapshot = Snapshot::False);
 	// Future< Optional<KeyValue> > get( const KeySelectorRef& key );
 	[[nodiscard]] Future<RangeResult> getRange(const KeySelector& begin,
 	                                           const KeySelector& end,
@@ -482,6 +494,18 @@ public:
 	template <typename Type>
 	using FutureT = Future<Type>;
 
+	// A speculatively issued getRange batch, produced when sequential iteration is detected. The
+	// stored selectors and limits identify the call it can satisfy; the conflict range is only
+	// added to the transaction if the batch is actually consumed.
+	struct RangePrefetch {
+		KeySelector begin;
+		KeySelector end;
+		GetRangeLimits limits;
+		Snapshot snapshot = Snapshot::False;
+		Future<RangeResult> result;
+		Future<std::pair<Key, Key>> conflictRange;
+	};
+
 private:
 	Future<Version> getReadVersion(uint32_t flags);
 
@@ -502,12 +526,29 @@ private:
 	std::vector<Future<std::pair<Key, Key>>> extraConflictRanges;
 	Promise<Void> commitResult;
 	Future<Void> committing;
+
+	// Sequential scan detection for plain forward getRange. The last such call is remembered so
+	// that a follow-up call picking up exactly where it left off starts read-ahead; once a scan is
+	// established, rangePrefetch holds the next batch, requested as soon as the previous arrived.
+	Future<RangePrefetch> rangePrefetch;
+	Future<RangeResult> lastRangeResult;
+	KeySelector lastRangeEnd;
+	GetRangeLimits lastRangeLimits;
+	Snapshot lastRangeSnapshot = Snapshot::False;
+
+	// Index into tr.transaction.mutations of the most recent atomic op on each key, used by
+	// atomicOp() to fold commutative ops on the same key together client-side instead of shipping
+	// them individually. Entries are invalidated by sets and clears of the key so that folding
+	// never crosses an intervening mutation.
+	std::map<KeyRef, int> latestAtomicOps;
+	bool coalesceAtomicOp(KeyRef key, MutationRef::Type operationType, ValueRef operand);
 };
 
 ACTOR Future<Version> waitForCommittedVersion(Database cx, Version version, SpanContext spanContext);
 ACTOR Future<Standalone<VectorRef<DDMetricsRef>>> waitDataDistributionMetricsList(Database cx,
                                                                                   KeyRange keys,
                                                                                   int shardLimit);
+ACTOR Future<std::vector<ShardCountEntry>> waitShardCountsList(Database cx);
 
 std::string unprintable(const std::string&);
 
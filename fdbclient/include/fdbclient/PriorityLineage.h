@@ -0,0 +1,44 @@
+/*
+ * PriorityLineage.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <string_view>
+
+#include "fdbclient/ActorLineageProfiler.h"
+
+// Records the TaskPriority the run loop was executing when a sample was taken, so aggregated samples show how
+// run-loop time is distributed across task priorities
+struct PriorityLineage : LineageProperties<PriorityLineage> {
+	static constexpr std::string_view name = "Priority"sv;
+	int64_t priority;
+};
+
+struct PriorityLineageCollector : IALPCollector<PriorityLineage> {
+	PriorityLineageCollector() : IALPCollector() {}
+	std::optional<std::any> collect(ActorLineage* lineage) override {
+		auto priority = lineage->get(&PriorityLineage::priority);
+		if (priority.has_value()) {
+			return priority.value();
+		} else {
+			return {};
+		}
+	}
+};
@@ -108,6 +108,10 @@ public:
 		                snapshot,
 		                reverse);
 	}
+	Future<Void> getRangeStream(PromiseStream<Standalone<RangeResultRef>> const& results,
+	                            KeySelector const& begin,
+	                            KeySelector const& end,
+	                            Snapshot = Snapshot::False) override;
 	Future<MappedRangeResult> getMappedRange(KeySelector begin,
 	                                         KeySelector end,
 	                                         Key mapper,
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <deque>
 #include <map>
 #include <functional>
 #include "flow/flow.h"
@@ -59,7 +60,7 @@ public:
 		    delete_requests_per_second, multipart_max_part_size, multipart_min_part_size, concurrent_requests,
 		    concurrent_uploads, concurrent_lists, concurrent_reads_per_file, concurrent_writes_per_file,
 		    read_block_size, read_ahead_blocks, read_cache_blocks_per_file, max_send_bytes_per_second,
-		    max_recv_bytes_per_second, sdk_auth;
+		    max_recv_bytes_per_second, max_connection_pool_size, sdk_auth;
 		bool set(StringRef name, int value);
 		std::string getURLParameters() const;
 		static std::vector<std::string> getKnobDescriptions() {
@@ -68,6 +69,8 @@ public:
 				"connect_tries (or ct)                 Number of times to try to connect for each request.",
 				"connect_timeout (or cto)              Number of seconds to wait for a connect request to succeed.",
 				"max_connection_life (or mcl)          Maximum number of seconds to use a single TCP connection.",
+				"max_connection_pool_size (or mcps)    Maximum number of idle keep-alive connections to retain for "
+				"reuse.",
 				"request_tries (or rt)                 Number of times to try each request until a parsable HTTP "
 				"response other than 429 is received.",
 				"request_timeout_min (or rtom)         Number of seconds to wait for a request to succeed after a "
@@ -151,7 +154,8 @@ public:
 		Reference<IConnection> conn;
 		double expirationTime;
 	};
-	std::queue<ReusableConnection> connectionPool;
+	// Idle keep-alive connections, most recently used first.
+	std::deque<ReusableConnection> connectionPool;
 	Future<ReusableConnection> connect();
 	void returnConnection(ReusableConnection& conn);
 
@@ -40,6 +40,8 @@ public:
 	int64_t MAX_WRITE_TRANSACTION_LIFE_VERSIONS;
 	bool ENABLE_VERSION_VECTOR;
 	bool ENABLE_VERSION_VECTOR_TLOG_UNICAST;
+	int VERSION_VECTOR_MAX_SIZE; // When the version vector exceeds this many entries, entries older than
+	                             // MAX_READ_TRANSACTION_LIFE_VERSIONS are compacted away
 	double MAX_COMMIT_BATCH_INTERVAL; // Each commit proxy generates a CommitTransactionBatchRequest at least this
 	                                  // often, so that versions always advance smoothly
 	double MAX_VERSION_RATE_MODIFIER;
@@ -48,6 +50,8 @@ public:
 
 	// TLogs
 	bool PEEK_USING_STREAMING;
+	bool PEEK_USING_STREAMING_LOCAL; // stream peeks from tLogs on the same machine even when
+	                                 // PEEK_USING_STREAMING is off
 	double TLOG_TIMEOUT; // tlog OR commit proxy failure - master's reaction time
 	double TLOG_SLOW_REJOIN_WARN_TIMEOUT_SECS; // Warns if a tlog takes too long to rejoin
 	double RECOVERY_TLOG_SMART_QUORUM_DELAY; // smaller might be better for bug amplification
@@ -57,6 +61,7 @@ public:
 	int DESIRED_UPDATE_BYTES;
 	double UPDATE_DELAY;
 	int MAXIMUM_PEEK_BYTES;
+	int LOG_ROUTER_PEEK_MAX_BYTES; // upper bound for the log router's adaptive peek reply size
 	int APPLY_MUTATION_BYTES;
 	int RECOVERY_DATA_BYTE_LIMIT;
 	int BUGGIFY_RECOVERY_DATA_LIMIT;
@@ -82,18 +87,24 @@ public:
 	int PARALLEL_GET_MORE_REQUESTS;
 	int MULTI_CURSOR_PRE_FETCH_LIMIT;
 	int64_t MAX_QUEUE_COMMIT_BYTES;
+	int TLOG_QUEUE_COMMIT_PIPELINE_DEPTH; // maximum number of in-flight disk queue syncs before further commits wait
 	int DESIRED_OUTSTANDING_MESSAGES;
 	double DESIRED_GET_MORE_DELAY;
 	int CONCURRENT_LOG_ROUTER_READS;
 	int LOG_ROUTER_PEEK_FROM_SATELLITES_PREFERRED; // 0==peek from primary, non-zero==peek from satellites
 	double DISK_QUEUE_ADAPTER_MIN_SWITCH_TIME;
 	double DISK_QUEUE_ADAPTER_MAX_SWITCH_TIME;
+	int64_t DISK_QUEUE_ADAPTER_PEEK_AHEAD_BYTES; // Keep this many recovered bytes buffered ahead of readNext() calls
 	int64_t TLOG_SPILL_REFERENCE_MAX_PEEK_MEMORY_BYTES;
 	int64_t TLOG_SPILL_REFERENCE_MAX_BATCHES_PER_PEEK;
 	int64_t TLOG_SPILL_REFERENCE_MAX_BYTES_PER_BATCH;
+	bool TLOG_SPILL_REFERENCE_CARRY_PARTIAL_BATCH; // Resume partially filled spill index batches on the next spill
 	int64_t DISK_QUEUE_FILE_EXTENSION_BYTES; // When we grow the disk queue, by how many bytes should it grow?
 	int64_t DISK_QUEUE_FILE_SHRINK_BYTES; // When we shrink the disk queue, by how many bytes should it shrink?
 	int64_t DISK_QUEUE_MAX_TRUNCATE_BYTES; // A truncate larger than this will cause the file to be replaced instead.
+	bool DISK_QUEUE_PREALLOCATE_EXTENTS; // Extend the push file in the background before it fills, off the push path
+	bool DISK_QUEUE_RECOVERY_READ_AHEAD; // Prefetch the next chunk of the queue while the current one is parsed
+	                                     // during the recovery scan
 	double TLOG_DEGRADED_DURATION;
 	int64_t MAX_CACHE_VERSIONS;
 	double TXS_POPPED_MAX_DELAY;
@@ -115,6 +126,8 @@ public:
 	double BLOCKING_PEEK_TIMEOUT;
 	bool PEEK_BATCHING_EMPTY_MSG;
 	double PEEK_BATCHING_EMPTY_MSG_INTERVAL;
+	int64_t TLOG_BACKLOG_PEEK_VERSION_LAG; // peeks lagging by more than this many versions are served below commit
+	                                       // priority; 0 disables the deprioritization
 
 	// Data distribution queue
 	double HEALTH_POLL_TIME;
@@ -125,6 +138,12 @@ public:
 	double DD_QUEUE_LOGGING_INTERVAL;
 	double RELOCATION_PARALLELISM_PER_SOURCE_SERVER;
 	double RELOCATION_PARALLELISM_PER_DEST_SERVER;
+	double RELOCATION_PARALLELISM_PER_SOURCE_SERVER_DRAIN; // Per-source-server relocation parallelism used while
+	                                                       // draining an excluded server (relocations at
+	                                                       // PRIORITY_TEAM_CONTAINS_UNDESIRED_SERVER). During a drain
+	                                                       // every affected shard shares the excluded host's teams, so
+	                                                       // the steady-state parallelism is the bottleneck. 0 falls
+	                                                       // back to RELOCATION_PARALLELISM_PER_SOURCE_SERVER.
 	int DD_QUEUE_MAX_KEY_SERVERS;
 	int DD_REBALANCE_PARALLELISM;
 	int DD_REBALANCE_RESET_AMOUNT;
@@ -210,6 +229,20 @@ public:
 	int64_t DD_SHARD_SIZE_GRANULARITY;
 	int64_t DD_SHARD_SIZE_GRANULARITY_SIM;
 	int DD_MOVE_KEYS_PARALLELISM;
+	int DD_INITIAL_SCAN_PARALLELISM; // Number of keyspace partitions read concurrently when bootstrapping the shard map
+	int DD_MOVE_COALESCE_LIMIT; // Max adjacent same-source queued relocations merged into one data move; <= 1 disables
+	bool DD_FAST_READ_HOT_SPLIT; // Split a detected read-hot sub-range out of its shard immediately on detection
+	bool DD_STORAGE_CACHE_ASSIGNMENT; // Automatically register detected read-hot ranges as cached ranges served by
+	                                  // storage cache servers; does nothing when no cache servers are configured
+	int DD_STORAGE_CACHE_MAX_RANGES; // Cap on the number of ranges data distribution keeps assigned to the cache
+	double DD_STORAGE_CACHE_COOLDOWN; // Seconds a cached range may go without a read-hot detection before it is
+	                                  // dropped from the cache
+	int64_t DD_MOVE_BYTES_IN_FLIGHT_BUDGET; // Cluster-wide cap on relocation bytes in flight below
+	                                        // PRIORITY_TEAM_UNHEALTHY; 0 disables the budget
+	int DD_LOAD_AWARE_PLACEMENT; // Multi-dimensional (CPU/disk/read/space) scoring of destination teams:
+	                             // 0 = off, 1 = shadow (score and trace only), 2 = active (scores affect selection)
+	double DD_LOAD_SCORE_READ_SATURATION; // Read bandwidth (bytes per kSecond) treated as a fully busy read axis
+	double DD_LOAD_SCORE_WEIGHT; // In active mode, how strongly a team's load score penalizes its apparent load
 	int DD_FETCH_SOURCE_PARALLELISM;
 	int DD_MERGE_LIMIT;
 	double DD_SHARD_METRICS_TIMEOUT;
@@ -282,6 +315,7 @@ public:
 	int SQLITE_WRITE_WINDOW_LIMIT;
 	double SQLITE_WRITE_WINDOW_SECONDS;
 	int64_t SQLITE_CURSOR_MAX_LIFETIME_BYTES;
+	bool SQLITE_INLINE_CACHED_READS; // Serve point reads on the network thread when all pages needed are cached
 
 	// KeyValueStoreSqlite spring cleaning
 	double SPRING_CLEANING_NO_ACTION_INTERVAL;
@@ -304,6 +338,9 @@ public:
 	int ROCKSDB_READ_PARALLELISM;
 	int64_t ROCKSDB_MEMTABLE_BYTES;
 	bool ROCKSDB_UNSAFE_AUTO_FSYNC;
+	bool ROCKSDB_DISABLE_WAL; // Skip the RocksDB WAL, gating commit durability on memtable flushes instead
+	double ROCKSDB_DISABLE_WAL_FLUSH_INTERVAL; // Max seconds between memtable flushes when the WAL is disabled
+	int64_t ROCKSDB_DISABLE_WAL_FLUSH_BYTES; // Unflushed commit bytes which trigger an early memtable flush
 	int64_t ROCKSDB_PERIODIC_COMPACTION_SECONDS;
 	int ROCKSDB_PREFIX_LEN;
 	int64_t ROCKSDB_BLOCK_CACHE_SIZE;
@@ -321,6 +358,7 @@ public:
 	double ROCKSDB_HISTOGRAMS_SAMPLE_RATE;
 	double ROCKSDB_READ_RANGE_ITERATOR_REFRESH_TIME;
 	bool ROCKSDB_READ_RANGE_REUSE_ITERATORS;
+	int ROCKSDB_READ_RANGE_SHARD_FANOUT;
 	int64_t ROCKSDB_WRITE_RATE_LIMITER_BYTES_PER_SEC;
 	bool ROCKSDB_WRITE_RATE_LIMITER_AUTO_TUNE;
 	std::string DEFAULT_FDB_ROCKSDB_COLUMN_FAMILY;
@@ -365,6 +403,10 @@ public:
 	double COMMIT_TRANSACTION_BATCH_INTERVAL_MAX;
 	double COMMIT_TRANSACTION_BATCH_INTERVAL_LATENCY_FRACTION;
 	double COMMIT_TRANSACTION_BATCH_INTERVAL_SMOOTHER_ALPHA;
+	double COMMIT_BATCH_LATENCY_TARGET; // if > 0, adjust the commit batching window to hold the p99 of batch
+	                                    // durations at this target instead of the latency-fraction smoothing
+	double COMMIT_BATCH_LATENCY_CONTROL_INTERVAL; // how often the closed-loop controller adjusts the window
+	double COMMIT_BATCH_LATENCY_CONTROL_STEP; // multiplicative step (and deadband) for each adjustment
 	int COMMIT_TRANSACTION_BATCH_COUNT_MAX;
 	int COMMIT_TRANSACTION_BATCH_BYTES_MIN;
 	int COMMIT_TRANSACTION_BATCH_BYTES_MAX;
@@ -373,8 +415,13 @@ public:
 	int64_t COMMIT_BATCHES_MEM_BYTES_HARD_LIMIT;
 	double COMMIT_BATCHES_MEM_FRACTION_OF_TOTAL;
 	double COMMIT_BATCHES_MEM_TO_TOTAL_MEM_SCALE_FACTOR;
+	int KEY_SERVERS_DECODE_CACHE_SIZE; // max decoded keyServers values cached per proxy; 0 disables the cache
+	int COMMIT_LARGE_TRANSACTION_BYTES; // transactions at least this large get a commit batch of their own; 0 disables
 
 	double RESOLVER_COALESCE_TIME;
+	int RESOLVER_READ_CHECK_THREADS; // worker threads for parallel read-conflict checking; 0 keeps the serial path.
+	                                 // Threaded checks trade simulation determinism for throughput, like the RocksDB
+	                                 // storage engine's thread pools.
 	int BUGGIFIED_ROW_LIMIT;
 	double PROXY_SPIN_DELAY;
 	double UPDATE_REMOTE_LOG_VERSION_INTERVAL;
@@ -442,6 +489,8 @@ public:
 	double CC_PRUNE_CLIENTS_INTERVAL;
 	double CC_CHANGE_DELAY;
 	double CC_CLASS_DELAY;
+	double CC_COORDINATOR_RESOLVE_CACHE_TTL; // How long worker registration reuses a cached resolution of the
+	                                         // coordinator hostnames before resolving again
 	double WAIT_FOR_GOOD_RECRUITMENT_DELAY;
 	double WAIT_FOR_GOOD_REMOTE_RECRUITMENT_DELAY;
 	double ATTEMPT_RECRUITMENT_DELAY;
@@ -557,6 +606,9 @@ public:
 	int64_t STORAGE_HARD_LIMIT_VERSION_OVERAGE;
 	int64_t STORAGE_DURABILITY_LAG_HARD_MAX;
 	int64_t STORAGE_DURABILITY_LAG_SOFT_MAX;
+	int64_t COMPACTION_DEBT_TARGET_BYTES; // Deferred storage engine compaction work at which ingest is shaped; 0 disables
+	int64_t COMPACTION_DEBT_SPRING_BYTES;
+	int64_t COMPACTION_L0_TARGET_FILES; // Level-0 file count at which ingest is shaped; 0 disables
 
 	int64_t LOW_PRIORITY_STORAGE_QUEUE_BYTES;
 	int64_t LOW_PRIORITY_DURABILITY_LAG;
@@ -586,6 +638,10 @@ public:
 	// Limit to the number of throttling tags each storage server
 	// will track and send to the ratekeeper
 	int64_t SS_THROTTLE_TAGS_TRACKED;
+	// Number of hot keys each storage server keeps in its hot key index
+	int SS_HOT_KEYS_TRACKED;
+	// Number of counters per row in the count-min sketch backing the hot key index
+	int SS_HOT_KEY_SKETCH_WIDTH;
 	// Use global tag throttling strategy. i.e. throttle based on the cluster-wide
 	// throughput for tags and their associated quotas.
 	bool GLOBAL_TAG_THROTTLING;
@@ -594,6 +650,12 @@ public:
 	// Used by global tag throttling counters
 	double GLOBAL_TAG_THROTTLING_FOLDING_TIME;
 	double GLOBAL_TAG_THROTTLING_TRACE_INTERVAL;
+	// Proportional gain of the per-tag rate controller; 0 falls back to the undamped ratio update
+	double GLOBAL_TAG_THROTTLING_PI_KP;
+	// Integral gain of the per-tag rate controller
+	double GLOBAL_TAG_THROTTLING_PI_KI;
+	// Seconds of unused target rate a tag may bank as burst credit; 0 disables burst credits
+	double GLOBAL_TAG_THROTTLING_BURST_WINDOW;
 
 	double MAX_TRANSACTIONS_PER_BYTE;
 
@@ -648,6 +710,8 @@ public:
 	int64_t EMPTY_READ_PENALTY;
 	int DD_SHARD_COMPARE_LIMIT; // when read-aware DD is enabled, at most how many shards are compared together
 	bool READ_SAMPLING_ENABLED;
+	double COLD_RANGE_REPORT_INTERVAL; // how often a storage server reports its cold ranges; 0 disables the report
+	int64_t COLD_SHARD_READ_BYTES_PER_KSECOND; // shards reading below this rate are considered cold
 
 	// Storage Server
 	double STORAGE_LOGGING_DELAY;
@@ -657,12 +721,17 @@ public:
 	int BUGGIFY_LIMIT_BYTES;
 	bool FETCH_USING_STREAMING;
 	int FETCH_BLOCK_BYTES;
+	int FETCH_KEYS_WRITE_BATCH_KEYS; // number of fetched key-values written to storage between yields
 	int FETCH_KEYS_PARALLELISM_BYTES;
 	int FETCH_KEYS_PARALLELISM;
 	int FETCH_KEYS_PARALLELISM_FULL;
 	int FETCH_KEYS_LOWER_PRIORITY;
+	bool FETCH_KEYS_SERVE_PREFIX_READS; // serve point reads over the already-fetched prefix of an adding shard
 	int FETCH_CHANGEFEED_PARALLELISM;
 	int SERVE_FETCH_CHECKPOINT_PARALLELISM;
+	int CHANGE_FEED_DISK_READS_PARALLELISM; // concurrent limit on change feed streams catching up from the storage
+	                                        // engine, so a storm of far-behind consumers cannot crowd out normal reads
+	int STORAGESERVER_READ_CONCURRENCY; // concurrent holder limit for the storage server read priority lock
 	int BUGGIFY_BLOCK_BYTES;
 	int64_t STORAGE_RECOVERY_VERSION_LAG_LIMIT;
 	double STORAGE_DURABILITY_LAG_REJECT_THRESHOLD;
@@ -670,11 +739,21 @@ public:
 	int STORAGE_COMMIT_BYTES;
 	int STORAGE_FETCH_BYTES;
 	double STORAGE_COMMIT_INTERVAL;
+	bool STORAGE_COMMIT_PACING_ENABLED; // pace updateStorage commit bytes against observed read latency
+	double STORAGE_COMMIT_PACING_TARGET_READ_LATENCY; // seconds; the commit byte budget shrinks when the smoothed
+	                                                  // read latency exceeds this
+	double STORAGE_COMMIT_PACING_MIN_FACTOR; // lower bound on the commit byte budget scale so durability always
+	                                         // makes progress
+	double STORAGE_COMMIT_PACING_LATENCY_EFOLD; // e-folding time of the smoothed read latency estimate
+	bool STORAGE_SPILL_QUEUE_ENABLED; // stage mutation backlog beyond the threshold to a disk queue instead of RAM
+	int64_t STORAGE_SPILL_QUEUE_THRESHOLD_BYTES; // in-memory backlog beyond which the storage server starts spilling
+	int64_t STORAGE_SPILL_QUEUE_MAX_BYTES; // stop spilling (and let ratekeeper engage) beyond this many spilled bytes
 	double UPDATE_SHARD_VERSION_INTERVAL;
 	int BYTE_SAMPLING_FACTOR;
 	int BYTE_SAMPLING_OVERHEAD;
 	int MAX_STORAGE_SERVER_WATCH_BYTES;
 	int MAX_BYTE_SAMPLE_CLEAR_MAP_SIZE;
+	int MAX_DEFERRED_BYTE_SAMPLE_OPS; // deferred byte-sample ops are folded inline once the buffer reaches this size
 	double LONG_BYTE_SAMPLE_RECOVERY_DELAY;
 	int BYTE_SAMPLE_LOAD_PARALLELISM;
 	double BYTE_SAMPLE_LOAD_DELAY;
@@ -689,6 +768,7 @@ public:
 	double TAG_MEASUREMENT_INTERVAL;
 	int64_t READ_COST_BYTE_FACTOR;
 	bool PREFIX_COMPRESS_KVS_MEM_SNAPSHOTS;
+	int64_t KVS_MEM_SNAPSHOT_YIELD_BYTES; // Snapshot bytes the memory storage engine writes between yields
 	bool REPORT_DD_METRICS;
 	double DD_METRICS_REPORT_INTERVAL;
 	double FETCH_KEYS_TOO_LONG_TIME_CRITERIA;
@@ -700,6 +780,7 @@ public:
 	bool QUICK_GET_VALUE_FALLBACK;
 	bool QUICK_GET_KEY_VALUES_FALLBACK;
 	int MAX_PARALLEL_QUICK_GET_VALUE;
+	int MAX_PARALLEL_REMOTE_QUICK_GET; // bound on deferred cross-shard subqueries in flight per mapped-range request
 	int CHECKPOINT_TRANSFER_BLOCK_BYTES;
 	int QUICK_GET_KEY_VALUES_LIMIT;
 	int QUICK_GET_KEY_VALUES_LIMIT_BYTES;
@@ -737,6 +818,14 @@ public:
 	bool WORKER_HEALTH_REPORT_RECENT_DESTROYED_PEER; // When enabled, the worker's health monitor also report any recent
 	                                                 // destroyed peers who are part of the transaction system to
 	                                                 // cluster controller.
+	bool ENABLE_IO_HEALTH_PROBER; // When enabled, each worker periodically probes its data disk with a small
+	                              // write/sync/read cycle and marks the process degraded if probes repeatedly
+	                              // violate the latency SLO, so gray disk failures surface before they throttle
+	                              // the cluster.
+	double IO_HEALTH_PROBE_INTERVAL; // Interval between two disk probes.
+	double IO_HEALTH_PROBE_LATENCY_SLO; // A probe cycle slower than this counts as an SLO violation.
+	double IO_HEALTH_PROBE_TIMEOUT; // A probe outstanding for this long is reported without waiting for completion.
+	int IO_HEALTH_PROBE_DEGRADED_COUNT; // Number of consecutive SLO violations before the process is marked degraded.
 
 	// Test harness
 	double WORKER_POLL_DELAY;
@@ -761,6 +850,8 @@ public:
 
 	// Status
 	double STATUS_MIN_TIME_BETWEEN_REQUESTS;
+	double STATUS_CACHE_TTL; // Requests arriving within this long of the last completed status get the same
+	                         // document without a re-collection; 0 disables the cache
 	double MAX_STATUS_REQUESTS_PER_SECOND;
 	int CONFIGURATION_ROWS_TO_FETCH;
 	bool DISABLE_DUPLICATE_LOG_WARNING;
@@ -839,6 +930,8 @@ public:
 	int REDWOOD_EXTENT_CONCURRENT_READS; // Max number of simultaneous extent disk reads in progress.
 	int REDWOOD_KVSTORE_CONCURRENT_READS; // Max number of simultaneous point or range reads in progress.
 	bool REDWOOD_KVSTORE_RANGE_PREFETCH; // Whether to use range read prefetching
+	int REDWOOD_KVSTORE_RANGE_PREFETCH_MAX_FACTOR; // Max multiple of a single request's limits that the prefetch
+	                                               // budget can grow to for sequential scans
 	double REDWOOD_PAGE_REBUILD_MAX_SLACK; // When rebuilding pages, max slack to allow in page
 	int REDWOOD_LAZY_CLEAR_BATCH_SIZE_PAGES; // Number of pages to try to pop from the lazy delete queue and process at
 	                                         // once
@@ -846,6 +939,8 @@ public:
 	                                  // queue is empty
 	int REDWOOD_LAZY_CLEAR_MAX_PAGES; // Maximum number of pages to free before ending a lazy clear cycle, unless the
 	                                  // queue is empty
+	int REDWOOD_LAZY_CLEAR_MAX_PAGES_PER_SECOND; // Target rate limit for background page freeing by lazy clear,
+	                                             // 0 means unlimited
 	int64_t REDWOOD_REMAP_CLEANUP_WINDOW_BYTES; // Total size of remapped pages to keep before being removed by
 	                                            // remap cleanup
 	double REDWOOD_REMAP_CLEANUP_TOLERANCE_RATIO; // Maximum ratio of the remap cleanup window that remap cleanup is
@@ -855,10 +950,25 @@ public:
 	double REDWOOD_HISTOGRAM_INTERVAL;
 	bool REDWOOD_EVICT_UPDATED_PAGES; // Whether to prioritize eviction of updated pages from cache.
 	int REDWOOD_DECODECACHE_REUSE_MIN_HEIGHT; // Minimum height for which to keep and reuse page decode caches
+	bool REDWOOD_DEFRAG_ENABLED; // Whether to run the background defragmentation scan
+	double REDWOOD_DEFRAG_INTERVAL; // Seconds between defragmentation scan passes
+	double REDWOOD_DEFRAG_BUSY_OPS_PER_SECOND; // KV operation rate above which defrag scan passes are skipped
+	int REDWOOD_DEFRAG_PAGES_PER_PASS; // Max number of leaf pages examined per defragmentation scan pass
+	double REDWOOD_DEFRAG_MIN_FILL_RATIO; // Stored KV fraction below which a leaf page is considered under-filled
+	int REDWOOD_PAGE_ENCODE_THREADS; // Threads for offloading page checksum generation and encryption during
+	                                 // commit, 0 means encode pages on the main thread
+	double REDWOOD_SCAN_CACHE_FRACTION; // Fraction of the page cache reserved, with its own eviction order, for
+	                                    // leaf pages loaded by range reads.  0 disables the separate scan cache.
+	bool REDWOOD_PAGE_COMPRESSION_ENABLED; // Whether to store multi-block BTree nodes compressed when doing so
+	                                       // occupies fewer pager blocks.  Has no effect without zlib support.
+	double REDWOOD_HISTORY_RETENTION_SECONDS; // How long committed versions remain readable via the point-in-time
+	                                          // read APIs.  0 means only the latest committed version is readable.
 
 	// Server request latency measurement
 	int LATENCY_SAMPLE_SIZE;
 	double LATENCY_METRICS_LOGGING_INTERVAL;
+	int LATENCY_BAND_RANGES_LOGGED; // busiest key ranges published per ReadLatencyBandsByRange event
+	int LATENCY_BAND_RANGES_TRACKED; // bound on per-shard latency band entries tracked per logging interval
 
 	// Cluster recovery
 	std::string CLUSTER_RECOVERY_EVENT_NAME_PREFIX;
@@ -900,8 +1010,12 @@ public:
 	bool BG_ENABLE_MERGING;
 	int BG_MERGE_CANDIDATE_THRESHOLD_SECONDS;
 	int BG_MERGE_CANDIDATE_DELAY_SECONDS;
+	bool BG_ENABLE_LOAD_BALANCING; // Periodically move granules from the most-loaded blob worker to the least-loaded
+	double BG_LOAD_BALANCE_INTERVAL;
+	int BG_LOAD_BALANCE_MAX_MOVES; // Max granules moved per load balancing round
 
 	int BLOB_WORKER_INITIAL_SNAPSHOT_PARALLELISM;
+	int BLOB_WORKER_RESNAPSHOT_PARALLELISM; // Max concurrent granule re-snapshots (blob-to-blob compactions) per worker
 	double BLOB_WORKER_TIMEOUT; // Blob Manager's reaction time to a blob worker failure
 	double BLOB_WORKER_REQUEST_TIMEOUT; // Blob Worker's server-side request timeout
 	double BLOB_WORKERLIST_FETCH_INTERVAL;
@@ -911,6 +1025,8 @@ public:
 	double BLOB_MANAGER_STATUS_EXP_BACKOFF_MAX;
 	double BLOB_MANAGER_STATUS_EXP_BACKOFF_EXPONENT;
 	int BLOB_MANAGER_CONCURRENT_MERGE_CHECKS;
+	int BLOB_MANAGER_PURGE_BATCH_SIZE; // Granules per metadata transaction / parallel read wave during a purge
+	int BLOB_MANAGER_CONCURRENT_PURGE_DELETES; // Max concurrent blob store file deletions across all purge work
 	double BGCC_TIMEOUT;
 	double BGCC_MIN_INTERVAL;
 
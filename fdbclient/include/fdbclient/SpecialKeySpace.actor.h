@@ -161,6 +161,62 @@ public:
 	}
 };
 
+// Retains the full module output across transactions and serves unchanged reads from the
+// retained arena. Derived classes report a cache generation; reads that observe the same
+// generation reuse the cached result, so high-frequency monitoring scans do not reallocate
+// identical output on every poll.
+class SpecialKeyRangeCachedImpl : public SpecialKeyRangeAsyncImpl {
+public:
+	explicit SpecialKeyRangeCachedImpl(KeyRangeRef kr) : SpecialKeyRangeAsyncImpl(kr) {}
+
+	Future<RangeResult> getRange(ReadYourWritesTransaction* ryw,
+	                             KeyRangeRef kr,
+	                             GetRangeLimits limitsHint) const override {
+		return getRangeCachedActor(this, ryw, kr, limitsHint);
+	}
+
+	// Produces the full module output; only called when the cache generation has changed
+	virtual Future<RangeResult> getRangeUncached(ReadYourWritesTransaction* ryw,
+	                                             KeyRangeRef kr,
+	                                             GetRangeLimits limitsHint) const = 0;
+
+	// Identifies the contents the cache was built from; a changed value discards the cache
+	virtual uint64_t cacheGeneration(ReadYourWritesTransaction* ryw) const = 0;
+
+	ACTOR static Future<RangeResult> getRangeCachedActor(const SpecialKeyRangeCachedImpl* impl,
+	                                                     ReadYourWritesTransaction* ryw,
+	                                                     KeyRangeRef kr,
+	                                                     GetRangeLimits limits) {
+		ASSERT(impl->getKeyRange().contains(kr));
+		state uint64_t generation = impl->cacheGeneration(ryw);
+		if (!impl->cachedResult.present() || generation != impl->cachedGeneration) {
+			// For simplicity, every time the cache is refreshed we read the whole range
+			RangeResult result_ = wait(impl->getRangeUncached(ryw, impl->getKeyRange(), limits));
+			impl->cachedResult = result_;
+			impl->cachedGeneration = generation;
+		}
+		const auto& allResults = impl->cachedResult.get();
+		int start = 0, end = allResults.size();
+		while (start < allResults.size() && allResults[start].key < kr.begin)
+			++start;
+		while (end > 0 && allResults[end - 1].key >= kr.end)
+			--end;
+		if (start < end) {
+			// Slices reference the retained arena rather than copying it; replaced caches stay
+			// alive until the last outstanding result referencing them is destroyed
+			RangeResult result = RangeResultRef(allResults.slice(start, end), false);
+			result.arena().dependsOn(allResults.arena());
+			return result;
+		} else
+			return RangeResult();
+	}
+
+	// mutable so that the const read path can refresh them; public so that the actor above can
+	// reach them from its generated state class
+	mutable Optional<RangeResult> cachedResult;
+	mutable uint64_t cachedGeneration = 0;
+};
+
 class SpecialKeySpace {
 public:
 	enum class MODULE {
@@ -177,6 +233,7 @@ public:
 		TESTONLY, // only used by correctness tests
 		TRACING, // Distributed tracing options
 		TRANSACTION, // transaction related info, conflicting keys, read/write conflict range
+		TRANSACTIONPROFILE, // sampled transaction profiles retained by this client
 		STATUSJSON,
 		UNKNOWN, // default value for all unregistered range
 		WORKERINTERFACE,
@@ -319,9 +376,27 @@ public:
 	                             GetRangeLimits limitsHint) const override;
 };
 
-class DDStatsRangeImpl : public SpecialKeyRangeAsyncImpl {
+class DDStatsRangeImpl : public SpecialKeyRangeCachedImpl {
 public:
 	explicit DDStatsRangeImpl(KeyRangeRef kr);
+	Future<RangeResult> getRangeUncached(ReadYourWritesTransaction* ryw,
+	                                     KeyRangeRef kr,
+	                                     GetRangeLimits limitsHint) const override;
+	uint64_t cacheGeneration(ReadYourWritesTransaction* ryw) const override;
+};
+
+class ShardCountsImpl : public SpecialKeyRangeCachedImpl {
+public:
+	explicit ShardCountsImpl(KeyRangeRef kr);
+	Future<RangeResult> getRangeUncached(ReadYourWritesTransaction* ryw,
+	                                     KeyRangeRef kr,
+	                                     GetRangeLimits limitsHint) const override;
+	uint64_t cacheGeneration(ReadYourWritesTransaction* ryw) const override;
+};
+
+class HotKeyMetricsImpl : public SpecialKeyRangeReadImpl {
+public:
+	explicit HotKeyMetricsImpl(KeyRangeRef kr);
 	Future<RangeResult> getRange(ReadYourWritesTransaction* ryw,
 	                             KeyRangeRef kr,
 	                             GetRangeLimits limitsHint) const override;
@@ -515,6 +590,16 @@ public:
 	                             GetRangeLimits limitsHint) const override;
 };
 
+// Exposes the ring of sampled transaction profiles held by the local DatabaseContext. Keys are
+// <seq>/<identifier>, values are the serialized FdbClientLogEvents chunk of one sampled transaction.
+class TransactionProfileRingImpl : public SpecialKeyRangeReadImpl {
+public:
+	explicit TransactionProfileRingImpl(KeyRangeRef kr);
+	Future<RangeResult> getRange(ReadYourWritesTransaction* ryw,
+	                             KeyRangeRef kr,
+	                             GetRangeLimits limitsHint) const override;
+};
+
 class ActorProfilerConf : public SpecialKeyRangeRWImpl {
 	bool didWrite = false;
 	std::map<std::string, std::string> config;
@@ -31,6 +31,8 @@ enum CheckpointFormat {
 	RocksDBColumnFamily = 1,
 	// For RocksDB, checkpoint generated via rocksdb::Checkpoint::CreateCheckpoint().
 	RocksDB = 2,
+	// For Redwood, a physical copy of the pager file taken at a commit boundary.
+	RedwoodV1 = 3,
 };
 
 // Metadata of a FDB checkpoint.
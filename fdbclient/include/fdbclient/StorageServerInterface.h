@@ -68,6 +68,8 @@ struct StorageServerInterface {
 
 	PublicRequestStream<struct GetValueRequest> getValue;
 	PublicRequestStream<struct GetKeyRequest> getKey;
+	PublicRequestStream<struct GetMultipleKeysRequest> getMultipleKeys;
+	PublicRequestStream<struct GetMultipleValuesRequest> getMultipleValues;
 
 	// Throws a wrong_shard_server if the keys in the request or result depend on data outside this server OR if a large
 	// selector offset prevents all data from being read in one range read
@@ -83,6 +85,7 @@ struct StorageServerInterface {
 
 	RequestStream<ReplyPromise<KeyValueStoreType>> getKeyValueStoreType;
 	PublicRequestStream<struct WatchValueRequest> watchValue;
+	PublicRequestStream<struct WatchValuesRequest> watchValues;
 	RequestStream<struct ReadHotSubRangeRequest> getReadHotRanges;
 	RequestStream<struct SplitRangeRequest> getRangeSplitPoints;
 	PublicRequestStream<struct GetKeyValuesStreamRequest> getKeyValuesStream;
@@ -93,6 +96,7 @@ struct StorageServerInterface {
 	RequestStream<struct GetCheckpointRequest> checkpoint;
 	RequestStream<struct FetchCheckpointRequest> fetchCheckpoint;
 	RequestStream<struct FetchCheckpointKeyValuesRequest> fetchCheckpointKeyValues;
+	RequestStream<struct GetHotKeysRequest> getHotKeys;
 
 private:
 	bool acceptingRequests;
@@ -163,6 +167,13 @@ public:
 				    RequestStream<struct FetchCheckpointRequest>(getValue.getEndpoint().getAdjustedEndpoint(20));
 				fetchCheckpointKeyValues = RequestStream<struct FetchCheckpointKeyValuesRequest>(
 				    getValue.getEndpoint().getAdjustedEndpoint(21));
+				getMultipleKeys = PublicRequestStream<struct GetMultipleKeysRequest>(
+				    getValue.getEndpoint().getAdjustedEndpoint(22));
+				watchValues =
+				    PublicRequestStream<struct WatchValuesRequest>(getValue.getEndpoint().getAdjustedEndpoint(23));
+				getMultipleValues = PublicRequestStream<struct GetMultipleValuesRequest>(
+				    getValue.getEndpoint().getAdjustedEndpoint(24));
+				getHotKeys = RequestStream<struct GetHotKeysRequest>(getValue.getEndpoint().getAdjustedEndpoint(25));
 			}
 		} else {
 			ASSERT(Ar::isDeserializing);
@@ -213,6 +224,10 @@ public:
 		streams.push_back(checkpoint.getReceiver());
 		streams.push_back(fetchCheckpoint.getReceiver());
 		streams.push_back(fetchCheckpointKeyValues.getReceiver());
+		streams.push_back(getMultipleKeys.getReceiver(TaskPriority::LoadBalancedEndpoint));
+		streams.push_back(watchValues.getReceiver());
+		streams.push_back(getMultipleValues.getReceiver(TaskPriority::LoadBalancedEndpoint));
+		streams.push_back(getHotKeys.getReceiver());
 		FlowTransport::transport().addEndpoints(streams);
 	}
 };
@@ -288,6 +303,46 @@ struct GetValueRequest : TimedRequest {
 	}
 };
 
+struct GetMultipleValuesReply : public LoadBalancedReply {
+	constexpr static FileIdentifier file_identifier = 13073557;
+	Arena arena;
+	VectorRef<Optional<ValueRef>> values; // one entry per requested key, in request order
+
+	GetMultipleValuesReply() {}
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, LoadBalancedReply::penalty, LoadBalancedReply::error, values, arena);
+	}
+};
+
+// Reads a batch of keys at one version in a single round trip. Each key is read exactly as a
+// GetValueRequest would read it; any key outside this server's shards fails the whole request with
+// wrong_shard_server and the client regroups by shard.
+struct GetMultipleValuesRequest : TimedRequest {
+	constexpr static FileIdentifier file_identifier = 9584156;
+	SpanContext spanContext;
+	Arena arena;
+	TenantInfo tenantInfo;
+	VectorRef<KeyRef> keys;
+	Version version;
+	Optional<TagSet> tags;
+	Optional<UID> debugID;
+	ReplyPromise<GetMultipleValuesReply> reply;
+	VersionVector ssLatestCommitVersions; // includes the latest commit versions, as known
+	                                      // to this client, of all storage replicas that
+	                                      // serve the given keys
+
+	bool verify() const { return tenantInfo.isAuthorized(); }
+
+	GetMultipleValuesRequest() {}
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, keys, version, tags, debugID, reply, spanContext, tenantInfo, arena, ssLatestCommitVersions);
+	}
+};
+
 struct WatchValueReply {
 	constexpr static FileIdentifier file_identifier = 3;
 
@@ -333,6 +388,65 @@ struct WatchValueRequest {
 	}
 };
 
+struct WatchValuesStreamReply : public ReplyPromiseStreamReply {
+	constexpr static FileIdentifier file_identifier = 4982066;
+	int index; // position of the fired watch in WatchValuesRequest::entries
+	Version version;
+
+	WatchValuesStreamReply() : index(-1), version(invalidVersion) {}
+	WatchValuesStreamReply(int index, Version version) : index(index), version(version) {}
+
+	int expectedSize() const { return sizeof(WatchValuesStreamReply); }
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, ReplyPromiseStreamReply::acknowledgeToken, ReplyPromiseStreamReply::sequence, index, version);
+	}
+};
+
+struct WatchValuesEntryRef {
+	KeyRef key;
+	Optional<ValueRef> value; // the value the watching transaction read, as in WatchValueRequest
+	Version version;
+
+	WatchValuesEntryRef() : version(invalidVersion) {}
+	WatchValuesEntryRef(KeyRef key, Optional<ValueRef> value, Version version)
+	  : key(key), value(value), version(version) {}
+	WatchValuesEntryRef(Arena& arena, const WatchValuesEntryRef& r)
+	  : key(arena, r.key), value(arena, r.value), version(r.version) {}
+
+	int expectedSize() const { return key.expectedSize() + value.expectedSize(); }
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, key, value, version);
+	}
+};
+
+// Registers a batch of watches on one storage server with a single streaming request. Each entry is
+// handled exactly like an individual WatchValueRequest; the server sends one WatchValuesStreamReply
+// per entry as it fires and closes the stream with end_of_stream once every entry has fired, or
+// with timed_out when it deliberately times the whole batch out.
+struct WatchValuesRequest {
+	constexpr static FileIdentifier file_identifier = 14747734;
+	SpanContext spanContext;
+	Arena arena;
+	TenantInfo tenantInfo;
+	VectorRef<WatchValuesEntryRef> entries;
+	Optional<TagSet> tags;
+	Optional<UID> debugID;
+	ReplyPromiseStream<WatchValuesStreamReply> reply;
+
+	WatchValuesRequest() {}
+
+	bool verify() const { return tenantInfo.isAuthorized(); }
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, entries, tags, debugID, reply, spanContext, tenantInfo, arena);
+	}
+};
+
 struct GetKeyValuesReply : public LoadBalancedReply {
 	constexpr static FileIdentifier file_identifier = 1783066;
 	Arena arena;
@@ -566,6 +680,47 @@ struct GetKeyRequest : TimedRequest {
 	}
 };
 
+struct GetMultipleKeysReply : public LoadBalancedReply {
+	constexpr static FileIdentifier file_identifier = 10651417;
+	Arena arena;
+	VectorRef<KeySelectorRef> sels; // one updated selector per requested selector, in request order,
+	                                // with the same meaning as GetKeyReply::sel
+
+	GetMultipleKeysReply() {}
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, LoadBalancedReply::penalty, LoadBalancedReply::error, sels, arena);
+	}
+};
+
+// Resolves a batch of key selectors in one round trip. Each selector is resolved independently
+// against the shard containing its key; any selector whose key lies outside this server's shards
+// fails the whole request with wrong_shard_server, and selectors whose offsets cross a shard
+// boundary come back partially advanced, exactly like GetKeyRequest.
+struct GetMultipleKeysRequest : TimedRequest {
+	constexpr static FileIdentifier file_identifier = 12923749;
+	SpanContext spanContext;
+	Arena arena;
+	TenantInfo tenantInfo;
+	VectorRef<KeySelectorRef> sels;
+	Version version; // or latestVersion
+	Optional<TagSet> tags;
+	ReplyPromise<GetMultipleKeysReply> reply;
+	VersionVector ssLatestCommitVersions; // includes the latest commit versions, as known
+	                                      // to this client, of all storage replicas that
+	                                      // serve the given keys
+
+	bool verify() const { return tenantInfo.isAuthorized(); }
+
+	GetMultipleKeysRequest() {}
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, sels, version, tags, reply, spanContext, tenantInfo, arena, ssLatestCommitVersions);
+	}
+};
+
 struct GetShardStateReply {
 	constexpr static FileIdentifier file_identifier = 0;
 
@@ -786,6 +941,57 @@ struct ReadHotSubRangeRequest {
 	}
 };
 
+// A key from the storage server's hot key index, with its estimated read and write cost rates.
+// Should always be used inside a `Standalone`.
+struct HotKeyWithMetrics {
+	KeyRef key;
+	// Estimated read cost (in cost units, see READ_COST_BYTE_FACTOR) per second over the last interval
+	double readRate;
+	// Estimated write cost per second over the last interval
+	double writeRate;
+
+	HotKeyWithMetrics() : readRate(0), writeRate(0) {}
+	HotKeyWithMetrics(KeyRef const& key, double readRate, double writeRate)
+	  : key(key), readRate(readRate), writeRate(writeRate) {}
+
+	HotKeyWithMetrics(Arena& arena, const HotKeyWithMetrics& rhs)
+	  : key(arena, rhs.key), readRate(rhs.readRate), writeRate(rhs.writeRate) {}
+
+	int expectedSize() const { return key.expectedSize() + sizeof(readRate) + sizeof(writeRate); }
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, key, readRate, writeRate);
+	}
+};
+
+struct GetHotKeysReply {
+	constexpr static FileIdentifier file_identifier = 10465101;
+	Standalone<VectorRef<HotKeyWithMetrics>> hotKeys;
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, hotKeys);
+	}
+};
+
+struct GetHotKeysRequest {
+	constexpr static FileIdentifier file_identifier = 2922478;
+	Arena arena;
+	// Only hot keys within this range are returned, so that fanning the request out per shard does not
+	// report the same server-wide hot key from every shard on a server
+	KeyRangeRef keys;
+	ReplyPromise<GetHotKeysReply> reply;
+
+	GetHotKeysRequest() {}
+	GetHotKeysRequest(KeyRangeRef const& keys) : keys(arena, keys) {}
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, keys, reply, arena);
+	}
+};
+
 struct SplitRangeReply {
 	constexpr static FileIdentifier file_identifier = 11813134;
 	// If the given range can be divided, contains the split points.
@@ -1066,12 +1272,14 @@ struct GetStorageMetricsReply {
 	double bytesInputRate;
 	int64_t versionLag;
 	double lastUpdate;
+	double cpuUsage = 0; // process CPU utilization in percent, from SystemMonitor
+	double diskUsage = 0; // disk busyness in percent, from SystemMonitor
 
 	GetStorageMetricsReply() : bytesInputRate(0) {}
 
 	template <class Ar>
 	void serialize(Ar& ar) {
-		serializer(ar, load, available, capacity, bytesInputRate, versionLag, lastUpdate);
+		serializer(ar, load, available, capacity, bytesInputRate, versionLag, lastUpdate, cpuUsage, diskUsage);
 	}
 };
 
@@ -1113,6 +1321,9 @@ struct StorageQueuingMetricsReply {
 	double diskUsage;
 	double localRateLimit;
 	std::vector<TagInfo> busiestTags;
+	int64_t bytesSpilled = 0; // mutation backlog currently staged in the storage server's spill queue
+	int64_t compactionBytes = 0; // storage engine's estimate of its deferred compaction work
+	int64_t level0Files = 0; // files not yet compacted out of the storage engine's first LSM level
 
 	template <class Ar>
 	void serialize(Ar& ar) {
@@ -1127,7 +1338,10 @@ struct StorageQueuingMetricsReply {
 		           cpuUsage,
 		           diskUsage,
 		           localRateLimit,
-		           busiestTags);
+		           busiestTags,
+		           bytesSpilled,
+		           compactionBytes,
+		           level0Files);
 	}
 };
 
@@ -149,6 +149,8 @@ extern const ValueRef conflictingKeysTrue, conflictingKeysFalse;
 extern const KeyRangeRef writeConflictRangeKeysRange;
 extern const KeyRangeRef readConflictRangeKeysRange;
 extern const KeyRangeRef ddStatsRange;
+extern const KeyRangeRef hotKeyMetricsRange;
+extern const KeyRangeRef shardCountsRange;
 
 extern const KeyRef cacheKeysPrefix;
 
@@ -477,6 +479,7 @@ extern const KeyRangeRef fdbClientInfoPrefixRange;
 
 // Consistency Check settings
 extern const KeyRef fdbShouldConsistencyCheckBeSuspended;
+extern const KeyRef fdbConsistencyCheckProgressKey;
 
 // Request latency measurement key
 extern const KeyRef latencyBandConfigKey;
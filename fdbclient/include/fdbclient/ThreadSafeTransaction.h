@@ -135,6 +135,9 @@ public:
 	                                   bool reverse = false) override {
 		return getRange(firstGreaterOrEqual(keys.begin), firstGreaterOrEqual(keys.end), limits, snapshot, reverse);
 	}
+	Reference<ITransactionRangeStream> getRangeStream(const KeySelectorRef& begin,
+	                                                  const KeySelectorRef& end,
+	                                                  bool snapshot = false) override;
 	ThreadFuture<MappedRangeResult> getMappedRange(const KeySelectorRef& begin,
 	                                               const KeySelectorRef& end,
 	                                               const StringRef& mapper,
@@ -199,6 +202,39 @@ private:
 	std::shared_ptr<std::atomic_bool> initialized;
 };
 
+// Adapts the main-thread push stream produced by ISingleThreadTransaction::getRangeStream into
+// the pull-based ITransactionRangeStream interface used across threads. Fragments buffered by the
+// reader on the main thread are handed out one onMainThread hop at a time.
+class ThreadSafeTransactionRangeStream final : public ITransactionRangeStream,
+                                               public ThreadSafeReferenceCounted<ThreadSafeTransactionRangeStream>,
+                                               NonCopyable {
+public:
+	ThreadSafeTransactionRangeStream(Reference<ThreadSafeTransaction> owner,
+	                                 ISingleThreadTransaction* tr,
+	                                 const KeySelectorRef& begin,
+	                                 const KeySelectorRef& end,
+	                                 bool snapshot);
+	~ThreadSafeTransactionRangeStream() override;
+
+	ThreadFuture<RangeResult> nextFragment() override;
+	void cancel() override;
+
+	void addref() override { ThreadSafeReferenceCounted<ThreadSafeTransactionRangeStream>::addref(); }
+	void delref() override { ThreadSafeReferenceCounted<ThreadSafeTransactionRangeStream>::delref(); }
+
+private:
+	// Created and destroyed on the main thread; holds the push side of the stream
+	struct StreamState {
+		PromiseStream<Standalone<RangeResultRef>> results;
+		Future<Void> reader;
+	};
+
+	// Keeps the transaction (and therefore the ISingleThreadTransaction) alive for as long as the
+	// stream handle exists
+	Reference<ThreadSafeTransaction> owner;
+	StreamState* state;
+};
+
 // An implementation of IClientApi that serializes operations onto the network thread and interacts with the lower-level
 // client APIs exposed by NativeAPI and ReadYourWrites.
 class ThreadSafeApi : public IClientApi, ThreadSafeReferenceCounted<ThreadSafeApi> {
@@ -112,6 +112,26 @@ public:
 		invalidateCachedEncodedSize();
 	}
 
+	// Removes entries whose commit version is at or below the given version, bounding the vector's
+	// growth as tags come and go across recoveries and role churn. Dropping an entry is always safe:
+	// readers treat a tag that is absent from the vector as being at maxVersion, which is the
+	// conservative (broadcast-equivalent) behavior, so a compacted-away tag only loses the
+	// optimization, never correctness.
+	void compact(Version before) {
+		bool modified = false;
+		for (auto iter = versions.begin(); iter != versions.end();) {
+			if (iter->second <= before) {
+				iter = versions.erase(iter);
+				modified = true;
+			} else {
+				iter++;
+			}
+		}
+		if (modified) {
+			invalidateCachedEncodedSize();
+		}
+	}
+
 	// @note this method, together with method applyDelta(), helps minimize
 	// the number of version vector entries that get sent from sequencer to
 	// grv proxy (and from grv proxy to client) on the read path.
@@ -254,7 +274,7 @@ public:
 
 		// Is the version vector empty?
 		if (utlCount == 0) {
-			return sizeof(size_t) + /* captures unique tag locality count (= 0, in this case) */
+			return sizeof(uint32_t) + /* captures unique tag locality count (= 0, in this case) */
 			       sizeof(Version); /* captures VersionVector::maxVersion */
 		}
 
@@ -272,12 +292,12 @@ public:
 			commitVersionSize = sizeof(uint64_t);
 		}
 
-		return sizeof(size_t) + /* unique tag locality count */
+		return sizeof(uint32_t) + /* unique tag locality count */
 		       utlCount * (sizeof(int8_t) + sizeof(uint16_t)) + // unique tag locality values and their run lengths
 		       sizeof(uint8_t) + /* number of bytes needed to serialize an individual (potentially compacted) tag id */
 		       sizeof(uint8_t) + /* number of bytes needed to serialize an individual commit version */
 		       sizeof(Version) + /* the lowest commit version in the version vector */
-		       sizeof(size_t) + /* number of <tagid, version> pairs */
+		       sizeof(uint32_t) + /* number of <tagid, version> pairs */
 		       this->size() * (tagIdSize + commitVersionSize) + /* encoded <tagid, version> pairs */
 		       sizeof(Version); /* VersionVector::maxVersion */
 	}
@@ -291,7 +311,7 @@ public:
 
 	// Copy RLE encoded tag locality values into the serialization buffer.
 	void serializeTagLocalities(size_t utlCount, uint8_t*& out) const {
-		serialize<size_t>(out, utlCount); // unique tag locality count
+		serialize<uint32_t>(out, (uint32_t)utlCount); // unique tag locality count
 
 		// Is the version vector empty?
 		if (utlCount == 0) {
@@ -331,7 +351,7 @@ public:
 		// The lowest commit version in the version vector.
 		serialize<Version>(out, minCommitVersion);
 		// The number of <tagId, commitVersion> pairs.
-		serialize<size_t>(out, (this->size()));
+		serialize<uint32_t>(out, (uint32_t)(this->size()));
 
 		for (const auto& [tag, version] : versions) {
 			// Serialize tag id.
@@ -393,7 +413,9 @@ public:
 		localityCounts.clear();
 
 		// Extract unique tag locality count from the buffer.
-		deserialize<size_t>(data, utlCount);
+		uint32_t count;
+		deserialize<uint32_t>(data, count);
+		utlCount = count;
 
 		if (utlCount == 0) {
 			return;
@@ -422,8 +444,8 @@ public:
 		Version minCommitVersion;
 		deserialize<Version>(data, minCommitVersion);
 
-		size_t pairCount; // number of serialized <tag id, commit version> pairs
-		deserialize<size_t>(data, pairCount);
+		uint32_t pairCount; // number of serialized <tag id, commit version> pairs
+		deserialize<uint32_t>(data, pairCount);
 
 		T tagId;
 		V versionDelta;
@@ -505,8 +527,6 @@ struct dynamic_size_traits<VersionVector> : std::true_type {
 		size_t encodedSize;
 		if (vv.isEncodedSizeCached()) {
 			encodedSize = vv.getCachedEncodedSize();
-			// @todo remove this assert before doing performance tests
-			ASSERT(encodedSize == vv.getEncodedSize());
 		} else {
 			encodedSize = vv.getEncodedSize();
 			const_cast<VersionVector&>(vv).setCachedEncodedSize(encodedSize);
@@ -516,8 +536,6 @@ struct dynamic_size_traits<VersionVector> : std::true_type {
 
 	template <class Context>
 	static void save(uint8_t* out, const VersionVector& vv, Context&) {
-		auto* begin = out;
-
 		size_t utlCount; // unique tag locality count
 		uint16_t maxTagId; // the highest tag id in the version vector
 		Version minCommitVersion; // the lowest commit version in the version vector (in "VersionVector::versions")
@@ -531,9 +549,6 @@ struct dynamic_size_traits<VersionVector> : std::true_type {
 
 		// Serialize vv::maxVersion.
 		vv.serialize<Version>(out, (vv.getMaxVersion()));
-
-		// @todo remove this assert before doing performance tests
-		ASSERT(out - begin == vv.getEncodedSize());
 	}
 
 	template <class Context>
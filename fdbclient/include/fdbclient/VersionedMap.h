@@ -115,6 +115,12 @@ public:
 		ASSERT(size_ < N);
 	}
 
+	void resize_with_bound(size_t sz, size_t bound) {
+		size_ = sz;
+		bound_sz_ = bound;
+		ASSERT(bound_sz_ <= size_ && size_ < N);
+	}
+
 	void push_back(PTree<T> const* node) {
 		entries_[size_++] = { node };
 		ASSERT(size_ < N);
@@ -209,6 +215,60 @@ void upper_bound(const Reference<PTree<T>>& p, Version at, const X& x, PTreeFing
 	upper_bound(p->child(!less, at), at, x, f);
 }
 
+// Searches for the upper bound of x starting from an existing finger (any root-to-node path in the
+// tree rooted at p, at version at) instead of from the root. The finger is first retracted to the
+// deepest node whose subtree the search for x would enter, and the search descends normally from
+// there. When successive searches target nearby keys the retraction inspects only a few nodes, so a
+// pass over k adjacent entries costs O(k + log n) comparisons in total rather than O(k log n); for
+// distant keys the cost is bounded by one extra walk over the old path.
+template <class T, class X>
+void upper_bound_hint(const Reference<PTree<T>>& p, Version at, const X& x, PTreeFinger<T>& f) {
+	if (!f.size() || f[0] != p.getPtr()) {
+		f.clear();
+		upper_bound(p, at, x, f);
+		return;
+	}
+	// The search for x visits a node iff its nearest left-turn ancestor is greater than x and its
+	// nearest right-turn ancestor is not; constraints from farther ancestors are implied by these
+	// two. Scan the old path bottom-up for the deepest node satisfying both.
+	size_t cand = f.size() - 1;
+	size_t bound = 0;
+	bool leftTurnChecked = false, rightTurnChecked = false;
+	for (size_t i = f.size() - 1; i >= 1 && !(leftTurnChecked && rightTurnChecked); i--) {
+		const PTree<T>* parent = f[i - 1];
+		if (parent->child(true, at).getPtr() == f[i]) {
+			if (!rightTurnChecked) {
+				if (x < parent->data) {
+					cand = i - 1;
+					leftTurnChecked = rightTurnChecked = false;
+					bound = 0;
+				} else {
+					rightTurnChecked = true;
+				}
+			}
+		} else {
+			if (!leftTurnChecked) {
+				if (x < parent->data) {
+					leftTurnChecked = true;
+					bound = i;
+				} else {
+					cand = i - 1;
+					leftTurnChecked = rightTurnChecked = false;
+					bound = 0;
+				}
+			}
+		}
+	}
+	const PTree<T>* node = f[cand];
+	f.resize_with_bound(cand, bound);
+	while (node) {
+		bool less = x < node->data;
+		f.push_for_bound(node, less);
+		node = node->child(!less, at).getPtr();
+	}
+	f.trim_to_bound();
+}
+
 template <class T, bool forward>
 void move(Version at, PTreeFinger<T>& f) {
 	ASSERT(f.size());
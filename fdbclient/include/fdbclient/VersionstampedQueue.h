@@ -0,0 +1,96 @@
+/*
+ * VersionstampedQueue.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FDBCLIENT_VERSIONSTAMPEDQUEUE_H
+#define FDBCLIENT_VERSIONSTAMPEDQUEUE_H
+
+#pragma once
+
+#include "fdbclient/ReadYourWrites.h"
+#include "fdbclient/Subspace.h"
+#include "fdbclient/Versionstamp.h"
+
+// A high-throughput queue built on versionstamped keys, replacing the ad hoc patterns layers tend to
+// reinvent on top of SET_VERSIONSTAMPED_KEY.
+//
+// Key layout: prefix + shard(1 byte) + versionstamp(10 bytes) + index(2 bytes, big endian)
+//
+// The trailing 12 bytes are exactly the tuple-layer versionstamp format, with the index as the user
+// version ordering entries enqueued by the same transaction. Enqueues are blind atomic writes to keys
+// that cannot exist yet, so producers never conflict with each other. Consumers rely on the fact that
+// a range read's conflict range only covers the keys it scanned: entries committed concurrently get
+// versionstamps greater than anything the consumer could have read, land beyond the scanned prefix,
+// and therefore do not abort the consumer. Heads are split across a small number of shards so that
+// multiple consumers can drain disjoint shards without touching the same keys.
+//
+// Entries are globally ordered by (versionstamp, index), i.e. by commit order; peek and pop merge the
+// shards back into that order.
+class VersionstampedQueue {
+public:
+	// An entry in commit order. version.getUserVersion() is the index assigned at enqueue time.
+	struct Entry {
+		Versionstamp version;
+		Value value;
+
+		Entry(Versionstamp version, Value value) : version(version), value(value) {}
+	};
+
+	explicit VersionstampedQueue(Subspace subspace, int shards = 16);
+
+	// Appends value to the queue as a blind write; adds no read or write conflicts with other
+	// producers or with consumers. Entries enqueued by the same transaction must use distinct
+	// indices; they are ordered by index within the transaction.
+	void enqueue(Reference<ReadYourWritesTransaction> tr, ValueRef value, uint16_t index = 0);
+
+	// Appends values in order with consecutive indices starting at firstIndex, all on one shard so
+	// the batch stays contiguous on disk.
+	void enqueueBatch(Reference<ReadYourWritesTransaction> tr,
+	                  VectorRef<ValueRef> values,
+	                  uint16_t firstIndex = 0);
+
+	// Returns up to limit entries in commit order without removing them
+	Future<std::vector<Entry>> peek(Reference<ReadYourWritesTransaction> tr, int limit);
+
+	// Removes and returns up to limit entries in commit order
+	Future<std::vector<Entry>> pop(Reference<ReadYourWritesTransaction> tr, int limit);
+
+	// As peek/pop, but restricted to one shard, for consumers that partition shards among themselves
+	Future<std::vector<Entry>> peekShard(Reference<ReadYourWritesTransaction> tr, int shard, int limit);
+	Future<std::vector<Entry>> popShard(Reference<ReadYourWritesTransaction> tr, int shard, int limit);
+
+	// True if no entries are visible at the transaction's read version
+	Future<bool> isEmpty(Reference<ReadYourWritesTransaction> tr);
+
+	int getShards() const { return shards; }
+
+	// Exposed for testing and benchmarks: the key written for an enqueue to shard, including the
+	// versionstamp placeholder and the trailing 4-byte offset consumed by SET_VERSIONSTAMPED_KEY
+	Key encodeKey(int shard, uint16_t index) const;
+	// Decodes the trailing 12 bytes of a committed queue key
+	Versionstamp decodeKey(KeyRef key) const;
+	// The key range holding one shard's entries
+	KeyRange shardRange(int shard) const;
+
+private:
+	Subspace subspace;
+	int shards;
+};
+
+#endif
@@ -460,15 +460,22 @@ public:
 	const char* delete_envvars;
 	bool deconfigured;
 	bool kill_on_configuration_change;
+	bool warm_standby;
 	uint64_t memory_rss;
 
+	/* Pre-forked child that has completed all post-fork setup and is parked just before execv(),
+	   waiting for its restart delay to arrive on the kick pipe. -1 when no standby exists. */
+	pid_t standby_pid;
+	int standby_kick_fd;
+
 	// one pair for each of stdout and stderr
 	int pipes[2][2];
 
-	Command() : argv(nullptr) {}
+	Command() : argv(nullptr), warm_standby(false), standby_pid(-1), standby_kick_fd(-1) {}
 	Command(const CSimpleIni& ini, std::string _section, ProcessID id, fdb_fd_set fds, int* maxfd)
 	  : fds(fds), argv(nullptr), section(_section), fork_retry_time(-1), quiet(false), delete_envvars(nullptr),
-	    deconfigured(false), kill_on_configuration_change(true), memory_rss(0) {
+	    deconfigured(false), kill_on_configuration_change(true), warm_standby(false), memory_rss(0), standby_pid(-1),
+	    standby_kick_fd(-1) {
 		char _ssection[strlen(section.c_str()) + 22];
 		snprintf(_ssection, strlen(section.c_str()) + 22, "%s", id.c_str());
 		ssection = _ssection;
@@ -569,6 +576,10 @@ public:
 			kill_on_configuration_change = false;
 		}
 
+		const char* ws = get_value_multi(ini, "warm-standby", ssection.c_str(), section.c_str(), "general", nullptr);
+		if (ws && !strcmp(ws, "true"))
+			warm_standby = true;
+
 		const char* binary = get_value_multi(ini, "command", ssection.c_str(), section.c_str(), "general", nullptr);
 		if (!binary) {
 			log_msg(SevError, "Unable to resolve command for %s\n", ssection.c_str());
@@ -605,7 +616,8 @@ public:
 			    isParameterNameEqual(i.pItem, "restart-delay-reset-interval") ||
 			    isParameterNameEqual(i.pItem, "disable-lifecycle-logging") ||
 			    isParameterNameEqual(i.pItem, "delete-envvars") ||
-			    isParameterNameEqual(i.pItem, "kill-on-configuration-change")) {
+			    isParameterNameEqual(i.pItem, "kill-on-configuration-change") ||
+			    isParameterNameEqual(i.pItem, "warm-standby")) {
 				continue;
 			}
 
@@ -639,6 +651,7 @@ public:
 		argv[i] = nullptr;
 	}
 	~Command() {
+		stop_standby();
 		for (int i = 0; i < commands.size(); ++i) {
 			free(argv[i]);
 		}
@@ -651,6 +664,15 @@ public:
 			}
 		}
 	}
+	/* Terminates any parked standby process. It will be reaped by the SIGCHLD loop. */
+	void stop_standby() {
+		if (standby_pid > 0) {
+			close(standby_kick_fd);
+			standby_kick_fd = -1;
+			kill(standby_pid, SIGTERM);
+			standby_pid = -1;
+		}
+	}
 	void update(const Command& other) {
 		quiet = other.quiet;
 		delete_envvars = other.delete_envvars;
@@ -660,6 +682,10 @@ public:
 		restart_delay_reset_interval = other.restart_delay_reset_interval;
 		deconfigured = other.deconfigured;
 		kill_on_configuration_change = other.kill_on_configuration_change;
+		warm_standby = other.warm_standby;
+		if (!warm_standby) {
+			stop_standby();
+		}
 
 		current_restart_delay = std::min<double>(max_restart_delay, current_restart_delay);
 		current_restart_delay = std::max<double>(initial_restart_delay, current_restart_delay);
@@ -729,10 +755,166 @@ uint64_t getRss(ProcessID id) {
 #endif
 }
 
+/* Post-fork setup shared by regular launches and warm standbys; only returns in the child.
+   All output in this function should be to stdout (for SevInfo messages) or stderr (for SevError messages);
+   using log_msg() or log_err() from the child will cause the logs to be written incorrectly. */
+void child_setup(Command* cmd, uid_t uid, gid_t gid, sigset_t* mask) {
+	/* remove signal handlers from parent */
+	signal(SIGHUP, SIG_DFL);
+	signal(SIGINT, SIG_DFL);
+	signal(SIGTERM, SIG_DFL);
+	signal(SIGPIPE, SIG_DFL);
+
+	dup2(cmd->pipes[0][1], fileno(stdout));
+	dup2(cmd->pipes[1][1], fileno(stderr));
+
+	if (cmd->delete_envvars != nullptr && std::strlen(cmd->delete_envvars) > 0) {
+		std::string vars(cmd->delete_envvars);
+		size_t start = 0;
+		do {
+			size_t bound = vars.find(" ", start);
+			std::string var = vars.substr(start, bound - start);
+			fprintf(stdout, "Deleting parent environment variable: \'%s\'\n", var.c_str());
+			fflush(stdout);
+			if (unsetenv(var.c_str())) {
+				fprintf(stderr,
+				        "Unable to remove parent environment variable: %s (unsetenv error %d: %s)\n",
+				        var.c_str(),
+				        errno,
+				        strerror(errno));
+				exit(1);
+			}
+			start = bound;
+			while (vars[start] == ' ')
+				start++;
+		} while (start <= vars.length());
+	}
+
+#ifdef __linux__
+	signal(SIGCHLD, SIG_DFL);
+
+	sigprocmask(SIG_SETMASK, mask, nullptr);
+
+	/* death of our parent raises SIGHUP */
+	prctl(PR_SET_PDEATHSIG, SIGHUP);
+	if (getppid() == 1) /* parent already died before prctl */
+		exit(0);
+#endif
+
+	if (getegid() != gid)
+		if (setgid(gid) != 0) {
+			fprintf(stderr, "Unable to set GID to %d (setgid error %d: %s)\n", gid, errno, strerror(errno));
+			exit(1);
+		}
+	if (geteuid() != uid)
+		if (setuid(uid) != 0) {
+			fprintf(stderr, "Unable to set UID to %d (setuid error %d: %s)\n", uid, errno, strerror(errno));
+			exit(1);
+		}
+
+#ifdef __linux__
+	/* death of our parent raises SIGHUP */
+	/* although not documented to this effect, setting uid/gid
+	   appears to reset PDEATHSIG */
+	prctl(PR_SET_PDEATHSIG, SIGHUP);
+	if (getppid() == 1) /* parent already died before prctl */
+		exit(0);
+#endif
+}
+
+/* Sleeps out any restart delay and then becomes the monitored process; never returns. */
+void child_exec(Command* cmd, int delay) {
+	if (delay)
+		while ((delay = sleep(delay)) > 0) {
+		}
+
+	if (!cmd->quiet) {
+		fprintf(stdout, "Launching %s (%d) for %s\n", cmd->argv[0], getpid(), cmd->ssection.c_str());
+		fflush(stdout);
+	}
+	execv(cmd->argv[0], (char* const*)cmd->argv);
+	fprintf(stderr,
+	        "Unable to launch %s for %s (execv error %d: %s)\n",
+	        cmd->argv[0],
+	        cmd->ssection.c_str(),
+	        errno,
+	        strerror(errno));
+	_exit(0);
+}
+
+/* Forks a warm standby for cmd: a child that has completed all launch setup and parks just before
+   execv(), so a later restart only has to write the restart delay to the kick pipe. A standby holds a
+   snapshot of cmd's argv and environment; it is stopped whenever the configuration changes (the Command
+   object is destroyed or updated) and respawned from the fresh state. Failure here is not an error --
+   the next restart simply takes the regular fork path. */
+void spawn_standby(Command* cmd, uid_t uid, gid_t gid, sigset_t* mask) {
+	if (!cmd->argv || !cmd->warm_standby || cmd->standby_pid > 0)
+		return;
+
+	int kick[2];
+	if (pipe(kick) != 0) {
+		log_err("pipe", errno, "Unable to construct kick pipe for %s standby", cmd->ssection.c_str());
+		return;
+	}
+
+	pid_t pid = fork();
+
+	if (pid < 0) {
+		log_err("fork", errno, "Unable to fork warm standby for %s", cmd->ssection.c_str());
+		close(kick[0]);
+		close(kick[1]);
+		return;
+	} else if (pid == 0) { /* we are the standby */
+		close(kick[1]);
+		child_setup(cmd, uid, gid, mask);
+
+		int delay = 0;
+		ssize_t n;
+		while ((n = read(kick[0], &delay, sizeof(delay))) < 0 && errno == EINTR)
+			;
+		if (n != sizeof(delay)) /* fdbmonitor shut down or discarded us */
+			_exit(0);
+		close(kick[0]);
+
+		child_exec(cmd, delay); /* never returns */
+	}
+
+	close(kick[0]);
+	cmd->standby_pid = pid;
+	cmd->standby_kick_fd = kick[1];
+	log_msg(SevInfo, "Spawned warm standby %d for %s\n", pid, cmd->ssection.c_str());
+}
+
 void start_process(Command* cmd, ProcessID id, uid_t uid, gid_t gid, int delay, sigset_t* mask) {
 	if (!cmd->argv)
 		return;
 
+	/* Promote the warm standby if one is parked: the forked and initialized child only needs its
+	   restart delay before it execs, skipping fork and setup on the recovery critical path. The write
+	   fails (EPIPE; SIGPIPE is ignored) if the standby died unannounced, in which case we fall through
+	   to a regular fork. */
+	if (cmd->standby_pid > 0) {
+		pid_t pid = cmd->standby_pid;
+		if (write(cmd->standby_kick_fd, &delay, sizeof(delay)) == sizeof(delay)) {
+			close(cmd->standby_kick_fd);
+			cmd->standby_pid = -1;
+			cmd->standby_kick_fd = -1;
+
+			cmd->last_start = timer() + delay;
+			cmd->fork_retry_time = -1;
+			pid_id[pid] = id;
+			id_pid[id] = pid;
+
+			log_msg(SevInfo, "Promoted warm standby %d for %s\n", pid, cmd->ssection.c_str());
+
+			/* park a fresh standby for the next restart */
+			spawn_standby(cmd, uid, gid, mask);
+			return;
+		}
+		log_msg(SevWarn, "Warm standby %d for %s is unusable, discarding it\n", pid, cmd->ssection.c_str());
+		cmd->stop_standby();
+	}
+
 	pid_t pid = fork();
 
 	if (pid < 0) { /* fork error */
@@ -747,91 +929,16 @@ void start_process(Command* cmd, ProcessID id, uid_t uid, gid_t gid, int delay,
 		        fork_delay);
 		return;
 	} else if (pid == 0) { /* we are the child */
-		/* remove signal handlers from parent */
-		signal(SIGHUP, SIG_DFL);
-		signal(SIGINT, SIG_DFL);
-		signal(SIGTERM, SIG_DFL);
-
-		/* All output in this block should be to stdout (for SevInfo messages) or stderr (for SevError messages) */
-		/* Using log_msg() or log_err() from the child will cause the logs to be written incorrectly */
-		dup2(cmd->pipes[0][1], fileno(stdout));
-		dup2(cmd->pipes[1][1], fileno(stderr));
-
-		if (cmd->delete_envvars != nullptr && std::strlen(cmd->delete_envvars) > 0) {
-			std::string vars(cmd->delete_envvars);
-			size_t start = 0;
-			do {
-				size_t bound = vars.find(" ", start);
-				std::string var = vars.substr(start, bound - start);
-				fprintf(stdout, "Deleting parent environment variable: \'%s\'\n", var.c_str());
-				fflush(stdout);
-				if (unsetenv(var.c_str())) {
-					fprintf(stderr,
-					        "Unable to remove parent environment variable: %s (unsetenv error %d: %s)\n",
-					        var.c_str(),
-					        errno,
-					        strerror(errno));
-					exit(1);
-				}
-				start = bound;
-				while (vars[start] == ' ')
-					start++;
-			} while (start <= vars.length());
-		}
-
-#ifdef __linux__
-		signal(SIGCHLD, SIG_DFL);
-
-		sigprocmask(SIG_SETMASK, mask, nullptr);
-
-		/* death of our parent raises SIGHUP */
-		prctl(PR_SET_PDEATHSIG, SIGHUP);
-		if (getppid() == 1) /* parent already died before prctl */
-			exit(0);
-#endif
-
-		if (delay)
-			while ((delay = sleep(delay)) > 0) {
-			}
-
-		if (getegid() != gid)
-			if (setgid(gid) != 0) {
-				fprintf(stderr, "Unable to set GID to %d (setgid error %d: %s)\n", gid, errno, strerror(errno));
-				exit(1);
-			}
-		if (geteuid() != uid)
-			if (setuid(uid) != 0) {
-				fprintf(stderr, "Unable to set UID to %d (setuid error %d: %s)\n", uid, errno, strerror(errno));
-				exit(1);
-			}
-
-#ifdef __linux__
-		/* death of our parent raises SIGHUP */
-		/* although not documented to this effect, setting uid/gid
-		   appears to reset PDEATHSIG */
-		prctl(PR_SET_PDEATHSIG, SIGHUP);
-		if (getppid() == 1) /* parent already died before prctl */
-			exit(0);
-#endif
-
-		if (!cmd->quiet) {
-			fprintf(stdout, "Launching %s (%d) for %s\n", cmd->argv[0], getpid(), cmd->ssection.c_str());
-			fflush(stdout);
-		}
-		execv(cmd->argv[0], (char* const*)cmd->argv);
-		fprintf(stderr,
-		        "Unable to launch %s for %s (execv error %d: %s)\n",
-		        cmd->argv[0],
-		        cmd->ssection.c_str(),
-		        errno,
-		        strerror(errno));
-		_exit(0);
+		child_setup(cmd, uid, gid, mask);
+		child_exec(cmd, delay); /* never returns */
 	}
 
 	cmd->last_start = timer() + delay;
 	cmd->fork_retry_time = -1;
 	pid_id[pid] = id;
 	id_pid[id] = pid;
+
+	spawn_standby(cmd, uid, gid, mask);
 }
 
 volatile int exit_signal = 0;
@@ -1500,6 +1607,9 @@ int main(int argc, char** argv) {
 	auto ign = write(lockfile_fd, pid_buf, strlen(pid_buf));
 	(void)ign;
 
+	/* writes to a dead warm standby's kick pipe must fail with EPIPE rather than kill us */
+	signal(SIGPIPE, SIG_IGN);
+
 #ifdef __linux__
 	/* attempt to do clean shutdown and remove lockfile when killed */
 	signal(SIGHUP, signal_handler);
@@ -1784,6 +1894,11 @@ int main(int argc, char** argv) {
 			case SIGTERM:
 				log_msg(SevWarn, "Received signal %d (%s), shutting down\n", exit_signal, strsignal(exit_signal));
 
+				/* Parked standbys never exit on their own; stop them so the wait() below can finish */
+				for (auto& i : id_command) {
+					i.second->stop_standby();
+				}
+
 				/* Unblock signals */
 				signal(SIGCHLD, SIG_IGN);
 				sigprocmask(SIG_SETMASK, &normal_mask, nullptr);
@@ -1901,6 +2016,22 @@ int main(int argc, char** argv) {
 					break;
 				}
 
+				if (!pid_id.count(pid)) {
+					/* A warm standby died while parked (or after being discarded); the next restart of
+					   its process falls back to a regular fork and respawns one */
+					for (auto& i : id_command) {
+						if (i.second->standby_pid == pid) {
+							log_process_msg(
+							    SevWarn, i.second->ssection.c_str(), "Warm standby %d exited while parked\n", pid);
+							close(i.second->standby_kick_fd);
+							i.second->standby_kick_fd = -1;
+							i.second->standby_pid = -1;
+							break;
+						}
+					}
+					continue;
+				}
+
 				ProcessID id = pid_id[pid];
 				Command* cmd = id_command[id].get();
 
@@ -38,8 +38,11 @@ EvictablePage::~EvictablePage() {
 			pageCache->pages.pop_back();
 		}
 	} else {
-		// remove it from the LRU
-		pageCache->lruPages.erase(EvictablePageCache::List::s_iterator_to(*this));
+		// remove it from the LRU, stepping the SIEVE hand off this page first if it points here
+		auto it = EvictablePageCache::List::s_iterator_to(*this);
+		if (EvictablePageCache::SIEVE == pageCache->cacheEvictionType && pageCache->sieveHand == it)
+			++pageCache->sieveHand;
+		pageCache->lruPages.erase(it);
 	}
 }
 
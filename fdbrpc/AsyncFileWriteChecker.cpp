@@ -22,3 +22,4 @@
 
 Optional<int> AsyncFileWriteChecker::checksumHistoryBudget = {};
 int AsyncFileWriteChecker::checksumHistoryPageSize = 4096;
+int AsyncFileWriteChecker::checksumHistoryLeafEntries = 4096;
@@ -374,6 +374,7 @@ ACTOR Future<Void> pingLatencyLogger(TransportData* self) {
 				    .detail("Count", peer->pingLatencies.getPopulationSize())
 				    .detail("BytesReceived", peer->bytesReceived - peer->lastLoggedBytesReceived)
 				    .detail("BytesSent", peer->bytesSent - peer->lastLoggedBytesSent)
+				    .detail("SameMachine", peer->destination.ip == self->localAddresses.getAddressList().address.ip)
 				    .detail("TimeoutCount", peer->timeoutCount)
 				    .detail("ConnectOutgoingCount", peer->connectOutgoingCount)
 				    .detail("ConnectIncomingCount", peer->connectIncomingCount)
@@ -494,6 +495,7 @@ static ReliablePacket* sendPacket(TransportData* self,
 
 ACTOR Future<Void> connectionMonitor(Reference<Peer> peer) {
 	state Endpoint remotePingEndpoint({ peer->destination }, Endpoint::wellKnownToken(WLTOKEN_PING_PACKET));
+	state double lastPingTime = 0;
 	loop {
 		if (!FlowTransport::isClient() && !peer->destination.isPublic() && peer->compatible) {
 			// Don't send ping messages to clients unless necessary. Instead monitor incoming client pings.
@@ -533,10 +535,21 @@ ACTOR Future<Void> connectionMonitor(Reference<Peer> peer) {
 			}
 		}
 
+		state int64_t bytesBeforeLoopDelay = peer->bytesReceived;
 		wait(delayJittered(FLOW_KNOBS->CONNECTION_MONITOR_LOOP_TIME, TaskPriority::ReadSocket));
 
+		if (FLOW_KNOBS->CONNECTION_MONITOR_BUSY_PING_INTERVAL > 0 && peer->bytesReceived > bytesBeforeLoopDelay &&
+		    now() - lastPingTime < FLOW_KNOBS->CONNECTION_MONITOR_BUSY_PING_INTERVAL) {
+			// Data received from the peer in the last loop period already demonstrates liveness (the
+			// ping timeout below only fails the connection when nothing at all is received), so on
+			// busy connections the explicit heartbeat is throttled to one per BUSY_PING_INTERVAL and
+			// liveness piggybacks on the data packets. Idle connections still ping every loop.
+			continue;
+		}
+
 		// TODO: Stop monitoring and close the connection with no onDisconnect requests outstanding
 		state PingRequest pingRequest;
+		lastPingTime = now();
 		FlowTransport::transport().sendUnreliable(SerializeSource<PingRequest>(pingRequest), remotePingEndpoint, true);
 		state int64_t startingBytes = peer->bytesReceived;
 		state int timeouts = 0;
@@ -577,9 +590,17 @@ ACTOR Future<Void> connectionWriter(Reference<Peer> self, Reference<IConnection>
 	state double lastWriteTime = now();
 	loop {
 		// wait( delay(0, TaskPriority::WriteSocket) );
-		wait(delayJittered(
-		    std::max<double>(FLOW_KNOBS->MIN_COALESCE_DELAY, FLOW_KNOBS->MAX_COALESCE_DELAY - (now() - lastWriteTime)),
-		    TaskPriority::WriteSocket));
+		if (FLOW_KNOBS->COALESCE_IDLE_THRESHOLD > 0 &&
+		    now() - lastWriteTime >= FLOW_KNOBS->COALESCE_IDLE_THRESHOLD) {
+			// The peer has been idle, so nothing else is likely to arrive within the coalescing
+			// window; send without the microbatch delay.  Under steady traffic lastWriteTime is
+			// recent and the delay below batches everything that arrives within the window.
+			wait(yield(TaskPriority::WriteSocket));
+		} else {
+			wait(delayJittered(std::max<double>(FLOW_KNOBS->MIN_COALESCE_DELAY,
+			                                    FLOW_KNOBS->MAX_COALESCE_DELAY - (now() - lastWriteTime)),
+			                   TaskPriority::WriteSocket));
+		}
 		// wait( delay(500e-6, TaskPriority::WriteSocket) );
 		// wait( yield(TaskPriority::WriteSocket) );
 
@@ -1699,10 +1720,10 @@ static void sendLocal(TransportData* self, ISerializeSource const& what, const E
 	CODE_PROBE(true, "\"Loopback\" delivery");
 	// SOMEDAY: Would it be better to avoid (de)serialization by doing this check in flow?
 
-	Standalone<StringRef> copy;
 	ObjectWriter wr(AssumeVersion(g_network->protocolVersion()));
 	what.serializeObjectWriter(wr);
-	copy = wr.toStringRef();
+	// toString() keeps a reference to the writer's arena rather than copying the message bytes
+	Standalone<StringRef> copy = wr.toString();
 #if VALGRIND
 	VALGRIND_CHECK_MEM_IS_DEFINED(copy.begin(), copy.size());
 #endif
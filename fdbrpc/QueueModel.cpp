@@ -21,8 +21,30 @@
 #include "fdbrpc/QueueModel.h"
 #include "fdbrpc/LoadBalance.h"
 
+// Decays `d.penalty` toward the neutral value of 1.0 based on the time since
+// it was last set or decayed. A penalized server receives few or no requests,
+// so without decay the penalty reported while it was overloaded would keep it
+// out of the replica rotation long after it has recovered.
+static void decayPenalty(QueueData& d) {
+	if (d.penalty > 1.0 && FLOW_KNOBS->QUEUE_MODEL_PENALTY_DECAY_TIME > 0) {
+		d.penalty =
+		    1.0 + (d.penalty - 1.0) * exp((d.penaltyUpdateTime - now()) / FLOW_KNOBS->QUEUE_MODEL_PENALTY_DECAY_TIME);
+	}
+	d.penaltyUpdateTime = now();
+}
+
+std::shared_ptr<QueueModel::EndpointData> QueueModel::makeEndpointData() {
+	// Sharing is disabled in simulation so that simulated processes cannot
+	// observe each other's measurements through the thread local map.
+	if (FLOW_KNOBS->QUEUE_MODEL_SHARED_STATE && g_network && !g_network->isSimulated()) {
+		static thread_local std::shared_ptr<EndpointData> sharedData = std::make_shared<EndpointData>();
+		return sharedData;
+	}
+	return std::make_shared<EndpointData>();
+}
+
 void QueueModel::endRequest(uint64_t id, double latency, double penalty, double delta, bool clean, bool futureVersion) {
-	auto& d = data[id];
+	auto& d = (*data)[id];
 
 	// Remove the penalty added when starting the request.
 	d.smoothOutstanding.addDelta(-delta);
@@ -47,31 +69,45 @@ void QueueModel::endRequest(uint64_t id, double latency, double penalty, double
 
 	if (penalty > 0) {
 		d.penalty = penalty;
+		d.penaltyUpdateTime = now();
 	}
 }
 
 QueueData const& QueueModel::getMeasurement(uint64_t id) {
-	return data[id]; // return smoothed penalty
+	auto& d = (*data)[id];
+	decayPenalty(d);
+
+	// Fast-recovery probe: periodically report a penalized server as healthy
+	// so that one request reaches it. If the server is still overloaded, its
+	// reply restores the penalty through `endRequest`; if it has recovered,
+	// it rejoins the rotation immediately instead of waiting for full decay.
+	if (d.penalty > 1.001 && now() > d.nextProbeTime) {
+		d.nextProbeTime = now() + FLOW_KNOBS->QUEUE_MODEL_PROBE_INTERVAL;
+		d.penalty = 1.0;
+	}
+
+	return d; // return smoothed penalty
 }
 
 double QueueModel::addRequest(uint64_t id) {
-	auto& d = data[id];
+	auto& d = (*data)[id];
+	decayPenalty(d);
 	d.smoothOutstanding.addDelta(d.penalty);
 	return d.penalty;
 }
 
 void QueueModel::updateTssEndpoint(uint64_t endpointId, const TSSEndpointData& tssData) {
-	auto& d = data[endpointId];
+	auto& d = (*data)[endpointId];
 	d.tssData = tssData;
 }
 
 void QueueModel::removeTssEndpoint(uint64_t endpointId) {
-	auto& d = data[endpointId];
+	auto& d = (*data)[endpointId];
 	d.tssData = Optional<TSSEndpointData>();
 }
 
 Optional<TSSEndpointData> QueueModel::getTssData(uint64_t id) {
-	return data[id].tssData;
+	return (*data)[id].tssData;
 }
 
 Optional<LoadBalancedReply> getLoadBalancedReply(const LoadBalancedReply* reply) {
@@ -81,6 +81,26 @@ void Counter::clear() {
 	metric = 0;
 }
 
+AtomicCounter::AtomicCounter(std::string const& name, CounterCollection& collection)
+  : name(name), value(0), interval_start_value(0), interval_start(0) {
+	collection.counters.push_back(this);
+}
+
+double AtomicCounter::getRate() const {
+	double elapsed = now() - interval_start;
+	return elapsed > 0 ? (getValue() - interval_start_value) / elapsed : 0;
+}
+
+void AtomicCounter::resetInterval() {
+	interval_start_value = getValue();
+	interval_start = now();
+}
+
+void AtomicCounter::clear() {
+	value.store(0, std::memory_order_relaxed);
+	resetInterval();
+}
+
 void CounterCollection::logToTraceEvent(TraceEvent& te) const {
 	for (ICounter* c : counters) {
 		te.detail(c->getName().c_str(), c);
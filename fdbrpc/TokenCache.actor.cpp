@@ -130,11 +130,22 @@ struct TokenCacheImpl {
 		double expirationTime = 0.0;
 	};
 
+	// Tokens that recently failed to parse or verify. Signature verification runs on the
+	// network thread, so a client replaying a bad token would otherwise cost an ES256
+	// verification per request; failures are remembered for TOKEN_NEGATIVE_CACHE_TTL so a
+	// key registered after a failure is picked up eventually.
+	struct NegativeEntry {
+		Arena arena;
+		double expirationTime = 0.0;
+	};
+
 	LRUCache<StringRef, CacheEntry> cache;
-	TokenCacheImpl() : cache(FLOW_KNOBS->TOKEN_CACHE_SIZE) {}
+	LRUCache<StringRef, NegativeEntry> negativeCache;
+	TokenCacheImpl() : cache(FLOW_KNOBS->TOKEN_CACHE_SIZE), negativeCache(FLOW_KNOBS->TOKEN_NEGATIVE_CACHE_SIZE) {}
 
 	bool validate(TenantNameRef tenant, StringRef token);
 	bool validateAndAdd(double currentTime, StringRef token, NetworkAddress const& peer);
+	void cacheFailure(double currentTime, StringRef token);
 };
 
 TokenCache::TokenCache() : impl(new TokenCacheImpl()) {}
@@ -161,6 +172,12 @@ bool TokenCache::validate(TenantNameRef name, StringRef token) {
 	    .detail("CurrentTime", currentTime)                                                                            \
 	    .detail("Token", token.toStringRef(arena).toStringView())
 
+void TokenCacheImpl::cacheFailure(double currentTime, StringRef token) {
+	NegativeEntry e;
+	e.expirationTime = currentTime + FLOW_KNOBS->TOKEN_NEGATIVE_CACHE_TTL;
+	negativeCache.insert(StringRef(e.arena, token), e);
+}
+
 bool TokenCacheImpl::validateAndAdd(double currentTime, StringRef token, NetworkAddress const& peer) {
 	Arena arena;
 	authz::jwt::TokenRef t;
@@ -170,16 +187,19 @@ bool TokenCacheImpl::validateAndAdd(double currentTime, StringRef token, Network
 		    .detail("From", peer)
 		    .detail("Reason", "ParseError")
 		    .detail("Token", token.toString());
+		cacheFailure(currentTime, token);
 		return false;
 	}
 	auto key = FlowTransport::transport().getPublicKeyByName(t.keyId);
 	if (!key.present()) {
 		CODE_PROBE(true, "Token referencing non-existing key");
 		TRACE_INVALID_PARSED_TOKEN("UnknownKey", t);
+		cacheFailure(currentTime, token);
 		return false;
 	} else if (!t.expiresAtUnixTime.present()) {
 		CODE_PROBE(true, "Token has no expiration time");
 		TRACE_INVALID_PARSED_TOKEN("NoExpirationTime", t);
+		cacheFailure(currentTime, token);
 		return false;
 	} else if (double(t.expiresAtUnixTime.get()) <= currentTime) {
 		CODE_PROBE(true, "Expired token");
@@ -188,6 +208,7 @@ bool TokenCacheImpl::validateAndAdd(double currentTime, StringRef token, Network
 	} else if (!t.notBeforeUnixTime.present()) {
 		CODE_PROBE(true, "Token has no not-before field");
 		TRACE_INVALID_PARSED_TOKEN("NoNotBefore", t);
+		cacheFailure(currentTime, token);
 		return false;
 	} else if (double(t.notBeforeUnixTime.get()) > currentTime) {
 		CODE_PROBE(true, "Tokens not-before is in the future");
@@ -196,10 +217,12 @@ bool TokenCacheImpl::validateAndAdd(double currentTime, StringRef token, Network
 	} else if (!t.tenants.present()) {
 		CODE_PROBE(true, "Token with no tenants");
 		TRACE_INVALID_PARSED_TOKEN("NoTenants", t);
+		cacheFailure(currentTime, token);
 		return false;
 	} else if (!authz::jwt::verifyToken(token, key.get())) {
 		CODE_PROBE(true, "Token with invalid signature");
 		TRACE_INVALID_PARSED_TOKEN("InvalidSignature", t);
+		cacheFailure(currentTime, token);
 		return false;
 	} else {
 		CacheEntry c;
@@ -219,6 +242,12 @@ bool TokenCacheImpl::validate(TenantNameRef name, StringRef token) {
 	double currentTime = g_network->timer();
 
 	if (!cachedEntry.present()) {
+		auto failedEntry = negativeCache.get(token);
+		if (failedEntry.present() && failedEntry.get()->expirationTime > currentTime) {
+			CODE_PROBE(true, "Rejected token found in negative cache");
+			TraceEvent(SevWarn, "InvalidToken").suppressFor(5.0).detail("From", peer).detail("Reason", "InvalidInCache");
+			return false;
+		}
 		if (validateAndAdd(currentTime, token, peer)) {
 			cachedEntry = cache.get(token);
 		} else {
@@ -321,6 +350,11 @@ TEST_CASE("/fdbrpc/authz/TokenCache/BadTokens") {
 		fmt::print("Unexpected successful validation of unparseable token\n");
 		ASSERT(false);
 	}
+	// a repeat of the same bad token must be rejected from the negative cache as well
+	if (TokenCache::instance().validate("TenantNameDontMatterHere2"_sr, "////.////.////"_sr)) {
+		fmt::print("Unexpected successful validation of cached unparseable token\n");
+		ASSERT(false);
+	}
 	fmt::print("TEST OK\n");
 	return Void();
 }
@@ -42,6 +42,7 @@ namespace bi = boost::intrusive;
 struct EvictablePage {
 	void* data;
 	int index;
+	bool visited = false; // SIEVE eviction's reference bit, set on hit and cleared by the scan hand
 	class Reference<struct EvictablePageCache> pageCache;
 	bi::list_member_hook<> member_hook;
 
@@ -55,24 +56,27 @@ struct EvictablePage {
 struct EvictablePageCache : ReferenceCounted<EvictablePageCache> {
 	using List =
 	    bi::list<EvictablePage, bi::member_hook<EvictablePage, bi::list_member_hook<>, &EvictablePage::member_hook>>;
-	enum CacheEvictionType { RANDOM = 0, LRU = 1 };
+	enum CacheEvictionType { RANDOM = 0, LRU = 1, SIEVE = 2 };
 
 	static CacheEvictionType evictionPolicyStringToEnum(const std::string& policy) {
 		std::string cep = policy;
 		std::transform(cep.begin(), cep.end(), cep.begin(), ::tolower);
-		if (cep != "random" && cep != "lru")
+		if (cep != "random" && cep != "lru" && cep != "sieve")
 			throw invalid_cache_eviction_policy();
 
 		if (cep == "random")
 			return RANDOM;
+		if (cep == "sieve")
+			return SIEVE;
 		return LRU;
 	}
 
-	EvictablePageCache() : pageSize(0), maxPages(0), cacheEvictionType(RANDOM) {}
+	EvictablePageCache() : pageSize(0), maxPages(0), cacheEvictionType(RANDOM) { sieveHand = lruPages.end(); }
 
 	explicit EvictablePageCache(int pageSize, int64_t maxSize)
 	  : pageSize(pageSize), maxPages(maxSize / pageSize),
 	    cacheEvictionType(evictionPolicyStringToEnum(FLOW_KNOBS->CACHE_EVICTION_POLICY)) {
+		sieveHand = lruPages.end();
 		cacheEvictions.init(LiteralStringRef("EvictablePageCache.CacheEvictions"));
 	}
 
@@ -91,10 +95,13 @@ struct EvictablePageCache : ReferenceCounted<EvictablePageCache> {
 	}
 
 	void updateHit(EvictablePage* page) {
-		if (RANDOM != cacheEvictionType) {
+		if (LRU == cacheEvictionType) {
 			// on a hit, update page's location in the LRU so that it's most recent (tail)
 			lruPages.erase(List::s_iterator_to(*page));
 			lruPages.push_back(*page);
+		} else if (SIEVE == cacheEvictionType) {
+			// SIEVE never moves pages on a hit; the scan hand in try_evict observes this bit
+			page->visited = true;
 		}
 	}
 
@@ -110,8 +117,34 @@ struct EvictablePageCache : ReferenceCounted<EvictablePageCache> {
 					}
 				}
 			}
+		} else if (SIEVE == cacheEvictionType) {
+			if (lruPages.size() >= (uint64_t)maxPages) {
+				// sweep the hand from oldest (head) toward newest (tail), giving pages hit since the
+				// last sweep a second chance by clearing their visited bit instead of evicting them
+				for (int i = 0; i < FLOW_KNOBS->MAX_EVICT_ATTEMPTS;
+				     i++) { // If we don't manage to evict anything, just go ahead and exceed the cache limit
+					if (sieveHand == lruPages.end()) {
+						sieveHand = lruPages.begin();
+						if (sieveHand == lruPages.end())
+							break;
+					}
+					if (sieveHand->visited) {
+						sieveHand->visited = false;
+						++sieveHand;
+					} else {
+						// advance past the candidate first; successful eviction deletes the page,
+						// which unlinks it from lruPages
+						EvictablePage* candidate = &*sieveHand;
+						++sieveHand;
+						if (candidate->evict()) {
+							++cacheEvictions;
+							break;
+						}
+					}
+				}
+			}
 		} else {
-			// For now, LRU is the only other CACHE_EVICTION option
+			// LRU
 			if (lruPages.size() >= (uint64_t)maxPages) {
 				int i = 0;
 				// try the least recently used pages first (starting at head of the LRU list)
@@ -128,6 +161,7 @@ struct EvictablePageCache : ReferenceCounted<EvictablePageCache> {
 
 	std::vector<EvictablePage*> pages;
 	List lruPages;
+	List::iterator sieveHand; // position of SIEVE's scan hand in lruPages; kept valid by ~EvictablePage
 	int pageSize;
 	int64_t maxPages;
 	Int64MetricHandle cacheEvictions;
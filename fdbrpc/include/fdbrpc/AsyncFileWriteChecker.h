@@ -18,6 +18,8 @@
  * limitations under the License.
  */
 
+#include <memory>
+
 #include "flow/IAsyncFile.h"
 #include "crc32/crc32c.h"
 
@@ -51,11 +53,16 @@ public:
 
 	Future<Void> truncate(int64_t size) override {
 		return map(m_f->truncate(size), [=](Void r) {
-			// Truncate the page checksum history if it is in use
-			if ((size / checksumHistoryPageSize) < checksumHistory.size()) {
-				int oldCapacity = checksumHistory.capacity();
-				checksumHistory.resize(size / checksumHistoryPageSize);
-				checksumHistoryBudget.get() -= (checksumHistory.capacity() - oldCapacity);
+			// Free page checksum history leaves that are entirely beyond the new size
+			int64_t leafCount =
+			    (size / checksumHistoryPageSize + checksumHistoryLeafEntries - 1) / checksumHistoryLeafEntries;
+			for (int64_t i = leafCount; i < (int64_t)checksumHistory.size(); ++i) {
+				if (checksumHistory[i]) {
+					checksumHistoryBudget.get() += checksumHistoryLeafEntries;
+				}
+			}
+			if (leafCount < (int64_t)checksumHistory.size()) {
+				checksumHistory.resize(leafCount);
 			}
 			return r;
 		});
@@ -75,13 +82,15 @@ public:
 		if (!checksumHistoryBudget.present()) {
 			checksumHistoryBudget = FLOW_KNOBS->PAGE_WRITE_CHECKSUM_HISTORY;
 		}
-
-		// Adjust the budget by the initial capacity of history, which should be 0 but maybe not for some
-		// implementations.
-		checksumHistoryBudget.get() -= checksumHistory.capacity();
 	}
 
-	~AsyncFileWriteChecker() override { checksumHistoryBudget.get() += checksumHistory.capacity(); }
+	~AsyncFileWriteChecker() override {
+		for (auto& leaf : checksumHistory) {
+			if (leaf) {
+				checksumHistoryBudget.get() += checksumHistoryLeafEntries;
+			}
+		}
+	}
 
 private:
 	Reference<IAsyncFile> m_f;
@@ -92,15 +101,48 @@ private:
 		uint32_t timestamp;
 	};
 
-	std::vector<WriteInfo> checksumHistory;
+	// Checksum history as a two-level page table.  Leaves are allocated lazily on first write to any page they
+	// cover, so sparse files and sampled verification only pay for the leaves actually touched.
+	std::vector<std::unique_ptr<WriteInfo[]>> checksumHistory;
 	// This is the most page checksum history blocks we will use across all files.
 	static Optional<int> checksumHistoryBudget;
 	static int checksumHistoryPageSize;
+	static int checksumHistoryLeafEntries;
+
+	// Deterministically decide whether a page is tracked, based only on its page number so that the write
+	// which stores a checksum and the later read which verifies it always agree.
+	bool sampledPage(int64_t page) const {
+		if (FLOW_KNOBS->PAGE_WRITE_CHECKSUM_SAMPLE_RATE >= 1.0) {
+			return true;
+		}
+		uint64_t h = (uint64_t)page * 0x9E3779B97F4A7C15ull;
+		return (h >> 32) < (uint64_t)(FLOW_KNOBS->PAGE_WRITE_CHECKSUM_SAMPLE_RATE * 4294967296.0);
+	}
+
+	// Returns the history entry for page, or nullptr if it is not tracked.  If allocate is true, a missing
+	// leaf will be created if the global budget allows it.
+	WriteInfo* historyEntry(int64_t page, bool allocate) {
+		int64_t leaf = page / checksumHistoryLeafEntries;
+		if (leaf >= (int64_t)checksumHistory.size()) {
+			if (!allocate) {
+				return nullptr;
+			}
+			checksumHistory.resize(leaf + 1);
+		}
+		if (!checksumHistory[leaf]) {
+			if (!allocate || checksumHistoryBudget.get() < checksumHistoryLeafEntries) {
+				return nullptr;
+			}
+			checksumHistory[leaf] = std::make_unique<WriteInfo[]>(checksumHistoryLeafEntries);
+			checksumHistoryBudget.get() -= checksumHistoryLeafEntries;
+		}
+		return &checksumHistory[leaf][page % checksumHistoryLeafEntries];
+	}
 
 	// Update or check checksum(s) in history for any full pages covered by this operation
 	void updateChecksumHistory(bool write, int64_t offset, int len, uint8_t* buf) {
 		// Check or set each full block in the the range
-		int page = offset / checksumHistoryPageSize; // First page number
+		int64_t page = offset / checksumHistoryPageSize; // First page number
 		int slack = offset % checksumHistoryPageSize; // Bytes after most recent page boundary
 		uint8_t* start = buf; // Position in buffer to start checking from
 		// If offset is not page-aligned, move to next page and adjust start
@@ -108,27 +150,20 @@ private:
 			++page;
 			start += (checksumHistoryPageSize - slack);
 		}
-		int pageEnd = (offset + len) / checksumHistoryPageSize; // Last page plus 1
-
-		// Make sure history is large enough or limit pageEnd
-		if (checksumHistory.size() < pageEnd) {
-			if (checksumHistoryBudget.get() > 0) {
-				// Resize history and update budget based on capacity change
-				auto initialCapacity = checksumHistory.capacity();
-				checksumHistory.resize(checksumHistory.size() +
-				                       std::min<int>(checksumHistoryBudget.get(), pageEnd - checksumHistory.size()));
-				checksumHistoryBudget.get() -= (checksumHistory.capacity() - initialCapacity);
-			}
-
-			// Limit pageEnd to end of history, which works whether or not all of the desired
-			// history slots were allocated.
-			pageEnd = checksumHistory.size();
-		}
+		int64_t pageEnd = (offset + len) / checksumHistoryPageSize; // Last page plus 1
 
 		while (page < pageEnd) {
+			// Skip pages excluded by the sample rate and pages with no history entry, which happens on reads
+			// of pages never written or when the budget ran out before a leaf could be allocated.
+			WriteInfo* history = sampledPage(page) ? historyEntry(page, write) : nullptr;
+			if (history == nullptr) {
+				start += checksumHistoryPageSize;
+				++page;
+				continue;
+			}
+
 			uint32_t checksum = crc32c_append(0xab12fd93, start, checksumHistoryPageSize);
-			WriteInfo& history = checksumHistory[page];
-			// printf("%d %d %u %u\n", write, page, checksum, history.checksum);
+			// printf("%d %" PRId64 " %u %u\n", write, page, checksum, history->checksum);
 
 #if VALGRIND
 			// It's possible we'll read or write a page where not all of the data is defined, but the checksum of the
@@ -138,19 +173,19 @@ private:
 
 			// For writes, just update the stored sum
 			if (write) {
-				history.timestamp = (uint32_t)now();
-				history.checksum = checksum;
+				history->timestamp = (uint32_t)now();
+				history->checksum = checksum;
 			} else {
-				if (history.checksum != 0 && history.checksum != checksum) {
+				if (history->checksum != 0 && history->checksum != checksum) {
 					// For reads, verify the stored sum if it is not 0.  If it fails, clear it.
 					TraceEvent(SevError, "AsyncFileLostWriteDetected")
 					    .error(checksum_failed())
 					    .detail("Filename", m_f->getFilename())
 					    .detail("PageNumber", page)
 					    .detail("ChecksumOfPage", checksum)
-					    .detail("ChecksumHistory", history.checksum)
-					    .detail("LastWriteTime", history.timestamp);
-					history.checksum = 0;
+					    .detail("ChecksumHistory", history->checksum)
+					    .detail("LastWriteTime", history->timestamp);
+					history->checksum = 0;
 				}
 			}
 
@@ -638,6 +638,9 @@ Future<REPLY_TYPE(Request)> loadBalance(
 		} else if (firstRequestData.isValid()) {
 			// Issue a second request, the first one is taking a long time.
 			secondRequestData.startRequest(backoff, triedAllOptions, stream, request, model, alternatives, channel);
+			if (model) {
+				++model->secondRequests;
+			}
 
 			loop choose {
 				when(ErrorOr<REPLY_TYPE(Request)> result =
@@ -650,6 +653,13 @@ Future<REPLY_TYPE(Request)> loadBalance(
 				}
 				when(ErrorOr<REPLY_TYPE(Request)> result = wait(secondRequestData.response)) {
 					if (secondRequestData.checkAndProcessResult(atMostOnce)) {
+						if (model) {
+							++model->secondRequestsWon;
+							TraceEvent("SecondRequestWon")
+							    .suppressFor(1.0)
+							    .detail("Winner", stream->getEndpoint().getPrimaryAddress())
+							    .detail("Elapsed", now() - startTime);
+						}
 						return result.get();
 					}
 
@@ -691,6 +701,8 @@ Future<REPLY_TYPE(Request)> loadBalance(
 							model->secondMultiplier += FLOW_KNOBS->SECOND_REQUEST_MULTIPLIER_GROWTH;
 							model->secondBudget -= 1.0;
 							break;
+						} else if (model) {
+							++model->secondRequestsDenied;
 						}
 					}
 				}
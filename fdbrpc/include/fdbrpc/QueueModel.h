@@ -24,6 +24,7 @@
 
 #include "flow/flow.h"
 #include "fdbrpc/Smoother.h"
+#include "fdbrpc/Stats.h"
 #include "flow/Knobs.h"
 #include "flow/ActorCollection.h"
 #include "fdbrpc/TSSComparison.h" // For TSS Metrics
@@ -54,9 +55,20 @@ struct QueueData {
 	// 1 indicating that each outstanding request corresponds 1 outstanding
 	// request. However, storage server can also increase the penalty if it
 	// decides to ask the client to slow down sending requests to it. Penalty
-	// is updated after each LoadBalancedReply.
+	// is updated after each LoadBalancedReply, and decays toward 1.0 over
+	// `QUEUE_MODEL_PENALTY_DECAY_TIME` when no replies arrive, so a server
+	// that has recovered does not keep being avoided indefinitely.
 	double penalty;
 
+	// The last time `penalty` was set from a server reply or decayed. Used to
+	// compute how much decay to apply when the penalty is next read.
+	double penaltyUpdateTime;
+
+	// The next time a fast-recovery probe may be sent to this server. While a
+	// server is penalized it receives few or no requests, so its penalty can
+	// only be refreshed by occasionally probing it with a real request.
+	double nextProbeTime;
+
 	// Do not consider this storage server if the current time hasn't reach this
 	// time. This field is computed after each request to not repeatedly try the
 	// same storage server that is likely not going to return a valid result.
@@ -75,7 +87,8 @@ struct QueueData {
 	Optional<TSSEndpointData> tssData;
 
 	QueueData()
-	  : smoothOutstanding(FLOW_KNOBS->QUEUE_MODEL_SMOOTHING_AMOUNT), latency(0.001), penalty(1.0), failedUntil(0),
+	  : smoothOutstanding(FLOW_KNOBS->QUEUE_MODEL_SMOOTHING_AMOUNT), latency(0.001), penalty(1.0),
+	    penaltyUpdateTime(0), nextProbeTime(0), failedUntil(0),
 	    futureVersionBackoff(FLOW_KNOBS->FUTURE_VERSION_INITIAL_BACKOFF), increaseBackoffTime(0) {}
 };
 
@@ -109,6 +122,14 @@ public:
 	int laggingRequestCount;
 	int laggingTSSCompareCount;
 
+	// Hedged ("second") request accounting for loadBalance(). The owner of this
+	// model is responsible for logging `cc`; DatabaseContext folds it into its
+	// TransactionMetrics event.
+	CounterCollection cc;
+	Counter secondRequests; // second request issued while the first was still outstanding
+	Counter secondRequestsWon; // the second request was answered before the first
+	Counter secondRequestsDenied; // a second request was wanted but the budget was exhausted
+
 	// Updates this endpoint data to duplicate requests to the specified TSS endpoint
 	void updateTssEndpoint(uint64_t endpointId, const TSSEndpointData& endpointData);
 
@@ -118,7 +139,10 @@ public:
 	// Retrieves the data for this endpoint's pair TSS endpoint, if present
 	Optional<TSSEndpointData> getTssData(uint64_t endpointId);
 
-	QueueModel() : secondMultiplier(1.0), secondBudget(0), laggingRequestCount(0) {
+	QueueModel()
+	  : secondMultiplier(1.0), secondBudget(0), laggingRequestCount(0), cc("QueueModel"),
+	    secondRequests("SecondRequests", cc), secondRequestsWon("SecondRequestsWon", cc),
+	    secondRequestsDenied("SecondRequestsDenied", cc), data(makeEndpointData()) {
 		laggingRequests = actorCollection(addActor.getFuture(), &laggingRequestCount);
 		tssComparisons = actorCollection(addTSSActor.getFuture(), &laggingTSSCompareCount);
 	}
@@ -129,7 +153,16 @@ public:
 	}
 
 private:
-	std::unordered_map<uint64_t, QueueData> data;
+	using EndpointData = std::unordered_map<uint64_t, QueueData>;
+
+	// Returns either a map private to this model or, when
+	// `QUEUE_MODEL_SHARED_STATE` is enabled, a map shared by all QueueModels on
+	// the current network thread. Sharing lets a freshly opened
+	// DatabaseContext inherit the penalties and latencies already observed by
+	// other contexts in the same process instead of starting blind.
+	static std::shared_ptr<EndpointData> makeEndpointData();
+
+	std::shared_ptr<EndpointData> data;
 };
 
 /* old queue model
@@ -34,6 +34,7 @@ MyCounters() : foo("foo", cc), bar("bar", cc), baz("baz", cc) {}
 
 */
 
+#include <atomic>
 #include <cstdint>
 #include <cstddef>
 #include "flow/flow.h"
@@ -128,6 +129,49 @@ struct Traceable<Counter> : std::true_type {
 	}
 };
 
+// A counter without Counter's per-event bookkeeping: incrementing is a single relaxed
+// atomic add and the interval state only changes when the logging actor takes a
+// snapshot, so it is safe to bump from any thread.  Rate is derived from the interval
+// snapshots.  Roughness is not measured and is reported as -1 (the value Counter
+// reports when it has no samples) so the traced field format matches Counter's.
+// Prefer this over Counter for values incremented per mutation or per message, where
+// Counter's now() call and roughness accounting are measurable.
+struct AtomicCounter final : ICounter, NonCopyable {
+public:
+	typedef int64_t Value;
+
+	AtomicCounter(std::string const& name, CounterCollection& collection);
+
+	void operator+=(Value delta) { value.fetch_add(delta, std::memory_order_relaxed); }
+	void operator++() { *this += 1; }
+	void clear();
+	void resetInterval() override;
+
+	std::string const& getName() const override { return name; }
+
+	Value getValue() const override { return value.load(std::memory_order_relaxed); }
+
+	// dValue / dt over the current logging interval
+	double getRate() const override;
+
+	bool hasRate() const override { return true; }
+	bool hasRoughness() const override { return true; }
+	double getRoughness() const override { return -1; }
+
+private:
+	std::string name;
+	std::atomic<Value> value;
+	Value interval_start_value;
+	double interval_start;
+};
+
+template <>
+struct Traceable<AtomicCounter> : std::true_type {
+	static std::string toString(AtomicCounter const& counter) {
+		return Traceable<ICounter*>::toString((ICounter const*)&counter);
+	}
+};
+
 template <class F>
 struct SpecialCounter final : ICounter, FastAllocated<SpecialCounter<F>>, NonCopyable {
 	SpecialCounter(CounterCollection& collection, std::string const& name, F&& f) : name(name), f(f) {
@@ -45,6 +45,23 @@ struct ValidationData {
 	std::unordered_set<std::string> allDestroyedChangeFeedIDs;
 };
 
+// A disk device model captured from a real host (e.g. from the disk statistics that
+// platform::getDiskStatistics exposes), loadable from the file named by the SIM_DISK_PROFILE_FILE
+// knob. Latencies are in seconds; queueDepthPenalty adds latency per operation already queued,
+// modeling devices whose latency degrades as queue depth grows.
+struct DiskProfile {
+	std::string name;
+	int64_t iops{ 5000 };
+	int64_t bandwidth{ 50000000 };
+	double syncLatencyBase{ 0.005 };
+	double syncLatencyRandom{ 0.010 };
+	double queueDepthPenalty{ 0.0 };
+
+	// Parses a profile file: "[name]" section headers followed by "key = value" lines for the
+	// fields above. Returns an empty vector if the file cannot be read.
+	static std::vector<DiskProfile> loadFromFile(std::string const& path);
+};
+
 class ISimulator : public INetwork {
 public:
 	// Order matters!
@@ -220,6 +237,10 @@ public:
 		std::set<std::string> closingFiles;
 		Optional<Standalone<StringRef>> machineId;
 
+		// The disk device model for this machine's simulated files; absent means the synthetic
+		// SIM_DISK_IOPS/SIM_DISK_BANDWIDTH model
+		Optional<DiskProfile> diskProfile;
+
 		const uint16_t remotePortStart;
 		std::vector<uint16_t> usedRemotePorts;
 
@@ -526,8 +547,17 @@ struct DiskParameters : ReferenceCounted<DiskParameters> {
 	double nextOperation;
 	int64_t iops;
 	int64_t bandwidth;
-
-	DiskParameters(int64_t iops, int64_t bandwidth) : nextOperation(0), iops(iops), bandwidth(bandwidth) {}
+	// Latency model; the defaults reproduce the historical synthetic model
+	double syncLatencyBase;
+	double syncLatencyRandom;
+	double queueDepthPenalty;
+
+	DiskParameters(int64_t iops, int64_t bandwidth)
+	  : nextOperation(0), iops(iops), bandwidth(bandwidth), syncLatencyBase(0.005), syncLatencyRandom(0.010),
+	    queueDepthPenalty(0.0) {}
+	explicit DiskParameters(DiskProfile const& profile)
+	  : nextOperation(0), iops(profile.iops), bandwidth(profile.bandwidth), syncLatencyBase(profile.syncLatencyBase),
+	    syncLatencyRandom(profile.syncLatencyRandom), queueDepthPenalty(profile.queueDepthPenalty) {}
 };
 
 // Simulates delays for performing operations on disk
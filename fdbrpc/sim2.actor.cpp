@@ -20,6 +20,7 @@
 
 #include <cinttypes>
 #include <memory>
+#include <sstream>
 #include <string>
 
 #include "flow/MkCert.h"
@@ -1249,6 +1250,15 @@ public:
 		MachineInfo& machine = machines[locality.machineId().get()];
 		if (!machine.machineId.present())
 			machine.machineId = locality.machineId();
+		if (!machine.diskProfile.present() && FLOW_KNOBS->SIM_DISK_PROFILE_FILE.size()) {
+			static std::vector<DiskProfile> profiles = DiskProfile::loadFromFile(FLOW_KNOBS->SIM_DISK_PROFILE_FILE);
+			if (!profiles.empty()) {
+				machine.diskProfile = profiles[deterministicRandom()->randomInt(0, profiles.size())];
+				TraceEvent("SimDiskProfileSelected")
+				    .detail("MachineId", locality.machineId())
+				    .detail("Profile", machine.diskProfile.get().name);
+			}
+		}
 		if (port == 0 && std::string(name) == "remote flow process") {
 			port = machine.getRandomPort();
 		}
@@ -2593,6 +2603,59 @@ ACTOR void doReboot(ISimulator::ProcessInfo* p, ISimulator::KillType kt) {
 	}
 }
 
+std::vector<DiskProfile> DiskProfile::loadFromFile(std::string const& path) {
+	std::vector<DiskProfile> profiles;
+	std::string contents;
+	try {
+		contents = readFileBytes(path, 1 << 20);
+	} catch (Error& e) {
+		TraceEvent(SevWarnAlways, "DiskProfileFileError").error(e).detail("Path", path);
+		return profiles;
+	}
+	auto trim = [](std::string s) {
+		auto first = s.find_first_not_of(" \t\r");
+		auto last = s.find_last_not_of(" \t\r");
+		return first == std::string::npos ? std::string() : s.substr(first, last - first + 1);
+	};
+	std::istringstream input(contents);
+	std::string line;
+	while (std::getline(input, line)) {
+		line = trim(line);
+		if (line.empty() || line[0] == '#') {
+			continue;
+		}
+		if (line[0] == '[') {
+			auto close = line.find(']');
+			if (close != std::string::npos) {
+				profiles.emplace_back();
+				profiles.back().name = line.substr(1, close - 1);
+			}
+			continue;
+		}
+		auto eq = line.find('=');
+		if (eq == std::string::npos || profiles.empty()) {
+			continue;
+		}
+		std::string key = trim(line.substr(0, eq));
+		std::string value = trim(line.substr(eq + 1));
+		auto& profile = profiles.back();
+		if (key == "iops") {
+			profile.iops = atoll(value.c_str());
+		} else if (key == "bandwidth") {
+			profile.bandwidth = atoll(value.c_str());
+		} else if (key == "sync_latency_base") {
+			profile.syncLatencyBase = atof(value.c_str());
+		} else if (key == "sync_latency_random") {
+			profile.syncLatencyRandom = atof(value.c_str());
+		} else if (key == "queue_depth_penalty") {
+			profile.queueDepthPenalty = atof(value.c_str());
+		} else {
+			TraceEvent(SevWarnAlways, "DiskProfileUnknownKey").detail("Path", path).detail("Key", key);
+		}
+	}
+	return profiles;
+}
+
 // Simulates delays for performing operations on disk
 Future<Void> waitUntilDiskReady(Reference<DiskParameters> diskParameters, int64_t size, bool sync) {
 	if (g_simulator.getCurrentProcess()->failedDisk) {
@@ -2605,11 +2668,16 @@ Future<Void> waitUntilDiskReady(Reference<DiskParameters> diskParameters, int64_
 		diskParameters->nextOperation = now();
 	diskParameters->nextOperation += (1.0 / diskParameters->iops) + (size / diskParameters->bandwidth);
 
+	// Approximate device queue depth by the backlog of already-scheduled operations
+	double queuedOperations = (diskParameters->nextOperation - now()) * diskParameters->iops;
+
 	double randomLatency;
 	if (sync) {
-		randomLatency = .005 + deterministicRandom()->random01() * (BUGGIFY ? 1.0 : .010);
+		randomLatency = diskParameters->syncLatencyBase +
+		                deterministicRandom()->random01() * (BUGGIFY ? 1.0 : diskParameters->syncLatencyRandom);
 	} else
 		randomLatency = 10 * deterministicRandom()->random01() / diskParameters->iops;
+	randomLatency += diskParameters->queueDepthPenalty * queuedOperations;
 
 	return delayUntil(diskParameters->nextOperation + randomLatency);
 }
@@ -2673,8 +2741,11 @@ Future<Reference<class IAsyncFile>> Sim2FileSystem::open(const std::string& file
 		if (itr == machineCache.end()) {
 			// Simulated disk parameters are shared by the AsyncFileNonDurable and the underlying SimpleFile.
 			// This way, they can both keep up with the time to start the next operation
+			auto& machineInfo = *g_simulator.getCurrentProcess()->machine;
 			auto diskParameters =
-			    makeReference<DiskParameters>(FLOW_KNOBS->SIM_DISK_IOPS, FLOW_KNOBS->SIM_DISK_BANDWIDTH);
+			    machineInfo.diskProfile.present()
+			        ? makeReference<DiskParameters>(machineInfo.diskProfile.get())
+			        : makeReference<DiskParameters>(FLOW_KNOBS->SIM_DISK_IOPS, FLOW_KNOBS->SIM_DISK_BANDWIDTH);
 			f = AsyncFileNonDurable::open(filename,
 			                              actualFilename,
 			                              SimpleFile::open(filename, flags, mode, diskParameters, false),
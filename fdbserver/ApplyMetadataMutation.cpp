@@ -82,6 +82,8 @@ public:
 	    commit(proxyCommitData_.commit), cx(proxyCommitData_.cx), committedVersion(&proxyCommitData_.committedVersion),
 	    storageCache(&proxyCommitData_.storageCache), tag_popped(&proxyCommitData_.tag_popped),
 	    tssMapping(&proxyCommitData_.tssMapping), tenantMap(&proxyCommitData_.tenantMap),
+	    tenantMapIndex(&proxyCommitData_.tenantMapIndex),
+	    keyServersDecodeCache(&proxyCommitData_.keyServersDecodeCache), proxyStats(&proxyCommitData_.stats),
 	    initialCommit(initialCommit_) {}
 
 	ApplyMetadataMutationsImpl(const SpanContext& spanContext_,
@@ -131,6 +133,11 @@ private:
 	std::unordered_map<UID, StorageServerInterface>* tssMapping = nullptr;
 
 	std::map<TenantName, TenantMapEntry>* tenantMap = nullptr;
+	std::unordered_map<TenantName, TenantMapEntry>* tenantMapIndex = nullptr;
+
+	// Decoded keyServers value cache (proxies only); see ProxyCommitData::keyServersDecodeCache.
+	std::unordered_map<std::string, std::pair<std::vector<UID>, std::vector<UID>>>* keyServersDecodeCache = nullptr;
+	ProxyStats* proxyStats = nullptr;
 
 	// true if the mutations were already written to the txnStateStore as part of recovery
 	bool initialCommit = false;
@@ -186,10 +193,29 @@ private:
 		KeyRef end = keyInfo->rangeContaining(k).end();
 		KeyRangeRef insertRange(k, end);
 		std::vector<UID> src, dest;
-		// txnStateStore is always an in-memory KVS, and must always be recovered before
-		// applyMetadataMutations is called, so a wait here should never be needed.
-		Future<RangeResult> fResult = txnStateStore->readRange(serverTagKeys);
-		decodeKeyServersValue(fResult.get(), m.param2, src, dest);
+		bool decoded = false;
+		if (keyServersDecodeCache != nullptr && SERVER_KNOBS->KEY_SERVERS_DECODE_CACHE_SIZE > 0) {
+			auto cached = keyServersDecodeCache->find(m.param2.toString());
+			if (cached != keyServersDecodeCache->end()) {
+				src = cached->second.first;
+				dest = cached->second.second;
+				++proxyStats->keyServersDecodeHits;
+				decoded = true;
+			}
+		}
+		if (!decoded) {
+			// txnStateStore is always an in-memory KVS, and must always be recovered before
+			// applyMetadataMutations is called, so a wait here should never be needed.
+			Future<RangeResult> fResult = txnStateStore->readRange(serverTagKeys);
+			decodeKeyServersValue(fResult.get(), m.param2, src, dest);
+			if (keyServersDecodeCache != nullptr && SERVER_KNOBS->KEY_SERVERS_DECODE_CACHE_SIZE > 0) {
+				if ((int)keyServersDecodeCache->size() >= SERVER_KNOBS->KEY_SERVERS_DECODE_CACHE_SIZE) {
+					keyServersDecodeCache->clear();
+				}
+				(*keyServersDecodeCache)[m.param2.toString()] = std::make_pair(src, dest);
+				++proxyStats->keyServersDecodeMisses;
+			}
+		}
 
 		ASSERT(storageCache);
 		ServerCacheInfo info;
@@ -248,6 +274,11 @@ private:
 		UID id = decodeServerTagKey(m.param1);
 		Tag tag = decodeServerTagValue(m.param2);
 
+		// The tag map feeds keyServers value decoding, so cached decodes are no longer valid.
+		if (keyServersDecodeCache != nullptr) {
+			keyServersDecodeCache->clear();
+		}
+
 		if (toCommit) {
 			MutationRef privatized = m;
 			privatized.param1 = m.param1.withPrefix(systemKeys.begin, arena);
@@ -659,6 +690,9 @@ private:
 
 				TraceEvent("CommitProxyInsertTenant", dbgid).detail("Tenant", tenantName).detail("Version", version);
 				(*tenantMap)[tenantName] = tenantEntry;
+				if (tenantMapIndex) {
+					(*tenantMapIndex)[tenantName] = tenantEntry;
+				}
 			}
 
 			if (!initialCommit) {
@@ -750,6 +784,10 @@ private:
 		if (!serverTagKeys.intersects(range)) {
 			return;
 		}
+		// The tag map feeds keyServers value decoding, so cached decodes are no longer valid.
+		if (keyServersDecodeCache != nullptr) {
+			keyServersDecodeCache->clear();
+		}
 		// Storage server removal always happens in a separate version from any prior writes (or any subsequent
 		// reuse of the tag) so we can safely destroy the tag here without any concern about intra-batch
 		// ordering
@@ -1045,6 +1083,11 @@ private:
 
 				auto startItr = tenantMap->lower_bound(startTenant);
 				auto endItr = tenantMap->lower_bound(endTenant);
+				if (tenantMapIndex) {
+					for (auto itr = startItr; itr != endItr; ++itr) {
+						tenantMapIndex->erase(itr->first);
+					}
+				}
 				tenantMap->erase(startItr, endItr);
 			}
 
@@ -714,6 +714,7 @@ ACTOR Future<Void> saveMutationsToFile(BackupData* self,
 	state std::vector<UID> activeUids; // active Backups' UIDs
 	state std::vector<Version> beginVersions; // logFiles' begin versions
 	state KeyRangeMap<std::set<int>> keyRangeMap; // range to index in logFileFutures, logFiles, & blockEnds
+	state Version minBeginVersion = MAX_VERSION; // smallest begin version of all active backups
 	state std::vector<Standalone<StringRef>> mutations;
 	state std::unordered_map<BlobCipherDetails, Reference<BlobCipherKey>> cipherKeys;
 	state int idx;
@@ -745,6 +746,7 @@ ACTOR Future<Void> saveMutationsToFile(BackupData* self,
 		// The true-up version can be larger than first message version, so keep
 		// the begin versions for later muation filtering.
 		beginVersions.push_back(it->second.lastSavedVersion);
+		minBeginVersion = std::min(minBeginVersion, it->second.lastSavedVersion);
 
 		logFileFutures.push_back(it->second.container.get().get()->writeTaggedLogFile(
 		    it->second.lastSavedVersion, popVersion + 1, blockSize, self->tag.id, self->totalTags));
@@ -778,6 +780,11 @@ ACTOR Future<Void> saveMutationsToFile(BackupData* self,
 	for (idx = 0; idx < numMsg; idx++) {
 		auto& message = self->messages[idx];
 		MutationRef m;
+		if (message.getVersion() < minBeginVersion) {
+			// Every active backup has already saved past this version; skip the message without
+			// deserializing (and possibly decrypting) it
+			continue;
+		}
 		if (!message.isBackupMessage(&m, cipherKeys))
 			continue;
 
@@ -801,14 +808,22 @@ ACTOR Future<Void> saveMutationsToFile(BackupData* self,
 			for (auto range : keyRangeMap.intersectingRanges(mutationRange)) {
 				const auto& subrange = range.range();
 				intersectionRange = mutationRange & subrange;
-				MutationRef subm(MutationRef::Type::ClearRange, intersectionRange.begin, intersectionRange.end);
-				BinaryWriter wr(AssumeVersion(g_network->protocolVersion()));
-				wr << subm;
-				mutations.push_back(wr.toValue());
+				const bool split = intersectionRange != mutationRange;
+				if (split) {
+					MutationRef subm(MutationRef::Type::ClearRange, intersectionRange.begin, intersectionRange.end);
+					BinaryWriter wr(AssumeVersion(g_network->protocolVersion()));
+					wr << subm;
+					mutations.push_back(wr.toValue());
+				}
 				for (int index : range.value()) {
 					if (message.getVersion() >= beginVersions[index]) {
-						adds.push_back(
-						    addMutation(logFiles[index], message, mutations.back(), &blockEnds[index], blockSize));
+						// A clear contained in a single filter range reuses the already-serialized mutation,
+						// like the non-clear path does
+						adds.push_back(addMutation(logFiles[index],
+						                           message,
+						                           split ? StringRef(mutations.back()) : message.message,
+						                           &blockEnds[index],
+						                           blockSize));
 					}
 				}
 			}
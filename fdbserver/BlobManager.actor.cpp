@@ -346,6 +346,7 @@ struct BlobManagerData : NonCopyable, ReferenceCounted<BlobManagerData> {
 	                                          // 0 is no merge version determined yet
 
 	FlowLock concurrentMergeChecks;
+	FlowLock concurrentPurgeDeletes;
 
 	AsyncTrigger startRecruiting;
 	Debouncer restartRecruiting;
@@ -365,6 +366,7 @@ struct BlobManagerData : NonCopyable, ReferenceCounted<BlobManagerData> {
 	    mergeCandidates(MergeCandidateInfo(MergeCandidateUnknown), normalKeys.end),
 	    activeGranuleMerges(invalidVersion, normalKeys.end),
 	    concurrentMergeChecks(SERVER_KNOBS->BLOB_MANAGER_CONCURRENT_MERGE_CHECKS),
+	    concurrentPurgeDeletes(SERVER_KNOBS->BLOB_MANAGER_CONCURRENT_PURGE_DELETES),
 	    restartRecruiting(SERVER_KNOBS->DEBOUNCE_RECRUITING_DELAY), recruitingStream(0) {}
 
 	// only initialize blob store if actually needed
@@ -1840,10 +1842,17 @@ ACTOR Future<Void> attemptMerges(Reference<BlobManagerData> bmData,
 	// large keys can cause a large number of granules in the merge to exceed the maximum value size
 	state int currentKeySumBytes = 0;
 	state std::vector<std::tuple<UID, KeyRange, Version>> currentCandidates;
+
+	// fetch the metrics for all candidates in parallel, then do the single-pass grouping
+	state std::vector<Future<StorageMetrics>> metricsFutures;
+	metricsFutures.reserve(candidates.size());
+	for (auto& it : candidates) {
+		metricsFutures.push_back(bmData->db->getStorageMetrics(std::get<1>(it), CLIENT_KNOBS->TOO_MANY));
+	}
+
 	state int i;
 	for (i = 0; i < candidates.size(); i++) {
-		StorageMetrics metrics =
-		    wait(bmData->db->getStorageMetrics(std::get<1>(candidates[i]), CLIENT_KNOBS->TOO_MANY));
+		StorageMetrics metrics = wait(metricsFutures[i]);
 
 		if (metrics.bytes >= SERVER_KNOBS->BG_SNAPSHOT_FILE_TARGET_BYTES ||
 		    metrics.bytesPerKSecond >= SERVER_KNOBS->SHARD_MIN_BYTES_PER_KSEC) {
@@ -2889,6 +2898,69 @@ ACTOR Future<Void> chaosRangeMover(Reference<BlobManagerData> bmData) {
 	}
 }
 
+// Evens out granule counts across blob workers. The manager only knows assignment counts (workers don't report
+// per-granule load), so this balances cardinality: a newly recruited or recovered worker picks up granules from the
+// busiest worker in small batches instead of waiting for future splits to land on it.
+ACTOR Future<Void> granuleLoadBalancer(Reference<BlobManagerData> bmData) {
+	loop {
+		wait(delay(SERVER_KNOBS->BG_LOAD_BALANCE_INTERVAL));
+
+		if (bmData->workerStats.size() < 2) {
+			continue;
+		}
+
+		UID busiestWorker;
+		int busiestCount = -1;
+		int leastCount = INT_MAX;
+		for (auto const& worker : bmData->workerStats) {
+			if (worker.second.numGranulesAssigned > busiestCount) {
+				busiestCount = worker.second.numGranulesAssigned;
+				busiestWorker = worker.first;
+			}
+			leastCount = std::min(leastCount, worker.second.numGranulesAssigned);
+		}
+
+		// Only move work when the imbalance is large enough that splits and merges won't fix it incidentally
+		if (busiestCount - leastCount < 4) {
+			continue;
+		}
+
+		std::vector<KeyRange> candidates;
+		for (auto& it : bmData->workerAssignments.ranges()) {
+			if (it.value() == busiestWorker && !bmData->isMergeActive(it.range())) {
+				candidates.push_back(it.range());
+			}
+		}
+		if (candidates.empty()) {
+			continue;
+		}
+		deterministicRandom()->randomShuffle(candidates);
+
+		int toMove = std::min<int>(
+		    { (int)candidates.size(), (busiestCount - leastCount) / 2, SERVER_KNOBS->BG_LOAD_BALANCE_MAX_MOVES });
+		CODE_PROBE(true, "BM load balancing granules");
+		TraceEvent("BlobManagerGranuleLoadBalance", bmData->id)
+		    .detail("BusiestWorker", busiestWorker)
+		    .detail("BusiestCount", busiestCount)
+		    .detail("LeastCount", leastCount)
+		    .detail("Moves", toMove);
+		for (int i = 0; i < toMove; i++) {
+			// The new assignment leaves the worker unset so doRangeAssignment picks the then-least-loaded worker
+			RangeAssignment revokeOld;
+			revokeOld.isAssign = false;
+			revokeOld.keyRange = candidates[i];
+			revokeOld.revoke = RangeRevokeData(false);
+			handleRangeAssign(bmData, revokeOld);
+
+			RangeAssignment assignNew;
+			assignNew.isAssign = true;
+			assignNew.keyRange = candidates[i];
+			assignNew.assign = RangeAssignmentData(); // not a continue
+			handleRangeAssign(bmData, assignNew);
+		}
+	}
+}
+
 // Returns the number of blob workers on addr
 int numExistingBWOnAddr(Reference<BlobManagerData> self, const AddressExclusion& addr) {
 	int numExistingBW = 0;
@@ -3132,9 +3204,16 @@ ACTOR Future<Void> canDeleteFullGranule(Reference<BlobManagerData> self, UID gra
 	return Void();
 }
 
-static Future<Void> deleteFile(Reference<BlobConnectionProvider> bstoreProvider, std::string filePath) {
+// Bounded by concurrentPurgeDeletes so that a large purge issues deletions through the blob
+// store's connection pool at a controlled rate instead of queueing one request per file at once.
+ACTOR static Future<Void> deleteFile(Reference<BlobManagerData> self,
+                                     Reference<BlobConnectionProvider> bstoreProvider,
+                                     std::string filePath) {
+	wait(self->concurrentPurgeDeletes.take());
+	state FlowLock::Releaser releaser(self->concurrentPurgeDeletes);
 	Reference<BackupContainerFileSystem> bstore = bstoreProvider->getForRead(filePath);
-	return bstore->deleteFile(filePath);
+	wait(bstore->deleteFile(filePath));
+	return Void();
 }
 
 ACTOR Future<Reference<BlobConnectionProvider>> getBStoreForGranule(Reference<BlobManagerData> self,
@@ -3156,14 +3235,14 @@ ACTOR Future<Reference<BlobConnectionProvider>> getBStoreForGranule(Reference<Bl
 }
 
 /*
- * Deletes all files pertaining to the granule with id granuleId and
- * also removes the history entry for this granule from the system keyspace
+ * Deletes all files pertaining to the granule with id granuleId. The caller is responsible for
+ * clearing the granule's history entry and file keys afterwards; purgeRange batches those clears
+ * for many granules into a single transaction.
  */
-ACTOR Future<Void> fullyDeleteGranule(Reference<BlobManagerData> self,
-                                      UID granuleId,
-                                      Key historyKey,
-                                      Version purgeVersion,
-                                      KeyRange granuleRange) {
+ACTOR Future<Void> fullyDeleteGranuleFiles(Reference<BlobManagerData> self,
+                                           UID granuleId,
+                                           Version purgeVersion,
+                                           KeyRange granuleRange) {
 	if (BM_PURGE_DEBUG) {
 		fmt::print("BM {0} Fully deleting granule {1}: init\n", self->epoch, granuleId.toString());
 	}
@@ -3181,13 +3260,13 @@ ACTOR Future<Void> fullyDeleteGranule(Reference<BlobManagerData> self,
 
 	for (auto snapshotFile : files.snapshotFiles) {
 		std::string fname = snapshotFile.filename;
-		deletions.push_back(deleteFile(bstore, fname));
+		deletions.push_back(deleteFile(self, bstore, fname));
 		filesToDelete.emplace_back(fname);
 	}
 
 	for (auto deltaFile : files.deltaFiles) {
 		std::string fname = deltaFile.filename;
-		deletions.push_back(deleteFile(bstore, fname));
+		deletions.push_back(deleteFile(self, bstore, fname));
 		filesToDelete.emplace_back(fname);
 	}
 
@@ -3207,30 +3286,8 @@ ACTOR Future<Void> fullyDeleteGranule(Reference<BlobManagerData> self,
 	// deleting files before corresponding metadata reduces the # of orphaned files.
 	wait(waitForAll(deletions));
 
-	// delete metadata in FDB (history entry and file keys)
 	if (BM_PURGE_DEBUG) {
-		fmt::print(
-		    "BM {0} Fully deleting granule {1}: deleting history and file keys\n", self->epoch, granuleId.toString());
-	}
-
-	state Transaction tr(self->db);
-	tr.setOption(FDBTransactionOptions::ACCESS_SYSTEM_KEYS);
-	tr.setOption(FDBTransactionOptions::PRIORITY_SYSTEM_IMMEDIATE);
-
-	loop {
-		try {
-			KeyRange fileRangeKey = blobGranuleFileKeyRangeFor(granuleId);
-			tr.clear(historyKey);
-			tr.clear(fileRangeKey);
-			wait(tr.commit());
-			break;
-		} catch (Error& e) {
-			wait(tr.onError(e));
-		}
-	}
-
-	if (BM_PURGE_DEBUG) {
-		fmt::print("BM {0} Fully deleting granule {1}: success\n", self->epoch, granuleId.toString());
+		fmt::print("BM {0} Fully deleting granule {1}: files deleted\n", self->epoch, granuleId.toString());
 	}
 
 	TraceEvent("GranuleFullPurge", self->id)
@@ -3280,7 +3337,7 @@ ACTOR Future<Void> partiallyDeleteGranule(Reference<BlobManagerData> self,
 		// if we already found the latestSnapshotVersion, this snapshot can be deleted
 		if (latestSnapshotVersion != invalidVersion) {
 			std::string fname = files.snapshotFiles[idx].filename;
-			deletions.push_back(deleteFile(bstore, fname));
+			deletions.push_back(deleteFile(self, bstore, fname));
 			deletedFileKeys.emplace_back(blobGranuleFileKeyFor(granuleId, files.snapshotFiles[idx].version, 'S'));
 			filesToDelete.emplace_back(fname);
 		} else if (files.snapshotFiles[idx].version <= purgeVersion) {
@@ -3304,7 +3361,7 @@ ACTOR Future<Void> partiallyDeleteGranule(Reference<BlobManagerData> self,
 		// otherwise deltaFile.version <= latestSnapshotVersion so delete it
 		// == should also be deleted because the last delta file before a snapshot would have the same version
 		std::string fname = deltaFile.filename;
-		deletions.push_back(deleteFile(bstore, fname));
+		deletions.push_back(deleteFile(self, bstore, fname));
 		deletedFileKeys.emplace_back(blobGranuleFileKeyFor(granuleId, deltaFile.version, 'D'));
 		filesToDelete.emplace_back(fname);
 	}
@@ -3409,8 +3466,8 @@ ACTOR Future<Void> purgeRange(Reference<BlobManagerData> self, KeyRangeRef range
 	tr.setOption(FDBTransactionOptions::ACCESS_SYSTEM_KEYS);
 	tr.setOption(FDBTransactionOptions::PRIORITY_SYSTEM_IMMEDIATE);
 
-	state KeyRangeMap<UID>::iterator activeRange;
-	for (activeRange = activeRanges.begin(); activeRange != activeRanges.end(); ++activeRange) {
+	state std::vector<KeyRange> activeRangesToCheck;
+	for (auto activeRange = activeRanges.begin(); activeRange != activeRanges.end(); ++activeRange) {
 		if (BM_PURGE_DEBUG) {
 			fmt::print("BM {0} Checking if active range [{1} - {2}), owned by BW {3}, should be purged\n",
 			           self->epoch,
@@ -3432,37 +3489,53 @@ ACTOR Future<Void> purgeRange(Reference<BlobManagerData> self, KeyRangeRef range
 		// so that it doesn't try to interact with the granule (i.e. force it to give up gLock).
 		// we'll need some way to ack that the revoke was successful
 
+		activeRangesToCheck.push_back(activeRange.range());
+	}
+
+	// Fetch the latest history entries in parallel waves instead of one round trip per granule
+	state int rangeIdx;
+	for (rangeIdx = 0; rangeIdx < activeRangesToCheck.size(); rangeIdx += SERVER_KNOBS->BLOB_MANAGER_PURGE_BATCH_SIZE) {
+		state int rangeEndIdx =
+		    std::min<int>(rangeIdx + SERVER_KNOBS->BLOB_MANAGER_PURGE_BATCH_SIZE, activeRangesToCheck.size());
+		state std::vector<Optional<GranuleHistory>> histories;
 		loop {
 			try {
 				if (BM_PURGE_DEBUG) {
-					fmt::print("BM {0} Fetching latest history entry for range [{1} - {2})\n",
+					fmt::print("BM {0} Fetching latest history entries for {1} active ranges\n",
 					           self->epoch,
-					           activeRange.begin().printable(),
-					           activeRange.end().printable());
+					           rangeEndIdx - rangeIdx);
+				}
+				std::vector<Future<Optional<GranuleHistory>>> historyFutures;
+				historyFutures.reserve(rangeEndIdx - rangeIdx);
+				for (int j = rangeIdx; j < rangeEndIdx; j++) {
+					historyFutures.push_back(getLatestGranuleHistory(&tr, activeRangesToCheck[j]));
 				}
-				// FIXME: doing this serially will likely be too slow for large purges
-				Optional<GranuleHistory> history = wait(getLatestGranuleHistory(&tr, activeRange.range()));
 				// TODO: can we tell from the krm that this range is not valid, so that we don't need to do a
 				// get
-				if (history.present()) {
-					if (BM_PURGE_DEBUG) {
-						fmt::print("BM {0}   Adding range to history queue: [{1} - {2}) @ {3} ({4})\n",
-						           self->epoch,
-						           activeRange.begin().printable(),
-						           activeRange.end().printable(),
-						           history.get().version,
-						           (void*)(activeRange.range().begin.begin()));
-					}
-					visited.insert({ activeRange.range().begin.toString(), history.get().version });
-					historyEntryQueue.push({ activeRange.range(), history.get().version, MAX_VERSION });
-				} else if (BM_PURGE_DEBUG) {
-					fmt::print("BM {0}   No history for range, ignoring\n", self->epoch);
-				}
+				wait(store(histories, getAll(historyFutures)));
 				break;
 			} catch (Error& e) {
 				wait(tr.onError(e));
 			}
 		}
+		for (int j = rangeIdx; j < rangeEndIdx; j++) {
+			KeyRange const& activeRange = activeRangesToCheck[j];
+			Optional<GranuleHistory> const& history = histories[j - rangeIdx];
+			if (history.present()) {
+				if (BM_PURGE_DEBUG) {
+					fmt::print("BM {0}   Adding range to history queue: [{1} - {2}) @ {3} ({4})\n",
+					           self->epoch,
+					           activeRange.begin.printable(),
+					           activeRange.end.printable(),
+					           history.get().version,
+					           (void*)(activeRange.begin.begin()));
+				}
+				visited.insert({ activeRange.begin.toString(), history.get().version });
+				historyEntryQueue.push({ activeRange, history.get().version, MAX_VERSION });
+			} else if (BM_PURGE_DEBUG) {
+				fmt::print("BM {0}   No history for range, ignoring\n", self->epoch);
+			}
+		}
 	}
 
 	if (BM_PURGE_DEBUG) {
@@ -3473,107 +3546,120 @@ ACTOR Future<Void> purgeRange(Reference<BlobManagerData> self, KeyRangeRef range
 		           range.end.printable());
 	}
 	while (!historyEntryQueue.empty()) {
-		// process the node at the front of the queue and remove it
-		state KeyRange currRange;
-		state Version startVersion;
-		state Version endVersion;
-		std::tie(currRange, startVersion, endVersion) = historyEntryQueue.front();
-		historyEntryQueue.pop();
-
-		if (BM_PURGE_DEBUG) {
-			fmt::print("BM {0} Processing history node [{1} - {2}) with versions [{3}, {4})\n",
-			           self->epoch,
-			           currRange.begin.printable(),
-			           currRange.end.printable(),
-			           startVersion,
-			           endVersion);
+		// take a wave of nodes off the front of the queue and fetch their history entries in
+		// parallel; nodes in the queue never depend on each other, only on their parents
+		state std::vector<std::tuple<KeyRange, Version, Version>> wave;
+		wave.clear();
+		while (!historyEntryQueue.empty() && wave.size() < SERVER_KNOBS->BLOB_MANAGER_PURGE_BATCH_SIZE) {
+			wave.push_back(historyEntryQueue.front());
+			historyEntryQueue.pop();
 		}
 
-		// get the persisted history entry for this granule
-		state Standalone<BlobGranuleHistoryValue> currHistoryNode;
-		state Key historyKey = blobGranuleHistoryKeyFor(currRange, startVersion);
-		state bool foundHistory = false;
+		// get the persisted history entries for this wave
+		state std::vector<Optional<Value>> persistedHistories;
 		loop {
 			try {
-				Optional<Value> persistedHistory = wait(tr.get(historyKey));
-				if (persistedHistory.present()) {
-					currHistoryNode = decodeBlobGranuleHistoryValue(persistedHistory.get());
-					foundHistory = true;
+				std::vector<Future<Optional<Value>>> historyGets;
+				historyGets.reserve(wave.size());
+				for (auto& entry : wave) {
+					historyGets.push_back(
+					    tr.get(blobGranuleHistoryKeyFor(std::get<0>(entry), std::get<1>(entry))));
 				}
+				wait(store(persistedHistories, getAll(historyGets)));
 				break;
 			} catch (Error& e) {
 				wait(tr.onError(e));
 			}
 		}
 
-		if (!foundHistory) {
+		for (int waveIdx = 0; waveIdx < wave.size(); waveIdx++) {
+			KeyRange currRange;
+			Version startVersion;
+			Version endVersion;
+			std::tie(currRange, startVersion, endVersion) = wave[waveIdx];
+
 			if (BM_PURGE_DEBUG) {
-				fmt::print("BM {0}  No history for this node, skipping\n", self->epoch);
+				fmt::print("BM {0} Processing history node [{1} - {2}) with versions [{3}, {4})\n",
+				           self->epoch,
+				           currRange.begin.printable(),
+				           currRange.end.printable(),
+				           startVersion,
+				           endVersion);
 			}
-			continue;
-		}
 
-		if (BM_PURGE_DEBUG) {
-			fmt::print("BM {0}  Found history entry for this node. It's granuleID is {1}\n",
-			           self->epoch,
-			           currHistoryNode.granuleID.toString());
-		}
-
-		// There are three cases this granule can fall into:
-		// - if the granule's end version is at or before the purge version or this is a force delete,
-		//   this granule should be completely deleted
-		// - else if the startVersion <= purgeVersion, then G.startVersion < purgeVersion < G.endVersion
-		//   and so this granule should be partially deleted
-		// - otherwise, this granule is active, so don't schedule it for deletion
-		if (force || endVersion <= purgeVersion) {
-			if (BM_PURGE_DEBUG) {
-				fmt::print(
-				    "BM {0}   Granule {1} will be FULLY deleted\n", self->epoch, currHistoryNode.granuleID.toString());
+			Key historyKey = blobGranuleHistoryKeyFor(currRange, startVersion);
+			if (!persistedHistories[waveIdx].present()) {
+				if (BM_PURGE_DEBUG) {
+					fmt::print("BM {0}  No history for this node, skipping\n", self->epoch);
+				}
+				continue;
 			}
-			toFullyDelete.push_back({ currHistoryNode.granuleID, historyKey, currRange });
-		} else if (startVersion < purgeVersion) {
+			Standalone<BlobGranuleHistoryValue> currHistoryNode =
+			    decodeBlobGranuleHistoryValue(persistedHistories[waveIdx].get());
+
 			if (BM_PURGE_DEBUG) {
-				fmt::print("BM {0}   Granule {1} will be partially deleted\n",
+				fmt::print("BM {0}  Found history entry for this node. It's granuleID is {1}\n",
 				           self->epoch,
 				           currHistoryNode.granuleID.toString());
 			}
-			toPartiallyDelete.push_back({ currHistoryNode.granuleID, currRange });
-		}
 
-		// add all of the node's parents to the queue
-		if (BM_PURGE_DEBUG) {
-			fmt::print("BM {0}   Checking {1} parents\n", self->epoch, currHistoryNode.parentVersions.size());
-		}
-		for (int i = 0; i < currHistoryNode.parentVersions.size(); i++) {
-			// for (auto& parent : currHistoryNode.parentVersions.size()) {
-			// if we already added this node to queue, skip it; otherwise, mark it as visited
-			KeyRangeRef parentRange(currHistoryNode.parentBoundaries[i], currHistoryNode.parentBoundaries[i + 1]);
-			Version parentVersion = currHistoryNode.parentVersions[i];
-			std::string beginStr = parentRange.begin.toString();
-			if (!visited.insert({ beginStr, parentVersion }).second) {
+			// There are three cases this granule can fall into:
+			// - if the granule's end version is at or before the purge version or this is a force delete,
+			//   this granule should be completely deleted
+			// - else if the startVersion <= purgeVersion, then G.startVersion < purgeVersion < G.endVersion
+			//   and so this granule should be partially deleted
+			// - otherwise, this granule is active, so don't schedule it for deletion
+			if (force || endVersion <= purgeVersion) {
 				if (BM_PURGE_DEBUG) {
-					fmt::print("BM {0}     Already added [{1} - {2}) @ {3} - {4} to queue, so skipping it\n",
+					fmt::print("BM {0}   Granule {1} will be FULLY deleted\n",
+					           self->epoch,
+					           currHistoryNode.granuleID.toString());
+				}
+				toFullyDelete.push_back({ currHistoryNode.granuleID, historyKey, currRange });
+			} else if (startVersion < purgeVersion) {
+				if (BM_PURGE_DEBUG) {
+					fmt::print("BM {0}   Granule {1} will be partially deleted\n",
+					           self->epoch,
+					           currHistoryNode.granuleID.toString());
+				}
+				toPartiallyDelete.push_back({ currHistoryNode.granuleID, currRange });
+			}
+
+			// add all of the node's parents to the queue
+			if (BM_PURGE_DEBUG) {
+				fmt::print("BM {0}   Checking {1} parents\n", self->epoch, currHistoryNode.parentVersions.size());
+			}
+			for (int i = 0; i < currHistoryNode.parentVersions.size(); i++) {
+				// for (auto& parent : currHistoryNode.parentVersions.size()) {
+				// if we already added this node to queue, skip it; otherwise, mark it as visited
+				KeyRangeRef parentRange(currHistoryNode.parentBoundaries[i], currHistoryNode.parentBoundaries[i + 1]);
+				Version parentVersion = currHistoryNode.parentVersions[i];
+				std::string beginStr = parentRange.begin.toString();
+				if (!visited.insert({ beginStr, parentVersion }).second) {
+					if (BM_PURGE_DEBUG) {
+						fmt::print("BM {0}     Already added [{1} - {2}) @ {3} - {4} to queue, so skipping it\n",
+						           self->epoch,
+						           parentRange.begin.printable(),
+						           parentRange.end.printable(),
+						           parentVersion,
+						           startVersion);
+					}
+					continue;
+				}
+
+				if (BM_PURGE_DEBUG) {
+					fmt::print("BM {0}     Adding parent [{1} - {2}) @ {3} - {4} to queue\n",
 					           self->epoch,
 					           parentRange.begin.printable(),
 					           parentRange.end.printable(),
 					           parentVersion,
 					           startVersion);
 				}
-				continue;
-			}
 
-			if (BM_PURGE_DEBUG) {
-				fmt::print("BM {0}     Adding parent [{1} - {2}) @ {3} - {4} to queue\n",
-				           self->epoch,
-				           parentRange.begin.printable(),
-				           parentRange.end.printable(),
-				           parentVersion,
-				           startVersion);
+				// the parent's end version is this node's startVersion,
+				// since this node must have started where it's parent finished
+				historyEntryQueue.push({ parentRange, parentVersion, startVersion });
 			}
-
-			// the parent's end version is this node's startVersion,
-			// since this node must have started where it's parent finished
-			historyEntryQueue.push({ parentRange, parentVersion, startVersion });
 		}
 	}
 
@@ -3584,8 +3670,10 @@ ACTOR Future<Void> purgeRange(Reference<BlobManagerData> self, KeyRangeRef range
 	// any node that must be partially deleted must occur later on in the history. Thus,
 	// we delete the 'toFullyDelete' granules first.
 	//
-	// Unfortunately we can't do parallelize _full_ deletions because they might
-	// race and we'll end up with unreachable nodes in the case of a crash.
+	// Full deletions are processed in batches: the file deletions for a batch run in parallel, and
+	// then the batch's history and file keys are cleared in a single transaction. Clearing each
+	// batch's metadata atomically preserves the reverse-order invariant across a crash, which a
+	// per-granule parallel metadata delete would not.
 	// Since partial deletions only occur for "leafs", they can be done in parallel
 	//
 	// Note about file deletions: although we might be retrying a deletion of a granule,
@@ -3606,16 +3694,49 @@ ACTOR Future<Void> purgeRange(Reference<BlobManagerData> self, KeyRangeRef range
 	if (BM_PURGE_DEBUG) {
 		fmt::print("BM {0}: {1} granules to fully delete\n", self->epoch, toFullyDelete.size());
 	}
-	for (i = toFullyDelete.size() - 1; i >= 0; --i) {
-		state UID granuleId;
-		Key historyKey;
-		KeyRange keyRange;
-		std::tie(granuleId, historyKey, keyRange) = toFullyDelete[i];
-		// FIXME: consider batching into a single txn (need to take care of txn size limit)
+	state int batchStart;
+	for (batchStart = toFullyDelete.size() - 1; batchStart >= 0;
+	     batchStart -= SERVER_KNOBS->BLOB_MANAGER_PURGE_BATCH_SIZE) {
+		state int batchEnd = std::max<int>(batchStart - SERVER_KNOBS->BLOB_MANAGER_PURGE_BATCH_SIZE, -1);
+		state std::vector<Future<Void>> fileDeletions;
+		fileDeletions.clear();
+		for (i = batchStart; i > batchEnd; --i) {
+			UID granuleId;
+			Key historyKey;
+			KeyRange keyRange;
+			std::tie(granuleId, historyKey, keyRange) = toFullyDelete[i];
+			if (BM_PURGE_DEBUG) {
+				fmt::print("BM {0}: About to fully delete granule {1}\n", self->epoch, granuleId.toString());
+			}
+			fileDeletions.push_back(fullyDeleteGranuleFiles(self, granuleId, purgeVersion, range));
+		}
+		wait(waitForAll(fileDeletions));
+
+		// delete metadata in FDB (history entries and file keys) for the whole batch at once
 		if (BM_PURGE_DEBUG) {
-			fmt::print("BM {0}: About to fully delete granule {1}\n", self->epoch, granuleId.toString());
+			fmt::print("BM {0}: Clearing history and file keys for {1} fully deleted granules\n",
+			           self->epoch,
+			           batchStart - batchEnd);
+		}
+		state Transaction clearTr(self->db);
+		clearTr.setOption(FDBTransactionOptions::ACCESS_SYSTEM_KEYS);
+		clearTr.setOption(FDBTransactionOptions::PRIORITY_SYSTEM_IMMEDIATE);
+		loop {
+			try {
+				for (i = batchStart; i > batchEnd; --i) {
+					UID granuleId;
+					Key historyKey;
+					KeyRange keyRange;
+					std::tie(granuleId, historyKey, keyRange) = toFullyDelete[i];
+					clearTr.clear(historyKey);
+					clearTr.clear(blobGranuleFileKeyRangeFor(granuleId));
+				}
+				wait(clearTr.commit());
+				break;
+			} catch (Error& e) {
+				wait(clearTr.onError(e));
+			}
 		}
-		wait(fullyDeleteGranule(self, granuleId, historyKey, purgeVersion, range));
 	}
 
 	if (BM_PURGE_DEBUG) {
@@ -3992,6 +4113,9 @@ ACTOR Future<Void> blobManager(BlobManagerInterface bmInterf,
 	if (SERVER_KNOBS->BG_ENABLE_MERGING) {
 		self->addActor.send(granuleMergeChecker(self));
 	}
+	if (SERVER_KNOBS->BG_ENABLE_LOAD_BALANCING) {
+		self->addActor.send(granuleLoadBalancer(self));
+	}
 
 	if (BUGGIFY) {
 		self->addActor.send(chaosRangeMover(self));
@@ -203,13 +203,15 @@ struct BlobWorkerData : NonCopyable, ReferenceCounted<BlobWorkerData> {
 	Promise<Void> fatalError;
 
 	FlowLock initialSnapshotLock;
+	FlowLock resnapshotLock;
 	bool shuttingDown = false;
 
 	int changeFeedStreamReplyBufferSize = SERVER_KNOBS->BG_DELTA_FILE_TARGET_BYTES / 2;
 
 	BlobWorkerData(UID id, Reference<AsyncVar<ServerDBInfo> const> dbInf, Database db)
 	  : id(id), db(db), stats(id, SERVER_KNOBS->WORKER_LOGGING_INTERVAL), tenantData(BGTenantMap(dbInf)), dbInfo(dbInf),
-	    initialSnapshotLock(SERVER_KNOBS->BLOB_WORKER_INITIAL_SNAPSHOT_PARALLELISM) {}
+	    initialSnapshotLock(SERVER_KNOBS->BLOB_WORKER_INITIAL_SNAPSHOT_PARALLELISM),
+	    resnapshotLock(SERVER_KNOBS->BLOB_WORKER_RESNAPSHOT_PARALLELISM) {}
 
 	bool managerEpochOk(int64_t epoch) {
 		if (epoch < currentManagerEpoch) {
@@ -993,6 +995,10 @@ ACTOR Future<BlobFileIndex> compactFromBlob(Reference<BlobWorkerData> bwData,
                                             std::vector<GranuleFiles> fileSet,
                                             Version version) {
 	wait(delay(0, TaskPriority::BlobWorkerUpdateStorage));
+	// Many granules tend to hit BG_DELTA_BYTES_BEFORE_COMPACT at about the same time (e.g. after a bulk load), so
+	// bound the number of concurrent re-snapshots to smooth the read+write load on the blob store
+	wait(bwData->resnapshotLock.take());
+	state FlowLock::Releaser holdingLock(bwData->resnapshotLock);
 	if (BW_DEBUG) {
 		fmt::print("Compacting snapshot from blob for [{0} - {1}) @ {2}\n",
 		           metadata->keyRange.begin.printable().c_str(),
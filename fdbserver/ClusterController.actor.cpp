@@ -938,6 +938,42 @@ void clusterRecruitBlobWorker(ClusterControllerData* self, RecruitBlobWorkerRequ
 	}
 }
 
+// Plans a recruitment for the requested (or current) configuration against the currently registered workers
+// without recruiting anything or changing datacenter preferences, so operators can inspect the layout a
+// configuration change would produce before applying it.
+void clusterRecruitmentDryRun(ClusterControllerData* self, RecruitmentDryRunRequest req) {
+	RecruitmentDryRunReply reply;
+	try {
+		if (!self->gotProcessClasses)
+			throw no_more_servers();
+		DatabaseConfiguration configuration =
+		    req.configuration.present() ? req.configuration.get() : self->db.config;
+		RecruitFromConfigurationReply layout = self->findWorkersForConfigurationDispatch(
+		    RecruitFromConfigurationRequest(configuration, false, 0), true, true);
+		reply.dcId = layout.dcId;
+		for (const auto& w : layout.tLogs)
+			reply.tLogs.push_back(w.address());
+		for (const auto& w : layout.satelliteTLogs)
+			reply.satelliteTLogs.push_back(w.address());
+		for (const auto& w : layout.commitProxies)
+			reply.commitProxies.push_back(w.address());
+		for (const auto& w : layout.grvProxies)
+			reply.grvProxies.push_back(w.address());
+		for (const auto& w : layout.resolvers)
+			reply.resolvers.push_back(w.address());
+		for (const auto& w : layout.backupWorkers)
+			reply.backupWorkers.push_back(w.address());
+	} catch (Error& e) {
+		if (e.code() == error_code_actor_cancelled) {
+			throw;
+		}
+		TraceEvent(SevWarn, "RecruitmentDryRunFailed", self->id).error(e);
+		reply = RecruitmentDryRunReply();
+		reply.errorMsg = e.name();
+	}
+	req.reply.send(reply);
+}
+
 void clusterRegisterMaster(ClusterControllerData* self, RegisterMasterRequest const& req) {
 	req.reply.send(Void());
 
@@ -1107,7 +1143,19 @@ ACTOR Future<Void> registerWorker(RegisterWorkerRequest req,
                                   ClusterControllerData* self,
                                   ClusterConnectionString cs,
                                   ConfigBroadcaster* configBroadcaster) {
-	std::vector<NetworkAddress> coordinatorAddresses = wait(cs.tryResolveHostnames());
+	state std::vector<NetworkAddress> coordinatorAddresses;
+	if (cs.hostnames.empty()) {
+		coordinatorAddresses = cs.coords;
+	} else if (cs.toString() == self->resolvedCoordinatorsKey &&
+	           now() - self->resolvedCoordinatorsTime < SERVER_KNOBS->CC_COORDINATOR_RESOLVE_CACHE_TTL) {
+		coordinatorAddresses = self->resolvedCoordinators;
+	} else {
+		std::vector<NetworkAddress> addresses = wait(cs.tryResolveHostnames());
+		coordinatorAddresses = addresses;
+		self->resolvedCoordinatorsKey = cs.toString();
+		self->resolvedCoordinators = addresses;
+		self->resolvedCoordinatorsTime = now();
+	}
 
 	const WorkerInterface& w = req.wi;
 	ProcessClass newProcessClass = req.processClass;
@@ -1370,6 +1418,10 @@ ACTOR Future<Void> statusServer(FutureStream<StatusRequest> requests,
 	// Seconds since the END of the last GetStatus executed
 	state double last_request_time = 0.0;
 
+	// The last successful status document, served to requests that arrive while it is still fresh so frequent
+	// pollers don't each trigger a full re-collection
+	state Optional<StatusReply> cachedResult;
+
 	// Place to accumulate a batch of requests to respond to
 	state std::vector<StatusRequest> requests_batch;
 
@@ -1378,6 +1430,12 @@ ACTOR Future<Void> statusServer(FutureStream<StatusRequest> requests,
 			// Wait til first request is ready
 			StatusRequest req = waitNext(requests);
 			++self->statusRequests;
+
+			if (cachedResult.present() && now() - last_request_time < SERVER_KNOBS->STATUS_CACHE_TTL) {
+				CODE_PROBE(true, "Status request served from cache");
+				req.reply.send(cachedResult.get());
+				continue;
+			}
 			requests_batch.push_back(req);
 
 			// Earliest time at which we may begin a new request
@@ -1442,6 +1500,7 @@ ACTOR Future<Void> statusServer(FutureStream<StatusRequest> requests,
 			// Update last_request_time now because GetStatus is finished and the delay is to be measured between
 			// requests
 			last_request_time = now();
+			cachedResult = result.isError() ? Optional<StatusReply>() : result.get();
 
 			while (!requests_batch.empty()) {
 				if (result.isError())
@@ -2588,6 +2647,9 @@ ACTOR Future<Void> clusterControllerCore(ClusterControllerFullInterface interf,
 		when(RecruitBlobWorkerRequest req = waitNext(interf.recruitBlobWorker.getFuture())) {
 			clusterRecruitBlobWorker(&self, req);
 		}
+		when(RecruitmentDryRunRequest req = waitNext(interf.clientInterface.recruitmentDryRun.getFuture())) {
+			clusterRecruitmentDryRun(&self, req);
+		}
 		when(RegisterWorkerRequest req = waitNext(interf.registerWorker.getFuture())) {
 			++self.registerWorkerRequests;
 			self.addActor.send(registerWorker(req,
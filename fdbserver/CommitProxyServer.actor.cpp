@@ -244,8 +244,8 @@ ErrorOr<Optional<TenantMapEntry>> getTenantEntry(ProxyCommitData* commitData,
                                                  Optional<int64_t> tenantId,
                                                  bool logOnFailure) {
 	if (tenant.present()) {
-		auto itr = commitData->tenantMap.find(tenant.get());
-		if (itr == commitData->tenantMap.end()) {
+		auto itr = commitData->tenantMapIndex.find(tenant.get());
+		if (itr == commitData->tenantMapIndex.end()) {
 			if (logOnFailure) {
 				TraceEvent(SevWarn, "CommitProxyUnknownTenant", commitData->dbgid).detail("Tenant", tenant.get());
 			}
@@ -417,7 +417,10 @@ ACTOR Future<Void> commitBatcher(ProxyCommitData* commitData,
 						}
 					}
 
-					if ((batchBytes + bytes > CLIENT_KNOBS->TRANSACTION_SIZE_LIMIT || req.firstInBatch()) &&
+					bool isLargeTransaction = SERVER_KNOBS->COMMIT_LARGE_TRANSACTION_BYTES > 0 &&
+					                          bytes >= SERVER_KNOBS->COMMIT_LARGE_TRANSACTION_BYTES;
+					if ((batchBytes + bytes > CLIENT_KNOBS->TRANSACTION_SIZE_LIMIT || req.firstInBatch() ||
+					     isLargeTransaction) &&
 					    batch.size()) {
 						out.send({ std::move(batch), batchBytes });
 						lastBatch = now();
@@ -429,6 +432,18 @@ ACTOR Future<Void> commitBatcher(ProxyCommitData* commitData,
 					batch.push_back(req);
 					batchBytes += bytes;
 					commitData->commitBatchesMemBytesCount += bytes;
+
+					if (isLargeTransaction) {
+						// Give the large transaction a version batch (and therefore a tLog push)
+						// of its own, so small transactions never wait behind it in commitBatch's
+						// serial phases.
+						CODE_PROBE(true, "Large transaction isolated into its own commit batch");
+						out.send({ std::move(batch), batchBytes });
+						lastBatch = now();
+						timeout = delayJittered(commitData->commitBatchInterval, TaskPriority::ProxyCommitBatcher);
+						batch.clear();
+						batchBytes = 0;
+					}
 				}
 				when(wait(timeout)) {}
 			}
@@ -1753,14 +1768,38 @@ ACTOR Future<Void> reply(CommitBatchContext* self) {
 	}
 
 	// Dynamic batching for commits
-	double target_latency =
-	    (now() - self->startTime) * SERVER_KNOBS->COMMIT_TRANSACTION_BATCH_INTERVAL_LATENCY_FRACTION;
-	pProxyCommitData->commitBatchInterval =
-	    std::max(SERVER_KNOBS->COMMIT_TRANSACTION_BATCH_INTERVAL_MIN,
-	             std::min(SERVER_KNOBS->COMMIT_TRANSACTION_BATCH_INTERVAL_MAX,
-	                      target_latency * SERVER_KNOBS->COMMIT_TRANSACTION_BATCH_INTERVAL_SMOOTHER_ALPHA +
-	                          pProxyCommitData->commitBatchInterval *
-	                              (1 - SERVER_KNOBS->COMMIT_TRANSACTION_BATCH_INTERVAL_SMOOTHER_ALPHA)));
+	if (SERVER_KNOBS->COMMIT_BATCH_LATENCY_TARGET > 0) {
+		// Closed loop: hold the p99 of recent batch durations at the target by widening the
+		// batching window while under it (more batching per commit) and shrinking it when over.
+		// COMMIT_TRANSACTION_BATCH_INTERVAL_MIN/MAX remain hard bounds in either direction.
+		pProxyCommitData->commitBatchDurations.addSample(now() - self->startTime);
+		if (now() - pProxyCommitData->lastCommitBatchIntervalAdjust >
+		        SERVER_KNOBS->COMMIT_BATCH_LATENCY_CONTROL_INTERVAL &&
+		    pProxyCommitData->commitBatchDurations.getPopulationSize() >= 10) {
+			double p99 = pProxyCommitData->commitBatchDurations.percentile(0.99);
+			double interval = pProxyCommitData->commitBatchInterval;
+			if (p99 > SERVER_KNOBS->COMMIT_BATCH_LATENCY_TARGET) {
+				interval /= 1 + SERVER_KNOBS->COMMIT_BATCH_LATENCY_CONTROL_STEP;
+			} else if (p99 < SERVER_KNOBS->COMMIT_BATCH_LATENCY_TARGET *
+			                     (1 - SERVER_KNOBS->COMMIT_BATCH_LATENCY_CONTROL_STEP)) {
+				interval *= 1 + SERVER_KNOBS->COMMIT_BATCH_LATENCY_CONTROL_STEP;
+			}
+			pProxyCommitData->commitBatchInterval =
+			    std::max(SERVER_KNOBS->COMMIT_TRANSACTION_BATCH_INTERVAL_MIN,
+			             std::min(SERVER_KNOBS->COMMIT_TRANSACTION_BATCH_INTERVAL_MAX, interval));
+			pProxyCommitData->commitBatchDurations.clear();
+			pProxyCommitData->lastCommitBatchIntervalAdjust = now();
+		}
+	} else {
+		double target_latency =
+		    (now() - self->startTime) * SERVER_KNOBS->COMMIT_TRANSACTION_BATCH_INTERVAL_LATENCY_FRACTION;
+		pProxyCommitData->commitBatchInterval =
+		    std::max(SERVER_KNOBS->COMMIT_TRANSACTION_BATCH_INTERVAL_MIN,
+		             std::min(SERVER_KNOBS->COMMIT_TRANSACTION_BATCH_INTERVAL_MAX,
+		                      target_latency * SERVER_KNOBS->COMMIT_TRANSACTION_BATCH_INTERVAL_SMOOTHER_ALPHA +
+		                          pProxyCommitData->commitBatchInterval *
+		                              (1 - SERVER_KNOBS->COMMIT_TRANSACTION_BATCH_INTERVAL_SMOOTHER_ALPHA)));
+	}
 
 	pProxyCommitData->stats.commitBatchingWindowSize.addMeasurement(pProxyCommitData->commitBatchInterval);
 	pProxyCommitData->commitBatchesMemBytesCount -= self->currentBatchMemBytesCount;
@@ -1890,42 +1929,49 @@ ACTOR static Future<Void> doKeyServerLocationRequest(GetKeyServerLocationsReques
 		}
 	}
 
+	// Location requests are the most frequent lookup against keyInfo, and keyInfo only changes when shard
+	// assignments change, so they are served from a flat snapshot that is rebuilt at most once per change.
+	if (!commitData->keyInfoSnapshot.upToDate(commitData->keyInfo)) {
+		commitData->keyInfoSnapshot.rebuild(commitData->keyInfo);
+	}
+	auto& keyInfoSnapshot = commitData->keyInfoSnapshot;
+
 	if (!req.end.present()) {
-		auto r = req.reverse ? commitData->keyInfo.rangeContainingKeyBefore(req.begin)
-		                     : commitData->keyInfo.rangeContaining(req.begin);
+		int r = req.reverse ? keyInfoSnapshot.rangeContainingKeyBefore(req.begin)
+		                    : keyInfoSnapshot.rangeContaining(req.begin);
 		std::vector<StorageServerInterface> ssis;
-		ssis.reserve(r.value().src_info.size());
-		for (auto& it : r.value().src_info) {
+		ssis.reserve(keyInfoSnapshot.valueAt(r).src_info.size());
+		for (auto& it : keyInfoSnapshot.valueAt(r).src_info) {
 			ssis.push_back(it->interf);
 			maybeAddTssMapping(rep, commitData, tssMappingsIncluded, it->interf.id());
 		}
-		rep.results.emplace_back(r.range(), ssis);
+		rep.results.emplace_back(keyInfoSnapshot.rangeAt(r), ssis);
 	} else if (!req.reverse) {
 		int count = 0;
-		for (auto r = commitData->keyInfo.rangeContaining(req.begin);
-		     r != commitData->keyInfo.ranges().end() && count < req.limit && r.begin() < req.end.get();
+		for (int r = keyInfoSnapshot.rangeContaining(req.begin);
+		     r < keyInfoSnapshot.size() && count < req.limit && keyInfoSnapshot.rangeAt(r).begin < req.end.get();
 		     ++r) {
 			std::vector<StorageServerInterface> ssis;
-			ssis.reserve(r.value().src_info.size());
-			for (auto& it : r.value().src_info) {
+			ssis.reserve(keyInfoSnapshot.valueAt(r).src_info.size());
+			for (auto& it : keyInfoSnapshot.valueAt(r).src_info) {
 				ssis.push_back(it->interf);
 				maybeAddTssMapping(rep, commitData, tssMappingsIncluded, it->interf.id());
 			}
-			rep.results.emplace_back(r.range(), ssis);
+			rep.results.emplace_back(keyInfoSnapshot.rangeAt(r), ssis);
 			count++;
 		}
 	} else {
 		int count = 0;
-		auto r = commitData->keyInfo.rangeContainingKeyBefore(req.end.get());
-		while (count < req.limit && req.begin < r.end()) {
+		int r = keyInfoSnapshot.rangeContainingKeyBefore(req.end.get());
+		while (count < req.limit && req.begin < keyInfoSnapshot.rangeAt(r).end) {
 			std::vector<StorageServerInterface> ssis;
-			ssis.reserve(r.value().src_info.size());
-			for (auto& it : r.value().src_info) {
+			ssis.reserve(keyInfoSnapshot.valueAt(r).src_info.size());
+			for (auto& it : keyInfoSnapshot.valueAt(r).src_info) {
 				ssis.push_back(it->interf);
 				maybeAddTssMapping(rep, commitData, tssMappingsIncluded, it->interf.id());
 			}
-			rep.results.emplace_back(r.range(), ssis);
-			if (r == commitData->keyInfo.ranges().begin()) {
+			rep.results.emplace_back(keyInfoSnapshot.rangeAt(r), ssis);
+			if (r == 0) {
 				break;
 			}
 			count++;
@@ -2055,6 +2101,54 @@ ACTOR Future<Void> ddMetricsRequestServer(CommitProxyInterface proxy, Reference<
 	}
 }
 
+ACTOR Future<Void> shardCountsRequestServer(CommitProxyInterface proxy, ProxyCommitData* commitData) {
+	loop {
+		GetShardCountsRequest req = waitNext(proxy.getShardCounts.getFuture());
+
+		// A single synchronous pass over the proxy's authoritative key-to-server map. This aggregates
+		// hundreds of thousands of shards down to one row per storage server and per team, so fleet
+		// tooling never has to pull the raw \xff/keyServers rows. No waits: keyInfo can mutate across
+		// them, and clients cache the result, so this runs at most once per polling interval.
+		std::unordered_map<UID, int64_t> serverShards;
+		std::map<std::string, int64_t> teamShards;
+		int64_t totalShards = 0;
+		for (auto r : commitData->keyInfo.ranges()) {
+			const auto& src = r.value().src_info;
+			if (src.empty()) {
+				continue;
+			}
+			++totalShards;
+			std::vector<UID> team;
+			team.reserve(src.size());
+			for (const auto& info : src) {
+				serverShards[info->interf.id()]++;
+				team.push_back(info->interf.id());
+			}
+			std::sort(team.begin(), team.end());
+			std::string teamName;
+			for (const auto& id : team) {
+				if (!teamName.empty())
+					teamName += ',';
+				teamName += id.toString();
+			}
+			teamShards[teamName]++;
+		}
+
+		// Rows are emitted in lexicographic key order: server/... < team/... < total
+		GetShardCountsReply reply;
+		reply.counts.reserve(serverShards.size() + teamShards.size() + 1);
+		std::map<UID, int64_t> sortedServerShards(serverShards.begin(), serverShards.end());
+		for (const auto& [id, shards] : sortedServerShards) {
+			reply.counts.emplace_back(Key(StringRef("server/" + id.toString())), shards);
+		}
+		for (const auto& [team, shards] : teamShards) {
+			reply.counts.emplace_back(Key(StringRef("team/" + team)), shards);
+		}
+		reply.counts.emplace_back(Key("total"_sr), totalShards);
+		req.reply.send(reply);
+	}
+}
+
 ACTOR Future<Void> monitorRemoteCommitted(ProxyCommitData* self) {
 	loop {
 		wait(delay(0)); // allow this actor to be cancelled if we are removed after db changes.
@@ -2518,7 +2612,13 @@ ACTOR Future<Void> commitProxyServerCore(CommitProxyInterface proxy,
 	addActor.send(readRequestServer(proxy, addActor, &commitData));
 	addActor.send(rejoinServer(proxy, &commitData));
 	addActor.send(ddMetricsRequestServer(proxy, db));
+	addActor.send(shardCountsRequestServer(proxy, &commitData));
 	addActor.send(reportTxnTagCommitCost(proxy.id(), db, &commitData.ssTrTagCommitCost));
+	if (SERVER_KNOBS->ENABLE_TLOG_ENCRYPTION) {
+		// Keep cipher keys for the domains this proxy commits to warm, so commit batches don't block on
+		// EncryptKeyProxy round trips when cached keys hit their TTL
+		addActor.send(refreshEncryptCipherKeys(db));
+	}
 
 	// wait for txnStateStore recovery
 	wait(success(commitData.txnStateStore->readValue(StringRef())));
@@ -321,8 +321,15 @@ class ConfigBroadcasterImpl {
 
 		impl->actors.add(registerNodeInternal(impl, w, lastSeenVersion));
 
-		// Push full snapshot to worker if it isn't up to date.
-		wait(impl->pushSnapshot(impl->mostRecentVersion, client));
+		// Catch the worker up. If the retained mutation history still covers the worker's last seen version, push
+		// just the changes since then; a full snapshot is only needed when the gap has been compacted away.
+		if (client.lastSeenVersion >= impl->lastCompactedVersion) {
+			CODE_PROBE(client.lastSeenVersion < impl->mostRecentVersion,
+			           "Re-registering worker caught up with changes instead of a snapshot");
+			wait(impl->pushChanges(client, impl->mutationHistory));
+		} else {
+			wait(impl->pushSnapshot(impl->mostRecentVersion, client));
+		}
 		impl->clients[broadcastInterface.id()] = client;
 		impl->clientFailures[broadcastInterface.id()] =
 		    waitForFailure(impl, watcher, broadcastInterface.id(), w.address());
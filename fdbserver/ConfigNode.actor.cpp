@@ -247,25 +247,39 @@ class ConfigNodeImpl {
 			req.reply.sendError(transaction_too_old());
 			return Void();
 		}
-		state Optional<Value> serializedValue =
-		    wait(self->kvStore->readValue(BinaryWriter::toValue(req.key, IncludeVersion()).withPrefix(kvKeys.begin)));
-		state Optional<KnobValue> value;
-		if (serializedValue.present()) {
-			value = ObjectReader::fromStringRef<KnobValue>(serializedValue.get(), IncludeVersion());
+		// All requested keys are answered from the same snapshot and mutation log scan, so a
+		// batched read costs one round trip and one log scan regardless of the number of knobs
+		state std::vector<ConfigKey> keys;
+		keys.push_back(req.key);
+		keys.insert(keys.end(), req.additionalKeys.begin(), req.additionalKeys.end());
+		state std::vector<Optional<KnobValue>> values;
+		state int i;
+		for (i = 0; i < keys.size(); ++i) {
+			Optional<Value> serializedValue = wait(
+			    self->kvStore->readValue(BinaryWriter::toValue(keys[i], IncludeVersion()).withPrefix(kvKeys.begin)));
+			if (serializedValue.present()) {
+				values.push_back(ObjectReader::fromStringRef<KnobValue>(serializedValue.get(), IncludeVersion()));
+			} else {
+				values.push_back(Optional<KnobValue>{});
+			}
 		}
 		Standalone<VectorRef<VersionedConfigMutationRef>> versionedMutations =
 		    wait(getMutations(self, 0, req.generation.committedVersion));
 		for (const auto& versionedMutation : versionedMutations) {
 			const auto& mutation = versionedMutation.mutation;
-			if (mutation.getKey() == req.key) {
-				if (mutation.isSet()) {
-					value = mutation.getValue();
-				} else {
-					value = {};
+			for (int j = 0; j < keys.size(); ++j) {
+				if (mutation.getKey() == keys[j]) {
+					if (mutation.isSet()) {
+						values[j] = mutation.getValue();
+					} else {
+						values[j] = {};
+					}
 				}
 			}
 		}
-		req.reply.send(ConfigTransactionGetReply{ value });
+		ConfigTransactionGetReply reply{ values[0] };
+		reply.additionalValues.assign(values.begin() + 1, values.end());
+		req.reply.send(reply);
 		return Void();
 	}
 
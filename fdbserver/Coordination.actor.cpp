@@ -120,20 +120,43 @@ ACTOR Future<Void> localGenerationReg(GenerationRegInterface interf, OnDemandSto
 			TraceEvent("GenerationRegReadRequest")
 			    .detail("From", _req.reply.getEndpoint().getPrimaryAddress())
 			    .detail("K", _req.key);
-			state GenerationRegReadRequest req = _req;
-			Optional<Value> rawV = wait(store->readValue(req.key));
-			v = rawV.present() ? BinaryReader::fromStringRef<GenerationRegVal>(rawV.get(), IncludeVersion())
-			                   : GenerationRegVal();
-			TraceEvent("GenerationRegReadReply")
-			    .detail("RVSize", rawV.present() ? rawV.get().size() : -1)
-			    .detail("VWG", v.writeGen.generation);
-			if (v.readGen < req.gen) {
-				v.readGen = req.gen;
-				store->set(KeyValueRef(
-				    req.key, BinaryWriter::toValue(v, IncludeVersion(ProtocolVersion::withGenerationRegVal()))));
+			// Batch any reads that are already waiting, so one commit of the readGen advances covers all of them.
+			// No reply may be sent before the commit that makes its readGen durable.
+			state std::vector<GenerationRegReadRequest> batchedReads;
+			state std::vector<GenerationRegReadReply> batchedReplies;
+			state bool needCommit = false;
+			state int readIdx;
+			batchedReads.push_back(_req);
+			while (interf.read.getFuture().isReady()) {
+				batchedReads.push_back(interf.read.getFuture().pop());
+			}
+			for (readIdx = 0; readIdx < batchedReads.size(); readIdx++) {
+				Optional<Value> rawV = wait(store->readValue(batchedReads[readIdx].key));
+				v = rawV.present() ? BinaryReader::fromStringRef<GenerationRegVal>(rawV.get(), IncludeVersion())
+				                   : GenerationRegVal();
+				TraceEvent("GenerationRegReadReply")
+				    .detail("RVSize", rawV.present() ? rawV.get().size() : -1)
+				    .detail("VWG", v.writeGen.generation);
+				if (v.readGen < batchedReads[readIdx].gen) {
+					v.readGen = batchedReads[readIdx].gen;
+					store->set(KeyValueRef(
+					    batchedReads[readIdx].key,
+					    BinaryWriter::toValue(v, IncludeVersion(ProtocolVersion::withGenerationRegVal()))));
+					needCommit = true;
+				}
+				batchedReplies.push_back(GenerationRegReadReply(v.val, v.writeGen, v.readGen));
+			}
+			if (needCommit) {
 				wait(store->commit());
 			}
-			req.reply.send(GenerationRegReadReply(v.val, v.writeGen, v.readGen));
+			if (batchedReads.size() > 1) {
+				CODE_PROBE(true, "Batched generation register reads shared one commit");
+			}
+			for (readIdx = 0; readIdx < batchedReads.size(); readIdx++) {
+				batchedReads[readIdx].reply.send(batchedReplies[readIdx]);
+			}
+			batchedReads.clear();
+			batchedReplies.clear();
 		}
 		when(GenerationRegWriteRequest _wrq = waitNext(interf.write.getFuture())) {
 			state GenerationRegWriteRequest wrq = _wrq;
@@ -226,6 +226,9 @@ public:
 			}
 
 			int64_t bestLoadBytes = 0;
+			double bestLoadScore = 0;
+			Reference<TCTeamInfo> lowestScoreTeam; // lowest multi-dimensional load score among candidates
+			double lowestLoadScore = 0;
 			bool wigglingBestOption = false; // best option contains server in paused wiggle state
 			Optional<Reference<IDataDistributionTeam>> bestOption;
 			std::vector<Reference<TCTeamInfo>> randomTeams;
@@ -270,6 +273,19 @@ public:
 					    (!req.preferLowerDiskUtil ||
 					     self->teams[currentIndex]->hasHealthyAvailableSpace(self->medianAvailableSpace))) {
 						int64_t loadBytes = self->teams[currentIndex]->getLoadBytes(true, req.inflightPenalty);
+						double loadScore = 0;
+						if (SERVER_KNOBS->DD_LOAD_AWARE_PLACEMENT != 0) {
+							loadScore = self->teams[currentIndex]->getLoadScore(true, req.inflightPenalty);
+							if (!lowestScoreTeam.isValid() || loadScore < lowestLoadScore) {
+								lowestLoadScore = loadScore;
+								lowestScoreTeam = self->teams[currentIndex];
+							}
+							if (SERVER_KNOBS->DD_LOAD_AWARE_PLACEMENT == 2) {
+								// Active mode: penalize candidates in proportion to their busiest load axis
+								loadBytes = (int64_t)(loadBytes *
+								                      (1.0 + SERVER_KNOBS->DD_LOAD_SCORE_WEIGHT * loadScore));
+							}
+						}
 						if ((!req.teamMustHaveShards ||
 						     self->shardsAffectedByTeamFailure->hasShards(ShardsAffectedByTeamFailure::Team(
 						         self->teams[currentIndex]->getServerIDs(), self->primary))) &&
@@ -284,6 +300,7 @@ public:
 								continue;
 							}
 							bestLoadBytes = loadBytes;
+							bestLoadScore = loadScore;
 							bestOption = self->teams[currentIndex];
 							bestIndex = currentIndex;
 							wigglingBestOption = self->teams[bestIndex]->hasWigglePausedServer();
@@ -331,6 +348,18 @@ public:
 
 				for (int i = 0; i < randomTeams.size(); i++) {
 					int64_t loadBytes = randomTeams[i]->getLoadBytes(true, req.inflightPenalty);
+					double loadScore = 0;
+					if (SERVER_KNOBS->DD_LOAD_AWARE_PLACEMENT != 0) {
+						loadScore = randomTeams[i]->getLoadScore(true, req.inflightPenalty);
+						if (!lowestScoreTeam.isValid() || loadScore < lowestLoadScore) {
+							lowestLoadScore = loadScore;
+							lowestScoreTeam = randomTeams[i];
+						}
+						if (SERVER_KNOBS->DD_LOAD_AWARE_PLACEMENT == 2) {
+							// Active mode: penalize candidates in proportion to their busiest load axis
+							loadBytes = (int64_t)(loadBytes * (1.0 + SERVER_KNOBS->DD_LOAD_SCORE_WEIGHT * loadScore));
+						}
+					}
 					if (!bestOption.present() ||
 					    req.lessCompare(bestOption.get(), randomTeams[i], bestLoadBytes, loadBytes)) {
 
@@ -341,12 +370,26 @@ public:
 						}
 
 						bestLoadBytes = loadBytes;
+						bestLoadScore = loadScore;
 						bestOption = randomTeams[i];
 						wigglingBestOption = randomTeams[i]->hasWigglePausedServer();
 					}
 				}
 			}
 
+			// Shadow mode: score candidates on the multi-dimensional load vector without changing the
+			// placement decision, so the scoring can be validated against real clusters before active
+			// mode (DD_LOAD_AWARE_PLACEMENT == 2) is enabled
+			if (SERVER_KNOBS->DD_LOAD_AWARE_PLACEMENT == 1 && bestOption.present() && lowestScoreTeam.isValid() &&
+			    bestOption.get().getPtr() != static_cast<IDataDistributionTeam*>(lowestScoreTeam.getPtr())) {
+				TraceEvent("GetTeamLoadScoreShadow", self->distributorId)
+				    .suppressFor(5.0)
+				    .detail("ChosenTeam", bestOption.get()->getTeamID())
+				    .detail("ChosenLoadScore", bestLoadScore)
+				    .detail("LowestScoreTeam", lowestScoreTeam->getTeamID())
+				    .detail("LowestLoadScore", lowestLoadScore);
+			}
+
 			// Note: req.completeSources can be empty and all servers (and server teams) can be unhealthy.
 			// We will get stuck at this! This only happens when a DC fails. No need to consider it right now.
 			// Note: this block does not apply any filters from the request
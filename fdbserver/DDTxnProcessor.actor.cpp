@@ -126,6 +126,139 @@ class DDTxnProcessorImpl {
 		return Void();
 	}
 
+	// Reads the keyServers decomposition of one partition of the keyspace and appends the
+	// resulting shards, in key order, to *output. Partitions other than the first may begin in
+	// the middle of a shard; that clipped leading fragment already belongs to the preceding
+	// partition's output, so it is dropped unless the partition boundary is a real shard
+	// boundary (i.e. an exact keyServers key exists for it).
+	ACTOR static Future<Void> getInitialShardsForPartition(
+	    Database cx,
+	    UID distributorId,
+	    MoveKeysLock moveKeysLock,
+	    const DDEnabledState* ddEnabledState,
+	    KeyRange keys,
+	    std::vector<Optional<Key>> remoteDcIds,
+	    Reference<InitialDataDistribution> result,
+	    std::map<UID, Optional<Key>>* server_dc,
+	    std::map<std::vector<UID>, std::pair<std::vector<UID>, std::vector<UID>>>* team_cache,
+	    std::vector<DDShardInfo>* output) {
+		state Key beginKey = keys.begin;
+		state bool isFirstChunk = true;
+		state bool succeeded;
+		state Transaction tr(cx);
+
+		while (beginKey < keys.end) {
+			loop {
+				succeeded = false;
+				try {
+					tr.setOption(FDBTransactionOptions::PRIORITY_SYSTEM_IMMEDIATE);
+					wait(checkMoveKeysLockReadOnly(&tr, moveKeysLock, ddEnabledState));
+					state Future<Optional<Value>> partitionBoundary;
+					if (isFirstChunk && beginKey > allKeys.begin) {
+						partitionBoundary = tr.get(keyServersKey(beginKey));
+					} else {
+						partitionBoundary = Optional<Value>();
+					}
+					state RangeResult UIDtoTagMap = wait(tr.getRange(serverTagKeys, CLIENT_KNOBS->TOO_MANY));
+					ASSERT(!UIDtoTagMap.more && UIDtoTagMap.size() < CLIENT_KNOBS->TOO_MANY);
+					state RangeResult keyServers = wait(krmGetRanges(&tr,
+					                                                 keyServersPrefix,
+					                                                 KeyRangeRef(beginKey, keys.end),
+					                                                 SERVER_KNOBS->MOVE_KEYS_KRM_LIMIT,
+					                                                 SERVER_KNOBS->MOVE_KEYS_KRM_LIMIT_BYTES));
+					Optional<Value> boundaryValue = wait(partitionBoundary);
+					succeeded = true;
+
+					std::vector<UID> src, dest;
+					UID srcId, destId;
+					int firstShard = 0;
+					if (isFirstChunk && beginKey > allKeys.begin && !boundaryValue.present()) {
+						CODE_PROBE(true, "DD initial scan partition begins mid-shard");
+						firstShard = 1;
+					}
+
+					// for each range
+					for (int i = firstShard; i < keyServers.size() - 1; i++) {
+						decodeKeyServersValue(UIDtoTagMap, keyServers[i].value, src, dest, srcId, destId);
+						DDShardInfo info(keyServers[i].key, srcId, destId);
+						if (remoteDcIds.size()) {
+							auto srcIter = team_cache->find(src);
+							if (srcIter == team_cache->end()) {
+								for (auto& id : src) {
+									auto& dc = (*server_dc)[id];
+									if (std::find(remoteDcIds.begin(), remoteDcIds.end(), dc) != remoteDcIds.end()) {
+										info.remoteSrc.push_back(id);
+									} else {
+										info.primarySrc.push_back(id);
+									}
+								}
+								result->primaryTeams.insert(info.primarySrc);
+								result->remoteTeams.insert(info.remoteSrc);
+								(*team_cache)[src] = std::make_pair(info.primarySrc, info.remoteSrc);
+							} else {
+								info.primarySrc = srcIter->second.first;
+								info.remoteSrc = srcIter->second.second;
+							}
+							if (dest.size()) {
+								info.hasDest = true;
+								auto destIter = team_cache->find(dest);
+								if (destIter == team_cache->end()) {
+									for (auto& id : dest) {
+										auto& dc = (*server_dc)[id];
+										if (std::find(remoteDcIds.begin(), remoteDcIds.end(), dc) !=
+										    remoteDcIds.end()) {
+											info.remoteDest.push_back(id);
+										} else {
+											info.primaryDest.push_back(id);
+										}
+									}
+									result->primaryTeams.insert(info.primaryDest);
+									result->remoteTeams.insert(info.remoteDest);
+									(*team_cache)[dest] = std::make_pair(info.primaryDest, info.remoteDest);
+								} else {
+									info.primaryDest = destIter->second.first;
+									info.remoteDest = destIter->second.second;
+								}
+							}
+						} else {
+							info.primarySrc = src;
+							auto srcIter = team_cache->find(src);
+							if (srcIter == team_cache->end()) {
+								result->primaryTeams.insert(src);
+								(*team_cache)[src] = std::pair<std::vector<UID>, std::vector<UID>>();
+							}
+							if (dest.size()) {
+								info.hasDest = true;
+								info.primaryDest = dest;
+								auto destIter = team_cache->find(dest);
+								if (destIter == team_cache->end()) {
+									result->primaryTeams.insert(dest);
+									(*team_cache)[dest] = std::pair<std::vector<UID>, std::vector<UID>>();
+								}
+							}
+						}
+						output->push_back(info);
+					}
+
+					ASSERT_GT(keyServers.size(), 0);
+					beginKey = keyServers.end()[-1].key;
+					isFirstChunk = false;
+					break;
+				} catch (Error& e) {
+					TraceEvent("GetInitialTeamsKeyServersRetry", distributorId).error(e);
+
+					wait(tr.onError(e));
+					ASSERT(!succeeded); // We shouldn't be retrying if we have already started modifying result in this
+					                    // loop
+				}
+			}
+
+			tr.reset();
+		}
+
+		return Void();
+	}
+
 	// Read keyservers, return unique set of teams
 	ACTOR static Future<Reference<InitialDataDistribution>> getInitialDataDistribution(
 	    Database cx,
@@ -134,7 +267,6 @@ class DDTxnProcessorImpl {
 	    std::vector<Optional<Key>> remoteDcIds,
 	    const DDEnabledState* ddEnabledState) {
 		state Reference<InitialDataDistribution> result = makeReference<InitialDataDistribution>();
-		state Key beginKey = allKeys.begin;
 
 		state bool succeeded;
 
@@ -247,103 +379,34 @@ class DDTxnProcessorImpl {
 			}
 		}
 
-		// If keyServers is too large to read in a single transaction, then we will have to break this process up into
-		// multiple transactions. In that case, each iteration should begin where the previous left off
-		while (beginKey < allKeys.end) {
-			CODE_PROBE(beginKey > allKeys.begin, "Multi-transactional getInitialDataDistribution");
-			loop {
-				succeeded = false;
-				try {
-					tr.setOption(FDBTransactionOptions::PRIORITY_SYSTEM_IMMEDIATE);
-					wait(checkMoveKeysLockReadOnly(&tr, moveKeysLock, ddEnabledState));
-					state RangeResult UIDtoTagMap = wait(tr.getRange(serverTagKeys, CLIENT_KNOBS->TOO_MANY));
-					ASSERT(!UIDtoTagMap.more && UIDtoTagMap.size() < CLIENT_KNOBS->TOO_MANY);
-					RangeResult keyServers = wait(krmGetRanges(&tr,
-					                                           keyServersPrefix,
-					                                           KeyRangeRef(beginKey, allKeys.end),
-					                                           SERVER_KNOBS->MOVE_KEYS_KRM_LIMIT,
-					                                           SERVER_KNOBS->MOVE_KEYS_KRM_LIMIT_BYTES));
-					succeeded = true;
-
-					std::vector<UID> src, dest, last;
-					UID srcId, destId;
-
-					// for each range
-					for (int i = 0; i < keyServers.size() - 1; i++) {
-						decodeKeyServersValue(UIDtoTagMap, keyServers[i].value, src, dest, srcId, destId);
-						DDShardInfo info(keyServers[i].key, srcId, destId);
-						if (remoteDcIds.size()) {
-							auto srcIter = team_cache.find(src);
-							if (srcIter == team_cache.end()) {
-								for (auto& id : src) {
-									auto& dc = server_dc[id];
-									if (std::find(remoteDcIds.begin(), remoteDcIds.end(), dc) != remoteDcIds.end()) {
-										info.remoteSrc.push_back(id);
-									} else {
-										info.primarySrc.push_back(id);
-									}
-								}
-								result->primaryTeams.insert(info.primarySrc);
-								result->remoteTeams.insert(info.remoteSrc);
-								team_cache[src] = std::make_pair(info.primarySrc, info.remoteSrc);
-							} else {
-								info.primarySrc = srcIter->second.first;
-								info.remoteSrc = srcIter->second.second;
-							}
-							if (dest.size()) {
-								info.hasDest = true;
-								auto destIter = team_cache.find(dest);
-								if (destIter == team_cache.end()) {
-									for (auto& id : dest) {
-										auto& dc = server_dc[id];
-										if (std::find(remoteDcIds.begin(), remoteDcIds.end(), dc) !=
-										    remoteDcIds.end()) {
-											info.remoteDest.push_back(id);
-										} else {
-											info.primaryDest.push_back(id);
-										}
-									}
-									result->primaryTeams.insert(info.primaryDest);
-									result->remoteTeams.insert(info.remoteDest);
-									team_cache[dest] = std::make_pair(info.primaryDest, info.remoteDest);
-								} else {
-									info.primaryDest = destIter->second.first;
-									info.remoteDest = destIter->second.second;
-								}
-							}
-						} else {
-							info.primarySrc = src;
-							auto srcIter = team_cache.find(src);
-							if (srcIter == team_cache.end()) {
-								result->primaryTeams.insert(src);
-								team_cache[src] = std::pair<std::vector<UID>, std::vector<UID>>();
-							}
-							if (dest.size()) {
-								info.hasDest = true;
-								info.primaryDest = dest;
-								auto destIter = team_cache.find(dest);
-								if (destIter == team_cache.end()) {
-									result->primaryTeams.insert(dest);
-									team_cache[dest] = std::pair<std::vector<UID>, std::vector<UID>>();
-								}
-							}
-						}
-						result->shards.push_back(info);
-					}
-
-					ASSERT_GT(keyServers.size(), 0);
-					beginKey = keyServers.end()[-1].key;
-					break;
-				} catch (Error& e) {
-					TraceEvent("GetInitialTeamsKeyServersRetry", distributorId).error(e);
-
-					wait(tr.onError(e));
-					ASSERT(!succeeded); // We shouldn't be retrying if we have already started modifying result in this
-					                    // loop
-				}
-			}
-
-			tr.reset();
+		// If keyServers is too large to read in a single transaction, it is read in chunks of
+		// MOVE_KEYS_KRM_LIMIT rows; scanning the partitions in parallel overlaps those round trips,
+		// which dominates DD initialization time on clusters with many shards. Each partition's
+		// shards land in their own vector and are concatenated in key order below.
+		state std::vector<std::vector<DDShardInfo>> partitionShards;
+		state std::vector<Future<Void>> partitionReads;
+		state int parallelism = std::min(128, std::max(1, SERVER_KNOBS->DD_INITIAL_SCAN_PARALLELISM));
+		CODE_PROBE(parallelism > 1, "Partitioned getInitialDataDistribution");
+		partitionShards.resize(parallelism);
+		for (int i = 0; i < parallelism; i++) {
+			uint8_t beginByte = i * 256 / parallelism;
+			uint8_t endByte = (i + 1) * 256 / parallelism;
+			Key partitionBegin = i == 0 ? allKeys.begin : Key(KeyRef(&beginByte, 1));
+			Key partitionEnd = i == parallelism - 1 ? allKeys.end : Key(KeyRef(&endByte, 1));
+			partitionReads.push_back(getInitialShardsForPartition(cx,
+			                                                      distributorId,
+			                                                      moveKeysLock,
+			                                                      ddEnabledState,
+			                                                      KeyRangeRef(partitionBegin, partitionEnd),
+			                                                      remoteDcIds,
+			                                                      result,
+			                                                      &server_dc,
+			                                                      &team_cache,
+			                                                      &partitionShards[i]));
+		}
+		wait(waitForAll(partitionReads));
+		for (auto& shards : partitionShards) {
+			result->shards.insert(result->shards.end(), shards.begin(), shards.end());
 		}
 
 		// a dummy shard at the end with no keys or servers makes life easier for trackInitialShards()
@@ -416,6 +416,12 @@ int getSrcWorkFactor(RelocateData const& relocation, int singleRegionTeamSize) {
 		return WORK_FULL_UTILIZATION / SERVER_KNOBS->RELOCATION_PARALLELISM_PER_SOURCE_SERVER;
 	else if (relocation.healthPriority == SERVER_KNOBS->PRIORITY_TEAM_2_LEFT)
 		return WORK_FULL_UTILIZATION / 2 / SERVER_KNOBS->RELOCATION_PARALLELISM_PER_SOURCE_SERVER;
+	else if (relocation.healthPriority == SERVER_KNOBS->PRIORITY_TEAM_CONTAINS_UNDESIRED_SERVER &&
+	         SERVER_KNOBS->RELOCATION_PARALLELISM_PER_SOURCE_SERVER_DRAIN > 0)
+		// Draining an excluded server funnels all of its shards through the teams that contain it; the healthy
+		// members of those teams can source more concurrent fetches than the steady-state default allows.
+		return WORK_FULL_UTILIZATION / singleRegionTeamSize /
+		       SERVER_KNOBS->RELOCATION_PARALLELISM_PER_SOURCE_SERVER_DRAIN;
 	else // for now we assume that any message at a lower priority can best be assumed to have a full team left for work
 		return WORK_FULL_UTILIZATION / singleRegionTeamSize / SERVER_KNOBS->RELOCATION_PARALLELISM_PER_SOURCE_SERVER;
 }
@@ -551,6 +557,9 @@ struct DDQueueData {
 	FlowLock finishMoveKeysParallelismLock;
 	FlowLock cleanUpDataMoveParallelismLock;
 	Reference<FlowLock> fetchSourceLock;
+	// Cluster-wide budget of relocation bytes in flight, so a few huge shard moves cannot occupy
+	// all the per-count relocation slots; health-critical moves bypass it
+	FlowLock moveBytesBudget;
 
 	int activeRelocations;
 	int queuedRelocations;
@@ -654,7 +663,9 @@ struct DDQueueData {
 	    startMoveKeysParallelismLock(SERVER_KNOBS->DD_MOVE_KEYS_PARALLELISM),
 	    finishMoveKeysParallelismLock(SERVER_KNOBS->DD_MOVE_KEYS_PARALLELISM),
 	    cleanUpDataMoveParallelismLock(SERVER_KNOBS->DD_MOVE_KEYS_PARALLELISM),
-	    fetchSourceLock(new FlowLock(SERVER_KNOBS->DD_FETCH_SOURCE_PARALLELISM)), activeRelocations(0),
+	    fetchSourceLock(new FlowLock(SERVER_KNOBS->DD_FETCH_SOURCE_PARALLELISM)),
+	    moveBytesBudget(std::max<int64_t>(1, SERVER_KNOBS->DD_MOVE_BYTES_IN_FLIGHT_BUDGET / 1000000)),
+	    activeRelocations(0),
 	    queuedRelocations(0), bytesWritten(0), teamSize(teamSize), singleRegionTeamSize(singleRegionTeamSize),
 	    output(output), input(input), getShardMetrics(getShardMetrics), getTopKMetrics(getTopKMetrics), lastInterval(0),
 	    suppressIntervals(0), rawProcessingUnhealthy(new AsyncVar<bool>(false)),
@@ -1037,6 +1048,12 @@ struct DDQueueData {
 		for (; it != combined.end(); it++) {
 			RelocateData rd(*it);
 
+			// This entry may have been absorbed into a neighboring relocation coalesced earlier in
+			// this pass, in which case it is no longer queued and must not be launched again
+			if (!rd.isRestore() && rd.src.size() && !queue[rd.src[0]].count(rd)) {
+				continue;
+			}
+
 			// Check if there is an inflight shard that is overlapped with the queued relocateShard (rd)
 			bool overlappingInFlight = false;
 			auto intersectingInFlight = inFlight.intersectingRanges(rd.keys);
@@ -1098,6 +1115,84 @@ struct DDQueueData {
 				}
 			}
 
+			// Coalesce key-adjacent queued relocations with the same source servers and priority into
+			// this relocation, so a contiguous run of shards (the common case when rebuilding after a
+			// host loss, where a whole team's shards requeue together) pays one
+			// startMoveKeys/finishMoveKeys transaction dance instead of one per shard. Not done for
+			// physical shard moves, where the range-to-shard-id mapping is per original shard.
+			if (!rd.isRestore() && rd.src.size() && rd.boundaryPriority == -1 &&
+			    !CLIENT_KNOBS->SHARD_ENCODE_LOCATION_METADATA && SERVER_KNOBS->DD_MOVE_COALESCE_LIMIT > 1) {
+				int coalesced = 1;
+				bool merging = true;
+				while (merging && coalesced < SERVER_KNOBS->DD_MOVE_COALESCE_LIMIT) {
+					merging = false;
+					for (int dir = 0; dir < 2 && coalesced < SERVER_KNOBS->DD_MOVE_COALESCE_LIMIT; dir++) {
+						bool extendRight = dir == 0;
+						if (extendRight ? rd.keys.end >= allKeys.end : rd.keys.begin <= allKeys.begin) {
+							continue;
+						}
+						auto nItr = queueMap.rangeContaining(extendRight ? rd.keys.end : rd.keys.begin);
+						if (!extendRight) {
+							if (nItr->range().begin != rd.keys.begin) {
+								continue; // left edge is not a queued relocation boundary
+							}
+							--nItr;
+						}
+						RelocateData q = nItr->value();
+						if (q.isRestore() || q.src != rd.src || q.priority != rd.priority ||
+						    q.healthPriority != rd.healthPriority || q.boundaryPriority != -1 ||
+						    q.reason != rd.reason || q.wantsNewServers != rd.wantsNewServers) {
+							continue;
+						}
+						if (extendRight ? q.keys.begin != rd.keys.end : q.keys.end != rd.keys.begin) {
+							continue;
+						}
+						if (q.keys != nItr->range() || !queue[q.src[0]].count(q)) {
+							continue; // stale queueMap value, or already launched / still fetching sources
+						}
+
+						// Do not absorb a range whose in-flight move has already finished fetching
+						bool overlappingInFlight = false;
+						auto intersectingInFlight = inFlight.intersectingRanges(q.keys);
+						for (auto f = intersectingInFlight.begin(); f != intersectingInFlight.end(); ++f) {
+							if (fetchKeysComplete.count(f->value()) && inFlightActors.liveActorAt(f->range().begin)) {
+								overlappingInFlight = true;
+								break;
+							}
+						}
+						if (overlappingInFlight) {
+							continue;
+						}
+
+						for (int i = 0; i < q.src.size(); i++) {
+							ASSERT(queue[q.src[i]].erase(q));
+						}
+						queuedRelocations--;
+						TraceEvent(SevVerbose, "QueuedRelocationsChanged")
+						    .detail("DataMoveID", q.dataMoveId)
+						    .detail("RandomID", q.randomId)
+						    .detail("Total", queuedRelocations);
+						finishRelocation(q.priority, q.healthPriority);
+
+						// Servers having the entire merged range are the intersection of both complete sets
+						std::set<UID> completeSrc(rd.completeSources.begin(), rd.completeSources.end());
+						std::vector<UID> sharedCompleteSources;
+						for (const auto& id : q.completeSources) {
+							if (completeSrc.count(id)) {
+								sharedCompleteSources.push_back(id);
+							}
+						}
+						rd.completeSources = sharedCompleteSources;
+
+						rd.keys = extendRight ? KeyRangeRef(rd.keys.begin, q.keys.end)
+						                      : KeyRangeRef(q.keys.begin, rd.keys.end);
+						coalesced++;
+						merging = true;
+						CODE_PROBE(true, "Coalesced adjacent queued relocations into one data move");
+					}
+				}
+			}
+
 			Future<Void> fCleanup =
 			    CLIENT_KNOBS->SHARD_ENCODE_LOCATION_METADATA ? cancelDataMove(this, rd.keys, ddEnabledState) : Void();
 
@@ -1316,6 +1411,20 @@ ACTOR Future<Void> dataDistributionRelocator(DDQueueData* self,
 		state StorageMetrics metrics =
 		    wait(brokenPromiseToNever(self->getShardMetrics.getReply(GetMetricsRequest(rd.keys))));
 
+		// Charge this move's size against the cluster-wide in-flight budget (in MB, since
+		// FlowLock::Releaser tracks its amount as an int) before picking a destination. Moves at or
+		// above PRIORITY_TEAM_UNHEALTHY skip the budget entirely so repair work is admitted
+		// immediately even when rebalancing has the budget saturated.
+		state FlowLock::Releaser moveBytesBudgetReleaser;
+		if (SERVER_KNOBS->DD_MOVE_BYTES_IN_FLIGHT_BUDGET > 0 &&
+		    rd.priority < SERVER_KNOBS->PRIORITY_TEAM_UNHEALTHY) {
+			state int64_t budgetMB = std::min<int64_t>(std::max<int64_t>(metrics.bytes / 1000000, 1),
+			                                           SERVER_KNOBS->DD_MOVE_BYTES_IN_FLIGHT_BUDGET / 1000000);
+			wait(self->moveBytesBudget.take(TaskPriority::DataDistributionLaunch, budgetMB));
+			moveBytesBudgetReleaser = FlowLock::Releaser(self->moveBytesBudget, budgetMB);
+			CODE_PROBE(self->moveBytesBudget.waiters() > 0, "Relocations queued on the move bytes budget");
+		}
+
 		ASSERT(rd.src.size());
 		loop {
 			destOverloadedCount = 0;
@@ -2338,6 +2447,8 @@ ACTOR Future<Void> dataDistributionQueue(Database cx,
 					    .detail("UnhealthyRelocations", self.unhealthyRelocations)
 					    .detail("HighestPriority", highestPriorityRelocation)
 					    .detail("BytesWritten", self.bytesWritten)
+					    .detail("MoveMBInFlight", self.moveBytesBudget.activePermits())
+					    .detail("MoveBudgetWaiters", self.moveBytesBudget.waiters())
 					    .detail("PriorityRecoverMove", self.priority_relocations[SERVER_KNOBS->PRIORITY_RECOVER_MOVE])
 					    .detail("PriorityRebalanceUnderutilizedTeam",
 					            self.priority_relocations[SERVER_KNOBS->PRIORITY_REBALANCE_UNDERUTILIZED_TEAM])
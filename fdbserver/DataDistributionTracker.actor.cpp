@@ -19,6 +19,7 @@
  */
 
 #include "fdbrpc/FailureMonitor.h"
+#include "fdbclient/ManagementAPI.actor.h"
 #include "fdbclient/SystemData.h"
 #include "fdbserver/DataDistribution.actor.h"
 #include "fdbserver/Knobs.h"
@@ -89,6 +90,9 @@ struct DataDistributionTracker {
 	// Read hot detection
 	PromiseStream<KeyRange> readHotShard;
 
+	// Read-hot ranges proposed for the storage cache
+	PromiseStream<KeyRange> cacheCandidate;
+
 	// The reference to trackerCancelled must be extracted by actors,
 	// because by the time (trackerCancelled == true) this memory cannot
 	// be accessed
@@ -329,6 +333,56 @@ ACTOR Future<Void> trackShardMetrics(DataDistributionTracker::SafeAccessor self,
 	}
 }
 
+// Immediately carve a detected read-hot sub-range out into its own shard instead of waiting for
+// the storage-metrics split path to notice the hot shard on its next averaging interval. The hot
+// piece is the skipped range in the split, so the hot data itself does not move; only the cold
+// edges of the shard relocate.
+void splitReadHotShard(DataDistributionTracker* self, KeyRange hotRange) {
+	auto shardItr = self->shards.rangeContaining(hotRange.begin);
+	KeyRange shard = shardItr->range();
+	if (!shard.contains(hotRange) || shard == hotRange) {
+		// The hot range spans a shard boundary (a later alert will see the current boundaries) or
+		// already is exactly one shard; there is nothing to carve out
+		return;
+	}
+	CODE_PROBE(true, "Fast split of a read-hot sub-range");
+
+	std::vector<KeyRange> pieces;
+	if (shard.begin < hotRange.begin) {
+		pieces.push_back(KeyRangeRef(shard.begin, hotRange.begin));
+	}
+	int skipRange = pieces.size();
+	pieces.push_back(hotRange);
+	if (hotRange.end < shard.end) {
+		pieces.push_back(KeyRangeRef(hotRange.end, shard.end));
+	}
+
+	TraceEvent("RelocateShardReadHotSplit", self->distributorId)
+	    .suppressFor(1.0)
+	    .detail("Begin", shard.begin)
+	    .detail("End", shard.end)
+	    .detail("HotBegin", hotRange.begin)
+	    .detail("HotEnd", hotRange.end)
+	    .detail("NumShards", pieces.size());
+
+	// Same nibbling order as shardSplitter: the queue can't deal with RelocateShard requests which
+	// split an existing shard into three pieces, and skipping the hot piece keeps it on its team
+	for (int i = 0; i < skipRange; i++)
+		restartShardTrackers(self, pieces[i]);
+	restartShardTrackers(self, pieces[skipRange]);
+	for (int i = pieces.size() - 1; i > skipRange; i--)
+		restartShardTrackers(self, pieces[i]);
+
+	for (int i = 0; i < skipRange; i++) {
+		self->shardsAffectedByTeamFailure->defineShard(pieces[i]);
+		self->output.send(RelocateShard(pieces[i], DataMovementReason::SPLIT_SHARD, RelocateReason::REBALANCE_READ));
+	}
+	for (int i = pieces.size() - 1; i > skipRange; i--) {
+		self->shardsAffectedByTeamFailure->defineShard(pieces[i]);
+		self->output.send(RelocateShard(pieces[i], DataMovementReason::SPLIT_SHARD, RelocateReason::REBALANCE_READ));
+	}
+}
+
 ACTOR Future<Void> readHotDetector(DataDistributionTracker* self) {
 	try {
 		loop {
@@ -345,6 +399,12 @@ ACTOR Future<Void> readHotDetector(DataDistributionTracker* self) {
 						    .detail("ReadDensityThreshold", SERVER_KNOBS->SHARD_MAX_READ_DENSITY_RATIO)
 						    .detail("KeyRangeBegin", keyRange.keys.begin)
 						    .detail("KeyRangeEnd", keyRange.keys.end);
+						if (SERVER_KNOBS->DD_FAST_READ_HOT_SPLIT) {
+							splitReadHotShard(self, keyRange.keys);
+						}
+						if (SERVER_KNOBS->DD_STORAGE_CACHE_ASSIGNMENT) {
+							self->cacheCandidate.send(keyRange.keys);
+						}
 					}
 					break;
 				} catch (Error& e) {
@@ -359,6 +419,72 @@ ACTOR Future<Void> readHotDetector(DataDistributionTracker* self) {
 	}
 }
 
+ACTOR Future<bool> anyCacheServers(Database cx) {
+	state Transaction tr(cx);
+	loop {
+		try {
+			tr.setOption(FDBTransactionOptions::READ_SYSTEM_KEYS);
+			RangeResult servers = wait(tr.getRange(storageCacheServerKeys, 1));
+			return !servers.empty();
+		} catch (Error& e) {
+			wait(tr.onError(e));
+		}
+	}
+}
+
+// Keeps the storage cache pointed at the read-hot portion of the keyspace. Ranges the read-hot
+// detector flags are registered as cached ranges, which the cache servers populate through their
+// private-mutation subscription and clients route to through the cached-range map; ranges that go
+// DD_STORAGE_CACHE_COOLDOWN seconds without another read-hot detection are dropped again. The
+// number of assigned ranges is capped by DD_STORAGE_CACHE_MAX_RANGES, and nothing is assigned
+// while the cluster has no cache servers.
+ACTOR Future<Void> storageCacheAssigner(DataDistributionTracker* self) {
+	state std::map<KeyRange, double, KeyRangeRef::ArbitraryOrder> cachedRanges; // range -> last read-hot detection
+	state Future<Void> cooldownCheck = delay(SERVER_KNOBS->DD_STORAGE_CACHE_COOLDOWN / 4);
+	try {
+		loop choose {
+			when(state KeyRange range = waitNext(self->cacheCandidate.getFuture())) {
+				auto cached = cachedRanges.find(range);
+				if (cached != cachedRanges.end()) {
+					cached->second = now();
+				} else if ((int)cachedRanges.size() < SERVER_KNOBS->DD_STORAGE_CACHE_MAX_RANGES) {
+					bool haveCacheServers = wait(anyCacheServers(self->cx));
+					if (haveCacheServers) {
+						wait(ManagementAPI::addCachedRange(self->cx.getReference(), range));
+						cachedRanges[range] = now();
+						TraceEvent("DDStorageCacheRangeAdded", self->distributorId)
+						    .detail("Begin", range.begin)
+						    .detail("End", range.end)
+						    .detail("CachedRanges", cachedRanges.size());
+					}
+				}
+			}
+			when(wait(cooldownCheck)) {
+				state std::vector<KeyRange> expired;
+				for (const auto& r : cachedRanges) {
+					if (now() - r.second > SERVER_KNOBS->DD_STORAGE_CACHE_COOLDOWN) {
+						expired.push_back(r.first);
+					}
+				}
+				state int i;
+				for (i = 0; i < expired.size(); i++) {
+					wait(ManagementAPI::removeCachedRange(self->cx.getReference(), expired[i]));
+					cachedRanges.erase(expired[i]);
+					TraceEvent("DDStorageCacheRangeRemoved", self->distributorId)
+					    .detail("Begin", expired[i].begin)
+					    .detail("End", expired[i].end)
+					    .detail("CachedRanges", cachedRanges.size());
+				}
+				cooldownCheck = delay(SERVER_KNOBS->DD_STORAGE_CACHE_COOLDOWN / 4);
+			}
+		}
+	} catch (Error& e) {
+		if (e.code() != error_code_actor_cancelled)
+			self->output.sendError(e); // Propagate failure to dataDistributionTracker
+		throw e;
+	}
+}
+
 /*
 ACTOR Future<Void> extrapolateShardBytes( Reference<AsyncVar<Optional<int64_t>>> inBytes,
 Reference<AsyncVar<Optional<int64_t>>> outBytes ) { state std::deque< std::pair<double,int64_t> > past; loop { wait(
@@ -1018,6 +1144,7 @@ ACTOR Future<Void> dataDistributionTracker(Reference<InitialDataDistribution> in
 	                                   *trackerCancelled);
 	state Future<Void> loggingTrigger = Void();
 	state Future<Void> readHotDetect = readHotDetector(&self);
+	state Future<Void> cacheAssigner = storageCacheAssigner(&self);
 	state Reference<EventCacheHolder> ddTrackerStatsEventHolder = makeReference<EventCacheHolder>("DDTrackerStats");
 	try {
 		wait(trackInitialShards(&self, initData));
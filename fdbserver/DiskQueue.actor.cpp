@@ -173,7 +173,8 @@ public:
 	  : basename(basename), fileExtension(fileExtension), dbgid(dbgid), dbg_file0BeginSeq(0),
 	    fileSizeWarningLimit(fileSizeWarningLimit), onError(delayed(error.getFuture())), onStopped(stopped.getFuture()),
 	    readyToPush(Void()), lastCommit(Void()), isFirstCommit(true), readingBuffer(dbgid), readingFile(-1),
-	    readingPage(-1), writingPos(-1), fileExtensionBytes(SERVER_KNOBS->DISK_QUEUE_FILE_EXTENSION_BYTES),
+	    readingPage(-1), readAheadBuffer(dbgid), readAheadFile(-1), readAheadPage(-1), writingPos(-1),
+	    fileExtensionBytes(SERVER_KNOBS->DISK_QUEUE_FILE_EXTENSION_BYTES),
 	    fileShrinkBytes(SERVER_KNOBS->DISK_QUEUE_FILE_SHRINK_BYTES) {
 		if (BUGGIFY)
 			fileExtensionBytes = _PAGE_SIZE * deterministicRandom()->randomSkewedUInt32(1, 10 << 10);
@@ -288,10 +289,20 @@ public:
 	                 // files[readingFile]. readingFile = 2 if recovery is complete (all files have been read).
 	int64_t readingPage; // Page within readingFile that is the next page after readingBuffer
 
+	// Prefetch of the chunk after readingBuffer during the recovery scan, so the next disk read
+	// overlaps with parsing of the current chunk. readingFile/readingPage are only advanced when the
+	// prefetched chunk is adopted, keeping truncateBeforeLastReadPage's position math unchanged.
+	StringBuffer readAheadBuffer;
+	Future<int> readAhead; // Invalid when no prefetch is outstanding
+	int readAheadFile; // readingFile's value once readAheadBuffer is adopted
+	int64_t readAheadPage; // readingPage's value once readAheadBuffer is adopted
+
 	int64_t writingPos; // Position within files[1] that will be next written
 
 	int64_t fileExtensionBytes;
 	int64_t fileShrinkBytes;
+	// In-flight proactive extension of the push file; pushes wait on it until it completes.
+	Future<Void> pendingExtension = Void();
 
 	Int64MetricHandle stallCount;
 
@@ -349,6 +360,12 @@ public:
 
 		state std::vector<Future<Void>> waitfor;
 
+		if (!self->pendingExtension.isReady()) {
+			// A proactive extension is still in flight; later writes may land in the region it
+			// covers, so this push (and the commit that syncs it) must wait for it.
+			waitfor.push_back(self->pendingExtension);
+		}
+
 		if (pageData.size() + self->writingPos > self->files[1].size) {
 			if (self->files[0].popped == self->files[0].size) {
 				// Finish self->files[1] and swap
@@ -429,6 +446,24 @@ public:
 		waitfor.push_back(self->files[1].f->write(pageData.begin(), pageData.size(), self->writingPos));
 		self->writingPos += pageData.size();
 
+		// Extend the file in the background before it fills so that the extension is off the
+		// critical path of a later push. Skipped when file 0 is fully popped, since the next
+		// overflow will swap files instead of extending.
+		if (SERVER_KNOBS->DISK_QUEUE_PREALLOCATE_EXTENTS && self->pendingExtension.isReady() &&
+		    self->files[0].popped < self->files[0].size &&
+		    self->files[1].size - self->writingPos < self->fileExtensionBytes / 2) {
+			self->files[1].size += std::min(self->fileExtensionBytes, self->files[0].size + self->files[1].size);
+			self->pendingExtension = self->files[1].f->truncate(self->files[1].size);
+			waitfor.push_back(self->pendingExtension);
+
+			if (self->fileSizeWarningLimit > 0 && self->files[1].size > self->fileSizeWarningLimit) {
+				TraceEvent(SevWarnAlways, "DiskQueueFileTooLarge", self->dbgid)
+				    .suppressFor(1.0)
+				    .detail("Filename", self->filename(1))
+				    .detail("Size", self->files[1].size);
+			}
+		}
+
 		return waitForAll(waitfor);
 	}
 
@@ -755,31 +790,67 @@ public:
 		return result;
 	}
 
-	Future<int> fillReadingBuffer() {
+	// Starts a read of the next chunk of the recovery scan at *file/*page into buffer, advancing
+	// *file/*page past the chunk. A ready 0 means the end of both files was reached.
+	Future<int> startBufferRead(StringBuffer& buffer, int* file, int64_t* page) {
 		// If we're right at the end of a file...
-		if (readingPage * sizeof(Page) >= (size_t)files[readingFile].size) {
-			readingFile++;
-			readingPage = 0;
-			if (readingFile >= 2) {
-				// Recovery complete
-				readingBuffer.clear();
-				writingPos = files[1].size;
+		if (*page * sizeof(Page) >= (size_t)files[*file].size) {
+			(*file)++;
+			*page = 0;
+			if (*file >= 2) {
+				buffer.clear();
 				return 0;
 			}
 		}
 
-		// Read up to 1MB into readingBuffer
-		int len = std::min<int64_t>((files[readingFile].size / sizeof(Page) - readingPage) * sizeof(Page),
+		// Read up to 1MB into buffer
+		int len = std::min<int64_t>((files[*file].size / sizeof(Page) - *page) * sizeof(Page),
 		                            BUGGIFY_WITH_PROB(1.0) ? sizeof(Page) * deterministicRandom()->randomInt(1, 4)
 		                                                   : (1 << 20));
-		readingBuffer.clear();
-		readingBuffer.alignReserve(sizeof(Page), len);
-		void* p = readingBuffer.append(len);
+		buffer.clear();
+		buffer.alignReserve(sizeof(Page), len);
+		void* p = buffer.append(len);
 
-		auto pos = readingPage * sizeof(Page);
-		readingPage += len / sizeof(Page);
+		auto pos = *page * sizeof(Page);
+		*page += len / sizeof(Page);
 		ASSERT(int64_t(p) % sizeof(Page) == 0);
-		return files[readingFile].f->read(p, len, pos);
+		return files[*file].f->read(p, len, pos);
+	}
+
+	// Holds a TrackMe for the prefetch read so shutdown waits for it before the buffer is freed.
+	ACTOR static UNCANCELLABLE Future<int> readAheadNextChunk(RawDiskQueue_TwoFiles* self) {
+		state TrackMe trackMe(self);
+		int bytes = wait(self->startBufferRead(self->readAheadBuffer, &self->readAheadFile, &self->readAheadPage));
+		return bytes;
+	}
+
+	Future<int> fillReadingBuffer() { return fillReadingBuffer(this); }
+
+	ACTOR static Future<int> fillReadingBuffer(RawDiskQueue_TwoFiles* self) {
+		state int bytes;
+		if (self->readAhead.isValid()) {
+			// Adopt the chunk prefetched while the previous buffer was being parsed.
+			int b = wait(self->readAhead);
+			bytes = b;
+			self->readAhead = Future<int>();
+			std::swap(self->readingBuffer, self->readAheadBuffer);
+			self->readingFile = self->readAheadFile;
+			self->readingPage = self->readAheadPage;
+		} else {
+			int b = wait(self->startBufferRead(self->readingBuffer, &self->readingFile, &self->readingPage));
+			bytes = b;
+		}
+		if (self->readingFile >= 2) {
+			// Recovery complete
+			self->writingPos = self->files[1].size;
+			return bytes;
+		}
+		if (SERVER_KNOBS->DISK_QUEUE_RECOVERY_READ_AHEAD && bytes > 0) {
+			self->readAheadFile = self->readingFile;
+			self->readAheadPage = self->readingPage;
+			self->readAhead = readAheadNextChunk(self);
+		}
+		return bytes;
 	}
 
 	ACTOR static UNCANCELLABLE Future<Standalone<StringRef>> readNextPage(RawDiskQueue_TwoFiles* self) {
@@ -845,6 +916,7 @@ public:
 
 			self->readingFile = 2;
 			self->readingBuffer.clear();
+			self->readAhead = Future<int>(); // Drop any outstanding prefetch; its read completes in the background.
 			self->writingPos = pos;
 
 			while (file < 2) {
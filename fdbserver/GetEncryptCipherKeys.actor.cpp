@@ -71,6 +71,13 @@ ACTOR Future<EKPGetLatestBaseCipherKeysReply> getUncachedLatestEncryptCipherKeys
 	}
 }
 
+// Encryption domains this process has requested latest cipher keys for, with owned copies of their names.
+// Consumed by refreshEncryptCipherKeys to keep the latest keys warm in the local cache.
+std::unordered_map<EncryptCipherDomainId, Standalone<StringRef>>& cipherKeyRefreshDomains() {
+	static std::unordered_map<EncryptCipherDomainId, Standalone<StringRef>> domains;
+	return domains;
+}
+
 } // anonymous namespace
 
 ACTOR Future<std::unordered_map<EncryptCipherDomainId, Reference<BlobCipherKey>>> getLatestEncryptCipherKeys(
@@ -87,6 +94,7 @@ ACTOR Future<std::unordered_map<EncryptCipherDomainId, Reference<BlobCipherKey>>
 
 	// Collect cached cipher keys.
 	for (auto& domain : domains) {
+		cipherKeyRefreshDomains()[domain.first] = Standalone<StringRef>(domain.second);
 		Reference<BlobCipherKey> cachedCipherKey = cipherKeyCache->getLatestCipherKey(domain.first /*domainId*/);
 		if (cachedCipherKey.isValid()) {
 			cipherKeys[domain.first] = cachedCipherKey;
@@ -225,6 +233,49 @@ ACTOR Future<std::unordered_map<BlobCipherDetails, Reference<BlobCipherKey>>> ge
 	return cipherKeys;
 }
 
+ACTOR Future<Void> refreshEncryptCipherKeys(Reference<AsyncVar<ServerDBInfo> const> db) {
+	state Reference<BlobCipherKeyCache> cipherKeyCache = BlobCipherKeyCache::getInstance();
+	state EKPGetLatestBaseCipherKeysRequest request;
+	loop {
+		wait(delay(FLOW_KNOBS->ENCRYPT_KEY_REFRESH_INTERVAL));
+		request = EKPGetLatestBaseCipherKeysRequest();
+		for (const auto& [domainId, domainName] : cipherKeyRefreshDomains()) {
+			Reference<BlobCipherKey> latest = cipherKeyCache->getLatestCipherKey(domainId);
+			// Re-fetch keys that would expire from the cache before the next refresh, so steady-state callers of
+			// getLatestEncryptCipherKeys keep hitting the cache instead of waiting on an EncryptKeyProxy round trip
+			if (!latest.isValid() || now() - latest->getCreationTime() + FLOW_KNOBS->ENCRYPT_KEY_REFRESH_INTERVAL >
+			                             FLOW_KNOBS->ENCRYPT_CIPHER_KEY_CACHE_TTL) {
+				request.encryptDomainInfos.emplace_back(domainId, domainName, request.arena);
+			}
+		}
+		if (request.encryptDomainInfos.empty()) {
+			continue;
+		}
+		try {
+			loop choose {
+				when(EKPGetLatestBaseCipherKeysReply reply = wait(getUncachedLatestEncryptCipherKeys(db, request))) {
+					for (const EKPBaseCipherDetails& details : reply.baseCipherDetails) {
+						cipherKeyCache->insertCipherKey(details.encryptDomainId,
+						                                details.baseCipherId,
+						                                details.baseCipherKey.begin(),
+						                                details.baseCipherKey.size());
+					}
+					CODE_PROBE(true, "Refreshed latest cipher keys ahead of cache TTL expiry");
+					break;
+				}
+				// In case encryptKeyProxy has changed, retry the request.
+				when(wait(onEncryptKeyProxyChange(db))) {}
+			}
+		} catch (Error& e) {
+			if (e.code() == error_code_actor_cancelled) {
+				throw;
+			}
+			// A failed refresh is not fatal: the next reader falls back to the on-demand fetch path
+			TraceEvent(SevWarn, "RefreshEncryptCipherKeysError").error(e);
+		}
+	}
+}
+
 ACTOR Future<TextAndHeaderCipherKeys> getLatestSystemEncryptCipherKeys(Reference<AsyncVar<ServerDBInfo> const> db) {
 	static std::unordered_map<EncryptCipherDomainId, EncryptCipherDomainName> domains = {
 		{ SYSTEM_KEYSPACE_ENCRYPT_DOMAIN_ID, FDB_DEFAULT_ENCRYPT_DOMAIN_NAME },
@@ -36,6 +36,9 @@ class GlobalTagThrottlerImpl {
 		Smoother totalWriteCostRate;
 		Smoother transactionCounter;
 		Smoother perClientRate;
+		double errorIntegral{ 0.0 };
+		double burstCredits{ 0.0 };
+		double lastUpdateTime{ -1.0 };
 
 		Optional<double> getReadTPSLimit() const {
 			if (totalReadCostRate.smoothTotal() > 0) {
@@ -101,10 +104,40 @@ class GlobalTagThrottlerImpl {
 		Optional<ClientTagThrottleLimits> updateAndGetPerClientLimit() {
 			auto targetRate = getTargetTotalTPSLimit();
 			if (targetRate.present() && transactionCounter.smoothRate() > 0) {
-				auto newPerClientRate = std::max(
-				    SERVER_KNOBS->GLOBAL_TAG_THROTTLING_MIN_RATE,
-				    std::min(targetRate.get(),
-				             (targetRate.get() / transactionCounter.smoothRate()) * perClientRate.smoothTotal()));
+				double const target = targetRate.get();
+				double const actual = transactionCounter.smoothRate();
+				double newPerClientRate;
+				if (SERVER_KNOBS->GLOBAL_TAG_THROTTLING_PI_KP > 0) {
+					double const dt = lastUpdateTime < 0 ? 0.0 : std::min(now() - lastUpdateTime, 10.0);
+					lastUpdateTime = now();
+
+					// Unused target rate accumulates as burst credit (a token bucket refilled at the
+					// target rate and capped at GLOBAL_TAG_THROTTLING_BURST_WINDOW seconds of it), so
+					// a tag idling below its quota may briefly exceed the target without triggering
+					// the tightening that causes sawtooth throughput on bursty workloads
+					burstCredits = std::max(
+					    0.0,
+					    std::min(burstCredits + (target - actual) * dt,
+					             target * SERVER_KNOBS->GLOBAL_TAG_THROTTLING_BURST_WINDOW));
+					double const effectiveTarget =
+					    target + (SERVER_KNOBS->GLOBAL_TAG_THROTTLING_BURST_WINDOW > 0
+					                  ? burstCredits / SERVER_KNOBS->GLOBAL_TAG_THROTTLING_BURST_WINDOW
+					                  : 0.0);
+
+					// PI controller on the normalized rate error; the damped proportional term
+					// removes the overshoot of the old gain-1 ratio update and the clamped integral
+					// term removes the steady-state offset it converged to
+					double const error = (effectiveTarget - actual) / std::max(effectiveTarget, 1.0);
+					errorIntegral = std::max(-2.0, std::min(2.0, errorIntegral + error * dt));
+					double const adjustment = 1.0 + SERVER_KNOBS->GLOBAL_TAG_THROTTLING_PI_KP * error +
+					                          SERVER_KNOBS->GLOBAL_TAG_THROTTLING_PI_KI * errorIntegral;
+					newPerClientRate =
+					    std::max(SERVER_KNOBS->GLOBAL_TAG_THROTTLING_MIN_RATE,
+					             std::min(effectiveTarget, perClientRate.smoothTotal() * std::max(0.1, adjustment)));
+				} else {
+					newPerClientRate = std::max(SERVER_KNOBS->GLOBAL_TAG_THROTTLING_MIN_RATE,
+					                            std::min(target, (target / actual) * perClientRate.smoothTotal()));
+				}
 				perClientRate.setTotal(newPerClientRate);
 				return ClientTagThrottleLimits(perClientRate.getTotal(), ClientTagThrottleLimits::NO_EXPIRATION);
 			} else {
@@ -114,7 +147,11 @@ class GlobalTagThrottlerImpl {
 
 		void processTraceEvent(TraceEvent& te) const {
 			if (quota.present()) {
-				te.detail("ProvidedReadTPSLimit", getReadTPSLimit())
+				te.detail("AchievedTPS", transactionCounter.smoothRate())
+				    .detail("TargetTPS", getTargetTotalTPSLimit())
+				    .detail("PerClientTPSLimit", perClientRate.smoothTotal())
+				    .detail("BurstCredits", burstCredits)
+				    .detail("ProvidedReadTPSLimit", getReadTPSLimit())
 				    .detail("ProvidedWriteTPSLimit", getWriteTPSLimit())
 				    .detail("ReadCostRate", totalReadCostRate.smoothTotal())
 				    .detail("WriteCostRate", totalWriteCostRate.smoothTotal())
@@ -707,6 +707,12 @@ ACTOR Future<GetReadVersionReply> getLiveCommittedVersion(SpanContext parentSpan
 	if (SERVER_KNOBS->ENABLE_VERSION_VECTOR) {
 		// TODO add to "status json"
 		grvProxyData->ssVersionVectorCache.applyDelta(repFromMaster.ssVersionVectorDelta);
+		if (grvProxyData->ssVersionVectorCache.size() > SERVER_KNOBS->VERSION_VECTOR_MAX_SIZE) {
+			// The master compacts retired tags out of its vector, but deltas never delete entries
+			// from this cache, so apply the same bound here
+			grvProxyData->ssVersionVectorCache.compact(repFromMaster.version -
+			                                           SERVER_KNOBS->MAX_READ_TRANSACTION_LIFE_VERSIONS);
+		}
 	}
 	grvProxyData->stats.grvGetCommittedVersionRpcDist->sampleSeconds(now() - grvConfirmEpochLive);
 	GetReadVersionReply rep;
@@ -749,6 +755,28 @@ ACTOR Future<Void> sendGrvReplies(Future<GetReadVersionReply> replyFuture,
 	Version replyVersion = reply.version;
 
 	double end = g_network->timer();
+
+	// These fields are the same for every request in the batch, so fill them in once rather than
+	// per reply.
+	reply.midShardSize = midShardSize;
+	reply.proxyId = grvProxyData->dbgid;
+	if (stats->lastBatchQueueThrottled) {
+		// Check if this throttling has been sustained for a certain amount of time to avoid false positives
+		if (now() - stats->batchThrottleStartTime > CLIENT_KNOBS->GRV_SUSTAINED_THROTTLING_THRESHOLD) {
+			reply.rkBatchThrottled = true;
+		}
+	}
+	if (stats->lastDefaultQueueThrottled) {
+		// Check if this throttling has been sustained for a certain amount of time to avoid false positives
+		if (now() - stats->defaultThrottleStartTime > CLIENT_KNOBS->GRV_SUSTAINED_THROTTLING_THRESHOLD) {
+			// Consider the batch queue throttled if the default is throttled
+			// to deal with a potential lull in activity for that priority.
+			// Avoids mistakenly thinking batch is unthrottled while default is still throttled.
+			reply.rkBatchThrottled = true;
+			reply.rkDefaultThrottled = true;
+		}
+	}
+
 	for (GetReadVersionRequest const& request : requests) {
 		double duration = end - request.requestTime();
 		if (request.priority == TransactionPriority::BATCH) {
@@ -769,13 +797,11 @@ ACTOR Future<Void> sendGrvReplies(Future<GetReadVersionReply> replyFuture,
 		} else {
 			reply.version = replyVersion;
 		}
-		reply.midShardSize = midShardSize;
 		reply.tagThrottleInfo.clear();
 		if (SERVER_KNOBS->ENABLE_VERSION_VECTOR) {
 			grvProxyData->ssVersionVectorCache.getDelta(request.maxVersion, reply.ssVersionVectorDelta);
 			grvProxyData->versionVectorSizeOnGRVReply.addMeasurement(reply.ssVersionVectorDelta.size());
 		}
-		reply.proxyId = grvProxyData->dbgid;
 
 		if (!request.tags.empty()) {
 			auto& priorityThrottledTags = throttledTags[request.priority];
@@ -798,22 +824,6 @@ ACTOR Future<Void> sendGrvReplies(Future<GetReadVersionReply> replyFuture,
 			}
 		}
 
-		if (stats->lastBatchQueueThrottled) {
-			// Check if this throttling has been sustained for a certain amount of time to avoid false positives
-			if (now() - stats->batchThrottleStartTime > CLIENT_KNOBS->GRV_SUSTAINED_THROTTLING_THRESHOLD) {
-				reply.rkBatchThrottled = true;
-			}
-		}
-		if (stats->lastDefaultQueueThrottled) {
-			// Check if this throttling has been sustained for a certain amount of time to avoid false positives
-			if (now() - stats->defaultThrottleStartTime > CLIENT_KNOBS->GRV_SUSTAINED_THROTTLING_THRESHOLD) {
-				// Consider the batch queue throttled if the default is throttled
-				// to deal with a potential lull in activity for that priority.
-				// Avoids mistakenly thinking batch is unthrottled while default is still throttled.
-				reply.rkBatchThrottled = true;
-				reply.rkDefaultThrottled = true;
-			}
-		}
 		request.reply.send(reply);
 		++stats->txnRequestOut;
 	}
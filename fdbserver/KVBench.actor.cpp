@@ -0,0 +1,210 @@
+/*
+ * KVBench.actor.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cinttypes>
+#include <fstream>
+#include <sstream>
+
+#include "fdbclient/NativeAPI.actor.h"
+#include "fdbserver/IKeyValueStore.h"
+#include "flow/Histogram.h"
+#include "flow/actorcompiler.h" // This must be the last #include.
+
+// The 'kvbench' role replays a recorded operation trace against any IKeyValueStore
+// implementation so that storage engines and knob settings can be compared on the
+// same workload.  The trace is a text file with one operation per line:
+//
+//   set <key> <value>
+//   clear <begin> <end>
+//   get <key>
+//   getrange <begin> <end> <rowLimit>
+//   commit
+//
+// Keys and values are escaped as produced by printable().  Blank lines and lines
+// starting with '#' are ignored.  Operations are replayed in order and each
+// read or commit is waited on before the next line is processed, so the reported
+// latencies are per-operation rather than pipelined.
+
+namespace {
+
+KeyValueStoreType parseStoreType(std::string const& storeTypeStr) {
+	for (uint32_t t = 0; t < KeyValueStoreType::END; t++) {
+		KeyValueStoreType type((KeyValueStoreType::StoreType)t);
+		if (type.toString() == storeTypeStr)
+			return type;
+	}
+	fprintf(stderr, "ERROR: Unknown storage engine type `%s'\n", storeTypeStr.c_str());
+	throw invalid_option_value();
+}
+
+// The physical write counters cover the whole device holding the store, so run
+// kvbench on an otherwise idle disk for a meaningful write amplification figure.
+uint64_t physicalWriteBytes(std::string const& directory) {
+	uint64_t currentIOs = 0, readMilliSecs = 0, writeMilliSecs = 0, IOMilliSecs = 0, reads = 0, writes = 0,
+	         writeSectors = 0;
+	getDiskStatistics(directory, currentIOs, readMilliSecs, writeMilliSecs, IOMilliSecs, reads, writes, writeSectors);
+	return writeSectors * 512;
+}
+
+} // namespace
+
+ACTOR Future<Void> KVBench(std::string traceFile, std::string storeTypeStr) {
+	if (!fileExists(traceFile))
+		throw file_not_found();
+
+	state KeyValueStoreType storeType = parseStoreType(storeTypeStr);
+	state std::vector<std::string> lines;
+	{
+		std::ifstream in(traceFile.c_str());
+		if (!in) {
+			fprintf(stderr, "ERROR: Could not open trace file `%s'\n", traceFile.c_str());
+			throw file_not_found();
+		}
+		std::string line;
+		while (std::getline(in, line))
+			lines.push_back(line);
+	}
+
+	state UID id = deterministicRandom()->randomUniqueID();
+	state std::string fn = format("kvbench-%s-%s", storeTypeStr.c_str(), id.toString().c_str());
+	state IKeyValueStore* store = openKVStore(storeType, fn, id, 500e6);
+	ASSERT(store != nullptr);
+	wait(store->init());
+
+	state Reference<Histogram> getLatency =
+	    Histogram::getHistogram("KVBench"_sr, "GetValue"_sr, Histogram::Unit::microseconds);
+	state Reference<Histogram> getRangeLatency =
+	    Histogram::getHistogram("KVBench"_sr, "GetRange"_sr, Histogram::Unit::microseconds);
+	state Reference<Histogram> commitLatency =
+	    Histogram::getHistogram("KVBench"_sr, "Commit"_sr, Histogram::Unit::microseconds);
+
+	state int64_t sets = 0, clears = 0, gets = 0, getRanges = 0, commits = 0;
+	state int64_t logicalWriteBytes = 0;
+	state int64_t logicalReadBytes = 0;
+	state double getSeconds = 0, getRangeSeconds = 0, commitSeconds = 0;
+	state uint64_t physicalWritesBefore = physicalWriteBytes(platform::getWorkingDirectory());
+	state double startTime = timer();
+	state int lineNo;
+	for (lineNo = 0; lineNo < (int)lines.size(); lineNo++) {
+		state std::string op;
+		state Key arg1;
+		state Key arg2;
+		state int rowLimit = 0;
+		{
+			std::istringstream ss(lines[lineNo]);
+			std::string a, b;
+			op.clear();
+			ss >> op;
+			if (op.empty() || op[0] == '#')
+				continue;
+			ss >> a >> b >> rowLimit;
+			arg1 = StringRef(unprintable(a));
+			arg2 = StringRef(unprintable(b));
+		}
+		state double opStart = timer();
+		if (op == "set") {
+			store->set(KeyValueRef(arg1, arg2));
+			logicalWriteBytes += arg1.size() + arg2.size();
+			++sets;
+		} else if (op == "clear") {
+			store->clear(KeyRangeRef(arg1, arg2));
+			++clears;
+		} else if (op == "get") {
+			Optional<Value> v = wait(store->readValue(arg1));
+			double elapsed = timer() - opStart;
+			getLatency->sampleSeconds(elapsed);
+			getSeconds += elapsed;
+			if (v.present())
+				logicalReadBytes += arg1.size() + v.get().size();
+			++gets;
+		} else if (op == "getrange") {
+			RangeResult r = wait(store->readRange(KeyRangeRef(arg1, arg2), rowLimit));
+			double elapsed = timer() - opStart;
+			getRangeLatency->sampleSeconds(elapsed);
+			getRangeSeconds += elapsed;
+			for (auto& kv : r)
+				logicalReadBytes += kv.key.size() + kv.value.size();
+			++getRanges;
+		} else if (op == "commit") {
+			wait(store->commit());
+			double elapsed = timer() - opStart;
+			commitLatency->sampleSeconds(elapsed);
+			commitSeconds += elapsed;
+			++commits;
+		} else {
+			fprintf(stderr, "ERROR: Unknown operation `%s' on line %d of `%s'\n", op.c_str(), lineNo + 1, traceFile.c_str());
+			throw file_corrupt();
+		}
+	}
+	// Make the tail of the trace durable so that the physical write and space
+	// measurements below cover every operation that was replayed.
+	wait(store->commit());
+	state double duration = timer() - startTime;
+
+	// Measure the logical size of the surviving key-value pairs for space amplification.
+	state int64_t liveBytes = 0;
+	state Key scanBegin;
+	loop {
+		RangeResult r = wait(store->readRange(KeyRangeRef(scanBegin, "\xff\xff\xff\xff"_sr), 1000));
+		for (auto& kv : r)
+			liveBytes += kv.key.size() + kv.value.size();
+		if (r.size() < 1000)
+			break;
+		scanBegin = keyAfter(r.back().key);
+	}
+
+	state uint64_t physicalWritesAfter = physicalWriteBytes(platform::getWorkingDirectory());
+	StorageBytes sb = store->getStorageBytes();
+
+	printf("Store type: %s\n", storeTypeStr.c_str());
+	printf("Replayed %" PRId64 " sets, %" PRId64 " clears, %" PRId64 " gets, %" PRId64 " getranges, %" PRId64
+	       " commits in %.3f sec\n",
+	       sets,
+	       clears,
+	       gets,
+	       getRanges,
+	       commits,
+	       duration);
+	printf("Throughput: %.0f ops/sec\n", (sets + clears + gets + getRanges + commits) / duration);
+	if (gets > 0)
+		printf("Mean get latency: %.1f us\n", 1e6 * getSeconds / gets);
+	if (getRanges > 0)
+		printf("Mean getrange latency: %.1f us\n", 1e6 * getRangeSeconds / getRanges);
+	if (commits > 0)
+		printf("Mean commit latency: %.1f us\n", 1e6 * commitSeconds / commits);
+	printf("Logical bytes written: %" PRId64 ", read: %" PRId64 "\n", logicalWriteBytes, logicalReadBytes);
+	if (physicalWritesAfter > physicalWritesBefore && logicalWriteBytes > 0)
+		printf("Physical bytes written: %" PRIu64 " (write amplification %.2f)\n",
+		       physicalWritesAfter - physicalWritesBefore,
+		       (double)(physicalWritesAfter - physicalWritesBefore) / logicalWriteBytes);
+	if (liveBytes > 0)
+		printf("Live logical bytes: %" PRId64 ", store used bytes: %" PRId64 " (space amplification %.2f)\n",
+		       liveBytes,
+		       sb.used,
+		       (double)sb.used / liveBytes);
+
+	// Latency histograms go to the trace log next to the storage engine's own metrics.
+	GetHistogramRegistry().logReport(duration);
+
+	Future<Void> closed = store->onClosed();
+	store->dispose();
+	wait(closed);
+	return Void();
+}
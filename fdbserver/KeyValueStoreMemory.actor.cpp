@@ -33,6 +33,10 @@
 
 #define OP_DISK_OVERHEAD (sizeof(OpHeader) + 1)
 
+// Flush threshold for batched encrypted ops, bounding how much plaintext is buffered between
+// metadata ops.
+#define OP_ENCRYPTED_BATCH_MAX_BYTES (1 << 20)
+
 template <typename Container>
 class KeyValueStoreMemory final : public IKeyValueStore, NonCopyable {
 public:
@@ -297,7 +301,8 @@ private:
 		OpCommit, // only in log, not in queue
 		OpRollback, // only in log, not in queue
 		OpSnapshotItemDelta,
-		OpEncrypted
+		OpEncrypted, // legacy single encrypted op, only read during recovery
+		OpEncryptedBatch // only in log, not in queue
 	};
 
 	struct OpRef {
@@ -400,6 +405,8 @@ private:
 	bool enableEncryption;
 	TextAndHeaderCipherKeys cipherKeys;
 	Future<Void> refreshCipherKeysActor;
+	// Plaintext of data ops buffered for the next OpEncryptedBatch record.
+	BinaryWriter batchPlaintext{ Unversioned() };
 
 	int64_t commit_queue(OpQueue& ops, bool log, bool sequential = false) {
 		int64_t total = 0, count = 0;
@@ -457,47 +464,68 @@ private:
 	// | sizeof(int) | sizeof(int) | sizeof(int) | len1   | len2   |
 	// +-------------+-------------+-------------+--------+--------+
 	//
-	// However, if the operation is encrypted:
-	// +-------------+-------------+-------------+---------------------------------+-------------+--------+--------+
-	// | OpEncrypted | len1        | len2        | BlobCipherEncryptHeader         | opType      | param1 | param2 |
-	// | sizeof(int) | sizeof(int) | sizeof(int) | sizeof(BlobCipherEncryptHeader) | sizeof(int) | len1   | len2   |
-	// +-------------+-------------+-------------+---------------------------------+-------------+--------+--------+
-	// |                                plaintext                                  |           encrypted           |
-	// +-----------------------------------------------------------------------------------------------------------+
+	// However, if the store is encrypted, the data ops between two metadata ops are buffered and
+	// written as a single batch record, with the real op headers and parameters encrypted:
+	// +------------------+-------------+-------------+---------------------------------+--------------+
+	// | OpEncryptedBatch | len1        | len2 = 0    | BlobCipherEncryptHeader         | batched ops  |
+	// | sizeof(int)      | sizeof(int) | sizeof(int) | sizeof(BlobCipherEncryptHeader) | len1         |
+	// +------------------+-------------+-------------+---------------------------------+--------------+
+	// |                                plaintext                                       |  encrypted   |
+	// +------------------------------------------------------------------------------------------------+
+	// Each batched op is a normal-format record (opType, len1, len2, param1, param2) without the
+	// trailing \x01 byte. Logs written by older versions carry one OpEncrypted record per op, with
+	// the encrypted portion being (opType, param1, param2); recovery still accepts that format.
 	//
 	IDiskQueue::location log_op(OpType op, StringRef v1, StringRef v2) {
 		// Metadata op types to be excluded from encryption.
 		static std::unordered_set<OpType> metaOps = { OpSnapshotEnd, OpSnapshotAbort, OpCommit, OpRollback };
 		if (!enableEncryption || metaOps.count(op) > 0) {
+			// Data ops logged before a metadata op must stay before it in the log, so flush any
+			// batched encrypted ops first.
+			flushEncryptedBatch();
 			OpHeader h = { (int)op, v1.size(), v2.size() };
 			log->push(StringRef((const uint8_t*)&h, sizeof(h)));
 			log->push(v1);
 			log->push(v2);
-		} else {
-			OpHeader h = { (int)OpEncrypted, v1.size(), v2.size() };
-			log->push(StringRef((const uint8_t*)&h, sizeof(h)));
+			return log->push(LiteralStringRef("\x01")); // Changes here should be reflected in OP_DISK_OVERHEAD
+		}
 
-			uint8_t* plaintext = new uint8_t[sizeof(int) + v1.size() + v2.size()];
-			*(int*)plaintext = op;
-			if (v1.size()) {
-				memcpy(plaintext + sizeof(int), v1.begin(), v1.size());
-			}
-			if (v2.size()) {
-				memcpy(plaintext + sizeof(int) + v1.size(), v2.begin(), v2.size());
-			}
+		// Encrypted data ops are buffered and written as one OpEncryptedBatch record, so that a
+		// single cipher context and encryption call cover the whole batch instead of paying the
+		// cipher setup cost once per op.
+		OpHeader h = { (int)op, v1.size(), v2.size() };
+		batchPlaintext.serializeBytes(&h, sizeof(h));
+		batchPlaintext.serializeBytes(v1);
+		batchPlaintext.serializeBytes(v2);
+		if (batchPlaintext.getLength() >= OP_ENCRYPTED_BATCH_MAX_BYTES) {
+			flushEncryptedBatch();
+		}
+		return log->getNextPushLocation();
+	}
 
-			ASSERT(cipherKeys.cipherTextKey.isValid());
-			ASSERT(cipherKeys.cipherHeaderKey.isValid());
-			EncryptBlobCipherAes265Ctr cipher(
-			    cipherKeys.cipherTextKey, cipherKeys.cipherHeaderKey, ENCRYPT_HEADER_AUTH_TOKEN_MODE_SINGLE);
-			BlobCipherEncryptHeader cipherHeader;
-			Arena arena;
-			StringRef ciphertext =
-			    cipher.encrypt(plaintext, sizeof(int) + v1.size() + v2.size(), &cipherHeader, arena)->toStringRef();
-			log->push(StringRef((const uint8_t*)&cipherHeader, BlobCipherEncryptHeader::headerSize));
-			log->push(ciphertext);
+	// Encrypt the buffered data ops and push them as one OpEncryptedBatch record. The cipher
+	// context cannot be reused across records because the encryption header records the context's
+	// initial IV, so reuse would repeat the CTR keystream.
+	void flushEncryptedBatch() {
+		if (batchPlaintext.getLength() == 0) {
+			return;
 		}
-		return log->push(LiteralStringRef("\x01")); // Changes here should be reflected in OP_DISK_OVERHEAD
+		OpHeader h = { (int)OpEncryptedBatch, batchPlaintext.getLength(), 0 };
+		log->push(StringRef((const uint8_t*)&h, sizeof(h)));
+
+		ASSERT(cipherKeys.cipherTextKey.isValid());
+		ASSERT(cipherKeys.cipherHeaderKey.isValid());
+		EncryptBlobCipherAes265Ctr cipher(
+		    cipherKeys.cipherTextKey, cipherKeys.cipherHeaderKey, ENCRYPT_HEADER_AUTH_TOKEN_MODE_SINGLE);
+		BlobCipherEncryptHeader cipherHeader;
+		Arena arena;
+		StringRef ciphertext =
+		    cipher.encrypt((const uint8_t*)batchPlaintext.getData(), batchPlaintext.getLength(), &cipherHeader, arena)
+		        ->toStringRef();
+		log->push(StringRef((const uint8_t*)&cipherHeader, BlobCipherEncryptHeader::headerSize));
+		log->push(ciphertext);
+		log->push(LiteralStringRef("\x01")); // Changes here should be reflected in OP_DISK_OVERHEAD
+		batchPlaintext = BinaryWriter(Unversioned());
 	}
 
 	// In case the op data is not encrypted, simply read the operands and the zero fill flag.
@@ -510,12 +538,15 @@ private:
 		static std::unordered_set<OpType> metaOps = { OpSnapshotEnd, OpSnapshotAbort, OpCommit, OpRollback };
 		if (metaOps.count((OpType)h->op) == 0) {
 			// It is not supported to open an encrypted store as unencrypted, or vice-versa.
-			ASSERT_EQ(h->op == OpEncrypted, self->enableEncryption);
+			ASSERT_EQ(h->op == OpEncrypted || h->op == OpEncryptedBatch, self->enableEncryption);
 		}
 		state int remainingBytes = h->len1 + h->len2 + 1;
 		if (h->op == OpEncrypted) {
 			// encryption header, plus the real (encrypted) op type
 			remainingBytes += BlobCipherEncryptHeader::headerSize + sizeof(int);
+		} else if (h->op == OpEncryptedBatch) {
+			// encryption header; the batched op headers ride inside the ciphertext
+			remainingBytes += BlobCipherEncryptHeader::headerSize;
 		}
 		state Standalone<StringRef> data = wait(self->log->readNext(remainingBytes));
 		ASSERT(data.size() <= remainingBytes);
@@ -523,19 +554,21 @@ private:
 		if (*zeroFillSize == 0) {
 			*isZeroFilled = (data[data.size() - 1] == 0);
 		}
-		if (h->op != OpEncrypted || *zeroFillSize > 0 || *isZeroFilled) {
+		if ((h->op != OpEncrypted && h->op != OpEncryptedBatch) || *zeroFillSize > 0 || *isZeroFilled) {
 			return data;
 		}
 		state BlobCipherEncryptHeader cipherHeader = *(BlobCipherEncryptHeader*)data.begin();
 		TextAndHeaderCipherKeys cipherKeys = wait(getEncryptCipherKeys(self->db, cipherHeader));
 		DecryptBlobCipherAes256Ctr cipher(cipherKeys.cipherTextKey, cipherKeys.cipherHeaderKey, cipherHeader.iv);
 		Arena arena;
-		StringRef plaintext = cipher
-		                          .decrypt(data.begin() + BlobCipherEncryptHeader::headerSize,
-		                                   sizeof(int) + h->len1 + h->len2,
-		                                   cipherHeader,
-		                                   arena)
-		                          ->toStringRef();
+		int ciphertextLen = h->op == OpEncryptedBatch ? h->len1 : sizeof(int) + h->len1 + h->len2;
+		StringRef plaintext =
+		    cipher.decrypt(data.begin() + BlobCipherEncryptHeader::headerSize, ciphertextLen, cipherHeader, arena)
+		        ->toStringRef();
+		if (h->op == OpEncryptedBatch) {
+			// The batched op records are unpacked by the caller.
+			return Standalone<StringRef>(plaintext, arena);
+		}
 		h->op = *(int*)plaintext.begin();
 		return Standalone<StringRef>(plaintext.substr(sizeof(int)), arena);
 	}
@@ -565,35 +598,60 @@ private:
 			state OpHeader h;
 			state Standalone<StringRef> lastSnapshotKey;
 			state bool isZeroFilled;
+			state Standalone<StringRef> data;
+			state Standalone<StringRef> batchData; // unapplied ops from the last OpEncryptedBatch record
 
 			TraceEvent("KVSMemRecoveryStarted", self->id).detail("SnapshotEndLocation", uncommittedSnapshotEnd);
 
 			try {
 				loop {
-					{
-						Standalone<StringRef> data = wait(self->log->readNext(sizeof(OpHeader)));
-						if (data.size() != sizeof(OpHeader)) {
-							if (data.size()) {
-								CODE_PROBE(true, "zero fill partial header in KeyValueStoreMemory");
-								memset(&h, 0, sizeof(OpHeader));
-								memcpy(&h, data.begin(), data.size());
-								zeroFillSize = sizeof(OpHeader) - data.size() + h.len1 + h.len2 + 1;
-								if (h.op == OpEncrypted) {
-									// encryption header, plus the real (encrypted) op type
-									zeroFillSize += BlobCipherEncryptHeader::headerSize + sizeof(int);
+					if (batchData.size() > 0) {
+						// Apply the next op record from the most recently decrypted batch.
+						ASSERT(batchData.size() >= (int)sizeof(OpHeader));
+						h = *(OpHeader*)batchData.begin();
+						ASSERT(batchData.size() >= (int)sizeof(OpHeader) + h.len1 + h.len2);
+						data = Standalone<StringRef>(batchData.substr(sizeof(OpHeader), h.len1 + h.len2),
+						                             batchData.arena());
+						batchData = Standalone<StringRef>(batchData.substr(sizeof(OpHeader) + h.len1 + h.len2),
+						                                  batchData.arena());
+						isZeroFilled = false;
+						zeroFillSize = 0;
+					} else {
+						{
+							Standalone<StringRef> data = wait(self->log->readNext(sizeof(OpHeader)));
+							if (data.size() != sizeof(OpHeader)) {
+								if (data.size()) {
+									CODE_PROBE(true, "zero fill partial header in KeyValueStoreMemory");
+									memset(&h, 0, sizeof(OpHeader));
+									memcpy(&h, data.begin(), data.size());
+									zeroFillSize = sizeof(OpHeader) - data.size() + h.len1 + h.len2 + 1;
+									if (h.op == OpEncrypted) {
+										// encryption header, plus the real (encrypted) op type
+										zeroFillSize += BlobCipherEncryptHeader::headerSize + sizeof(int);
+									} else if (h.op == OpEncryptedBatch) {
+										// encryption header; the op headers ride inside the ciphertext
+										zeroFillSize += BlobCipherEncryptHeader::headerSize;
+									}
 								}
+								TraceEvent("KVSMemRecoveryComplete", self->id)
+								    .detail("Reason", "Non-header sized data read")
+								    .detail("DataSize", data.size())
+								    .detail("ZeroFillSize", zeroFillSize)
+								    .detail("SnapshotEndLocation", uncommittedSnapshotEnd)
+								    .detail("NextReadLoc", self->log->getNextReadLocation());
+								break;
 							}
-							TraceEvent("KVSMemRecoveryComplete", self->id)
-							    .detail("Reason", "Non-header sized data read")
-							    .detail("DataSize", data.size())
-							    .detail("ZeroFillSize", zeroFillSize)
-							    .detail("SnapshotEndLocation", uncommittedSnapshotEnd)
-							    .detail("NextReadLoc", self->log->getNextReadLocation());
-							break;
+							h = *(OpHeader*)data.begin();
+						}
+						Standalone<StringRef> opData = wait(readOpData(self, &h, &isZeroFilled, &zeroFillSize));
+						data = opData;
+						if (h.op == OpEncryptedBatch && zeroFillSize == 0 && !isZeroFilled) {
+							// The decrypted payload is a sequence of per-op records; apply them from
+							// the front of the buffer on subsequent iterations.
+							batchData = data;
+							continue;
 						}
-						h = *(OpHeader*)data.begin();
 					}
-					state Standalone<StringRef> data = wait(readOpData(self, &h, &isZeroFilled, &zeroFillSize));
 					if (zeroFillSize > 0) {
 						TraceEvent("KVSMemRecoveryComplete", self->id)
 						    .detail("Reason", "data specified by header does not exist")
@@ -779,6 +837,8 @@ private:
 		state int lastDiff = 0;
 		state int snapItems = 0;
 		state uint64_t snapshotBytes = 0;
+		state int64_t bytesSinceYield = 0;
+		state typename Container::iterator next;
 
 		// Snapshot keys will be alternately written to two preallocated buffers.
 		// This allows consecutive snapshot keys to be compared for delta compression while only copying each key's
@@ -800,7 +860,7 @@ private:
 				self->resetSnapshot = false;
 			}
 
-			auto next = nextKeyAfter ? self->data.upper_bound(nextKey) : self->data.lower_bound(nextKey);
+			next = nextKeyAfter ? self->data.upper_bound(nextKey) : self->data.lower_bound(nextKey);
 			int diff = self->notifiedCommittedWriteBytes.get() - snapshotTotalWrittenBytes;
 			if (diff > lastDiff && diff > 5e7)
 				TraceEvent(SevWarnAlways, "ManyWritesAtOnce", self->id)
@@ -813,7 +873,7 @@ private:
 			// Since notifiedCommittedWriteBytes is only set() once per commit, before logging the commit operation,
 			// when this line is reached it is certain that there are no snapshot items in this commit yet.  Since this
 			// commit could be the first thing read during recovery, we can't write a delta yet.
-			bool useDelta = false;
+			state bool useDelta = false;
 
 			// Write snapshot items until the wait above would block because we've used up all of the byte budget
 			loop {
@@ -915,6 +975,31 @@ private:
 					// If we're not stopping now, increment next
 					if (snapshotTotalWrittenBytes < self->notifiedCommittedWriteBytes.get()) {
 						++next;
+						bytesSinceYield += opBytes;
+						if (bytesSinceYield >= SERVER_KNOBS->KVS_MEM_SNAPSHOT_YIELD_BYTES) {
+							// A large commit burst grants a large snapshot byte budget, and writing
+							// all of it in one go would stall commits arriving at the same
+							// priority.  Save the continuation state and yield.
+							nextKey = destKey;
+							nextKeyAfter = true;
+							wait(yield());
+							bytesSinceYield = 0;
+
+							// A commit may have been logged during the yield and recovery could
+							// begin reading there, so the next item written cannot be a delta
+							// against a key logged before it.
+							useDelta = false;
+
+							// If resyncLog() or a full snapshot aborted this snapshot during the
+							// yield, restart from the beginning via the outer loop.
+							if (self->resetSnapshot) {
+								break;
+							}
+
+							// Mutations during the yield may have invalidated the iterator, so
+							// reacquire it from the saved key.
+							next = self->data.upper_bound(nextKey);
+						}
 					} else {
 						// Otherwise, save state for continuing after the next wait and stop
 						nextKey = destKey;
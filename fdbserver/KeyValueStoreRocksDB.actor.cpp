@@ -1143,7 +1143,14 @@ struct RocksDBKeyValueStore : IKeyValueStore {
 			// If there are any range deletes, we should have added them to be deleted.
 			ASSERT(!deletes.empty() || !a.batchToCommit->HasDeleteRange());
 			rocksdb::WriteOptions options;
-			options.sync = !SERVER_KNOBS->ROCKSDB_UNSAFE_AUTO_FSYNC;
+			if (SERVER_KNOBS->ROCKSDB_DISABLE_WAL) {
+				// The mutations are redundantly durable in the FDB transaction logs until this
+				// commit is acknowledged, so skip the RocksDB WAL entirely.  Durability comes
+				// from a memtable flush before the commit's promise is fulfilled, see commit().
+				options.disableWAL = true;
+			} else {
+				options.sync = !SERVER_KNOBS->ROCKSDB_UNSAFE_AUTO_FSYNC;
+			}
 
 			double writeBeginTime = a.getHistograms ? timer_monotonic() : 0;
 			if (rateLimiter) {
@@ -1187,6 +1194,26 @@ struct RocksDBKeyValueStore : IKeyValueStore {
 			}
 		}
 
+		struct FlushAction : TypedAction<Writer, FlushAction> {
+			ThreadReturnPromise<Void> done;
+			double getTimeEstimate() const override { return SERVER_KNOBS->COMMIT_TIME_ESTIMATE; }
+		};
+		void action(FlushAction& a) {
+			if (db == nullptr) {
+				a.done.send(Void());
+				return;
+			}
+			rocksdb::FlushOptions options;
+			options.wait = true;
+			rocksdb::Status s = db->Flush(options, cf);
+			if (!s.ok()) {
+				logRocksDBError(id, s, "Flush");
+				a.done.sendError(statusToError(s));
+			} else {
+				a.done.send(Void());
+			}
+		}
+
 		struct CloseAction : TypedAction<Writer, CloseAction> {
 			ThreadReturnPromise<Void> done;
 			std::string path;
@@ -1200,6 +1227,13 @@ struct RocksDBKeyValueStore : IKeyValueStore {
 				a.done.send(Void());
 				return;
 			}
+			if (SERVER_KNOBS->ROCKSDB_DISABLE_WAL && !a.deleteOnClose) {
+				// Without a WAL anything still in the memtables would be lost on close, which
+				// would lengthen the transaction log replay on the next start, so flush first.
+				rocksdb::FlushOptions options;
+				options.wait = true;
+				db->Flush(options, cf);
+			}
 			for (rocksdb::ColumnFamilyHandle* handle : cfHandles) {
 				if (handle != nullptr) {
 					db->DestroyColumnFamilyHandle(handle);
@@ -1361,6 +1395,94 @@ struct RocksDBKeyValueStore : IKeyValueStore {
 			}
 		}
 
+		struct ReadValuesAction : TypedAction<Reader, ReadValuesAction> {
+			std::vector<Key> keys;
+			Optional<UID> debugID;
+			double startTime;
+			bool getHistograms;
+			ThreadReturnPromise<std::vector<Optional<Value>>> result;
+			ReadValuesAction(std::vector<Key> keys, Optional<UID> debugID)
+			  : keys(std::move(keys)), debugID(debugID), startTime(timer_monotonic()),
+			    getHistograms(
+			        (deterministicRandom()->random01() < SERVER_KNOBS->ROCKSDB_HISTOGRAMS_SAMPLE_RATE) ? true : false) {
+			}
+			double getTimeEstimate() const override { return SERVER_KNOBS->READ_VALUE_TIME_ESTIMATE; }
+		};
+		void action(ReadValuesAction& a) {
+			ASSERT(cf != nullptr);
+			double readBeginTime = timer_monotonic();
+			if (a.getHistograms) {
+				metricPromiseStream->send(
+				    std::make_pair(ROCKSDB_READVALUE_QUEUEWAIT_HISTOGRAM.toString(), readBeginTime - a.startTime));
+			}
+			Optional<TraceBatch> traceBatch;
+			if (a.debugID.present()) {
+				traceBatch = { TraceBatch{} };
+				traceBatch.get().addEvent("GetValueDebug", a.debugID.get().first(), "Reader.Before");
+			}
+			if (readBeginTime - a.startTime > readValueTimeout) {
+				TraceEvent(SevWarn, "KVSTimeout", id)
+				    .detail("Error", "Read values request timedout")
+				    .detail("Method", "ReadValuesAction")
+				    .detail("TimeoutValue", readValueTimeout);
+				a.result.sendError(transaction_too_old());
+				return;
+			}
+
+			auto options = getReadOptions();
+			uint64_t deadlineMircos =
+			    db->GetEnv()->NowMicros() + (readValueTimeout - (readBeginTime - a.startTime)) * 1000000;
+			std::chrono::seconds deadlineSeconds(deadlineMircos / 1000000);
+			options.deadline = std::chrono::duration_cast<std::chrono::microseconds>(deadlineSeconds);
+
+			std::vector<rocksdb::Slice> keySlices;
+			keySlices.reserve(a.keys.size());
+			for (const auto& key : a.keys) {
+				keySlices.push_back(toSlice(key));
+			}
+			std::vector<rocksdb::PinnableSlice> values(a.keys.size());
+			std::vector<rocksdb::Status> statuses(a.keys.size());
+			double dbGetBeginTime = a.getHistograms ? timer_monotonic() : 0;
+			db->MultiGet(options,
+			             cf,
+			             keySlices.size(),
+			             keySlices.data(),
+			             values.data(),
+			             statuses.data(),
+			             /*sorted_input=*/false);
+			if (a.getHistograms) {
+				metricPromiseStream->send(
+				    std::make_pair(ROCKSDB_READVALUE_GET_HISTOGRAM.toString(), timer_monotonic() - dbGetBeginTime));
+			}
+
+			std::vector<Optional<Value>> result;
+			result.reserve(a.keys.size());
+			for (int i = 0; i < (int)statuses.size(); i++) {
+				if (statuses[i].ok()) {
+					result.push_back(Value(toStringRef(values[i])));
+				} else if (statuses[i].IsNotFound()) {
+					result.push_back(Optional<Value>());
+				} else {
+					logRocksDBError(id, statuses[i], "ReadValues");
+					a.result.sendError(statusToError(statuses[i]));
+					return;
+				}
+			}
+
+			if (a.debugID.present()) {
+				traceBatch.get().addEvent("GetValueDebug", a.debugID.get().first(), "Reader.After");
+				traceBatch.get().dump();
+			}
+			a.result.send(result);
+			if (a.getHistograms) {
+				double currTime = timer_monotonic();
+				metricPromiseStream->send(
+				    std::make_pair(ROCKSDB_READVALUE_ACTION_HISTOGRAM.toString(), currTime - readBeginTime));
+				metricPromiseStream->send(
+				    std::make_pair(ROCKSDB_READVALUE_LATENCY_HISTOGRAM.toString(), currTime - a.startTime));
+			}
+		}
+
 		struct ReadValuePrefixAction : TypedAction<Reader, ReadValuePrefixAction> {
 			Key key;
 			int maxLength;
@@ -1596,6 +1718,9 @@ struct RocksDBKeyValueStore : IKeyValueStore {
 			writeThread = createGenericThreadPool();
 			readThreads = createGenericThreadPool();
 		}
+		if (SERVER_KNOBS->ROCKSDB_DISABLE_WAL) {
+			flushHolder = periodicFlusher(this);
+		}
 		if (SERVER_KNOBS->ROCKSDB_HISTOGRAMS_SAMPLE_RATE > 0) {
 			collection = actorCollection(addActor.getFuture());
 			for (int i = 0; i < SERVER_KNOBS->ROCKSDB_READ_PARALLELISM + 1; i++) {
@@ -1729,6 +1854,7 @@ struct RocksDBKeyValueStore : IKeyValueStore {
 
 	ACTOR static void doClose(RocksDBKeyValueStore* self, bool deleteOnClose) {
 		self->sharedState->closing = true;
+		self->flushHolder.cancel();
 
 		// The metrics future retains a reference to the DB, so stop it before we delete it.
 		self->metrics.reset();
@@ -1815,6 +1941,39 @@ struct RocksDBKeyValueStore : IKeyValueStore {
 
 	Future<Void> canCommit() override { return checkRocksdbState(this); }
 
+	// Sends the result of a posted memtable flush to the promise that commits gated on the
+	// flush are waiting on
+	ACTOR static void forwardFlush(Promise<Void> flushed, Future<Void> f) {
+		try {
+			wait(f);
+			flushed.send(Void());
+		} catch (Error& e) {
+			flushed.sendError(e);
+		}
+	}
+
+	// Flush the memtables, making all previously posted commits durable, and fulfill the
+	// promises of the commits gated on the flush.  Only used when the WAL is disabled.
+	void flushMemtable() {
+		if (unflushedBytes == 0) {
+			return;
+		}
+		unflushedBytes = 0;
+		Promise<Void> flushed = nextFlush;
+		nextFlush = Promise<Void>();
+		auto a = new Writer::FlushAction();
+		Future<Void> f = a->done.getFuture();
+		writeThread->post(a);
+		forwardFlush(flushed, f);
+	}
+
+	ACTOR static Future<Void> periodicFlusher(RocksDBKeyValueStore* self) {
+		loop {
+			wait(delay(SERVER_KNOBS->ROCKSDB_DISABLE_WAL_FLUSH_INTERVAL));
+			self->flushMemtable();
+		}
+	}
+
 	Future<Void> commit(bool) override {
 		// If there is nothing to write, don't write.
 		if (writeBatch == nullptr) {
@@ -1823,6 +1982,19 @@ struct RocksDBKeyValueStore : IKeyValueStore {
 		auto a = new Writer::CommitAction();
 		a->batchToCommit = std::move(writeBatch);
 		auto res = a->done.getFuture();
+		if (SERVER_KNOBS->ROCKSDB_DISABLE_WAL) {
+			// Without a WAL the write only reaches the memtables, so hold the commit's promise
+			// until a later flush persists it.  The restart version stored in the batch by the
+			// storage server is persisted by the same flush, so recovered state is always
+			// consistent with it and the unflushed tail is replayed from the transaction logs.
+			unflushedBytes += a->batchToCommit->GetDataSize();
+			Future<Void> durable = nextFlush.getFuture();
+			writeThread->post(a);
+			if (unflushedBytes >= SERVER_KNOBS->ROCKSDB_DISABLE_WAL_FLUSH_BYTES) {
+				flushMemtable();
+			}
+			return res && durable;
+		}
 		writeThread->post(a);
 		return res;
 	}
@@ -1893,6 +2065,47 @@ struct RocksDBKeyValueStore : IKeyValueStore {
 		return read(a.release(), &semaphore, readThreads.getPtr(), &counters.failedToAcquire);
 	}
 
+	ACTOR static Future<std::vector<Optional<Value>>> read(Reader::ReadValuesAction* action,
+	                                                       FlowLock* semaphore,
+	                                                       IThreadPool* pool,
+	                                                       Counter* counter) {
+		state std::unique_ptr<Reader::ReadValuesAction> a(action);
+		state Optional<Void> slot = wait(timeout(semaphore->take(), SERVER_KNOBS->ROCKSDB_READ_QUEUE_WAIT));
+		if (!slot.present()) {
+			++(*counter);
+			throw server_overloaded();
+		}
+
+		state FlowLock::Releaser release(*semaphore);
+
+		auto fut = a->result.getFuture();
+		pool->post(a.release());
+		std::vector<Optional<Value>> result = wait(fut);
+
+		return result;
+	}
+
+	Future<std::vector<Optional<Value>>> readValues(VectorRef<KeyRef> keys,
+	                                                IKeyValueStore::ReadType type,
+	                                                Optional<UID> debugID) override {
+		// The batch shares one thread pool crossing, so it throttles as a single read; whether to
+		// throttle is decided by the first key since batches do not mix keyspaces in practice.
+		std::vector<Key> keyValues(keys.begin(), keys.end());
+		if (keys.size() == 0 || !shouldThrottle(type, keys[0])) {
+			auto a = new Reader::ReadValuesAction(std::move(keyValues), debugID);
+			auto res = a->result.getFuture();
+			readThreads->post(a);
+			return res;
+		}
+
+		auto& semaphore = (type == IKeyValueStore::ReadType::FETCH) ? fetchSemaphore : readSemaphore;
+		int maxWaiters = (type == IKeyValueStore::ReadType::FETCH) ? numFetchWaiters : numReadWaiters;
+
+		checkWaiters(semaphore, maxWaiters);
+		auto a = std::make_unique<Reader::ReadValuesAction>(std::move(keyValues), debugID);
+		return read(a.release(), &semaphore, readThreads.getPtr(), &counters.failedToAcquire);
+	}
+
 	ACTOR static Future<Standalone<RangeResultRef>> read(Reader::ReadRangeAction* action,
 	                                                     FlowLock* semaphore,
 	                                                     IThreadPool* pool,
@@ -1943,6 +2156,22 @@ struct RocksDBKeyValueStore : IKeyValueStore {
 		return StorageBytes(free, total, live, free);
 	}
 
+	CompactionDebt getCompactionDebt() const override {
+		CompactionDebt debt;
+		if (db == nullptr || cf == nullptr) {
+			return debt;
+		}
+		uint64_t pendingBytes = 0;
+		if (db->GetAggregatedIntProperty(rocksdb::DB::Properties::kEstimatePendingCompactionBytes, &pendingBytes)) {
+			debt.pendingBytes = pendingBytes;
+		}
+		std::string level0Files;
+		if (db->GetProperty(cf, rocksdb::DB::Properties::kNumFilesAtLevelPrefix + "0", &level0Files)) {
+			debt.level0Files = atoi(level0Files.c_str());
+		}
+		return debt;
+	}
+
 	Future<CheckpointMetaData> checkpoint(const CheckpointRequest& request) override {
 		auto a = new Writer::CheckpointAction(request);
 
@@ -1996,6 +2225,10 @@ struct RocksDBKeyValueStore : IKeyValueStore {
 	Promise<Void> closePromise;
 	Future<Void> openFuture;
 	std::unique_ptr<rocksdb::WriteBatch> writeBatch;
+	// Commits gated on the next memtable flush when the WAL is disabled
+	Promise<Void> nextFlush;
+	Future<Void> flushHolder;
+	int64_t unflushedBytes = 0;
 	Optional<Future<Void>> metrics;
 	FlowLock readSemaphore;
 	int numReadWaiters;
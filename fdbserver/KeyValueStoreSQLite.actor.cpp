@@ -276,6 +276,11 @@ struct SQLiteDB : NonCopyable {
 	void checkError(const char* context, int rc) {
 		// if (deterministicRandom()->random01() < .001) rc = SQLITE_INTERRUPT;
 		if (rc) {
+			// An inline read on the main thread needed a page which was not in the cache.  This is
+			// not a disk error; the caller will see the miss flag and retry on a reader thread.
+			if (VFSAsyncFile::inlineReadActive && VFSAsyncFile::inlineReadMissed) {
+				throw io_error();
+			}
 			// Our exceptions don't propagate through sqlite, so we don't know for sure if the error that caused this
 			// was an injected fault.  Assume that if VFSAsyncFile caught an injected Error that it caused this error
 			// return code.
@@ -1612,6 +1617,11 @@ public:
 	void startReadThreads();
 
 private:
+	// Attempts to serve a point read on the network thread, which is possible when every page the
+	// B-tree descent touches is already in the page cache.  Returns nothing when a page misses or
+	// no idle read cursor exists, in which case the caller posts the read to a reader thread.
+	Optional<Optional<Value>> tryReadValueInline(KeyRef key, int maxLength, Optional<UID> debugID);
+
 	KeyValueStoreType type;
 	UID logID;
 	std::string filename;
@@ -2216,8 +2226,52 @@ Future<Void> KeyValueStoreSQLite::commit(bool sequential) {
 	writeThread->post(p);
 	return f;
 }
+Optional<Optional<Value>> KeyValueStoreSQLite::tryReadValueInline(KeyRef key, int maxLength, Optional<UID> debugID) {
+	// Borrow an initialized read cursor.  The reader coroutines run on this thread, so nothing can
+	// be using the cursor while this function runs, and since an inline read never blocks nothing
+	// can observe the cursor mid-operation.
+	for (int i = 0; i < readCursors.size(); i++) {
+		Reference<ReadCursor> cursor = readCursors[i];
+		if (!cursor || cursor->get().kvBytesRead > SERVER_KNOBS->SQLITE_CURSOR_MAX_LIFETIME_BYTES)
+			continue;
+
+		if (debugID.present())
+			g_traceBatch.addEvent("GetValueDebug", debugID.get().first(), "Reader.Before");
+
+		Optional<Value> v;
+		VFSAsyncFile::beginInlineRead();
+		try {
+			v = maxLength < 0 ? cursor->get().get(key) : cursor->get().getPrefix(key, maxLength);
+		} catch (Error& e) {
+			VFSAsyncFile::endInlineRead();
+			if (!VFSAsyncFile::inlineReadMissed)
+				throw;
+			// The miss left this cursor's pager in an error state.  Dropping the shared reference
+			// makes its reader open a fresh cursor, and the rollback when the last reference goes
+			// away clears the error state.
+			readCursors[i].clear();
+			return Optional<Optional<Value>>();
+		}
+		VFSAsyncFile::endInlineRead();
+		if (VFSAsyncFile::inlineReadMissed) {
+			readCursors[i].clear();
+			return Optional<Optional<Value>>();
+		}
+
+		++readsComplete;
+		if (debugID.present())
+			g_traceBatch.addEvent("GetValueDebug", debugID.get().first(), "Reader.After");
+		return Optional<Optional<Value>>(v);
+	}
+	return Optional<Optional<Value>>();
+}
 Future<Optional<Value>> KeyValueStoreSQLite::readValue(KeyRef key, IKeyValueStore::ReadType, Optional<UID> debugID) {
 	++readsRequested;
+	if (SERVER_KNOBS->SQLITE_INLINE_CACHED_READS && readThreads->isCoro()) {
+		Optional<Optional<Value>> v = tryReadValueInline(key, -1, debugID);
+		if (v.present())
+			return v.get();
+	}
 	auto p = new Reader::ReadValueAction(key, debugID);
 	auto f = p->result.getFuture();
 	readThreads->post(p);
@@ -2228,6 +2282,11 @@ Future<Optional<Value>> KeyValueStoreSQLite::readValuePrefix(KeyRef key,
                                                              IKeyValueStore::ReadType,
                                                              Optional<UID> debugID) {
 	++readsRequested;
+	if (SERVER_KNOBS->SQLITE_INLINE_CACHED_READS && readThreads->isCoro() && maxLength >= 0) {
+		Optional<Optional<Value>> v = tryReadValueInline(key, maxLength, debugID);
+		if (v.present())
+			return v.get();
+	}
 	auto p = new Reader::ReadValuePrefixAction(key, maxLength, debugID);
 	auto f = p->result.getFuture();
 	readThreads->post(p);
@@ -29,6 +29,7 @@
 #include "flow/ThreadHelper.actor.h"
 #include "flow/Histogram.h"
 
+#include <deque>
 #include <memory>
 #include <tuple>
 #include <vector>
@@ -2385,6 +2386,82 @@ struct ShardedRocksDBKeyValueStore : IKeyValueStore {
 		return result;
 	}
 
+	// Reads a range spanning multiple physical shards by posting one action per shard to the
+	// reader thread pool, so the shards' column families are read in parallel, and merging the
+	// results in shard order.  The per-shard limits cannot be tightened based on results which
+	// do not exist yet, so every action carries the full limits and the number of reads in
+	// flight is bounded to limit wasted reads when an early shard satisfies the request.
+	ACTOR static Future<RangeResult> readRangeFanOut(ShardedRocksDBKeyValueStore* self,
+	                                                 KeyRange keys,
+	                                                 std::vector<DataShard*> shards,
+	                                                 int rowLimit,
+	                                                 int byteLimit,
+	                                                 FlowLock* semaphore,
+	                                                 Counter* counter) {
+		// Build one action per shard before the first wait so the shard mapping is captured
+		// synchronously, just as the single-action path does.  Shards are ordered ascending
+		// and reverse reads visit them in reverse order.
+		state std::vector<std::unique_ptr<Reader::ReadRangeAction>> actions;
+		if (rowLimit < 0) {
+			std::reverse(shards.begin(), shards.end());
+		}
+		for (DataShard* shard : shards) {
+			actions.push_back(std::make_unique<Reader::ReadRangeAction>(
+			    keys, std::vector<DataShard*>{ shard }, rowLimit, byteLimit));
+		}
+
+		state Optional<Void> slot = wait(timeout(semaphore->take(), SERVER_KNOBS->ROCKSDB_READ_QUEUE_WAIT));
+		if (!slot.present()) {
+			++(*counter);
+			throw server_overloaded();
+		}
+		state FlowLock::Releaser release(*semaphore);
+
+		state std::deque<Future<RangeResult>> inFlight;
+		state int nextAction = 0;
+		state RangeResult result;
+		state int accumulatedBytes = 0;
+		state int remainingRows = abs(rowLimit);
+
+		loop {
+			while (nextAction < (int)actions.size() &&
+			       (int)inFlight.size() < SERVER_KNOBS->ROCKSDB_READ_RANGE_SHARD_FANOUT) {
+				auto* a = actions[nextAction++].release();
+				inFlight.push_back(a->result.getFuture());
+				self->readThreads->post(a);
+			}
+			if (inFlight.empty()) {
+				break;
+			}
+			RangeResult r = wait(inFlight.front());
+			inFlight.pop_front();
+
+			int count = 0;
+			while (count < r.size()) {
+				accumulatedBytes += sizeof(KeyValueRef) + r[count].expectedSize();
+				++count;
+				--remainingRows;
+				if (remainingRows == 0 || accumulatedBytes >= byteLimit) {
+					break;
+				}
+			}
+			if (count > 0) {
+				result.append(result.arena(), r.begin(), count);
+				result.arena().dependsOn(r.arena());
+			}
+			if (remainingRows == 0 || accumulatedBytes >= byteLimit) {
+				break;
+			}
+		}
+		// Unposted actions and results of posted but unmerged actions are discarded
+
+		result.more = (remainingRows == 0) || (accumulatedBytes >= byteLimit);
+		if (result.more) {
+			result.readThrough = result[result.size() - 1].key;
+		}
+		return result;
+	}
+
 	Future<RangeResult> readRange(KeyRangeRef keys,
 	                              int rowLimit,
 	                              int byteLimit,
@@ -2403,6 +2480,11 @@ struct ShardedRocksDBKeyValueStore : IKeyValueStore {
 		int maxWaiters = (type == IKeyValueStore::ReadType::FETCH) ? numFetchWaiters : numReadWaiters;
 		checkWaiters(semaphore, maxWaiters);
 
+		if (SERVER_KNOBS->ROCKSDB_READ_RANGE_SHARD_FANOUT > 1 && shards.size() > 1 && rowLimit != 0 &&
+		    byteLimit > 0) {
+			return readRangeFanOut(this, keys, shards, rowLimit, byteLimit, &semaphore, &counters.failedToAcquire);
+		}
+
 		auto a = std::make_unique<Reader::ReadRangeAction>(keys, shards, rowLimit, byteLimit);
 		return read(a.release(), &semaphore, readThreads.getPtr(), &counters.failedToAcquire);
 	}
@@ -104,6 +104,9 @@ struct LogRouterData {
 	struct PeekTrackerData {
 		std::map<int, Promise<std::pair<Version, bool>>> sequence_version;
 		double lastUpdate;
+		// Adaptive reply size for this peek client: grows while the remote tLog drains full replies so a
+		// single WAN round trip carries more of a burst, and resets once the consumer catches up.
+		int64_t replyBytesLimit = 0;
 	};
 
 	std::map<UID, PeekTrackerData> peekTracker;
@@ -403,7 +406,12 @@ std::deque<std::pair<Version, LengthPrefixedStringRef>>& get_version_messages(Lo
 	return tagData->version_messages;
 };
 
-void peekMessagesFromMemory(LogRouterData* self, Tag tag, Version begin, BinaryWriter& messages, Version& endVersion) {
+void peekMessagesFromMemory(LogRouterData* self,
+                            Tag tag,
+                            Version begin,
+                            int64_t limitBytes,
+                            BinaryWriter& messages,
+                            Version& endVersion) {
 	ASSERT(!messages.getLength());
 
 	auto& deque = get_version_messages(self, tag);
@@ -417,7 +425,7 @@ void peekMessagesFromMemory(LogRouterData* self, Tag tag, Version begin, BinaryW
 	Version currentVersion = -1;
 	for (; it != deque.end(); ++it) {
 		if (it->first != currentVersion) {
-			if (messages.getLength() >= SERVER_KNOBS->DESIRED_TOTAL_BYTES) {
+			if (messages.getLength() >= limitBytes) {
 				endVersion = currentVersion + 1;
 				//TraceEvent("TLogPeekMessagesReached2", self->dbgid);
 				break;
@@ -450,6 +458,7 @@ Future<Void> logRouterPeekMessages(PromiseType replyPromise,
 	state BinaryWriter messages(Unversioned());
 	state int sequence = -1;
 	state UID peekId;
+	state int64_t replyBytesLimit = SERVER_KNOBS->DESIRED_TOTAL_BYTES;
 
 	if (reqSequence.present()) {
 		try {
@@ -479,6 +488,10 @@ Future<Void> logRouterPeekMessages(PromiseType replyPromise,
 			}
 
 			trackerData.lastUpdate = now();
+			if (trackerData.replyBytesLimit == 0) {
+				trackerData.replyBytesLimit = SERVER_KNOBS->DESIRED_TOTAL_BYTES;
+			}
+			replyBytesLimit = trackerData.replyBytesLimit;
 			std::pair<Version, bool> prevPeekData = wait(trackerData.sequence_version[sequence].getFuture());
 			reqBegin = prevPeekData.first;
 			reqOnlySpilled = prevPeekData.second;
@@ -547,7 +560,7 @@ Future<Void> logRouterPeekMessages(PromiseType replyPromise,
 	// want to wait a little bit instead of just sending back an empty message. This feature is controlled by a knob.
 	loop {
 		endVersion = self->version.get() + 1;
-		peekMessagesFromMemory(self, reqTag, reqBegin, messages, endVersion);
+		peekMessagesFromMemory(self, reqTag, reqBegin, replyBytesLimit, messages, endVersion);
 
 		// Reply the peek request when
 		//   - Have data return to the caller, or
@@ -583,6 +596,13 @@ Future<Void> logRouterPeekMessages(PromiseType replyPromise,
 	if (reqSequence.present()) {
 		auto& trackerData = self->peekTracker[peekId];
 		trackerData.lastUpdate = now();
+		if (reply.messages.size() >= replyBytesLimit) {
+			// The consumer drained a full reply, so the window is limiting throughput; grow it.
+			trackerData.replyBytesLimit =
+			    std::min<int64_t>(2 * replyBytesLimit, SERVER_KNOBS->LOG_ROUTER_PEEK_MAX_BYTES);
+		} else {
+			trackerData.replyBytesLimit = SERVER_KNOBS->DESIRED_TOTAL_BYTES;
+		}
 		auto& sequenceData = trackerData.sequence_version[sequence + 1];
 		if (trackerData.sequence_version.size() && sequence + 1 < trackerData.sequence_version.begin()->first) {
 			replyPromise.sendError(operation_obsolete());
@@ -304,21 +304,43 @@ void LogPushData::writeMessage(StringRef rawMessageWithoutLength, bool usePrevio
 		for (auto& tag : next_message_tags) {
 			prev_tags.push_back(tag);
 		}
-		msg_locations.clear();
-		logSystem->getPushLocations(prev_tags, msg_locations);
+		getPushLocationsCached();
 		written_tags.insert(next_message_tags.begin(), next_message_tags.end());
 		next_message_tags.clear();
 	}
 	uint32_t subseq = this->subsequence++;
 	uint32_t msgsize =
 	    rawMessageWithoutLength.size() + sizeof(subseq) + sizeof(uint16_t) + sizeof(Tag) * prev_tags.size();
+	// Serialize the message once, into the first location's stream, and copy the bytes into the
+	// remaining locations instead of re-serializing the header for each (see writeTypedMessage).
+	bool first = true;
+	int firstOffset = -1, firstLength = -1;
 	for (int loc : msg_locations) {
 		BinaryWriter& wr = messagesWriter[loc];
-		wr << msgsize << subseq << uint16_t(prev_tags.size());
-		for (auto& tag : prev_tags)
-			wr << tag;
-		wr.serializeBytes(rawMessageWithoutLength);
+		if (first) {
+			firstOffset = wr.getLength();
+			wr << msgsize << subseq << uint16_t(prev_tags.size());
+			for (auto& tag : prev_tags)
+				wr << tag;
+			wr.serializeBytes(rawMessageWithoutLength);
+			firstLength = wr.getLength() - firstOffset;
+			first = false;
+		} else {
+			BinaryWriter& from = messagesWriter[msg_locations[0]];
+			wr.serializeBytes((uint8_t*)from.getData() + firstOffset, firstLength);
+		}
+	}
+}
+
+void LogPushData::getPushLocationsCached() {
+	auto cached = cached_locations.find(prev_tags);
+	if (cached != cached_locations.end()) {
+		msg_locations = cached->second;
+		return;
 	}
+	msg_locations.clear();
+	logSystem->getPushLocations(prev_tags, msg_locations, false /*allLocations*/);
+	cached_locations[prev_tags] = msg_locations;
 }
 
 std::vector<Standalone<StringRef>> LogPushData::getAllMessages() {
@@ -26,14 +26,17 @@
 
 class LogSystemDiskQueueAdapterImpl {
 public:
-	ACTOR static Future<Standalone<StringRef>> readNext(LogSystemDiskQueueAdapter* self, int bytes) {
-		while (self->recoveryQueueDataSize < bytes) {
+	// Pulls messages from the txs tag peek cursor into recoveryQueue until at least targetSize
+	// bytes are buffered or the end of the log is reached. Runs ahead of readNext() consumption so
+	// that peek round trips overlap with the caller's decoding of already-buffered data.
+	ACTOR static Future<Void> fillRecoveryQueue(LogSystemDiskQueueAdapter* self, int64_t targetSize) {
+		while (self->logSystem.isValid() && self->recoveryQueueDataSize < targetSize) {
 			if (self->recoveryLoc == self->logSystem->getEnd()) {
 				// Recovery will be complete once the current recoveryQueue is consumed, so we no longer need
 				// self->logSystem
 				TraceEvent("PeekNextEnd")
 				    .detail("Queue", self->recoveryQueue.size())
-				    .detail("Bytes", bytes)
+				    .detail("Target", targetSize)
 				    .detail("Loc", self->recoveryLoc)
 				    .detail("End", self->logSystem->getEnd());
 				self->logSystem.clear();
@@ -90,7 +93,7 @@ public:
 				TraceEvent("PeekNextGetMore")
 				    .detail("Total", self->totalRecoveredBytes)
 				    .detail("Queue", self->recoveryQueue.size())
-				    .detail("Bytes", bytes)
+				    .detail("Target", targetSize)
 				    .detail("Loc", self->recoveryLoc)
 				    .detail("End", self->logSystem->getEnd())
 				    .detail("HasMessage", self->cursor->hasMessage())
@@ -153,8 +156,37 @@ public:
 			if (!self->cursor->hasMessage())
 				self->recoveryLoc = self->cursor->version().version;
 
-			//TraceEvent("PeekNextResults").detail("From", self->recoveryLoc).detail("Queue", self->recoveryQueue.size()).detail("Bytes", bytes).detail("Has", self->cursor->hasMessage()).detail("End", self->logSystem->getEnd());
+			//TraceEvent("PeekNextResults").detail("From", self->recoveryLoc).detail("Queue", self->recoveryQueue.size()).detail("Has", self->cursor->hasMessage()).detail("End", self->logSystem->getEnd());
+		}
+		return Void();
+	}
+
+	ACTOR static Future<Standalone<StringRef>> readNext(LogSystemDiskQueueAdapter* self, int bytes) {
+		// Buffer well past the requested bytes, so the many small header/payload reads issued while
+		// recovering the txnStateStore are served from memory instead of each paying for more of a
+		// peek round trip.
+		state int64_t targetSize = std::max<int64_t>(bytes, SERVER_KNOBS->DISK_QUEUE_ADAPTER_PEEK_AHEAD_BYTES);
+		while (self->recoveryQueueDataSize < bytes && self->logSystem.isValid()) {
+			if (self->recoveryFill.isValid() && self->recoveryFill.isError()) {
+				// A background fill hit a disk adapter reset; deliver it to this reader so the
+				// caller restarts its recovery from the adapter's rewound state.
+				Error e = self->recoveryFill.getError();
+				self->recoveryFill = Future<Void>();
+				throw e;
+			}
+			if (!self->recoveryFill.isValid() || self->recoveryFill.isReady()) {
+				self->recoveryFill = fillRecoveryQueue(self, targetSize);
+			}
+			wait(self->recoveryFill);
+		}
+
+		// Re-arm the peek-ahead fill before returning, so the cursor keeps streaming while the
+		// caller decodes the data it already has.
+		if (self->logSystem.isValid() && self->recoveryQueueDataSize < targetSize &&
+		    (!self->recoveryFill.isValid() || (self->recoveryFill.isReady() && !self->recoveryFill.isError()))) {
+			self->recoveryFill = fillRecoveryQueue(self, targetSize);
 		}
+
 		if (self->recoveryQueue.size() > 1) {
 			self->recoveryQueue[0] = concatenate(self->recoveryQueue.begin(), self->recoveryQueue.end());
 			self->recoveryQueue.resize(1);
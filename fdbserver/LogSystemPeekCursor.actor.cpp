@@ -116,6 +116,13 @@ void ILogSystem::ServerPeekCursor::nextMessage() {
 	if (rd.empty()) {
 		messageVersion.reset(std::min(results.end, end.version));
 		hasMsg = false;
+		// Every message in this reply has been consumed, so release the reply's arena now instead of
+		// pinning it until the next reply arrives. During storage catchup many cursors sit exhausted
+		// between getMore calls, and the dead replies add up. Consumers take their own reference to
+		// the arena for each message they keep, so this only drops the cursor's reference.
+		results.arena = Arena();
+		results.messages = StringRef();
+		rd = ArenaReader(results.arena, results.messages, Unversioned());
 		return;
 	}
 	if (*(int32_t*)rd.peekBytes(4) == VERSION_HEADER) {
@@ -438,6 +445,15 @@ Future<Void> ILogSystem::ServerPeekCursor::getMore(TaskPriority taskID) {
 	if (hasMessage() && !parallelGetMore)
 		return Void();
 	if (!more.isValid() || more.isReady()) {
+		if (!usePeekStream && SERVER_KNOBS->PEEK_USING_STREAMING_LOCAL && sequence == 0 && futureResults.empty() &&
+		    (tag.locality >= 0 || tag.locality == tagLocalityLogRouter || tag.locality == tagLocalityRemoteLog) &&
+		    interf && interf->get().present() &&
+		    interf->get().interf().peekMessages.getEndpoint().getPrimaryAddress().ip ==
+		        FlowTransport::transport().getLocalAddress().ip) {
+			// A tLog on the same machine can push streamed replies as soon as data is durable, so the
+			// consumer does not pay a request/response round trip per polling peek.
+			usePeekStream = true;
+		}
 		if (usePeekStream &&
 		    (tag.locality >= 0 || tag.locality == tagLocalityLogRouter || tag.locality == tagLocalityRemoteLog)) {
 			more = serverPeekStreamGetMore(this, taskID);
@@ -36,7 +36,8 @@ const char* limitReasonName[] = { "workload",
 	                              "log_server_min_free_space",
 	                              "log_server_min_free_space_ratio",
 	                              "storage_server_durability_lag",
-	                              "storage_server_list_fetch_failed" };
+	                              "storage_server_list_fetch_failed",
+	                              "storage_server_compaction_debt" };
 static_assert(sizeof(limitReasonName) / sizeof(limitReasonName[0]) == limitReason_t_end, "limitReasonDesc table size");
 
 int limitReasonEnd = limitReason_t_end;
@@ -54,7 +55,8 @@ const char* limitReasonDesc[] = { "Workload or read performance.",
 	                              "Log server running out of space (approaching 100MB limit).",
 	                              "Log server running out of space (approaching 5% limit).",
 	                              "Storage server durable version falling behind.",
-	                              "Unable to fetch storage server list." };
+	                              "Unable to fetch storage server list.",
+	                              "Storage engine compaction falling behind." };
 
 static_assert(sizeof(limitReasonDesc) / sizeof(limitReasonDesc[0]) == limitReason_t_end, "limitReasonDesc table size");
 
@@ -539,6 +541,30 @@ void Ratekeeper::updateRate(RatekeeperLimits* limits) {
 
 		double targetRateRatio = std::min((storageQueue - targetBytes + springBytes) / (double)springBytes, 2.0);
 
+		// Deferred compaction work is a leading indicator of the write stalls LSM engines impose
+		// themselves, which arrive long before the backlog shows up in the storage queue. Shape
+		// ingest on it with the same controller the storage queue uses so that compactions can
+		// catch up before the engine hits its own slowdown triggers.
+		limitReason_t writeQueueReason = limitReason_t::storage_server_write_queue_size;
+		if (SERVER_KNOBS->COMPACTION_DEBT_TARGET_BYTES > 0) {
+			double compactionRateRatio =
+			    std::min((ss.smoothCompactionBytes.smoothTotal() - SERVER_KNOBS->COMPACTION_DEBT_TARGET_BYTES +
+			              SERVER_KNOBS->COMPACTION_DEBT_SPRING_BYTES) /
+			                 (double)SERVER_KNOBS->COMPACTION_DEBT_SPRING_BYTES,
+			             2.0);
+			if (SERVER_KNOBS->COMPACTION_L0_TARGET_FILES > 0) {
+				// Reaches 1.0 at the target level-0 file count and 2.0 at 1.5x the target
+				compactionRateRatio = std::max(
+				    compactionRateRatio,
+				    std::min(2.0 * ss.lastReply.level0Files / (double)SERVER_KNOBS->COMPACTION_L0_TARGET_FILES - 1.0,
+				             2.0));
+			}
+			if (compactionRateRatio > targetRateRatio) {
+				targetRateRatio = compactionRateRatio;
+				writeQueueReason = limitReason_t::storage_server_compaction_debt;
+			}
+		}
+
 		if (limits->priority == TransactionPriority::DEFAULT) {
 			addActor.send(tagThrottler->tryUpdateAutoThrottling(ss));
 		}
@@ -586,7 +612,7 @@ void Ratekeeper::updateRate(RatekeeperLimits* limits) {
 				    ssLimitReason == limitReason_t::storage_server_write_bandwidth_mvcc) {
 					if (printRateKeepLimitReasonDetails) {
 						TraceEvent("RatekeeperLimitReasonDetails")
-						    .detail("Reason", limitReason_t::storage_server_write_queue_size)
+						    .detail("Reason", writeQueueReason)
 						    .detail("FromReason", ssLimitReason)
 						    .detail("SSID", ss.id)
 						    .detail("SSSmoothTotalSpace", ss.smoothTotalSpace.smoothTotal())
@@ -597,6 +623,8 @@ void Ratekeeper::updateRate(RatekeeperLimits* limits) {
 						    .detail("SSLastReplyBytesInput", ss.lastReply.bytesInput)
 						    .detail("SSSmoothDurableBytes", ss.smoothDurableBytes.smoothTotal())
 						    .detail("StorageQueue", storageQueue)
+						    .detail("CompactionBytes", ss.smoothCompactionBytes.smoothTotal())
+						    .detail("Level0Files", ss.lastReply.level0Files)
 						    .detail("TargetBytes", targetBytes)
 						    .detail("SpringBytes", springBytes)
 						    .detail("SSVerySmoothDurableBytesSmoothRate", ss.verySmoothDurableBytes.smoothRate())
@@ -608,7 +636,7 @@ void Ratekeeper::updateRate(RatekeeperLimits* limits) {
 						    .detail("InputRate", inputRate)
 						    .detail("TargetRateRatio", targetRateRatio);
 					}
-					ssLimitReason = limitReason_t::storage_server_write_queue_size;
+					ssLimitReason = writeQueueReason;
 				}
 			}
 		}
@@ -946,7 +974,7 @@ StorageQueueInfo::StorageQueueInfo(UID id, LocalityData locality)
     smoothInputBytes(SERVER_KNOBS->SMOOTHING_AMOUNT), verySmoothDurableBytes(SERVER_KNOBS->SLOW_SMOOTHING_AMOUNT),
     smoothDurableVersion(SERVER_KNOBS->SMOOTHING_AMOUNT), smoothLatestVersion(SERVER_KNOBS->SMOOTHING_AMOUNT),
     smoothFreeSpace(SERVER_KNOBS->SMOOTHING_AMOUNT), smoothTotalSpace(SERVER_KNOBS->SMOOTHING_AMOUNT),
-    limitReason(limitReason_t::unlimited) {
+    smoothCompactionBytes(SERVER_KNOBS->SMOOTHING_AMOUNT), limitReason(limitReason_t::unlimited) {
 	// FIXME: this is a tacky workaround for a potential uninitialized use in trackStorageServerQueueInfo
 	lastReply.instanceID = -1;
 }
@@ -969,6 +997,7 @@ void StorageQueueInfo::update(StorageQueuingMetricsReply const& reply, Smoother&
 		smoothTotalSpace.reset(reply.storageBytes.total);
 		smoothDurableVersion.reset(reply.durableVersion);
 		smoothLatestVersion.reset(reply.version);
+		smoothCompactionBytes.reset(reply.compactionBytes);
 	} else {
 		smoothTotalDurableBytes.addDelta(reply.bytesDurable - prevReply.bytesDurable);
 		smoothDurableBytes.setTotal(reply.bytesDurable);
@@ -978,6 +1007,7 @@ void StorageQueueInfo::update(StorageQueuingMetricsReply const& reply, Smoother&
 		smoothTotalSpace.setTotal(reply.storageBytes.total);
 		smoothDurableVersion.setTotal(reply.durableVersion);
 		smoothLatestVersion.setTotal(reply.version);
+		smoothCompactionBytes.setTotal(reply.compactionBytes);
 	}
 
 	busiestReadTags = reply.busiestTags;
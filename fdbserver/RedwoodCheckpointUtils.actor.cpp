@@ -0,0 +1,269 @@
+/*
+ *RedwoodCheckpointUtils.actor.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fdbserver/RedwoodCheckpointUtils.actor.h"
+
+#include "fdbclient/FDBTypes.h"
+#include "fdbclient/NativeAPI.actor.h"
+#include "fdbclient/StorageCheckpoint.h"
+#include "fdbclient/SystemData.h"
+#include "fdbserver/IKeyValueStore.h"
+#include "flow/Trace.h"
+#include "flow/flow.h"
+
+#include "flow/actorcompiler.h" // has to be last include
+
+namespace {
+
+// RedwoodCheckpointReader serves a Redwood checkpoint either as raw pager file chunks via
+// nextChunk, for physical file transfer, or as key-value pairs via nextKeyValues, by opening
+// the pager file copy as a Redwood store and scanning it.
+class RedwoodCheckpointReader : public ICheckpointReader {
+public:
+	RedwoodCheckpointReader(const CheckpointMetaData& checkpoint, UID logID)
+	  : checkpoint_(checkpoint), id_(logID), offset_(0) {}
+
+	Future<Void> init(StringRef token) override;
+
+	Future<RangeResult> nextKeyValues(const int rowLimit, const int byteLimit) override {
+		if (kvStore_ == nullptr) {
+			throw not_implemented();
+		}
+		return getNextKeyValues(this, rowLimit, byteLimit);
+	}
+
+	Future<Standalone<StringRef>> nextChunk(const int byteLimit) override {
+		if (!file_.isValid()) {
+			throw not_implemented();
+		}
+		return getNextChunk(this, byteLimit);
+	}
+
+	Future<Void> close() override { return doClose(this); }
+
+private:
+	ACTOR static Future<Void> doFileInit(RedwoodCheckpointReader* self) {
+		try {
+			Reference<IAsyncFile> file = wait(IAsyncFileSystem::filesystem()->open(
+			    self->path_, IAsyncFile::OPEN_READONLY | IAsyncFile::OPEN_UNCACHED | IAsyncFile::OPEN_NO_AIO, 0));
+			self->file_ = file;
+			TraceEvent("RedwoodCheckpointReaderOpenFile", self->id_).detail("File", self->path_);
+		} catch (Error& e) {
+			TraceEvent(SevWarnAlways, "RedwoodCheckpointReaderOpenFileFailure", self->id_)
+			    .errorUnsuppressed(e)
+			    .detail("File", self->path_);
+			throw e;
+		}
+		return Void();
+	}
+
+	ACTOR static Future<Void> doStoreInit(RedwoodCheckpointReader* self) {
+		// Opening the copy runs normal Redwood recovery, which may rewrite pager internals but
+		// leaves the logical contents of the checkpoint unchanged.
+		self->kvStore_ = openKVStore(KeyValueStoreType::SSD_REDWOOD_V1, self->path_, self->id_, 0);
+		wait(self->kvStore_->init());
+		TraceEvent("RedwoodCheckpointReaderOpenStore", self->id_)
+		    .detail("File", self->path_)
+		    .detail("Range", self->range_);
+		return Void();
+	}
+
+	ACTOR static Future<Standalone<StringRef>> getNextChunk(RedwoodCheckpointReader* self, int byteLimit) {
+		int blockSize = std::min(64 * 1024, byteLimit); // Block size read from disk.
+		state Standalone<StringRef> buf = makeAlignedString(_PAGE_SIZE, blockSize);
+		int bytesRead = wait(self->file_->read(mutateString(buf), blockSize, self->offset_));
+		if (bytesRead == 0) {
+			throw end_of_stream();
+		}
+
+		self->offset_ += bytesRead;
+		return buf.substr(0, bytesRead);
+	}
+
+	ACTOR static Future<RangeResult> getNextKeyValues(RedwoodCheckpointReader* self, int rowLimit, int byteLimit) {
+		if (self->nextKey_ >= self->range_.end) {
+			throw end_of_stream();
+		}
+		RangeResult res = wait(self->kvStore_->readRange(KeyRangeRef(self->nextKey_, self->range_.end),
+		                                                 rowLimit,
+		                                                 byteLimit,
+		                                                 IKeyValueStore::ReadType::FETCH));
+		if (res.empty()) {
+			throw end_of_stream();
+		}
+		self->nextKey_ = keyAfter(res.back().key);
+		return res;
+	}
+
+	ACTOR static Future<Void> doClose(RedwoodCheckpointReader* self) {
+		if (self->kvStore_ != nullptr) {
+			Future<Void> closed = self->kvStore_->onClosed();
+			self->kvStore_->close();
+			wait(closed);
+		}
+		wait(delay(0, TaskPriority::FetchKeys));
+		delete self;
+		return Void();
+	}
+
+	CheckpointMetaData checkpoint_;
+	UID id_;
+	std::string path_;
+	Reference<IAsyncFile> file_;
+	int64_t offset_;
+	IKeyValueStore* kvStore_ = nullptr;
+	KeyRange range_;
+	Key nextKey_;
+};
+
+Future<Void> RedwoodCheckpointReader::init(StringRef token) {
+	ASSERT_EQ(checkpoint_.getFormat(), RedwoodV1);
+	const RedwoodCheckpoint redwood = getRedwoodCheckpoint(checkpoint_);
+	path_ = joinPath(redwood.dir, redwood.pagerFile);
+
+	if (token.toString() == redwood.pagerFile) {
+		offset_ = 0;
+		return doFileInit(this);
+	}
+
+	// Otherwise the token names a key range to scan from the checkpoint contents.
+	KeyRange requested = BinaryReader::fromStringRef<KeyRange>(token, IncludeVersion());
+	range_ = requested & checkpoint_.range;
+	nextKey_ = range_.begin;
+	return doStoreInit(this);
+}
+
+} // namespace
+
+ICheckpointReader* newRedwoodCheckpointReader(const CheckpointMetaData& checkpoint, UID logID) {
+	return new RedwoodCheckpointReader(checkpoint, logID);
+}
+
+RedwoodCheckpoint getRedwoodCheckpoint(const CheckpointMetaData& checkpoint) {
+	RedwoodCheckpoint redwood;
+	ObjectReader reader(checkpoint.serializedCheckpoint.begin(), IncludeVersion());
+	reader.deserialize(redwood);
+	return redwood;
+}
+
+ACTOR Future<CheckpointMetaData> fetchRedwoodCheckpoint(Database cx,
+                                                        CheckpointMetaData initialState,
+                                                        std::string dir,
+                                                        std::function<Future<Void>(const CheckpointMetaData&)> cFun) {
+	state CheckpointMetaData metaData = initialState;
+	state RedwoodCheckpoint redwood = getRedwoodCheckpoint(initialState);
+	TraceEvent(SevInfo, "FetchRedwoodCheckpointBegin")
+	    .detail("InitialState", initialState.toString())
+	    .detail("CheckpointDir", dir);
+
+	// Skip a file that has already been fetched.
+	if (redwood.fetched && redwood.dir == dir) {
+		return metaData;
+	}
+
+	state std::string localFile = joinPath(dir, redwood.pagerFile);
+	state UID ssID = metaData.ssID;
+
+	state Transaction tr(cx);
+	state StorageServerInterface ssi;
+	loop {
+		try {
+			tr.setOption(FDBTransactionOptions::READ_SYSTEM_KEYS);
+			Optional<Value> ss = wait(tr.get(serverListKeyFor(ssID)));
+			if (!ss.present()) {
+				throw checkpoint_not_found();
+			}
+			ssi = decodeServerListValue(ss.get());
+			break;
+		} catch (Error& e) {
+			wait(tr.onError(e));
+		}
+	}
+
+	state int attempt = 0;
+	loop {
+		try {
+			++attempt;
+			TraceEvent("FetchRedwoodCheckpointFileBegin")
+			    .detail("RemoteFile", redwood.pagerFile)
+			    .detail("StorageServer", ssi.id().toString())
+			    .detail("LocalFile", localFile)
+			    .detail("Attempt", attempt);
+
+			wait(IAsyncFileSystem::filesystem()->deleteFile(localFile, true));
+			const int64_t flags = IAsyncFile::OPEN_ATOMIC_WRITE_AND_CREATE | IAsyncFile::OPEN_READWRITE |
+			                      IAsyncFile::OPEN_CREATE | IAsyncFile::OPEN_UNCACHED | IAsyncFile::OPEN_NO_AIO;
+			state int64_t offset = 0;
+			state Reference<IAsyncFile> asyncFile = wait(IAsyncFileSystem::filesystem()->open(localFile, flags, 0666));
+
+			state ReplyPromiseStream<FetchCheckpointReply> stream =
+			    ssi.fetchCheckpoint.getReplyStream(FetchCheckpointRequest(metaData.checkpointID, redwood.pagerFile));
+			loop {
+				state FetchCheckpointReply rep = waitNext(stream.getFuture());
+				wait(asyncFile->write(rep.data.begin(), rep.data.size(), offset));
+				wait(asyncFile->flush());
+				offset += rep.data.size();
+			}
+		} catch (Error& e) {
+			if (e.code() != error_code_end_of_stream) {
+				TraceEvent("FetchRedwoodCheckpointFileError")
+				    .errorUnsuppressed(e)
+				    .detail("RemoteFile", redwood.pagerFile)
+				    .detail("StorageServer", ssi.toString())
+				    .detail("LocalFile", localFile)
+				    .detail("Attempt", attempt);
+				if (attempt >= 3) {
+					throw e;
+				}
+			} else {
+				wait(asyncFile->sync());
+				int64_t fileSize = wait(asyncFile->size());
+				TraceEvent("FetchRedwoodCheckpointFileEnd")
+				    .detail("RemoteFile", redwood.pagerFile)
+				    .detail("StorageServer", ssi.toString())
+				    .detail("LocalFile", localFile)
+				    .detail("Attempt", attempt)
+				    .detail("DataSize", offset)
+				    .detail("FileSize", fileSize)
+				    .detail("ExpectedSize", redwood.pagerFileSize);
+				if (fileSize != redwood.pagerFileSize) {
+					throw io_error();
+				}
+				redwood.dir = dir;
+				redwood.fetched = true;
+				metaData.serializedCheckpoint = ObjectWriter::toValue(redwood, IncludeVersion());
+				if (cFun) {
+					wait(cFun(metaData));
+				}
+				return metaData;
+			}
+		}
+	}
+}
+
+ACTOR Future<Void> deleteRedwoodCheckpoint(CheckpointMetaData checkpoint) {
+	RedwoodCheckpoint redwood = getRedwoodCheckpoint(checkpoint);
+	TraceEvent(SevInfo, "DeleteRedwoodCheckpoint", checkpoint.checkpointID)
+	    .detail("CheckpointID", checkpoint.checkpointID)
+	    .detail("RedwoodCheckpoint", redwood.toString());
+	platform::eraseDirectoryRecursive(redwood.dir);
+	wait(delay(0, TaskPriority::FetchKeys));
+	return Void();
+}
@@ -145,6 +145,11 @@ struct Resolver : ReferenceCounted<Resolver> {
 	std::unordered_map<UID, StorageServerInterface> tssMapping;
 	bool forceRecovery = false;
 
+	// True while a batch is suspended on the conflict set's worker threads between the duplicate
+	// check and version.set() in resolveBatch. Only set when RESOLVER_READ_CHECK_THREADS > 0; the
+	// serial path never waits in that region.
+	bool resolutionInFlight = false;
+
 	Version debugMinRecentStateVersion = 0;
 
 	// The previous commit versions per tlog
@@ -249,8 +254,17 @@ ACTOR Future<Void> resolveBatch(Reference<Resolver> self, ResolveTransactionBatc
 		g_network->setCurrentTask(TaskPriority::DefaultEndpoint);
 	}
 
+	while (self->resolutionInFlight && self->version.get() == req.prevVersion) {
+		// Another actor is resolving this same version on the conflict set's worker threads. Wait
+		// for it to finish so the check below recognizes this request as a duplicate rather than
+		// applying the batch a second time.
+		CODE_PROBE(true, "Duplicate resolve batch request while parallel conflict check in flight");
+		wait(self->version.whenAtLeast(req.prevVersion + 1));
+	}
+
 	if (self->version.get() ==
-	    req.prevVersion) { // Not a duplicate (check relies on no waiting between here and self->version.set() below!)
+	    req.prevVersion) { // Not a duplicate (check relies on no waiting between here and self->version.set() below,
+		                   // except for the parallel conflict check, which is guarded by resolutionInFlight!)
 		++self->resolveBatchStart;
 		self->resolvedTransactions += req.transactions.size();
 		self->resolvedBytes += req.transactions.expectedSize();
@@ -260,23 +274,23 @@ ACTOR Future<Void> resolveBatch(Reference<Resolver> self, ResolveTransactionBatc
 			                                   proxyInfo.outstandingBatches.upper_bound(req.lastReceivedVersion));
 		}
 
-		Version firstUnseenVersion = proxyInfo.lastVersion + 1;
+		state Version firstUnseenVersion = proxyInfo.lastVersion + 1;
 		proxyInfo.lastVersion = req.version;
 
 		if (req.debugID.present())
 			g_traceBatch.addEvent("CommitDebug", debugID.get().first(), "Resolver.resolveBatch.AfterOrderer");
 
-		ResolveTransactionBatchReply& reply = proxyInfo.outstandingBatches[req.version];
-		reply.writtenTags = req.writtenTags;
-
-		std::vector<int> commitList;
-		std::vector<int> tooOldList;
+		state std::vector<int> commitList;
+		state std::vector<int> tooOldList;
 
 		// Detect conflicts
 		double expire = now() + SERVER_KNOBS->SAMPLE_EXPIRATION_TIME;
-		ConflictBatch conflictBatch(self->conflictSet, &reply.conflictingKeyRangeMap, &reply.arena);
+		state std::unique_ptr<ConflictBatch> conflictBatch(
+		    new ConflictBatch(self->conflictSet,
+		                      &proxyInfo.outstandingBatches[req.version].conflictingKeyRangeMap,
+		                      &proxyInfo.outstandingBatches[req.version].arena));
 		for (int t = 0; t < req.transactions.size(); t++) {
-			conflictBatch.addTransaction(req.transactions[t]);
+			conflictBatch->addTransaction(req.transactions[t]);
 			self->resolvedReadConflictRanges += req.transactions[t].read_conflict_ranges.size();
 			self->resolvedWriteConflictRanges += req.transactions[t].write_conflict_ranges.size();
 
@@ -289,9 +303,19 @@ ACTOR Future<Void> resolveBatch(Reference<Resolver> self, ResolveTransactionBatc
 					    it.begin, SERVER_KNOBS->SAMPLE_OFFSET_PER_KEY + it.begin.size(), expire);
 			}
 		}
-		conflictBatch.detectConflicts(
-		    req.version, req.version - SERVER_KNOBS->MAX_WRITE_TRANSACTION_LIFE_VERSIONS, commitList, &tooOldList);
+		if (SERVER_KNOBS->RESOLVER_READ_CHECK_THREADS > 0) {
+			self->resolutionInFlight = true;
+			wait(conflictBatch->detectConflictsParallel(
+			    req.version, req.version - SERVER_KNOBS->MAX_WRITE_TRANSACTION_LIFE_VERSIONS, commitList, &tooOldList));
+			self->resolutionInFlight = false;
+		} else {
+			conflictBatch->detectConflicts(
+			    req.version, req.version - SERVER_KNOBS->MAX_WRITE_TRANSACTION_LIFE_VERSIONS, commitList, &tooOldList);
+		}
+		conflictBatch.reset();
 
+		ResolveTransactionBatchReply& reply = proxyInfo.outstandingBatches[req.version];
+		reply.writtenTags = req.writtenTags;
 		reply.debugID = req.debugID;
 		reply.committed.resize(reply.arena, req.transactions.size());
 		for (int c = 0; c < commitList.size(); c++)
@@ -326,9 +326,11 @@ ACTOR Future<Standalone<VectorRef<KeyValueRef>>> decodeLogFileBlock(Reference<IA
 	state StringRefReader reader(buf, restore_corrupted_data());
 
 	try {
-		// Read header, currently only decoding version BACKUP_AGENT_MLOG_VERSION
-		if (reader.consume<int32_t>() != BACKUP_AGENT_MLOG_VERSION)
+		// Read header, decoding versions BACKUP_AGENT_MLOG_VERSION and BACKUP_AGENT_MLOG_VERSION_VARINT
+		uint32_t version = (uint32_t)reader.consume<int32_t>();
+		if (version != BACKUP_AGENT_MLOG_VERSION && version != BACKUP_AGENT_MLOG_VERSION_VARINT)
 			throw restore_unsupported_file_version();
+		bool varintLengths = version == BACKUP_AGENT_MLOG_VERSION_VARINT;
 
 		// Read k/v pairs.  Block ends either at end of last value exactly or with 0xFF as first key len byte.
 		while (1) {
@@ -337,9 +339,9 @@ ACTOR Future<Standalone<VectorRef<KeyValueRef>>> decodeLogFileBlock(Reference<IA
 				break;
 
 			// Read key and value.  If anything throws then there is a problem.
-			uint32_t kLen = reader.consumeNetworkUInt32();
+			uint32_t kLen = varintLengths ? reader.consumeCompressedUInt() : reader.consumeNetworkUInt32();
 			const uint8_t* k = reader.consume(kLen);
-			uint32_t vLen = reader.consumeNetworkUInt32();
+			uint32_t vLen = varintLengths ? reader.consumeCompressedUInt() : reader.consumeNetworkUInt32();
 			const uint8_t* v = reader.consume(vLen);
 
 			results.push_back(results.arena(), KeyValueRef(KeyRef(k, kLen), ValueRef(v, vLen)));
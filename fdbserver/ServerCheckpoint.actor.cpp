@@ -20,6 +20,7 @@
 
 #include "fdbserver/ServerCheckpoint.actor.h"
 #include "fdbserver/RocksDBCheckpointUtils.actor.h"
+#include "fdbserver/RedwoodCheckpointUtils.actor.h"
 
 #include "flow/actorcompiler.h" // has to be last include
 
@@ -27,6 +28,8 @@ ICheckpointReader* newCheckpointReader(const CheckpointMetaData& checkpoint, UID
 	const CheckpointFormat format = checkpoint.getFormat();
 	if (format == RocksDBColumnFamily || format == RocksDB) {
 		return newRocksDBCheckpointReader(checkpoint, logID);
+	} else if (format == RedwoodV1) {
+		return newRedwoodCheckpointReader(checkpoint, logID);
 	} else {
 		throw not_implemented();
 	}
@@ -39,6 +42,8 @@ ACTOR Future<Void> deleteCheckpoint(CheckpointMetaData checkpoint) {
 	state CheckpointFormat format = checkpoint.getFormat();
 	if (format == RocksDBColumnFamily || format == RocksDB) {
 		wait(deleteRocksCheckpoint(checkpoint));
+	} else if (format == RedwoodV1) {
+		wait(deleteRedwoodCheckpoint(checkpoint));
 	} else {
 		throw not_implemented();
 	}
@@ -56,6 +61,9 @@ ACTOR Future<CheckpointMetaData> fetchCheckpoint(Database cx,
 	if (format == RocksDBColumnFamily || format == RocksDB) {
 		CheckpointMetaData _result = wait(fetchRocksDBCheckpoint(cx, initialState, dir, cFun));
 		result = _result;
+	} else if (format == RedwoodV1) {
+		CheckpointMetaData _result = wait(fetchRedwoodCheckpoint(cx, initialState, dir, cFun));
+		result = _result;
 	} else {
 		throw not_implemented();
 	}
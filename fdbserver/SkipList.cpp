@@ -27,12 +27,15 @@
 #include <vector>
 
 #include "flow/Platform.h"
+#include "flow/IThreadPool.h"
+#include "flow/ThreadHelper.actor.h"
 #include "fdbrpc/fdbrpc.h"
 #include "fdbrpc/PerfMetric.h"
 #include "fdbclient/FDBTypes.h"
 #include "fdbclient/KeyRangeMap.h"
 #include "fdbclient/SystemData.h"
 #include "fdbserver/ConflictSet.h"
+#include "fdbserver/Knobs.h"
 
 static std::vector<PerfDoubleCounter*> skc;
 
@@ -782,13 +785,59 @@ private:
 	}
 };
 
+// Owns everything the worker threads touch during one parallel read-conflict check, so a
+// cancelled resolver batch cannot free memory out from under the pool. The range keys are flat
+// copies rather than references into the request arena because Arena reference counts are not
+// thread safe.
+struct ReadConflictCheckJob : ThreadSafeReferenceCounted<ReadConflictCheckJob> {
+	std::vector<uint8_t> keys;
+	std::vector<ReadConflictRange> ranges;
+	std::vector<std::unique_ptr<bool[]>> results; // one per-transaction status array per chunk
+};
+
+class ConflictCheckThread final : public IThreadPoolReceiver {
+public:
+	void init() override {}
+
+	struct CheckAction final : TypedAction<ConflictCheckThread, CheckAction>, FastAllocated<CheckAction> {
+		CheckAction(Reference<ReadConflictCheckJob> job, SkipList* list, int begin, int end, bool* results)
+		  : job(job), list(list), begin(begin), end(end), results(results) {}
+		double getTimeEstimate() const override { return .001; }
+
+		Reference<ReadConflictCheckJob> job;
+		SkipList* list; // read-only during the check; the conflict set joins the pool before freeing it
+		int begin, end;
+		bool* results;
+		ThreadReturnPromise<Void> done;
+	};
+
+	void action(CheckAction& a) {
+		a.list->detectConflicts(&a.job->ranges[a.begin], a.end - a.begin, a.results);
+		a.done.send(Void());
+	}
+};
+
 struct ConflictSet {
-	ConflictSet() : removalKey(makeString(0)), oldestVersion(0) {}
-	~ConflictSet() {}
+	ConflictSet() : removalKey(makeString(0)), oldestVersion(0) {
+		if (SERVER_KNOBS->RESOLVER_READ_CHECK_THREADS > 0) {
+			readCheckPool = createGenericThreadPool();
+			for (int i = 0; i < SERVER_KNOBS->RESOLVER_READ_CHECK_THREADS; i++) {
+				readCheckPool->addThread(new ConflictCheckThread(), "fdb-conflictck");
+			}
+		}
+	}
+	~ConflictSet() {
+		if (readCheckPool) {
+			// Synchronously joins the worker threads, so in-flight checks finish before the skip
+			// list is freed.
+			readCheckPool->stop();
+		}
+	}
 
 	SkipList versionHistory;
 	Key removalKey;
 	Version oldestVersion;
+	Reference<IThreadPool> readCheckPool;
 };
 
 ConflictSet* newConflictSet() {
@@ -921,7 +970,85 @@ void ConflictBatch::detectConflicts(Version now,
 	checkReadConflictRanges();
 	g_checkRead += timer() - t;
 
+	finishDetectConflicts(now, newOldestVersion, nonConflicting, tooOldTransactions);
+}
+
+Future<Void> ConflictBatch::detectConflictsParallel(Version now,
+                                                    Version newOldestVersion,
+                                                    std::vector<int>& nonConflicting,
+                                                    std::vector<int>* tooOldTransactions) {
+	bool reportsConflictingKeys = false;
+	for (const ReadConflictRange& range : combinedReadConflictRanges) {
+		if (range.conflictingKeyRange != nullptr) {
+			reportsConflictingKeys = true;
+			break;
+		}
+	}
+	const int threads = SERVER_KNOBS->RESOLVER_READ_CHECK_THREADS;
+	if (!cs->readCheckPool || reportsConflictingKeys || (int)combinedReadConflictRanges.size() < threads * 2) {
+		detectConflicts(now, newOldestVersion, nonConflicting, tooOldTransactions);
+		return Void();
+	}
+
+	double t = timer();
+	sortPoints(points);
+	g_sort += timer() - t;
+
 	t = timer();
+	Reference<ReadConflictCheckJob> job(new ReadConflictCheckJob);
+	size_t keyBytes = 0;
+	for (const ReadConflictRange& range : combinedReadConflictRanges) {
+		keyBytes += range.begin.size() + range.end.size();
+	}
+	job->keys.resize(keyBytes);
+	job->ranges = combinedReadConflictRanges;
+	uint8_t* p = job->keys.data();
+	for (ReadConflictRange& range : job->ranges) {
+		memcpy(p, range.begin.begin(), range.begin.size());
+		range.begin = StringRef(p, range.begin.size());
+		p += range.begin.size();
+		memcpy(p, range.end.begin(), range.end.size());
+		range.end = StringRef(p, range.end.size());
+		p += range.end.size();
+		range.conflictingKeyRange = nullptr;
+		range.cKRArena = nullptr;
+	}
+
+	std::vector<Future<Void>> done;
+	const int count = job->ranges.size();
+	const int chunkSize = (count + threads - 1) / threads;
+	for (int begin = 0; begin < count; begin += chunkSize) {
+		const int end = std::min(begin + chunkSize, count);
+		job->results.emplace_back(new bool[transactionCount]());
+		auto a = new ConflictCheckThread::CheckAction(
+		    job, &cs->versionHistory, begin, end, job->results.back().get());
+		done.push_back(a->done.getFuture());
+		cs->readCheckPool->post(a);
+	}
+	g_checkRead += timer() - t;
+
+	return map(waitForAll(done),
+	           [this, job, now, newOldestVersion, &nonConflicting, tooOldTransactions](Void) {
+		           double t = timer();
+		           transactionConflictStatus = new bool[transactionCount];
+		           memset(transactionConflictStatus, 0, transactionCount * sizeof(bool));
+		           for (const auto& chunk : job->results) {
+			           for (int i = 0; i < transactionCount; i++) {
+				           transactionConflictStatus[i] |= chunk[i];
+			           }
+		           }
+		           g_checkRead += timer() - t;
+
+		           finishDetectConflicts(now, newOldestVersion, nonConflicting, tooOldTransactions);
+		           return Void();
+	           });
+}
+
+void ConflictBatch::finishDetectConflicts(Version now,
+                                          Version newOldestVersion,
+                                          std::vector<int>& nonConflicting,
+                                          std::vector<int>* tooOldTransactions) {
+	double t = timer();
 	checkIntraBatchConflicts();
 	g_checkBatch += timer() - t;
 
@@ -471,6 +471,43 @@ struct RolesInfo {
 		return latencyBands;
 	}
 
+	// Parses a ReadLatencyBandsByRange event, which attributes a storage server's latency band counts to the
+	// busiest key ranges it served in the last logging interval
+	JsonBuilderArray addRangeLatencyBandInfo(TraceEventFields const& metrics) {
+		JsonBuilderArray rangeBands;
+
+		int count = metrics.getInt("Ranges");
+		for (int i = 0; i < count; i++) {
+			JsonBuilderObject range;
+			range["begin"] = metrics.getValue(format("Range%dBegin", i));
+			range["end"] = metrics.getValue(format("Range%dEnd", i));
+			range.setKeyRawNumber("count", metrics.getValue(format("Range%dCount", i)));
+			range.setKeyRawNumber("filtered", metrics.getValue(format("Range%dFiltered", i)));
+
+			// Bands are encoded as a comma-separated list of <threshold>:<count> pairs
+			JsonBuilderObject bands;
+			std::string bandCounts = metrics.getValue(format("Range%dBands", i));
+			size_t pos = 0;
+			while (pos < bandCounts.size()) {
+				size_t end = bandCounts.find(',', pos);
+				if (end == std::string::npos) {
+					end = bandCounts.size();
+				}
+				std::string entry = bandCounts.substr(pos, end - pos);
+				size_t sep = entry.find(':');
+				if (sep != std::string::npos) {
+					bands.setKeyRawNumber(entry.substr(0, sep), entry.substr(sep + 1));
+				}
+				pos = end + 1;
+			}
+			range["bands"] = bands;
+
+			rangeBands.push_back(range);
+		}
+
+		return rangeBands;
+	}
+
 	JsonBuilderObject& addRole(NetworkAddress address, std::string const& role, UID id) {
 		JsonBuilderObject obj;
 		obj["id"] = id.shortString();
@@ -547,6 +584,11 @@ struct RolesInfo {
 				obj["read_latency_bands"] = addLatencyBandInfo(readLatencyBands);
 			}
 
+			TraceEventFields const& readLatencyBandsByRange = metrics.at("ReadLatencyBandsByRange");
+			if (readLatencyBandsByRange.size()) {
+				obj["read_latency_bands_by_range"] = addRangeLatencyBandInfo(readLatencyBandsByRange);
+			}
+
 			obj["data_lag"] = getLagObject(versionLag);
 			obj["durability_lag"] = getLagObject(version - durableVersion);
 			dataLagSeconds = versionLag / (double)SERVER_KNOBS->VERSIONS_PER_SECOND;
@@ -1982,7 +2024,11 @@ ACTOR static Future<std::vector<StorageServerStatusInfo>> getStorageServerStatus
 	           getServerMetrics(servers,
 	                            address_workers,
 	                            std::vector<std::string>{
-	                                "StorageMetrics", "ReadLatencyMetrics", "ReadLatencyBands", "BusiestReadTag" })) &&
+	                                "StorageMetrics",
+	                                "ReadLatencyMetrics",
+	                                "ReadLatencyBands",
+	                                "ReadLatencyBandsByRange",
+	                                "BusiestReadTag" })) &&
 	     store(busiestWriteTags, getServerBusiestWriteTags(servers, address_workers, rkWorker)));
 
 	ASSERT(busiestWriteTags.size() == results.size());
@@ -3494,6 +3540,23 @@ TEST_CASE("/status/json/builder") {
 	ASSERT(checkAsciiNumber("-.e+"));
 	ASSERT(checkAsciiNumber("-.0e+1"));
 
+	// Cache a finished subtree's serialized bytes and splice them into new documents
+	// without re-serialization
+	Standalone<StringRef> cached = object2.toStringRef();
+	ASSERT(cached.toString() == object2.getJson());
+
+	JsonBuilderObject reuse;
+	reuse["cached"] = JsonBuilder::fromRawJson(cached);
+	reuse["fresh"] = 7;
+	ASSERT(checkJson(reuse, ("{\"cached\":" + object2.getJson() + ",\"fresh\":7}").c_str()));
+
+	JsonBuilderArray reuseArray;
+	reuseArray.push_back(JsonBuilder::fromRawJson(cached));
+	reuseArray.push_back(JsonBuilder::fromRawJson(cached));
+	ASSERT(checkJson(reuseArray, ("[" + object2.getJson() + "," + object2.getJson() + "]").c_str()));
+
+	ASSERT(checkJson(JsonBuilder::fromRawJson(Standalone<StringRef>()), "null"));
+
 	return Void();
 }
 
@@ -410,6 +410,26 @@ double TCTeamInfo::getLoadReadBandwidth(bool includeInFlight, double inflightPen
 	       (includeInFlight ? inflightPenalty * getReadInFlightToTeam() / servers.size() : 0);
 }
 
+double TCTeamInfo::getLoadScore(bool includeInFlight, double inflightPenalty) const {
+	// Each axis is normalized to [0,1] at saturation; the score is the busiest axis rather than a
+	// weighted sum so that a team saturated on one dimension cannot look attractive by being idle
+	// on the others. CPU and disk busyness come per server from SystemMonitor via the storage
+	// metrics reply; the team is only as good as its busiest member.
+	double cpuDiskScore = 0;
+	for (const auto& server : servers) {
+		if (server->metricsPresent()) {
+			auto& replyValue = server->getMetrics();
+			cpuDiskScore = std::max(cpuDiskScore, std::max(replyValue.cpuUsage, replyValue.diskUsage) / 100.0);
+		}
+	}
+
+	double readScore =
+	    getLoadReadBandwidth(includeInFlight, inflightPenalty) / SERVER_KNOBS->DD_LOAD_SCORE_READ_SATURATION;
+	double spaceScore = 1.0 - getMinAvailableSpaceRatio(includeInFlight);
+
+	return std::max({ cpuDiskScore, readScore, spaceScore });
+}
+
 int64_t TCTeamInfo::getMinAvailableSpace(bool includeInFlight) const {
 	int64_t minAvailableSpace = std::numeric_limits<int64_t>::max();
 	for (const auto& server : servers) {
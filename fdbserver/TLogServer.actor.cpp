@@ -18,6 +18,7 @@
  * limitations under the License.
  */
 
+#include "flow/ChunkedDeque.h"
 #include "flow/Hash3.h"
 #include "flow/UnitTest.h"
 #include "fdbclient/NativeAPI.actor.h"
@@ -228,7 +229,7 @@ static const KeyRange persistTagPoppedKeys = prefixRange(LiteralStringRef("TagPo
 static const KeyRef persistClusterIdKey = LiteralStringRef("clusterId");
 
 static Key persistTagMessagesKey(UID id, Tag tag, Version version) {
-	BinaryWriter wr(Unversioned());
+	FixedSizeWriter<64> wr(Unversioned());
 	wr.serializeBytes(persistTagMessagesKeys.begin);
 	wr << id;
 	wr << tag;
@@ -237,7 +238,7 @@ static Key persistTagMessagesKey(UID id, Tag tag, Version version) {
 }
 
 static Key persistTagMessageRefsKey(UID id, Tag tag, Version version) {
-	BinaryWriter wr(Unversioned());
+	FixedSizeWriter<64> wr(Unversioned());
 	wr.serializeBytes(persistTagMessageRefsKeys.begin);
 	wr << id;
 	wr << tag;
@@ -246,7 +247,7 @@ static Key persistTagMessageRefsKey(UID id, Tag tag, Version version) {
 }
 
 static Key persistTagPoppedKey(UID id, Tag tag) {
-	BinaryWriter wr(Unversioned());
+	FixedSizeWriter<64> wr(Unversioned());
 	wr.serializeBytes(persistTagPoppedKeys.begin);
 	wr << id;
 	wr << tag;
@@ -406,6 +407,16 @@ struct LogData : NonCopyable, public ReferenceCounted<LogData> {
 		bool unpoppedRecovered;
 		Tag tag;
 
+		// A partially filled spill-by-reference index batch carried into the next spill cycle,
+		// so that index batches fill toward TLOG_SPILL_REFERENCE_MAX_BYTES_PER_BATCH instead of
+		// the index getting one small record per tag per cycle. The carried bytes are already
+		// durable under spillBatchLastVersion's key; the cycle that resumes them rewrites the
+		// combined batch under its new last version and clears the superseded key.
+		Standalone<StringRef> spillBatchBytes;
+		uint32_t spillBatchCount;
+		IDiskQueue::location spillBatchFirstLocation;
+		Version spillBatchLastVersion;
+
 		TagData(Tag tag,
 		        Version popped,
 		        IDiskQueue::location poppedLocation,
@@ -414,13 +425,16 @@ struct LogData : NonCopyable, public ReferenceCounted<LogData> {
 		        bool unpoppedRecovered)
 		  : nothingPersistent(nothingPersistent), poppedRecently(poppedRecently), popped(popped), persistentPopped(0),
 		    versionForPoppedLocation(0), poppedLocation(poppedLocation), unpoppedRecovered(unpoppedRecovered),
-		    tag(tag) {}
+		    tag(tag), spillBatchCount(0), spillBatchFirstLocation(std::numeric_limits<IDiskQueue::location>::max()),
+		    spillBatchLastVersion(invalidVersion) {}
 
 		TagData(TagData&& r) noexcept
 		  : versionMessages(std::move(r.versionMessages)), nothingPersistent(r.nothingPersistent),
 		    poppedRecently(r.poppedRecently), popped(r.popped), persistentPopped(r.persistentPopped),
 		    versionForPoppedLocation(r.versionForPoppedLocation), poppedLocation(r.poppedLocation),
-		    unpoppedRecovered(r.unpoppedRecovered), tag(r.tag) {}
+		    unpoppedRecovered(r.unpoppedRecovered), tag(r.tag), spillBatchBytes(std::move(r.spillBatchBytes)),
+		    spillBatchCount(r.spillBatchCount), spillBatchFirstLocation(r.spillBatchFirstLocation),
+		    spillBatchLastVersion(r.spillBatchLastVersion) {}
 		void operator=(TagData&& r) noexcept {
 			versionMessages = std::move(r.versionMessages);
 			nothingPersistent = r.nothingPersistent;
@@ -431,6 +445,10 @@ struct LogData : NonCopyable, public ReferenceCounted<LogData> {
 			poppedLocation = r.poppedLocation;
 			tag = r.tag;
 			unpoppedRecovered = r.unpoppedRecovered;
+			spillBatchBytes = std::move(r.spillBatchBytes);
+			spillBatchCount = r.spillBatchCount;
+			spillBatchFirstLocation = r.spillBatchFirstLocation;
+			spillBatchLastVersion = r.spillBatchLastVersion;
 		}
 
 		// Erase messages not needed to update *from* versions >= before (thus, messages with toversion <= before)
@@ -516,7 +534,9 @@ struct LogData : NonCopyable, public ReferenceCounted<LogData> {
 	Version minPoppedTagVersion;
 	Tag minPoppedTag; // The tag that makes tLog hold its data and cause tLog's disk queue increasing.
 
-	Deque<std::pair<Version, Standalone<VectorRef<uint8_t>>>> messageBlocks;
+	// Chunked so that a deep backlog grows by appending segments instead of
+	// copying the whole queue (see ChunkedDeque.h).
+	ChunkedDeque<std::pair<Version, Standalone<VectorRef<uint8_t>>>> messageBlocks;
 	std::vector<std::vector<Reference<TagData>>> tag_data; // tag.locality | tag.id
 	int unpoppedRecoveredTagCount;
 	std::set<Tag> unpoppedRecoveredTags;
@@ -1009,9 +1029,27 @@ ACTOR Future<Void> updatePersistentData(TLogData* self, Reference<LogData> logDa
 				state std::deque<std::pair<Version, LengthPrefixedStringRef>>::iterator msg =
 				    tagData->versionMessages.begin();
 				state int refSpilledTagCount = 0;
+				state Version carriedBatchVersion = invalidVersion;
 				wr = BinaryWriter(AssumeVersion(logData->protocolVersion));
-				// We prefix our spilled locations with a count, so that we can read this back out as a VectorRef.
-				wr << uint32_t(0);
+				bool hasRefData = !logData->shouldSpillByValue(tagData->tag) &&
+				                  msg != tagData->versionMessages.end() && msg->first <= newPersistentDataVersion;
+				if (SERVER_KNOBS->TLOG_SPILL_REFERENCE_CARRY_PARTIAL_BATCH && hasRefData &&
+				    tagData->spillBatchCount > 0) {
+					// Resume the partial index batch flushed last cycle. New entries append to it, and
+					// the combined batch is rewritten under its new last version's key with the
+					// superseded key cleared in the same commit.
+					wr.serializeBytes(tagData->spillBatchBytes);
+					refSpilledTagCount = tagData->spillBatchCount;
+					firstLocation = tagData->spillBatchFirstLocation;
+					lastVersion = tagData->spillBatchLastVersion;
+					carriedBatchVersion = tagData->spillBatchLastVersion;
+					tagData->spillBatchBytes = Standalone<StringRef>();
+					tagData->spillBatchCount = 0;
+				} else {
+					// We prefix our spilled locations with a count, so that we can read this back out as a
+					// VectorRef.
+					wr << uint32_t(0);
+				}
 				while (msg != tagData->versionMessages.end() && msg->first <= newPersistentDataVersion) {
 					currentVersion = msg->first;
 					anyData = true;
@@ -1047,6 +1085,11 @@ ACTOR Future<Void> updatePersistentData(TLogData* self, Reference<LogData> logDa
 						if ((wr.getLength() + sizeof(SpilledData) >
 						     SERVER_KNOBS->TLOG_SPILL_REFERENCE_MAX_BYTES_PER_BATCH)) {
 							*(uint32_t*)wr.getData() = refSpilledTagCount;
+							if (carriedBatchVersion != invalidVersion && carriedBatchVersion != lastVersion) {
+								self->persistentData->clear(singleKeyRange(
+								    persistTagMessageRefsKey(logData->logId, tagData->tag, carriedBatchVersion)));
+							}
+							carriedBatchVersion = invalidVersion;
 							self->persistentData->set(KeyValueRef(
 							    persistTagMessageRefsKey(logData->logId, tagData->tag, lastVersion), wr.toValue()));
 							tagData->poppedLocation = std::min(tagData->poppedLocation, firstLocation);
@@ -1068,9 +1111,21 @@ ACTOR Future<Void> updatePersistentData(TLogData* self, Reference<LogData> logDa
 				}
 				if (refSpilledTagCount > 0) {
 					*(uint32_t*)wr.getData() = refSpilledTagCount;
+					if (carriedBatchVersion != invalidVersion && carriedBatchVersion != lastVersion) {
+						self->persistentData->clear(singleKeyRange(
+						    persistTagMessageRefsKey(logData->logId, tagData->tag, carriedBatchVersion)));
+					}
 					self->persistentData->set(
 					    KeyValueRef(persistTagMessageRefsKey(logData->logId, tagData->tag, lastVersion), wr.toValue()));
 					tagData->poppedLocation = std::min(tagData->poppedLocation, firstLocation);
+					if (SERVER_KNOBS->TLOG_SPILL_REFERENCE_CARRY_PARTIAL_BATCH &&
+					    wr.getLength() + sizeof(SpilledData) <= SERVER_KNOBS->TLOG_SPILL_REFERENCE_MAX_BYTES_PER_BATCH) {
+						// This batch still has room; resume it next cycle.
+						tagData->spillBatchBytes = wr.toValue();
+						tagData->spillBatchCount = refSpilledTagCount;
+						tagData->spillBatchFirstLocation = firstLocation;
+						tagData->spillBatchLastVersion = lastVersion;
+					}
 				}
 
 				wait(yield(TaskPriority::UpdateStorage));
@@ -1791,6 +1846,14 @@ Future<Void> tLogPeekMessages(PromiseType replyPromise,
 		// txsTag is only ever peeked on recovery, and we would still wish to prioritize requests
 		// that impact recovery duration.
 		wait(delay(0, TaskPriority::TLogSpilledPeekReply));
+	} else if (SERVER_KNOBS->TLOG_BACKLOG_PEEK_VERSION_LAG > 0 && reqTag.locality != tagLocalityTxs &&
+	           reqTag != txsTag &&
+	           logData->version.get() - reqBegin > SERVER_KNOBS->TLOG_BACKLOG_PEEK_VERSION_LAG) {
+		// An in-memory peek that is far behind the tlog's version is a storage server catching up
+		// after falling behind or rejoining. TaskPriority::TLogPeek outranks TaskPriority::TLogCommit,
+		// so a storm of such peeks can crowd out ingest; serve them below commit priority for the
+		// same reason as spilled peeks above.
+		wait(delay(0, TaskPriority::TLogSpilledPeekReply));
 	}
 
 	state double workStart = now();
@@ -2235,9 +2298,15 @@ ACTOR Future<Void> commitQueue(TLogData* self) {
 			choose {
 				when(wait(logData->version.whenAtLeast(
 				    std::max(logData->queueCommittingVersion, logData->queueCommittedVersion.get()) + 1))) {
-					while (self->queueCommitBegin != self->queueCommitEnd.get() &&
+					// New versions accumulate into the next sync while earlier syncs are still in
+					// flight, so each sync covers every version pushed since the one before it.
+					// doQueueCommit acknowledges its versions only after all earlier syncs have
+					// completed, preserving per-tag ordering at any pipeline depth.
+					while (self->queueCommitBegin >=
+					           self->queueCommitEnd.get() + SERVER_KNOBS->TLOG_QUEUE_COMMIT_PIPELINE_DEPTH &&
 					       !self->largeDiskQueueCommitBytes.get()) {
-						wait(self->queueCommitEnd.whenAtLeast(self->queueCommitBegin) ||
+						wait(self->queueCommitEnd.whenAtLeast(self->queueCommitBegin -
+						                                      SERVER_KNOBS->TLOG_QUEUE_COMMIT_PIPELINE_DEPTH + 1) ||
 						     self->largeDiskQueueCommitBytes.onChange());
 					}
 					if (logData->queueCommittedVersion.get() == std::numeric_limits<Version>::max()) {
@@ -20,6 +20,7 @@
 
 #include "fdbserver/Knobs.h"
 #include "fdbserver/TransactionTagCounter.h"
+#include "flow/Hash3.h"
 #include "flow/Trace.h"
 
 namespace {
@@ -78,6 +79,103 @@ public:
 	void clear() { topTags.clear(); }
 };
 
+// Approximate per-key cost counters for the hot key index. A count-min sketch bounds memory
+// regardless of how many distinct keys are touched in an interval; estimates only ever
+// over-count, which for hot key identification means a cold key can be reported hot under
+// heavy hash collisions (kept unlikely by the sketch width) but a hot key is never missed.
+class CountMinSketch {
+	static constexpr int ROWS = 4;
+	int width;
+	std::vector<uint32_t> counts;
+
+public:
+	explicit CountMinSketch(int width) : width(width), counts(ROWS * width, 0) { ASSERT_GT(width, 0); }
+
+	int64_t add(KeyRef key, int64_t n) {
+		uint32_t h1 = 0xdeadbeef, h2 = 0xdeadbeef;
+		hashlittle2(key.begin(), key.size(), &h1, &h2);
+		int64_t result = std::numeric_limits<int64_t>::max();
+		for (int row = 0; row < ROWS; ++row) {
+			uint32_t& count = counts[row * width + (h1 + row * h2) % width];
+			count = (uint32_t)std::min<int64_t>(count + n, std::numeric_limits<uint32_t>::max());
+			result = std::min<int64_t>(result, count);
+		}
+		return result;
+	}
+
+	int64_t estimate(KeyRef key) const {
+		uint32_t h1 = 0xdeadbeef, h2 = 0xdeadbeef;
+		hashlittle2(key.begin(), key.size(), &h1, &h2);
+		int64_t result = std::numeric_limits<int64_t>::max();
+		for (int row = 0; row < ROWS; ++row) {
+			result = std::min<int64_t>(result, counts[row * width + (h1 + row * h2) % width]);
+		}
+		return result;
+	}
+
+	void clear() { std::fill(counts.begin(), counts.end(), 0); }
+};
+
+// Keeps the keys with the largest sketch estimates, using the same replace-the-minimum policy
+// as TopKTags. Keys are copied into a per-interval arena since the references handed to the
+// index do not outlive the request or mutation being counted.
+class TopKKeys {
+public:
+	struct KeyAndCost {
+		Key key;
+		int64_t readCost;
+		int64_t writeCost;
+		int64_t totalCost() const { return readCost + writeCost; }
+		KeyAndCost(Key key, int64_t readCost, int64_t writeCost)
+		  : key(key), readCost(readCost), writeCost(writeCost) {}
+	};
+
+private:
+	std::vector<KeyAndCost> topKeys;
+	int limit;
+
+public:
+	explicit TopKKeys(int limit) : limit(limit) {
+		ASSERT_GT(limit, 0);
+		topKeys.reserve(limit);
+	}
+
+	// readEstimate/writeEstimate are the sketch's current per-class estimates for this key
+	void update(KeyRef key, int64_t readEstimate, int64_t writeEstimate) {
+		auto iter = std::find_if(topKeys.begin(), topKeys.end(), [key](const auto& kc) { return kc.key == key; });
+		if (iter != topKeys.end()) {
+			iter->readCost = readEstimate;
+			iter->writeCost = writeEstimate;
+		} else if (topKeys.size() < limit) {
+			topKeys.emplace_back(Key(key), readEstimate, writeEstimate);
+		} else {
+			auto toReplace = std::min_element(
+			    topKeys.begin(), topKeys.end(), [](const auto& a, const auto& b) {
+				    return a.totalCost() < b.totalCost();
+			    });
+			if (toReplace->totalCost() < readEstimate + writeEstimate) {
+				toReplace->key = Key(key);
+				toReplace->readCost = readEstimate;
+				toReplace->writeCost = writeEstimate;
+			}
+		}
+	}
+
+	Standalone<VectorRef<HotKeyWithMetrics>> getHotKeys(double elapsed) const {
+		Standalone<VectorRef<HotKeyWithMetrics>> result;
+		for (auto const& keyAndCost : topKeys) {
+			result.push_back_deep(
+			    result.arena(),
+			    HotKeyWithMetrics(keyAndCost.key, keyAndCost.readCost / elapsed, keyAndCost.writeCost / elapsed));
+		}
+		return result;
+	}
+
+	size_t size() const { return topKeys.size(); }
+
+	void clear() { topKeys.clear(); }
+};
+
 } // namespace
 
 class TransactionTagCounterImpl {
@@ -87,15 +185,24 @@ class TransactionTagCounterImpl {
 	TopKTags topTags;
 	double intervalStart = 0;
 
+	CountMinSketch readSketch;
+	CountMinSketch writeSketch;
+	TopKKeys topKeys;
+
 	std::vector<StorageQueuingMetricsReply::TagInfo> previousBusiestTags;
+	Standalone<VectorRef<HotKeyWithMetrics>> previousHotKeys;
 	Reference<EventCacheHolder> busiestReadTagEventHolder;
+	Reference<EventCacheHolder> hotKeysEventHolder;
 
 	static int64_t costFunction(int64_t bytes) { return bytes / SERVER_KNOBS->READ_COST_BYTE_FACTOR + 1; }
 
 public:
 	TransactionTagCounterImpl(UID thisServerID)
 	  : thisServerID(thisServerID), topTags(SERVER_KNOBS->SS_THROTTLE_TAGS_TRACKED),
-	    busiestReadTagEventHolder(makeReference<EventCacheHolder>(thisServerID.toString() + "/BusiestReadTag")) {}
+	    readSketch(SERVER_KNOBS->SS_HOT_KEY_SKETCH_WIDTH), writeSketch(SERVER_KNOBS->SS_HOT_KEY_SKETCH_WIDTH),
+	    topKeys(SERVER_KNOBS->SS_HOT_KEYS_TRACKED),
+	    busiestReadTagEventHolder(makeReference<EventCacheHolder>(thisServerID.toString() + "/BusiestReadTag")),
+	    hotKeysEventHolder(makeReference<EventCacheHolder>(thisServerID.toString() + "/HotKeys")) {}
 
 	void addRequest(Optional<TagSet> const& tags, int64_t bytes) {
 		if (tags.present()) {
@@ -111,6 +218,16 @@ public:
 		}
 	}
 
+	void addKeyRead(KeyRef key, int64_t bytes) {
+		int64_t cost = costFunction(bytes);
+		topKeys.update(key, readSketch.add(key, cost), writeSketch.estimate(key));
+	}
+
+	void addKeyWrite(KeyRef key, int64_t bytes) {
+		int64_t cost = costFunction(bytes);
+		topKeys.update(key, readSketch.estimate(key), writeSketch.add(key, cost));
+	}
+
 	void startNewInterval() {
 		double elapsed = now() - intervalStart;
 		previousBusiestTags.clear();
@@ -126,13 +243,28 @@ public:
 			    .trackLatest(busiestReadTagEventHolder->trackingKey);
 		}
 
+		previousHotKeys = Standalone<VectorRef<HotKeyWithMetrics>>();
+		if (intervalStart > 0 && elapsed > 0 && topKeys.size() > 0) {
+			previousHotKeys = topKeys.getHotKeys(elapsed);
+
+			TraceEvent("HotKeys", thisServerID)
+			    .detail("Elapsed", elapsed)
+			    .detail("Reported", previousHotKeys.size())
+			    .trackLatest(hotKeysEventHolder->trackingKey);
+		}
+
 		intervalCounts.clear();
 		intervalTotalSampledCount = 0;
 		topTags.clear();
+		readSketch.clear();
+		writeSketch.clear();
+		topKeys.clear();
 		intervalStart = now();
 	}
 
 	std::vector<StorageQueuingMetricsReply::TagInfo> const& getBusiestTags() const { return previousBusiestTags; }
+
+	Standalone<VectorRef<HotKeyWithMetrics>> const& getHotKeys() const { return previousHotKeys; }
 };
 
 TransactionTagCounter::TransactionTagCounter(UID thisServerID)
@@ -144,6 +276,14 @@ void TransactionTagCounter::addRequest(Optional<TagSet> const& tags, int64_t byt
 	return impl->addRequest(tags, bytes);
 }
 
+void TransactionTagCounter::addKeyRead(KeyRef key, int64_t bytes) {
+	return impl->addKeyRead(key, bytes);
+}
+
+void TransactionTagCounter::addKeyWrite(KeyRef key, int64_t bytes) {
+	return impl->addKeyWrite(key, bytes);
+}
+
 void TransactionTagCounter::startNewInterval() {
 	return impl->startNewInterval();
 }
@@ -152,6 +292,10 @@ std::vector<StorageQueuingMetricsReply::TagInfo> const& TransactionTagCounter::g
 	return impl->getBusiestTags();
 }
 
+Standalone<VectorRef<HotKeyWithMetrics>> const& TransactionTagCounter::getHotKeys() const {
+	return impl->getHotKeys();
+}
+
 TEST_CASE("/TransactionTagCounter/TopKTags") {
 	TopKTags topTags(2);
 
@@ -208,3 +352,38 @@ TEST_CASE("/TransactionTagCounter/TopKTags") {
 	ASSERT_EQ(topTags.getBusiestTags(1.0, 0).size(), 0);
 	return Void();
 }
+
+TEST_CASE("/TransactionTagCounter/HotKeyIndex") {
+	CountMinSketch sketch(64);
+	ASSERT_EQ(sketch.estimate("a"_sr), 0);
+	ASSERT_EQ(sketch.add("a"_sr, 5), 5);
+	ASSERT_EQ(sketch.add("a"_sr, 5), 10);
+	// The sketch can over-count under collisions but never under-counts
+	ASSERT_GE(sketch.estimate("a"_sr), 10);
+	sketch.clear();
+	ASSERT_EQ(sketch.estimate("a"_sr), 0);
+
+	TopKKeys topKeys(2);
+	ASSERT_EQ(topKeys.getHotKeys(1.0).size(), 0);
+	topKeys.update("a"_sr, 1, 0);
+	topKeys.update("b"_sr, 0, 2);
+	topKeys.update("c"_sr, 3, 0);
+	{
+		auto hotKeys = topKeys.getHotKeys(1.0);
+		ASSERT_EQ(hotKeys.size(), 2);
+		ASSERT_EQ(std::count_if(hotKeys.begin(), hotKeys.end(), [](auto const& hk) { return hk.key == "a"_sr; }), 0);
+		ASSERT_EQ(std::count_if(hotKeys.begin(), hotKeys.end(), [](auto const& hk) { return hk.key == "b"_sr; }), 1);
+		ASSERT_EQ(std::count_if(hotKeys.begin(), hotKeys.end(), [](auto const& hk) { return hk.key == "c"_sr; }), 1);
+	}
+	topKeys.update("a"_sr, 1, 4);
+	{
+		auto hotKeys = topKeys.getHotKeys(1.0);
+		ASSERT_EQ(hotKeys.size(), 2);
+		ASSERT_EQ(std::count_if(hotKeys.begin(), hotKeys.end(), [](auto const& hk) { return hk.key == "a"_sr; }), 1);
+		ASSERT_EQ(std::count_if(hotKeys.begin(), hotKeys.end(), [](auto const& hk) { return hk.key == "b"_sr; }), 0);
+		ASSERT_EQ(std::count_if(hotKeys.begin(), hotKeys.end(), [](auto const& hk) { return hk.key == "c"_sr; }), 1);
+	}
+	topKeys.clear();
+	ASSERT_EQ(topKeys.getHotKeys(1.0).size(), 0);
+	return Void();
+}
@@ -74,6 +74,9 @@ VFSAsyncFile::VFSAsyncFile(std::string const& filename, int flags)
 
 std::map<std::string, std::pair<uint32_t, int>> VFSAsyncFile::filename_lockCount_openCount;
 
+bool VFSAsyncFile::inlineReadActive = false;
+bool VFSAsyncFile::inlineReadMissed = false;
+
 static int asyncClose(sqlite3_file* pFile) {
 	VFSAsyncFile* p = (VFSAsyncFile*)pFile;
 
@@ -91,7 +94,14 @@ static int asyncRead(sqlite3_file* pFile, void* zBuf, int iAmt, sqlite_int64 iOf
 	VFSAsyncFile* p = (VFSAsyncFile*)pFile;
 	try {
 		++p->debug_reads;
-		int readBytes = waitForAndGet(p->file->read(zBuf, iAmt, iOfst));
+		Future<int> readFuture = p->file->read(zBuf, iAmt, iOfst);
+		if (VFSAsyncFile::inlineReadActive && !readFuture.isReady()) {
+			// The read was started above, so the data will likely be cached by the time the
+			// caller retries this operation on a reader thread.
+			VFSAsyncFile::inlineReadMissed = true;
+			return SQLITE_IOERR_READ;
+		}
+		int readBytes = waitForAndGet(readFuture);
 		if (readBytes < iAmt) {
 			memset((uint8_t*)zBuf + readBytes, 0, iAmt - readBytes); // When reading past the EOF, sqlite expects the
 			                                                         // extra portion of the buffer to be zeroed
@@ -128,6 +138,12 @@ static int asyncReadZeroCopy(sqlite3_file* pFile, void** data, int iAmt, sqlite_
 		Future<Void> readFuture = p->file->readZeroCopy(data, &readBytes, iOfst);
 		if (pDataWasCached)
 			*pDataWasCached = readFuture.isReady() ? 1 : 0;
+		if (VFSAsyncFile::inlineReadActive && !readFuture.isReady()) {
+			// This read is being abandoned, so return the page reference taken by readZeroCopy().
+			VFSAsyncFile::inlineReadMissed = true;
+			p->file->releaseZeroCopy(*data, iAmt, iOfst);
+			return SQLITE_IOERR_READ;
+		}
 		waitFor(readFuture);
 		++p->debug_zcrefs;
 		if (readBytes < iAmt) {
@@ -38,14 +38,20 @@
 #include "flow/genericactors.actor.h"
 #include "flow/UnitTest.h"
 #include "flow/IAsyncFile.h"
+#include "flow/IThreadPool.h"
 #include "flow/ActorCollection.h"
+#include <deque>
 #include <map>
 #include <string>
 #include <unordered_map>
 #include <vector>
 #include "fdbclient/CommitTransaction.h"
 #include "fdbserver/IKeyValueStore.h"
+#include "fdbserver/RedwoodCheckpointUtils.actor.h"
+#include "fdbserver/CoroFlow.h"
 #include "fdbserver/DeltaTree.h"
+#include "fdbserver/PriorityMultiLock.actor.h"
+#include "flow/CompressionUtils.h"
 #include <string.h>
 #include <cinttypes>
 #include <boost/intrusive/list.hpp>
@@ -84,6 +90,11 @@ static FILE* g_debugStream = stdout;
 #define debug_printf printf
 #endif
 
+// Page format value used on container pages whose payload is a compressed image of a logically
+// larger multi-block BTree node.  Written by VersionedBTree::tryCompressPage() and expanded on
+// cache fill by DWALPager::expandCompressedPage().
+static constexpr uint8_t PAGE_FORMAT_COMPRESSED_NODE_IMAGE = 1;
+
 #define BEACON debug_printf_always("HERE\n")
 #define TRACE                                                                                                          \
 	debug_printf_always("%s: %s line %d %s\n", __FUNCTION__, __FILE__, __LINE__, platform::get_backtrace().c_str());
@@ -102,201 +113,6 @@ std::string addPrefix(std::string prefix, std::string lines) {
 	return s;
 }
 
-#define PRIORITYMULTILOCK_DEBUG 0
-
-// A multi user lock with a concurrent holder limit where waiters are granted the lock according to
-// an integer priority from 0 to maxPriority, inclusive, where higher integers are given priority.
-//
-// The interface is similar to FlowMutex except that lock holders can drop the lock to release it.
-//
-// Usage:
-//   Lock lock = wait(prioritylock.lock(priorityLevel));
-//   lock.release();  // Explicit release, or
-//   // let lock and all copies of lock go out of scope to release
-class PriorityMultiLock {
-
-public:
-	// Waiting on the lock returns a Lock, which is really just a Promise<Void>
-	// Calling release() is not necessary, it exists in case the Lock holder wants to explicitly release
-	// the Lock before it goes out of scope.
-	struct Lock {
-		void release() { promise.send(Void()); }
-
-		// This is exposed in case the caller wants to use/copy it directly
-		Promise<Void> promise;
-	};
-
-private:
-	struct Waiter {
-		Waiter() : queuedTime(now()) {}
-		Promise<Lock> lockPromise;
-		double queuedTime;
-	};
-
-	typedef Deque<Waiter> Queue;
-
-#if PRIORITYMULTILOCK_DEBUG
-#define prioritylock_printf(...) printf(__VA_ARGS__)
-#else
-#define prioritylock_printf(...)
-#endif
-
-public:
-	PriorityMultiLock(int concurrency, int maxPriority, int launchLimit = std::numeric_limits<int>::max())
-	  : concurrency(concurrency), available(concurrency), waiting(0), launchLimit(launchLimit) {
-		waiters.resize(maxPriority + 1);
-		fRunner = runner(this);
-	}
-
-	~PriorityMultiLock() { prioritylock_printf("destruct"); }
-
-	Future<Lock> lock(int priority = 0) {
-		prioritylock_printf("lock begin %s\n", toString().c_str());
-
-		// This shortcut may enable a waiter to jump the line when the releaser loop yields
-		if (available > 0) {
-			--available;
-			Lock p;
-			addRunner(p);
-			prioritylock_printf("lock exit immediate %s\n", toString().c_str());
-			return p;
-		}
-
-		Waiter w;
-		waiters[priority].push_back(w);
-		++waiting;
-		prioritylock_printf("lock exit queued %s\n", toString().c_str());
-		return w.lockPromise.getFuture();
-	}
-
-	std::string toString() const {
-		int runnersDone = 0;
-		for (int i = 0; i < runners.size(); ++i) {
-			if (runners[i].isReady()) {
-				++runnersDone;
-			}
-		}
-
-		std::string s =
-		    format("{ ptr=%p concurrency=%d available=%d running=%d waiting=%d runnersQueue=%d runnersDone=%d ",
-		           this,
-		           concurrency,
-		           available,
-		           concurrency - available,
-		           waiting,
-		           runners.size(),
-		           runnersDone);
-
-		for (int i = 0; i < waiters.size(); ++i) {
-			s += format("p%d_waiters=%u ", i, waiters[i].size());
-		}
-
-		s += "}";
-		return s;
-	}
-
-private:
-	void addRunner(Lock& lock) {
-		runners.push_back(map(ready(lock.promise.getFuture()), [=](Void) {
-			prioritylock_printf("Lock released\n");
-			++available;
-			if (waiting > 0 || runners.size() > 100) {
-				release.trigger();
-			}
-			return Void();
-		}));
-	}
-
-	ACTOR static Future<Void> runner(PriorityMultiLock* self) {
-		state int sinceYield = 0;
-		state Future<Void> error = self->brokenOnDestruct.getFuture();
-		state int maxPriority = self->waiters.size() - 1;
-
-		// Priority to try to run tasks from next
-		state int priority = maxPriority;
-		state Queue* pQueue = &self->waiters[maxPriority];
-
-		// Track the number of waiters unlocked at the same priority in a row
-		state int lastPriorityCount = 0;
-
-		loop {
-			// Cleanup finished runner futures at the front of the runner queue.
-			while (!self->runners.empty() && self->runners.front().isReady()) {
-				self->runners.pop_front();
-			}
-
-			// Wait for a runner to release its lock
-			wait(self->release.onTrigger());
-			prioritylock_printf("runner wakeup %s\n", self->toString().c_str());
-
-			if (++sinceYield == 1000) {
-				sinceYield = 0;
-				wait(delay(0));
-			}
-
-			// While there are available slots and there are waiters, launch tasks
-			while (self->available > 0 && self->waiting > 0) {
-				prioritylock_printf("Checking priority=%d lastPriorityCount=%d %s\n",
-				                    priority,
-				                    lastPriorityCount,
-				                    self->toString().c_str());
-
-				while (!pQueue->empty() && ++lastPriorityCount < self->launchLimit) {
-					Waiter w = pQueue->front();
-					pQueue->pop_front();
-					--self->waiting;
-					Lock lock;
-					prioritylock_printf("  Running waiter priority=%d wait=%f %s\n",
-					                    priority,
-					                    now() - w.queuedTime,
-					                    self->toString().c_str());
-					w.lockPromise.send(lock);
-
-					// Self may have been destructed during the lock callback
-					if (error.isReady()) {
-						throw error.getError();
-					}
-
-					// If the lock was not already released, add it to the runners future queue
-					if (lock.promise.canBeSet()) {
-						self->addRunner(lock);
-
-						// A slot has been consumed, so stop reading from this queue if there aren't any more
-						if (--self->available == 0) {
-							break;
-						}
-					}
-				}
-
-				// If there are no more slots available, then don't move to the next priority
-				if (self->available == 0) {
-					break;
-				}
-
-				// Decrease priority, wrapping around to max from 0
-				if (priority == 0) {
-					priority = maxPriority;
-				} else {
-					--priority;
-				}
-
-				pQueue = &self->waiters[priority];
-				lastPriorityCount = 0;
-			}
-		}
-	}
-
-	int concurrency;
-	int available;
-	int waiting;
-	int launchLimit;
-	std::vector<Queue> waiters;
-	Deque<Future<Void>> runners;
-	Future<Void> fRunner;
-	AsyncTrigger release;
-	Promise<Void> brokenOnDestruct;
-};
-
 // Some convenience functions for debugging to stringify various structures
 // Classes can add compatibility by either specializing toString<T> or implementing
 //   std::string toString() const;
@@ -1808,6 +1624,10 @@ ACTOR Future<Void> redwoodMetricsLogger() {
 //   Future<Void> onEvictable() const;  // ready when entry can be evicted
 template <class IndexType, class ObjectType>
 class ObjectCache : NonCopyable {
+public:
+	class Evictor;
+
+private:
 	struct Entry;
 	typedef std::unordered_map<IndexType, Entry> CacheT;
 
@@ -1819,6 +1639,9 @@ class ObjectCache : NonCopyable {
 		int size;
 		bool ownedByEvictor;
 		CacheT* pCache;
+		// The evictor whose quota and eviction order this entry's size is counted against,
+		// which is not necessarily the cache's default evictor
+		Evictor* pEntryEvictor;
 	};
 
 	typedef boost::intrusive::list<Entry> EvictionOrderT;
@@ -1987,9 +1810,11 @@ public:
 	}
 
 	// If index is in cache and not on the prioritized eviction order list, move it there.
+	// Entries owned by a non-default evictor are skipped because flushPrioritizedEvictions()
+	// returns the prioritized entries to the default evictor's order.
 	void prioritizeEviction(const IndexType& index) {
 		auto i = cache.find(index);
-		if (i != cache.end() && i->second.ownedByEvictor) {
+		if (i != cache.end() && i->second.ownedByEvictor && i->second.pEntryEvictor == pEvictor) {
 			pEvictor->moveOut(i->second, prioritizedEvictions);
 		}
 	}
@@ -1998,7 +1823,9 @@ public:
 	// After a get(), the object for i is the last in evictionOrder.
 	// If noHit is set, do not consider this access to be cache hit if the object is present
 	// If noMiss is set, do not consider this access to be a cache miss if the object is not present
-	ObjectType& get(const IndexType& index, int size, bool noHit = false) {
+	// If evictor is set, a newly created entry is counted against that evictor instead of the
+	// cache's default evictor, while an existing entry stays with the evictor that owns it
+	ObjectType& get(const IndexType& index, int size, bool noHit = false, Evictor* evictor = nullptr) {
 		Entry& entry = cache[index];
 
 		// If entry is linked into an evictionOrder
@@ -2008,7 +1835,7 @@ public:
 				++entry.hits;
 				// If item eviction is not prioritized, move to end of eviction order
 				if (entry.ownedByEvictor) {
-					pEvictor->moveToBack(entry);
+					entry.pEntryEvictor->moveToBack(entry);
 				}
 			}
 		} else {
@@ -2017,11 +1844,12 @@ public:
 			// Finish initializing entry
 			entry.index = index;
 			entry.pCache = &cache;
+			entry.pEntryEvictor = (evictor != nullptr) ? evictor : pEvictor;
 			entry.hits = 0;
 			entry.size = size;
 
-			pEvictor->trim(entry.size);
-			pEvictor->addNew(entry);
+			entry.pEntryEvictor->trim(entry.size);
+			entry.pEntryEvictor->addNew(entry);
 		}
 
 		return entry.item;
@@ -2029,9 +1857,9 @@ public:
 
 	// Clears the cache, saving the entries to second cache, then waits for each item to be evictable and evicts it.
 	ACTOR static Future<Void> clear_impl(ObjectCache* self) {
-		// Claim ownership of all of our cached items, removing them from the evictor's control and quota.
+		// Claim ownership of all of our cached items, removing them from their evictor's control and quota.
 		for (auto& ie : self->cache) {
-			self->pEvictor->reclaim(ie.second);
+			ie.second.pEntryEvictor->reclaim(ie.second);
 		}
 
 		// All items are in the cache so we don't need the prioritized eviction order anymore, and the cache is about
@@ -2206,10 +2034,31 @@ public:
 		// This sets the page cache size for all PageCacheT instances using the same evictor
 		pageCache.evictor().sizeLimit = pageCacheBytes;
 
+		// Reserve a fraction of the cache, with its own eviction order, for leaf pages loaded by
+		// range reads so that large scans can only evict other scan-loaded pages and not the
+		// point read working set
+		if (SERVER_KNOBS->REDWOOD_SCAN_CACHE_FRACTION > 0) {
+			scanCacheEvictor.sizeLimit = (int64_t)(pageCacheBytes * SERVER_KNOBS->REDWOOD_SCAN_CACHE_FRACTION);
+			pageCache.evictor().sizeLimit = pageCacheBytes - scanCacheEvictor.sizeLimit;
+		}
+
 		if (!g_redwoodMetricsActor.isValid()) {
 			g_redwoodMetricsActor = redwoodMetricsLogger();
 		}
 
+		if (SERVER_KNOBS->REDWOOD_PAGE_ENCODE_THREADS > 0) {
+			// In simulation, run page encoding as Coro threads on the network thread so that determinism
+			// is preserved, following the same pattern as the other storage engine thread pools.
+			if (g_network->isSimulated()) {
+				encodeThreadPool = CoroThreadPool::createThreadPool();
+			} else {
+				encodeThreadPool = createGenericThreadPool();
+			}
+			for (int i = 0; i < SERVER_KNOBS->REDWOOD_PAGE_ENCODE_THREADS; ++i) {
+				encodeThreadPool->addThread(new PageEncodeWorker(), "fdb-rwd-encode");
+			}
+		}
+
 		commitFuture = Void();
 		recoverFuture = forwardError(recover(this), errorPromise);
 	}
@@ -2712,6 +2561,69 @@ public:
 		return Void();
 	}
 
+	// Runs ArenaPage::preWrite() (checksum generation and optional encryption) off the main thread.
+	// The work is pure CPU so there is no per-thread state to initialize.
+	struct PageEncodeWorker : IThreadPoolReceiver {
+		void init() override {}
+
+		struct EncodePageAction final : TypedAction<PageEncodeWorker, EncodePageAction>,
+		                                FastAllocated<EncodePageAction> {
+			// Raw pointer because the page refcount is not atomic, so it must only be modified on
+			// the main thread.  The actor that posts this action holds a Reference to the page
+			// until the action has completed.
+			ArenaPage* page;
+			PhysicalPageID pageID;
+			ThreadReturnPromise<Void> done;
+			EncodePageAction(ArenaPage* page, PhysicalPageID pageID) : page(page), pageID(pageID) {}
+			double getTimeEstimate() const override { return .0001; }
+		};
+		void action(EncodePageAction& a) {
+			try {
+				a.page->preWrite(a.pageID);
+				a.done.send(Void());
+			} catch (Error& e) {
+				a.done.sendError(e);
+			}
+		}
+	};
+
+	// Issue the write(s) of an already-encoded page to each of its physical block locations
+	Future<Void> writePhysicalBlocks(PagerEventReasons reason,
+	                                 unsigned int level,
+	                                 Standalone<VectorRef<PhysicalPageID>> pageIDs,
+	                                 Reference<ArenaPage> page,
+	                                 bool header) {
+		int blockSize = header ? smallestPhysicalBlock : physicalPageSize;
+		if (pageIDs.size() == 1) {
+			return writePhysicalBlock(this, page, 0, blockSize, pageIDs.front(), reason, level, header);
+		}
+		std::vector<Future<Void>> writers;
+		for (int i = 0; i < pageIDs.size(); ++i) {
+			Future<Void> p = writePhysicalBlock(this, page, i, blockSize, pageIDs[i], reason, level, header);
+			writers.push_back(p);
+		}
+		return waitForAll(writers);
+	}
+
+	// Encode the page on the encode thread pool, then issue its block writes.  The page must not be
+	// modified after this is called, which is already guaranteed because updatePage() treats page
+	// contents as immutable once written and encrypted pages are cloned before encoding.
+	ACTOR static Future<Void> encodeAndWritePhysicalPage(DWALPager* self,
+	                                                     PagerEventReasons reason,
+	                                                     unsigned int level,
+	                                                     Standalone<VectorRef<PhysicalPageID>> pageIDs,
+	                                                     Reference<ArenaPage> page) {
+		state PageEncodeWorker::EncodePageAction* a =
+		    new PageEncodeWorker::EncodePageAction(page.getPtr(), pageIDs.front());
+		state Future<Void> encoded = a->done.getFuture();
+		self->encodeThreadPool->post(a);
+		// The worker encodes through a raw pointer, so the page reference must survive until the
+		// action completes even if this actor is cancelled.
+		wait(uncancellable(holdWhile(page, encoded)));
+		wait(self->writePhysicalBlocks(reason, level, pageIDs, page, false));
+		return Void();
+	}
+
 	Future<Void> writePhysicalPage(PagerEventReasons reason,
 	                               unsigned int level,
 	                               Standalone<VectorRef<PhysicalPageID>> pageIDs,
@@ -2734,19 +2646,14 @@ public:
 			page = page->clone();
 		}
 
-		page->preWrite(pageIDs.front());
-
-		int blockSize = header ? smallestPhysicalBlock : physicalPageSize;
 		Future<Void> f;
-		if (pageIDs.size() == 1) {
-			f = writePhysicalBlock(this, page, 0, blockSize, pageIDs.front(), reason, level, header);
+		if (encodeThreadPool.isValid() && !header) {
+			// Offload checksum generation and encryption so commits aren't serialized behind them on
+			// the main thread.  Header writes stay synchronous as they are rare and order-sensitive.
+			f = encodeAndWritePhysicalPage(this, reason, level, pageIDs, page);
 		} else {
-			std::vector<Future<Void>> writers;
-			for (int i = 0; i < pageIDs.size(); ++i) {
-				Future<Void> p = writePhysicalBlock(this, page, i, blockSize, pageIDs[i], reason, level, header);
-				writers.push_back(p);
-			}
-			f = waitForAll(writers);
+			page->preWrite(pageIDs.front());
+			f = writePhysicalBlocks(reason, level, pageIDs, page, header);
 		}
 
 		operations.push_back(f);
@@ -2801,7 +2708,12 @@ public:
 		}
 
 		// Always update the page contents immediately regardless of what happened above.
-		cacheEntry.readFuture = data;
+		// Compressed node images are cached in their expanded form, just as a read would produce.
+		if (data->getPageFormat() == PAGE_FORMAT_COMPRESSED_NODE_IMAGE) {
+			cacheEntry.readFuture = expandCompressedPage(data);
+		} else {
+			cacheEntry.readFuture = data;
+		}
 	}
 
 	Future<LogicalPageID> atomicUpdatePage(PagerEventReasons reason,
@@ -2946,6 +2858,33 @@ public:
 		return bytes;
 	}
 
+	// Expand a compressed node image container page (see VersionedBTree::tryCompressPage) back into
+	// the original, logically larger page.  The inner image carries its own headers and checksums,
+	// computed before compression with invalidPhysicalPageID as the write seed, so it is verified
+	// like any other page after decompression.
+	Reference<ArenaPage> expandCompressedPage(Reference<ArenaPage> container) {
+#ifdef ZLIB_LIB_SUPPORTED
+		uint32_t sizes[2];
+		memcpy(sizes, container->data(), sizeof(sizes));
+		ASSERT(sizes[0] % logicalPageSize == 0);
+		ASSERT(sizes[1] <= container->dataSize() - sizeof(sizes));
+
+		Arena scratch;
+		StringRef image = CompressionUtils::decompress(
+		    CompressionFilter::GZIP, StringRef(container->data() + sizeof(sizes), sizes[1]), scratch);
+		ASSERT(image.size() == sizes[0]);
+
+		Reference<ArenaPage> page = newPageBuffer(sizes[0] / logicalPageSize);
+		memcpy(page->rawData(), image.begin(), image.size());
+		page->postReadHeader(invalidPhysicalPageID);
+		page->postReadPayload(invalidPhysicalPageID);
+		return page;
+#else
+		// The file contains compressed pages but this build cannot expand them
+		throw page_encoding_not_supported();
+#endif
+	}
+
 	// Read a physical page from the page file.  Note that header pages use a page size of smallestPhysicalBlock
 	// If the user chosen physical page size is larger, then there will be a gap of unused space after the header pages
 	// and before the user-chosen sized pages.
@@ -2981,6 +2920,9 @@ public:
 				page->encryptionKey = k;
 			}
 			page->postReadPayload(pageID);
+			if (!header && page->getPageFormat() == PAGE_FORMAT_COMPRESSED_NODE_IMAGE) {
+				page = self->expandCompressedPage(page);
+			}
 			debug_printf("DWALPager(%s) op=readPhysicalVerified %s ptr=%p\n",
 			             self->filename.c_str(),
 			             toString(pageID).c_str(),
@@ -3049,6 +2991,9 @@ public:
 				page->encryptionKey = k;
 			}
 			page->postReadPayload(pageIDs.front());
+			if (page->getPageFormat() == PAGE_FORMAT_COMPRESSED_NODE_IMAGE) {
+				page = self->expandCompressedPage(page);
+			}
 			debug_printf("DWALPager(%s) op=readPhysicalVerified %s ptr=%p bytes=%d\n",
 			             self->filename.c_str(),
 			             toString(pageIDs).c_str(),
@@ -3078,6 +3023,15 @@ public:
 		return readPhysicalPage(this, pageID, ioMaxPriority, true);
 	}
 
+	// Returns the eviction domain for a cacheable read:  the scan cache for leaf pages read for
+	// range reads when the scan cache is enabled, otherwise the default domain.
+	PageCacheT::Evictor* readEvictor(PagerEventReasons reason, unsigned int level) {
+		if (scanCacheEvictor.sizeLimit > 0 && reason == PagerEventReasons::RangeRead && level == 1) {
+			return &scanCacheEvictor;
+		}
+		return nullptr;
+	}
+
 	// Reads the most recent version of pageID, either previously committed or written using updatePage()
 	// in the current commit
 	Future<Reference<ArenaPage>> readPage(PagerEventReasons reason,
@@ -3107,7 +3061,7 @@ public:
 			debug_printf("DWALPager(%s) op=readUncachedMiss %s\n", filename.c_str(), toString(pageID).c_str());
 			return forwardError(readPhysicalPage(this, pageID, priority, false), errorPromise);
 		}
-		PageCacheEntry& cacheEntry = pageCache.get(pageID, physicalPageSize, noHit);
+		PageCacheEntry& cacheEntry = pageCache.get(pageID, physicalPageSize, noHit, readEvictor(reason, level));
 		debug_printf("DWALPager(%s) op=read %s cached=%d reading=%d writing=%d noHit=%d\n",
 		             filename.c_str(),
 		             toString(pageID).c_str(),
@@ -3157,7 +3111,8 @@ public:
 			return forwardError(readPhysicalMultiPage(this, pageIDs, priority), errorPromise);
 		}
 
-		PageCacheEntry& cacheEntry = pageCache.get(pageIDs.front(), pageIDs.size() * physicalPageSize, noHit);
+		PageCacheEntry& cacheEntry =
+		    pageCache.get(pageIDs.front(), pageIDs.size() * physicalPageSize, noHit, readEvictor(reason, level));
 		debug_printf("DWALPager(%s) op=read %s cached=%d reading=%d writing=%d noHit=%d\n",
 		             filename.c_str(),
 		             toString(pageIDs).c_str(),
@@ -3767,6 +3722,11 @@ public:
 		wait(waitForAllReady(self->operations));
 		self->operations.clear();
 
+		if (self->encodeThreadPool.isValid()) {
+			debug_printf("DWALPager(%s) shutdown stop encode threads\n", self->filename.c_str());
+			wait(self->encodeThreadPool->stop());
+		}
+
 		debug_printf("DWALPager(%s) shutdown destroy page cache\n", self->filename.c_str());
 		wait(self->extentCache.clear());
 		wait(self->pageCache.clear());
@@ -3992,6 +3952,10 @@ private:
 	PageCacheT::Evictor extentCacheDummyEvictor{ std::numeric_limits<int64_t>::max() };
 	PageCacheT extentCache{ &extentCacheDummyEvictor };
 
+	// Eviction domain with its own quota for leaf pages loaded by range reads, unused unless
+	// REDWOOD_SCAN_CACHE_FRACTION is > 0.  See readEvictor().
+	PageCacheT::Evictor scanCacheEvictor{ 0 };
+
 	Promise<Void> closedPromise;
 	Promise<Void> errorPromise;
 	Future<Void> commitFuture;
@@ -4000,6 +3964,10 @@ private:
 	Future<Void> remapCleanupFuture;
 	bool remapCleanupStop;
 
+	// Thread pool for offloading page checksum generation and encryption, unset if
+	// REDWOOD_PAGE_ENCODE_THREADS is 0
+	Reference<IThreadPool> encodeThreadPool;
+
 	Reference<IAsyncFile> pageFile;
 
 	LogicalPageQueueT freeList;
@@ -5026,6 +4994,20 @@ public:
 		m_pBuffer->erase(iBegin, iEnd);
 	}
 
+	// Flag a key range for defragmentation.  The next commit will visit the leaves in the range and
+	// rebuild them even if they contain no pending mutations, merging runs of under-filled siblings
+	// into fewer pages where possible and returning the freed blocks to the pager.  The flags are
+	// only hints so they carry no durability; if the next commit turns out to be a no-op they are
+	// silently dropped.
+	void defragRange(KeyRangeRef range) {
+		MutationBuffer::iterator iBegin = m_pBuffer->insert(range.begin);
+		MutationBuffer::iterator iEnd = m_pBuffer->insert(range.end);
+		while (iBegin != iEnd) {
+			iBegin.mutation().forceRebuild = true;
+			++iBegin;
+		}
+	}
+
 	void setOldestReadableVersion(Version v) { m_newOldestVersion = v; }
 
 	Version getOldestReadableVersion() const { return m_pager->getOldestReadableVersion(); }
@@ -5090,6 +5072,7 @@ public:
 
 		loop {
 			state int toPop = SERVER_KNOBS->REDWOOD_LAZY_CLEAR_BATCH_SIZE_PAGES;
+			state int freedPagesBefore = freedPages;
 			state std::vector<std::pair<LazyClearQueueEntry, Future<Reference<const ArenaPage>>>> entries;
 			entries.reserve(toPop);
 
@@ -5173,6 +5156,18 @@ public:
 			    (freedPages >= SERVER_KNOBS->REDWOOD_LAZY_CLEAR_MAX_PAGES)) {
 				break;
 			}
+
+			// Pace the background free rate so that clearing a very large subtree does not saturate
+			// the pager with queue and free list IO between commits.  The pause is taken in small
+			// slices so a stop request from a commit is still honored promptly.
+			if (SERVER_KNOBS->REDWOOD_LAZY_CLEAR_MAX_PAGES_PER_SECOND > 0) {
+				state double pauseEnd =
+				    now() + (double)(freedPages - freedPagesBefore) /
+				                SERVER_KNOBS->REDWOOD_LAZY_CLEAR_MAX_PAGES_PER_SECOND;
+				while (now() < pauseEnd && !self->m_lazyClearStop) {
+					wait(delay(std::min(0.1, pauseEnd - now())));
+				}
+			}
 		}
 
 		debug_printf("LazyClear: freed %d pages, %s has %" PRId64 " entries\n",
@@ -5353,11 +5348,15 @@ private:
 	};
 
 	struct RangeMutation {
-		RangeMutation() : boundaryChanged(false), clearAfterBoundary(false) {}
+		RangeMutation() : boundaryChanged(false), clearAfterBoundary(false), forceRebuild(false) {}
 
 		bool boundaryChanged;
 		Optional<ValueRef> boundaryValue; // Not present means cleared
 		bool clearAfterBoundary;
+		// Rebuild the leaf pages covered by the range after the boundary during the next commit even if
+		// nothing in them changed, repacking their records at normal target fill.  Set by the background
+		// defragmentation scan.
+		bool forceRebuild;
 
 		bool boundaryCleared() const { return boundaryChanged && !boundaryValue.present(); }
 		bool boundarySet() const { return boundaryChanged && boundaryValue.present(); }
@@ -5381,9 +5380,10 @@ private:
 		}
 
 		std::string toString() const {
-			return format("boundaryChanged=%d clearAfterBoundary=%d boundaryValue=%s",
+			return format("boundaryChanged=%d clearAfterBoundary=%d forceRebuild=%d boundaryValue=%s",
 			              boundaryChanged,
 			              clearAfterBoundary,
+			              forceRebuild,
 			              ::toString(boundaryValue).c_str());
 		}
 	};
@@ -5467,6 +5467,10 @@ public:
 			if (iPrevious.mutation().clearAfterBoundary) {
 				ib.mutation().clearAll();
 			}
+			// The range after the dividing boundary inherits any pending rebuild request
+			if (iPrevious.mutation().forceRebuild) {
+				ib.mutation().forceRebuild = true;
+			}
 
 			return ib;
 		}
@@ -5562,6 +5566,13 @@ private:
 	Future<int> m_lazyClearActor;
 	bool m_lazyClearStop;
 
+	// Bulk load state.  The most recent batch is held in m_bulkLoadPending until the next batch
+	// provides the upper boundary for its leaves, and links to all leaf pages built so far are
+	// accumulated in m_bulkLoadLeafLinks until bulkLoadFinish() builds the levels above them.
+	bool m_bulkLoading = false;
+	Standalone<VectorRef<RedwoodRecordRef>> m_bulkLoadPending;
+	Standalone<VectorRef<RedwoodRecordRef>> m_bulkLoadLeafLinks;
+
 	// Describes a range of a vector of records that should be built into a single BTreePage
 	struct PageToBuild {
 		PageToBuild(int index, int blockSize, EncodingType t)
@@ -5754,6 +5765,48 @@ private:
 		return pages;
 	}
 
+	// Try to compress the logical image of a freshly built multi-block node into a container page
+	// occupying fewer pager blocks.  The container's payload is the image's logical and compressed
+	// sizes followed by the compressed bytes, and is flagged via the main header's pageFormat so
+	// the pager read path knows to expand it on cache fill.  The inner image is finalized with
+	// invalidPhysicalPageID as its write seed since its real physical location is the container's.
+	// Returns an invalid reference if compression is unavailable or would not save any blocks.
+	Reference<ArenaPage> tryCompressPage(Reference<ArenaPage> page, int blockCount, unsigned int height, Version v) {
+#ifdef ZLIB_LIB_SUPPORTED
+		page->setWriteInfo(invalidPhysicalPageID, v);
+		page->preWrite(invalidPhysicalPageID);
+		int logicalImageSize = page->dataSize() + (page->data() - page->rawData());
+
+		Arena scratch;
+		StringRef compressed =
+		    CompressionUtils::compress(CompressionFilter::GZIP, StringRef(page->rawData(), logicalImageSize), scratch);
+
+		// Find the smallest block count whose payload can hold the size prefixes and compressed bytes
+		int logicalBlockSize = m_pager->getLogicalPageSize();
+		int headerOverhead = logicalBlockSize - ArenaPage::getUsableSize(logicalBlockSize, m_encodingType);
+		int containerBlocks =
+		    (2 * (int)sizeof(uint32_t) + compressed.size() + headerOverhead + logicalBlockSize - 1) / logicalBlockSize;
+		if (containerBlocks >= blockCount) {
+			return Reference<ArenaPage>();
+		}
+
+		Reference<ArenaPage> container = m_pager->newPageBuffer(containerBlocks);
+		container->init(m_encodingType,
+		                (containerBlocks == 1) ? PageType::BTreeNode : PageType::BTreeSuperNode,
+		                height,
+		                PAGE_FORMAT_COMPRESSED_NODE_IMAGE);
+		uint8_t* out = container->mutateData();
+		uint32_t sizes[2] = { (uint32_t)logicalImageSize, (uint32_t)compressed.size() };
+		memcpy(out, sizes, sizeof(sizes));
+		memcpy(out + sizeof(sizes), compressed.begin(), compressed.size());
+		// preWrite() requires the entire payload to be defined
+		memset(out + sizeof(sizes) + compressed.size(), 0, container->dataSize() - sizeof(sizes) - compressed.size());
+		return container;
+#else
+		return Reference<ArenaPage>();
+#endif
+	}
+
 	// Writes entries to 1 or more pages and return a vector of boundary keys with their ArenaPage(s)
 	ACTOR static Future<Standalone<VectorRef<RedwoodRecordRef>>> writePages(VersionedBTree* self,
 	                                                                        const RedwoodRecordRef* lowerBound,
@@ -5906,12 +5959,28 @@ private:
 				// would likely convert the changes to a parent update anyways, skipping the second writes
 				// on this multi-block node.  It is more efficient to just take this path directly.
 
+				// If enabled, try to compress the node image into fewer blocks.  This is only
+				// attempted here because it must happen before the node's page IDs are allocated,
+				// and single-block nodes cannot occupy any less space on disk.
+				state int blockCount = p.blockCount;
+				if (SERVER_KNOBS->REDWOOD_PAGE_COMPRESSION_ENABLED && p.blockCount > 1 && !page->isEncrypted()) {
+					Reference<ArenaPage> compressed = self->tryCompressPage(page, p.blockCount, height, v);
+					if (compressed.isValid()) {
+						blockCount = compressed->rawSize() / self->m_pager->getPhysicalPageSize();
+						CODE_PROBE(true, "Redwood multi-block node stored compressed");
+						debug_printf("writePages: compressed %d block node image to %d blocks\n",
+						             p.blockCount,
+						             blockCount);
+						page = compressed;
+					}
+				}
+
 				// Free the old IDs, but only once (before the first output record is added).
 				if (records.empty()) {
 					self->freeBTreePage(height, previousID, v);
 				}
 
-				childPageID.resize(records.arena(), p.blockCount);
+				childPageID.resize(records.arena(), blockCount);
 				state int i = 0;
 				for (i = 0; i < childPageID.size(); ++i) {
 					LogicalPageID id = wait(self->m_pager->newPageID());
@@ -6472,6 +6541,57 @@ private:
 		}
 	};
 
+	// Merge a run of consecutive leaf children, covered by a defragmentation range with no pending
+	// mutations, into replacement pages built at normal target fill, freeing the originals.  The
+	// children are described by the parent page records in the cursor range of update, which the
+	// caller must keep valid until this actor completes.
+	ACTOR static Future<Void> mergeLeafRun(VersionedBTree* self,
+	                                       CommitBatch* batch,
+	                                       LogicalPageID parentID,
+	                                       InternalPageSliceUpdate* update) {
+		state Standalone<VectorRef<RedwoodRecordRef>> merged;
+		// The records in merged reference memory owned by the child pages and their decode caches,
+		// so both are retained until the replacement pages have been built.
+		state std::vector<Reference<const ArenaPage>> pages;
+		state std::vector<BTreePage::BinaryTree::Cursor> cursors;
+		state BTreePage::BinaryTree::Cursor c = update->cBegin;
+
+		while (c != update->cEnd) {
+			if (c.get().value.present()) {
+				state BTreeNodeLink childID = BTreeNodeLink(c.get().getChildPage());
+				Reference<const ArenaPage> page = wait(readPage(
+				    self, PagerEventReasons::Commit, 1, batch->snapshot.getPtr(), childID, ioLeafPriority, false, true));
+				pages.push_back(page);
+				cursors.push_back(self->getCursor(page.getPtr(), c));
+				BTreePage::BinaryTree::Cursor& leafCursor = cursors.back();
+				leafCursor.moveFirst();
+				while (leafCursor.valid()) {
+					merged.push_back(merged.arena(), leafCursor.get());
+					leafCursor.moveNext();
+				}
+				self->freeBTreePage(2, childID, batch->writeVersion);
+			}
+			c.moveNext();
+		}
+
+		if (merged.empty()) {
+			update->cleared();
+			return Void();
+		}
+
+		CODE_PROBE(pages.size() > 1, "Redwood merged a run of under-filled leaf pages");
+		Standalone<VectorRef<RedwoodRecordRef>> entries = wait(writePages(self,
+		                                                                  &update->subtreeLowerBound,
+		                                                                  &update->subtreeUpperBound,
+		                                                                  merged,
+		                                                                  1,
+		                                                                  batch->writeVersion,
+		                                                                  BTreeNodeLinkRef(),
+		                                                                  parentID));
+		update->rebuilt(entries);
+		return Void();
+	}
+
 	ACTOR static Future<Void> commitSubtree(
 	    VersionedBTree* self,
 	    CommitBatch* batch,
@@ -6556,6 +6676,26 @@ private:
 			bool updatingDeltaTree = tryToUpdate;
 			bool changesMade = false;
 
+			// If a mutation range covering this page is flagged for defragmentation, force a linear merge
+			// so the page is rebuilt at normal target fill even if nothing in it changed.  This is the
+			// individual-leaf path used when a flagged range also contains real mutations or does not
+			// cover whole leaves; it reclaims excess blocks held by the page but does not merge siblings.
+			bool forceRebuild = false;
+			{
+				auto m = mBegin;
+				while (1) {
+					if (m.mutation().forceRebuild) {
+						forceRebuild = true;
+						updatingDeltaTree = false;
+						break;
+					}
+					if (m == mEnd) {
+						break;
+					}
+					++m;
+				}
+			}
+
 			// Copy page for modification if not already copied
 			auto copyForUpdate = [&]() {
 				if (!pageCopy.isValid()) {
@@ -6785,8 +6925,8 @@ private:
 			}
 
 			// No changes were actually made.  This could happen if the only mutations are clear ranges which do not
-			// match any records.
-			if (!changesMade) {
+			// match any records.  A page flagged for defragmentation is rebuilt regardless.
+			if (!changesMade && !forceRebuild) {
 				debug_printf("%s No changes were made during mutation merge, returning slice:\n", context.c_str());
 				debug_print(addPrefix(context, update->toString()));
 				return Void();
@@ -6942,8 +7082,18 @@ private:
 						uniform = !range.boundaryChanged || mutationBoundaryKey != u.subtreeLowerBound.key;
 					}
 
-					// If u's subtree is either all cleared or all unchanged
-					if (uniform) {
+					// A range flagged for defragmentation must not be skipped even though it changes nothing by
+					// itself.  If this page's children are leaves and the range is otherwise unchanged then the
+					// run of covered children can be merged directly into fewer, fuller pages.  Otherwise,
+					// recursion continues and each covered leaf is rebuilt individually.
+					bool defragMerge = false;
+					if (range.forceRebuild) {
+						defragMerge = uniform && !range.clearAfterBoundary && height == 2;
+						uniform = false;
+					}
+
+					// If u's subtree is either all cleared or all unchanged, or is a leaf run to be merged
+					if (uniform || defragMerge) {
 						// We do not need to recurse to this subtree.  Next, let's see if we can embiggen u's range to
 						// include sibling subtrees also covered by (mBegin, mEnd) so we can not recurse to those, too.
 						// If the cursor is valid, u.subtreeUpperBound is the cursor's position, which is >= mEnd.key().
@@ -6981,8 +7131,13 @@ private:
 							}
 						}
 
-						// The subtree range is either fully cleared or unchanged.
-						if (range.clearAfterBoundary) {
+						// The subtree range is a leaf run to be merged, fully cleared, or unchanged.
+						if (defragMerge) {
+							debug_printf("%s Merging leaf run for defragmentation:\n", context.c_str());
+							debug_print(addPrefix(context, u.toString()));
+							recursions.push_back(self->mergeLeafRun(self, batch, rootID.front(), &u));
+							continue;
+						} else if (range.clearAfterBoundary) {
 							// Cleared
 							u.cleared();
 							auto c = u.cBegin;
@@ -7665,6 +7820,204 @@ public:
 
 		return cursor->init(this, reason, snapshot, root);
 	}
+
+	// Background defragmentation scan.  Incrementally walks the leaf level of the tree during idle
+	// windows looking for under-filled pages, and flags runs of them for rebuild via defragRange()
+	// so that a later commit repacks them into fewer pages and returns the freed blocks to the
+	// pager.  Scan progress is kept in memory only and restarts from the beginning of the keyspace
+	// after a reboot or when the end of the tree is reached.
+	ACTOR static Future<Void> defragScan_impl(VersionedBTree* self) {
+		state Key progress;
+
+		loop {
+			wait(delay(SERVER_KNOBS->REDWOOD_DEFRAG_INTERVAL));
+
+			// Pace by recent KV operation rate as a proxy for how busy the disk is.  The metrics are
+			// process-wide and are reset by the metrics logger, so compute a rate over the current
+			// metrics window and skip the pass if the window is too young to judge.
+			double elapsed = now() - g_redwoodMetrics.startTime;
+			int64_t opCount = (int64_t)g_redwoodMetrics.metric.opSet + g_redwoodMetrics.metric.opClear +
+			                  g_redwoodMetrics.metric.opGet + g_redwoodMetrics.metric.opGetRange;
+			if (elapsed < 1.0 || opCount / elapsed > SERVER_KNOBS->REDWOOD_DEFRAG_BUSY_OPS_PER_SECOND) {
+				continue;
+			}
+
+			state BTreeCursor cur;
+			wait(self->initBTreeCursor(&cur, self->getLastCommittedVersion(), PagerEventReasons::RangeRead));
+			wait(cur.seekGTE(progress));
+
+			state int leavesScanned = 0;
+			state int rangesFlagged = 0;
+			state int runLeaves = 0;
+			state bool runHasExcessBlocks = false;
+			state Key runBegin;
+
+			while (cur.isValid() && !cur.inRoot() && leavesScanned < SERVER_KNOBS->REDWOOD_DEFRAG_PAGES_PER_PASS) {
+				BTreePage::BinaryTree::Cursor& leafCursor = cur.back().cursor;
+				auto btPage = cur.back().btPage();
+				const ArenaPage* page = cur.back().page.getPtr();
+				bool underFilled =
+				    btPage->kvBytes < SERVER_KNOBS->REDWOOD_DEFRAG_MIN_FILL_RATIO * page->dataSize();
+
+				if (underFilled) {
+					if (runLeaves == 0) {
+						runBegin = Key(leafCursor.cache->lowerBound.key);
+					}
+					++runLeaves;
+					// A usable size larger than one block means the page holds extra blocks which a
+					// rebuild would free even without merging the page with its siblings.
+					if (page->dataSize() > self->m_blockSize) {
+						runHasExcessBlocks = true;
+					}
+				} else if (runLeaves > 0) {
+					// End of an under-filled run.  Flag it if rebuilding can actually free blocks, which
+					// requires either multiple leaves to merge or excess blocks to shed.
+					if (runLeaves >= 2 || runHasExcessBlocks) {
+						self->defragRange(KeyRangeRef(runBegin, leafCursor.cache->lowerBound.key));
+						++rangesFlagged;
+					}
+					runLeaves = 0;
+					runHasExcessBlocks = false;
+				}
+
+				++leavesScanned;
+				progress = Key(leafCursor.cache->upperBound.key);
+				cur.popPath();
+				wait(cur.moveNext());
+			}
+
+			// Flush a trailing run, which ends at the upper boundary of the last leaf scanned
+			if (runLeaves > 0 && (runLeaves >= 2 || runHasExcessBlocks)) {
+				self->defragRange(KeyRangeRef(runBegin, progress));
+				++rangesFlagged;
+			}
+
+			if (rangesFlagged > 0) {
+				CODE_PROBE(true, "Redwood defrag scan flagged under-filled leaf ranges for rebuild");
+				TraceEvent(SevDebug, "RedwoodDefragScan")
+				    .detail("InstanceName", self->m_pager->getName())
+				    .detail("LeavesScanned", leavesScanned)
+				    .detail("RangesFlagged", rangesFlagged)
+				    .detail("Progress", progress);
+			}
+
+			// Wrap around to the beginning of the keyspace when the end of the tree is reached
+			if (!cur.isValid() || cur.inRoot()) {
+				progress = Key();
+			}
+
+			// Release the cursor so its pager snapshot is not pinned across the inter-pass delay
+			cur = BTreeCursor();
+		}
+	}
+
+	Future<Void> defragScan() { return defragScan_impl(this); }
+
+	// Build leaf pages at target fill from the pending bulk load batch and accumulate links to
+	// them.  The upper boundary is the first record of the next batch, or dbEnd for the last batch.
+	ACTOR static Future<Void> bulkLoadBuildPending(VersionedBTree* self, RedwoodRecordRef upperBound) {
+		state RedwoodRecordRef lowerBound =
+		    self->m_bulkLoadLeafLinks.empty() ? dbBegin : self->m_bulkLoadPending.front().withoutValue();
+		Standalone<VectorRef<RedwoodRecordRef>> links = wait(writePages(self,
+		                                                                &lowerBound,
+		                                                                &upperBound,
+		                                                                self->m_bulkLoadPending,
+		                                                                1,
+		                                                                self->getLastCommittedVersion() + 1,
+		                                                                BTreeNodeLinkRef(),
+		                                                                invalidLogicalPageID));
+
+		self->m_bulkLoadLeafLinks.arena().dependsOn(links.arena());
+		self->m_bulkLoadLeafLinks.append(self->m_bulkLoadLeafLinks.arena(), links.begin(), links.size());
+		self->m_bulkLoadPending = Standalone<VectorRef<RedwoodRecordRef>>();
+		return Void();
+	}
+
+	// Add a sorted batch of records to a bulk load of the tree, which must be empty when the first
+	// batch is added.  Leaf pages are built bottom-up at target fill, bypassing the mutation buffer
+	// and the commit path's copy-on-write page updates, so each record is written once instead of
+	// its page being rewritten as successive commits land nearby records.  Batches must be in
+	// ascending key order with every key greater than the last key of the previous batch.  The
+	// loaded records are neither readable nor durable until bulkLoadFinish() and then a commit have
+	// completed, and mutations made before that commit are applied on top of the loaded data.
+	ACTOR static Future<Void> bulkLoadBatch_impl(VersionedBTree* self, Standalone<VectorRef<KeyValueRef>> kvs) {
+		if (kvs.empty()) {
+			return Void();
+		}
+
+		if (!self->m_bulkLoading) {
+			// The first batch may only be loaded into an empty tree
+			ASSERT(self->m_header.height == 1);
+			state Reference<IPagerSnapshot> snapshot =
+			    self->m_pager->getReadSnapshot(self->m_pager->getLastCommittedVersion());
+			Reference<const ArenaPage> rootPage = wait(readPage(self,
+			                                                    PagerEventReasons::Commit,
+			                                                    1,
+			                                                    snapshot.getPtr(),
+			                                                    self->m_header.root,
+			                                                    ioLeafPriority,
+			                                                    false,
+			                                                    true));
+			ASSERT(((const BTreePage*)rootPage->data())->tree()->numItems == 0);
+			self->m_bulkLoading = true;
+		} else {
+			ASSERT(self->m_bulkLoadPending.back().key < kvs.front().key);
+			// Build the previous batch's leaves using this batch's first key as their upper boundary
+			wait(bulkLoadBuildPending(self, RedwoodRecordRef(kvs.front().key)));
+		}
+
+		state Standalone<VectorRef<RedwoodRecordRef>> entries;
+		entries.arena().dependsOn(kvs.arena());
+		for (auto const& kv : kvs) {
+			entries.push_back(entries.arena(), RedwoodRecordRef(kv.key, kv.value));
+		}
+		for (int i = 1; i < entries.size(); ++i) {
+			ASSERT(entries[i - 1].key < entries[i].key);
+		}
+
+		self->m_bulkLoadPending = entries;
+		return Void();
+	}
+
+	// Complete a bulk load by building the remaining leaves and the internal levels above them,
+	// then replacing the empty root with the new subtree's root.  The loaded tree becomes durable,
+	// and readable, at the next commit.
+	ACTOR static Future<Void> bulkLoadFinish_impl(VersionedBTree* self) {
+		ASSERT(self->m_bulkLoading);
+		state Version v = self->getLastCommittedVersion() + 1;
+
+		if (!self->m_bulkLoadPending.empty()) {
+			wait(bulkLoadBuildPending(self, dbEnd));
+		}
+
+		state Standalone<VectorRef<RedwoodRecordRef>> links = self->m_bulkLoadLeafLinks;
+		ASSERT(!links.empty());
+
+		// Free the empty root page being replaced
+		self->freeBTreePage(1, self->m_header.root, v);
+
+		if (links.size() == 1) {
+			self->m_header.height = 1;
+			self->m_header.root = links.front().getChildPage();
+		} else {
+			// buildNewRoot() increments m_header.height for each level it builds above the leaves
+			self->m_header.height = 1;
+			Standalone<VectorRef<RedwoodRecordRef>> rootRecord = wait(buildNewRoot(self, v, links, 1));
+			self->m_header.root = rootRecord.front().getChildPage();
+		}
+		debug_printf("%s: bulk load complete, new root %s height %d\n",
+		             self->m_name.c_str(),
+		             toString(self->m_header.root).c_str(),
+		             self->m_header.height);
+
+		self->m_bulkLoading = false;
+		self->m_bulkLoadLeafLinks = Standalone<VectorRef<RedwoodRecordRef>>();
+		return Void();
+	}
+
+	Future<Void> bulkLoadBatch(Standalone<VectorRef<KeyValueRef>> kvs) { return bulkLoadBatch_impl(this, kvs); }
+
+	Future<Void> bulkLoadFinish() { return bulkLoadFinish_impl(this); }
 };
 
 #include "fdbserver/art_impl.h"
@@ -7725,6 +8078,9 @@ public:
 		    .detail("Filename", self->m_filename)
 		    .detail("Version", self->m_tree->getLastCommittedVersion());
 		self->m_nextCommitVersion = self->m_tree->getLastCommittedVersion() + 1;
+		if (SERVER_KNOBS->REDWOOD_DEFRAG_ENABLED) {
+			self->m_defragScan = self->catchError(self->m_tree->defragScan());
+		}
 		return Void();
 	}
 
@@ -7751,6 +8107,7 @@ public:
 			self->m_error.sendError(actor_cancelled()); // Ideally this should be shutdown_in_progress
 		}
 		self->m_init.cancel();
+		self->m_defragScan.cancel();
 		Future<Void> closedFuture = self->m_tree->onClosed();
 		if (dispose)
 			self->m_tree->dispose();
@@ -7769,9 +8126,27 @@ public:
 	Future<Void> onClosed() const override { return m_closed.getFuture(); }
 
 	Future<Void> commit(bool sequential = false) override {
-		m_lastCommit = catchError(m_tree->commit(m_nextCommitVersion));
-		// Currently not keeping history
-		m_tree->setOldestReadableVersion(m_nextCommitVersion);
+		if (m_checkpointBarrier.isReady()) {
+			m_lastCommit = catchError(m_tree->commit(m_nextCommitVersion));
+		} else {
+			// A physical checkpoint is copying the pager file; hold the commit until the copy
+			// finishes so that the file matches the checkpoint's version exactly.
+			m_lastCommit = catchError(commitAfterCheckpoint(this, m_nextCommitVersion));
+		}
+		if (SERVER_KNOBS->REDWOOD_HISTORY_RETENTION_SECONDS > 0) {
+			// Keep versions committed within the retention window readable.  The oldest readable
+			// version is the newest one committed at or before the start of the window, so it is
+			// only popped once the next version also falls outside of the window.
+			m_commitTimes.push_back({ now(), m_nextCommitVersion });
+			while (m_commitTimes.size() > 1 &&
+			       m_commitTimes[1].first <= now() - SERVER_KNOBS->REDWOOD_HISTORY_RETENTION_SECONDS) {
+				m_commitTimes.pop_front();
+			}
+			m_tree->setOldestReadableVersion(m_commitTimes.front().second);
+		} else {
+			// Not keeping history
+			m_tree->setOldestReadableVersion(m_nextCommitVersion);
+		}
 		++m_nextCommitVersion;
 		return m_lastCommit;
 	}
@@ -7780,6 +8155,90 @@ public:
 
 	StorageBytes getStorageBytes() const override { return m_tree->getStorageBytes(); }
 
+	ACTOR static Future<Void> commitAfterCheckpoint(KeyValueStoreRedwood* self, Version version) {
+		wait(self->m_checkpointBarrier);
+		wait(self->m_tree->commit(version));
+		return Void();
+	}
+
+	Future<CheckpointMetaData> checkpoint(const CheckpointRequest& request) override {
+		return catchError(doCheckpoint(this, request));
+	}
+
+	// Creates a physical checkpoint by copying the pager file into the checkpoint directory.
+	// Commits are held for the duration of the copy, so the copy is byte-for-byte the recovery
+	// image of the last committed version; opening it recovers that version directly.
+	ACTOR static Future<CheckpointMetaData> doCheckpoint(KeyValueStoreRedwood* self, CheckpointRequest request) {
+		if (request.format != RedwoodV1) {
+			throw not_implemented();
+		}
+
+		// Wait for any checkpoint already holding commits, then install our own barrier.
+		wait(self->m_checkpointBarrier);
+		state Promise<Void> barrier;
+		self->m_checkpointBarrier = barrier.getFuture();
+
+		state CheckpointMetaData res;
+		try {
+			// Wait for the outstanding commit to become durable.  With the barrier installed no
+			// further commit will modify the pager file until the copy below completes.
+			wait(self->m_lastCommit);
+			state Version version = self->m_tree->getLastCommittedVersion();
+			state std::string checkpointDir = abspath(request.checkpointDir);
+			state std::string pagerFile = basename(self->m_filename);
+			state std::string checkpointFile = joinPath(checkpointDir, pagerFile);
+			TraceEvent(SevInfo, "RedwoodCheckpointBegin")
+			    .detail("Filename", self->m_filename)
+			    .detail("MinVersion", request.version)
+			    .detail("PagerVersion", version)
+			    .detail("Range", request.range)
+			    .detail("CheckpointDir", checkpointDir);
+
+			platform::eraseDirectoryRecursive(checkpointDir);
+			platform::createDirectory(checkpointDir);
+
+			state Reference<IAsyncFile> src = wait(IAsyncFileSystem::filesystem()->open(
+			    self->m_filename, IAsyncFile::OPEN_READONLY | IAsyncFile::OPEN_UNCACHED | IAsyncFile::OPEN_NO_AIO, 0));
+			state Reference<IAsyncFile> dst = wait(IAsyncFileSystem::filesystem()->open(
+			    checkpointFile,
+			    IAsyncFile::OPEN_ATOMIC_WRITE_AND_CREATE | IAsyncFile::OPEN_READWRITE | IAsyncFile::OPEN_CREATE |
+			        IAsyncFile::OPEN_UNCACHED | IAsyncFile::OPEN_NO_AIO,
+			    0666));
+			state int64_t size = wait(src->size());
+			state Standalone<StringRef> buf = makeAlignedString(_PAGE_SIZE, 1 << 20);
+			state int64_t offset = 0;
+			while (offset < size) {
+				state int bytesRead = wait(src->read(mutateString(buf), buf.size(), offset));
+				if (bytesRead == 0) {
+					throw io_error();
+				}
+				wait(dst->write(buf.begin(), bytesRead, offset));
+				offset += bytesRead;
+			}
+			wait(dst->sync());
+			src.clear();
+			dst.clear();
+
+			RedwoodCheckpoint redwood;
+			redwood.dir = checkpointDir;
+			redwood.pagerFile = pagerFile;
+			redwood.pagerFileSize = size;
+			res = CheckpointMetaData(version, request.range, request.format, request.checkpointID);
+			res.serializedCheckpoint = ObjectWriter::toValue(redwood, IncludeVersion());
+			res.setState(CheckpointMetaData::Complete);
+		} catch (Error& e) {
+			barrier.send(Void());
+			throw;
+		}
+		barrier.send(Void());
+
+		TraceEvent(SevInfo, "RedwoodCheckpointEnd")
+		    .detail("Filename", self->m_filename)
+		    .detail("Version", res.version)
+		    .detail("CheckpointDir", checkpointDir);
+		return res;
+	}
+
 	Future<Void> getError() const override { return delayed(m_error.getFuture()); };
 
 	void clear(KeyRangeRef range, const Arena* arena = 0) override {
@@ -7794,16 +8253,26 @@ public:
 
 	Future<RangeResult> readRange(KeyRangeRef keys, int rowLimit, int byteLimit, IKeyValueStore::ReadType) override {
 		debug_printf("READRANGE %s\n", printable(keys).c_str());
-		return catchError(readRange_impl(this, keys, rowLimit, byteLimit));
+		return catchError(readRange_impl(this, keys, m_tree->getLastCommittedVersion(), rowLimit, byteLimit));
+	}
+
+	Future<RangeResult> readRangeAtVersion(KeyRangeRef keys,
+	                                       Version version,
+	                                       int rowLimit,
+	                                       int byteLimit,
+	                                       IKeyValueStore::ReadType) override {
+		debug_printf("READRANGE %s @%" PRId64 "\n", printable(keys).c_str(), version);
+		return catchError(readRange_impl(this, keys, version, rowLimit, byteLimit));
 	}
 
 	ACTOR static Future<RangeResult> readRange_impl(KeyValueStoreRedwood* self,
 	                                                KeyRange keys,
+	                                                Version version,
 	                                                int rowLimit,
 	                                                int byteLimit) {
+		self->checkReadVersion(version);
 		state VersionedBTree::BTreeCursor cur;
-		wait(
-		    self->m_tree->initBTreeCursor(&cur, self->m_tree->getLastCommittedVersion(), PagerEventReasons::RangeRead));
+		wait(self->m_tree->initBTreeCursor(&cur, version, PagerEventReasons::RangeRead));
 		state PriorityMultiLock::Lock lock;
 		state Future<Void> f;
 		++g_redwoodMetrics.metric.opGetRange;
@@ -7815,6 +8284,7 @@ public:
 		if (rowLimit == 0) {
 			return result;
 		}
+		state bool forward = rowLimit > 0;
 
 		if (rowLimit > 0) {
 			f = cur.seekGTE(keys.begin);
@@ -7828,7 +8298,12 @@ public:
 			}
 
 			if (self->prefetch) {
-				cur.prefetch(keys.end, true, rowLimit, byteLimit);
+				int readAhead = self->updateReadAheadFactor(keys.begin, keys.end, true);
+				CODE_PROBE(readAhead > 1, "Redwood range prefetch budget boosted for a sequential scan");
+				cur.prefetch(keys.end,
+				             true,
+				             (int)std::min<int64_t>((int64_t)rowLimit * readAhead, std::numeric_limits<int>::max()),
+				             (int)std::min<int64_t>((int64_t)byteLimit * readAhead, std::numeric_limits<int>::max()));
 			}
 
 			while (cur.isValid()) {
@@ -7884,7 +8359,11 @@ public:
 			}
 
 			if (self->prefetch) {
-				cur.prefetch(keys.begin, false, -rowLimit, byteLimit);
+				int readAhead = self->updateReadAheadFactor(keys.begin, keys.end, false);
+				cur.prefetch(keys.begin,
+				             false,
+				             (int)std::min<int64_t>((int64_t)-rowLimit * readAhead, std::numeric_limits<int>::max()),
+				             (int)std::min<int64_t>((int64_t)byteLimit * readAhead, std::numeric_limits<int>::max()));
 			}
 
 			while (cur.isValid()) {
@@ -7935,14 +8414,28 @@ public:
 			ASSERT(result.size() > 0);
 			result.readThrough = result[result.size() - 1].key;
 		}
+		if (self->prefetch) {
+			// Remember where this scan stopped so that a continuation request starting there can be
+			// recognized and given a larger readahead budget.
+			if (result.more) {
+				KeyRef last = result[result.size() - 1].key;
+				// Deep copy so the continuation key does not pin the result arena or its source pages
+				self->m_scanContinuation = forward ? keyAfter(last) : Key(last);
+			} else {
+				self->m_scanContinuation = Key();
+			}
+		}
 		g_redwoodMetrics.kvSizeReadByGetRange->sample(accumulatedBytes);
 		return result;
 	}
 
-	ACTOR static Future<Optional<Value>> readValue_impl(KeyValueStoreRedwood* self, Key key, Optional<UID> debugID) {
+	ACTOR static Future<Optional<Value>> readValue_impl(KeyValueStoreRedwood* self,
+	                                                    Key key,
+	                                                    Version version,
+	                                                    Optional<UID> debugID) {
+		self->checkReadVersion(version);
 		state VersionedBTree::BTreeCursor cur;
-		wait(
-		    self->m_tree->initBTreeCursor(&cur, self->m_tree->getLastCommittedVersion(), PagerEventReasons::PointRead));
+		wait(self->m_tree->initBTreeCursor(&cur, version, PagerEventReasons::PointRead));
 
 		// Not locking for point reads, instead relying on IO priority lock
 		// state PriorityMultiLock::Lock lock = wait(self->m_concurrentReads.lock());
@@ -7962,19 +8455,31 @@ public:
 	}
 
 	Future<Optional<Value>> readValue(KeyRef key, IKeyValueStore::ReadType, Optional<UID> debugID) override {
-		return catchError(readValue_impl(this, key, debugID));
+		return catchError(readValue_impl(this, key, m_tree->getLastCommittedVersion(), debugID));
 	}
 
+	Future<Optional<Value>> readValueAtVersion(KeyRef key,
+	                                           Version version,
+	                                           IKeyValueStore::ReadType,
+	                                           Optional<UID> debugID) override {
+		return catchError(readValue_impl(this, key, version, debugID));
+	}
+
+	Version getOldestReadableVersion() const override { return m_tree->getOldestReadableVersion(); }
+
+	Version getLastCommittedVersion() const override { return m_tree->getLastCommittedVersion(); }
+
 	Future<Optional<Value>> readValuePrefix(KeyRef key,
 	                                        int maxLength,
 	                                        IKeyValueStore::ReadType,
 	                                        Optional<UID> debugID) override {
-		return catchError(map(readValue_impl(this, key, debugID), [maxLength](Optional<Value> v) {
-			if (v.present() && v.get().size() > maxLength) {
-				v.get().contents() = v.get().substr(0, maxLength);
-			}
-			return v;
-		}));
+		return catchError(
+		    map(readValue_impl(this, key, m_tree->getLastCommittedVersion(), debugID), [maxLength](Optional<Value> v) {
+			    if (v.present() && v.get().size() > maxLength) {
+				    v.get().contents() = v.get().substr(0, maxLength);
+			    }
+			    return v;
+		    }));
 	}
 
 	~KeyValueStoreRedwood() override{};
@@ -7987,9 +8492,46 @@ private:
 	Promise<Void> m_error;
 	PriorityMultiLock m_concurrentReads;
 	bool prefetch;
+	// Large scans typically arrive as a series of limit-bounded range reads, each starting where
+	// the previous one stopped.  The key where the last limited range read stopped is remembered
+	// and the prefetch budget is grown for each consecutive continuation so that deeper readahead
+	// is issued once a scan proves to be sequential.
+	Key m_scanContinuation;
+	bool m_scanForward = true;
+	int m_readAheadFactor = 1;
 	Version m_nextCommitVersion;
 	std::shared_ptr<IEncryptionKeyProvider> m_keyProvider;
 	Future<Void> m_lastCommit = Void();
+	Future<Void> m_defragScan;
+	// Ready except while a physical checkpoint is copying the pager file; commits wait on it.
+	Future<Void> m_checkpointBarrier = Void();
+	// Commit times of versions within the history retention window, oldest first, used to advance
+	// the oldest readable version as the window moves.  Empty if history is not being retained.
+	std::deque<std::pair<double, Version>> m_commitTimes;
+
+	// Throws if version is not within the currently readable version window
+	void checkReadVersion(Version version) const {
+		if (version > m_tree->getLastCommittedVersion()) {
+			throw future_version();
+		}
+		if (version < m_tree->getOldestReadableVersion()) {
+			throw transaction_too_old();
+		}
+	}
+
+	// Returns the prefetch budget multiplier for a range read, doubling it when the read is a
+	// continuation of the previous scan and resetting it to 1 otherwise.
+	int updateReadAheadFactor(KeyRef begin, KeyRef end, bool forward) {
+		if (forward == m_scanForward && m_scanContinuation.size() > 0 &&
+		    (forward ? begin : end) == m_scanContinuation) {
+			m_readAheadFactor =
+			    std::min(2 * m_readAheadFactor, SERVER_KNOBS->REDWOOD_KVSTORE_RANGE_PREFETCH_MAX_FACTOR);
+		} else {
+			m_readAheadFactor = 1;
+		}
+		m_scanForward = forward;
+		return m_readAheadFactor;
+	}
 
 	template <typename T>
 	inline Future<T> catchError(Future<T> f) {
@@ -11070,6 +11612,166 @@ TEST_CASE(":/redwood/performance/randomRangeScans") {
 	return Void();
 }
 
+// Returns the key for index in the replay benchmark's keyspace, a fixed prefix with a big endian
+// suffix so that indices are in key order
+static Key makeReplayKey(int64_t index, const std::string& keyData) {
+	Key k(StringRef((const uint8_t*)keyData.data(), keyData.size()));
+	*(uint64_t*)(k.end() - sizeof(uint64_t)) = bigEndian64(index);
+	return k;
+}
+
+// Replays a workload described by the op mix and size distributions captured from a production
+// storage process (StorageMetrics op rates and byte sample) against a standalone Redwood instance,
+// reporting op throughput plus the pager metrics (page writes, cache hit rate, remap queue
+// activity) accumulated during the run.  Run via
+//   fdbserver -r unittests -f :/redwood/performance/replay --knob-...
+// with the same seed to reproduce a run while evaluating knob changes.
+TEST_CASE(":/redwood/performance/replay") {
+	state std::string file = params.get("file").orDefault("unittest.redwood-v1");
+	state bool openExisting = params.getInt("openExisting").orDefault(0);
+	state int64_t initialRecords = params.getInt("initialRecords").orDefault(1e6);
+	state int64_t ops = params.getInt("ops").orDefault(1e6);
+	state double setFraction = params.getDouble("setFraction").orDefault(0.25);
+	state double clearFraction = params.getDouble("clearFraction").orDefault(0.05);
+	state double getFraction = params.getDouble("getFraction").orDefault(0.5);
+	// The remainder of the op mix is range reads
+	state int keySize = params.getInt("keySize").orDefault(32);
+	state int minValueSize = params.getInt("minValueSize").orDefault(100);
+	state int maxValueSize = params.getInt("maxValueSize").orDefault(500);
+	state int rangeWidth = params.getInt("rangeWidth").orDefault(50);
+	state int opsPerCommit = params.getInt("opsPerCommit").orDefault(5000);
+	state bool traceMetrics = params.getInt("traceMetrics").orDefault(0);
+
+	ASSERT(keySize >= (int)sizeof(uint64_t));
+	ASSERT(setFraction + clearFraction + getFraction <= 1.0);
+
+	printf("file: %s\n", file.c_str());
+	printf("openExisting: %d\n", openExisting);
+	printf("initialRecords: %" PRId64 "\n", initialRecords);
+	printf("ops: %" PRId64 "\n", ops);
+	printf("opMix: %.3f set, %.3f clear, %.3f get, %.3f getRange\n",
+	       setFraction,
+	       clearFraction,
+	       getFraction,
+	       1.0 - setFraction - clearFraction - getFraction);
+	printf("keySize: %d\n", keySize);
+	printf("valueSize: %d to %d\n", minValueSize, maxValueSize);
+	printf("rangeWidth: %d\n", rangeWidth);
+	printf("opsPerCommit: %d\n", opsPerCommit);
+
+	// If using stdout for metrics, prevent trace event metrics logger from starting
+	if (!traceMetrics) {
+		g_redwoodMetricsActor = Void();
+		g_redwoodMetrics.clear();
+	}
+
+	if (!openExisting) {
+		deleteFile(file);
+		wait(delay(5));
+	}
+	state IKeyValueStore* kvs = openKVStore(KeyValueStoreType::SSD_REDWOOD_V1, file, UID(), 0);
+	wait(kvs->init());
+
+	state std::string keyData(keySize, 'k');
+	state std::string valueData(maxValueSize, 'v');
+	state Future<Void> commit = Void();
+	state int64_t i;
+	state double start = timer();
+
+	if (!openExisting) {
+		printf("Loading %" PRId64 " records\n", initialRecords);
+		for (i = 0; i < initialRecords; ++i) {
+			Key k = makeReplayKey(i, keyData);
+			KeyValue kv;
+			kv.arena().dependsOn(k.arena());
+			kv.key = k;
+			kv.value = StringRef((const uint8_t*)valueData.data(),
+			                     deterministicRandom()->randomInt(minValueSize, maxValueSize + 1));
+			kvs->set(kv);
+			if (i % opsPerCommit == opsPerCommit - 1) {
+				wait(commit);
+				commit = kvs->commit();
+			}
+		}
+		wait(kvs->commit());
+		printf("Loaded in %.2f seconds.  StorageBytes=%s\n",
+		       timer() - start,
+		       kvs->getStorageBytes().toString().c_str());
+	}
+
+	state int64_t sets = 0;
+	state int64_t clears = 0;
+	state int64_t gets = 0;
+	state int64_t getRanges = 0;
+	state int64_t recordsRead = 0;
+	state Key rangeBegin;
+	state Key rangeEnd;
+
+	printf("Replaying %" PRId64 " ops\n", ops);
+	start = timer();
+	for (i = 0; i < ops; ++i) {
+		state int64_t index = deterministicRandom()->randomInt64(0, initialRecords);
+		double r = deterministicRandom()->random01();
+
+		if (r < setFraction) {
+			Key k = makeReplayKey(index, keyData);
+			KeyValue kv;
+			kv.arena().dependsOn(k.arena());
+			kv.key = k;
+			kv.value = StringRef((const uint8_t*)valueData.data(),
+			                     deterministicRandom()->randomInt(minValueSize, maxValueSize + 1));
+			kvs->set(kv);
+			++sets;
+		} else if (r < setFraction + clearFraction) {
+			rangeBegin = makeReplayKey(index, keyData);
+			rangeEnd = makeReplayKey(index + 1, keyData);
+			kvs->clear(KeyRangeRef(rangeBegin, rangeEnd));
+			++clears;
+		} else if (r < setFraction + clearFraction + getFraction) {
+			rangeBegin = makeReplayKey(index, keyData);
+			Optional<Value> v = wait(kvs->readValue(rangeBegin));
+			recordsRead += v.present() ? 1 : 0;
+			++gets;
+		} else {
+			rangeBegin = makeReplayKey(index, keyData);
+			rangeEnd = makeReplayKey(index + rangeWidth, keyData);
+			RangeResult result = wait(kvs->readRange(KeyRangeRef(rangeBegin, rangeEnd), rangeWidth));
+			recordsRead += result.size();
+			++getRanges;
+		}
+
+		if (i % opsPerCommit == opsPerCommit - 1) {
+			wait(commit);
+			// Avoid capturing state vars via this in the continuation
+			bool printMetrics = !traceMetrics;
+			commit = map(kvs->commit(), [printMetrics](Void) {
+				if (printMetrics) {
+					printf("%s\n", g_redwoodMetrics.toString(true).c_str());
+				}
+				return Void();
+			});
+		}
+	}
+	wait(kvs->commit());
+
+	double elapsed = timer() - start;
+	printf("Replayed %" PRId64 " ops in %.2f seconds, %.2f ops/sec\n", ops, elapsed, ops / elapsed);
+	printf("  %" PRId64 " sets, %" PRId64 " clears, %" PRId64 " gets, %" PRId64 " getRanges, %" PRId64
+	       " records read\n",
+	       sets,
+	       clears,
+	       gets,
+	       getRanges,
+	       recordsRead);
+	if (!traceMetrics) {
+		printf("%s\n", g_redwoodMetrics.toString(true).c_str());
+	}
+	printf("StorageBytes=%s\n", kvs->getStorageBytes().toString().c_str());
+
+	wait(closeKVS(kvs));
+	return Void();
+}
+
 TEST_CASE(":/redwood/performance/histogramThroughput") {
 	std::default_random_engine generator;
 	std::uniform_int_distribution<uint32_t> distribution(0, UINT32_MAX);
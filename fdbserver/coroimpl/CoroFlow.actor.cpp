@@ -19,6 +19,7 @@
  */
 
 #include "fdbserver/CoroFlow.h"
+#include "fdbserver/VFSAsync.h"
 #include "flow/ActorCollection.h"
 #include "flow/TDMetric.actor.h"
 #include "fdbrpc/simulator.h"
@@ -286,9 +287,15 @@ public:
 typedef WorkPool<Coroutine, ThreadUnsafeSpinLock, true> CoroPool;
 
 void CoroThreadPool::waitFor(Future<Void> what) {
-	ASSERT(current_coro != nullptr);
 	if (what.isReady())
 		return;
+	// An inline read executing on the main thread must never block, so any wait that would
+	// otherwise suspend is reported to the VFS caller as a cache miss.
+	if (current_coro == nullptr && VFSAsyncFile::inlineReadActive) {
+		VFSAsyncFile::inlineReadMissed = true;
+		throw io_error();
+	}
+	ASSERT(current_coro != nullptr);
 	// double t = now();
 	current_coro->waitFor(what);
 	what.get(); // Throw if |what| is an error
@@ -19,6 +19,7 @@
  */
 
 #include "fdbserver/CoroFlow.h"
+#include "fdbserver/VFSAsync.h"
 #include "flow/ActorCollection.h"
 #include "Coro.h"
 #include "flow/TDMetric.actor.h"
@@ -274,9 +275,15 @@ ACTOR void coroSwitcher(Future<Void> what, TaskPriority taskID, Coro* coro) {
 }
 
 void CoroThreadPool::waitFor(Future<Void> what) {
-	ASSERT(current_coro != main_coro);
 	if (what.isReady())
 		return;
+	// An inline read executing on the main thread must never block, so any wait that would
+	// otherwise suspend is reported to the VFS caller as a cache miss.
+	if (current_coro == main_coro && VFSAsyncFile::inlineReadActive) {
+		VFSAsyncFile::inlineReadMissed = true;
+		throw io_error();
+	}
+	ASSERT(current_coro != main_coro);
 	// double t = now();
 	coroSwitcher(what, g_network->getCurrentTask(), current_coro);
 	Coro_switchTo_(swapCoro(main_coro), main_coro);
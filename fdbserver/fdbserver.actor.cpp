@@ -89,6 +89,7 @@
 #include <execinfo.h>
 #include <signal.h>
 #include <sys/prctl.h>
+#include <sys/wait.h>
 #ifdef ALLOC_INSTRUMENTATION
 #include <cxxabi.h>
 #endif
@@ -110,10 +111,10 @@ enum {
 	OPT_NOBOX, OPT_TESTFILE, OPT_RESTARTING, OPT_RESTORING, OPT_RANDOMSEED, OPT_KEY, OPT_MEMLIMIT, OPT_VMEMLIMIT, OPT_STORAGEMEMLIMIT, OPT_CACHEMEMLIMIT, OPT_MACHINEID,
 	OPT_DCID, OPT_MACHINE_CLASS, OPT_BUGGIFY, OPT_VERSION, OPT_BUILD_FLAGS, OPT_CRASHONERROR, OPT_HELP, OPT_NETWORKIMPL, OPT_NOBUFSTDOUT, OPT_BUFSTDOUTERR,
 	OPT_TRACECLOCK, OPT_NUMTESTERS, OPT_DEVHELP, OPT_PRINT_CODE_PROBES, OPT_ROLLSIZE, OPT_MAXLOGS, OPT_MAXLOGSSIZE, OPT_KNOB, OPT_UNITTESTPARAM, OPT_TESTSERVERS, OPT_TEST_ON_SERVERS, OPT_METRICSCONNFILE,
-	OPT_METRICSPREFIX, OPT_LOGGROUP, OPT_LOCALITY, OPT_IO_TRUST_SECONDS, OPT_IO_TRUST_WARN_ONLY, OPT_FILESYSTEM, OPT_PROFILER_RSS_SIZE, OPT_KVFILE,
+	OPT_METRICSPREFIX, OPT_LOGGROUP, OPT_LOCALITY, OPT_IO_TRUST_SECONDS, OPT_IO_TRUST_WARN_ONLY, OPT_FILESYSTEM, OPT_PROFILER_RSS_SIZE, OPT_KVFILE, OPT_STORETYPE,
 	OPT_TRACE_FORMAT, OPT_WHITELIST_BINPATH, OPT_BLOB_CREDENTIAL_FILE, OPT_CONFIG_PATH, OPT_USE_TEST_CONFIG_DB, OPT_FAULT_INJECTION, OPT_PROFILER, OPT_PRINT_SIMTIME,
 	OPT_FLOW_PROCESS_NAME, OPT_FLOW_PROCESS_ENDPOINT, OPT_IP_TRUSTED_MASK, OPT_KMS_CONN_DISCOVERY_URL_FILE, OPT_KMS_CONN_VALIDATION_TOKEN_DETAILS, OPT_KMS_CONN_GET_ENCRYPTION_KEYS_ENDPOINT,
-	OPT_NEW_CLUSTER_KEY
+	OPT_NEW_CLUSTER_KEY, OPT_SIMULATION_SEEDS
 };
 
 CSimpleOpt::SOption g_rgOptions[] = {
@@ -149,6 +150,7 @@ CSimpleOpt::SOption g_rgOptions[] = {
 	{ OPT_NOBOX,                 "--no-dialog",                 SO_NONE },
 #endif
 	{ OPT_KVFILE,                "--kvfile",                    SO_REQ_SEP },
+	{ OPT_STORETYPE,             "--storetype",                 SO_REQ_SEP },
 	{ OPT_TESTFILE,              "-f",                          SO_REQ_SEP },
 	{ OPT_TESTFILE,              "--testfile",                  SO_REQ_SEP },
 	{ OPT_RESTARTING,            "-R",                          SO_NONE },
@@ -202,6 +204,7 @@ CSimpleOpt::SOption g_rgOptions[] = {
 	{ OPT_USE_TEST_CONFIG_DB,    "--use-test-config-db",        SO_NONE },
 	{ OPT_FAULT_INJECTION,       "-fi",                         SO_REQ_SEP },
 	{ OPT_FAULT_INJECTION,       "--fault-injection",           SO_REQ_SEP },
+	{ OPT_SIMULATION_SEEDS,      "--simulation-seeds",          SO_REQ_SEP },
 	{ OPT_PROFILER,	             "--profiler-",                 SO_REQ_SEP },
 	{ OPT_PRINT_SIMTIME,         "--print-sim-time",             SO_NONE },
 	{ OPT_FLOW_PROCESS_NAME,     "--process-name",              SO_REQ_SEP },
@@ -630,7 +633,7 @@ static void printUsage(const char* name, bool devhelp) {
 	                 " Sets the LogGroup field with the specified value for all"
 	                 " events in the trace output (defaults to `default').");
 	printOptionUsage("--trace-format FORMAT",
-	                 " Select the format of the log files. xml (the default) and json"
+	                 " Select the format of the log files. xml (the default), json, and binary"
 	                 " are supported.");
 	printOptionUsage("--tracer       TRACER",
 	                 " Select a tracer for transaction tracing. Currently disabled"
@@ -674,7 +677,8 @@ static void printUsage(const char* name, bool devhelp) {
 		printOptionUsage("-r ROLE, --role ROLE",
 		                 " Server role (valid options are fdbd, test, multitest,"
 		                 " simulation, networktestclient, networktestserver, restore"
-		                 " consistencycheck, kvfileintegritycheck, kvfilegeneratesums, kvfiledump, unittests)."
+		                 " consistencycheck, kvfileintegritycheck, kvfilegeneratesums, kvfiledump, kvbench,"
+		                 " unittests)."
 		                 " The default is `fdbd'.");
 #ifdef _WIN32
 		printOptionUsage("-n, --newconsole", " Create a new console.");
@@ -689,9 +693,19 @@ static void printUsage(const char* name, bool devhelp) {
 		printOptionUsage("-k KEY, --key KEY", "Target key for search role.");
 		printOptionUsage("--kvfile FILE",
 		                 "Input file (SQLite database file) for use by the 'kvfilegeneratesums', "
-		                 "'kvfileintegritycheck' and 'kvfiledump' roles.");
+		                 "'kvfileintegritycheck' and 'kvfiledump' roles, or the operation trace file "
+		                 "for the 'kvbench' role.");
+		printOptionUsage("--storetype TYPE",
+		                 "Storage engine the 'kvbench' role replays its trace against, specified as in"
+		                 " the database configuration (e.g. `ssd-2', `ssd-redwood-1-experimental',"
+		                 " `ssd-rocksdb-v1'). Defaults to `ssd-2'.");
 		printOptionUsage("-b [on,off], --buggify [on,off]", " Sets Buggify system state, defaults to `off'.");
 		printOptionUsage("-fi [on,off], --fault-injection [on,off]", " Sets fault injection, defaults to `on'.");
+		printOptionUsage("--simulation-seeds COUNT",
+		                 " Run COUNT consecutive seeds, each in its own forked child process, so one machine"
+		                 " can run seeds on all of its cores; the parent reports per-seed pass/fail. Combine"
+		                 " with `-b off -fi off' for a deterministic performance profile without buggify"
+		                 " delays or fault injection. Simulation only, defaults to 1.");
 		printOptionUsage("--crash", "Crash on serious errors instead of continuing.");
 		printOptionUsage("-N NETWORKIMPL, --network NETWORKIMPL",
 		                 " Select network implementation, `net2' (default),"
@@ -740,6 +754,14 @@ static void printUsage(const char* name, bool devhelp) {
 		       " - FDB_DUMP_ENDKEY: end key for the dump, default is \"\\xff\\xff\"\n"
 		       " - FDB_DUMP_DEBUG: print key-values to stderr in escaped format\n");
 
+		printf("\n"
+		       "The 'kvbench' role replays a recorded operation trace (passed with '--kvfile')\n"
+		       "against the storage engine selected with '--storetype' and reports latency\n"
+		       "histograms plus write and space amplification. The trace is text, one operation\n"
+		       "per line: 'set <key> <value>', 'clear <begin> <end>', 'get <key>',\n"
+		       "'getrange <begin> <end> <rowLimit>' or 'commit', with keys and values escaped\n"
+		       "as produced by printable().\n");
+
 		printf(
 		    "\n"
 		    "The 'changedescription' role replaces the old cluster key in all coordinators' data file to the specified "
@@ -1001,6 +1023,7 @@ enum class ServerRole {
 	DSLTest,
 	FDBD,
 	FlowProcess,
+	KVBench,
 	KVFileGenerateIOLogChecksums,
 	KVFileIntegrityCheck,
 	KVFileDump,
@@ -1028,9 +1051,11 @@ struct CLIOptions {
 
 	ServerRole role = ServerRole::FDBD;
 	uint32_t randomSeed = platform::getRandomSeed();
+	int simulationSeeds = 1; // number of consecutive seeds to run in forked child processes (simulation only)
 
 	const char* testFile = "tests/default.txt";
 	std::string kvFile;
+	std::string storeType = "ssd-2";
 	std::string testServersStr;
 	std::string whitelistBinPaths;
 
@@ -1260,6 +1285,8 @@ private:
 					role = ServerRole::KVFileGenerateIOLogChecksums;
 				else if (!strcmp(sRole, "kvfiledump"))
 					role = ServerRole::KVFileDump;
+				else if (!strcmp(sRole, "kvbench"))
+					role = ServerRole::KVBench;
 				else if (!strcmp(sRole, "consistencycheck"))
 					role = ServerRole::ConsistencyCheck;
 				else if (!strcmp(sRole, "unittests"))
@@ -1445,6 +1472,9 @@ private:
 			case OPT_KVFILE:
 				kvFile = args.OptionArg();
 				break;
+			case OPT_STORETYPE:
+				storeType = args.OptionArg();
+				break;
 			case OPT_RESTARTING:
 				restarting = true;
 				break;
@@ -1458,6 +1488,16 @@ private:
 				}
 				break;
 			}
+			case OPT_SIMULATION_SEEDS: {
+				char* end;
+				simulationSeeds = (int)strtol(args.OptionArg(), &end, 0);
+				if (*end || simulationSeeds < 1) {
+					fprintf(stderr, "ERROR: Could not parse simulation seed count `%s'\n", args.OptionArg());
+					printHelpTeaser(argv[0]);
+					flushAndExit(FDB_EXIT_ERROR);
+				}
+				break;
+			}
 			case OPT_MACHINEID: {
 				zoneId = std::string(args.OptionArg());
 				break;
@@ -1723,7 +1763,7 @@ private:
 		    });
 		if ((role != ServerRole::Simulation && role != ServerRole::CreateTemplateDatabase &&
 		     role != ServerRole::KVFileIntegrityCheck && role != ServerRole::KVFileGenerateIOLogChecksums &&
-		     role != ServerRole::KVFileDump && role != ServerRole::UnitTests) ||
+		     role != ServerRole::KVFileDump && role != ServerRole::KVBench && role != ServerRole::UnitTests) ||
 		    autoPublicAddress) {
 
 			if (seedSpecified && !fileExists(connFile)) {
@@ -1857,6 +1897,48 @@ int main(int argc, char* argv[]) {
 		auto opts = CLIOptions::parseArgs(argc, argv);
 		const auto role = opts.role;
 
+#if defined(__linux__) || defined(__FreeBSD__)
+		if (role == ServerRole::Simulation && opts.simulationSeeds > 1) {
+			// Run each seed in its own forked child process so one machine can run seeds on all of its cores
+			// while sharing the binary's read-only pages. Forking happens before any trace file or network
+			// state exists; each child gets its own data and log directory and continues down the normal
+			// single-seed path, and the parent only collects exit codes.
+			std::vector<std::pair<pid_t, uint32_t>> children;
+			for (int i = 0; i < opts.simulationSeeds; i++) {
+				uint32_t seed = opts.randomSeed + i;
+				pid_t pid = fork();
+				if (pid < 0) {
+					fprintf(stderr, "ERROR: Could not fork simulation child process (%s)\n", strerror(errno));
+					flushAndExit(FDB_EXIT_ERROR);
+				}
+				if (pid == 0) {
+					opts.randomSeed = seed;
+					std::string suffix = format("/seed_%u", seed);
+					opts.dataFolder = (opts.dataFolder.size() ? opts.dataFolder : "simfdb") + suffix;
+					opts.logFolder = opts.dataFolder;
+					platform::createDirectory(opts.dataFolder);
+					children.clear();
+					break;
+				}
+				children.emplace_back(pid, seed);
+			}
+			if (!children.empty()) {
+				int failed = 0;
+				for (const auto& [pid, seed] : children) {
+					int status = 0;
+					while (waitpid(pid, &status, 0) < 0 && errno == EINTR)
+						;
+					bool passed = WIFEXITED(status) && WEXITSTATUS(status) == FDB_EXIT_SUCCESS;
+					printf("Seed %u: %s\n", seed, passed ? "PASS" : "FAIL");
+					if (!passed)
+						failed++;
+				}
+				printf("%d/%d seeds passed\n", opts.simulationSeeds - failed, opts.simulationSeeds);
+				flushAndExit(failed ? FDB_EXIT_ERROR : FDB_EXIT_SUCCESS);
+			}
+		}
+#endif
+
 		if (role == ServerRole::Simulation) {
 			printf("Random seed is %u...\n", opts.randomSeed);
 			bindDeterministicRandomToOpenssl();
@@ -2320,6 +2402,9 @@ int main(int argc, char* argv[]) {
 		} else if (role == ServerRole::KVFileDump) {
 			f = stopAfter(KVFileDump(opts.kvFile));
 			g_network->run();
+		} else if (role == ServerRole::KVBench) {
+			f = stopAfter(KVBench(opts.kvFile, opts.storeType));
+			g_network->run();
 		} else if (role == ServerRole::ChangeClusterKey) {
 			Key newClusterKey(opts.newClusterKey);
 			Key oldClusterKey = opts.connectionFile->getConnectionString().clusterKey();
@@ -141,6 +141,10 @@ public:
 		if (iPrevious.mutation().clearAfterBoundary) {
 			ib.mutation().clearAll();
 		}
+		// The range after the new boundary inherits any pending rebuild request
+		if (iPrevious.mutation().forceRebuild) {
+			ib.mutation().forceRebuild = true;
+		}
 		return ib;
 	}
 };
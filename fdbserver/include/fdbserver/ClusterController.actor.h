@@ -1851,8 +1851,11 @@ public:
 		return result;
 	}
 
+	// When dryRun is set, the planned datacenter preferences are not applied, so a hypothetical recruitment can
+	// be computed without steering any actual recruitment towards its layout.
 	RecruitFromConfigurationReply findWorkersForConfigurationDispatch(RecruitFromConfigurationRequest const& req,
-	                                                                  bool checkGoodRecruitment) {
+	                                                                  bool checkGoodRecruitment,
+	                                                                  bool dryRun = false) {
 		if (req.configuration.regions.size() > 1) {
 			std::vector<RegionInfo> regions = req.configuration.regions;
 			if (regions[0].priority == regions[1].priority && regions[1].dcId == clusterControllerDcId.get()) {
@@ -1894,7 +1897,9 @@ public:
 				std::vector<Optional<Key>> dcPriority;
 				dcPriority.push_back(regions[0].dcId);
 				dcPriority.push_back(regions[1].dcId);
-				desiredDcIds.set(dcPriority);
+				if (!dryRun) {
+					desiredDcIds.set(dcPriority);
+				}
 				if (reply.isError()) {
 					throw reply.getError();
 				} else if (regions[0].dcId == clusterControllerDcId.get()) {
@@ -1918,7 +1923,7 @@ public:
 				    .error(e)
 				    .detail("SetPrimaryDesired", setPrimaryDesired);
 				auto reply = findWorkersForConfigurationFromDC(req, regions[1].dcId, checkGoodRecruitment);
-				if (!setPrimaryDesired) {
+				if (!setPrimaryDesired && !dryRun) {
 					std::vector<Optional<Key>> dcPriority;
 					dcPriority.push_back(regions[1].dcId);
 					dcPriority.push_back(regions[0].dcId);
@@ -1934,7 +1939,9 @@ public:
 		} else if (req.configuration.regions.size() == 1) {
 			std::vector<Optional<Key>> dcPriority;
 			dcPriority.push_back(req.configuration.regions[0].dcId);
-			desiredDcIds.set(dcPriority);
+			if (!dryRun) {
+				desiredDcIds.set(dcPriority);
+			}
 			auto reply =
 			    findWorkersForConfigurationFromDC(req, req.configuration.regions[0].dcId, checkGoodRecruitment);
 			if (reply.isError()) {
@@ -2089,11 +2096,15 @@ public:
 				TraceEvent("BestDCIsNotClusterDC").log();
 				std::vector<Optional<Key>> dcPriority;
 				dcPriority.push_back(bestDC);
-				desiredDcIds.set(dcPriority);
+				if (!dryRun) {
+					desiredDcIds.set(dcPriority);
+				}
 				throw no_more_servers();
 			}
 			// If this cluster controller dies, do not prioritize recruiting the next one in the same DC
-			desiredDcIds.set(std::vector<Optional<Key>>());
+			if (!dryRun) {
+				desiredDcIds.set(std::vector<Optional<Key>>());
+			}
 			TraceEvent("FindWorkersForConfig")
 			    .detail("Replication", req.configuration.tLogReplicationFactor)
 			    .detail("DesiredLogs", req.configuration.getDesiredLogs())
@@ -3237,6 +3248,13 @@ public:
 	std::set<Endpoint> updateDBInfoEndpoints;
 	std::set<Endpoint> removedDBInfoEndpoints;
 
+	// Cached resolution of the coordinator hostnames, keyed by the connection string it was resolved from. Every
+	// worker registration needs the coordinator addresses, and re-resolving them for each periodic re-registration
+	// makes heartbeat intake cost scale with cluster size for no benefit.
+	std::string resolvedCoordinatorsKey;
+	std::vector<NetworkAddress> resolvedCoordinators;
+	double resolvedCoordinatorsTime = -1;
+
 	DBInfo db;
 	Database cx;
 	double startTime;
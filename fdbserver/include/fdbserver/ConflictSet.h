@@ -50,6 +50,15 @@ struct ConflictBatch {
 	                     Version newOldestVersion,
 	                     std::vector<int>& nonConflicting,
 	                     std::vector<int>* tooOldTransactions = nullptr);
+	// Like detectConflicts, but checks the read conflict ranges against the version history on the
+	// conflict set's worker threads, partitioning the ranges and combining the per-worker results on
+	// the caller's thread so the outcome matches the serial check exactly. Falls back to the serial
+	// path when RESOLVER_READ_CHECK_THREADS == 0 or when any transaction reports conflicting keys.
+	// The workers own copies of everything they touch, so cancelling the caller is safe.
+	Future<Void> detectConflictsParallel(Version now,
+	                                     Version newOldestVersion,
+	                                     std::vector<int>& nonConflicting,
+	                                     std::vector<int>* tooOldTransactions = nullptr);
 	void GetTooOldTransactions(std::vector<int>& tooOldTransactions);
 
 private:
@@ -68,6 +77,11 @@ private:
 	void combineWriteConflictRanges();
 	void checkReadConflictRanges();
 	void mergeWriteConflictRanges(Version now);
+	// The phases of detectConflicts that follow the read conflict check.
+	void finishDetectConflicts(Version now,
+	                           Version newOldestVersion,
+	                           std::vector<int>& nonConflicting,
+	                           std::vector<int>* tooOldTransactions);
 	void addConflictRanges(Version now,
 	                       std::vector<std::pair<StringRef, StringRef>>::iterator begin,
 	                       std::vector<std::pair<StringRef, StringRef>>::iterator end,
@@ -1308,6 +1308,9 @@ public:
 				return -1;
 			}
 
+			// The caller is about to visit the child, so overlap its memory fetch with the work below
+			prefetchNode(childOffset);
+
 			// parent has this child so return the index if it is in DecodedNode
 			if (parent->rightChildIndex != -1) {
 				return parent->rightChildIndex;
@@ -1333,6 +1336,9 @@ public:
 				return -1;
 			}
 
+			// The caller is about to visit the child, so overlap its memory fetch with the work below
+			prefetchNode(childOffset);
+
 			// parent has this child so return the index if it is in DecodedNode
 			if (parent->leftChildIndex != -1) {
 				return parent->leftChildIndex;
@@ -1346,6 +1352,15 @@ public:
 			return childIndex;
 		}
 
+		// Hint the CPU to start pulling the tree Node at the given offset into cache.
+		// Node offsets within a page are effectively random, so each hop of a search or iteration descent
+		// stalls on memory unless the candidate children were requested while the previous comparison ran.
+		void prefetchNode(int offset) const {
+			if (offset != 0) {
+				_mm_prefetch((const char*)tree->nodeAt(offset), _MM_HINT_T0);
+			}
+		}
+
 		// seek() moves the cursor to a node containing s or the node that would be the parent of s if s were to be
 		// added to the tree. If the tree was empty, the cursor will be invalid and the return value will be 0.
 		// Otherwise, returns the result of s.compare(item at cursor position)
@@ -1359,8 +1374,17 @@ public:
 
 			while (nIndex != -1) {
 				nodeIndex = nIndex;
-				item.reset();
-				cmp = s.compare(get(), skipLen);
+				DecodedNode& decoded = cache->get(nIndex);
+				Node* n = decoded.node(tree);
+
+				// Both possible next hops are likely outside this node's cache lines, so request them before
+				// doing the comparison that chooses between them
+				prefetchNode(n->getLeftChildOffset(tree->largeNodes));
+				prefetchNode(n->getRightChildOffset(tree->largeNodes));
+
+				// Compare against the item without materializing it into the cursor; the final item is
+				// produced lazily by get() for whichever node the cursor ends up on
+				cmp = s.compare(get(decoded), skipLen);
 				deltatree_printf("seek(%s) loop cmp=%d %s\n", s.toString().c_str(), cmp, toString().c_str());
 				if (cmp == 0) {
 					break;
@@ -42,6 +42,12 @@ Future<std::unordered_map<BlobCipherDetails, Reference<BlobCipherKey>>> getEncry
     const Reference<AsyncVar<ServerDBInfo> const>& db,
     const std::unordered_set<BlobCipherDetails>& cipherDetails);
 
+// Keeps the latest cipher keys for every encryption domain this process has requested warm in the local
+// BlobCipherKeyCache, re-fetching keys from EncryptKeyProxy shortly before their cache TTL expires. Roles that
+// fetch cipher keys on a latency-sensitive path should run this so getLatestEncryptCipherKeys does not wait on
+// an EncryptKeyProxy round trip in steady state.
+Future<Void> refreshEncryptCipherKeys(const Reference<AsyncVar<ServerDBInfo> const>& db);
+
 struct TextAndHeaderCipherKeys {
 	Reference<BlobCipherKey> cipherTextKey;
 	Reference<BlobCipherKey> cipherHeaderKey;
@@ -88,6 +88,20 @@ public:
 	                                                ReadType type = ReadType::NORMAL,
 	                                                Optional<UID> debugID = Optional<UID>()) = 0;
 
+	// Reads several keys with one call, returning the values in the order the keys were given.
+	// The default implementation issues an individual readValue() per key; storage engines with a
+	// native batched lookup should override it to serve the whole batch with one engine call.
+	virtual Future<std::vector<Optional<Value>>> readValues(VectorRef<KeyRef> keys,
+	                                                        ReadType type = ReadType::NORMAL,
+	                                                        Optional<UID> debugID = Optional<UID>()) {
+		std::vector<Future<Optional<Value>>> values;
+		values.reserve(keys.size());
+		for (const auto& key : keys) {
+			values.push_back(readValue(key, type, debugID));
+		}
+		return getAll(values);
+	}
+
 	// If rowLimit>=0, reads first rows sorted ascending, otherwise reads last rows sorted descending
 	// The total size of the returned value (less the last entry) will be less than byteLimit
 	virtual Future<RangeResult> readRange(KeyRangeRef keys,
@@ -95,6 +109,28 @@ public:
 	                                      int byteLimit = 1 << 30,
 	                                      ReadType type = ReadType::NORMAL) = 0;
 
+	// Point-in-time reads as of a specific prior commit, for storage engines which retain version
+	// history.  The readable version window is [getOldestReadableVersion(), getLastCommittedVersion()]
+	// and reads outside of it will fail.  The default implementations do not support historical reads.
+	virtual Version getOldestReadableVersion() const { throw not_implemented(); }
+
+	virtual Version getLastCommittedVersion() const { throw not_implemented(); }
+
+	virtual Future<Optional<Value>> readValueAtVersion(KeyRef key,
+	                                                   Version version,
+	                                                   ReadType type = ReadType::NORMAL,
+	                                                   Optional<UID> debugID = Optional<UID>()) {
+		throw not_implemented();
+	}
+
+	virtual Future<RangeResult> readRangeAtVersion(KeyRangeRef keys,
+	                                               Version version,
+	                                               int rowLimit = 1 << 30,
+	                                               int byteLimit = 1 << 30,
+	                                               ReadType type = ReadType::NORMAL) {
+		throw not_implemented();
+	}
+
 	// Shard management APIs.
 	// Adds key range to a physical shard.
 	virtual Future<Void> addRange(KeyRangeRef range, std::string id) { return Void(); }
@@ -116,6 +152,16 @@ public:
 	// Returns the amount of free and total space for this store, in bytes
 	virtual StorageBytes getStorageBytes() const = 0;
 
+	// Background maintenance work the engine still owes for data it has already committed.
+	// LSM engines report their compaction backlog here so that ratekeeper can shape ingest
+	// before the engine starts stalling writes itself; engines without background
+	// compaction report zeroes.
+	struct CompactionDebt {
+		int64_t pendingBytes = 0; // estimated bytes compactions must rewrite to catch up
+		int64_t level0Files = 0; // files not yet compacted out of the engine's first level
+	};
+	virtual CompactionDebt getCompactionDebt() const { return CompactionDebt(); }
+
 	virtual void resyncLog() {}
 
 	virtual void enableSnapshot() {}
@@ -228,5 +274,6 @@ inline IKeyValueStore* openKVStore(KeyValueStoreType storeType,
 void GenerateIOLogChecksumFile(std::string filename);
 Future<Void> KVFileCheck(std::string const& filename, bool const& integrity);
 Future<Void> KVFileDump(std::string const& filename);
+Future<Void> KVBench(std::string const& traceFile, std::string const& storeTypeStr);
 
 #endif
@@ -569,6 +569,14 @@ private:
 public:
 	EncodingType getEncodingType() const { return page->encodingType; }
 
+	uint8_t getPageFormat() const {
+		if (page->headerVersion == 1) {
+			return page->getMainHeader<RedwoodHeaderV1>()->pageFormat;
+		} else {
+			throw page_header_version_not_supported();
+		}
+	}
+
 	PhysicalPageID getPhysicalPageID() const {
 		if (page->headerVersion == 1) {
 			return page->getMainHeader<RedwoodHeaderV1>()->firstPhysicalPageID;
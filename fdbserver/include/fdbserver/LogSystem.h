@@ -21,6 +21,7 @@
 #ifndef FDBSERVER_LOGSYSTEM_H
 #define FDBSERVER_LOGSYSTEM_H
 
+#include <map>
 #include <set>
 #include <stdint.h>
 #include <vector>
@@ -820,6 +821,11 @@ private:
 	std::vector<BinaryWriter> messagesWriter;
 	std::vector<bool> messagesWritten; // if messagesWriter has written anything
 	std::vector<int> msg_locations;
+	// Memoizes the push locations computed for each distinct tag set. Routing
+	// for a tag set is deterministic for the lifetime of a log system, and tag
+	// sets repeat heavily across the mutations of a version batch, so the
+	// replication policy only needs to run once per distinct set.
+	std::map<std::vector<Tag>, std::vector<int>> cached_locations;
 	// Stores message locations that have had span information written to them
 	// for the current transaction. Adding transaction info will reset this
 	// field.
@@ -828,6 +834,10 @@ private:
 	SpanContext spanContext;
 	bool shardChanged = false; // if keyServers has any changes, i.e., shard boundary modifications.
 
+	// Fills msg_locations with the push locations for prev_tags, consulting
+	// and populating cached_locations.
+	void getPushLocationsCached();
+
 	// Writes transaction info to the message stream at the given location if
 	// it has not already been written (for the current transaction). Returns
 	// true on a successful write, and false if the location has already been
@@ -844,8 +854,12 @@ void LogPushData::writeTypedMessage(T const& item, bool metadataMessage, bool al
 	for (auto& tag : next_message_tags) {
 		prev_tags.push_back(tag);
 	}
-	msg_locations.clear();
-	logSystem->getPushLocations(prev_tags, msg_locations, allLocations);
+	if (allLocations) {
+		msg_locations.clear();
+		logSystem->getPushLocations(prev_tags, msg_locations, true /*allLocations*/);
+	} else {
+		getPushLocationsCached();
+	}
 
 	BinaryWriter bw(AssumeVersion(g_network->protocolVersion()));
 
@@ -130,6 +130,7 @@ private:
 	Version startLoc, recoveryLoc, recoveryQueueLoc;
 	std::vector<Standalone<StringRef>> recoveryQueue;
 	int recoveryQueueDataSize;
+	Future<Void> recoveryFill; // outstanding peek-ahead fill of recoveryQueue, ahead of readNext() calls
 
 	// State for next commit() call
 	Standalone<VectorRef<VectorRef<uint8_t>>> pushedData; // SOMEDAY: better representation?
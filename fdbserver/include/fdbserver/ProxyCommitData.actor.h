@@ -62,6 +62,7 @@ struct ProxyStats {
 	Counter mutations;
 	Counter conflictRanges;
 	Counter keyServerLocationIn, keyServerLocationOut, keyServerLocationErrors;
+	Counter keyServersDecodeHits, keyServersDecodeMisses;
 	Counter txnExpensiveClearCostEstCount;
 	Version lastCommitVersionAssigned;
 
@@ -114,7 +115,8 @@ struct ProxyStats {
 	    commitBatchIn("CommitBatchIn", cc), commitBatchOut("CommitBatchOut", cc), mutationBytes("MutationBytes", cc),
 	    mutations("Mutations", cc), conflictRanges("ConflictRanges", cc),
 	    keyServerLocationIn("KeyServerLocationIn", cc), keyServerLocationOut("KeyServerLocationOut", cc),
-	    keyServerLocationErrors("KeyServerLocationErrors", cc),
+	    keyServerLocationErrors("KeyServerLocationErrors", cc), keyServersDecodeHits("KeyServersDecodeHits", cc),
+	    keyServersDecodeMisses("KeyServersDecodeMisses", cc),
 	    txnExpensiveClearCostEstCount("ExpensiveClearCostEstCount", cc), lastCommitVersionAssigned(0),
 	    commitLatencySample("CommitLatencyMetrics",
 	                        id,
@@ -172,6 +174,10 @@ struct ProxyCommitData {
 	UID dbgid;
 	int64_t commitBatchesMemBytesCount;
 	std::map<TenantName, TenantMapEntry> tenantMap;
+	// Hash-indexed mirror of tenantMap for the per-transaction lookups on the commit path. The
+	// ordered map stays authoritative (range erases need it); both are updated together in
+	// applyMetadataMutations.
+	std::unordered_map<TenantName, TenantMapEntry> tenantMapIndex;
 	ProxyStats stats;
 	MasterInterface master;
 	std::vector<ResolverInterface> resolvers;
@@ -193,6 +199,8 @@ struct ProxyCommitData {
 	// only tracks normalKeys. This is used for tracking versions for systemKeys.
 	Deque<Version> systemKeyVersions;
 	KeyRangeMap<ServerCacheInfo> keyInfo; // keyrange -> all storage servers in all DCs for the keyrange
+	// Flat view of keyInfo used to serve key server location requests; lazily rebuilt when keyInfo changes
+	KeyRangeMapSnapshot<ServerCacheInfo> keyInfoSnapshot;
 	KeyRangeMap<bool> cacheInfo;
 	std::map<Key, ApplyMutationsData> uid_applyMutationsData;
 	bool firstProxy;
@@ -200,6 +208,10 @@ struct ProxyCommitData {
 	bool locked;
 	Optional<Value> metadataVersion;
 	double commitBatchInterval;
+	// Batch durations observed since the last closed-loop adjustment of commitBatchInterval.
+	// Only maintained when COMMIT_BATCH_LATENCY_TARGET > 0.
+	ContinuousSample<double> commitBatchDurations;
+	double lastCommitBatchIntervalAdjust;
 
 	int64_t localCommitBatchesStarted;
 	NotifiedVersion latestLocalCommitBatchResolving;
@@ -212,6 +224,10 @@ struct ProxyCommitData {
 	EventMetricHandle<SingleKeyMutation> singleKeyMutationEvent;
 
 	std::map<UID, Reference<StorageInfo>> storageCache;
+	// Decoded keyServers values, keyed by the raw value bytes. Data movement writes the same value
+	// across many shard boundaries, so caching skips repeated decoding. Cleared whenever server
+	// tags change, since decoding consults the server tag map.
+	std::unordered_map<std::string, std::pair<std::vector<UID>, std::vector<UID>>> keyServersDecodeCache;
 	std::unordered_map<UID, StorageServerInterface> tssMapping;
 	std::map<Tag, Version> tag_popped;
 	Deque<std::pair<Version, Version>> txsPopVersions;
@@ -294,7 +310,8 @@ struct ProxyCommitData {
 	    logAdapter(nullptr), txnStateStore(nullptr), committedVersion(recoveryTransactionVersion),
 	    minKnownCommittedVersion(0), version(0), lastVersionTime(0), commitVersionRequestNumber(1),
 	    mostRecentProcessedRequestNumber(0), firstProxy(firstProxy), lastCoalesceTime(0), locked(false),
-	    commitBatchInterval(SERVER_KNOBS->COMMIT_TRANSACTION_BATCH_INTERVAL_MIN), localCommitBatchesStarted(0),
+	    commitBatchInterval(SERVER_KNOBS->COMMIT_TRANSACTION_BATCH_INTERVAL_MIN), commitBatchDurations(1000),
+	    lastCommitBatchIntervalAdjust(0), localCommitBatchesStarted(0),
 	    getConsistentReadVersion(getConsistentReadVersion), commit(commit),
 	    cx(openDBOnServer(db, TaskPriority::DefaultEndpoint, LockAware::True)), db(db),
 	    singleKeyMutationEvent(LiteralStringRef("SingleKeyMutation")), lastTxsPop(0), popRemoteTxs(false),
@@ -43,6 +43,7 @@ enum limitReason_t {
 	log_server_min_free_space_ratio,
 	storage_server_durability_lag, // 10
 	storage_server_list_fetch_failed,
+	storage_server_compaction_debt,
 	limitReason_t_end
 };
 
@@ -64,12 +65,18 @@ public:
 	Smoother smoothDurableVersion, smoothLatestVersion;
 	Smoother smoothFreeSpace;
 	Smoother smoothTotalSpace;
+	Smoother smoothCompactionBytes;
 	limitReason_t limitReason;
 	std::vector<StorageQueuingMetricsReply::TagInfo> busiestReadTags, busiestWriteTags;
 
 	StorageQueueInfo(UID id, LocalityData locality);
 	void refreshCommitCost(double elapsed);
-	int64_t getStorageQueueBytes() const { return lastReply.bytesInput - smoothDurableBytes.smoothTotal(); }
+	// Backlog the storage server has staged in its spill queue no longer occupies memory, so it is discounted
+	// from the storage queue that drives write throttling
+	int64_t getStorageQueueBytes() const {
+		return std::max<int64_t>(
+		    0, lastReply.bytesInput - smoothDurableBytes.smoothTotal() - lastReply.bytesSpilled);
+	}
 	int64_t getDurabilityLag() const { return smoothLatestVersion.smoothTotal() - smoothDurableVersion.smoothTotal(); }
 	void update(StorageQueuingMetricsReply const&, Smoother& smoothTotalDurableBytes);
 	void addCommitCost(TransactionTagRef tagName, TransactionCommitCostEstimation const& cost);
@@ -0,0 +1,75 @@
+/*
+ *RedwoodCheckpointUtils.actor.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#if defined(NO_INTELLISENSE) && !defined(FDBSERVER_REDWOOD_CHECKPOINT_UTILS_ACTOR_G_H)
+#define FDBSERVER_REDWOOD_CHECKPOINT_UTILS_ACTOR_G_H
+#include "fdbserver/RedwoodCheckpointUtils.actor.g.h"
+#elif !defined(FDBSERVER_REDWOOD_CHECKPOINT_UTILS_ACTOR_H)
+#define FDBSERVER_REDWOOD_CHECKPOINT_UTILS_ACTOR_H
+
+#include "fdbclient/NativeAPI.actor.h"
+#include "fdbserver/ServerCheckpoint.actor.h"
+#include "flow/flow.h"
+
+#include "flow/actorcompiler.h" // has to be last include
+
+// Metadata of a Redwood checkpoint: a physical copy of the pager file taken at a commit
+// boundary, so that opening the copy recovers exactly the checkpoint's version. Shard
+// moves can therefore ship the file itself instead of iterating the key space.
+struct RedwoodCheckpoint {
+	constexpr static FileIdentifier file_identifier = 13804349;
+	std::string dir; // Directory currently holding the pager file copy.
+	std::string pagerFile; // Base name of the pager file within dir.
+	int64_t pagerFileSize = 0;
+	bool fetched = false; // Set once the copy has been fetched to a local directory.
+
+	CheckpointFormat format() const { return RedwoodV1; }
+
+	std::string toString() const {
+		return "RedwoodCheckpoint:\nDir: " + dir + "\nPager file: " + pagerFile +
+		       "\nSize: " + std::to_string(pagerFileSize) + "\nFetched: " + std::to_string(fetched) + "\n";
+	}
+
+	template <class Ar>
+	void serialize(Ar& ar) {
+		serializer(ar, dir, pagerFile, pagerFileSize, fetched);
+	}
+};
+
+ICheckpointReader* newRedwoodCheckpointReader(const CheckpointMetaData& checkpoint, UID logID);
+
+RedwoodCheckpoint getRedwoodCheckpoint(const CheckpointMetaData& checkpoint);
+
+// Fetch the pager file copy of a Redwood checkpoint to the local `dir`.
+// If cFun is provided, the fetch progress can be checkpointed, so that next time, the fetch
+// process can be continued, in case of crash.
+ACTOR Future<CheckpointMetaData> fetchRedwoodCheckpoint(Database cx,
+                                                        CheckpointMetaData initialState,
+                                                        std::string dir,
+                                                        std::function<Future<Void>(const CheckpointMetaData&)> cFun =
+                                                            nullptr);
+
+// Clean up on-disk files associated with a Redwood checkpoint.
+ACTOR Future<Void> deleteRedwoodCheckpoint(CheckpointMetaData checkpoint);
+
+#include "flow/unactorcompiler.h"
+
+#endif
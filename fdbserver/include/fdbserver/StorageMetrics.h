@@ -432,7 +432,9 @@ struct StorageServerMetrics {
 	                       StorageBytes sb,
 	                       double bytesInputRate,
 	                       int64_t versionLag,
-	                       double lastUpdate) const {
+	                       double lastUpdate,
+	                       double cpuUsage,
+	                       double diskUsage) const {
 		GetStorageMetricsReply rep;
 
 		// SOMEDAY: make bytes dynamic with hard disk space
@@ -462,6 +464,9 @@ struct StorageServerMetrics {
 		rep.versionLag = versionLag;
 		rep.lastUpdate = lastUpdate;
 
+		rep.cpuUsage = cpuUsage;
+		rep.diskUsage = diskUsage;
+
 		req.reply.send(rep);
 	}
 
@@ -612,3 +617,6 @@ struct ByteSampleInfo {
 // Determines whether a key-value pair should be included in a byte sample
 // Also returns size information about the sample
 ByteSampleInfo isKeyValueInSample(KeyValueRef keyValue);
+
+// Same as above given only the key and the total key-value size
+ByteSampleInfo isKeyValueInSample(KeyRef key, int64_t totalKvSize);
@@ -211,6 +211,10 @@ public:
 
 	double getLoadReadBandwidth(bool includeInFlight = true, double inflightPenalty = 1.0) const override;
 
+	// Dimensionless [0,1+] busyness of the team's most loaded axis (CPU, disk, read bandwidth, or
+	// space); used by load-aware destination team selection (DD_LOAD_AWARE_PLACEMENT)
+	double getLoadScore(bool includeInFlight = true, double inflightPenalty = 1.0) const;
+
 	int64_t getReadInFlightToTeam() const override;
 
 	int64_t getMinAvailableSpace(bool includeInFlight = true) const override;
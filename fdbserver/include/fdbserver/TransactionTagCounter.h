@@ -34,9 +34,18 @@ public:
 	// Update counters tracking the busyness of each tag in the current interval
 	void addRequest(Optional<TagSet> const& tags, int64_t bytes);
 
-	// Save current set of busy tags and reset counters for next interval
+	// Update the hot key index for a read of the given key
+	void addKeyRead(KeyRef key, int64_t bytes);
+
+	// Update the hot key index for a mutation to the given key
+	void addKeyWrite(KeyRef key, int64_t bytes);
+
+	// Save current set of busy tags and hot keys and reset counters for next interval
 	void startNewInterval();
 
 	// Returns the set of busiest tags as of the end of the last interval
 	std::vector<StorageQueuingMetricsReply::TagInfo> const& getBusiestTags() const;
+
+	// Returns the hottest keys (by combined read and write cost) as of the end of the last interval
+	Standalone<VectorRef<HotKeyWithMetrics>> const& getHotKeys() const;
 };
@@ -77,6 +77,22 @@ struct VFSAsyncFile {
 		return e || f;
 	}
 
+	// An "inline read" is a read-only SQLite operation executed directly on the network thread
+	// instead of on a reader coroutine, which is only safe if it never blocks.  While an inline
+	// read is active the VFS read methods fail instead of waiting when data is not already in the
+	// page cache, recording the miss here so that the caller can distinguish the failure from a
+	// real disk error and retry the operation on a reader thread.  Plain globals suffice because
+	// the network thread runs at most one inline read at a time and coroutines cannot run while
+	// one is active.
+	static bool inlineReadActive;
+	static bool inlineReadMissed;
+
+	static void beginInlineRead() {
+		inlineReadActive = true;
+		inlineReadMissed = false;
+	}
+	static void endInlineRead() { inlineReadActive = false; }
+
 	uint32_t* const pLockCount; // +1 for each SHARED_LOCK, or 1+X_COUNT for lock level X
 	int lockLevel; // NO_LOCK, SHARED_LOCK, RESERVED_LOCK, PENDING_LOCK, or EXCLUSIVE_LOCK
 
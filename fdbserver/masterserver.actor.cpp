@@ -252,6 +252,11 @@ void updateLiveCommittedVersion(Reference<MasterData> self, ReportRawCommittedVe
 			    SERVER_KNOBS->ENABLE_VERSION_VECTOR_HA_OPTIMIZATION ? self->locality : tagLocalityInvalid;
 			self->ssVersionVector.setVersion(req.writtenTags.get(), req.version, primaryLocality);
 			self->versionVectorTagUpdates.addMeasurement(req.writtenTags.get().size());
+			if (self->ssVersionVector.size() > SERVER_KNOBS->VERSION_VECTOR_MAX_SIZE) {
+				// Tags that have not committed within the MVCC window (e.g. were retired by role
+				// churn) fall back to maxVersion for readers; dropping them caps vector growth
+				self->ssVersionVector.compact(req.version - SERVER_KNOBS->MAX_READ_TRANSACTION_LIFE_VERSIONS);
+			}
 		}
 		auto curTime = now();
 		// add debug here to change liveCommittedVersion to time bound of now()
@@ -61,6 +61,7 @@
 #include "fdbserver/EncryptedMutationMessage.h"
 #include "fdbserver/FDBExecHelper.actor.h"
 #include "fdbserver/GetEncryptCipherKeys.h"
+#include "fdbserver/IDiskQueue.h"
 #include "fdbserver/IKeyValueStore.h"
 #include "fdbserver/Knobs.h"
 #include "fdbserver/LatencyBandConfig.h"
@@ -68,6 +69,7 @@
 #include "fdbserver/LogSystem.h"
 #include "fdbserver/MoveKeys.actor.h"
 #include "fdbserver/MutationTracking.h"
+#include "fdbserver/PriorityMultiLock.actor.h"
 #include "fdbserver/OTELSpanContextMessage.h"
 #include "fdbserver/RecoveryState.h"
 #include "fdbserver/RocksDBCheckpointUtils.actor.h"
@@ -100,6 +102,10 @@
 
 #define SHORT_CIRCUT_ACTUAL_STORAGE 0
 
+// Priorities for the storage server read concurrency lock, higher priorities are granted first
+static constexpr int SS_READ_PRIORITY_RANGE = 0;
+static constexpr int SS_READ_PRIORITY_POINT = 1;
+
 namespace {
 bool canReplyWith(Error e) {
 	switch (e.code()) {
@@ -192,6 +198,13 @@ struct AddingShard : NonCopyable {
 	// completes.
 	std::deque<Standalone<VerUpdateRef>> updates;
 
+	// All keys strictly less than fetchedHighWatermark have been fetched (at fetchVersion) and written to the storage
+	// engine. fetchedDurableWatermark additionally requires that those writes have been committed, so they are
+	// readable from the storage engine regardless of whether the engine allows reads to see uncommitted writes.
+	// Point reads over the fetched, durable prefix can be served during the Fetching phase.
+	Key fetchedHighWatermark;
+	Key fetchedDurableWatermark;
+
 	struct StorageServer* server;
 	Version transferredVersion;
 	Version fetchVersion;
@@ -217,8 +230,9 @@ struct AddingShard : NonCopyable {
 
 	// When fetchKeys "partially completes" (splits an adding shard in two), this is used to construct the left half
 	AddingShard(AddingShard* prev, KeyRange const& keys)
-	  : keys(keys), fetchClient(prev->fetchClient), server(prev->server), transferredVersion(prev->transferredVersion),
-	    fetchVersion(prev->fetchVersion), phase(prev->phase) {}
+	  : keys(keys), fetchClient(prev->fetchClient), fetchedHighWatermark(prev->fetchedHighWatermark),
+	    fetchedDurableWatermark(prev->fetchedDurableWatermark), server(prev->server),
+	    transferredVersion(prev->transferredVersion), fetchVersion(prev->fetchVersion), phase(prev->phase) {}
 	~AddingShard() {
 		if (!fetchComplete.isSet())
 			fetchComplete.send(Void());
@@ -399,6 +413,12 @@ struct StorageServerDisk {
 		++(*kvGets);
 		return storage->readValuePrefix(key, maxLength, type, debugID);
 	}
+	Future<std::vector<Optional<Value>>> readValues(VectorRef<KeyRef> keys,
+	                                                IKeyValueStore::ReadType type = IKeyValueStore::ReadType::NORMAL,
+	                                                Optional<UID> debugID = Optional<UID>()) {
+		*kvGets += keys.size();
+		return storage->readValues(keys, type, debugID);
+	}
 	Future<RangeResult> readRange(KeyRangeRef keys,
 	                              int rowLimit = 1 << 30,
 	                              int byteLimit = 1 << 30,
@@ -417,6 +437,7 @@ struct StorageServerDisk {
 
 	KeyValueStoreType getKeyValueStoreType() const { return storage->getType(); }
 	StorageBytes getStorageBytes() const { return storage->getStorageBytes(); }
+	IKeyValueStore::CompactionDebt getCompactionDebt() const { return storage->getCompactionDebt(); }
 	std::tuple<size_t, size_t, size_t> getSize() const { return storage->getSize(); }
 
 	// The following are pointers to the Counters in StorageServer::counters of the same names.
@@ -449,20 +470,34 @@ struct UpdateEagerReadInfo {
 
 	Arena arena;
 
+	// Ranges cleared by mutations earlier in the batch, coalesced. An eager value read for an atomic op on a
+	// covered key can be elided because conversion will find the clear (or a newer set) in the versioned map
+	// and never consult the eager result. A clear expansion probe that lands in a covered range can alias to
+	// the covering range's own probe: every durable key in between is deleted before the probing clear
+	// applies, and keys set in between by this batch are bounded out by the versioned map during expansion.
+	std::map<KeyRef, KeyRef> clearedRanges;
+	std::map<KeyRef, KeyRef> keyBeginAlias;
+
 	void addMutations(VectorRef<MutationRef> const& mutations) {
 		for (auto& m : mutations)
 			addMutation(m);
 	}
 
+	// Fetch-injected mutations are collected after, but applied before, the mutations from the log cursor, so
+	// clears from the cursor must not elide their reads
+	void beginFetchInjectedMutations() { clearedRanges.clear(); }
+
 	void addMutation(MutationRef const& m) {
-		// SOMEDAY: Theoretically we can avoid a read if there is an earlier overlapping ClearRange
 		if (m.type == MutationRef::ClearRange && !m.param2.startsWith(systemKeys.end) &&
-		    SERVER_KNOBS->ENABLE_CLEAR_RANGE_EAGER_READS)
-			keyBegin.push_back(m.param2);
-		else if (m.type == MutationRef::CompareAndClear) {
+		    SERVER_KNOBS->ENABLE_CLEAR_RANGE_EAGER_READS) {
+			addKeyBeginProbe(m.param2);
+			addClearedRange(m.param1, m.param2);
+		} else if (m.type == MutationRef::CompareAndClear) {
 			if (SERVER_KNOBS->ENABLE_CLEAR_RANGE_EAGER_READS)
-				keyBegin.push_back(keyAfter(m.param1, arena));
-			if (keys.size() > 0 && keys.back().first == m.param1) {
+				addKeyBeginProbe(keyAfter(m.param1, arena));
+			if (coveringClearEnd(m.param1).size()) {
+				CODE_PROBE(true, "Eager value read elided by earlier batch clear");
+			} else if (keys.size() > 0 && keys.back().first == m.param1) {
 				// Don't issue a second read, if the last read was equal to the current key.
 				// CompareAndClear is likely to be used after another atomic operation on same key.
 				keys.back().second = std::max(keys.back().second, m.param2.size() + 1);
@@ -470,10 +505,63 @@ struct UpdateEagerReadInfo {
 				keys.emplace_back(m.param1, m.param2.size() + 1);
 			}
 		} else if ((m.type == MutationRef::AppendIfFits) || (m.type == MutationRef::ByteMin) ||
-		           (m.type == MutationRef::ByteMax))
-			keys.emplace_back(m.param1, CLIENT_KNOBS->VALUE_SIZE_LIMIT);
-		else if (isAtomicOp((MutationRef::Type)m.type))
-			keys.emplace_back(m.param1, m.param2.size());
+		           (m.type == MutationRef::ByteMax)) {
+			if (coveringClearEnd(m.param1).size()) {
+				CODE_PROBE(true, "Eager value read elided by earlier batch clear");
+			} else {
+				keys.emplace_back(m.param1, CLIENT_KNOBS->VALUE_SIZE_LIMIT);
+			}
+		} else if (isAtomicOp((MutationRef::Type)m.type)) {
+			if (coveringClearEnd(m.param1).size()) {
+				CODE_PROBE(true, "Eager value read elided by earlier batch clear");
+			} else {
+				keys.emplace_back(m.param1, m.param2.size());
+			}
+		}
+	}
+
+	// Registers a clear expansion probe at key, or aliases it to an earlier covering probe
+	void addKeyBeginProbe(KeyRef key) {
+		KeyRef covered = coveringClearEnd(key);
+		if (covered.size()) {
+			CODE_PROBE(true, "Eager read probe elided by earlier batch clear");
+			keyBeginAlias[key] = covered;
+		} else {
+			// Shadow any alias left from before beginFetchInjectedMutations() reset the coverage: the aliased
+			// probe is only valid for clears that apply after the clears that justified the alias, and
+			// fetch-injected mutations apply before the cursor's. The un-aliased probe is always sound;
+			// under-expansion is merely conservative.
+			keyBeginAlias.erase(key);
+			keyBegin.push_back(key);
+		}
+	}
+
+	// Returns the end of the coalesced range of earlier clears containing key, or KeyRef() if none
+	KeyRef coveringClearEnd(KeyRef key) const {
+		auto it = clearedRanges.upper_bound(key);
+		if (it != clearedRanges.begin()) {
+			--it;
+			if (key < it->second)
+				return it->second;
+		}
+		return KeyRef();
+	}
+
+	void addClearedRange(KeyRef begin, KeyRef end) {
+		auto it = clearedRanges.upper_bound(begin);
+		if (it != clearedRanges.begin()) {
+			auto prev = std::prev(it);
+			if (prev->second >= begin) {
+				begin = prev->first;
+				end = std::max(end, prev->second);
+				it = clearedRanges.erase(prev);
+			}
+		}
+		while (it != clearedRanges.end() && it->first <= end) {
+			end = std::max(end, it->second);
+			it = clearedRanges.erase(it);
+		}
+		clearedRanges[begin] = end;
 	}
 
 	void finishKeyBegin() {
@@ -506,6 +594,13 @@ struct UpdateEagerReadInfo {
 	}
 
 	KeyRef getKeyEnd(KeyRef key) {
+		// Resolve elided probes to the probe they alias; each alias points to a strictly larger key, so the
+		// chain terminates
+		auto alias = keyBeginAlias.find(key);
+		while (alias != keyBeginAlias.end()) {
+			key = alias->second;
+			alias = keyBeginAlias.find(key);
+		}
 		int i = std::lower_bound(keyBegin.begin(), keyBegin.end(), key) - keyBegin.begin();
 		ASSERT(i < keyBegin.size() && keyBegin[i] == key);
 		return keyEnd[i];
@@ -603,6 +698,19 @@ struct ChangeFeedInfo : ReferenceCounted<ChangeFeedInfo> {
 		}
 		return false;
 	}
+
+	// An in-flight read of this feed's durable mutations that concurrent listening streams can share, so that
+	// fanning the same batch out to N streams costs one disk read and one decoded copy of the bytes. A stream
+	// may only join a read if the feed's durable and empty versions still match the values captured when the
+	// read was issued; otherwise the snapshot could be missing mutations the joining stream has already
+	// trimmed from its view of the memory deque.
+	struct SharedDiskRead {
+		Version durableVersion;
+		Version emptyVersion;
+		int byteLimit;
+		Future<RangeResult> result;
+	};
+	std::map<std::pair<Version, Version>, SharedDiskRead> inflightDiskReads;
 };
 
 class ServerWatchMetadata : public ReferenceCounted<ServerWatchMetadata> {
@@ -619,6 +727,137 @@ public:
 	  : key(key), value(value), version(version), tags(tags), debugID(debugID) {}
 };
 
+// Attributes read latency band measurements to the shard that served them, so that when the role-level read
+// latency bands in status degrade, the key ranges responsible can be identified without packet tracing.
+// Measurements are only recorded while a latency band configuration is set, counts are kept per shard for one
+// logging interval, and only the busiest LATENCY_BAND_RANGES_LOGGED ranges are published.
+struct ReadRangeLatencyBands {
+	struct RangeCounts {
+		KeyRange range;
+		int64_t count = 0;
+		int64_t filtered = 0;
+		// One bucket per threshold plus a final overflow bucket, matching the LatencyBands scheme where each
+		// measurement is counted in the first band whose threshold exceeds it
+		std::vector<int64_t> bands;
+	};
+
+	std::vector<double> thresholds;
+	std::map<Key, RangeCounts> ranges;
+
+	void addThreshold(double value) {
+		if (value > 0 && !std::count(thresholds.begin(), thresholds.end(), value)) {
+			thresholds.push_back(value);
+			std::sort(thresholds.begin(), thresholds.end());
+			ranges.clear();
+		}
+	}
+
+	void clearBands() {
+		thresholds.clear();
+		ranges.clear();
+	}
+
+	void addMeasurement(KeyRangeRef shard, double measurement, bool filtered) {
+		if (thresholds.empty()) {
+			return;
+		}
+		auto itr = ranges.find(shard.begin);
+		if (itr == ranges.end()) {
+			if (ranges.size() >= SERVER_KNOBS->LATENCY_BAND_RANGES_TRACKED) {
+				return;
+			}
+			itr = ranges.emplace(shard.begin, RangeCounts()).first;
+			itr->second.range = shard;
+			itr->second.bands.resize(thresholds.size() + 1, 0);
+		}
+		RangeCounts& entry = itr->second;
+		entry.count++;
+		if (filtered) {
+			entry.filtered++;
+		} else {
+			entry.bands[std::upper_bound(thresholds.begin(), thresholds.end(), measurement) - thresholds.begin()]++;
+		}
+	}
+
+	// Logs the busiest ranges of the last interval as a single event (so status can fetch the latest one) and
+	// starts a new interval
+	void log(UID thisServerID) {
+		if (!ranges.empty()) {
+			std::vector<const RangeCounts*> busiest;
+			busiest.reserve(ranges.size());
+			for (auto const& [begin, entry] : ranges) {
+				busiest.push_back(&entry);
+			}
+			int logged = std::min<int>(busiest.size(), SERVER_KNOBS->LATENCY_BAND_RANGES_LOGGED);
+			std::partial_sort(busiest.begin(),
+			                  busiest.begin() + logged,
+			                  busiest.end(),
+			                  [](const RangeCounts* a, const RangeCounts* b) { return a->count > b->count; });
+
+			TraceEvent ev("ReadLatencyBandsByRange", thisServerID);
+			ev.detail("Ranges", logged);
+			ev.detail("TrackedRanges", ranges.size());
+			for (int i = 0; i < logged; i++) {
+				std::string bands;
+				for (int b = 0; b < busiest[i]->bands.size(); b++) {
+					if (b) {
+						bands += ',';
+					}
+					bands += b < thresholds.size() ? format("%g", thresholds[b]) : std::string("inf");
+					bands += format(":%" PRId64, busiest[i]->bands[b]);
+				}
+				ev.detail(format("Range%dBegin", i), busiest[i]->range.begin);
+				ev.detail(format("Range%dEnd", i), busiest[i]->range.end);
+				ev.detail(format("Range%dCount", i), busiest[i]->count);
+				ev.detail(format("Range%dFiltered", i), busiest[i]->filtered);
+				ev.detail(format("Range%dBands", i), bands);
+			}
+			ranges.clear();
+		}
+	}
+};
+
+// The storage server probes its watch set for every mutation it applies, and almost no mutations touch a
+// watched key. WatchKeyMap keeps a hashed overlay of the watched keys next to the base class's
+// boundary-sorted map: point triggers answer the overwhelmingly common no-watch case with a single hash
+// lookup instead of an ordered-map search over every watched key, and range triggers skip the ordered walk
+// entirely when nothing is watched. The overlay is a superset of the watched keys (a key whose last waiter
+// was cancelled keeps its entry until the next point trigger on it), so an overlay miss always means there
+// is nothing to trigger. Only onChange(), trigger() and triggerRange() maintain the overlay; the AsyncMap
+// setters must not be used through this type.
+class WatchKeyMap : public AsyncMap<Key, bool> {
+public:
+	Future<Void> onChange(Key const& key) override {
+		if (!items.count(key)) {
+			watchedKeys.insert(key);
+		}
+		return AsyncMap<Key, bool>::onChange(key);
+	}
+
+	void trigger(KeyRef const& keyRef) {
+		Key key(keyRef);
+		auto it = watchedKeys.find(key);
+		if (it == watchedKeys.end()) {
+			return;
+		}
+		// Drop the overlay entry before firing; any waiter that re-registers puts it back through onChange.
+		// Until then the overlay and the underlying map agree that the key is not watched.
+		watchedKeys.erase(it);
+		AsyncMap<Key, bool>::trigger(key);
+	}
+
+	void triggerRange(KeyRef const& begin, KeyRef const& end) {
+		if (watchedKeys.empty()) {
+			return;
+		}
+		// Range triggers do not remove map entries, so the overlay stays as is
+		AsyncMap<Key, bool>::triggerRange(Key(begin), Key(end));
+	}
+
+private:
+	std::unordered_set<Key> watchedKeys;
+};
+
 struct StorageServer {
 	typedef VersionedMap<KeyRef, ValueOrClearToRef> VersionedData;
 
@@ -811,10 +1050,17 @@ public:
 	    Version ver,
 	    MutationRef m); // Appends m to mutationLog@ver, or to storage if ver==invalidVersion
 
-	// Update the byteSample, and write the updates to the mutation log@ver, or to storage if ver==invalidVersion
+	// Update the byteSample, and write the updates to the mutation log@ver, or to storage if ver==invalidVersion.
+	// The apply methods only append to byteSampleOps; byteSampleFold() folds the buffered ops, in order, into
+	// byteSample and the persistent byte-sample keyspace, so the ingest path does not pay per-mutation sample
+	// map churn. updateStorage folds ahead of each commit so sample mutations land in the same commit as the
+	// data they describe.
 	void byteSampleApplyMutation(MutationRef const& m, Version ver);
 	void byteSampleApplySet(KeyValueRef kv, Version ver);
 	void byteSampleApplyClear(KeyRangeRef range, Version ver);
+	void byteSampleFold();
+	void byteSampleFoldSet(KeyRef key, int64_t size, Version ver);
+	void byteSampleFoldClear(KeyRangeRef range, Version ver);
 
 	void popVersion(Version v, bool popAllTags = false) {
 		if (logSystem && !isTss()) {
@@ -966,9 +1212,39 @@ public:
 	CoalescedKeyRangeMap<bool, int64_t, KeyBytesMetric<int64_t>> byteSampleClears;
 	AsyncVar<bool> byteSampleClearsTooLarge;
 	Future<Void> byteSampleRecovery;
+
+	// A deferred byte-sample operation; see byteSampleFold()
+	struct ByteSampleOp {
+		Version version; // version for the persistent mutation, or invalidVersion to write storage directly
+		KeyRef key; // the set key, or the clear range begin
+		KeyRef end; // the clear range end, or empty for a set
+		int64_t size; // key+value size of a set, used to re-derive sample membership when folding
+		bool isClear;
+	};
+	Arena byteSampleOpsArena;
+	std::vector<ByteSampleOp> byteSampleOps;
+	bool byteSampleFolding;
+
 	Future<Void> durableInProgress;
 
-	AsyncMap<Key, bool> watches;
+	// Number of storage engine commits that have completed (as opposed to counters.kvCommits, which counts commits
+	// issued). fetchKeys uses this to decide when fetched blocks written to storage are durably committed, and
+	// therefore readable from the storage engine regardless of the engine's uncommitted-read behavior.
+	int64_t storageCommitsCompleted = 0;
+
+	// Optional disk-backed staging area for the mutation backlog (see spillMutationLog() and
+	// unspillMutationLog()). Opened lazily the first time the in-memory backlog crosses
+	// STORAGE_SPILL_QUEUE_THRESHOLD_BYTES; its contents are redundant with the tlogs and are discarded on restart.
+	IDiskQueue* spillQueue = nullptr;
+	struct SpilledVersionInfo {
+		IDiskQueue::location start, end; // where the serialized VerUpdateRef lives in spillQueue
+		int64_t bytes; // MVCC byte accounting of the spilled mutations, matching bytesInput/bytesDurable
+	};
+	std::map<Version, SpilledVersionInfo> spilledVersions; // mutationLog entries currently staged on disk
+	int64_t spilledBytes = 0; // sum of spilledVersions bytes
+	Future<Void> spillInProgress = Void();
+
+	WatchKeyMap watches;
 	int64_t watchBytes;
 	int64_t numWatches;
 	AsyncVar<bool> noRecentUpdates;
@@ -985,12 +1261,28 @@ public:
 	// feed tail fetching
 	FlowLock fetchKeysParallelismFullLock;
 	FlowLock fetchChangeFeedParallelismLock;
+	// Bounds the number of change feed streams concurrently reading their catch-up data from the storage engine
+	FlowLock changeFeedDiskReadsLock;
 	int64_t fetchKeysBytesBudget;
 	AsyncVar<bool> fetchKeysBudgetUsed;
 	std::vector<Promise<FetchInjectionInfo*>> readyFetchKeys;
 
 	FlowLock serveFetchCheckpointParallelismLock;
 
+	// Bounds how many reads run their storage-engine stage at once so that CPU heavy range reads
+	// cannot starve latency sensitive point reads; point reads are granted slots first.
+	PriorityMultiLock readLock;
+
+	// Disk-local feedback between foreground reads and updateStorage commits: read completions feed a
+	// smoothed latency estimate, and updateStorage scales its commit byte budget down (to at most
+	// commitPacingFactor of STORAGE_COMMIT_BYTES) while the estimate exceeds the target, so large commit
+	// batches leave the disk headroom to serve reads. readTimeSeconds/commitTimeSeconds attribute
+	// wall-clock time to the two classes for observability.
+	Smoother smoothReadLatency;
+	double commitPacingFactor = 1.0;
+	double readTimeSeconds = 0;
+	double commitTimeSeconds = 0;
+
 	int64_t instanceID;
 
 	Promise<Void> otherError;
@@ -1019,16 +1311,18 @@ public:
 	TransactionTagCounter transactionTagCounter;
 
 	Optional<LatencyBandConfig> latencyBandConfig;
+	ReadRangeLatencyBands readRangeLatencyBands;
 
 	struct Counters {
 		CounterCollection cc;
-		Counter allQueries, getKeyQueries, getValueQueries, getRangeQueries, getMappedRangeQueries,
-		    getRangeStreamQueries, finishedQueries, lowPriorityQueries, rowsQueried, bytesQueried, watchQueries,
-		    emptyQueries, feedRowsQueried, feedBytesQueried, feedStreamQueries, feedVersionQueries;
+		Counter allQueries, getKeyQueries, getMultipleKeysQueries, getValueQueries, getMultipleValuesQueries,
+		    getRangeQueries, getMappedRangeQueries, getRangeStreamQueries, finishedQueries, lowPriorityQueries,
+		    rowsQueried, bytesQueried, watchQueries, emptyQueries, feedRowsQueried, feedBytesQueried,
+		    feedStreamQueries, feedVersionQueries;
 
 		// Bytes of the mutations that have been added to the memory of the storage server. When the data is durable
 		// and cleared from the memory, we do not subtract it but add it to bytesDurable.
-		Counter bytesInput;
+		AtomicCounter bytesInput;
 		// Bytes pulled from TLogs, it counts the size of the key value pairs, e.g., key-value pair ("a", "b") is
 		// counted as 2 Bytes.
 		Counter logicalBytesInput;
@@ -1046,12 +1340,15 @@ public:
 		// bytesInput, instead of the actual bytes taken in the storages, so that (bytesInput - bytesDurable) can
 		// reflect the current memory footprint of MVCC.
 		Counter bytesDurable;
+		// Bytes of mutation backlog staged to (and restored from) the spill queue. The counting is the same as
+		// bytesInput, so BytesSpilled - BytesUnspilled is the portion of the queue that is not in memory.
+		Counter bytesSpilled, bytesUnspilled;
 		// Bytes fetched by fetchKeys() for data movements. The size is counted as a collection of KeyValueRef.
 		Counter bytesFetched;
 		// Like bytesInput but without MVCC accounting. The size is counted as how much it takes when serialized. It
 		// is basically the size of both parameters of the mutation and a 12 bytes overhead that keeps mutation type
 		// and the lengths of both parameters.
-		Counter mutationBytes;
+		AtomicCounter mutationBytes;
 
 		// Bytes fetched by fetchChangeFeed for data movements.
 		Counter feedBytesFetched;
@@ -1059,8 +1356,8 @@ public:
 		Counter sampledBytesCleared;
 		// The number of key-value pairs fetched by fetchKeys()
 		Counter kvFetched;
-		Counter mutations, setMutations, clearRangeMutations, atomicMutations, changeFeedMutations,
-		    changeFeedMutationsDurable;
+		AtomicCounter mutations, setMutations, clearRangeMutations, atomicMutations, changeFeedMutations;
+		Counter changeFeedMutationsDurable;
 		Counter updateBatches, updateVersions;
 		Counter loops;
 		Counter fetchWaitingMS, fetchWaitingCount, fetchExecutingMS, fetchExecutingCount;
@@ -1087,6 +1384,7 @@ public:
 		Counter kvCommits;
 		// The count of change feed reads that hit disk
 		Counter changeFeedDiskReads;
+	Counter changeFeedSharedDiskReads;
 
 		LatencySample readLatencySample;
 		LatencyBands readLatencyBands;
@@ -1096,7 +1394,8 @@ public:
 
 		Counters(StorageServer* self)
 		  : cc("StorageServer", self->thisServerID.toString()), allQueries("QueryQueue", cc),
-		    getKeyQueries("GetKeyQueries", cc), getValueQueries("GetValueQueries", cc),
+		    getKeyQueries("GetKeyQueries", cc), getMultipleKeysQueries("GetMultipleKeysQueries", cc),
+		    getValueQueries("GetValueQueries", cc), getMultipleValuesQueries("GetMultipleValuesQueries", cc),
 		    getRangeQueries("GetRangeQueries", cc), getMappedRangeQueries("GetMappedRangeQueries", cc),
 		    getRangeStreamQueries("GetRangeStreamQueries", cc), finishedQueries("FinishedQueries", cc),
 		    lowPriorityQueries("LowPriorityQueries", cc), rowsQueried("RowsQueried", cc),
@@ -1107,6 +1406,7 @@ public:
 		    logicalBytesMoveInOverhead("LogicalBytesMoveInOverhead", cc),
 		    kvCommitLogicalBytes("KVCommitLogicalBytes", cc), kvClearRanges("KVClearRanges", cc),
 		    kvSystemClearRanges("KVSystemClearRanges", cc), bytesDurable("BytesDurable", cc),
+		    bytesSpilled("BytesSpilled", cc), bytesUnspilled("BytesUnspilled", cc),
 		    bytesFetched("BytesFetched", cc), mutationBytes("MutationBytes", cc),
 		    feedBytesFetched("FeedBytesFetched", cc), sampledBytesCleared("SampledBytesCleared", cc),
 		    kvFetched("KVFetched", cc), mutations("Mutations", cc), setMutations("SetMutations", cc),
@@ -1122,6 +1422,7 @@ public:
 		    quickGetKeyValuesMiss("QuickGetKeyValuesMiss", cc), kvScanBytes("KVScanBytes", cc),
 		    kvGetBytes("KVGetBytes", cc), eagerReadsKeys("EagerReadsKeys", cc), kvGets("KVGets", cc),
 		    kvScans("KVScans", cc), kvCommits("KVCommits", cc), changeFeedDiskReads("ChangeFeedDiskReads", cc),
+	    changeFeedSharedDiskReads("ChangeFeedSharedDiskReads", cc),
 		    readLatencySample("ReadLatencyMetrics",
 		                      self->thisServerID,
 		                      SERVER_KNOBS->LATENCY_METRICS_LOGGING_INTERVAL,
@@ -1146,6 +1447,10 @@ public:
 			specialCounter(cc, "DesiredOldestVersion", [self]() { return self->desiredOldestVersion.get(); });
 			specialCounter(cc, "VersionLag", [self]() { return self->versionLag; });
 			specialCounter(cc, "LocalRate", [self] { return int64_t(self->currentRate() * 100); });
+			specialCounter(cc, "CommitPacingFactor", [self]() { return int64_t(self->commitPacingFactor * 100); });
+			specialCounter(cc, "ReadDiskTimeUS", [self]() { return int64_t(self->readTimeSeconds * 1e6); });
+			specialCounter(cc, "CommitDiskTimeUS", [self]() { return int64_t(self->commitTimeSeconds * 1e6); });
+			specialCounter(cc, "BytesInSpillQueue", [self]() { return self->spilledBytes; });
 
 			specialCounter(cc, "BytesReadSampleCount", [self]() { return self->metrics.bytesReadSample.queue.size(); });
 			specialCounter(
@@ -1161,6 +1466,10 @@ public:
 			});
 			specialCounter(
 			    cc, "FetchChangeFeedWaiting", [self]() { return self->fetchChangeFeedParallelismLock.waiters(); });
+			specialCounter(
+			    cc, "ChangeFeedDiskReadsActive", [self]() { return self->changeFeedDiskReadsLock.activePermits(); });
+			specialCounter(
+			    cc, "ChangeFeedDiskReadsWaiting", [self]() { return self->changeFeedDiskReadsLock.waiters(); });
 			specialCounter(cc, "ServeFetchCheckpointActive", [self]() {
 				return self->serveFetchCheckpointParallelismLock.activePermits();
 			});
@@ -1216,13 +1525,17 @@ public:
 	    prevVersion(0), rebootAfterDurableVersion(std::numeric_limits<Version>::max()),
 	    primaryLocality(tagLocalityInvalid), knownCommittedVersion(0), versionLag(0), logProtocol(0),
 	    thisServerID(ssi.id()), tssInQuarantine(false), db(db), actors(false),
-	    byteSampleClears(false, LiteralStringRef("\xff\xff\xff")), durableInProgress(Void()), watchBytes(0),
+	    byteSampleClears(false, LiteralStringRef("\xff\xff\xff")), byteSampleFolding(false), durableInProgress(Void()),
+	    watchBytes(0),
 	    numWatches(0), noRecentUpdates(false), lastUpdate(now()), updateEagerReads(nullptr),
 	    fetchKeysParallelismLock(SERVER_KNOBS->FETCH_KEYS_PARALLELISM),
 	    fetchKeysParallelismFullLock(SERVER_KNOBS->FETCH_KEYS_PARALLELISM_FULL),
 	    fetchChangeFeedParallelismLock(SERVER_KNOBS->FETCH_KEYS_PARALLELISM),
+	    changeFeedDiskReadsLock(SERVER_KNOBS->CHANGE_FEED_DISK_READS_PARALLELISM),
 	    fetchKeysBytesBudget(SERVER_KNOBS->STORAGE_FETCH_BYTES), fetchKeysBudgetUsed(false),
 	    serveFetchCheckpointParallelismLock(SERVER_KNOBS->SERVE_FETCH_CHECKPOINT_PARALLELISM),
+	    readLock(SERVER_KNOBS->STORAGESERVER_READ_CONCURRENCY, SS_READ_PRIORITY_POINT),
+	    smoothReadLatency(SERVER_KNOBS->STORAGE_COMMIT_PACING_LATENCY_EFOLD),
 	    instanceID(deterministicRandom()->randomUniqueID().first()), shuttingDown(false), behind(false),
 	    versionBehind(false), debug_inApplyUpdate(false), debug_lastValidateTime(0), lastBytesInputEBrake(0),
 	    lastDurableVersionEBrake(0), maxQueryQueue(0), transactionTagCounter(ssi.id()), counters(this),
@@ -1253,6 +1566,14 @@ public:
 
 	//~StorageServer() { fclose(log); }
 
+	~StorageServer() {
+		// The spill queue's contents are redundant with the tlogs, so its files can be deleted whenever this
+		// storage server stops (cleanly or otherwise)
+		if (spillQueue) {
+			spillQueue->dispose();
+		}
+	}
+
 	// Puts the given shard into shards.  The caller is responsible for adding shards
 	//   for all ranges in shards.getAffectedRangesAfterInsertion(newShard->keys)), because these
 	//   shards are invalidated by the call.
@@ -1761,6 +2082,112 @@ std::vector<StorageServerShard> StorageServer::getStorageServerShards(KeyRangeRe
 	return res;
 }
 
+// Serves a point read over the already-fetched, durably committed prefix of an adding shard that is still in the
+// Fetching phase. The fetched base value (at the shard's fetchVersion) is read from the storage engine, and the
+// mutations buffered in AddingShard::updates with versions after fetchVersion and up to the read version are
+// replayed on top of it. The
+// caller must have verified that key < fetchedDurableWatermark and version >= fetchVersion.
+ACTOR Future<Optional<Value>> getValueFromAddingShard(StorageServer* data,
+                                                      Key key,
+                                                      Version version,
+                                                      uint64_t changeCounter,
+                                                      Optional<UID> debugID) {
+	// Capture the buffered mutations affecting this key before reading storage; the AddingShard may buffer more
+	// updates or be replaced entirely while the read is outstanding
+	state Standalone<VectorRef<MutationRef>> updates;
+	AddingShard* shard = data->shards[key]->adding.get();
+	state Version shardFetchVersion = shard->fetchVersion;
+	for (const auto& vu : shard->updates) {
+		if (vu.version > version)
+			break;
+		for (const auto& m : vu.mutations) {
+			if (m.type == MutationRef::ClearRange ? (m.param1 <= key && key < m.param2) : m.param1 == key) {
+				updates.push_back_deep(updates.arena(), m);
+			}
+		}
+	}
+
+	state Optional<Value> v = wait(data->storage.readValue(key, IKeyValueStore::ReadType::NORMAL, debugID));
+	data->counters.kvGetBytes += v.expectedSize();
+
+	// Validate that while we were reading the data we didn't lose the version or the shard.  If the shard has
+	// advanced past the Fetching phase, the buffered updates we captured have been (or are being) injected into the
+	// version data, so replaying our copy on top of storage could double apply them; make the client retry instead.
+	if (version < data->storageVersion()) {
+		CODE_PROBE(true, "transaction_too_old after fetched-prefix readValue");
+		throw transaction_too_old();
+	}
+	data->checkChangeCounter(changeCounter, key);
+	auto& shardInfo = data->shards[key];
+	if (!shardInfo->adding || shardInfo->adding->phase != AddingShard::Fetching) {
+		CODE_PROBE(true, "Adding shard advanced past Fetching during a fetched-prefix read");
+		throw wrong_shard_server();
+	}
+	// A fetch retry leaves the shard in the Fetching phase but re-picks fetchVersion, pops buffered updates, and
+	// resets the watermarks, so the base value just read may be from the aborted attempt and the captured updates
+	// may already be reflected in its replacement. Neither the phase nor the change counter detects this.
+	if (shardInfo->adding->fetchVersion != shardFetchVersion || !(key < shardInfo->adding->fetchedDurableWatermark)) {
+		CODE_PROBE(true, "Fetch restarted during a fetched-prefix read");
+		throw wrong_shard_server();
+	}
+
+	// Replay the buffered mutations on top of the fetched base value, in version order
+	Arena replayArena;
+	for (const auto& m : updates) {
+		Optional<StringRef> oldVal;
+		if (v.present())
+			oldVal = v.get();
+		switch (m.type) {
+		case MutationRef::SetValue:
+			v = Value(m.param2);
+			break;
+		case MutationRef::ClearRange:
+			v = Optional<Value>();
+			break;
+		case MutationRef::AddValue:
+			v = Value(doLittleEndianAdd(oldVal, m.param2, replayArena));
+			break;
+		case MutationRef::And:
+			v = Value(doAnd(oldVal, m.param2, replayArena));
+			break;
+		case MutationRef::Or:
+			v = Value(doOr(oldVal, m.param2, replayArena));
+			break;
+		case MutationRef::Xor:
+			v = Value(doXor(oldVal, m.param2, replayArena));
+			break;
+		case MutationRef::AppendIfFits:
+			v = Value(doAppendIfFits(oldVal, m.param2, replayArena));
+			break;
+		case MutationRef::Max:
+			v = Value(doMax(oldVal, m.param2, replayArena));
+			break;
+		case MutationRef::Min:
+			v = Value(doMin(oldVal, m.param2, replayArena));
+			break;
+		case MutationRef::ByteMin:
+			v = Value(doByteMin(oldVal, m.param2, replayArena));
+			break;
+		case MutationRef::ByteMax:
+			v = Value(doByteMax(oldVal, m.param2, replayArena));
+			break;
+		case MutationRef::MinV2:
+			v = Value(doMinV2(oldVal, m.param2, replayArena));
+			break;
+		case MutationRef::AndV2:
+			v = Value(doAndV2(oldVal, m.param2, replayArena));
+			break;
+		case MutationRef::CompareAndClear:
+			if (oldVal.present() && m.param2 == oldVal.get())
+				v = Optional<Value>();
+			break;
+		default:
+			ASSERT(false);
+		}
+	}
+	return v;
+}
+
 ACTOR Future<Void> getValueQ(StorageServer* data, GetValueRequest req) {
 	state int64_t resultSize = 0;
 	Span span("SS:getValue"_loc, req.spanContext);
@@ -1794,33 +2221,57 @@ ACTOR Future<Void> getValueQ(StorageServer* data, GetValueRequest req) {
 			                      req.debugID.get().first(),
 			                      "getValueQ.AfterVersion"); //.detail("TaskID", g_network->getCurrentTask());
 
+		// The version is readable, so take a read slot for the execution stage before checking
+		// shard membership and reading
+		state PriorityMultiLock::Lock readLock = wait(data->readLock.lock(SS_READ_PRIORITY_POINT));
+
 		Optional<TenantMapEntry> entry = data->getTenantEntry(version, req.tenantInfo);
 		if (entry.present()) {
 			req.key = req.key.withPrefix(entry.get().prefix);
 		}
 		state uint64_t changeCounter = data->shardChangeCounter;
 
-		if (!data->shards[req.key]->isReadable()) {
-			//TraceEvent("WrongShardServer", data->thisServerID).detail("Key", req.key).detail("Version", version).detail("In", "getValueQ");
-			throw wrong_shard_server();
-		}
-
 		state int path = 0;
-		auto i = data->data().at(version).lastLessOrEqual(req.key);
-		if (i && i->isValue() && i.key() == req.key) {
-			v = (Value)i->getValue();
-			path = 1;
-		} else if (!i || !i->isClearTo() || i->getEndKey() <= req.key) {
-			path = 2;
-			Optional<Value> vv = wait(data->storage.readValue(req.key, IKeyValueStore::ReadType::NORMAL, req.debugID));
-			data->counters.kvGetBytes += vv.expectedSize();
-			// Validate that while we were reading the data we didn't lose the version or shard
-			if (version < data->storageVersion()) {
-				CODE_PROBE(true, "transaction_too_old after readValue");
-				throw transaction_too_old();
+		if (!data->shards[req.key]->isReadable()) {
+			AddingShard* addingShard = data->shards[req.key]->adding.get();
+			if (SERVER_KNOBS->FETCH_KEYS_SERVE_PREFIX_READS && addingShard && version >= addingShard->fetchVersion &&
+			    addingShard->phase == AddingShard::Fetching && req.key < addingShard->fetchedDurableWatermark) {
+				// The key has been fetched and durably committed at fetchVersion, and any newer mutations are
+				// buffered in AddingShard::updates, so this read can be served without waiting for the rest of the
+				// shard to arrive
+				CODE_PROBE(true, "Point read served from the fetched prefix of an adding shard");
+				path = 3;
+				Optional<Value> vv = wait(getValueFromAddingShard(data, req.key, version, changeCounter, req.debugID));
+				v = vv;
+			} else if (SERVER_KNOBS->FETCH_KEYS_SERVE_PREFIX_READS && addingShard &&
+			           addingShard->isDataTransferred() && version >= addingShard->transferredVersion) {
+				// The fetched data was durably committed before it was injected into the version data at
+				// transferredVersion, so reads at or above that version are served by the normal path below
+				CODE_PROBE(true, "Point read on an adding shard at or above transferredVersion");
+			} else {
+				//TraceEvent("WrongShardServer", data->thisServerID).detail("Key", req.key).detail("Version", version).detail("In", "getValueQ");
+				throw wrong_shard_server();
+			}
+		}
+
+		if (path != 3) {
+			auto i = data->data().at(version).lastLessOrEqual(req.key);
+			if (i && i->isValue() && i.key() == req.key) {
+				v = (Value)i->getValue();
+				path = 1;
+			} else if (!i || !i->isClearTo() || i->getEndKey() <= req.key) {
+				path = 2;
+				Optional<Value> vv =
+				    wait(data->storage.readValue(req.key, IKeyValueStore::ReadType::NORMAL, req.debugID));
+				data->counters.kvGetBytes += vv.expectedSize();
+				// Validate that while we were reading the data we didn't lose the version or shard
+				if (version < data->storageVersion()) {
+					CODE_PROBE(true, "transaction_too_old after readValue");
+					throw transaction_too_old();
+				}
+				data->checkChangeCounter(changeCounter, req.key);
+				v = vv;
 			}
-			data->checkChangeCounter(changeCounter, req.key);
-			v = vv;
 		}
 
 		DEBUG_MUTATION("ShardGetValue",
@@ -1833,7 +2284,8 @@ ACTOR Future<Void> getValueQ(StorageServer* data, GetValueRequest req) {
 		                           req.key,
 		                           path == 0   ? LiteralStringRef("0")
 		                           : path == 1 ? LiteralStringRef("1")
-		                                       : LiteralStringRef("2")),
+		                           : path == 2 ? LiteralStringRef("2")
+		                                       : LiteralStringRef("3")),
 		               data->thisServerID);
 
 		/*
@@ -1878,16 +2330,159 @@ ACTOR Future<Void> getValueQ(StorageServer* data, GetValueRequest req) {
 		data->sendErrorWithPenalty(req.reply, e, data->getPenalty());
 	}
 
+	data->transactionTagCounter.addRequest(req.tags, resultSize);
+	data->transactionTagCounter.addKeyRead(req.key, resultSize);
+
+	++data->counters.finishedQueries;
+
+	double duration = g_network->timer() - req.requestTime();
+	data->counters.readLatencySample.addMeasurement(duration);
+	data->smoothReadLatency.setTotal(duration);
+	data->readTimeSeconds += duration;
+	if (data->latencyBandConfig.present()) {
+		int maxReadBytes =
+		    data->latencyBandConfig.get().readConfig.maxReadBytes.orDefault(std::numeric_limits<int>::max());
+		bool filtered = resultSize > maxReadBytes;
+		data->counters.readLatencyBands.addMeasurement(duration, filtered);
+		if (req.key < allKeys.end) {
+			data->readRangeLatencyBands.addMeasurement(
+			    data->shards.rangeContaining(req.key)->range(), duration, filtered);
+		}
+	}
+
+	return Void();
+}
+
+// Reads a batch of keys, each one exactly as getValueQ would read it. The whole batch runs at one
+// version; a key outside this server's readable shards fails the batch with wrong_shard_server and
+// the client regroups by shard.
+ACTOR Future<Void> getMultipleValuesQ(StorageServer* data, GetMultipleValuesRequest req) {
+	state Span span("SS:getMultipleValues"_loc, req.spanContext);
+	if (req.tenantInfo.name.present()) {
+		span.addAttribute("tenant"_sr, req.tenantInfo.name.get());
+	}
+	state int64_t resultSize = 0;
+	getCurrentLineage()->modify(&TransactionLineage::txID) = req.spanContext.traceID;
+
+	try {
+		++data->counters.getMultipleValuesQueries;
+		++data->counters.allQueries;
+		data->maxQueryQueue = std::max<int>(
+		    data->maxQueryQueue, data->counters.allQueries.getValue() - data->counters.finishedQueries.getValue());
+
+		// Active load balancing runs at a very high priority (to obtain accurate queue lengths)
+		// so we need to downgrade here
+		wait(data->getQueryDelay());
+
+		if (req.debugID.present())
+			g_traceBatch.addEvent("GetValueDebug", req.debugID.get().first(), "getMultipleValuesQ.DoRead");
+
+		Version commitVersion = getLatestCommitVersion(req.ssLatestCommitVersions, data->tag);
+		state Version version = wait(waitForVersion(data, commitVersion, req.version, req.spanContext));
+
+		state Optional<TenantMapEntry> tenantEntry = data->getTenantEntry(version, req.tenantInfo);
+		state GetMultipleValuesReply reply;
+
+		// Resolve what we can from the in-memory version data first, collecting the keys which miss
+		// the PTree so the storage engine can serve them with one batched read instead of one thread
+		// pool crossing per key.
+		state std::vector<Key> keys;
+		state std::vector<Optional<Value>> values(req.keys.size());
+		state Standalone<VectorRef<KeyRef>> missingKeys;
+		state std::vector<int> missingIndex;
+		state uint64_t changeCounter = data->shardChangeCounter;
+		keys.reserve(req.keys.size());
+		for (int i = 0; i < req.keys.size(); i++) {
+			Key key = tenantEntry.present() ? Key(req.keys[i]).withPrefix(tenantEntry.get().prefix)
+			                                : Key(req.keys[i], req.arena);
+			keys.push_back(key);
+
+			if (!data->shards[key]->isReadable()) {
+				throw wrong_shard_server();
+			}
+
+			auto it = data->data().at(version).lastLessOrEqual(key);
+			if (it && it->isValue() && it.key() == key) {
+				values[i] = (Value)it->getValue();
+			} else if (!it || !it->isClearTo() || it->getEndKey() <= key) {
+				missingKeys.push_back_deep(missingKeys.arena(), key);
+				missingIndex.push_back(i);
+			}
+		}
+
+		if (missingKeys.size() > 0) {
+			std::vector<Optional<Value>> vv =
+			    wait(data->storage.readValues(missingKeys, IKeyValueStore::ReadType::NORMAL, req.debugID));
+			// Validate that while we were reading the data we didn't lose the version or shards
+			if (version < data->storageVersion()) {
+				CODE_PROBE(true, "transaction_too_old after readValues in getMultipleValues");
+				throw transaction_too_old();
+			}
+			for (int j = 0; j < (int)vv.size(); j++) {
+				data->checkChangeCounter(changeCounter, missingKeys[j]);
+				data->counters.kvGetBytes += vv[j].expectedSize();
+				values[missingIndex[j]] = vv[j];
+			}
+		}
+
+		for (int i = 0; i < req.keys.size(); i++) {
+			const Key& key = keys[i];
+			const Optional<Value>& v = values[i];
+
+			DEBUG_MUTATION("ShardGetValue",
+			               version,
+			               MutationRef(MutationRef::DebugKey, key, v.present() ? v.get() : LiteralStringRef("<null>")),
+			               data->thisServerID);
+
+			if (v.present()) {
+				++data->counters.rowsQueried;
+				resultSize += v.get().size();
+			} else {
+				++data->counters.emptyQueries;
+			}
+
+			if (SERVER_KNOBS->READ_SAMPLING_ENABLED) {
+				// If the read yields no value, randomly sample the empty read.
+				int64_t bytesReadPerKSecond =
+				    v.present() ? std::max((int64_t)(key.size() + v.get().size()), SERVER_KNOBS->EMPTY_READ_PENALTY)
+				                : SERVER_KNOBS->EMPTY_READ_PENALTY;
+				data->metrics.notifyBytesReadPerKSecond(key, bytesReadPerKSecond);
+			}
+
+			reply.values.push_back_deep(reply.arena,
+			                            v.present() ? Optional<ValueRef>(v.get()) : Optional<ValueRef>());
+		}
+
+		data->counters.bytesQueried += resultSize;
+
+		if (req.debugID.present())
+			g_traceBatch.addEvent("GetValueDebug", req.debugID.get().first(), "getMultipleValuesQ.AfterRead");
+
+		reply.penalty = data->getPenalty();
+		req.reply.send(reply);
+	} catch (Error& e) {
+		if (!canReplyWith(e))
+			throw;
+		data->sendErrorWithPenalty(req.reply, e, data->getPenalty());
+	}
+
 	data->transactionTagCounter.addRequest(req.tags, resultSize);
 
 	++data->counters.finishedQueries;
 
 	double duration = g_network->timer() - req.requestTime();
 	data->counters.readLatencySample.addMeasurement(duration);
+	data->smoothReadLatency.setTotal(duration);
+	data->readTimeSeconds += duration;
 	if (data->latencyBandConfig.present()) {
 		int maxReadBytes =
 		    data->latencyBandConfig.get().readConfig.maxReadBytes.orDefault(std::numeric_limits<int>::max());
-		data->counters.readLatencyBands.addMeasurement(duration, resultSize > maxReadBytes);
+		bool filtered = resultSize > maxReadBytes;
+		data->counters.readLatencyBands.addMeasurement(duration, filtered);
+		if (req.keys.size() && req.keys[0] < allKeys.end) {
+			data->readRangeLatencyBands.addMeasurement(
+			    data->shards.rangeContaining(req.keys[0])->range(), duration, filtered);
+		}
 	}
 
 	return Void();
@@ -1995,15 +2590,19 @@ ACTOR Future<Version> watchWaitForValueChange(StorageServer* data, SpanContext p
 	}
 }
 
-void checkCancelWatchImpl(StorageServer* data, WatchValueRequest req) {
-	Reference<ServerWatchMetadata> metadata = data->getWatchMetadata(req.key.contents());
+void checkCancelWatch(StorageServer* data, KeyRef key) {
+	Reference<ServerWatchMetadata> metadata = data->getWatchMetadata(key);
 	if (metadata.isValid() && metadata->versionPromise.getFutureReferenceCount() == 1) {
 		// last watch timed out so cancel watch_impl and delete key from the map
-		data->deleteWatchMetadata(req.key.contents());
+		data->deleteWatchMetadata(key);
 		metadata->watch_impl.cancel();
 	}
 }
 
+void checkCancelWatchImpl(StorageServer* data, WatchValueRequest req) {
+	checkCancelWatch(data, req.key.contents());
+}
+
 ACTOR Future<Void> watchValueSendReply(StorageServer* data,
                                        WatchValueRequest req,
                                        Future<Version> resp,
@@ -2055,6 +2654,108 @@ ACTOR Future<Void> watchValueSendReply(StorageServer* data,
 	}
 }
 
+// Registers one entry of a multiplexed watch request against the shared per-key watch metadata,
+// following the same cases as serveWatchValueRequestsImpl, and returns the version at which the
+// watch fired. `key` already includes any tenant prefix. Unlike watchValueSendReply there is no
+// per-entry timeout; the whole batch is timed out together by watchValuesQ.
+ACTOR Future<Version> watchValuesTrigger(StorageServer* data,
+                                         SpanContext parent,
+                                         Key key,
+                                         Optional<Value> value,
+                                         Version version,
+                                         Optional<TagSet> tags,
+                                         Optional<UID> debugID) {
+	state Span span("SS:watchValuesTrigger"_loc, parent);
+	state Reference<ServerWatchMetadata> metadata = data->getWatchMetadata(key);
+	++data->counters.watchQueries;
+	++data->numWatches;
+	data->watchBytes += WATCH_OVERHEAD_WATCHQ;
+	try {
+		state Future<Version> resp;
+		// case 1: no watch set for the current key
+		if (!metadata.isValid()) {
+			metadata = makeReference<ServerWatchMetadata>(key, value, version, tags, debugID);
+			KeyRef mapKey = data->setWatchMetadata(metadata);
+			metadata->watch_impl =
+			    forward(watchWaitForValueChange(data, span.context, mapKey), metadata->versionPromise);
+			resp = metadata->versionPromise.getFuture();
+		}
+		// case 2: there is a watch in the map and it has the same value so just update version
+		else if (metadata->value == value) {
+			if (version > metadata->version) {
+				metadata->version = version;
+				metadata->tags = tags;
+				metadata->debugID = debugID;
+			}
+			resp = metadata->versionPromise.getFuture();
+		}
+		// case 3: version in map has a lower version so trigger watch and create a new entry in map
+		else if (version > metadata->version) {
+			data->deleteWatchMetadata(key);
+			metadata->versionPromise.send(version);
+			metadata->watch_impl.cancel();
+
+			metadata = makeReference<ServerWatchMetadata>(key, value, version, tags, debugID);
+			KeyRef mapKey = data->setWatchMetadata(metadata);
+			metadata->watch_impl =
+			    forward(watchWaitForValueChange(data, span.context, mapKey), metadata->versionPromise);
+			resp = metadata->versionPromise.getFuture();
+		}
+		// case 4: version in the map is higher so immediately trigger watch
+		else if (version < metadata->version) {
+			CODE_PROBE(true, "multiplexed watch version in map is higher so trigger watch (case 4)");
+			resp = metadata->version;
+		}
+		// case 5: watch value differs but their versions are the same (rare case) so check with the SS
+		else {
+			CODE_PROBE(true, "multiplexed watch version in the map is the same but value is different (case 5)");
+			loop {
+				try {
+					state Version latest = data->version.get();
+					GetValueRequest getReq(
+					    span.context, TenantInfo(), metadata->key, latest, metadata->tags, metadata->debugID, VersionVector());
+					state Future<Void> getValue = getValueQ(data, getReq);
+					GetValueReply reply = wait(getReq.reply.getFuture());
+					metadata = data->getWatchMetadata(key);
+
+					if (metadata.isValid() && reply.value != metadata->value) { // valSS != valMap
+						data->deleteWatchMetadata(key);
+						metadata->versionPromise.send(version);
+						metadata->watch_impl.cancel();
+					}
+
+					if (reply.value == value) { // valSS == valreq
+						metadata = makeReference<ServerWatchMetadata>(key, value, version, tags, debugID);
+						KeyRef mapKey = data->setWatchMetadata(metadata);
+						metadata->watch_impl =
+						    forward(watchWaitForValueChange(data, span.context, mapKey), metadata->versionPromise);
+						resp = metadata->versionPromise.getFuture();
+					} else {
+						resp = latest;
+					}
+					break;
+				} catch (Error& e) {
+					if (e.code() != error_code_transaction_too_old) {
+						throw e;
+					}
+					CODE_PROBE(true, "Reading a multiplexed watched key failed with transaction_too_old");
+				}
+			}
+		}
+
+		Version ver = wait(resp);
+		checkCancelWatch(data, key);
+		--data->numWatches;
+		data->watchBytes -= WATCH_OVERHEAD_WATCHQ;
+		return ver;
+	} catch (Error& e) {
+		checkCancelWatch(data, key);
+		--data->numWatches;
+		data->watchBytes -= WATCH_OVERHEAD_WATCHQ;
+		throw;
+	}
+}
+
 // Finds a checkpoint.
 ACTOR Future<Void> getCheckpointQ(StorageServer* self, GetCheckpointRequest req) {
 	// Wait until the desired version is durable.
@@ -2446,6 +3147,47 @@ static std::deque<Standalone<MutationsAndVersionRef>>::const_iterator searchChan
 	}
 }
 
+// Issues a disk read of the feed's durable mutations for [beginVersion, endVersion), or joins an identical
+// in-flight read issued by another stream of the same feed; see ChangeFeedInfo::SharedDiskRead. Sets
+// *joinedExisting when an in-flight read was shared.
+static Future<RangeResult> readChangeFeedDurableMutations(StorageServer* data,
+                                                          Reference<ChangeFeedInfo> feedInfo,
+                                                          Version beginVersion,
+                                                          Version endVersion,
+                                                          int byteLimit,
+                                                          bool* joinedExisting) {
+	// Prune reads that have completed; later requests must see newly durable or popped data
+	for (auto it = feedInfo->inflightDiskReads.begin(); it != feedInfo->inflightDiskReads.end();) {
+		if (it->second.result.isReady()) {
+			it = feedInfo->inflightDiskReads.erase(it);
+		} else {
+			++it;
+		}
+	}
+
+	auto readKey = std::make_pair(beginVersion, endVersion);
+	auto it = feedInfo->inflightDiskReads.find(readKey);
+	if (it != feedInfo->inflightDiskReads.end()) {
+		if (it->second.durableVersion == feedInfo->durableVersion && it->second.emptyVersion == feedInfo->emptyVersion &&
+		    it->second.byteLimit == byteLimit) {
+			CODE_PROBE(true, "Change feed stream joined shared durable read");
+			*joinedExisting = true;
+			return it->second.result;
+		}
+		// The feed's durable state changed while the read was in flight, so its snapshot cannot be shared
+		feedInfo->inflightDiskReads.erase(it);
+	}
+
+	Future<RangeResult> read = data->storage.readRange(
+	    KeyRangeRef(changeFeedDurableKey(feedInfo->id, beginVersion), changeFeedDurableKey(feedInfo->id, endVersion)),
+	    1 << 30,
+	    byteLimit);
+	feedInfo->inflightDiskReads[readKey] =
+	    ChangeFeedInfo::SharedDiskRead{ feedInfo->durableVersion, feedInfo->emptyVersion, byteLimit, read };
+	*joinedExisting = false;
+	return read;
+}
+
 ACTOR Future<std::pair<ChangeFeedStreamReply, bool>> getChangeFeedMutations(StorageServer* data,
                                                                             ChangeFeedStreamRequest req,
                                                                             bool inverted,
@@ -2543,14 +3285,22 @@ ACTOR Future<std::pair<ChangeFeedStreamReply, bool>> getChangeFeedMutations(Stor
 			// To let update storage finish
 			wait(delay(0));
 		}
-		RangeResult res = wait(
-		    data->storage.readRange(KeyRangeRef(changeFeedDurableKey(req.rangeID, std::max(req.begin, emptyVersion)),
-		                                        changeFeedDurableKey(req.rangeID, req.end)),
-		                            1 << 30,
-		                            remainingDurableBytes));
-
-		data->counters.kvScanBytes += res.logicalSize();
-		++data->counters.changeFeedDiskReads;
+		// Bound how many streams catch up from the storage engine at once; when many far-behind consumers restart
+		// together, the excess ones queue here instead of crowding out the normal key-value read path
+		wait(data->changeFeedDiskReadsLock.take(TaskPriority::DefaultYield));
+		state FlowLock::Releaser holdingCFDRL(data->changeFeedDiskReadsLock);
+		state bool joinedDiskRead = false;
+		RangeResult res = wait(readChangeFeedDurableMutations(
+		    data, feedInfo, std::max(req.begin, emptyVersion), req.end, remainingDurableBytes, &joinedDiskRead));
+		holdingCFDRL.release();
+
+		if (joinedDiskRead) {
+			// The scan work was already counted by the stream that issued the read
+			++data->counters.changeFeedSharedDiskReads;
+		} else {
+			data->counters.kvScanBytes += res.logicalSize();
+			++data->counters.changeFeedDiskReads;
+		}
 
 		if (!inverted && !req.range.empty()) {
 			data->checkChangeCounter(changeCounter, req.range);
@@ -3186,7 +3936,9 @@ ACTOR Future<GetValueReqAndResultRef> quickGetValue(StorageServer* data,
                                                     Version version,
                                                     Arena* a,
                                                     // To provide span context, tags, debug ID to underlying lookups.
-                                                    GetMappedKeyValuesRequest* pOriginalReq) {
+                                                    GetMappedKeyValuesRequest* pOriginalReq,
+                                                    // Shared by all remote subqueries of the original request.
+                                                    Transaction* pRemoteTr) {
 	state GetValueReqAndResultRef getValue;
 	state double getValueStart = g_network->timer();
 	getValue.key = key;
@@ -3222,12 +3974,7 @@ ACTOR Future<GetValueReqAndResultRef> quickGetValue(StorageServer* data,
 
 	++data->counters.quickGetValueMiss;
 	if (SERVER_KNOBS->QUICK_GET_VALUE_FALLBACK) {
-		state Transaction tr(data->cx, pOriginalReq->tenantInfo.name.castTo<TenantName>());
-		tr.setVersion(version);
-		// TODO: is DefaultPromiseEndpoint the best priority for this?
-		tr.trState->taskID = TaskPriority::DefaultPromiseEndpoint;
-		Future<Optional<Value>> valueFuture = tr.get(key, Snapshot::True);
-		// TODO: async in case it needs to read from other servers.
+		Future<Optional<Value>> valueFuture = pRemoteTr->get(key, Snapshot::True);
 		Optional<Value> valueOption = wait(valueFuture);
 		copyOptionalValue(a, getValue, valueOption);
 		double duration = g_network->timer() - getValueStart;
@@ -3680,6 +4427,9 @@ ACTOR Future<Void> getKeyValuesQ(StorageServer* data, GetKeyValuesRequest req)
 			throw wrong_shard_server();
 		}
 
+		// The request is now eligible to read, so take a read slot for the execution stage
+		state PriorityMultiLock::Lock readLock = wait(data->readLock.lock(SS_READ_PRIORITY_RANGE));
+
 		KeyRangeRef searchRange = data->clampRangeToTenant(shard, tenantEntry, req.arena);
 
 		state int offset1 = 0;
@@ -3793,15 +4543,20 @@ ACTOR Future<Void> getKeyValuesQ(StorageServer* data, GetKeyValuesRequest req)
 
 	double duration = g_network->timer() - req.requestTime();
 	data->counters.readLatencySample.addMeasurement(duration);
+	data->smoothReadLatency.setTotal(duration);
+	data->readTimeSeconds += duration;
 	if (data->latencyBandConfig.present()) {
 		int maxReadBytes =
 		    data->latencyBandConfig.get().readConfig.maxReadBytes.orDefault(std::numeric_limits<int>::max());
 		int maxSelectorOffset =
 		    data->latencyBandConfig.get().readConfig.maxKeySelectorOffset.orDefault(std::numeric_limits<int>::max());
-		data->counters.readLatencyBands.addMeasurement(duration,
-		                                               resultSize > maxReadBytes ||
-		                                                   abs(req.begin.offset) > maxSelectorOffset ||
-		                                                   abs(req.end.offset) > maxSelectorOffset);
+		bool filtered = resultSize > maxReadBytes || abs(req.begin.offset) > maxSelectorOffset ||
+		                abs(req.end.offset) > maxSelectorOffset;
+		data->counters.readLatencyBands.addMeasurement(duration, filtered);
+		if (req.begin.getKey() < allKeys.end) {
+			data->readRangeLatencyBands.addMeasurement(
+			    data->shards.rangeContaining(req.begin.getKey())->range(), duration, filtered);
+		}
 	}
 
 	return Void();
@@ -3813,7 +4568,9 @@ ACTOR Future<GetRangeReqAndResultRef> quickGetKeyValues(
     Version version,
     Arena* a,
     // To provide span context, tags, debug ID to underlying lookups.
-    GetMappedKeyValuesRequest* pOriginalReq) {
+    GetMappedKeyValuesRequest* pOriginalReq,
+    // Shared by all remote subqueries of the original request.
+    Transaction* pRemoteTr) {
 	state GetRangeReqAndResultRef getRange;
 	state double getValuesStart = g_network->timer();
 	getRange.begin = firstGreaterOrEqual(KeyRef(*a, prefix));
@@ -3864,16 +4621,8 @@ ACTOR Future<GetRangeReqAndResultRef> quickGetKeyValues(
 
 	++data->counters.quickGetKeyValuesMiss;
 	if (SERVER_KNOBS->QUICK_GET_KEY_VALUES_FALLBACK) {
-		state Transaction tr(data->cx, pOriginalReq->tenantInfo.name.castTo<TenantName>());
-		tr.setVersion(version);
-		if (pOriginalReq->debugID.present()) {
-			tr.debugTransaction(pOriginalReq->debugID.get());
-		}
-		// TODO: is DefaultPromiseEndpoint the best priority for this?
-		tr.trState->taskID = TaskPriority::DefaultPromiseEndpoint;
 		Future<RangeResult> rangeResultFuture =
-		    tr.getRange(prefixRange(prefix), GetRangeLimits::ROW_LIMIT_UNLIMITED, Snapshot::True);
-		// TODO: async in case it needs to read from other servers.
+		    pRemoteTr->getRange(prefixRange(prefix), GetRangeLimits::ROW_LIMIT_UNLIMITED, Snapshot::True);
 		RangeResult rangeResult = wait(rangeResultFuture);
 		a->dependsOn(rangeResult.arena());
 		getRange.result = rangeResult;
@@ -4136,10 +4885,12 @@ ACTOR Future<Void> mapSubquery(StorageServer* data,
                                bool isBoundary,
                                KeyValueRef* it,
                                MappedKeyValueRef* kvm,
-                               Key mappedKey) {
+                               Key mappedKey,
+                               Transaction* pRemoteTr) {
 	if (isRangeQuery) {
 		// Use the mappedKey as the prefix of the range query.
-		GetRangeReqAndResultRef getRange = wait(quickGetKeyValues(data, mappedKey, version, pArena, pOriginalReq));
+		GetRangeReqAndResultRef getRange =
+		    wait(quickGetKeyValues(data, mappedKey, version, pArena, pOriginalReq, pRemoteTr));
 		if ((!getRange.result.empty() && matchIndex == MATCH_INDEX_MATCHED_ONLY) ||
 		    (getRange.result.empty() && matchIndex == MATCH_INDEX_UNMATCHED_ONLY)) {
 			kvm->key = it->key;
@@ -4149,7 +4900,8 @@ ACTOR Future<Void> mapSubquery(StorageServer* data,
 		kvm->boundaryAndExist = isBoundary && !getRange.result.empty();
 		kvm->reqAndResult = getRange;
 	} else {
-		GetValueReqAndResultRef getValue = wait(quickGetValue(data, mappedKey, version, pArena, pOriginalReq));
+		GetValueReqAndResultRef getValue =
+		    wait(quickGetValue(data, mappedKey, version, pArena, pOriginalReq, pRemoteTr));
 		kvm->reqAndResult = getValue;
 		kvm->boundaryAndExist = isBoundary && getValue.result.present();
 	}
@@ -4187,10 +4939,19 @@ ACTOR Future<GetMappedKeyValuesReply> mapKeyValues(StorageServer* data,
 	preprocessMappedKey(mappedKeyFormatTuple, vt, isRangeQuery);
 
 	state int sz = input.data.size();
-	const int k = std::min(sz, SERVER_KNOBS->MAX_PARALLEL_QUICK_GET_VALUE);
-	state std::vector<MappedKeyValueRef> kvms(k);
+	state std::vector<MappedKeyValueRef> kvms(sz);
 	state std::vector<Future<Void>> subqueries;
+	state std::vector<Future<Void>> remoteSubqueries;
 	state int offset = 0;
+	// One transaction shared by all cross-shard subqueries of this request, so that they share
+	// location cache state instead of each constructing their own transaction.
+	state Transaction remoteTr(data->cx, pOriginalReq->tenantInfo.name.castTo<TenantName>());
+	remoteTr.setVersion(input.version);
+	if (pOriginalReq->debugID.present()) {
+		remoteTr.debugTransaction(pOriginalReq->debugID.get());
+	}
+	// TODO: is DefaultPromiseEndpoint the best priority for this?
+	remoteTr.trState->taskID = TaskPriority::DefaultPromiseEndpoint;
 	if (pOriginalReq->debugID.present())
 		g_traceBatch.addEvent(
 		    "TransactionDebug", pOriginalReq->debugID.get().first(), "storageserver.mapKeyValues.BeforeLoop");
@@ -4198,7 +4959,7 @@ ACTOR Future<GetMappedKeyValuesReply> mapKeyValues(StorageServer* data,
 		// Divide into batches of MAX_PARALLEL_QUICK_GET_VALUE subqueries
 		for (int i = 0; i + offset < sz && i < SERVER_KNOBS->MAX_PARALLEL_QUICK_GET_VALUE; i++) {
 			KeyValueRef* it = &input.data[i + offset];
-			MappedKeyValueRef* kvm = &kvms[i];
+			MappedKeyValueRef* kvm = &kvms[i + offset];
 			bool isBoundary = (i + offset) == 0 || (i + offset) == sz - 1;
 			// need to keep the boundary, so that caller can use it as a continuation.
 			if (isBoundary || matchIndex == MATCH_INDEX_ALL) {
@@ -4217,26 +4978,46 @@ ACTOR Future<GetMappedKeyValuesReply> mapKeyValues(StorageServer* data,
 			// std::cout << "key:" << printable(kvm->key) << ", value:" << printable(kvm->value)
 			//          << ", mappedKey:" << printable(mappedKey) << std::endl;
 
-			subqueries.push_back(mapSubquery(data,
-			                                 input.version,
-			                                 pOriginalReq,
-			                                 &result.arena,
-			                                 matchIndex,
-			                                 isRangeQuery,
-			                                 isBoundary,
-			                                 it,
-			                                 kvm,
-			                                 mappedKey));
+			Future<Void> subquery = mapSubquery(data,
+			                                    input.version,
+			                                    pOriginalReq,
+			                                    &result.arena,
+			                                    matchIndex,
+			                                    isRangeQuery,
+			                                    isBoundary,
+			                                    it,
+			                                    kvm,
+			                                    mappedKey,
+			                                    &remoteTr);
+			// Secondary keys on this server resolve in bounded parallel batches; keys on other
+			// shards are dispatched immediately and harvested once after the loop, so a few remote
+			// rows do not stall every local batch behind a cross-shard round trip.
+			if (data->shards[mappedKey]->isReadable()) {
+				subqueries.push_back(subquery);
+			} else {
+				remoteSubqueries.push_back(subquery);
+			}
 		}
 		wait(waitForAll(subqueries));
 		if (pOriginalReq->debugID.present())
 			g_traceBatch.addEvent(
 			    "TransactionDebug", pOriginalReq->debugID.get().first(), "storageserver.mapKeyValues.AfterBatch");
 		subqueries.clear();
-		for (int i = 0; i + offset < sz && i < SERVER_KNOBS->MAX_PARALLEL_QUICK_GET_VALUE; i++) {
-			result.data.push_back(result.arena, kvms[i]);
+		if (remoteSubqueries.size() >= SERVER_KNOBS->MAX_PARALLEL_REMOTE_QUICK_GET) {
+			// Crude backpressure: drain the remote fan-out before starting yet more of it.
+			wait(waitForAll(remoteSubqueries));
+			remoteSubqueries.clear();
 		}
 	}
+	if (!remoteSubqueries.empty()) {
+		wait(waitForAll(remoteSubqueries));
+		if (pOriginalReq->debugID.present())
+			g_traceBatch.addEvent(
+			    "TransactionDebug", pOriginalReq->debugID.get().first(), "storageserver.mapKeyValues.AfterRemote");
+	}
+	for (int i = 0; i < sz; i++) {
+		result.data.push_back(result.arena, kvms[i]);
+	}
 	if (pOriginalReq->debugID.present())
 		g_traceBatch.addEvent(
 		    "TransactionDebug", pOriginalReq->debugID.get().first(), "storageserver.mapKeyValues.AfterAll");
@@ -4421,6 +5202,9 @@ ACTOR Future<Void> getMappedKeyValuesQ(StorageServer* data, GetMappedKeyValuesRe
 			throw wrong_shard_server();
 		}
 
+		// The request is now eligible to read, so take a read slot for the execution stage
+		state PriorityMultiLock::Lock readLock = wait(data->readLock.lock(SS_READ_PRIORITY_RANGE));
+
 		KeyRangeRef searchRange = data->clampRangeToTenant(shard, tenantEntry, req.arena);
 
 		state int offset1 = 0;
@@ -4551,16 +5335,21 @@ ACTOR Future<Void> getMappedKeyValuesQ(StorageServer* data, GetMappedKeyValuesRe
 
 	double duration = g_network->timer() - req.requestTime();
 	data->counters.readLatencySample.addMeasurement(duration);
+	data->smoothReadLatency.setTotal(duration);
+	data->readTimeSeconds += duration;
 	data->counters.mappedRangeSample.addMeasurement(duration);
 	if (data->latencyBandConfig.present()) {
 		int maxReadBytes =
 		    data->latencyBandConfig.get().readConfig.maxReadBytes.orDefault(std::numeric_limits<int>::max());
 		int maxSelectorOffset =
 		    data->latencyBandConfig.get().readConfig.maxKeySelectorOffset.orDefault(std::numeric_limits<int>::max());
-		data->counters.readLatencyBands.addMeasurement(duration,
-		                                               resultSize > maxReadBytes ||
-		                                                   abs(req.begin.offset) > maxSelectorOffset ||
-		                                                   abs(req.end.offset) > maxSelectorOffset);
+		bool filtered = resultSize > maxReadBytes || abs(req.begin.offset) > maxSelectorOffset ||
+		                abs(req.end.offset) > maxSelectorOffset;
+		data->counters.readLatencyBands.addMeasurement(duration, filtered);
+		if (req.begin.getKey() < allKeys.end) {
+			data->readRangeLatencyBands.addMeasurement(
+			    data->shards.rangeContaining(req.begin.getKey())->range(), duration, filtered);
+		}
 	}
 
 	return Void();
@@ -4855,15 +5644,108 @@ ACTOR Future<Void> getKeyQ(StorageServer* data, GetKeyRequest req) {
 
 	double duration = g_network->timer() - req.requestTime();
 	data->counters.readLatencySample.addMeasurement(duration);
+	data->smoothReadLatency.setTotal(duration);
+	data->readTimeSeconds += duration;
 	if (data->latencyBandConfig.present()) {
 		int maxReadBytes =
 		    data->latencyBandConfig.get().readConfig.maxReadBytes.orDefault(std::numeric_limits<int>::max());
 		int maxSelectorOffset =
 		    data->latencyBandConfig.get().readConfig.maxKeySelectorOffset.orDefault(std::numeric_limits<int>::max());
-		data->counters.readLatencyBands.addMeasurement(
-		    duration, resultSize > maxReadBytes || abs(req.sel.offset) > maxSelectorOffset);
+		bool filtered = resultSize > maxReadBytes || abs(req.sel.offset) > maxSelectorOffset;
+		data->counters.readLatencyBands.addMeasurement(duration, filtered);
+		if (req.sel.getKey() < allKeys.end) {
+			data->readRangeLatencyBands.addMeasurement(
+			    data->shards.rangeContaining(req.sel.getKey())->range(), duration, filtered);
+		}
+	}
+
+	return Void();
+}
+
+ACTOR Future<Void> getMultipleKeysQ(StorageServer* data, GetMultipleKeysRequest req) {
+	state Span span("SS:getMultipleKeys"_loc, req.spanContext);
+	if (req.tenantInfo.name.present()) {
+		span.addAttribute("tenant"_sr, req.tenantInfo.name.get());
+	}
+	state int64_t resultSize = 0;
+	getCurrentLineage()->modify(&TransactionLineage::txID) = req.spanContext.traceID;
+
+	++data->counters.getMultipleKeysQueries;
+	++data->counters.allQueries;
+	data->maxQueryQueue = std::max<int>(
+	    data->maxQueryQueue, data->counters.allQueries.getValue() - data->counters.finishedQueries.getValue());
+
+	// Active load balancing runs at a very high priority (to obtain accurate queue lengths)
+	// so we need to downgrade here
+	wait(data->getQueryDelay());
+
+	try {
+		Version commitVersion = getLatestCommitVersion(req.ssLatestCommitVersions, data->tag);
+		state Version version = wait(waitForVersion(data, commitVersion, req.version, req.spanContext));
+
+		state Optional<TenantMapEntry> tenantEntry = data->getTenantEntry(version, req.tenantInfo);
+		state GetMultipleKeysReply reply;
+		state int i;
+		for (i = 0; i < req.sels.size(); i++) {
+			// Each selector is resolved against the current shard map, like one getKeyQ would be;
+			// a selector outside this server's shards fails the whole batch with wrong_shard_server
+			// and the client regroups.
+			state KeySelector sel = KeySelector(req.sels[i], req.arena);
+			if (tenantEntry.present()) {
+				sel.setKeyUnlimited(sel.getKey().withPrefix(tenantEntry.get().prefix, sel.arena()));
+			}
+			state uint64_t changeCounter = data->shardChangeCounter;
+
+			KeyRange shard = getShardKeyRange(data, sel);
+			KeyRangeRef searchRange = data->clampRangeToTenant(shard, tenantEntry, sel.arena());
+
+			state int offset;
+			Key absoluteKey = wait(
+			    findKey(data, sel, version, searchRange, &offset, req.spanContext, IKeyValueStore::ReadType::NORMAL));
+
+			data->checkChangeCounter(changeCounter,
+			                         KeyRangeRef(std::min<KeyRef>(sel.getKey(), absoluteKey),
+			                                     std::max<KeyRef>(sel.getKey(), absoluteKey)));
+
+			KeyRef k = absoluteKey;
+			if (tenantEntry.present()) {
+				k = k.removePrefix(tenantEntry.get().prefix);
+			}
+
+			KeySelectorRef updated;
+			if (offset < 0)
+				updated = firstGreaterOrEqual(k) + offset; // first thing on this shard OR (large offset case) smallest
+				                                           // key retrieved in range read
+			else if (offset > 0)
+				updated = firstGreaterOrEqual(k) + offset - 1; // first thing on next shard OR (large offset case)
+				                                               // keyAfter largest key retrieved in range read
+			else
+				updated = KeySelectorRef(k, true, 0); // found
+
+			reply.sels.push_back_deep(reply.arena, updated);
+			resultSize += k.size();
+			++data->counters.rowsQueried;
+		}
+
+		data->counters.bytesQueried += resultSize;
+		reply.penalty = data->getPenalty();
+
+		req.reply.send(reply);
+	} catch (Error& e) {
+		if (!canReplyWith(e))
+			throw;
+		data->sendErrorWithPenalty(req.reply, e, data->getPenalty());
 	}
 
+	data->transactionTagCounter.addRequest(req.tags, resultSize);
+
+	++data->counters.finishedQueries;
+
+	double duration = g_network->timer() - req.requestTime();
+	data->counters.readLatencySample.addMeasurement(duration);
+	data->smoothReadLatency.setTotal(duration);
+	data->readTimeSeconds += duration;
+
 	return Void();
 }
 
@@ -4883,6 +5765,11 @@ void getQueuingMetrics(StorageServer* self, StorageQueuingMetricsRequest const&
 	reply.durableVersion = self->durableVersion.get();
 
 	reply.busiestTags = self->transactionTagCounter.getBusiestTags();
+	reply.bytesSpilled = self->spilledBytes;
+
+	auto compactionDebt = self->storage.getCompactionDebt();
+	reply.compactionBytes = compactionDebt.pendingBytes;
+	reply.level0Files = compactionDebt.level0Files;
 
 	req.reply.send(reply);
 }
@@ -5115,6 +6002,7 @@ void applyMutation(StorageServer* self,
                    Version version) {
 	// m is expected to be in arena already
 	// Clear split keys are added to arena
+	ArenaTagScope tagScope(ArenaTag::VersionedMap);
 	StorageMetrics metrics;
 	metrics.bytesPerKSecond = mvccStorageBytes(m) / 2;
 	metrics.iosPerKSecond = 1;
@@ -6278,6 +7166,13 @@ ACTOR Future<Void> fetchKeys(StorageServer* data, AddingShard* shard) {
 
 		loop {
 			state Transaction tr(data->cx);
+			// A retry restarts the stream from keys.begin at a re-picked, higher fetchVersion and pops buffered
+			// updates up to it, so anything fetched by a previous attempt is stale: serving a read below the old
+			// watermark would combine the old attempt's base values with updates newer than the new fetchVersion,
+			// losing the mutations in between. Reset the watermarks (and the not-yet-durable block accounting)
+			// before any wait so no read can be served from the previous attempt's data.
+			shard->fetchedHighWatermark = keys.begin;
+			shard->fetchedDurableWatermark = keys.begin;
 			// fetchVersion = data->version.get();
 			// A quick fix:
 			// By default, we use data->version as the fetchVersion.
@@ -6332,12 +7227,25 @@ ACTOR Future<Void> fetchKeys(StorageServer* data, AddingShard* shard) {
 			                              : tryGetRange(results, &tr, keys);
 			state Key nfk = keys.begin;
 
+			// Blocks that have been written to storage, paired with the number of storage commits that must have
+			// completed before those writes are durably committed (and therefore readable from the storage engine).
+			// Explicitly cleared because state variables are not re-initialized on a retry iteration, and a stale
+			// entry from a previous attempt must not promote the durable watermark.
+			state std::deque<std::pair<Key, int64_t>> pendingDurableBlocks;
+			pendingDurableBlocks.clear();
+
 			try {
 				loop {
 					CODE_PROBE(true, "Fetching keys for transferred shard");
 					while (data->fetchKeysBudgetUsed.get()) {
 						wait(data->fetchKeysBudgetUsed.onChange());
 					}
+
+					while (!pendingDurableBlocks.empty() &&
+					       pendingDurableBlocks.front().second <= data->storageCommitsCompleted) {
+						shard->fetchedDurableWatermark = pendingDurableBlocks.front().first;
+						pendingDurableBlocks.pop_front();
+					}
 					state RangeResult this_block = waitNext(results.getFuture());
 
 					state int expectedBlockSize =
@@ -6365,17 +7273,26 @@ ACTOR Future<Void> fetchKeys(StorageServer* data, AddingShard* shard) {
 
 					metricReporter.addFetchedBytes(expectedBlockSize, this_block.size());
 
-					// Write this_block to storage
+					// Write this_block to storage, yielding between batches rather than per row so that large
+					// blocks do not pay actor scheduling overhead for every key-value
 					state KeyValueRef* kvItr = this_block.begin();
+					state int kvBatched = 0;
 					for (; kvItr != this_block.end(); ++kvItr) {
 						data->storage.writeKeyValue(*kvItr);
-						wait(yield());
+						if (++kvBatched >= SERVER_KNOBS->FETCH_KEYS_WRITE_BATCH_KEYS) {
+							kvBatched = 0;
+							wait(yield());
+						}
 					}
 
 					kvItr = this_block.begin();
+					kvBatched = 0;
 					for (; kvItr != this_block.end(); ++kvItr) {
 						data->byteSampleApplySet(*kvItr, invalidVersion);
-						wait(yield());
+						if (++kvBatched >= SERVER_KNOBS->FETCH_KEYS_WRITE_BATCH_KEYS) {
+							kvBatched = 0;
+							wait(yield());
+						}
 					}
 
 					ASSERT(this_block.readThrough.present() || this_block.size());
@@ -6383,6 +7300,11 @@ ACTOR Future<Void> fetchKeys(StorageServer* data, AddingShard* shard) {
 					                                       : keyAfter(this_block.end()[-1].key);
 					this_block = RangeResult();
 
+					// The writes above are included in the next storage commit to be issued, so they become
+					// readable once commit number kvCommits+1 has completed
+					shard->fetchedHighWatermark = nfk;
+					pendingDurableBlocks.emplace_back(nfk, data->counters.kvCommits.getValue() + 1);
+
 					data->fetchKeysBytesBudget -= expectedBlockSize;
 					if (data->fetchKeysBytesBudget <= 0) {
 						data->fetchKeysBudgetUsed.set(true);
@@ -6489,6 +7411,11 @@ ACTOR Future<Void> fetchKeys(StorageServer* data, AddingShard* shard) {
 		holdingFKPL.release();
 		wait(dataArrive && fetchDurable);
 
+		// Everything written for this shard is now durably committed, so the entire fetched range is eligible for
+		// point reads (note that `keys` has been clipped to the fetched prefix if the shard was split above)
+		shard->fetchedHighWatermark = keys.end;
+		shard->fetchedDurableWatermark = keys.end;
+
 		state std::unordered_map<Key, Version> feedFetchedVersions = wait(feedFetchMain);
 
 		TraceEvent(SevDebug, "FKAfterFinalCommit", data->thisServerID)
@@ -6686,7 +7613,8 @@ ACTOR Future<Void> fetchKeys(StorageServer* data, AddingShard* shard) {
 }
 
 AddingShard::AddingShard(StorageServer* server, KeyRangeRef const& keys)
-  : keys(keys), server(server), transferredVersion(invalidVersion), fetchVersion(invalidVersion), phase(WaitPrevious) {
+  : keys(keys), fetchedHighWatermark(keys.begin), fetchedDurableWatermark(keys.begin), server(server),
+    transferredVersion(invalidVersion), fetchVersion(invalidVersion), phase(WaitPrevious) {
 	fetchClient = fetchKeys(server, this);
 }
 
@@ -7335,6 +8263,12 @@ void StorageServer::addMutation(Version version,
 	    .detail("ShardBegin", shard.begin)
 	    .detail("ShardEnd", shard.end);
 
+	if (!fromFetch && expanded.type == MutationRef::SetValue && !expanded.param1.startsWith(systemKeys.begin)) {
+		// Atomic ops were converted to sets above, so this captures client sets and atomics in the hot key
+		// index; clears have no single key and fetched mutations are data movement rather than client load
+		transactionTagCounter.addKeyWrite(expanded.param1, expanded.param1.size() + expanded.param2.size());
+	}
+
 	if (!fromFetch) {
 		// have to do change feed before applyMutation because nonExpanded wasn't copied into the mutation log arena,
 		// and thus would go out of scope if it wasn't copied into the change feed arena
@@ -7827,6 +8761,118 @@ ACTOR Future<Void> tssDelayForever() {
 	}
 }
 
+// Stages the cold tail of the mutation log to the spill queue so a large durability backlog does not have to be held
+// entirely in memory. Entries are chosen oldest-first, skipping versions the current updateStorage cycle may already
+// be writing, and are removed from the mutation log only once the disk queue commit has made their disk copies
+// readable. updateStorage restores them (see unspillMutationLog) before making their versions durable.
+ACTOR Future<Void> spillMutationLog(StorageServer* data) {
+	wait(delay(0, TaskPriority::UpdateStorage));
+
+	if (data->spillQueue == nullptr) {
+		// The spill queue is opened on first use. Anything a previous incarnation of this storage server left in
+		// the files is redundant with the tlogs, so recovery just drains and discards it.
+		state IDiskQueue* queue =
+		    openDiskQueue(data->folder + "/storagequeue-" + data->thisServerID.toString() + "-",
+		                  "fdq",
+		                  data->thisServerID,
+		                  DiskQueueVersion::V2);
+		bool recovered = wait(queue->initializeRecovery(0));
+		if (!recovered) {
+			loop {
+				Standalone<StringRef> r = wait(queue->readNext(1 << 20));
+				if (r.size() < (1 << 20)) {
+					break;
+				}
+			}
+		}
+		queue->pop(queue->getNextReadLocation());
+		wait(queue->commit());
+		data->spillQueue = queue;
+		TraceEvent("StorageSpillQueueOpened", data->thisServerID);
+	}
+
+	state std::vector<std::pair<Version, StorageServer::SpilledVersionInfo>> staged;
+	int64_t stagedBytes = 0;
+	int64_t inMemoryQueue = data->queueSize() - data->spilledBytes;
+	// Only versions above everything already spilled are candidates, so that disk queue locations are always in
+	// version order and unspillMutationLog can pop the queue as it restores a prefix
+	Version minSpillableVersion = data->desiredOldestVersion.get();
+	if (!data->spilledVersions.empty()) {
+		minSpillableVersion = std::max(minSpillableVersion, data->spilledVersions.rbegin()->first);
+	}
+	for (auto u = data->getMutationLog().upper_bound(minSpillableVersion);
+	     u != data->getMutationLog().end() && u->first <= data->version.get();
+	     ++u) {
+		if (inMemoryQueue - stagedBytes <= SERVER_KNOBS->STORAGE_SPILL_QUEUE_THRESHOLD_BYTES ||
+		    data->spilledBytes + stagedBytes >= SERVER_KNOBS->STORAGE_SPILL_QUEUE_MAX_BYTES) {
+			break;
+		}
+		int64_t entryBytes = VERSION_OVERHEAD;
+		for (const auto& m : u->second.mutations) {
+			entryBytes += mvccStorageBytes(m);
+		}
+		BinaryWriter wr(IncludeVersion());
+		wr << u->second;
+		IDiskQueue::location start = data->spillQueue->getNextPushLocation();
+		IDiskQueue::location end = data->spillQueue->push(wr.toValue());
+		staged.emplace_back(u->first, StorageServer::SpilledVersionInfo{ start, end, entryBytes });
+		stagedBytes += entryBytes;
+	}
+	if (staged.empty()) {
+		return Void();
+	}
+	CODE_PROBE(true, "Storage server spilled mutation backlog to disk");
+	wait(data->spillQueue->commit());
+
+	// The disk copies are readable now, so the in-memory entries can be dropped. Skip any version that has become
+	// eligible for durability while the commit was outstanding; its in-memory copy must remain authoritative.
+	for (const auto& [version, info] : staged) {
+		if (version <= data->desiredOldestVersion.get()) {
+			continue;
+		}
+		auto u = data->getMutableMutationLog().find(version);
+		if (u == data->getMutableMutationLog().end()) {
+			continue;
+		}
+		data->getMutableMutationLog().erase(u);
+		data->spilledVersions[version] = info;
+		data->spilledBytes += info.bytes;
+		data->counters.bytesSpilled += info.bytes;
+	}
+	return Void();
+}
+
+// Restores spilled mutation log entries with versions at or below `through`, so that the updateStorage cycle about to
+// make those versions durable (and changeDurableVersion, which replays the same mutations to clean up the versioned
+// data) finds them in the mutation log again.
+ACTOR Future<Void> unspillMutationLog(StorageServer* data, Version through) {
+	state IDiskQueue::location popTo;
+	state bool restored = false;
+	while (!data->spilledVersions.empty() && data->spilledVersions.begin()->first <= through) {
+		state Version version = data->spilledVersions.begin()->first;
+		state StorageServer::SpilledVersionInfo info = data->spilledVersions.begin()->second;
+		state Standalone<StringRef> buf = wait(data->spillQueue->read(info.start, info.end, CheckHashes::True));
+		ArenaReader reader(buf.arena(), buf, IncludeVersion());
+		Standalone<VerUpdateRef> restoredUpdate;
+		reader >> restoredUpdate;
+		ASSERT(restoredUpdate.version == version);
+		data->getMutableMutationLog()[version] = restoredUpdate;
+		data->spilledVersions.erase(version);
+		data->spilledBytes -= info.bytes;
+		data->counters.bytesUnspilled += info.bytes;
+		popTo = info.end;
+		restored = true;
+		wait(yield(TaskPriority::UpdateStorage));
+	}
+	if (restored) {
+		CODE_PROBE(true, "Storage server restored spilled mutation backlog");
+		// Reclaim the disk space. The pop becomes durable with the next spill queue commit, which is acceptable
+		// because the queue is never recovered across restarts.
+		data->spillQueue->pop(popTo);
+	}
+	return Void();
+}
+
 ACTOR Future<Void> update(StorageServer* data, bool* pReceivedUpdate) {
 	state double start;
 	try {
@@ -8020,6 +9066,7 @@ ACTOR Future<Void> update(StorageServer* data, bool* pReceivedUpdate) {
 					// actor until it was completed.
 				}
 
+				eager.beginFetchInjectedMutations();
 				for (auto& c : fii.changes)
 					eager.addMutations(c.mutations);
 
@@ -8310,6 +9357,15 @@ ACTOR Future<Void> update(StorageServer* data, bool* pReceivedUpdate) {
 			data->behind = false;
 		}
 
+		// If the in-memory durability backlog has grown past the spill threshold, stage the cold tail of the
+		// mutation log to disk so that a short ingest burst does not have to be absorbed entirely by RAM
+		if (SERVER_KNOBS->STORAGE_SPILL_QUEUE_ENABLED && data->spillInProgress.isReady() &&
+		    data->queueSize() - data->spilledBytes > SERVER_KNOBS->STORAGE_SPILL_QUEUE_THRESHOLD_BYTES &&
+		    data->spilledBytes < SERVER_KNOBS->STORAGE_SPILL_QUEUE_MAX_BYTES) {
+			data->spillInProgress = spillMutationLog(data);
+			data->actors.add(data->spillInProgress);
+		}
+
 		return Void(); // update will get called again ASAP
 	} catch (Error& err) {
 		state Error e = err;
@@ -8392,6 +9448,46 @@ ACTOR Future<Void> updateStorage(StorageServer* data) {
 		state Version desiredVersion = data->desiredOldestVersion.get();
 		state int64_t bytesLeft = SERVER_KNOBS->STORAGE_COMMIT_BYTES;
 
+		// Disk-local commit pacing: while foreground reads are observed to be slower than the target, scale
+		// down the byte budget for this commit batch so the disk has headroom to serve them. Durability still
+		// progresses at no less than STORAGE_COMMIT_PACING_MIN_FACTOR of the configured rate, and if pacing
+		// lets the durability lag grow too far, currentRate() pushes back on ingest as usual.
+		if (SERVER_KNOBS->STORAGE_COMMIT_PACING_ENABLED) {
+			double readLatency = data->smoothReadLatency.smoothTotal();
+			double factor = 1.0;
+			if (readLatency > SERVER_KNOBS->STORAGE_COMMIT_PACING_TARGET_READ_LATENCY) {
+				CODE_PROBE(true, "Storage commit bytes paced down by read latency");
+				factor = std::max(SERVER_KNOBS->STORAGE_COMMIT_PACING_MIN_FACTOR,
+				                  SERVER_KNOBS->STORAGE_COMMIT_PACING_TARGET_READ_LATENCY / readLatency);
+			}
+			data->commitPacingFactor = factor;
+			bytesLeft = std::max<int64_t>(1, int64_t(bytesLeft * factor));
+		}
+
+		// Bring back any spilled mutation backlog that this durability cycle needs. To bound the memory spike,
+		// clamp desiredVersion so that roughly one commit budget's worth of spilled data is restored per cycle.
+		if (data->spillQueue != nullptr && !data->spilledVersions.empty() &&
+		    data->spilledVersions.begin()->first <= desiredVersion) {
+			Version unspillThrough = data->spilledVersions.begin()->first;
+			int64_t unspillBytes = 0;
+			for (const auto& [version, info] : data->spilledVersions) {
+				if (version > desiredVersion) {
+					break;
+				}
+				unspillThrough = version;
+				unspillBytes += info.bytes;
+				if (unspillBytes >= std::max<int64_t>(bytesLeft, SERVER_KNOBS->STORAGE_COMMIT_BYTES)) {
+					break;
+				}
+			}
+			auto next = data->spilledVersions.upper_bound(unspillThrough);
+			if (next != data->spilledVersions.end() && next->first <= desiredVersion) {
+				CODE_PROBE(true, "Spilled mutation backlog clamps the durability cycle");
+				desiredVersion = unspillThrough;
+			}
+			wait(unspillMutationLog(data, unspillThrough));
+		}
+
 		// Clean up stale checkpoint requests, this is not supposed to happen, since checkpoints are cleaned up on
 		// failures. This is kept as a safeguard.
 		while (!data->pendingCheckpoints.empty() && data->pendingCheckpoints.begin()->first <= startOldestVersion) {
@@ -8465,8 +9561,13 @@ ACTOR Future<Void> updateStorage(StorageServer* data) {
 			}
 		}
 
+		// Fold deferred byte-sample maintenance ahead of the durable writes so the sample mutations are
+		// committed together with the data they describe
+		data->byteSampleFold();
+
 		// Write mutations to storage until we reach the desiredVersion or have written too much (bytesleft)
 		state double beforeStorageUpdates = now();
+		state std::vector<Future<Void>> cleanupFutures;
 		loop {
 			state bool done = data->storage.makeVersionMutationsDurable(
 			    newOldestVersion, desiredVersion, bytesLeft, unlimitedCommitBytes);
@@ -8476,17 +9577,20 @@ ACTOR Future<Void> updateStorage(StorageServer* data) {
 			}
 			// We want to forget things from these data structures atomically with changing oldestVersion (and "before",
 			// since oldestVersion.set() may trigger waiting actors) forgetVersionsBeforeAsync visibly forgets
-			// immediately (without waiting) but asynchronously frees memory.
-			Future<Void> finishedForgetting =
+			// immediately (without waiting) but asynchronously frees memory. The freeing walk is collected and waited
+			// on after the loop so that it does not delay later iterations from making their versions durable.
+			cleanupFutures.push_back(
 			    data->mutableData().forgetVersionsBeforeAsync(newOldestVersion, TaskPriority::UpdateStorage) &&
 			    data->tenantMap.forgetVersionsBeforeAsync(newOldestVersion, TaskPriority::UpdateStorage) &&
-			    data->tenantPrefixIndex.forgetVersionsBeforeAsync(newOldestVersion, TaskPriority::UpdateStorage);
+			    data->tenantPrefixIndex.forgetVersionsBeforeAsync(newOldestVersion, TaskPriority::UpdateStorage));
 			data->oldestVersion.set(newOldestVersion);
-			wait(finishedForgetting);
 			wait(yield(TaskPriority::UpdateStorage));
 			if (done)
 				break;
 		}
+		// All the version trimming started above must finish before this durability window completes; the dead
+		// nodes are owned by the cleanup actors, so the waits below only bound how far freeing can fall behind.
+		wait(waitForAll(cleanupFutures));
 
 		if (addedRanges) {
 			TraceEvent(SevVerbose, "SSAddKVSRangeMetaData", data->thisServerID)
@@ -8566,6 +9670,10 @@ ACTOR Future<Void> updateStorage(StorageServer* data) {
 			curFeed++;
 		}
 
+		// Fold byte-sample ops deferred while this window was in flight (e.g. from fetchKeys writes) so they
+		// join the same commit as their data; ops at not-yet-durable versions just land in the mutation log
+		data->byteSampleFold();
+
 		// Set the new durable version as part of the outstanding change set, before commit
 		if (startOldestVersion != newOldestVersion)
 			data->storage.makeVersionDurable(newOldestVersion);
@@ -8583,7 +9691,9 @@ ACTOR Future<Void> updateStorage(StorageServer* data) {
 		}
 
 		wait(ioTimeoutError(durable, SERVER_KNOBS->MAX_STORAGE_COMMIT_TIME));
+		++data->storageCommitsCompleted;
 		data->storageCommitLatencyHistogram->sampleSeconds(now() - beforeStorageCommit);
+		data->commitTimeSeconds += now() - beforeStorageCommit;
 
 		debug_advanceMinCommittedVersion(data->thisServerID, newOldestVersion);
 
@@ -9362,10 +10472,13 @@ Future<bool> StorageServerDisk::restoreDurableState() {
 // Determines whether a key-value pair should be included in a byte sample
 // Also returns size information about the sample
 ByteSampleInfo isKeyValueInSample(KeyValueRef keyValue) {
+	return isKeyValueInSample(keyValue.key, keyValue.key.size() + keyValue.value.size());
+}
+
+ByteSampleInfo isKeyValueInSample(KeyRef key, int64_t totalKvSize) {
 	ByteSampleInfo info;
 
-	const KeyRef key = keyValue.key;
-	info.size = key.size() + keyValue.value.size();
+	info.size = totalKvSize;
 
 	uint32_t a = 0;
 	uint32_t b = 0;
@@ -9389,13 +10502,45 @@ void StorageServer::addMutationToMutationLogOrStorage(Version ver, MutationRef m
 }
 
 void StorageServer::byteSampleApplySet(KeyValueRef kv, Version ver) {
+	// Defer the sample update off the ingest path; byteSampleFold() applies buffered ops in order
+	byteSampleOps.push_back(ByteSampleOp{
+	    ver, KeyRef(byteSampleOpsArena, kv.key), KeyRef(), (int64_t)kv.key.size() + kv.value.size(), false });
+	if (!byteSampleFolding && byteSampleOps.size() >= SERVER_KNOBS->MAX_DEFERRED_BYTE_SAMPLE_OPS)
+		byteSampleFold();
+}
+
+void StorageServer::byteSampleApplyClear(KeyRangeRef range, Version ver) {
+	// Defer the sample update off the ingest path; byteSampleFold() applies buffered ops in order
+	byteSampleOps.push_back(
+	    ByteSampleOp{ ver, KeyRef(byteSampleOpsArena, range.begin), KeyRef(byteSampleOpsArena, range.end), 0, true });
+	if (!byteSampleFolding && byteSampleOps.size() >= SERVER_KNOBS->MAX_DEFERRED_BYTE_SAMPLE_OPS)
+		byteSampleFold();
+}
+
+void StorageServer::byteSampleFold() {
+	// Folding a sampled set persists it through the mutation log, which defers a sample op for the persisted
+	// key itself; such ops are appended while folding and are folded in the same pass, so iterate by index
+	// and copy each op since the vector can reallocate.
+	byteSampleFolding = true;
+	for (int i = 0; i < byteSampleOps.size(); i++) {
+		ByteSampleOp op = byteSampleOps[i];
+		if (op.isClear)
+			byteSampleFoldClear(KeyRangeRef(op.key, op.end), op.version);
+		else
+			byteSampleFoldSet(op.key, op.size, op.version);
+	}
+	byteSampleOps.clear();
+	byteSampleOpsArena = Arena();
+	byteSampleFolding = false;
+}
+
+void StorageServer::byteSampleFoldSet(KeyRef key, int64_t size, Version ver) {
 	// Update byteSample in memory and (eventually) on disk and notify waiting metrics
 
-	ByteSampleInfo sampleInfo = isKeyValueInSample(kv);
+	ByteSampleInfo sampleInfo = isKeyValueInSample(key, size);
 	auto& byteSample = metrics.byteSample.sample;
 
 	int64_t delta = 0;
-	const KeyRef key = kv.key;
 
 	auto old = byteSample.find(key);
 	if (old != byteSample.end())
@@ -9429,7 +10574,7 @@ void StorageServer::byteSampleApplySet(KeyValueRef kv, Version ver) {
 		metrics.notifyBytes(key, delta);
 }
 
-void StorageServer::byteSampleApplyClear(KeyRangeRef range, Version ver) {
+void StorageServer::byteSampleFoldClear(KeyRangeRef range, Version ver) {
 	// Update byteSample in memory and (eventually) on disk via the mutationLog and notify waiting metrics
 
 	auto& byteSample = metrics.byteSample.sample;
@@ -9631,8 +10776,13 @@ ACTOR Future<Void> metricsCore(StorageServer* self, StorageServerInterface ssi)
 			}
 			when(GetStorageMetricsRequest req = waitNext(ssi.getStorageMetrics.getFuture())) {
 				StorageBytes sb = self->storage.getStorageBytes();
-				self->metrics.getStorageMetrics(
-				    req, sb, self->counters.bytesInput.getRate(), self->versionLag, self->lastUpdate);
+				self->metrics.getStorageMetrics(req,
+				                                sb,
+				                                self->counters.bytesInput.getRate(),
+				                                self->versionLag,
+				                                self->lastUpdate,
+				                                self->cpuUsage,
+				                                self->diskUsage);
 			}
 			when(ReadHotSubRangeRequest req = waitNext(ssi.getReadHotRanges.getFuture())) {
 				if (!self->isReadable(req.keys)) {
@@ -9642,6 +10792,24 @@ ACTOR Future<Void> metricsCore(StorageServer* self, StorageServerInterface ssi)
 					self->metrics.getReadHotRanges(req);
 				}
 			}
+			when(GetHotKeysRequest req = waitNext(ssi.getHotKeys.getFuture())) {
+				if (!self->isReadable(req.keys)) {
+					CODE_PROBE(true, "getHotKeys immediate wrong_shard_server()");
+					self->sendErrorWithPenalty(req.reply, wrong_shard_server(), self->getPenalty());
+				} else {
+					GetHotKeysReply reply;
+					auto const& hotKeys = self->transactionTagCounter.getHotKeys();
+					for (auto const& hotKey : hotKeys) {
+						// The index is server-wide; filter to the requested range so that fanning the
+						// request out per shard does not report the same key from every shard
+						if (req.keys.contains(hotKey.key)) {
+							reply.hotKeys.push_back(reply.hotKeys.arena(), hotKey);
+						}
+					}
+					reply.hotKeys.arena().dependsOn(hotKeys.arena());
+					req.reply.send(reply);
+				}
+			}
 			when(SplitRangeRequest req = waitNext(ssi.getRangeSplitPoints.getFuture())) {
 				if (!self->isReadable(req.keys)) {
 					CODE_PROBE(true, "getSplitPoints immediate wrong_shard_server()");
@@ -9669,6 +10837,67 @@ ACTOR Future<Void> logLongByteSampleRecovery(Future<Void> recovery) {
 	return Void();
 }
 
+// Periodically walks the readable shards and reports how much of this server's data is cold:
+// bytes in shards whose read bandwidth over the metrics averaging window is below
+// COLD_SHARD_READ_BYTES_PER_KSECOND. This is the access-frequency signal for tiering cold
+// ranges out of the local storage engine (e.g. eviction to blob storage with read-through),
+// and measures how many bytes such a tier could reclaim before any data moves.
+ACTOR Future<Void> reportColdRanges(StorageServer* self) {
+	state std::vector<KeyRange> ranges;
+	state int64_t coldBytes;
+	state int64_t totalBytes;
+	state int coldShards;
+	state KeyRange largestColdRange;
+	state int64_t largestColdBytes;
+	state int i;
+
+	wait(self->byteSampleRecovery);
+	loop {
+		wait(delay(SERVER_KNOBS->COLD_RANGE_REPORT_INTERVAL));
+
+		// The shard map can change while this actor yields, so snapshot the readable ranges
+		// first. Metrics estimates on a slightly stale range are still meaningful.
+		ranges.clear();
+		for (auto s = self->shards.ranges().begin(); s != self->shards.ranges().end(); ++s) {
+			if (s->value()->isReadable()) {
+				ranges.push_back(s->range());
+			}
+		}
+
+		coldBytes = 0;
+		totalBytes = 0;
+		coldShards = 0;
+		largestColdRange = KeyRange();
+		largestColdBytes = 0;
+		for (i = 0; i < ranges.size(); i++) {
+			int64_t bytes = self->metrics.byteSample.getEstimate(ranges[i]);
+			int64_t readBytesPerKSecond = self->metrics.bytesReadSample.getEstimate(ranges[i]) *
+			                              SERVER_KNOBS->STORAGE_METRICS_AVERAGE_INTERVAL_PER_KSECONDS;
+			totalBytes += bytes;
+			if (readBytesPerKSecond < SERVER_KNOBS->COLD_SHARD_READ_BYTES_PER_KSECOND) {
+				coldBytes += bytes;
+				++coldShards;
+				if (bytes > largestColdBytes) {
+					largestColdBytes = bytes;
+					largestColdRange = ranges[i];
+				}
+			}
+			if (i % 100 == 99) {
+				wait(yield());
+			}
+		}
+
+		TraceEvent("ColdRangeReport", self->thisServerID)
+		    .detail("ColdBytes", coldBytes)
+		    .detail("TotalBytes", totalBytes)
+		    .detail("ColdShards", coldShards)
+		    .detail("Shards", ranges.size())
+		    .detail("LargestColdRange", largestColdRange)
+		    .detail("LargestColdRangeBytes", largestColdBytes)
+		    .detail("ReadBytesPerKSecondThreshold", SERVER_KNOBS->COLD_SHARD_READ_BYTES_PER_KSECOND);
+	}
+}
+
 ACTOR Future<Void> checkBehind(StorageServer* self) {
 	state int behindCount = 0;
 	loop {
@@ -9754,6 +10983,28 @@ ACTOR Future<Void> serveGetKeyRequests(StorageServer* self, FutureStream<GetKeyR
 	}
 }
 
+ACTOR Future<Void> serveGetMultipleKeysRequests(StorageServer* self,
+                                                FutureStream<GetMultipleKeysRequest> getMultipleKeys) {
+	getCurrentLineage()->modify(&TransactionLineage::operation) = TransactionLineage::Operation::GetKey;
+	loop {
+		GetMultipleKeysRequest req = waitNext(getMultipleKeys);
+		// Warning: This code is executed at extremely high priority (TaskPriority::LoadBalancedEndpoint), so
+		// downgrade before doing real work
+		self->actors.add(self->readGuard(req, getMultipleKeysQ));
+	}
+}
+
+ACTOR Future<Void> serveGetMultipleValuesRequests(StorageServer* self,
+                                                  FutureStream<GetMultipleValuesRequest> getMultipleValues) {
+	getCurrentLineage()->modify(&TransactionLineage::operation) = TransactionLineage::Operation::GetValue;
+	loop {
+		GetMultipleValuesRequest req = waitNext(getMultipleValues);
+		// Warning: This code is executed at extremely high priority (TaskPriority::LoadBalancedEndpoint), so
+		// downgrade before doing real work
+		self->actors.add(self->readGuard(req, getMultipleValuesQ));
+	}
+}
+
 ACTOR Future<Void> watchValueWaitForVersion(StorageServer* self,
                                             WatchValueRequest req,
                                             PromiseStream<WatchValueRequest> stream) {
@@ -9881,6 +11132,82 @@ ACTOR Future<Void> serveWatchValueRequests(StorageServer* self, FutureStream<Wat
 	}
 }
 
+ACTOR Future<Void> forwardWatchTrigger(WatchValuesRequest req, int index, Future<Version> trigger) {
+	Version ver = wait(trigger);
+	req.reply.send(WatchValuesStreamReply(index, ver));
+	return Void();
+}
+
+// Serves one multiplexed watch request. Every entry is registered against the shared per-key watch
+// metadata through watchValuesTrigger and its fired version is streamed back tagged with the
+// entry's index. The whole batch shares one timeout, driven by the same noRecentUpdates logic as
+// watchValueSendReply; entries that fired before the timeout have already been delivered.
+ACTOR Future<Void> watchValuesQ(StorageServer* data, WatchValuesRequest req) {
+	state Span span("SS:watchValues"_loc, req.spanContext);
+	state std::vector<Future<Void>> forwarders;
+	state double startTime = now();
+	getCurrentLineage()->modify(&TransactionLineage::txID) = req.spanContext.traceID;
+	try {
+		state Version maxVersion = invalidVersion;
+		for (auto& entry : req.entries) {
+			maxVersion = std::max(maxVersion, entry.version);
+		}
+		wait(success(waitForVersionNoTooOld(data, maxVersion)));
+		state Optional<TenantMapEntry> tenantEntry = data->getTenantEntry(latestVersion, req.tenantInfo);
+		for (int i = 0; i < req.entries.size(); i++) {
+			Key key = tenantEntry.present() ? Key(req.entries[i].key).withPrefix(tenantEntry.get().prefix)
+			                                : Key(req.entries[i].key, req.arena);
+			Optional<Value> value = req.entries[i].value.present()
+			                            ? Optional<Value>(Value(req.entries[i].value.get(), req.arena))
+			                            : Optional<Value>();
+			forwarders.push_back(forwardWatchTrigger(
+			    req,
+			    i,
+			    watchValuesTrigger(data, span.context, key, value, req.entries[i].version, req.tags, req.debugID)));
+		}
+		CODE_PROBE(req.entries.size() > 1, "Multiple watches registered through one multiplexed request");
+		state Future<Void> allDone = waitForAll(forwarders);
+		loop {
+			double timeoutDelay = -1;
+			if (data->noRecentUpdates.get()) {
+				timeoutDelay = std::max(CLIENT_KNOBS->FAST_WATCH_TIMEOUT - (now() - startTime), 0.0);
+			} else if (!BUGGIFY) {
+				timeoutDelay = std::max(CLIENT_KNOBS->WATCH_TIMEOUT - (now() - startTime), 0.0);
+			}
+			choose {
+				when(wait(allDone)) {
+					req.reply.sendError(end_of_stream());
+					return Void();
+				}
+				when(wait(timeoutDelay < 0 ? Never() : delay(timeoutDelay))) {
+					// the batch timed out; unfired watches re-register through the client's retry loop
+					req.reply.sendError(timed_out());
+					return Void();
+				}
+				when(wait(data->noRecentUpdates.onChange())) {}
+			}
+		}
+	} catch (Error& e) {
+		if (e.code() == error_code_operation_obsolete) {
+			// the client went away
+			return Void();
+		}
+		if (!canReplyWith(e)) {
+			throw e;
+		}
+		req.reply.sendError(e);
+	}
+	return Void();
+}
+
+ACTOR Future<Void> serveWatchValuesRequests(StorageServer* self, FutureStream<WatchValuesRequest> watchValues) {
+	getCurrentLineage()->modify(&TransactionLineage::operation) = TransactionLineage::Operation::WatchValue;
+	loop {
+		WatchValuesRequest req = waitNext(watchValues);
+		self->actors.add(watchValuesQ(self, req));
+	}
+}
+
 ACTOR Future<Void> serveChangeFeedStreamRequests(StorageServer* self,
                                                  FutureStream<ChangeFeedStreamRequest> changeFeedStream) {
 	loop {
@@ -9958,13 +11285,19 @@ ACTOR Future<Void> storageServerCore(StorageServer* self, StorageServerInterface
 	self->actors.add(self->otherError.getFuture());
 	self->actors.add(metricsCore(self, ssi));
 	self->actors.add(logLongByteSampleRecovery(self->byteSampleRecovery));
+	if (SERVER_KNOBS->COLD_RANGE_REPORT_INTERVAL > 0) {
+		self->actors.add(reportColdRanges(self));
+	}
 	self->actors.add(checkBehind(self));
 	self->actors.add(serveGetValueRequests(self, ssi.getValue.getFuture()));
 	self->actors.add(serveGetKeyValuesRequests(self, ssi.getKeyValues.getFuture()));
 	self->actors.add(serveGetMappedKeyValuesRequests(self, ssi.getMappedKeyValues.getFuture()));
 	self->actors.add(serveGetKeyValuesStreamRequests(self, ssi.getKeyValuesStream.getFuture()));
 	self->actors.add(serveGetKeyRequests(self, ssi.getKey.getFuture()));
+	self->actors.add(serveGetMultipleKeysRequests(self, ssi.getMultipleKeys.getFuture()));
+	self->actors.add(serveGetMultipleValuesRequests(self, ssi.getMultipleValues.getFuture()));
 	self->actors.add(serveWatchValueRequests(self, ssi.watchValue.getFuture()));
+	self->actors.add(serveWatchValuesRequests(self, ssi.watchValues.getFuture()));
 	self->actors.add(serveChangeFeedStreamRequests(self, ssi.changeFeedStream.getFuture()));
 	self->actors.add(serveOverlappingChangeFeedsRequests(self, ssi.overlappingChangeFeeds.getFuture()));
 	self->actors.add(serveChangeFeedPopRequests(self, ssi.changeFeedPop.getFuture()));
@@ -9975,6 +11308,8 @@ ACTOR Future<Void> storageServerCore(StorageServer* self, StorageServerInterface
 	self->transactionTagCounter.startNewInterval();
 	self->actors.add(
 	    recurring([&]() { self->transactionTagCounter.startNewInterval(); }, SERVER_KNOBS->TAG_MEASUREMENT_INTERVAL));
+	self->actors.add(recurring([&]() { self->readRangeLatencyBands.log(self->thisServerID); },
+	                           SERVER_KNOBS->STORAGE_LOGGING_DELAY));
 
 	self->coreStarted.send(Void());
 
@@ -10026,10 +11361,12 @@ ACTOR Future<Void> storageServerCore(StorageServer* self, StorageServerInterface
 				     newLatencyBandConfig.get().readConfig != self->latencyBandConfig.get().readConfig)) {
 					self->latencyBandConfig = newLatencyBandConfig;
 					self->counters.readLatencyBands.clearBands();
+					self->readRangeLatencyBands.clearBands();
 					TraceEvent("LatencyBandReadUpdatingConfig").detail("Present", newLatencyBandConfig.present());
 					if (self->latencyBandConfig.present()) {
 						for (auto band : self->latencyBandConfig.get().readConfig.bands) {
 							self->counters.readLatencyBands.addThreshold(band);
+							self->readRangeLatencyBands.addThreshold(band);
 						}
 					}
 				}
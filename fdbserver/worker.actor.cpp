@@ -170,6 +170,8 @@ Database openDBOnServer(Reference<AsyncVar<ServerDBInfo> const> const& db,
 	cx->globalConfig->init(db, std::addressof(db->get().client));
 	cx->globalConfig->trigger(samplingFrequency, samplingProfilerUpdateFrequency);
 	cx->globalConfig->trigger(samplingWindow, samplingProfilerUpdateWindow);
+	cx->globalConfig->triggerRange(traceSeverityPrefix, traceSeverityUpdated);
+	cx->globalConfig->triggerRange(traceRateLimitPrefix, traceRateLimitUpdated);
 	return cx;
 }
 
@@ -1077,6 +1079,109 @@ ACTOR Future<Void> healthMonitor(Reference<AsyncVar<Optional<ClusterControllerFu
 	}
 }
 
+struct IoProbeTimings {
+	double write = 0;
+	double sync = 0;
+	double read = 0;
+	double total() const { return write + sync + read; }
+};
+
+// Issues a single 4K write/sync/read cycle against the probe file and reports how long each phase took.
+ACTOR Future<IoProbeTimings> runIoProbe(Reference<IAsyncFile> file) {
+	state IoProbeTimings timings;
+	state std::string payload = deterministicRandom()->randomAlphaNumeric(4096);
+	state std::string scratch;
+	state double start = now();
+	wait(file->write(payload.data(), (int)payload.size(), 0));
+	timings.write = now() - start;
+	start = now();
+	wait(file->sync());
+	timings.sync = now() - start;
+	start = now();
+	scratch.resize(payload.size());
+	int n = wait(file->read(&scratch[0], (int)scratch.size(), 0));
+	timings.read = now() - start;
+	if (n != (int)payload.size() || scratch != payload) {
+		TraceEvent(SevError, "IoProbeReadMismatch").detail("Expected", (int)payload.size()).detail("Actual", n);
+		throw io_error();
+	}
+	return timings;
+}
+
+// The actor that periodically probes the worker's data disk with a small write/sync/read cycle. Repeated SLO
+// violations mark the process degraded through the same AsyncVar the transport layer uses for slow connections,
+// so the cluster controller deprioritizes the process for transaction system roles before a slowly-dying disk
+// that still passes liveness checks can throttle the whole cluster.
+ACTOR Future<Void> ioHealthProber(std::string folder, Reference<AsyncVar<bool>> degraded) {
+	state std::string filename = joinPath(folder, "iohealthprobe");
+	state Reference<IAsyncFile> probeFile;
+	state int consecutiveSlowProbes = 0;
+	loop {
+		wait(delay(SERVER_KNOBS->IO_HEALTH_PROBE_INTERVAL, TaskPriority::Low));
+		state bool slowProbe = false;
+		try {
+			if (!probeFile) {
+				Reference<IAsyncFile> f = wait(IAsyncFileSystem::filesystem()->open(
+				    filename, IAsyncFile::OPEN_CREATE | IAsyncFile::OPEN_READWRITE, 0600));
+				probeFile = f;
+			}
+			state double probeStart = now();
+			state Future<IoProbeTimings> probe = runIoProbe(probeFile);
+			state Optional<IoProbeTimings> timings;
+			choose {
+				when(IoProbeTimings t = wait(probe)) { timings = t; }
+				when(wait(delay(SERVER_KNOBS->IO_HEALTH_PROBE_TIMEOUT))) {}
+			}
+			if (!timings.present()) {
+				slowProbe = true;
+				TraceEvent(SevWarnAlways, "IoProbeTimedOut")
+				    .detail("Folder", folder)
+				    .detail("Timeout", SERVER_KNOBS->IO_HEALTH_PROBE_TIMEOUT);
+				// Wait the probe out rather than starting another one; a hung fsync can be serviced arbitrarily
+				// late and overlapping probes would make the latency measurements meaningless.
+				IoProbeTimings late = wait(probe);
+				TraceEvent(SevWarn, "IoProbeCompletedLate")
+				    .detail("Folder", folder)
+				    .detail("Elapsed", now() - probeStart)
+				    .detail("WriteLatency", late.write)
+				    .detail("SyncLatency", late.sync)
+				    .detail("ReadLatency", late.read);
+			} else {
+				slowProbe = timings.get().total() > SERVER_KNOBS->IO_HEALTH_PROBE_LATENCY_SLO;
+				TraceEvent(slowProbe ? SevWarn : SevInfo, "IoProbe")
+				    .suppressFor(slowProbe ? 5.0 : 300.0)
+				    .detail("Folder", folder)
+				    .detail("WriteLatency", timings.get().write)
+				    .detail("SyncLatency", timings.get().sync)
+				    .detail("ReadLatency", timings.get().read)
+				    .detail("ConsecutiveSlowProbes", consecutiveSlowProbes);
+			}
+		} catch (Error& e) {
+			if (e.code() == error_code_actor_cancelled) {
+				throw;
+			}
+			TraceEvent(SevWarnAlways, "IoProbeError").errorUnsuppressed(e).detail("Folder", folder);
+			probeFile.clear();
+			slowProbe = true;
+		}
+
+		if (slowProbe) {
+			if (++consecutiveSlowProbes >= SERVER_KNOBS->IO_HEALTH_PROBE_DEGRADED_COUNT) {
+				TraceEvent(SevWarnAlways, "IoProbeDegradedDisk")
+				    .suppressFor(60.0)
+				    .detail("Folder", folder)
+				    .detail("ConsecutiveSlowProbes", consecutiveSlowProbes);
+				degraded->set(true);
+			}
+		} else {
+			if (consecutiveSlowProbes >= SERVER_KNOBS->IO_HEALTH_PROBE_DEGRADED_COUNT) {
+				TraceEvent(SevWarnAlways, "IoProbeDiskRecovered").detail("Folder", folder);
+			}
+			consecutiveSlowProbes = 0;
+		}
+	}
+}
+
 #if (defined(__linux__) || defined(__FreeBSD__)) && defined(USE_GPERFTOOLS)
 // A set of threads that should be profiled
 std::set<std::thread::id> profiledThreads;
@@ -1277,6 +1382,8 @@ ACTOR Future<Void> storageServerRollbackRebooter(std::set<std::pair<UID, KeyValu
 
 		DUMPTOKEN(recruited.getValue);
 		DUMPTOKEN(recruited.getKey);
+		DUMPTOKEN(recruited.getMultipleKeys);
+		DUMPTOKEN(recruited.getMultipleValues);
 		DUMPTOKEN(recruited.getKeyValues);
 		DUMPTOKEN(recruited.getMappedKeyValues);
 		DUMPTOKEN(recruited.getShardState);
@@ -1289,6 +1396,7 @@ ACTOR Future<Void> storageServerRollbackRebooter(std::set<std::pair<UID, KeyValu
 		DUMPTOKEN(recruited.getQueuingMetrics);
 		DUMPTOKEN(recruited.getKeyValueStoreType);
 		DUMPTOKEN(recruited.watchValue);
+		DUMPTOKEN(recruited.watchValues);
 		DUMPTOKEN(recruited.getKeyValuesStream);
 		DUMPTOKEN(recruited.changeFeedStream);
 		DUMPTOKEN(recruited.changeFeedPop);
@@ -1324,6 +1432,8 @@ ACTOR Future<Void> storageCacheRollbackRebooter(Future<Void> prevStorageCache,
 
 		DUMPTOKEN(recruited.getValue);
 		DUMPTOKEN(recruited.getKey);
+		DUMPTOKEN(recruited.getMultipleKeys);
+		DUMPTOKEN(recruited.getMultipleValues);
 		DUMPTOKEN(recruited.getKeyValues);
 		DUMPTOKEN(recruited.getShardState);
 		DUMPTOKEN(recruited.waitMetrics);
@@ -1333,6 +1443,7 @@ ACTOR Future<Void> storageCacheRollbackRebooter(Future<Void> prevStorageCache,
 		DUMPTOKEN(recruited.getQueuingMetrics);
 		DUMPTOKEN(recruited.getKeyValueStoreType);
 		DUMPTOKEN(recruited.watchValue);
+		DUMPTOKEN(recruited.watchValues);
 
 		prevStorageCache = storageCacheServer(recruited, 0, db);
 	}
@@ -1652,6 +1763,9 @@ ACTOR Future<Void> workerServer(Reference<IClusterConnectionRecord> connRecord,
 	errorForwarders.add(monitorTraceLogIssues(issues));
 	errorForwarders.add(testerServerCore(interf.testerInterface, connRecord, dbInfo, locality));
 	errorForwarders.add(monitorHighMemory(memoryProfileThreshold));
+	if (SERVER_KNOBS->ENABLE_IO_HEALTH_PROBER) {
+		errorForwarders.add(ioHealthProber(folder, degraded));
+	}
 
 	filesClosed.add(stopping.getFuture());
 
@@ -1728,6 +1842,8 @@ ACTOR Future<Void> workerServer(Reference<IClusterConnectionRecord> connRecord,
 
 				DUMPTOKEN(recruited.getValue);
 				DUMPTOKEN(recruited.getKey);
+				DUMPTOKEN(recruited.getMultipleKeys);
+				DUMPTOKEN(recruited.getMultipleValues);
 				DUMPTOKEN(recruited.getKeyValues);
 				DUMPTOKEN(recruited.getMappedKeyValues);
 				DUMPTOKEN(recruited.getShardState);
@@ -1740,6 +1856,7 @@ ACTOR Future<Void> workerServer(Reference<IClusterConnectionRecord> connRecord,
 				DUMPTOKEN(recruited.getQueuingMetrics);
 				DUMPTOKEN(recruited.getKeyValueStoreType);
 				DUMPTOKEN(recruited.watchValue);
+				DUMPTOKEN(recruited.watchValues);
 				DUMPTOKEN(recruited.getKeyValuesStream);
 				DUMPTOKEN(recruited.changeFeedStream);
 				DUMPTOKEN(recruited.changeFeedPop);
@@ -1836,6 +1953,8 @@ ACTOR Future<Void> workerServer(Reference<IClusterConnectionRecord> connRecord,
 			// DUMPTOKEN(recruited.getVersion);
 			DUMPTOKEN(recruited.getValue);
 			DUMPTOKEN(recruited.getKey);
+			DUMPTOKEN(recruited.getMultipleKeys);
+			DUMPTOKEN(recruited.getMultipleValues);
 			DUMPTOKEN(recruited.getKeyValues);
 			DUMPTOKEN(recruited.getMappedKeyValues);
 			DUMPTOKEN(recruited.getShardState);
@@ -1846,6 +1965,7 @@ ACTOR Future<Void> workerServer(Reference<IClusterConnectionRecord> connRecord,
 			DUMPTOKEN(recruited.getQueuingMetrics);
 			DUMPTOKEN(recruited.getKeyValueStoreType);
 			DUMPTOKEN(recruited.watchValue);
+			DUMPTOKEN(recruited.watchValues);
 
 			auto f = storageCacheServer(recruited, 0, dbInfo);
 			f = storageCacheRollbackRebooter(f, recruited.id(), recruited.locality, dbInfo);
@@ -2265,6 +2385,8 @@ ACTOR Future<Void> workerServer(Reference<IClusterConnectionRecord> connRecord,
 
 					DUMPTOKEN(recruited.getValue);
 					DUMPTOKEN(recruited.getKey);
+					DUMPTOKEN(recruited.getMultipleKeys);
+					DUMPTOKEN(recruited.getMultipleValues);
 					DUMPTOKEN(recruited.getKeyValues);
 					DUMPTOKEN(recruited.getMappedKeyValues);
 					DUMPTOKEN(recruited.getShardState);
@@ -2277,6 +2399,7 @@ ACTOR Future<Void> workerServer(Reference<IClusterConnectionRecord> connRecord,
 					DUMPTOKEN(recruited.getQueuingMetrics);
 					DUMPTOKEN(recruited.getKeyValueStoreType);
 					DUMPTOKEN(recruited.watchValue);
+					DUMPTOKEN(recruited.watchValues);
 					DUMPTOKEN(recruited.getKeyValuesStream);
 					DUMPTOKEN(recruited.changeFeedStream);
 					DUMPTOKEN(recruited.changeFeedPop);
@@ -75,7 +75,8 @@ struct ConsistencyCheckWorkload : TestWorkload {
 	// SevWarn
 	bool failureIsError;
 
-	// Max number of bytes per second to read from each storage server
+	// Max number of bytes per second to read from each storage server. In a distributed check this budget is
+	// divided evenly among the clients, so it bounds the cluster-wide read rate of the check as a whole
 	int rateLimitMax;
 
 	// DataSet Size
@@ -185,6 +186,42 @@ struct ConsistencyCheckWorkload : TestWorkload {
 		}
 	}
 
+	// Reads the durable progress checkpoint left by a previous in-order scan, if any, so a restarted checker can
+	// resume from where it left off instead of re-reading the whole keyspace
+	ACTOR Future<Optional<Key>> loadCheckProgress(Database cx) {
+		state ReadYourWritesTransaction tr(cx);
+		loop {
+			try {
+				tr.setOption(FDBTransactionOptions::ACCESS_SYSTEM_KEYS);
+				tr.setOption(FDBTransactionOptions::LOCK_AWARE);
+				Optional<Value> progress = wait(tr.get(fdbConsistencyCheckProgressKey));
+				return progress;
+			} catch (Error& e) {
+				wait(tr.onError(e));
+			}
+		}
+	}
+
+	// Durably records that every shard ending at or before `progress` has been checked this round. Clearing the
+	// key (an empty Optional) marks the round as complete, so the next round starts from the beginning.
+	ACTOR Future<Void> saveCheckProgress(Database cx, Optional<Value> progress) {
+		state ReadYourWritesTransaction tr(cx);
+		loop {
+			try {
+				tr.setOption(FDBTransactionOptions::ACCESS_SYSTEM_KEYS);
+				tr.setOption(FDBTransactionOptions::LOCK_AWARE);
+				if (progress.present())
+					tr.set(fdbConsistencyCheckProgressKey, progress.get());
+				else
+					tr.clear(fdbConsistencyCheckProgressKey);
+				wait(tr.commit());
+				return Void();
+			} catch (Error& e) {
+				wait(tr.onError(e));
+			}
+		}
+	}
+
 	ACTOR Future<Void> _start(Database cx, ConsistencyCheckWorkload* self) {
 		loop {
 			while (self->suspendConsistencyCheck.get()) {
@@ -1153,16 +1190,24 @@ struct ConsistencyCheckWorkload : TestWorkload {
 		// Note: this may cause some shards to be processed more than once or not at all in a non-quiescent database
 		state int effectiveClientCount = (self->distributed) ? self->clientCount : 1;
 		state int i = self->clientId * (self->shardSampleFactor + 1);
-		state int increment =
-		    (self->distributed && !self->firstClient) ? effectiveClientCount * self->shardSampleFactor : 1;
+		// A non-distributed check (e.g. the standalone consistencycheck role) also honors shardSampleFactor, so a
+		// continuous check can audit a random sample of shards per round instead of doing a full scan every round
+		state int increment = self->distributed
+		                          ? ((!self->firstClient) ? effectiveClientCount * self->shardSampleFactor : 1)
+		                          : self->shardSampleFactor;
+		// In a distributed check the rate budget is split evenly across the clients, so rateLimitMax bounds the
+		// cluster-wide read rate of the check rather than each client's share of it
+		state int rateLimitCeiling = (self->distributed && self->rateLimitMax > 0)
+		                                 ? std::max(self->rateLimitMax / effectiveClientCount, 1)
+		                                 : self->rateLimitMax;
 		state int rateLimitForThisRound =
 		    self->bytesReadInPreviousRound == 0
-		        ? self->rateLimitMax
+		        ? rateLimitCeiling
 		        : std::min(
-		              self->rateLimitMax,
+		              rateLimitCeiling,
 		              static_cast<int>(ceil(self->bytesReadInPreviousRound /
 		                                    (float)CLIENT_KNOBS->CONSISTENCY_CHECK_ONE_ROUND_TARGET_COMPLETION_TIME)));
-		ASSERT(rateLimitForThisRound >= 0 && rateLimitForThisRound <= self->rateLimitMax);
+		ASSERT(rateLimitForThisRound >= 0 && rateLimitForThisRound <= rateLimitCeiling);
 		TraceEvent("ConsistencyCheck_RateLimitForThisRound").detail("RateLimit", rateLimitForThisRound);
 		state Reference<IRateControl> rateLimiter = Reference<IRateControl>(new SpeedLimit(rateLimitForThisRound, 1));
 		state double rateLimiterStartTime = now();
@@ -1192,6 +1237,26 @@ struct ConsistencyCheckWorkload : TestWorkload {
 			sharedRandom.randomShuffle(shardOrder);
 		}
 
+		// A non-distributed, in-order scan checkpoints its progress in the system keyspace after each shard, so a
+		// restarted checker resumes from the last completed shard instead of starting the round over. Shuffled and
+		// distributed scans do not visit shards in key order and so cannot use a single-key checkpoint.
+		state bool checkpointProgress = !self->distributed && !self->shuffleShards && !self->performQuiescentChecks;
+		state int64_t shardsCheckedThisRound = 0;
+		if (checkpointProgress) {
+			Optional<Key> progress = wait(self->loadCheckProgress(cx));
+			if (progress.present()) {
+				int skippedShards = 0;
+				while (i < ranges.size() && ranges[shardOrder[i]].end <= progress.get()) {
+					i += increment;
+					skippedShards++;
+				}
+				TraceEvent("ConsistencyCheck_ResumingFromCheckpoint")
+				    .detail("Checkpoint", printable(progress.get()))
+				    .detail("SkippedShards", skippedShards)
+				    .detail("TotalShards", ranges.size());
+			}
+		}
+
 		for (; i < ranges.size(); i += increment) {
 			state int shard = shardOrder[i];
 
@@ -1320,6 +1385,20 @@ struct ConsistencyCheckWorkload : TestWorkload {
 					try {
 						lastSampleKey = lastStartSampleKey;
 
+						// A continuous background check yields to foreground traffic: while Ratekeeper reports the
+						// cluster batch-limited, stop issuing reads rather than competing with clients for bandwidth
+						if (self->indefinite && !self->performQuiescentChecks && rateLimitForThisRound > 0) {
+							loop {
+								HealthMetrics healthMetrics = wait(cx->getHealthMetrics(false));
+								if (!healthMetrics.batchLimited)
+									break;
+								TraceEvent("ConsistencyCheck_PausedForClusterLoad")
+								    .suppressFor(60.0)
+								    .detail("TpsLimit", healthMetrics.tpsLimit);
+								wait(delay(5.0));
+							}
+						}
+
 						// Get the min version of the storage servers
 						Version version = wait(self->getVersion(cx, self));
 
@@ -1566,8 +1645,8 @@ struct ConsistencyCheckWorkload : TestWorkload {
 							// Set ratelimit to max allowed if current round has been going on for a while
 							if (now() - rateLimiterStartTime >
 							        1.1 * CLIENT_KNOBS->CONSISTENCY_CHECK_ONE_ROUND_TARGET_COMPLETION_TIME &&
-							    rateLimitForThisRound != self->rateLimitMax) {
-								rateLimitForThisRound = self->rateLimitMax;
+							    rateLimitForThisRound != rateLimitCeiling) {
+								rateLimitForThisRound = rateLimitCeiling;
 								rateLimiter = Reference<IRateControl>(new SpeedLimit(rateLimitForThisRound, 1));
 								rateLimiterStartTime = now();
 								TraceEvent(SevInfo, "ConsistencyCheck_RateLimitSetMaxForThisRound")
@@ -1691,6 +1770,27 @@ struct ConsistencyCheckWorkload : TestWorkload {
 				    .detail("Range", range)
 				    .detail("BytesRead", bytesReadInRange);
 			}
+
+			// Record which team has been checked and how far through the round this client is, so a long-running
+			// check's progress can be followed from the trace logs
+			shardsCheckedThisRound++;
+			TraceEvent("ConsistencyCheck_ShardProgress")
+			    .suppressFor(5.0)
+			    .detail("ShardBegin", printable(range.begin))
+			    .detail("ShardEnd", printable(range.end))
+			    .detail("Team", describe(storageServers))
+			    .detail("ShardsChecked", shardsCheckedThisRound)
+			    .detail("TotalShards", ranges.size())
+			    .detail("BytesReadThisRound", bytesReadInthisRound);
+
+			if (checkpointProgress) {
+				wait(self->saveCheckProgress(cx, Value(range.end)));
+			}
+		}
+
+		if (checkpointProgress) {
+			// The round is complete; clear the checkpoint so the next round starts from the beginning of the keyspace
+			wait(self->saveCheckProgress(cx, Optional<Value>()));
 		}
 
 		// SOMEDAY: when background data distribution is implemented, include this test
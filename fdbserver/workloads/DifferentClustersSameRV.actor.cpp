@@ -127,6 +127,12 @@ struct DifferentClustersSameRVWorkload : TestWorkload {
 
 	ACTOR static Future<Void> doSwitch(Database cx, DifferentClustersSameRVWorkload* self) {
 		state UID lockUid = deterministicRandom()->randomUniqueID();
+		if (deterministicRandom()->coinflip()) {
+			// Sometimes prewarm the standby cluster so the switch path that reuses warm proxy
+			// state gets exercised
+			cx->prewarmConnection(makeReference<ClusterConnectionMemoryRecord>(
+			    self->extraDB->getConnectionRecord()->getConnectionString()));
+		}
 		wait(delay(self->switchAfter));
 		state Future<Void> watchFuture;
 		wait(runRYWTransaction(cx, [=](Reference<ReadYourWritesTransaction> tr) mutable -> Future<Void> {
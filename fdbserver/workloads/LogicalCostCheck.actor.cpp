@@ -0,0 +1,143 @@
+/*
+ * LogicalCostCheck.actor.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fdbclient/DatabaseContext.h"
+#include "fdbclient/NativeAPI.actor.h"
+#include "fdbserver/TesterInterface.actor.h"
+#include "fdbserver/workloads/workloads.actor.h"
+#include "flow/actorcompiler.h" // This must be the last #include.
+
+// Runs a fixed number of simple read-modify-write transactions and checks the logical cost the client paid
+// for them: read version requests, logical and physical reads, and commits, counted per transaction attempt.
+// Run as the only workload of a test, this turns the round-trip count of the simple-transaction path into a
+// tested invariant, so a change that adds an extra GRV or storage server round trip per transaction fails
+// the test deterministically instead of just showing up later as a latency regression.
+struct LogicalCostCheckWorkload : TestWorkload {
+	int opCount;
+	// Physical reads are retried internally on storage server failures, so unlike the other costs they are
+	// only bounded up to a per-attempt budget rather than matched exactly
+	int maxPhysicalReadsPerAttempt;
+	int keyBytes, valueBytes;
+
+	// Transaction attempts made by this client, counting retries; the budgets are per attempt
+	int64_t attempts = 0;
+	// Cost deltas measured across the start phase, evaluated in the check phase
+	int64_t readVersions = 0, logicalReads = 0, physicalReads = 0, commits = 0;
+
+	LogicalCostCheckWorkload(WorkloadContext const& wcx) : TestWorkload(wcx) {
+		opCount = getOption(options, LiteralStringRef("opCount"), 100);
+		maxPhysicalReadsPerAttempt = getOption(options, LiteralStringRef("maxPhysicalReadsPerAttempt"), 10);
+		keyBytes = std::max(getOption(options, LiteralStringRef("keyBytes"), 16), 8);
+		valueBytes = getOption(options, LiteralStringRef("valueBytes"), 16);
+	}
+
+	std::string description() const override { return "LogicalCostCheck"; }
+
+	Future<Void> setup(Database const& cx) override { return Void(); }
+
+	Future<Void> start(Database const& cx) override {
+		if (clientId != 0)
+			return Void();
+		return _start(cx, this);
+	}
+
+	Key keyForIndex(int index) const {
+		Key result = makeString(keyBytes);
+		uint8_t* data = mutateString(result);
+		memset(data, 'x', keyBytes);
+		emplaceIndex(data, 0, (int64_t)index);
+		return result;
+	}
+
+	ACTOR static Future<Void> _start(Database cx, LogicalCostCheckWorkload* self) {
+		state int i;
+		state int64_t readVersionBase = cx->transactionReadVersionsCompleted.getValue();
+		state int64_t logicalReadBase = cx->transactionGetValueRequests.getValue();
+		state int64_t physicalReadBase = cx->transactionPhysicalReadsCompleted.getValue();
+		state int64_t commitBase = cx->transactionsCommitCompleted.getValue();
+
+		for (i = 0; i < self->opCount; i++) {
+			state Transaction tr(cx);
+			loop {
+				try {
+					++self->attempts;
+					wait(success(tr.get(self->keyForIndex(i))));
+					tr.set(self->keyForIndex(i), ValueRef(std::string(self->valueBytes, 'v')));
+					wait(tr.commit());
+					break;
+				} catch (Error& e) {
+					wait(tr.onError(e));
+				}
+			}
+		}
+
+		// Capture the deltas immediately so tester activity on the same Database after the start phase (e.g.
+		// quiescence polling) is not charged to the workload
+		self->readVersions = cx->transactionReadVersionsCompleted.getValue() - readVersionBase;
+		self->logicalReads = cx->transactionGetValueRequests.getValue() - logicalReadBase;
+		self->physicalReads = cx->transactionPhysicalReadsCompleted.getValue() - physicalReadBase;
+		self->commits = cx->transactionsCommitCompleted.getValue() - commitBase;
+		return Void();
+	}
+
+	Future<bool> check(Database const& cx) override {
+		if (clientId != 0)
+			return true;
+		bool ok = true;
+		if (readVersions > attempts) {
+			TraceEvent(SevError, "LogicalCostCheckExtraReadVersions")
+			    .detail("ReadVersions", readVersions)
+			    .detail("Attempts", attempts);
+			ok = false;
+		}
+		if (logicalReads > attempts) {
+			TraceEvent(SevError, "LogicalCostCheckExtraReads")
+			    .detail("LogicalReads", logicalReads)
+			    .detail("Attempts", attempts);
+			ok = false;
+		}
+		if (physicalReads > attempts * maxPhysicalReadsPerAttempt) {
+			TraceEvent(SevError, "LogicalCostCheckExtraPhysicalReads")
+			    .detail("PhysicalReads", physicalReads)
+			    .detail("Attempts", attempts)
+			    .detail("MaxPhysicalReadsPerAttempt", maxPhysicalReadsPerAttempt);
+			ok = false;
+		}
+		if (commits > attempts) {
+			TraceEvent(SevError, "LogicalCostCheckExtraCommits")
+			    .detail("Commits", commits)
+			    .detail("Attempts", attempts);
+			ok = false;
+		}
+		return ok;
+	}
+
+	void getMetrics(std::vector<PerfMetric>& m) override {
+		if (clientId != 0)
+			return;
+		m.emplace_back("Attempts", attempts, Averaged::False);
+		m.emplace_back("ReadVersions", readVersions, Averaged::False);
+		m.emplace_back("LogicalReads", logicalReads, Averaged::False);
+		m.emplace_back("PhysicalReads", physicalReads, Averaged::False);
+		m.emplace_back("Commits", commits, Averaged::False);
+	}
+};
+
+WorkloadFactory<LogicalCostCheckWorkload> LogicalCostCheckWorkloadFactory("LogicalCostCheck");
@@ -42,6 +42,16 @@ void forceLinkRESTClientTests();
 void forceLinkRESTUtilsTests();
 void forceLinkRESTKmsConnectorTest();
 void forceLinkCompressionUtilsTest();
+void forceLinkWorkStealingQueueTests();
+void forceLinkSimdCompareTests();
+void forceLinkTimerWheelTests();
+void forceLinkMPSCRingQueueTests();
+void forceLinkChunkedDequeTests();
+void forceLinkCoroutineTests();
+void forceLinkBinaryTraceLogFormatterTests();
+void forceLinkXXHashBatchTests();
+void forceLinkKeyRangeMapTests();
+void forceLinkVersionstampedQueueTests();
 
 struct UnitTestWorkload : TestWorkload {
 	bool enabled;
@@ -94,6 +104,16 @@ struct UnitTestWorkload : TestWorkload {
 		forceLinkRESTUtilsTests();
 		forceLinkRESTKmsConnectorTest();
 		forceLinkCompressionUtilsTest();
+		forceLinkWorkStealingQueueTests();
+		forceLinkSimdCompareTests();
+		forceLinkTimerWheelTests();
+		forceLinkMPSCRingQueueTests();
+		forceLinkChunkedDequeTests();
+		forceLinkCoroutineTests();
+		forceLinkBinaryTraceLogFormatterTests();
+		forceLinkXXHashBatchTests();
+		forceLinkKeyRangeMapTests();
+		forceLinkVersionstampedQueueTests();
 	}
 
 	std::string description() const override { return "UnitTests"; }
@@ -104,6 +104,49 @@ void makeUndefined(void*, size_t) {}
 #endif
 } // namespace
 
+namespace {
+
+thread_local ArenaTag g_currentArenaTag = ArenaTag::Unknown;
+
+std::atomic<int64_t> g_arenaTagBytes[(int)ArenaTag::COUNT];
+std::atomic<int64_t> g_arenaTagPeakBytes[(int)ArenaTag::COUNT];
+
+void arenaTagAccount(uint8_t tag, int64_t bytes) {
+	ASSERT(tag < (int)ArenaTag::COUNT);
+	int64_t current = g_arenaTagBytes[tag].fetch_add(bytes, std::memory_order_relaxed) + bytes;
+	int64_t peak = g_arenaTagPeakBytes[tag].load(std::memory_order_relaxed);
+	while (current > peak &&
+	       !g_arenaTagPeakBytes[tag].compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+	}
+}
+
+} // namespace
+
+const char* arenaTagName(ArenaTag tag) {
+	static const char* const names[] = { "Unknown", "VersionedMap", "FetchKeys", "Transport", "PageCache" };
+	static_assert(sizeof(names) / sizeof(names[0]) == (int)ArenaTag::COUNT);
+	ASSERT(tag < ArenaTag::COUNT);
+	return names[(int)tag];
+}
+
+int64_t getArenaTagBytes(ArenaTag tag) {
+	ASSERT(tag < ArenaTag::COUNT);
+	return g_arenaTagBytes[(int)tag].load(std::memory_order_relaxed);
+}
+
+int64_t getArenaTagPeakBytes(ArenaTag tag) {
+	ASSERT(tag < ArenaTag::COUNT);
+	return g_arenaTagPeakBytes[(int)tag].load(std::memory_order_relaxed);
+}
+
+ArenaTagScope::ArenaTagScope(ArenaTag tag) : prev(g_currentArenaTag) {
+	g_currentArenaTag = tag;
+}
+
+ArenaTagScope::~ArenaTagScope() {
+	g_currentArenaTag = prev;
+}
+
 Arena::Arena() : impl(nullptr) {}
 Arena::Arena(size_t reservedSize) : impl(0) {
 	UNSTOPPABLE_ASSERT(reservedSize < std::numeric_limits<int>::max());
@@ -133,6 +176,16 @@ void* Arena::allocate4kAlignedBuffer(uint32_t size) {
 	return ArenaBlock::dependOn4kAlignedBuffer(impl, size);
 }
 
+StringRef Arena::adopt(StringRef value, const Arena& source) {
+	double dominantFraction = FLOW_KNOBS ? FLOW_KNOBS->ARENA_ADOPT_DOMINANT_FRACTION : 0.5;
+	if (value.size() > 0 &&
+	    value.size() >= dominantFraction * source.getSize(FastInaccurateEstimate::True)) {
+		dependsOn(source);
+		return value;
+	}
+	return StringRef(*this, value);
+}
+
 FDB_DEFINE_BOOLEAN_PARAM(FastInaccurateEstimate);
 
 size_t Arena::getSize(FastInaccurateEstimate fastInaccurateEstimate) const {
@@ -293,6 +346,7 @@ void* ArenaBlock::make4kAlignedBuffer(uint32_t size) {
 	nextBlockOffset = bigUsed;
 	bigUsed += sizeof(ArenaBlockRef);
 	totalSizeEstimate += size;
+	arenaTagAccount(tag, size);
 	return result;
 }
 
@@ -390,6 +444,8 @@ ArenaBlock* ArenaBlock::create(int dataSize, Reference<ArenaBlock>& next) {
 			b->totalSizeEstimate = b->bigSize;
 			b->tinySize = b->tinyUsed = NOT_TINY;
 			b->bigUsed = sizeof(ArenaBlock);
+			b->tag = (uint8_t)g_currentArenaTag;
+			arenaTagAccount(b->tag, b->bigSize);
 		} else {
 #ifdef ALLOC_INSTRUMENTATION
 			allocInstr["ArenaHugeKB"].alloc((reqSize + 1023) >> 10);
@@ -399,6 +455,8 @@ ArenaBlock* ArenaBlock::create(int dataSize, Reference<ArenaBlock>& next) {
 			b->bigSize = reqSize;
 			b->totalSizeEstimate = b->bigSize;
 			b->bigUsed = sizeof(ArenaBlock);
+			b->tag = (uint8_t)g_currentArenaTag;
+			arenaTagAccount(b->tag, b->bigSize);
 
 #if !DEBUG_DETERMINISM
 			if (FLOW_KNOBS && g_allocation_tracing_disabled == 0 &&
@@ -450,6 +508,7 @@ void ArenaBlock::destroy() {
 				// If aligned4kBuffer is valid, free it
 				if (br->aligned4kBufferSize != 0) {
 					// printf("Arena::aligned4kBuffer free %p\n", br->aligned4kBuffer);
+					arenaTagAccount(b->tag, -(int64_t)br->aligned4kBufferSize);
 					freeFast4kAligned(br->aligned4kBufferSize, br->aligned4kBuffer);
 				} else {
 					allowAccess(br->next);
@@ -475,6 +534,7 @@ void ArenaBlock::destroyLeaf() {
 			INSTRUMENT_RELEASE("Arena64");
 		}
 	} else {
+		arenaTagAccount(tag, -(int64_t)bigSize);
 		if (bigSize <= 128) {
 			FastAllocator<128>::release(this);
 			INSTRUMENT_RELEASE("Arena128");
@@ -661,6 +721,52 @@ TEST_CASE("/flow/Arena/SmallVectorRef10") {
 	return Void();
 }
 
+TEST_CASE("/flow/Arena/TagAccounting") {
+	int64_t before = getArenaTagBytes(ArenaTag::FetchKeys);
+	{
+		ArenaTagScope scope(ArenaTag::FetchKeys);
+		Arena a;
+		new (a) uint8_t[100000];
+		ASSERT(getArenaTagBytes(ArenaTag::FetchKeys) >= before + 100000);
+		ASSERT(getArenaTagPeakBytes(ArenaTag::FetchKeys) >= before + 100000);
+	}
+	// The arena is gone; its blocks must have been debited from the tag
+	ASSERT(getArenaTagBytes(ArenaTag::FetchKeys) == before);
+
+	// A nested scope restores the outer tag
+	int64_t unknownBefore = getArenaTagBytes(ArenaTag::Unknown);
+	Arena outer;
+	{
+		ArenaTagScope scope(ArenaTag::VersionedMap);
+		{ ArenaTagScope inner(ArenaTag::Transport); }
+		Arena b;
+		new (b) uint8_t[100000];
+		ASSERT(getArenaTagBytes(ArenaTag::VersionedMap) >= 100000);
+	}
+	new (outer) uint8_t[100000];
+	ASSERT(getArenaTagBytes(ArenaTag::Unknown) >= unknownBefore + 100000);
+	return Void();
+}
+
+TEST_CASE("/flow/Arena/Adopt") {
+	// A value that dominates its source arena is adopted zero-copy.
+	Arena source;
+	StringRef big(source, std::string(10000, 'x'));
+	Arena dest;
+	StringRef adopted = dest.adopt(big, source);
+	ASSERT(adopted.begin() == big.begin());
+
+	// A small value in a large arena is copied so the source can be freed.
+	Arena source2;
+	StringRef small(source2, "abc"_sr);
+	(void)new (source2) uint8_t[100000];
+	Arena dest2;
+	StringRef adopted2 = dest2.adopt(small, source2);
+	ASSERT(adopted2 == small);
+	ASSERT(adopted2.begin() != small.begin());
+	return Void();
+}
+
 TEST_CASE("/flow/Arena/OptionalHash") {
 	std::hash<Optional<int>> hashFunc{};
 	Optional<int> a;
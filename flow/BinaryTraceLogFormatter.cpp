@@ -0,0 +1,209 @@
+/*
+ * BinaryTraceLogFormatter.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flow/flow.h"
+#include "flow/BinaryTraceLogFormatter.h"
+#include "flow/UnitTest.h"
+
+namespace {
+
+const char* const BINARY_TRACE_MAGIC = "FDBTRACEBIN1\n";
+
+void putVarint(std::string& out, uint64_t v) {
+	while (v >= 0x80) {
+		out.push_back(char((v & 0x7f) | 0x80));
+		v >>= 7;
+	}
+	out.push_back(char(v));
+}
+
+// Returns false if the input is truncated or the varint is malformed.
+bool getVarint(const char*& p, const char* end, uint64_t& v) {
+	v = 0;
+	for (int shift = 0; shift < 64; shift += 7) {
+		if (p == end) {
+			return false;
+		}
+		uint8_t b = uint8_t(*p++);
+		v |= uint64_t(b & 0x7f) << shift;
+		if (!(b & 0x80)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void xmlEscape(std::string& out, std::string const& source) {
+	for (char c : source) {
+		if (c == '&') {
+			out += "&amp;";
+		} else if (c == '"') {
+			out += "&quot;";
+		} else if (c == '<') {
+			out += "&lt;";
+		} else if (c == '>') {
+			out += "&gt;";
+		} else if (c == '\r' || c == '\n' || c == '\0') {
+			out += " ";
+		} else {
+			out += c;
+		}
+	}
+}
+
+} // namespace
+
+void BinaryTraceLogFormatter::addref() {
+	ReferenceCounted<BinaryTraceLogFormatter>::addref();
+}
+
+void BinaryTraceLogFormatter::delref() {
+	ReferenceCounted<BinaryTraceLogFormatter>::delref();
+}
+
+const char* BinaryTraceLogFormatter::getExtension() const {
+	return "bin";
+}
+
+const char* BinaryTraceLogFormatter::getHeader() const {
+	// A new header means a new file; reset the token table so every file is
+	// decodable on its own.
+	nameTokens.clear();
+	return BINARY_TRACE_MAGIC;
+}
+
+const char* BinaryTraceLogFormatter::getFooter() const {
+	return "";
+}
+
+std::string BinaryTraceLogFormatter::formatEvent(const TraceEventFields& fields) const {
+	std::string out;
+	out.reserve(16 + fields.sizeBytes() / 4);
+	putVarint(out, fields.size());
+	for (auto const& field : fields) {
+		auto itr = nameTokens.find(field.first);
+		if (itr == nameTokens.end()) {
+			// Token 0 introduces a new field name; it gets the next token id.
+			nameTokens.emplace(field.first, (uint32_t)nameTokens.size() + 1);
+			putVarint(out, 0);
+			putVarint(out, field.first.size());
+			out += field.first;
+		} else {
+			putVarint(out, itr->second);
+		}
+		putVarint(out, field.second.size());
+		out += field.second;
+	}
+	return out;
+}
+
+std::string binaryTraceToXml(std::string const& data) {
+	const char* p = data.data();
+	const char* end = p + data.size();
+
+	size_t magicLen = strlen(BINARY_TRACE_MAGIC);
+	if (data.size() < magicLen || memcmp(p, BINARY_TRACE_MAGIC, magicLen) != 0) {
+		throw io_error();
+	}
+	p += magicLen;
+
+	std::vector<std::string> names;
+	std::string out = "<?xml version=\"1.0\"?>\r\n<Trace>\r\n";
+	while (p != end) {
+		uint64_t numFields;
+		if (!getVarint(p, end, numFields)) {
+			throw io_error();
+		}
+		out += "<Event ";
+		for (uint64_t i = 0; i < numFields; i++) {
+			uint64_t token;
+			if (!getVarint(p, end, token)) {
+				throw io_error();
+			}
+			if (token == 0) {
+				uint64_t len;
+				if (!getVarint(p, end, len) || uint64_t(end - p) < len) {
+					throw io_error();
+				}
+				names.emplace_back(p, len);
+				p += len;
+				token = names.size();
+			} else if (token > names.size()) {
+				throw io_error();
+			}
+			uint64_t len;
+			if (!getVarint(p, end, len) || uint64_t(end - p) < len) {
+				throw io_error();
+			}
+			xmlEscape(out, names[token - 1]);
+			out += "=\"";
+			xmlEscape(out, std::string(p, len));
+			out += "\" ";
+			p += len;
+		}
+		out += "/>\n";
+	}
+	out += "</Trace>\r\n";
+	return out;
+}
+
+TEST_CASE("/flow/BinaryTraceLogFormatter/roundtrip") {
+	BinaryTraceLogFormatter formatter;
+
+	std::string file = formatter.getHeader();
+	std::string expected = "<?xml version=\"1.0\"?>\r\n<Trace>\r\n";
+	for (int i = 0; i < 100; i++) {
+		TraceEventFields fields;
+		fields.addField("Severity", "10");
+		fields.addField("Time", format("%d.%06d", i, i));
+		fields.addField("Type", format("TestEvent%d", i % 7));
+		if (i % 3 == 0) {
+			fields.addField("Details", "quoted \"value\" with <markup> & newline\n");
+		}
+		file += formatter.formatEvent(fields);
+
+		expected += "<Event ";
+		for (auto const& field : fields) {
+			std::string v;
+			xmlEscape(v, field.second);
+			expected += field.first + "=\"" + v + "\" ";
+		}
+		expected += "/>\n";
+	}
+	file += formatter.getFooter();
+	expected += "</Trace>\r\n";
+
+	ASSERT(binaryTraceToXml(file) == expected);
+
+	// Repeated field names are token references, not repeated text
+	ASSERT(file.size() < expected.size());
+
+	// A rolled file resets the token table and decodes on its own
+	std::string second = formatter.getHeader();
+	TraceEventFields fields;
+	fields.addField("Severity", "20");
+	second += formatter.formatEvent(fields);
+	ASSERT(binaryTraceToXml(second) ==
+	       "<?xml version=\"1.0\"?>\r\n<Trace>\r\n<Event Severity=\"20\" />\n</Trace>\r\n");
+
+	return Void();
+}
+
+void forceLinkBinaryTraceLogFormatterTests() {}
@@ -0,0 +1,82 @@
+/*
+ * ChunkedDeque.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <deque>
+
+#include "flow/UnitTest.h"
+#include "flow/ChunkedDeque.h"
+
+TEST_CASE("/flow/ChunkedDeque/12345") {
+	ChunkedDeque<int> q;
+	q.push_back(1);
+	q.push_back(2);
+	q.push_back(3);
+	q.pop_front();
+	q.push_back(4);
+	q.pop_back();
+	q.push_back(5);
+	q.push_back(6);
+	q.pop_front();
+	q.pop_back();
+	ASSERT(q.size() == 2 && q[0] == 3 && q[1] == 5);
+	return Void();
+}
+
+TEST_CASE("/flow/ChunkedDeque/randomOps") {
+	// Small segments so segment allocation, release, and map growth are all
+	// exercised; compare against std::deque at every step.
+	ChunkedDeque<int, 8> q;
+	std::deque<int> ref;
+	for (int op = 0; op < 100000; op++) {
+		int r = deterministicRandom()->randomInt(0, 100);
+		if (r < 45) {
+			int v = deterministicRandom()->randomInt(0, 1 << 30);
+			q.push_back(v);
+			ref.push_back(v);
+		} else if (r < 75) {
+			if (!ref.empty()) {
+				q.pop_front();
+				ref.pop_front();
+			}
+		} else if (r < 99) {
+			if (!ref.empty()) {
+				q.pop_back();
+				ref.pop_back();
+			}
+		} else {
+			q.clear();
+			ref.clear();
+		}
+		ASSERT(q.size() == ref.size());
+		if (!ref.empty()) {
+			ASSERT(q.front() == ref.front());
+			ASSERT(q.back() == ref.back());
+			int i = deterministicRandom()->randomInt(0, ref.size());
+			ASSERT(q[i] == ref[i]);
+		}
+	}
+	ChunkedDeque<int, 8> copy(q);
+	ASSERT(copy == q);
+	ChunkedDeque<int, 8> moved(std::move(copy));
+	ASSERT(moved == q);
+	return Void();
+}
+
+void forceLinkChunkedDequeTests() {}
@@ -0,0 +1,65 @@
+/*
+ * Coroutines.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flow/Coroutines.h"
+#include "flow/UnitTest.h"
+
+#if FLOW_HAS_COROUTINES
+
+namespace {
+
+Future<int> addOne(Future<int> in) {
+	int v = co_await in;
+	co_return v + 1;
+}
+
+Future<Void> rethrows(Future<int> in) {
+	co_await in;
+	co_return;
+}
+
+} // namespace
+
+// Coroutines awaiting already-ready futures run to completion synchronously
+// (like an actor that never blocks), so these cases need no running network.
+TEST_CASE("/flow/coro/readyValue") {
+	Future<int> f = addOne(Future<int>(41));
+	ASSERT(f.isReady() && f.get() == 42);
+	return Void();
+}
+
+TEST_CASE("/flow/coro/errorPropagation") {
+	Future<Void> f = rethrows(Future<int>(end_of_stream()));
+	ASSERT(f.isError() && f.getError().code() == error_code_end_of_stream);
+	return Void();
+}
+
+TEST_CASE("/flow/coro/deferredValue") {
+	Promise<int> p;
+	Future<int> f = addOne(p.getFuture());
+	ASSERT(!f.isReady());
+	p.send(6);
+	ASSERT(f.isReady() && f.get() == 7);
+	return Void();
+}
+
+#endif // FLOW_HAS_COROUTINES
+
+void forceLinkCoroutineTests() {}
@@ -41,6 +41,8 @@
 #ifdef __linux__
 #include <sys/mman.h>
 #include <linux/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 #endif
 
 #ifdef __FreeBSD__
@@ -239,10 +241,39 @@ void recordDeallocation(void* ptr) {
 #endif
 }
 
+// The global magazine pool is striped by NUMA node so that a thread refilling
+// its freelist preferentially receives a magazine that was last touched on its
+// own socket.  On single-socket hosts every thread maps to node 0 and the
+// behavior is identical to the old single pool.
+constexpr int FAST_ALLOC_MAX_NUMA_NODES = 8;
+
+// Returns the NUMA node of the calling thread's current CPU, cached per
+// thread.  fdbserver pins worker threads rarely migrate across sockets, so a
+// once-per-thread answer is accurate enough for pool selection and avoids a
+// syscall on the allocation path.
+static int fastAllocNumaNode() noexcept {
+#ifdef __linux__
+	static thread_local int cachedNode = -1;
+	if (cachedNode < 0) {
+		unsigned cpu = 0, node = 0;
+		if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+			cachedNode = node % FAST_ALLOC_MAX_NUMA_NODES;
+		} else {
+			cachedNode = 0;
+		}
+	}
+	return cachedNode;
+#else
+	return 0;
+#endif
+}
+
 template <int Size>
 struct FastAllocator<Size>::GlobalData {
 	CRITICAL_SECTION mutex;
-	std::vector<void*> magazines; // These magazines are always exactly magazine_size ("full")
+	// Full magazines (always exactly magazine_size entries), striped by the
+	// NUMA node of the thread that released them.
+	std::vector<void*> magazines[FAST_ALLOC_MAX_NUMA_NODES];
 	std::vector<std::pair<int, void*>>
 	    partial_magazines; // Magazines that are not "full" and their counts.  Only created by releaseThreadMagazines().
 	std::atomic<long long> totalMemory;
@@ -251,6 +282,13 @@ struct FastAllocator<Size>::GlobalData {
 	GlobalData() : totalMemory(0), partialMagazineUnallocatedMemory(0), activeThreads(0) {
 		InitializeCriticalSection(&mutex);
 	}
+	long long fullMagazineCount() const {
+		long long count = 0;
+		for (auto& m : magazines) {
+			count += m.size();
+		}
+		return count;
+	}
 };
 
 template <int Size>
@@ -263,7 +301,7 @@ template <int Size>
 long long FastAllocator<Size>::getApproximateMemoryUnused() {
 	EnterCriticalSection(&globalData()->mutex);
 	long long unused =
-	    globalData()->magazines.size() * magazine_size * Size + globalData()->partialMagazineUnallocatedMemory;
+	    globalData()->fullMagazineCount() * magazine_size * Size + globalData()->partialMagazineUnallocatedMemory;
 	LeaveCriticalSection(&globalData()->mutex);
 	return unused;
 }
@@ -464,15 +502,22 @@ void FastAllocator<Size>::getMagazine() {
 	ThreadData& thr = threadData();
 	ASSERT(!thr.freelist && !thr.alternate && thr.count == 0);
 
+	int node = fastAllocNumaNode();
 	EnterCriticalSection(&globalData()->mutex);
-	if (globalData()->magazines.size()) {
-		void* m = globalData()->magazines.back();
-		globalData()->magazines.pop_back();
-		LeaveCriticalSection(&globalData()->mutex);
-		thr.freelist = m;
-		thr.count = magazine_size;
-		return;
-	} else if (globalData()->partial_magazines.size()) {
+	// Prefer a node-local magazine; fall back to remote nodes before going to
+	// the system allocator so total memory is unchanged by the striping.
+	for (int i = 0; i < FAST_ALLOC_MAX_NUMA_NODES; i++) {
+		auto& pool = globalData()->magazines[(node + i) % FAST_ALLOC_MAX_NUMA_NODES];
+		if (pool.size()) {
+			void* m = pool.back();
+			pool.pop_back();
+			LeaveCriticalSection(&globalData()->mutex);
+			thr.freelist = m;
+			thr.count = magazine_size;
+			return;
+		}
+	}
+	if (globalData()->partial_magazines.size()) {
 		std::pair<int, void*> p = globalData()->partial_magazines.back();
 		globalData()->partial_magazines.pop_back();
 		globalData()->partialMagazineUnallocatedMemory -= p.first * Size;
@@ -540,8 +585,9 @@ void FastAllocator<Size>::getMagazine() {
 }
 template <int Size>
 void FastAllocator<Size>::releaseMagazine(void* mag) {
+	int node = fastAllocNumaNode();
 	EnterCriticalSection(&globalData()->mutex);
-	globalData()->magazines.push_back(mag);
+	globalData()->magazines[node].push_back(mag);
 	LeaveCriticalSection(&globalData()->mutex);
 }
 template <int Size>
@@ -553,7 +599,7 @@ FastAllocator<Size>::ThreadData::~ThreadData() {
 		globalData()->partialMagazineUnallocatedMemory += count * Size;
 	}
 	if (alternate) {
-		globalData()->magazines.push_back(alternate);
+		globalData()->magazines[fastAllocNumaNode()].push_back(alternate);
 	}
 	globalData()->activeThreads.fetch_add(-1);
 	LeaveCriticalSection(&globalData()->mutex);
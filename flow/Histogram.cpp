@@ -89,6 +89,7 @@ const char* const Histogram::UnitToStringMapper[] = { "microseconds", "bytes", "
 	                                                  "percentage",   "count", "none" };
 
 void Histogram::writeToLog(double elapsed) {
+	mergeStripes();
 	bool active = false;
 	for (uint32_t i = 0; i < 32; i++) {
 		if (buckets[i]) {
@@ -138,6 +139,7 @@ void Histogram::writeToLog(double elapsed) {
 }
 
 std::string Histogram::drawHistogram() {
+	mergeStripes();
 
 	std::stringstream result;
 
@@ -210,38 +212,38 @@ TEST_CASE("/flow/histogram/smoke_test") {
 		    Histogram::getHistogram(LiteralStringRef("smoke_test"), LiteralStringRef("counts"), Histogram::Unit::bytes);
 
 		h->sample(0);
-		ASSERT(h->buckets[0] == 1);
+		ASSERT(h->bucketCount(0) == 1);
 		h->sample(1);
-		ASSERT(h->buckets[0] == 2);
+		ASSERT(h->bucketCount(0) == 2);
 
 		h->sample(2);
-		ASSERT(h->buckets[1] == 1);
+		ASSERT(h->bucketCount(1) == 1);
 
 		GetHistogramRegistry().logReport();
 
-		ASSERT(h->buckets[0] == 0);
+		ASSERT(h->bucketCount(0) == 0);
 		h->sample(0);
-		ASSERT(h->buckets[0] == 1);
+		ASSERT(h->bucketCount(0) == 1);
 		h = Histogram::getHistogram(
 		    LiteralStringRef("smoke_test"), LiteralStringRef("counts2"), Histogram::Unit::bytes);
 
 		// confirm that old h was deallocated.
 		h = Histogram::getHistogram(LiteralStringRef("smoke_test"), LiteralStringRef("counts"), Histogram::Unit::bytes);
-		ASSERT(h->buckets[0] == 0);
+		ASSERT(h->bucketCount(0) == 0);
 
 		h = Histogram::getHistogram(
 		    LiteralStringRef("smoke_test"), LiteralStringRef("times"), Histogram::Unit::microseconds);
 
 		h->sampleSeconds(0.000000);
 		h->sampleSeconds(0.0000019);
-		ASSERT(h->buckets[0] == 2);
+		ASSERT(h->bucketCount(0) == 2);
 		h->sampleSeconds(0.0000021);
-		ASSERT(h->buckets[1] == 1);
+		ASSERT(h->bucketCount(1) == 1);
 		h->sampleSeconds(0.000015);
-		ASSERT(h->buckets[3] == 1);
+		ASSERT(h->bucketCount(3) == 1);
 
 		h->sampleSeconds(4400.0);
-		ASSERT(h->buckets[31] == 1);
+		ASSERT(h->bucketCount(31) == 1);
 
 		GetHistogramRegistry().logReport();
 	}
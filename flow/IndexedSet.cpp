@@ -198,6 +198,42 @@ TEST_CASE("/flow/IndexedSet/random ops") {
 	return Void();
 }
 
+TEST_CASE("/flow/IndexedSet/bulk build") {
+	for (int t = 0; t < 20; t++) {
+		int n = deterministicRandom()->randomInt(0, 100000);
+		std::vector<std::pair<int, int>> data;
+		data.reserve(n);
+		for (int i = 0; i < n; i++)
+			data.emplace_back(i * 2, 3);
+
+		IndexedSet<int, int> is;
+		is.bulkBuild(data);
+		is.testonly_assertBalanced();
+
+		int count = 0;
+		for (auto i : is) {
+			ASSERT(i == count * 2);
+			++count;
+		}
+		ASSERT(count == n);
+		ASSERT(is.sumTo(is.end()) == n * 3);
+		if (n > 0) {
+			int q = deterministicRandom()->randomInt(0, n);
+			ASSERT(is.sumTo(is.lower_bound(q * 2)) == q * 3);
+		}
+
+		// The bulk-built tree must behave like any other under later mutation
+		for (int i = 0; i < 1000; i++) {
+			if (deterministicRandom()->coinflip())
+				is.insert(deterministicRandom()->randomInt(0, 200000), 3);
+			else
+				is.erase(is.lower_bound(deterministicRandom()->randomInt(0, 200000)));
+		}
+		is.testonly_assertBalanced();
+	}
+	return Void();
+}
+
 TEST_CASE("/flow/IndexedSet/strings") {
 	Map<std::string, int> myMap;
 	std::map<std::string, int> aMap;
@@ -57,6 +57,9 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 
 	init( DISABLE_ASSERTS,                                       0 );
 	init( QUEUE_MODEL_SMOOTHING_AMOUNT,                        2.0 );
+	init( QUEUE_MODEL_PENALTY_DECAY_TIME,                     10.0 ); if( randomize && BUGGIFY ) QUEUE_MODEL_PENALTY_DECAY_TIME = 1.0;
+	init( QUEUE_MODEL_PROBE_INTERVAL,                          5.0 );
+	init( QUEUE_MODEL_SHARED_STATE,                          false ); // share endpoint measurements between all QueueModels on a network thread; ignored in simulation
 
 	init( RUN_LOOP_PROFILING_INTERVAL,                       0.125 ); // A value of 0 disables run loop profiling
 	init( SLOWTASK_PROFILING_LOG_INTERVAL,                       0 ); // A value of 0 means use RUN_LOOP_PROFILING_INTERVAL
@@ -71,6 +74,7 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( FAST_ALLOC_LOGGING_BYTES,                           10e6 );
 	init( HUGE_ARENA_LOGGING_BYTES,                          100e6 );
 	init( HUGE_ARENA_LOGGING_INTERVAL,                         5.0 );
+	init( ARENA_ADOPT_DOMINANT_FRACTION,                       0.5 );
 
 	init( MEMORY_USAGE_CHECK_INTERVAL,                         1.0 );
 
@@ -90,6 +94,7 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( CONNECTION_MONITOR_TIMEOUT,     isSimulated ? 1.50 : 2.0 ); if( randomize && BUGGIFY ) CONNECTION_MONITOR_TIMEOUT = 6.0;
 	init( CONNECTION_MONITOR_IDLE_TIMEOUT,                   180.0 ); if( randomize && BUGGIFY ) CONNECTION_MONITOR_IDLE_TIMEOUT = 5.0;
 	init( CONNECTION_MONITOR_INCOMING_IDLE_MULTIPLIER,         1.2 );
+	init( CONNECTION_MONITOR_BUSY_PING_INTERVAL,              10.0 ); if( randomize && BUGGIFY ) CONNECTION_MONITOR_BUSY_PING_INTERVAL = 0;
 	init( CONNECTION_MONITOR_UNREFERENCED_CLOSE_DELAY,         2.0 );
 
 	//FlowTransport
@@ -120,6 +125,8 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( TLS_HANDSHAKE_THREAD_STACKSIZE,                64 * 1024 );
 	init( TLS_MALLOC_ARENA_MAX,                                  6 );
 	init( TLS_HANDSHAKE_LIMIT,                                1000 );
+	init( TLS_SESSION_RESUMPTION,                             true ); if( randomize && BUGGIFY ) TLS_SESSION_RESUMPTION = false;
+	init( TLS_SESSION_CACHE_SIZE,                              256 );
 
 	init( NETWORK_TEST_CLIENT_COUNT,                            30 );
 	init( NETWORK_TEST_REPLY_SIZE,                           600e3 );
@@ -158,6 +165,7 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( DISK_METRIC_LOGGING_INTERVAL,                        5.0 );
 
 	init( PAGE_WRITE_CHECKSUM_HISTORY,                           0 ); if( randomize && BUGGIFY ) PAGE_WRITE_CHECKSUM_HISTORY = 10000000;
+	init( PAGE_WRITE_CHECKSUM_SAMPLE_RATE,                     1.0 ); if( randomize && BUGGIFY ) PAGE_WRITE_CHECKSUM_SAMPLE_RATE = deterministicRandom()->random01();
 	init( DISABLE_POSIX_KERNEL_AIO,                              0 );
 
 	//AsyncFileNonDurable
@@ -183,6 +191,7 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	//Net2 and FlowTransport
 	init( MIN_COALESCE_DELAY,                                10e-6 ); if( randomize && BUGGIFY ) MIN_COALESCE_DELAY = 0;
 	init( MAX_COALESCE_DELAY,                                20e-6 ); if( randomize && BUGGIFY ) MAX_COALESCE_DELAY = 0;
+	init( COALESCE_IDLE_THRESHOLD,                          200e-6 ); if( randomize && BUGGIFY ) COALESCE_IDLE_THRESHOLD = 0; // Peers idle this long skip the coalesce delay; 0 to always delay
 	init( SLOW_LOOP_CUTOFF,                          15.0 / 1000.0 );
 	init( SLOW_LOOP_SAMPLING_RATE,                             0.1 );
 	init( TSC_YIELD_TIME,                                  1000000 );
@@ -190,6 +199,13 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( CERT_FILE_MAX_SIZE,                      5 * 1024 * 1024 );
 	init( READY_QUEUE_RESERVED_SIZE,                          8192 );
 	init( TASKS_PER_REACTOR_CHECK,                             100 );
+	init( RUN_LOOP_STARVATION_THRESHOLD,                       1.0 ); // Ready tasks waiting longer than this log a RunLoopStarvation warning
+	init( NET2_REACTOR_SHARDS,                                   1 ); // A value > 1 starts auxiliary work-stealing run loops (experimental)
+	init( NET2_WORK_STEAL_BATCH,                                16 );
+	init( NET2_TIMER_WHEEL_RESOLUTION,                      0.0005 ); // 0 keeps the binary-heap timer queue
+	init( NET2_TIMER_WHEEL_SLOTS,                             4096 );
+	init( NET2_THREAD_READY_RING_SIZE,                        4096 );
+	init( NET2_RUN_LOOP_SPIN_WINDOW,                             0 ); // seconds to busy-poll after activity before sleeping; 0 == always sleep
 
 	//Network
 	init( PACKET_LIMIT,                                  100LL<<20 );
@@ -206,6 +222,8 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( MAX_OPEN_TIME,                                    0.0012 );
 	init( SIM_DISK_IOPS,                                      5000 );
 	init( SIM_DISK_BANDWIDTH,                             50000000 );
+	init( SIM_DISK_PROFILE_FILE,                                "" ); // Device profiles captured from real hosts; each simulated machine picks one
+
 	init( MIN_NETWORK_LATENCY,                              100e-6 );
 	init( FAST_NETWORK_LATENCY,                             800e-6 );
 	init( SLOW_NETWORK_LATENCY,                             100e-3 );
@@ -288,6 +306,8 @@ void FlowKnobs::initialize(Randomize randomize, IsSimulated isSimulated) {
 	init( ENCRYPT_KEY_REFRESH_INTERVAL,   isSimulated ? 60 : 8 * 60 );
 	if ( randomize && BUGGIFY) { ENCRYPT_KEY_REFRESH_INTERVAL = deterministicRandom()->randomInt(2, 10); }
 	init( TOKEN_CACHE_SIZE,                                    100 );
+	init( TOKEN_NEGATIVE_CACHE_SIZE,                           100 );
+	init( TOKEN_NEGATIVE_CACHE_TTL,                           30.0 );
 
 	// REST Client
 	init( RESTCLIENT_MAX_CONNECTIONPOOL_SIZE,                   10 );
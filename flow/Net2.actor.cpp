@@ -26,6 +26,7 @@
 #include "flow/Trace.h"
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #define BOOST_SYSTEM_NO_LIB
 #define BOOST_DATE_TIME_NO_LIB
 #define BOOST_REGEX_NO_LIB
@@ -44,7 +45,11 @@
 #include "flow/ActorCollection.h"
 #include "flow/ThreadSafeQueue.h"
 #include "flow/ThreadHelper.actor.h"
+#include "flow/MPSCRingQueue.h"
+#include "flow/TimerWheel.h"
+#include "flow/WorkStealingQueue.h"
 #include "flow/TDMetric.actor.h"
+#include "flow/Histogram.h"
 #include "flow/AsioReactor.h"
 #include "flow/Profiler.h"
 #include "flow/ProtocolVersion.h"
@@ -117,6 +122,9 @@ struct OrderedTask {
 	int64_t priority;
 	TaskPriority taskID;
 	Task* task;
+	// When the task entered the ready queue (timer_monotonic based), or 0 if the enqueue path doesn't track it
+	double makeReady = 0;
+	OrderedTask() : priority(0), taskID(TaskPriority::Zero), task(nullptr) {}
 	OrderedTask(int64_t priority, TaskPriority taskID, Task* task) : priority(priority), taskID(taskID), task(task) {}
 	bool operator<(OrderedTask const& rhs) const { return priority < rhs.priority; }
 };
@@ -266,6 +274,22 @@ public:
 
 	ReadyQueue<OrderedTask> ready;
 	ThreadSafeQueue<OrderedTask> threadReady;
+	// Bounded lock-free fast path in front of threadReady: cross-thread posts
+	// take one CAS here and fall back to threadReady only when the ring is
+	// full, with wakeups coalesced to one per consumer sleep cycle.
+	MPSCRingQueue<OrderedTask> threadReadyRing;
+
+	// Experimental multi-reactor mode (NET2_REACTOR_SHARDS > 1): auxiliary run
+	// loops drain a sharded ready queue with work stealing between shards.
+	// Only tasks that are safe to run off the main network thread may be
+	// posted with postAuxTask(); ordinary actor continuations still run on the
+	// main run loop.
+	std::unique_ptr<WorkStealingQueue<OrderedTask>> auxReady;
+	std::vector<THREAD_HANDLE> auxReactorThreads;
+	Event auxReactorWake;
+	int64_t nextAuxShard = 0;
+	void postAuxTask(Task* task, TaskPriority taskID);
+	void runAuxReactor(int shard);
 
 	struct DelayedTask : OrderedTask {
 		double at;
@@ -274,11 +298,27 @@ public:
 		bool operator<(DelayedTask const& rhs) const { return at > rhs.at; } // Ordering is reversed for priority_queue
 	};
 	std::priority_queue<DelayedTask, std::vector<DelayedTask>> timers;
+	// When NET2_TIMER_WHEEL_RESOLUTION > 0, pending timers live in a timing
+	// wheel with O(1) insert/expiry instead of the binary heap above.
+	TimerWheel<DelayedTask> timerWheel;
+	bool useTimerWheel;
+	void pushTimer(DelayedTask const& task) {
+		if (useTimerWheel)
+			timerWheel.push(task);
+		else
+			timers.push(task);
+	}
+
+	// Timestamp of the last run-loop iteration that found work; used by the
+	// adaptive-spin sleep path below.
+	double lastActivityTime = 0;
+	bool spinPollReactor(double spinUntil);
 
 	void checkForSlowTask(int64_t tscBegin, int64_t tscEnd, double duration, TaskPriority priority);
 	bool check_yield(TaskPriority taskId, int64_t tscNow);
 	void processThreadReady();
 	void trackAtPriority(TaskPriority priority, double now);
+	void recordQueueWait(TaskPriority priority, double age);
 	void stopImmediately() {
 #ifdef ADDRESS_SANITIZER
 		// Do leak check before intentionally leaking a bunch of memory
@@ -289,6 +329,7 @@ public:
 		ready.swap(_1);
 		decltype(timers) _2;
 		timers.swap(_2);
+		timerWheel.clear();
 	}
 
 	Future<Void> timeOffsetLogger;
@@ -306,6 +347,7 @@ public:
 	Int64MetricHandle countRunLoop;
 	Int64MetricHandle countCantSleep;
 	Int64MetricHandle countWontSleep;
+	Int64MetricHandle countRunLoopSpins;
 	Int64MetricHandle countTimers;
 	Int64MetricHandle countTasks;
 	Int64MetricHandle countYields;
@@ -322,6 +364,9 @@ public:
 
 	EventMetricHandle<SlowTask> slowTaskMetric;
 
+	// Time tasks spent in the ready queue before running, bucketed per TaskPriority
+	std::unordered_map<TaskPriority, Reference<Histogram>> queueWaitHistograms;
+
 	std::vector<std::string> blobCredentialFiles;
 	std::vector<std::function<void()>> stopCallbacks;
 };
@@ -827,6 +872,77 @@ struct SSLHandshakerThread final : IThreadPoolReceiver {
 	}
 };
 
+// Cache of client TLS sessions, keyed by peer address, used to resume sessions when reconnecting to a
+// peer. Resumption skips the certificate exchange and asymmetric crypto of a full handshake, which is
+// what burns CPU on every process at once when a network blip forces the whole cluster to reconnect.
+// Sessions are captured through the SSL context's new-session callback because TLS 1.3 tickets are
+// issued after the handshake completes; the callback can run on a handshaker pool thread, so the cache
+// takes a lock. Cached sessions are single use: TLS 1.3 forbids ticket reuse and the server issues
+// fresh tickets on each connection.
+class TLSSessionCache : NonCopyable {
+public:
+	static TLSSessionCache& instance() {
+		static TLSSessionCache cache;
+		return cache;
+	}
+
+	// Index of the SSL ex-data slot holding the cache key of a client connection, or nullptr for
+	// connections (e.g. accepted ones) whose sessions should not be cached
+	static int exDataIndex() {
+		static int index = SSL_get_ex_new_index(0, (void*)"TLSSessionCacheKey", nullptr, nullptr, nullptr);
+		return index;
+	}
+
+	// Called from the SSL context's new-session callback. Takes ownership of session and returns true,
+	// or returns false to let OpenSSL free it.
+	bool store(SSL* ssl, SSL_SESSION* session) {
+		const char* key = static_cast<const char*>(SSL_get_ex_data(ssl, exDataIndex()));
+		if (key == nullptr)
+			return false;
+		std::lock_guard<std::mutex> lock(mutex);
+		auto [it, inserted] = sessions.emplace(key, session);
+		if (!inserted) {
+			SSL_SESSION_free(it->second);
+			it->second = session;
+		} else if (sessions.size() > (size_t)FLOW_KNOBS->TLS_SESSION_CACHE_SIZE) {
+			// Evict an arbitrary peer; reconnecting to it just pays a full handshake
+			auto victim = sessions.begin();
+			if (victim == it)
+				++victim;
+			SSL_SESSION_free(victim->second);
+			sessions.erase(victim);
+		}
+		return true;
+	}
+
+	// Attaches the cached session for key to ssl, if there is one, and removes it from the cache
+	void resume(SSL* ssl, const std::string& key) {
+		std::lock_guard<std::mutex> lock(mutex);
+		auto it = sessions.find(key);
+		if (it == sessions.end())
+			return;
+		SSL_set_session(ssl, it->second); // takes its own reference
+		SSL_SESSION_free(it->second);
+		sessions.erase(it);
+	}
+
+private:
+	std::mutex mutex;
+	std::unordered_map<std::string, SSL_SESSION*> sessions;
+};
+
+// Enables TLS session resumption on an SSL context: server-side resumption uses stateless session
+// tickets, and client sessions are routed to TLSSessionCache rather than OpenSSL's internal store so
+// they can be looked up by peer address.
+void configureSessionResumption(boost::asio::ssl::context* context) {
+	if (!FLOW_KNOBS->TLS_SESSION_RESUMPTION)
+		return;
+	SSL_CTX* ctx = context->native_handle();
+	SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+	SSL_CTX_sess_set_new_cb(
+	    ctx, [](SSL* ssl, SSL_SESSION* session) -> int { return TLSSessionCache::instance().store(ssl, session); });
+}
+
 class SSLConnection final : public IConnection, ReferenceCounted<SSLConnection> {
 public:
 	void addref() override { ReferenceCounted<SSLConnection>::addref(); }
@@ -899,8 +1015,9 @@ public:
 		try {
 			Future<Void> onHandshook;
 
-			// If the background handshakers are not all busy, use one
-			if (N2::g_net2->sslPoolHandshakesInProgress < N2::g_net2->sslHandshakerThreadsStarted) {
+			// Always use a background handshaker if any were started; the pool queues excess work, which
+			// keeps a storm of simultaneous handshakes from monopolizing the network thread
+			if (N2::g_net2->sslHandshakerThreadsStarted > 0) {
 				holder = Hold(&N2::g_net2->sslPoolHandshakesInProgress);
 				auto handshake =
 				    new SSLHandshakerThread::Handshake(self->ssl_sock, boost::asio::ssl::stream_base::server);
@@ -973,8 +1090,19 @@ public:
 
 		try {
 			Future<Void> onHandshook;
-			// If the background handshakers are not all busy, use one
-			if (N2::g_net2->sslPoolHandshakesInProgress < N2::g_net2->sslHandshakerThreadsStarted) {
+
+			if (FLOW_KNOBS->TLS_SESSION_RESUMPTION) {
+				// Try to resume the last session negotiated with this peer; new sessions are captured by
+				// TLSSessionCache through the context's new-session callback, keyed by the ex-data set here
+				self->tlsSessionKey = self->peer_address.toString();
+				SSL* ssl = self->ssl_sock.native_handle();
+				SSL_set_ex_data(ssl, TLSSessionCache::exDataIndex(), (void*)self->tlsSessionKey.c_str());
+				TLSSessionCache::instance().resume(ssl, self->tlsSessionKey);
+			}
+
+			// Always use a background handshaker if any were started; the pool queues excess work, which
+			// keeps a storm of simultaneous handshakes from monopolizing the network thread
+			if (N2::g_net2->sslHandshakerThreadsStarted > 0) {
 				holder = Hold(&N2::g_net2->sslPoolHandshakesInProgress);
 				auto handshake =
 				    new SSLHandshakerThread::Handshake(self->ssl_sock, boost::asio::ssl::stream_base::client);
@@ -1118,6 +1246,9 @@ private:
 	ssl_socket ssl_sock;
 	NetworkAddress peer_address;
 	Reference<ReferencedObject<boost::asio::ssl::context>> sslContext;
+	// TLSSessionCache key of an outgoing connection; referenced from the SSL object's ex-data, so it
+	// must live as long as the connection
+	std::string tlsSessionKey;
 
 	void init() {
 		// Socket settings that have to be set after connect or accept succeeds
@@ -1216,7 +1347,11 @@ Net2::Net2(const TLSConfig& tlsConfig, bool useThreadPool, bool useMetrics)
     sslHandshakerThreadsStarted(0), sslPoolHandshakesInProgress(0), tlsConfig(tlsConfig),
     tlsInitializedState(ETLSInitState::NONE), network(this), tscBegin(0), tscEnd(0), taskBegin(0),
     currentTaskID(TaskPriority::DefaultYield), tasksIssued(0), stopped(false), started(false), numYields(0),
-    lastPriorityStats(nullptr), ready(FLOW_KNOBS->READY_QUEUE_RESERVED_SIZE) {
+    lastPriorityStats(nullptr), ready(FLOW_KNOBS->READY_QUEUE_RESERVED_SIZE),
+    threadReadyRing(FLOW_KNOBS->NET2_THREAD_READY_RING_SIZE),
+    timerWheel(FLOW_KNOBS->NET2_TIMER_WHEEL_RESOLUTION > 0 ? FLOW_KNOBS->NET2_TIMER_WHEEL_RESOLUTION : 1e-3,
+               FLOW_KNOBS->NET2_TIMER_WHEEL_SLOTS),
+    useTimerWheel(FLOW_KNOBS->NET2_TIMER_WHEEL_RESOLUTION > 0) {
 	// Until run() is called, yield() will always yield
 	TraceEvent("Net2Starting").log();
 
@@ -1301,6 +1436,7 @@ ACTOR static Future<Void> reloadCertificatesOnChange(
 			LoadedTLSConfig loaded = wait(config.loadAsync());
 			boost::asio::ssl::context context(boost::asio::ssl::context::tls);
 			ConfigureSSLContext(loaded, &context, onPolicyFailure);
+			configureSessionResumption(&context);
 			TraceEvent(SevInfo, "TLSCertificateRefreshSucceeded").log();
 			mismatches = 0;
 			contextVar->set(ReferencedObject<boost::asio::ssl::context>::from(std::move(context)));
@@ -1333,6 +1469,7 @@ void Net2::initTLS(ETLSInitState targetState) {
 			    .detail("HasPassword", !loaded.getPassword().empty())
 			    .detail("VerifyPeers", boost::algorithm::join(loaded.getVerifyPeers(), "|"));
 			ConfigureSSLContext(tlsConfig.loadSync(), &newContext, onPolicyFailure);
+			configureSessionResumption(&newContext);
 			sslContextVar.set(ReferencedObject<boost::asio::ssl::context>::from(std::move(newContext)));
 		} catch (Error& e) {
 			TraceEvent("Net2TLSInitError").error(e);
@@ -1398,6 +1535,7 @@ void Net2::initMetrics() {
 	countRunLoop.init(LiteralStringRef("Net2.CountRunLoop"));
 	countCantSleep.init(LiteralStringRef("Net2.CountCantSleep"));
 	countWontSleep.init(LiteralStringRef("Net2.CountWontSleep"));
+	countRunLoopSpins.init(LiteralStringRef("Net2.CountRunLoopSpins"));
 	countTimers.init(LiteralStringRef("Net2.CountTimers"));
 	countTasks.init(LiteralStringRef("Net2.CountTasks"));
 	countYields.init(LiteralStringRef("Net2.CountYields"));
@@ -1424,6 +1562,41 @@ ActorLineageSet& Net2::getActorLineageSet() {
 }
 #endif
 
+struct AuxReactorArgs {
+	Net2* net2;
+	int shard;
+};
+
+THREAD_FUNC auxReactorThread(void* arg) {
+	std::unique_ptr<AuxReactorArgs> args((AuxReactorArgs*)arg);
+	args->net2->runAuxReactor(args->shard);
+	THREAD_RETURN;
+}
+
+void Net2::postAuxTask(Task* task, TaskPriority taskID) {
+	ASSERT(auxReady);
+	int shard = nextAuxShard++ % auxReady->numShards();
+	auxReady->push(shard, OrderedTask((int64_t(taskID) << 32) - (++tasksIssued), taskID, task));
+	auxReactorWake.set();
+}
+
+void Net2::runAuxReactor(int shard) {
+	while (!stopped) {
+		Optional<OrderedTask> t = auxReady->pop(shard);
+		if (!t.present()) {
+			auxReactorWake.block();
+			continue;
+		}
+		try {
+			(*t.get().task)();
+		} catch (Error& e) {
+			TraceEvent(SevError, "AuxReactorTaskError").error(e);
+		} catch (...) {
+			TraceEvent(SevError, "AuxReactorTaskError").error(unknown_error());
+		}
+	}
+}
+
 void Net2::run() {
 	TraceEvent::setNetworkThread();
 	TraceEvent("Net2Running").log();
@@ -1450,6 +1623,16 @@ void Net2::run() {
 	runCycleFuncPtr runFunc = reinterpret_cast<runCycleFuncPtr>(
 	    reinterpret_cast<flowGlobalType>(g_network->global(INetwork::enRunCycleFunc)));
 
+	if (FLOW_KNOBS->NET2_REACTOR_SHARDS > 1 && auxReactorThreads.empty()) {
+		int numAux = FLOW_KNOBS->NET2_REACTOR_SHARDS - 1;
+		auxReady = std::make_unique<WorkStealingQueue<OrderedTask>>(
+		    numAux, FLOW_KNOBS->NET2_WORK_STEAL_BATCH, FLOW_KNOBS->READY_QUEUE_RESERVED_SIZE);
+		for (int i = 0; i < numAux; i++) {
+			auxReactorThreads.push_back(startThread(auxReactorThread, new AuxReactorArgs{ this, i }, 0, "fdb-auxreactor"));
+		}
+		TraceEvent("Net2AuxReactorsStarted").detail("Shards", FLOW_KNOBS->NET2_REACTOR_SHARDS);
+	}
+
 	started.store(true);
 	double nnow = timer_monotonic();
 
@@ -1471,27 +1654,47 @@ void Net2::run() {
 		double sleepTime = 0;
 		bool b = ready.empty();
 		if (b) {
-			b = threadReady.canSleep();
+			b = threadReady.canSleep() && threadReadyRing.canSleep();
 			if (!b)
 				++countCantSleep;
 		} else
 			++countWontSleep;
+		if (!b && FLOW_KNOBS->NET2_RUN_LOOP_SPIN_WINDOW > 0)
+			lastActivityTime = timer_monotonic();
 		if (b) {
 			sleepTime = 1e99;
 			double sleepStart = timer_monotonic();
-			if (!timers.empty()) {
+			if (useTimerWheel) {
+				if (!timerWheel.empty()) {
+					sleepTime = timerWheel.nextAt() - sleepStart;
+				}
+			} else if (!timers.empty()) {
 				sleepTime = timers.top().at - sleepStart; // + 500e-6?
 			}
 			if (sleepTime > 0) {
-#if defined(__linux__)
-				// notify the run loop monitoring thread that we have gone idle
-				net2RunLoopSleeps.fetch_add(1);
-#endif
-
 				trackAtPriority(TaskPriority::Zero, sleepStart);
 				awakeMetric = false;
 				priorityMetric = 0;
-				reactor.sleep(sleepTime);
+
+				// On latency-sensitive hosts, busy-poll the reactor for a short
+				// window after recent activity rather than paying an epoll
+				// wakeup; fall back to a real sleep once the window expires.
+				bool gotWork = false;
+				double spinWindow = FLOW_KNOBS->NET2_RUN_LOOP_SPIN_WINDOW;
+				if (spinWindow > 0 && sleepStart - lastActivityTime < spinWindow) {
+					++countRunLoopSpins;
+					gotWork = spinPollReactor(std::min(lastActivityTime + spinWindow, sleepStart + sleepTime));
+				}
+				if (!gotWork) {
+					double remaining = spinWindow > 0 ? sleepStart + sleepTime - timer_monotonic() : sleepTime;
+					if (remaining > 0) {
+#if defined(__linux__)
+						// notify the run loop monitoring thread that we have gone idle
+						net2RunLoopSleeps.fetch_add(1);
+#endif
+						reactor.sleep(remaining);
+					}
+				}
 				awakeMetric = true;
 			}
 		}
@@ -1514,11 +1717,22 @@ void Net2::run() {
 			TraceEvent("SomewhatSlowRunLoopTop").detail("Elapsed", now - nnow);
 
 		int numTimers = 0;
-		while (!timers.empty() && timers.top().at < now) {
-			++numTimers;
-			++countTimers;
-			ready.push(timers.top());
-			timers.pop();
+		if (useTimerWheel) {
+			numTimers = timerWheel.expire(now, [this, now](DelayedTask const& t) {
+				OrderedTask readyTask = t;
+				readyTask.makeReady = now;
+				ready.push(readyTask);
+			});
+			countTimers += numTimers;
+		} else {
+			while (!timers.empty() && timers.top().at < now) {
+				++numTimers;
+				++countTimers;
+				OrderedTask readyTask = timers.top();
+				readyTask.makeReady = now;
+				ready.push(readyTask);
+				timers.pop();
+			}
 		}
 		// FIXME: Is this double counting?
 		countTimers += numTimers;
@@ -1539,8 +1753,13 @@ void Net2::run() {
 			currentTaskID = ready.top().taskID;
 			priorityMetric = static_cast<int64_t>(currentTaskID);
 			Task* task = ready.top().task;
+			double makeReady = ready.top().makeReady;
 			ready.pop();
 
+			if (makeReady > 0) {
+				recordQueueWait(currentTaskID, taskBegin - makeReady);
+			}
+
 			try {
 				++tasksSinceReact;
 				(*task)();
@@ -1635,6 +1854,14 @@ void Net2::run() {
 			    .detail("Elapsed", nnow - now); // This includes the time spent running tasks
 	}
 
+	for ([[maybe_unused]] auto& th : auxReactorThreads) {
+		auxReactorWake.set();
+	}
+	for (auto& th : auxReactorThreads) {
+		waitThread(th);
+	}
+	auxReactorThreads.clear();
+
 	for (auto& fn : stopCallbacks) {
 		fn();
 	}
@@ -1695,13 +1922,64 @@ void Net2::trackAtPriority(TaskPriority priority, double now) {
 	}
 }
 
+// Records how long a task waited in the ready queue before running, bucketed per TaskPriority, and raises a
+// trace event when work has been starved past the knob threshold. Queue age is the leading indicator of
+// run-loop saturation; request latencies degrade well after ready queues start growing old.
+void Net2::recordQueueWait(TaskPriority priority, double age) {
+	if (age < 0) {
+		age = 0;
+	}
+	auto& histogram = queueWaitHistograms[priority];
+	if (!histogram.isValid()) {
+		histogram = Histogram::getHistogram(LiteralStringRef("Net2"),
+		                                    StringRef(format("QueueWait%d", static_cast<int>(priority))),
+		                                    Histogram::Unit::microseconds);
+	}
+	histogram->sampleSeconds(age);
+	if (age > FLOW_KNOBS->RUN_LOOP_STARVATION_THRESHOLD) {
+		TraceEvent(SevWarnAlways, "RunLoopStarvation")
+		    .suppressFor(5.0)
+		    .detail("Priority", static_cast<int>(priority))
+		    .detail("QueueWaitTime", age)
+		    .detail("ReadyQueueSize", (int)ready.size());
+	}
+}
+
+// Busy-polls the reactor and the cross-thread queues until work arrives or
+// spinUntil passes.  Returns true if the caller should skip sleeping and go
+// straight back to the top of the run loop.
+bool Net2::spinPollReactor(double spinUntil) {
+	do {
+		reactor.react();
+		if (!ready.empty() || !threadReady.canSleep() || !threadReadyRing.canSleep()) {
+			lastActivityTime = timer_monotonic();
+			return true;
+		}
+	} while (timer_monotonic() < spinUntil);
+	return false;
+}
+
 void Net2::processThreadReady() {
 	int numReady = 0;
+	// Cross-thread tasks count as ready from the moment the run loop drains them; the cross-thread handoff
+	// itself is not part of the queue wait being measured
+	double readyTime = timer_monotonic();
+	while (true) {
+		Optional<OrderedTask> t = threadReadyRing.pop();
+		if (!t.present())
+			break;
+		t.get().priority -= ++tasksIssued;
+		t.get().makeReady = readyTime;
+		ASSERT(t.get().task != 0);
+		ready.push(t.get());
+		++numReady;
+	}
 	while (true) {
 		Optional<OrderedTask> t = threadReady.pop();
 		if (!t.present())
 			break;
 		t.get().priority -= ++tasksIssued;
+		t.get().makeReady = readyTime;
 		ASSERT(t.get().task != 0);
 		ready.push(t.get());
 		++numReady;
@@ -1792,7 +2070,9 @@ Future<class Void> Net2::yield(TaskPriority taskID) {
 Future<Void> Net2::delay(double seconds, TaskPriority taskId) {
 	if (seconds <= 0.) {
 		PromiseTask* t = new PromiseTask;
-		this->ready.push(OrderedTask((int64_t(taskId) << 32) - (++tasksIssued), taskId, t));
+		OrderedTask task((int64_t(taskId) << 32) - (++tasksIssued), taskId, t);
+		task.makeReady = now();
+		this->ready.push(task);
 		return t->promise.getFuture();
 	}
 	if (seconds >=
@@ -1801,7 +2081,7 @@ Future<Void> Net2::delay(double seconds, TaskPriority taskId) {
 
 	double at = now() + seconds;
 	PromiseTask* t = new PromiseTask;
-	this->timers.push(DelayedTask(at, (int64_t(taskId) << 32) - (++tasksIssued), taskId, t));
+	this->pushTimer(DelayedTask(at, (int64_t(taskId) << 32) - (++tasksIssued), taskId, t));
 	return t->promise.getFuture();
 }
 
@@ -1818,10 +2098,18 @@ void Net2::onMainThread(Promise<Void>&& signal, TaskPriority taskID) {
 
 	if (thread_network == this) {
 		processThreadReady();
-		this->ready.push(OrderedTask(priority - (++tasksIssued), taskID, p));
+		OrderedTask task(priority - (++tasksIssued), taskID, p);
+		task.makeReady = now();
+		this->ready.push(task);
 	} else {
-		if (threadReady.push(OrderedTask(priority, taskID, p)))
+		OrderedTask task(priority, taskID, p);
+		auto result = threadReadyRing.tryPush(task);
+		if (result == MPSCRingQueue<OrderedTask>::PushResult::Full) {
+			if (threadReady.push(task))
+				reactor.wake();
+		} else if (result == MPSCRingQueue<OrderedTask>::PushResult::NeedsWake) {
 			reactor.wake();
+		}
 	}
 }
 
@@ -18,6 +18,8 @@
  * limitations under the License.
  */
 
+#include <cmath>
+
 #include "flow/Net2Packet.h"
 
 void PacketWriter::init(PacketBuffer* buf, ReliablePacket* reliable) {
@@ -139,7 +141,27 @@ void ReliablePacket::remove() {
 	}
 }
 
+void UnsentPacketQueue::updateThroughput(int bytes) {
+	double t = now();
+	recentSentBytes = recentSentBytes * exp((recentSentTime - t) / THROUGHPUT_DECAY_TIME) + bytes;
+	recentSentTime = t;
+}
+
+size_t UnsentPacketQueue::preferredBufferBytes() const {
+	double recent = recentSentBytes * exp((recentSentTime - now()) / THROUGHPUT_DECAY_TIME);
+	// A queue pushing multiple large buffers per decay interval stays in the large class; one
+	// that hasn't recently filled even a small buffer drops to the small class
+	if (recent >= PacketBuffer::largeClassPayload()) {
+		return PacketBuffer::largeClassPayload();
+	}
+	if (recent < PacketBuffer::smallClassPayload()) {
+		return PacketBuffer::smallClassPayload();
+	}
+	return PacketBuffer::mediumClassPayload();
+}
+
 void UnsentPacketQueue::sent(int bytes) {
+	updateThroughput(bytes);
 	while (bytes) {
 		ASSERT(unsent_first);
 		PacketBuffer* b = unsent_first;
@@ -0,0 +1,161 @@
+/*
+ * SimdCompare.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flow/SimdCompare.h"
+
+#include <cstring>
+
+#include "flow/UnitTest.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SIMD_COMPARE_HAS_AVX2 1
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__)
+#define SIMD_COMPARE_HAS_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace simd_compare_impl {
+
+static int compareAndPrefixScalar(const uint8_t* a, const uint8_t* b, int n, int* commonPrefixLen) {
+	int c = memcmp(a, b, n);
+	if (c == 0) {
+		if (commonPrefixLen) {
+			*commonPrefixLen = n;
+		}
+		return 0;
+	}
+	if (commonPrefixLen) {
+		int i = 0;
+		while (a[i] == b[i]) {
+			i++;
+		}
+		*commonPrefixLen = i;
+	}
+	return c;
+}
+
+#ifdef SIMD_COMPARE_HAS_AVX2
+__attribute__((target("avx2"))) static int compareAndPrefixAvx2(const uint8_t* a,
+                                                                const uint8_t* b,
+                                                                int n,
+                                                                int* commonPrefixLen) {
+	int i = 0;
+	for (; i + 32 <= n; i += 32) {
+		__m256i va = _mm256_loadu_si256((const __m256i*)(a + i));
+		__m256i vb = _mm256_loadu_si256((const __m256i*)(b + i));
+		uint32_t eq = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb));
+		if (eq != 0xffffffffu) {
+			int idx = i + __builtin_ctz(~eq);
+			if (commonPrefixLen) {
+				*commonPrefixLen = idx;
+			}
+			return (int)a[idx] - (int)b[idx];
+		}
+	}
+	for (; i < n; i++) {
+		if (a[i] != b[i]) {
+			if (commonPrefixLen) {
+				*commonPrefixLen = i;
+			}
+			return (int)a[i] - (int)b[i];
+		}
+	}
+	if (commonPrefixLen) {
+		*commonPrefixLen = n;
+	}
+	return 0;
+}
+#endif
+
+#ifdef SIMD_COMPARE_HAS_NEON
+static int compareAndPrefixNeon(const uint8_t* a, const uint8_t* b, int n, int* commonPrefixLen) {
+	int i = 0;
+	for (; i + 16 <= n; i += 16) {
+		uint8x16_t eq = vceqq_u8(vld1q_u8(a + i), vld1q_u8(b + i));
+		if (vminvq_u8(eq) != 0xff) {
+			for (int j = i;; j++) {
+				if (a[j] != b[j]) {
+					if (commonPrefixLen) {
+						*commonPrefixLen = j;
+					}
+					return (int)a[j] - (int)b[j];
+				}
+			}
+		}
+	}
+	for (; i < n; i++) {
+		if (a[i] != b[i]) {
+			if (commonPrefixLen) {
+				*commonPrefixLen = i;
+			}
+			return (int)a[i] - (int)b[i];
+		}
+	}
+	if (commonPrefixLen) {
+		*commonPrefixLen = n;
+	}
+	return 0;
+}
+#endif
+
+static decltype(compareAndPrefix) chooseCompareAndPrefix() {
+#ifdef SIMD_COMPARE_HAS_AVX2
+	if (__builtin_cpu_supports("avx2")) {
+		return &compareAndPrefixAvx2;
+	}
+#endif
+#ifdef SIMD_COMPARE_HAS_NEON
+	return &compareAndPrefixNeon;
+#endif
+	return &compareAndPrefixScalar;
+}
+
+int (*const compareAndPrefix)(const uint8_t* a, const uint8_t* b, int n, int* commonPrefixLen) =
+    chooseCompareAndPrefix();
+
+} // namespace simd_compare_impl
+
+TEST_CASE("/flow/SimdCompare/memcmpEquivalence") {
+	// Exercise every alignment and mismatch position near vector-width
+	// boundaries, comparing against memcmp and a scalar prefix scan.
+	uint8_t a[256], b[256];
+	for (int len = 0; len < 200; len++) {
+		for (int i = 0; i < len; i++) {
+			a[i] = b[i] = (uint8_t)deterministicRandom()->randomInt(0, 256);
+		}
+		for (int mismatch = -1; mismatch < len; mismatch++) {
+			memcpy(b, a, len);
+			if (mismatch >= 0) {
+				b[mismatch] = a[mismatch] + 1 + deterministicRandom()->randomInt(0, 255);
+			}
+			int prefix = -1;
+			int c = simdMemcmpWithPrefix(a, b, len, &prefix);
+			int expected = memcmp(a, b, len);
+			ASSERT((c < 0) == (expected < 0) && (c > 0) == (expected > 0));
+			ASSERT(prefix == (mismatch >= 0 ? mismatch : len));
+		}
+	}
+	return Void();
+}
+
+void forceLinkSimdCompareTests() {}
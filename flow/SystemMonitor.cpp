@@ -162,6 +162,15 @@ SystemStatistics customSystemMonitor(std::string const& eventName, StatisticsSta
 			    .DETAILALLOCATORMEMUSAGE(8192)
 			    .DETAILALLOCATORMEMUSAGE(16384)
 			    .detail("HugeArenaMemory", g_hugeArenaMemory.load())
+			    .detail("ArenaUnknown", getArenaTagBytes(ArenaTag::Unknown))
+			    .detail("ArenaVersionedMap", getArenaTagBytes(ArenaTag::VersionedMap))
+			    .detail("ArenaVersionedMapPeak", getArenaTagPeakBytes(ArenaTag::VersionedMap))
+			    .detail("ArenaFetchKeys", getArenaTagBytes(ArenaTag::FetchKeys))
+			    .detail("ArenaFetchKeysPeak", getArenaTagPeakBytes(ArenaTag::FetchKeys))
+			    .detail("ArenaTransport", getArenaTagBytes(ArenaTag::Transport))
+			    .detail("ArenaTransportPeak", getArenaTagPeakBytes(ArenaTag::Transport))
+			    .detail("ArenaPageCache", getArenaTagBytes(ArenaTag::PageCache))
+			    .detail("ArenaPageCachePeak", getArenaTagPeakBytes(ArenaTag::PageCache))
 			    .detail("DCID", machineState.dcId)
 			    .detail("ZoneID", machineState.zoneId)
 			    .detail("MachineID", machineState.machineId);
@@ -0,0 +1,88 @@
+/*
+ * TimerWheel.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flow/TimerWheel.h"
+#include "flow/UnitTest.h"
+
+namespace {
+struct TestTimer {
+	double at;
+	int id;
+};
+} // namespace
+
+TEST_CASE("/flow/TimerWheel/neverEarly") {
+	// Random deadlines, random expiry times: every timer must fire no earlier
+	// than its deadline and no later than one resolution past it once time has
+	// advanced that far.
+	double resolution = 0.001;
+	TimerWheel<TestTimer> wheel(resolution, 64);
+	std::vector<double> deadlines;
+	double base = 1000.0;
+	for (int i = 0; i < 1000; i++) {
+		double at = base + deterministicRandom()->random01() * 2.0;
+		wheel.push(TestTimer{ at, (int)deadlines.size() });
+		deadlines.push_back(at);
+	}
+	ASSERT(wheel.size() == deadlines.size());
+
+	std::vector<bool> fired(deadlines.size(), false);
+	double now = base;
+	while (!wheel.empty()) {
+		now += deterministicRandom()->random01() * 0.01;
+		wheel.expire(now, [&](TestTimer const& t) {
+			ASSERT(t.at <= now);
+			ASSERT(!fired[t.id]);
+			fired[t.id] = true;
+		});
+		for (int i = 0; i < (int)deadlines.size(); i++) {
+			// Anything a full resolution past due must have fired by now.
+			if (deadlines[i] + resolution <= now) {
+				ASSERT(fired[i]);
+			}
+		}
+	}
+	return Void();
+}
+
+TEST_CASE("/flow/TimerWheel/nextAt") {
+	TimerWheel<TestTimer> wheel(0.001, 64);
+	ASSERT(wheel.nextAt() == 1e99);
+	wheel.push(TestTimer{ 500.0, 0 }); // far beyond the window: overflow
+	ASSERT(wheel.nextAt() == 500.0);
+	int fired = wheel.expire(499.0, [](TestTimer const&) { ASSERT(false); });
+	ASSERT(fired == 0);
+	// The window has advanced, so the timer is now in the wheel and nextAt()
+	// reports its slot boundary, which is never after the deadline is due.
+	ASSERT(wheel.nextAt() >= 499.0 && wheel.nextAt() <= 500.0 + 0.001);
+	fired = wheel.expire(500.002, [](TestTimer const& t) { ASSERT(t.at == 500.0); });
+	ASSERT(fired == 1 && wheel.empty());
+
+	// Interleaved pushes while the wheel is positioned
+	wheel.push(TestTimer{ 500.0005, 1 }); // already due
+	wheel.push(TestTimer{ 500.05, 2 });
+	fired = wheel.expire(500.003, [](TestTimer const& t) { ASSERT(t.id == 1); });
+	ASSERT(fired == 1);
+	fired = wheel.expire(500.06, [](TestTimer const& t) { ASSERT(t.id == 2); });
+	ASSERT(fired == 1 && wheel.empty());
+	return Void();
+}
+
+void forceLinkTimerWheelTests() {}
@@ -23,6 +23,7 @@
 #include "flow/Knobs.h"
 #include "flow/XmlTraceLogFormatter.h"
 #include "flow/JsonTraceLogFormatter.h"
+#include "flow/BinaryTraceLogFormatter.h"
 #include "flow/flow.h"
 #include "flow/DeterministicRandom.h"
 #include <stdlib.h>
@@ -89,12 +90,68 @@ struct SuppressionMap {
 	}
 };
 
+// Runtime-adjustable per-event-type severity thresholds and token bucket rate limits, settable
+// via setTraceTypeSeverity() and setTraceTypeRateLimit(). Unlike suppressFor(), which is
+// per-call-site and compiled in, these apply to every event of a type and can be changed while
+// the process is running. Guarded by a mutex because trace events can be created off the network
+// thread; the atomic counts let the common no-overrides case skip the lock entirely.
+struct TraceTypeOverrides {
+	struct RateLimit {
+		double eventsPerSecond = 0;
+		double burstSize = 0;
+		double tokens = 0;
+		double lastUpdate = 0;
+		int64_t suppressedEventCount = 0;
+	};
+
+	Mutex mutex;
+	std::atomic<int> severityCount{ 0 };
+	std::atomic<int> rateLimitCount{ 0 };
+	std::map<std::string, int> severities;
+	std::map<std::string, RateLimit> rateLimits;
+
+	// Returns the minimum severity required to log events of the given type
+	int minSeverity(const char* type) {
+		if (severityCount.load(std::memory_order_relaxed) == 0) {
+			return FLOW_KNOBS->MIN_TRACE_SEVERITY;
+		}
+		MutexHolder holder(mutex);
+		auto it = severities.find(type);
+		return it == severities.end() ? FLOW_KNOBS->MIN_TRACE_SEVERITY : it->second;
+	}
+
+	// Takes a token from the bucket for the given type, if one exists. Returns -1 if the event
+	// should be suppressed, otherwise the number of preceding events of the type that were.
+	int64_t checkRateLimit(const char* type, double now) {
+		if (rateLimitCount.load(std::memory_order_relaxed) == 0) {
+			return 0;
+		}
+		MutexHolder holder(mutex);
+		auto it = rateLimits.find(type);
+		if (it == rateLimits.end()) {
+			return 0;
+		}
+		RateLimit& limit = it->second;
+		limit.tokens = std::min(limit.burstSize, limit.tokens + (now - limit.lastUpdate) * limit.eventsPerSecond);
+		limit.lastUpdate = now;
+		if (limit.tokens < 1.0) {
+			++limit.suppressedEventCount;
+			return -1;
+		}
+		limit.tokens -= 1.0;
+		int64_t suppressedEventCount = limit.suppressedEventCount;
+		limit.suppressedEventCount = 0;
+		return suppressedEventCount;
+	}
+};
+
 #define TRACE_BATCH_IMPLICIT_SEVERITY SevInfo
 TraceBatch g_traceBatch;
 std::atomic<trace_clock_t> g_trace_clock{ TRACE_CLOCK_NOW };
 
 LatestEventCache latestEventCache;
 SuppressionMap suppressedEvents;
+TraceTypeOverrides traceTypeOverrides;
 
 static TransientThresholdMetricSample<Standalone<StringRef>>* traceEventThrottlerCache;
 static const char* TRACE_EVENT_THROTTLE_STARTING_TYPE = "TraceEventThrottle_";
@@ -665,6 +722,11 @@ bool traceFormatImpl(std::string& format) {
 			g_traceLog.formatter = Reference<ITraceLogFormatter>(new JsonTraceLogFormatter());
 		}
 		return true;
+	} else if (format == "binary") {
+		if (!validate) {
+			g_traceLog.formatter = Reference<ITraceLogFormatter>(new BinaryTraceLogFormatter());
+		}
+		return true;
 	} else {
 		if (!validate) {
 			g_traceLog.formatter = Reference<ITraceLogFormatter>(new XmlTraceLogFormatter());
@@ -813,10 +875,38 @@ void addUniversalTraceField(const std::string& name, const std::string& value) {
 	g_traceLog.addUniversalTraceField(name, value);
 }
 
+void setTraceTypeSeverity(std::string const& type, int minSeverity) {
+	MutexHolder holder(traceTypeOverrides.mutex);
+	traceTypeOverrides.severities[type] = minSeverity;
+	traceTypeOverrides.severityCount.store(traceTypeOverrides.severities.size(), std::memory_order_relaxed);
+}
+
+void clearTraceTypeSeverity(std::string const& type) {
+	MutexHolder holder(traceTypeOverrides.mutex);
+	traceTypeOverrides.severities.erase(type);
+	traceTypeOverrides.severityCount.store(traceTypeOverrides.severities.size(), std::memory_order_relaxed);
+}
+
+void setTraceTypeRateLimit(std::string const& type, double eventsPerSecond, double burstSize) {
+	MutexHolder holder(traceTypeOverrides.mutex);
+	auto& limit = traceTypeOverrides.rateLimits[type];
+	limit.eventsPerSecond = eventsPerSecond;
+	limit.burstSize = burstSize;
+	limit.tokens = burstSize; // Start with a full bucket so the change itself doesn't suppress anything
+	limit.lastUpdate = g_network ? now() : 0;
+	traceTypeOverrides.rateLimitCount.store(traceTypeOverrides.rateLimits.size(), std::memory_order_relaxed);
+}
+
+void clearTraceTypeRateLimit(std::string const& type) {
+	MutexHolder holder(traceTypeOverrides.mutex);
+	traceTypeOverrides.rateLimits.erase(type);
+	traceTypeOverrides.rateLimitCount.store(traceTypeOverrides.rateLimits.size(), std::memory_order_relaxed);
+}
+
 BaseTraceEvent::BaseTraceEvent() : initialized(true), enabled(false), logged(true) {}
 BaseTraceEvent::BaseTraceEvent(Severity severity, const char* type, UID id)
-  : initialized(false), enabled(g_network == nullptr || FLOW_KNOBS->MIN_TRACE_SEVERITY <= severity), logged(false),
-    severity(severity), type(type), id(id) {}
+  : initialized(false), enabled(g_network == nullptr || traceTypeOverrides.minSeverity(type) <= severity),
+    logged(false), severity(severity), type(type), id(id) {}
 
 BaseTraceEvent::BaseTraceEvent(BaseTraceEvent&& ev) {
 	enabled = ev.enabled;
@@ -931,7 +1021,7 @@ bool BaseTraceEvent::init() {
 
 	++g_allocation_tracing_disabled;
 
-	enabled = enabled && (!g_network || severity >= FLOW_KNOBS->MIN_TRACE_SEVERITY);
+	enabled = enabled && (!g_network || severity >= traceTypeOverrides.minSeverity(type));
 
 	// Backstop to throttle very spammy trace events
 	if (enabled && g_network && !g_network->isSimulated() && severity > SevDebug && isNetworkThread()) {
@@ -945,6 +1035,15 @@ bool BaseTraceEvent::init() {
 		}
 	}
 
+	// Runtime-configured per-type rate limit (see setTraceTypeRateLimit())
+	int64_t rateLimitedEventCount = 0;
+	if (enabled && g_network) {
+		rateLimitedEventCount = traceTypeOverrides.checkRateLimit(type, now());
+		if (rateLimitedEventCount < 0) {
+			enabled = false;
+		}
+	}
+
 	if (enabled) {
 		tmpEventMetric = std::make_unique<DynamicEventMetric>(MetricNameRef());
 
@@ -969,6 +1068,9 @@ bool BaseTraceEvent::init() {
 			detail("Machine", formatIpPort(local.ip, local.port));
 		}
 		detail("ID", id);
+		if (rateLimitedEventCount > 0) {
+			detail("SuppressedEventCount", rateLimitedEventCount);
+		}
 		if (err.isValid()) {
 			if (err.isInjectedFault()) {
 				detail("ErrorIsInjectedFault", true);
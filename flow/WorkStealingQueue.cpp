@@ -0,0 +1,58 @@
+/*
+ * WorkStealingQueue.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flow/WorkStealingQueue.h"
+#include "flow/UnitTest.h"
+
+TEST_CASE("/flow/WorkStealingQueue/priorityOrder") {
+	WorkStealingQueue<int> q(1, 4);
+	q.push(0, 3);
+	q.push(0, 10);
+	q.push(0, 7);
+	ASSERT(q.pop(0).get() == 10);
+	ASSERT(q.pop(0).get() == 7);
+	ASSERT(q.pop(0).get() == 3);
+	ASSERT(!q.pop(0).present());
+	ASSERT(q.empty());
+	return Void();
+}
+
+TEST_CASE("/flow/WorkStealingQueue/steal") {
+	WorkStealingQueue<int> q(4, 4);
+	for (int i = 0; i < 100; i++) {
+		q.push(1, i);
+	}
+	ASSERT(q.size() == 100);
+	// Shard 0 is empty, so popping it must steal a batch from shard 1 and
+	// still return the globally highest-priority item.
+	ASSERT(q.pop(0).get() == 99);
+	ASSERT(!q.empty());
+	int popped = 1;
+	for (int shard = 0; shard < 4; shard++) {
+		while (q.pop(shard).present()) {
+			popped++;
+		}
+	}
+	ASSERT(popped == 100);
+	ASSERT(q.size() == 0);
+	return Void();
+}
+
+void forceLinkWorkStealingQueueTests() {}
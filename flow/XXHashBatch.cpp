@@ -0,0 +1,83 @@
+/*
+ * XXHashBatch.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flow/XXHashBatch.h"
+
+#include <algorithm>
+
+#include "flow/IRandom.h"
+#include "flow/UnitTest.h"
+
+namespace {
+
+// How far into the next buffer to prefetch before hashing the current one.
+// XXH3 reads sequentially, so by the time these lines are consumed the
+// hardware prefetcher has taken over.
+constexpr size_t PREFETCH_BYTES = 512;
+
+inline void prefetchBuffer(const void* data, size_t len) {
+#if defined(__GNUC__) || defined(__clang__)
+	const char* p = (const char*)data;
+	size_t n = std::min(len, PREFETCH_BYTES);
+	for (size_t off = 0; off < n; off += 64) {
+		__builtin_prefetch(p + off, 0, 3);
+	}
+#else
+	(void)data;
+	(void)len;
+#endif
+}
+
+} // namespace
+
+void xxh3Batch(XXHashBatchItem* items, int count) {
+	for (int i = 0; i < count; i++) {
+		if (i + 1 < count) {
+			prefetchBuffer(items[i + 1].data, items[i + 1].len);
+		}
+		items[i].result = items[i].seed ? XXH3_64bits_withSeed(items[i].data, items[i].len, items[i].seed)
+		                                : XXH3_64bits(items[i].data, items[i].len);
+	}
+}
+
+TEST_CASE("/flow/XXHashBatch/equivalence") {
+	constexpr int numBuffers = 8;
+	constexpr int pageSize = 8192;
+	std::vector<std::vector<uint8_t>> pages(numBuffers);
+	XXHashBatchItem items[numBuffers];
+	for (int i = 0; i < numBuffers; i++) {
+		pages[i].resize(deterministicRandom()->randomInt(1, pageSize + 1));
+		deterministicRandom()->randomBytes(pages[i].data(), pages[i].size());
+		items[i].data = pages[i].data();
+		items[i].len = pages[i].size();
+		items[i].seed = (i % 2) ? deterministicRandom()->randomUInt64() : 0;
+	}
+
+	xxh3Batch(items, numBuffers);
+
+	for (int i = 0; i < numBuffers; i++) {
+		XXH64_hash_t expected = items[i].seed ? XXH3_64bits_withSeed(items[i].data, items[i].len, items[i].seed)
+		                                      : XXH3_64bits(items[i].data, items[i].len);
+		ASSERT(items[i].result == expected);
+	}
+	return Void();
+}
+
+void forceLinkXXHashBatchTests() {}
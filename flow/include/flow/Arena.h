@@ -31,6 +31,7 @@
 #include "flow/Trace.h"
 #include "flow/ObjectSerializerTraits.h"
 #include "flow/FileIdentifier.h"
+#include "flow/SimdCompare.h"
 #include <algorithm>
 #include <boost/functional/hash.hpp>
 #include <stdint.h>
@@ -94,6 +95,38 @@ protected:
 
 FDB_DECLARE_BOOLEAN_PARAM(FastInaccurateEstimate);
 
+class StringRef;
+
+// Optional subsystem attribution for arena memory.  An ArenaTagScope tags all
+// arena blocks allocated on this thread while it is in scope; per-tag current
+// and peak byte counters are reported in the MemoryMetrics trace event so
+// arena memory held by, say, the versioned map can be told apart from fetch
+// buffers in production.  Scopes only cover synchronous code: an actor's tag
+// does not survive a wait(), so place them around allocation-heavy loops, not
+// whole actors.  Tiny (<= 64 byte) blocks are not attributed; they have no
+// room for a tag and don't matter for memory ownership questions.
+enum class ArenaTag : uint8_t {
+	Unknown = 0,
+	VersionedMap,
+	FetchKeys,
+	Transport,
+	PageCache,
+	COUNT
+};
+
+const char* arenaTagName(ArenaTag tag);
+int64_t getArenaTagBytes(ArenaTag tag);
+int64_t getArenaTagPeakBytes(ArenaTag tag);
+
+class ArenaTagScope : NonCopyable {
+public:
+	explicit ArenaTagScope(ArenaTag tag);
+	~ArenaTagScope();
+
+private:
+	ArenaTag prev;
+};
+
 // An Arena is a custom allocator that consists of a set of ArenaBlocks.  Allocation is performed by bumping a pointer
 // on the most recent ArenaBlock until the block is unable to service the next allocation request.  When the current
 // ArenaBlock is full, a new (larger) one is added to the Arena.  Deallocation is not directly supported.  Instead,
@@ -111,6 +144,15 @@ public:
 	void dependsOn(const Arena& p);
 	void* allocate4kAlignedBuffer(uint32_t size);
 
+	// Transfers `value`, which must be allocated in `source`, into this arena.
+	// When the value is the dominant occupant of source's memory (at least
+	// ARENA_ADOPT_DOMINANT_FRACTION of it) this arena takes a dependency on
+	// source's block tree, which is zero-copy and wastes little because the
+	// value dominates it; otherwise the value is copied so source's blocks can
+	// be freed instead of being pinned by one small value.  Returns a reference
+	// valid for the lifetime of this arena.
+	StringRef adopt(StringRef value, const Arena& source);
+
 	// If fastInaccurateEstimate is true this operation is O(1) but it is inaccurate in that it
 	// will omit memory added to this Arena's block tree using Arena handles which reference
 	// non-root nodes in this Arena's block tree.
@@ -168,6 +210,8 @@ struct ArenaBlock : NonCopyable, ThreadSafeReferenceCounted<ArenaBlock> {
 	// if tinySize != NOT_TINY, following variables aren't used
 	uint32_t bigSize, bigUsed; // include block header
 	uint32_t nextBlockOffset;
+	uint8_t tag; // ArenaTag; occupies existing padding.  Only valid when !isTiny() -- for
+	             // tiny blocks this byte is part of the data region.
 	mutable size_t totalSizeEstimate; // Estimate of the minimum total size of arena blocks this one reaches
 
 	void addref();
@@ -573,9 +617,24 @@ public:
 	int compare(StringRef const& other) const {
 		auto minSize = static_cast<int>(std::min(size(), other.size()));
 		if (minSize != 0) {
-			int c = memcmp(begin(), other.begin(), minSize);
+			int c = simdMemcmp(begin(), other.begin(), minSize);
+			if (c != 0)
+				return c;
+		}
+		return ::compare(size(), other.size());
+	}
+
+	// Vectorized comparison that additionally reports the length of the common
+	// prefix of the two strings, which tree descent paths can use to avoid
+	// re-comparing bytes already known equal.
+	int compareSIMD(StringRef const& other, int* commonPrefixLen) const {
+		auto minSize = static_cast<int>(std::min(size(), other.size()));
+		if (minSize != 0) {
+			int c = simdMemcmpWithPrefix(begin(), other.begin(), minSize, commonPrefixLen);
 			if (c != 0)
 				return c;
+		} else if (commonPrefixLen) {
+			*commonPrefixLen = 0;
 		}
 		return ::compare(size(), other.size());
 	}
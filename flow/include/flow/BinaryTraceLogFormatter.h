@@ -0,0 +1,58 @@
+/*
+ * BinaryTraceLogFormatter.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLOW_BINARY_TRACE_LOG_FORMATTER_H
+#define FLOW_BINARY_TRACE_LOG_FORMATTER_H
+#pragma once
+
+#include <unordered_map>
+
+#include "flow/FastRef.h"
+#include "flow/Trace.h"
+
+// Compact binary trace format (trace_format=binary).  Each event is encoded
+// as a varint field count followed by (name token, value) pairs; the first
+// occurrence of a field name in a file defines a token inline, and later
+// occurrences are a one- or two-byte token reference, so there is no
+// per-event text formatting or escaping.  Every file is self-contained: the
+// token table is reset whenever a new file starts.  Files can be converted
+// back to the XML layout with binaryTraceToXml() below.
+struct BinaryTraceLogFormatter final : public ITraceLogFormatter, ReferenceCounted<BinaryTraceLogFormatter> {
+	void addref() override;
+	void delref() override;
+
+	const char* getExtension() const override;
+	const char* getHeader() const override;
+	const char* getFooter() const override;
+
+	std::string formatEvent(const TraceEventFields& fields) const override;
+
+private:
+	// formatEvent/getHeader are only called from the single trace log writer
+	// thread; the table is per-output-file state, not logically part of the
+	// formatter's observable value, hence mutable.
+	mutable std::unordered_map<std::string, uint32_t> nameTokens;
+};
+
+// Decodes a complete binary trace file (including header and footer) to the
+// equivalent XML trace text, one <Event .../> line per event.
+std::string binaryTraceToXml(std::string const& data);
+
+#endif
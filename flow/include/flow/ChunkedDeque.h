@@ -0,0 +1,211 @@
+/*
+ * ChunkedDeque.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLOW_CHUNKED_DEQUE_H
+#define FLOW_CHUNKED_DEQUE_H
+#pragma once
+
+#include "flow/Platform.h"
+#include <stdexcept>
+#include <vector>
+
+// ChunkedDeque is a drop-in alternative to Deque (same interface subset) that
+// stores elements in fixed-size segments instead of one circular array.
+// Growth appends a segment and at worst doubles the small segment-pointer map,
+// so a deque with millions of entries never pauses to copy all of its
+// elements the way Deque::grow() does.  Elements are never moved, so
+// references remain valid until the element is popped (unlike Deque).
+template <class T, int SegmentItems = 64>
+class ChunkedDeque {
+	static_assert(SegmentItems > 0 && (SegmentItems & (SegmentItems - 1)) == 0,
+	              "SegmentItems must be a power of two");
+
+public:
+	typedef T value_type;
+	typedef T& reference;
+	typedef T const& const_reference;
+	typedef int64_t difference_type;
+	typedef uint64_t size_type;
+
+	ChunkedDeque() : begin(0), end(0) {}
+
+	ChunkedDeque(ChunkedDeque const& r) : begin(0), end(0) {
+		for (size_type i = 0; i < r.size(); i++) {
+			push_back(r[i]);
+		}
+	}
+
+	void operator=(ChunkedDeque const& r) {
+		if (this == &r) {
+			return;
+		}
+		clear();
+		for (size_type i = 0; i < r.size(); i++) {
+			push_back(r[i]);
+		}
+	}
+
+	ChunkedDeque(ChunkedDeque&& r) noexcept : segs(std::move(r.segs)), begin(r.begin), end(r.end) {
+		r.segs.clear();
+		r.begin = r.end = 0;
+	}
+
+	void operator=(ChunkedDeque&& r) noexcept {
+		destroyAll();
+		segs = std::move(r.segs);
+		begin = r.begin;
+		end = r.end;
+		r.segs.clear();
+		r.begin = r.end = 0;
+	}
+
+	bool operator==(const ChunkedDeque& r) const {
+		if (size() != r.size())
+			return false;
+		for (size_type i = 0; i < size(); i++)
+			if ((*this)[i] != r[i])
+				return false;
+		return true;
+	}
+	bool operator!=(const ChunkedDeque& r) const { return !(*this == r); }
+
+	~ChunkedDeque() { destroyAll(); }
+
+	void push_back(const T& val) { new (slotForPushBack()) T(val); }
+
+	template <class... U>
+	reference emplace_back(U&&... val) {
+		T* p = new (slotForPushBack()) T(std::forward<U>(val)...);
+		return *p;
+	}
+
+	void pop_back() {
+		ASSERT(!empty());
+		end--;
+		elem(end).~T();
+		if (end == begin) {
+			releaseAll();
+			begin = end = 0;
+		} else if (end % SegmentItems == 0) {
+			releaseSegment(end / SegmentItems);
+		}
+	}
+
+	void pop_front() {
+		ASSERT(!empty());
+		elem(begin).~T();
+		begin++;
+		if (end == begin) {
+			releaseAll();
+			begin = end = 0;
+		} else if (begin % SegmentItems == 0) {
+			releaseSegment(begin / SegmentItems - 1);
+		}
+	}
+
+	void clear() {
+		destroyAll();
+		begin = end = 0;
+	}
+
+	size_type size() const { return end - begin; }
+	bool empty() const { return end == begin; }
+	size_type max_size() const { return uint64_t(1) << 62; }
+
+	T& front() { return elem(begin); }
+	T const& front() const { return elem(begin); }
+	T& back() { return elem(end - 1); }
+	T const& back() const { return elem(end - 1); }
+
+	T& operator[](size_type i) { return elem(begin + i); }
+	T const& operator[](size_type i) const { return elem(begin + i); }
+
+	T& at(size_type i) {
+		if (i >= size())
+			throw std::out_of_range("requires 0 <= i < size");
+		return (*this)[i];
+	}
+	T const& at(size_type i) const {
+		if (i >= size())
+			throw std::out_of_range("requires 0 <= i < size");
+		return (*this)[i];
+	}
+
+private:
+	// Circular map of segment pointers: absolute segment number s lives at
+	// segs[s & (segs.size()-1)]; segs.size() is always a power of two.
+	std::vector<T*> segs;
+	uint64_t begin, end; // absolute element indices
+
+	T& elem(uint64_t i) const { return segs[(i / SegmentItems) & (segs.size() - 1)][i % SegmentItems]; }
+
+	void* slotForPushBack() {
+		if (end % SegmentItems == 0) {
+			uint64_t seg = end / SegmentItems;
+			uint64_t liveSegs = empty() ? 0 : seg - begin / SegmentItems;
+			if (liveSegs + 1 > segs.size()) {
+				growMap();
+			}
+			T* block = (T*)aligned_alloc(std::max(__alignof(T), sizeof(void*)), SegmentItems * sizeof(T));
+			if (block == nullptr) {
+				platform::outOfMemory();
+			}
+			segs[seg & (segs.size() - 1)] = block;
+		}
+		T* p = &elem(end);
+		end++;
+		return p;
+	}
+
+	// Doubles the segment-pointer map; copies only pointers, never elements.
+	void growMap() {
+		size_t newSize = std::max<size_t>(8, segs.size() * 2);
+		std::vector<T*> newSegs(newSize, nullptr);
+		for (uint64_t s = begin / SegmentItems; s <= (empty() ? begin : end - 1) / SegmentItems && !segs.empty();
+		     s++) {
+			newSegs[s & (newSize - 1)] = segs[s & (segs.size() - 1)];
+		}
+		segs = std::move(newSegs);
+	}
+
+	void releaseSegment(uint64_t seg) {
+		T*& slot = segs[seg & (segs.size() - 1)];
+		aligned_free(slot);
+		slot = nullptr;
+	}
+
+	void releaseAll() {
+		for (auto& s : segs) {
+			if (s) {
+				aligned_free(s);
+				s = nullptr;
+			}
+		}
+	}
+
+	void destroyAll() {
+		for (uint64_t i = begin; i != end; i++) {
+			elem(i).~T();
+		}
+		releaseAll();
+	}
+};
+
+#endif
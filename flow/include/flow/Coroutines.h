@@ -0,0 +1,154 @@
+/*
+ * Coroutines.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLOW_COROUTINES_H
+#define FLOW_COROUTINES_H
+#pragma once
+
+// C++20 coroutine support for flow: a coroutine returning Future<T> can
+// co_await other Futures directly, with no actor compiler involvement.
+// The coroutine frame (which replaces the actor compiler's generated state
+// class) is allocated from FastAllocator, so a short-lived coroutine costs
+// one pooled allocation, the same as an actor today but without the
+// generated-code virtual dispatch per wait.
+//
+// This is opt-in infrastructure: the tree still builds as C++17, where this
+// entire header compiles away.  Known limitations relative to actors, to be
+// addressed before hot-path actors are ported:
+//   * Cancelling the returned Future does not interrupt the coroutine; it
+//     runs until its next co_await completes and then delivers into a
+//     broken promise.  Actors are cancelled at their next wait.
+//   * No uncancellable/UNCANCELLABLE distinction.
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#define FLOW_HAS_COROUTINES 1
+#else
+#define FLOW_HAS_COROUTINES 0
+#endif
+
+#if FLOW_HAS_COROUTINES
+
+#include <coroutine>
+
+#include "flow/flow.h"
+
+namespace coro_impl {
+
+// Waits for a Future inside a coroutine.  Registered as an ordinary flow
+// Callback; the value or error is copied out in fire()/error() because the
+// SAV may be destroyed before the resumed coroutine reads the result.
+template <class T>
+struct FutureAwaiter final : Callback<T> {
+	Future<T> future;
+	Optional<T> value;
+	Error err;
+	std::coroutine_handle<> handle;
+
+	explicit FutureAwaiter(Future<T> const& f) : future(f) {}
+
+	bool await_ready() {
+		if (!future.isReady())
+			return false;
+		if (future.isError())
+			err = future.getError();
+		else
+			value = future.get();
+		return true;
+	}
+
+	void await_suspend(std::coroutine_handle<> h) {
+		handle = h;
+		future.addCallbackAndClear(this);
+	}
+
+	T await_resume() {
+		if (err.isValid())
+			throw err;
+		return std::move(value.get());
+	}
+
+	void fire(T const& v) override {
+		Callback<T>::remove();
+		value = v;
+		handle.resume();
+	}
+	void fire(T&& v) override {
+		Callback<T>::remove();
+		value = std::move(v);
+		handle.resume();
+	}
+	void error(Error e) override {
+		Callback<T>::remove();
+		err = e;
+		handle.resume();
+	}
+};
+
+// Shared by the Void and non-Void promise types below.  The frame allocation
+// the compiler requests here includes the coroutine state, so routing it
+// through FastAllocator covers the whole per-call allocation.
+template <class T>
+struct PromiseBase {
+	Promise<T> promise;
+
+	Future<T> get_return_object() { return promise.getFuture(); }
+	std::suspend_never initial_suspend() noexcept { return {}; }
+	std::suspend_never final_suspend() noexcept { return {}; }
+
+	void unhandled_exception() {
+		try {
+			throw;
+		} catch (Error& e) {
+			promise.sendError(e);
+		} catch (...) {
+			promise.sendError(unknown_error());
+		}
+	}
+
+	static void* operator new(size_t size) { return allocateFast((int)size); }
+	static void operator delete(void* ptr, size_t size) { freeFast((int)size, ptr); }
+};
+
+template <class T>
+struct CoroPromise : PromiseBase<T> {
+	void return_value(T const& v) { this->promise.send(v); }
+	void return_value(T&& v) { this->promise.send(std::move(v)); }
+};
+
+template <>
+struct CoroPromise<Void> : PromiseBase<Void> {
+	void return_void() { this->promise.send(Void()); }
+};
+
+} // namespace coro_impl
+
+template <class T>
+auto operator co_await(Future<T> const& future) {
+	return coro_impl::FutureAwaiter<T>(future);
+}
+
+template <class T, class... Args>
+struct std::coroutine_traits<Future<T>, Args...> {
+	using promise_type = coro_impl::CoroPromise<T>;
+};
+
+#endif // FLOW_HAS_COROUTINES
+
+#endif
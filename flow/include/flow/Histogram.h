@@ -23,6 +23,7 @@
 #pragma once
 
 #include <flow/Arena.h>
+#include <atomic>
 #include <string>
 #include <map>
 #include <unordered_map>
@@ -119,7 +120,7 @@ public:
 		idx = sample ? (31 - __builtin_clz(sample)) : 0;
 #endif
 		ASSERT(idx < 32);
-		buckets[idx]++;
+		bump(idx);
 	}
 
 	inline void sampleSeconds(double delta) {
@@ -138,7 +139,7 @@ public:
 		}
 		size_t idx = (pct * 100) / 4;
 		ASSERT(idx < 32 && idx >= 0);
-		buckets[idx]++;
+		bump(idx);
 	}
 
 	// Histogram buckets samples into one of the same sized buckets
@@ -149,7 +150,7 @@ public:
 		}
 		size_t idx = ((sample - lowerBound) * 31.0) / (upperBound - lowerBound);
 		ASSERT(idx < 32 && idx >= 0);
-		buckets[idx]++;
+		bump(idx);
 	}
 
 	void updateUpperBound(uint32_t upperBound) {
@@ -158,10 +159,36 @@ public:
 	}
 
 	void clear() {
+		for (auto& stripe : stripes) {
+			for (auto& b : stripe.buckets) {
+				b.store(0, std::memory_order_relaxed);
+			}
+		}
 		for (uint32_t& i : buckets) {
 			i = 0;
 		}
 	}
+
+	// Drains the per-thread stripes into buckets[].  Called at report time;
+	// counts sampled concurrently with the merge land in the next report.
+	void mergeStripes() {
+		for (auto& stripe : stripes) {
+			for (uint32_t i = 0; i < 32; i++) {
+				buckets[i] += stripe.buckets[i].exchange(0, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	// Non-destructive read of a single bucket, including unmerged stripe counts.
+	uint32_t bucketCount(size_t idx) const {
+		ASSERT(idx < 32);
+		uint32_t total = buckets[idx];
+		for (auto& stripe : stripes) {
+			total += stripe.buckets[idx].load(std::memory_order_relaxed);
+		}
+		return total;
+	}
+
 	void writeToLog(double elapsed = -1.0);
 
 	std::string name() const { return generateName(this->group, this->op); }
@@ -172,9 +199,27 @@ public:
 	std::string const op;
 	Unit const unit;
 	Reference<HistogramRegistry> registry;
+	// Samples land in one of a few cache-line-aligned stripes chosen per
+	// thread, so concurrent samplers (e.g. RocksDB reader threads) don't
+	// ping-pong a shared line; buckets[] is the merged view built by
+	// mergeStripes() at report time.
+	static constexpr unsigned NUM_STRIPES = 8;
+	struct alignas(64) BucketStripe {
+		std::atomic<uint32_t> buckets[32];
+	};
+	BucketStripe stripes[NUM_STRIPES];
 	uint32_t buckets[32];
 	uint32_t lowerBound;
 	uint32_t upperBound;
+
+private:
+	static unsigned stripeIndex() {
+		static std::atomic<unsigned> nextStripe(0);
+		static thread_local unsigned stripe = nextStripe.fetch_add(1, std::memory_order_relaxed) % NUM_STRIPES;
+		return stripe;
+	}
+
+	inline void bump(size_t idx) { stripes[stripeIndex()].buckets[idx].fetch_add(1, std::memory_order_relaxed); }
 };
 
 #endif // FLOW_HISTOGRAM_H
@@ -192,6 +192,13 @@ public:
 	//   inserted.
 	int insert(const std::vector<std::pair<T, Metric>>& data, bool replaceExisting = true);
 
+	// Constructs a balanced tree directly from data, which must be sorted and
+	// contain no duplicates, in a single O(n) pass with no rebalancing.  The
+	// set must be empty.  Items are moved out of data.  Nodes are allocated in
+	// key order, so an in-order traversal of the resulting tree touches memory
+	// nearly sequentially, unlike a tree grown by incremental insertion.
+	void bulkBuild(std::vector<std::pair<T, Metric>>& data);
+
 	// Increase the metric for the given item by the given amount.  Inserts data into the set if it
 	//   doesn't exist. Returns the new sum.
 	template <class T_, class Metric_>
@@ -316,6 +323,8 @@ private:
 
 	Node* root;
 
+	static Node* buildBalanced(std::vector<std::pair<T, Metric>>& data, int begin, int end, Node* parent, int& height);
+
 	Metric eraseHalf(Node* start, Node* end, int eraseDir, int& heightDelta, std::vector<Node*>& toFree);
 	void erase(iterator begin, iterator end, std::vector<Node*>& toFree);
 
@@ -458,6 +467,7 @@ public:
 	int insert(const std::vector<std::pair<MapPair<Key, Value>, Metric>>& pairs, bool replaceExisting = true) {
 		return set.insert(pairs, replaceExisting);
 	}
+	void bulkBuild(std::vector<std::pair<MapPair<Key, Value>, Metric>>& pairs) { set.bulkBuild(pairs); }
 
 	template <class KeyCompatible>
 	void erase(KeyCompatible const& k) {
@@ -1027,6 +1037,53 @@ int IndexedSet<T, Metric>::insert(const std::vector<std::pair<T, Metric>>& dataV
 	return num_inserted;
 }
 
+template <class T, class Metric>
+typename IndexedSet<T, Metric>::Node* IndexedSet<T, Metric>::buildBalanced(std::vector<std::pair<T, Metric>>& data,
+                                                                           int begin,
+                                                                           int end,
+                                                                           Node* parent,
+                                                                           int& height) {
+	if (begin == end) {
+		height = 0;
+		return nullptr;
+	}
+
+	int mid = begin + (end - begin) / 2;
+
+	// Build the left subtree before allocating this node, so that nodes come
+	// out of FastAllocator in key order and an in-order walk of the finished
+	// tree visits memory nearly sequentially.
+	int leftHeight = 0, rightHeight = 0;
+	Node* left = buildBalanced(data, begin, mid, nullptr, leftHeight);
+
+	Node* n = new Node(std::move(data[mid].first), std::move(data[mid].second), parent);
+	if (left) {
+		left->parent = n;
+		n->child[0] = left;
+		n->total = n->total + left->total;
+	}
+
+	Node* right = buildBalanced(data, mid + 1, end, n, rightHeight);
+	if (right) {
+		n->child[1] = right;
+		n->total = n->total + right->total;
+	}
+
+	n->balance = rightHeight - leftHeight;
+	height = std::max(leftHeight, rightHeight) + 1;
+	return n;
+}
+
+template <class T, class Metric>
+void IndexedSet<T, Metric>::bulkBuild(std::vector<std::pair<T, Metric>>& data) {
+	ASSERT(root == nullptr);
+	for (int i = 1; i < data.size(); ++i) {
+		ASSERT(compare(data[i - 1].first, data[i].first) < 0);
+	}
+	int height = 0;
+	root = buildBalanced(data, 0, (int)data.size(), nullptr, height);
+}
+
 template <class T, class Metric>
 Metric IndexedSet<T, Metric>::eraseHalf(Node* start,
                                         Node* end,
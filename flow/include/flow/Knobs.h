@@ -128,11 +128,15 @@ public:
 
 	int DISABLE_ASSERTS;
 	double QUEUE_MODEL_SMOOTHING_AMOUNT;
+	double QUEUE_MODEL_PENALTY_DECAY_TIME;
+	double QUEUE_MODEL_PROBE_INTERVAL;
+	bool QUEUE_MODEL_SHARED_STATE;
 
 	int RANDOMSEED_RETRY_LIMIT;
 	double FAST_ALLOC_LOGGING_BYTES;
 	double HUGE_ARENA_LOGGING_BYTES;
 	double HUGE_ARENA_LOGGING_INTERVAL;
+	double ARENA_ADOPT_DOMINANT_FRACTION;
 
 	double MEMORY_USAGE_CHECK_INTERVAL;
 
@@ -161,6 +165,8 @@ public:
 	double CONNECTION_MONITOR_TIMEOUT;
 	double CONNECTION_MONITOR_IDLE_TIMEOUT;
 	double CONNECTION_MONITOR_INCOMING_IDLE_MULTIPLIER;
+	double CONNECTION_MONITOR_BUSY_PING_INTERVAL; // min time between explicit pings to a peer that is sending us data;
+	                                              // 0 pings every monitor loop regardless of traffic
 	double CONNECTION_MONITOR_UNREFERENCED_CLOSE_DELAY;
 
 	// FlowTransport
@@ -188,6 +194,8 @@ public:
 	int TLS_HANDSHAKE_THREAD_STACKSIZE;
 	int TLS_MALLOC_ARENA_MAX;
 	int TLS_HANDSHAKE_LIMIT;
+	bool TLS_SESSION_RESUMPTION; // Cache client TLS sessions and resume them on reconnect to the same peer
+	int TLS_SESSION_CACHE_SIZE; // Maximum number of peers with a cached TLS session
 
 	int NETWORK_TEST_CLIENT_COUNT;
 	int NETWORK_TEST_REPLY_SIZE;
@@ -204,7 +212,7 @@ public:
 	int64_t SIM_PAGE_CACHE_64K;
 	int64_t BUGGIFY_SIM_PAGE_CACHE_4K;
 	int64_t BUGGIFY_SIM_PAGE_CACHE_64K;
-	std::string CACHE_EVICTION_POLICY; // for now, "random", "lru", are supported
+	std::string CACHE_EVICTION_POLICY; // for now, "random", "lru", "sieve" are supported
 	int MAX_EVICT_ATTEMPTS;
 	double PAGE_CACHE_TRUNCATE_LOOKUP_FRACTION;
 	double TOO_MANY_CONNECTIONS_CLOSED_RESET_DELAY;
@@ -226,6 +234,8 @@ public:
 	double DISK_METRIC_LOGGING_INTERVAL;
 
 	int PAGE_WRITE_CHECKSUM_HISTORY;
+	double PAGE_WRITE_CHECKSUM_SAMPLE_RATE; // Fraction of pages tracked by the write checker; pages are chosen
+	                                        // deterministically by page number so writes and reads agree
 	int DISABLE_POSIX_KERNEL_AIO;
 
 	// AsyncFileNonDurable
@@ -251,6 +261,7 @@ public:
 	// Net2
 	double MIN_COALESCE_DELAY;
 	double MAX_COALESCE_DELAY;
+	double COALESCE_IDLE_THRESHOLD;
 	double SLOW_LOOP_CUTOFF;
 	double SLOW_LOOP_SAMPLING_RATE;
 	int64_t TSC_YIELD_TIME;
@@ -259,6 +270,13 @@ public:
 	int CERT_FILE_MAX_SIZE;
 	int READY_QUEUE_RESERVED_SIZE;
 	int TASKS_PER_REACTOR_CHECK;
+	double RUN_LOOP_STARVATION_THRESHOLD;
+	int NET2_REACTOR_SHARDS;
+	int NET2_WORK_STEAL_BATCH;
+	double NET2_TIMER_WHEEL_RESOLUTION;
+	int NET2_TIMER_WHEEL_SLOTS;
+	int NET2_THREAD_READY_RING_SIZE;
+	double NET2_RUN_LOOP_SPIN_WINDOW;
 
 	// Network
 	int64_t PACKET_LIMIT;
@@ -276,6 +294,7 @@ public:
 	double MAX_OPEN_TIME;
 	int64_t SIM_DISK_IOPS;
 	int64_t SIM_DISK_BANDWIDTH;
+	std::string SIM_DISK_PROFILE_FILE;
 	double MIN_NETWORK_LATENCY;
 	double FAST_NETWORK_LATENCY;
 	double SLOW_NETWORK_LATENCY;
@@ -358,6 +377,8 @@ public:
 
 	// Authorization
 	int TOKEN_CACHE_SIZE;
+	int TOKEN_NEGATIVE_CACHE_SIZE;
+	double TOKEN_NEGATIVE_CACHE_TTL;
 
 	// RESTClient
 	int RESTCLIENT_MAX_CONNECTIONPOOL_SIZE;
@@ -0,0 +1,126 @@
+/*
+ * MPSCRingQueue.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLOW_MPSC_RING_QUEUE_H
+#define FLOW_MPSC_RING_QUEUE_H
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "flow/Arena.h"
+#include "flow/Error.h"
+
+// MPSCRingQueue<T> is a bounded lock-free multi-producer, single-consumer ring
+// (Vyukov's bounded queue, specialized for one consumer).  A push costs a
+// single uncontended compare-and-swap; pop is wait-free.  tryPush fails when
+// the ring is full, so callers that need unbounded semantics keep a fallback
+// queue (see Net2's threadReady).
+//
+// Like ThreadSafeQueue, it supports event-loop integration with coalesced
+// wakeups: the consumer calls canSleep() before blocking, and a producer whose
+// tryPush returned NeedsWake (at most one producer per sleep cycle) wakes it.
+template <class T>
+class MPSCRingQueue : NonCopyable {
+public:
+	enum class PushResult { Queued, NeedsWake, Full };
+
+	explicit MPSCRingQueue(int capacity) : cells(roundUpToPowerOfTwo(capacity)), mask(cells.size() - 1) {
+		for (size_t i = 0; i < cells.size(); i++) {
+			cells[i].seq.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	PushResult tryPush(T const& t) {
+		size_t pos = enqueuePos.load(std::memory_order_relaxed);
+		for (;;) {
+			Cell& cell = cells[pos & mask];
+			size_t seq = cell.seq.load(std::memory_order_acquire);
+			intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+			if (dif == 0) {
+				if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					cell.data = t;
+					cell.seq.store(pos + 1, std::memory_order_release);
+					if (sleeping.load(std::memory_order_acquire) && sleeping.exchange(false)) {
+						return PushResult::NeedsWake;
+					}
+					return PushResult::Queued;
+				}
+			} else if (dif < 0) {
+				return PushResult::Full;
+			} else {
+				pos = enqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	// Must be called only from the consumer thread.
+	Optional<T> pop() {
+		Cell& cell = cells[dequeuePos & mask];
+		size_t seq = cell.seq.load(std::memory_order_acquire);
+		if ((intptr_t)seq - (intptr_t)(dequeuePos + 1) < 0) {
+			return Optional<T>();
+		}
+		T t = cell.data;
+		cell.seq.store(dequeuePos + mask + 1, std::memory_order_release);
+		++dequeuePos;
+		return t;
+	}
+
+	// Consumer-side sleep arming, mirroring ThreadSafeQueue::canSleep: returns
+	// true if the queue was empty and the next push will report NeedsWake.
+	bool canSleep() {
+		sleeping.store(true, std::memory_order_seq_cst);
+		if (!empty()) {
+			sleeping.store(false, std::memory_order_relaxed);
+			return false;
+		}
+		return true;
+	}
+
+	// May spuriously return false under concurrent pushes; exact when quiescent.
+	bool empty() const {
+		Cell const& cell = cells[dequeuePos & mask];
+		return (intptr_t)cell.seq.load(std::memory_order_acquire) - (intptr_t)(dequeuePos + 1) < 0;
+	}
+
+private:
+	struct Cell {
+		std::atomic<size_t> seq;
+		T data;
+	};
+
+	static size_t roundUpToPowerOfTwo(int capacity) {
+		ASSERT(capacity > 0);
+		size_t n = 1;
+		while (n < (size_t)capacity) {
+			n <<= 1;
+		}
+		return n;
+	}
+
+	std::vector<Cell> cells;
+	size_t mask;
+	std::atomic<size_t> enqueuePos{ 0 };
+	size_t dequeuePos = 0; // consumer-owned
+	std::atomic<bool> sleeping{ false };
+};
+
+#endif
@@ -55,11 +55,13 @@ public:
 		sendQueueLatencyHistogram = Reference<Histogram>(nullptr);
 	}
 
-	// Get a PacketBuffer to write new packets into
+	// Get a PacketBuffer to write new packets into.  Without an explicit size hint, the buffer
+	// size class is chosen from the queue's recent throughput: connections that have sent
+	// little lately get small buffers, bulk transfers keep getting large ones.
 	PacketBuffer* getWriteBuffer(size_t sizeHint = 0) {
 		if (!unsent_last) {
 			ASSERT(!unsent_first);
-			unsent_first = unsent_last = PacketBuffer::create(sizeHint);
+			unsent_first = unsent_last = PacketBuffer::create(sizeHint ? sizeHint : preferredBufferBytes());
 		};
 		return unsent_last;
 	}
@@ -89,6 +91,15 @@ private:
 	PacketBuffer *unsent_first, *unsent_last; // Both nullptr, or inclusive range of PacketBuffers that haven't been
 	                                          // sent.  The last one may have space for more packets to be written.
 	Reference<Histogram> sendQueueLatencyHistogram;
+
+	// Exponentially decayed count of bytes recently sent from this queue, used by
+	// preferredBufferBytes() to pick the size class for new write buffers
+	double recentSentBytes = 0;
+	double recentSentTime = 0;
+	static constexpr double THROUGHPUT_DECAY_TIME = 2.0;
+
+	void updateThroughput(int bytes);
+	size_t preferredBufferBytes() const;
 };
 
 class ReliablePacketList : NonCopyable {
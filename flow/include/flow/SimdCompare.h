@@ -0,0 +1,48 @@
+/*
+ * SimdCompare.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLOW_SIMD_COMPARE_H
+#define FLOW_SIMD_COMPARE_H
+#pragma once
+
+#include <cstdint>
+
+namespace simd_compare_impl {
+// The best compare kernel for this CPU, chosen once at static initialization:
+// AVX2 on x86-64 when available, NEON on aarch64, otherwise a memcmp-based
+// fallback.  Returns a memcmp-style result for [a, a+n) vs [b, b+n) and, when
+// commonPrefixLen is non-null, stores the length of the byte-wise common
+// prefix of the two ranges.
+extern int (*const compareAndPrefix)(const uint8_t* a, const uint8_t* b, int n, int* commonPrefixLen);
+} // namespace simd_compare_impl
+
+// memcmp-compatible vectorized comparison of equal-length byte ranges.
+inline int simdMemcmp(const void* a, const void* b, int n) {
+	return simd_compare_impl::compareAndPrefix((const uint8_t*)a, (const uint8_t*)b, n, nullptr);
+}
+
+// Like simdMemcmp, but also reports the length of the common prefix of the two
+// ranges, which callers descending a tree can use to skip bytes already known
+// equal.
+inline int simdMemcmpWithPrefix(const void* a, const void* b, int n, int* commonPrefixLen) {
+	return simd_compare_impl::compareAndPrefix((const uint8_t*)a, (const uint8_t*)b, n, commonPrefixLen);
+}
+
+#endif
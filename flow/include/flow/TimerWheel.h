@@ -0,0 +1,182 @@
+/*
+ * TimerWheel.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLOW_TIMER_WHEEL_H
+#define FLOW_TIMER_WHEEL_H
+#pragma once
+
+#include <cmath>
+#include <queue>
+#include <vector>
+
+#include "flow/Error.h"
+
+// TimerWheel<T> is a timing wheel for the run loop's pending timers.  T must
+// expose a double member `at` (absolute deadline in seconds).  Deadlines within
+// the wheel's span are bucketed into slots of `resolution` seconds, making
+// insert and expiry O(1) amortized instead of the O(log n) of a binary heap;
+// deadlines beyond the span sit in an overflow heap and migrate into the wheel
+// as it advances.  Timers never fire early; they may fire up to one resolution
+// late, which is within the scheduling granularity the run loop already has.
+template <class T>
+class TimerWheel {
+public:
+	explicit TimerWheel(double resolution, int numSlots = 4096)
+	  : resolution(resolution), slots(numSlots), occupied((numSlots + 63) / 64), curTick(0), wheelCount(0) {
+		ASSERT(resolution > 0 && numSlots > 0);
+	}
+
+	bool empty() const { return wheelCount == 0 && overflow.empty(); }
+	size_t size() const { return wheelCount + overflow.size(); }
+
+	void push(T const& t) {
+		// Until expire() has positioned the window near the current time, or if
+		// the deadline is beyond the window, the timer waits in the overflow
+		// heap; expire() migrates it into the wheel once the window reaches it.
+		int64_t tick = tickFor(t.at);
+		if (tick < curTick + (int64_t)slots.size()) {
+			placeInWheel(std::max(tick, curTick), t);
+		} else {
+			overflow.push(t);
+		}
+	}
+
+	// The earliest time at which expire() could fire a timer, for computing how
+	// long the run loop may sleep.  Returns infinity if no timers are pending.
+	double nextAt() const {
+		double next = 1e99;
+		if (!overflow.empty()) {
+			next = overflow.top().at;
+		}
+		if (wheelCount != 0) {
+			int64_t tick = nextOccupiedTick();
+			ASSERT(tick >= 0);
+			next = std::min(next, tick * resolution);
+		}
+		return next;
+	}
+
+	// Invokes fn for every timer with a deadline at or before now, advancing
+	// the wheel.  Returns the number of timers fired.
+	template <class Fn>
+	int expire(double now, Fn fn) {
+		int fired = 0;
+		int64_t nowTick = (int64_t)std::floor(now / resolution);
+		while (curTick <= nowTick && !empty()) {
+			if (wheelCount == 0) {
+				// Skip the idle region in one step, repositioning the window so
+				// migration below sees the overflow timers.
+				curTick = std::max(curTick, std::min(nowTick + 1, tickFor(overflow.top().at)));
+			}
+			migrateOverflow();
+			if (curTick > nowTick) {
+				break;
+			}
+			auto& slot = slots[curTick % slots.size()];
+			for (auto& t : slot) {
+				fn(t);
+				++fired;
+			}
+			wheelCount -= slot.size();
+			slot.clear();
+			clearOccupied(curTick % slots.size());
+			++curTick;
+			migrateOverflow();
+		}
+		return fired;
+	}
+
+	void clear() {
+		for (auto& s : slots) {
+			s.clear();
+		}
+		for (auto& w : occupied) {
+			w = 0;
+		}
+		wheelCount = 0;
+		decltype(overflow) empty;
+		overflow.swap(empty);
+	}
+
+private:
+	struct CompareAt {
+		bool operator()(T const& a, T const& b) const { return a.at > b.at; }
+	};
+
+	int64_t tickFor(double at) const { return (int64_t)std::ceil(at / resolution); }
+
+	void placeInWheel(int64_t tick, T const& t) {
+		int slot = tick % slots.size();
+		slots[slot].push_back(t);
+		occupied[slot >> 6] |= uint64_t(1) << (slot & 63);
+		++wheelCount;
+	}
+
+	void clearOccupied(int slot) {
+		if (slots[slot].empty()) {
+			occupied[slot >> 6] &= ~(uint64_t(1) << (slot & 63));
+		}
+	}
+
+	void migrateOverflow() {
+		while (!overflow.empty() && tickFor(overflow.top().at) < curTick + (int64_t)slots.size()) {
+			placeInWheel(std::max(tickFor(overflow.top().at), curTick), overflow.top());
+			overflow.pop();
+		}
+	}
+
+	// Finds the tick of the first occupied slot at or after curTick by scanning
+	// the occupancy bitmap, one 64-slot word at a time.
+	int64_t nextOccupiedTick() const {
+		int n = slots.size();
+		int start = curTick % n;
+		for (int scanned = 0; scanned < n;) {
+			int slot = (start + scanned) % n;
+			uint64_t word = occupied[slot >> 6] >> (slot & 63);
+			if (word != 0) {
+				int offset = scanned + firstSetBit(word);
+				if (offset >= n) {
+					break;
+				}
+				return curTick + offset;
+			}
+			scanned += 64 - (slot & 63);
+		}
+		return -1;
+	}
+
+	static int firstSetBit(uint64_t word) {
+		int i = 0;
+		while (!(word & 1)) {
+			word >>= 1;
+			++i;
+		}
+		return i;
+	}
+
+	double resolution;
+	std::vector<std::vector<T>> slots;
+	std::vector<uint64_t> occupied;
+	int64_t curTick; // Slots at ticks < curTick have already been expired
+	size_t wheelCount;
+	std::priority_queue<T, std::vector<T>, CompareAt> overflow;
+};
+
+#endif
@@ -656,6 +656,18 @@ bool selectTraceClockSource(std::string source);
 // Returns true iff source is recognized.
 bool validateTraceClockSource(std::string source);
 
+// Overrides the minimum severity required for events of the given type to be logged, replacing
+// MIN_TRACE_SEVERITY for that type only. Allows turning up diagnostic detail for one subsystem
+// (or quieting a noisy one) at runtime. Thread safe.
+void setTraceTypeSeverity(std::string const& type, int minSeverity);
+void clearTraceTypeSeverity(std::string const& type);
+
+// Limits events of the given type to a token bucket refilled at eventsPerSecond, with at most
+// burstSize events passing back-to-back. Suppressed events are counted and the count is attached
+// as "SuppressedEventCount" to the next event of the type that is logged. Thread safe.
+void setTraceTypeRateLimit(std::string const& type, double eventsPerSecond, double burstSize);
+void clearTraceTypeRateLimit(std::string const& type);
+
 void addTraceRole(std::string const& role);
 void removeTraceRole(std::string const& role);
 void retrieveTraceLogIssues(std::set<std::string>& out);
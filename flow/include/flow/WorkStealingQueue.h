@@ -0,0 +1,162 @@
+/*
+ * WorkStealingQueue.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLOW_WORK_STEALING_QUEUE_H
+#define FLOW_WORK_STEALING_QUEUE_H
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "flow/Arena.h"
+#include "flow/Error.h"
+#include "flow/ThreadPrimitives.h"
+
+// WorkStealingQueue<T> is a set of priority-ordered run queues (shards), one per
+// reactor thread, with a stealing path used when a shard runs dry.  T must be
+// ordered by operator< (largest item is popped first, matching the convention of
+// the Net2 ready queue).
+//
+// Each shard is an ordinary binary heap guarded by a spin lock.  The common case
+// (an owner pushing and popping its own shard without contention) takes the lock
+// uncontended; stealing locks a victim shard and transfers up to stealBatch items
+// in one critical section so that a burst of imbalance is amortized over a single
+// lock acquisition.
+template <class T>
+class WorkStealingQueue : NonCopyable {
+public:
+	WorkStealingQueue(int numShards, int stealBatch, int reservedSizePerShard = 0)
+	  : shards(numShards), stealBatch(std::max(1, stealBatch)) {
+		ASSERT(numShards > 0);
+		for (auto& s : shards) {
+			s.items.reserve(reservedSizePerShard);
+		}
+	}
+
+	int numShards() const { return shards.size(); }
+
+	void push(int shard, T const& item) {
+		Shard& s = shards[shard];
+		ThreadSpinLockHolder holder(s.lock);
+		s.items.push_back(item);
+		std::push_heap(s.items.begin(), s.items.end());
+		s.size.store(s.items.size(), std::memory_order_release);
+	}
+
+	// Pops the highest-priority item from the owner's shard, falling back to
+	// stealing a batch from the fullest sibling shard.  Returns nothing only if
+	// every shard was observed empty.
+	Optional<T> pop(int shard) {
+		Optional<T> item = popLocal(shard);
+		if (item.present()) {
+			return item;
+		}
+		int victim = fullestShard(shard);
+		if (victim >= 0 && stealFrom(victim, shard)) {
+			return popLocal(shard);
+		}
+		return Optional<T>();
+	}
+
+	// An inexpensive emptiness check suitable for deciding whether a reactor may
+	// sleep.  May spuriously return false under concurrent pops.
+	bool empty() const {
+		for (auto& s : shards) {
+			if (s.size.load(std::memory_order_acquire) > 0) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	size_t size() const {
+		size_t total = 0;
+		for (auto& s : shards) {
+			total += s.size.load(std::memory_order_acquire);
+		}
+		return total;
+	}
+
+private:
+	struct Shard {
+		ThreadSpinLock lock;
+		std::vector<T> items; // binary heap ordered by operator<
+		std::atomic<size_t> size{ 0 };
+	};
+
+	Optional<T> popLocal(int shard) {
+		Shard& s = shards[shard];
+		ThreadSpinLockHolder holder(s.lock);
+		if (s.items.empty()) {
+			return Optional<T>();
+		}
+		std::pop_heap(s.items.begin(), s.items.end());
+		T item = s.items.back();
+		s.items.pop_back();
+		s.size.store(s.items.size(), std::memory_order_release);
+		return item;
+	}
+
+	// Chooses the sibling with the most queued work, based on the unlocked size
+	// hints; a slightly stale answer only costs an extra steal attempt.
+	int fullestShard(int except) const {
+		int victim = -1;
+		size_t victimSize = 0;
+		for (int i = 0; i < (int)shards.size(); i++) {
+			if (i == except) {
+				continue;
+			}
+			size_t sz = shards[i].size.load(std::memory_order_acquire);
+			if (sz > victimSize) {
+				victimSize = sz;
+				victim = i;
+			}
+		}
+		return victim;
+	}
+
+	bool stealFrom(int victim, int thief) {
+		// Lock ordering: always lower index first, so concurrent thieves cannot
+		// deadlock against each other.
+		Shard& v = shards[victim];
+		Shard& t = shards[thief];
+		ThreadSpinLockHolder first(victim < thief ? v.lock : t.lock);
+		ThreadSpinLockHolder second(victim < thief ? t.lock : v.lock);
+		if (v.items.empty()) {
+			return false;
+		}
+		int toSteal = std::min<int>(stealBatch, (v.items.size() + 1) / 2);
+		for (int i = 0; i < toSteal; i++) {
+			std::pop_heap(v.items.begin(), v.items.end());
+			t.items.push_back(v.items.back());
+			v.items.pop_back();
+			std::push_heap(t.items.begin(), t.items.end());
+		}
+		v.size.store(v.items.size(), std::memory_order_release);
+		t.size.store(t.items.size(), std::memory_order_release);
+		return true;
+	}
+
+	std::vector<Shard> shards;
+	int stealBatch;
+};
+
+#endif
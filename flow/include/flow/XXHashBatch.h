@@ -0,0 +1,44 @@
+/*
+ * XXHashBatch.h
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLOW_XXHASH_BATCH_H
+#define FLOW_XXHASH_BATCH_H
+#pragma once
+
+#include <cstddef>
+
+#include "flow/xxhash.h"
+
+// One entry per buffer to hash; result is filled in by xxh3Batch().
+struct XXHashBatchItem {
+	const void* data;
+	size_t len;
+	XXH64_hash_t seed = 0;
+	XXH64_hash_t result = 0;
+};
+
+// Hashes a group of independent buffers (e.g. 4-8 pages from one commit) in
+// a single call.  Each result is identical to XXH3_64bits_withSeed() on the
+// corresponding buffer; the win is that the start of the next buffer is
+// prefetched while the current one is hashed, hiding the DRAM miss that a
+// page-at-a-time loop pays at the top of every page.
+void xxh3Batch(XXHashBatchItem* items, int count);
+
+#endif
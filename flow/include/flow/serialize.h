@@ -546,6 +546,97 @@ private:
 	}
 };
 
+// A BinaryWriter-compatible archive with a fixed-capacity inline buffer.
+// Serialization does no arena allocation and no growth checks beyond a bounds
+// assert, and toValue() makes a single exact-size copy, so short fixed-layout
+// values (per-tag persistent keys on the TLog commit path, for example) avoid
+// BinaryWriter's grow-and-recopy entirely.  The output is byte-identical to
+// BinaryWriter's for the same writes.  Exceeding Capacity is a program error.
+template <int Capacity>
+class FixedSizeWriter : NonCopyable {
+public:
+	static const int isDeserializing = 0;
+	static constexpr bool isSerializing = true;
+	typedef FixedSizeWriter WRITER;
+
+	template <class VersionOptions>
+	explicit FixedSizeWriter(VersionOptions vo) : size(0) {
+		vo.write(*this);
+	}
+
+	void serializeBytes(StringRef bytes) { serializeBytes(bytes.begin(), bytes.size()); }
+	void serializeBytes(const void* data, int bytes) {
+		if (bytes > 0) {
+			memcpy(writeBytes(bytes), data, bytes);
+		}
+	}
+	template <class T>
+	void serializeBinaryItem(const T& t) {
+		static_assert(is_binary_serializable<T>::value,
+		              "Object must be binary serializable, see BINARY_SERIALIZABLE macro");
+		*(T*)writeBytes(sizeof(T)) = t;
+	}
+	void* getData() { return buf; }
+	int getLength() const { return size; }
+	Standalone<StringRef> toValue() const { return Standalone<StringRef>(StringRef(buf, size)); }
+	StringRef toValue(Arena& arena) const { return StringRef(arena, StringRef(buf, size)); }
+	ProtocolVersion protocolVersion() const { return m_protocolVersion; }
+	void setProtocolVersion(ProtocolVersion pv) { m_protocolVersion = pv; }
+
+private:
+	uint8_t buf[Capacity];
+	int size;
+	ProtocolVersion m_protocolVersion;
+
+	void* writeBytes(int s) {
+		ASSERT(size + s <= Capacity);
+		void* p = buf + size;
+		size += s;
+		return p;
+	}
+};
+
+// Canonical fixed-width order-preserving integer key encoding.
+//
+// Values are written as 8 big-endian bytes, with the sign bit flipped for signed types, so that
+// unsigned byte-wise comparison of the encoded form orders exactly like the integers themselves.
+// Unlike the tuple encoding, which is variable width and needs per-byte type/length parsing,
+// numeric keys stored in this form are ordered correctly by the ordinary lexicographic key
+// comparison: no decoding happens on the compare path, and the 8 aligned bytes are consumed by a
+// single wide load in the vectorized StringRef::compare.
+static constexpr int ORDERED_KEY_INTEGER_BYTES = 8;
+
+inline void encodeOrderedKeyInteger(uint8_t* out, uint64_t value) {
+	value = bigEndian64(value);
+	memcpy(out, &value, sizeof(value));
+}
+inline void encodeOrderedKeyInteger(uint8_t* out, int64_t value) {
+	encodeOrderedKeyInteger(out, uint64_t(value) ^ (uint64_t(1) << 63));
+}
+inline uint64_t decodeOrderedKeyUint64(const uint8_t* in) {
+	uint64_t value;
+	memcpy(&value, in, sizeof(value));
+	return bigEndian64(value);
+}
+inline int64_t decodeOrderedKeyInt64(const uint8_t* in) {
+	return int64_t(decodeOrderedKeyUint64(in) ^ (uint64_t(1) << 63));
+}
+
+// Appends the encoded form to a BinaryWriter-compatible archive, for keys built with a prefix
+template <class Writer, class T>
+void serializeOrderedKeyInteger(Writer& wr, T value) {
+	uint8_t bytes[ORDERED_KEY_INTEGER_BYTES];
+	encodeOrderedKeyInteger(bytes, value);
+	wr.serializeBytes(bytes, ORDERED_KEY_INTEGER_BYTES);
+}
+
+template <class T>
+Standalone<StringRef> orderedKeyInteger(T value) {
+	uint8_t bytes[ORDERED_KEY_INTEGER_BYTES];
+	encodeOrderedKeyInteger(bytes, value);
+	return Standalone<StringRef>(StringRef(bytes, ORDERED_KEY_INTEGER_BYTES));
+}
+
 // A known-length memory segment and an unknown-length memory segment which can be written to as a whole.
 struct SplitBuffer {
 	void write(const void* data, int length);
@@ -777,7 +868,13 @@ struct PacketBuffer : SendBuffer {
 private:
 	int reference_count;
 	uint32_t const size_;
-	static constexpr size_t PACKET_BUFFER_MIN_SIZE = 16384;
+	// Pooled buffer size classes.  Each class is recycled through the FastAllocator magazine of its
+	// total size; anything larger comes from the global heap.  Small buffers keep mostly idle
+	// connections from pinning a large buffer per flush, while large ones keep bulk transfers from
+	// fragmenting into long chains.
+	static constexpr size_t PACKET_BUFFER_SMALL_SIZE = 512;
+	static constexpr size_t PACKET_BUFFER_MEDIUM_SIZE = 4096;
+	static constexpr size_t PACKET_BUFFER_LARGE_SIZE = 16384;
 	static constexpr size_t PACKET_BUFFER_OVERHEAD = 40;
 
 public:
@@ -785,6 +882,11 @@ public:
 
 	size_t size() const { return size_; }
 
+	// Payload bytes available in each pooled size class (see create())
+	static constexpr size_t smallClassPayload() { return PACKET_BUFFER_SMALL_SIZE - PACKET_BUFFER_OVERHEAD; }
+	static constexpr size_t mediumClassPayload() { return PACKET_BUFFER_MEDIUM_SIZE - PACKET_BUFFER_OVERHEAD; }
+	static constexpr size_t largeClassPayload() { return PACKET_BUFFER_LARGE_SIZE - PACKET_BUFFER_OVERHEAD; }
+
 private:
 	explicit PacketBuffer(size_t size) : reference_count(1), size_(size), enqueue_time(g_network->now()) {
 		next = nullptr;
@@ -795,15 +897,42 @@ private:
 
 public:
 	static PacketBuffer* create(size_t size = 0) {
-		size = std::max(size, PACKET_BUFFER_MIN_SIZE - PACKET_BUFFER_OVERHEAD);
-		uint8_t* mem = new uint8_t[size + PACKET_BUFFER_OVERHEAD];
+		if (size == 0) {
+			size = largeClassPayload();
+		}
+		// Round the payload up to the smallest size class that holds it, so the buffer comes
+		// from (and returns to) that class's FastAllocator magazine rather than the global
+		// heap.  Oversized contiguous writes fall through to the heap.
+		uint8_t* mem;
+		if (size <= smallClassPayload()) {
+			mem = reinterpret_cast<uint8_t*>(FastAllocator<PACKET_BUFFER_SMALL_SIZE>::allocate());
+			size = smallClassPayload();
+		} else if (size <= mediumClassPayload()) {
+			mem = reinterpret_cast<uint8_t*>(FastAllocator<PACKET_BUFFER_MEDIUM_SIZE>::allocate());
+			size = mediumClassPayload();
+		} else if (size <= largeClassPayload()) {
+			mem = reinterpret_cast<uint8_t*>(FastAllocator<PACKET_BUFFER_LARGE_SIZE>::allocate());
+			size = largeClassPayload();
+		} else {
+			mem = new uint8_t[size + PACKET_BUFFER_OVERHEAD];
+		}
 		return new (mem) PacketBuffer{ size };
 	}
 	PacketBuffer* nextPacketBuffer() { return static_cast<PacketBuffer*>(next); }
 	void addref() { ++reference_count; }
 	void delref() {
 		if (!--reference_count) {
-			delete[] reinterpret_cast<uint8_t*>(this);
+			// create() rounds every pooled payload up to exactly its class size, so heap buffers
+			// are exactly those larger than the largest class payload
+			if (size_ == smallClassPayload()) {
+				FastAllocator<PACKET_BUFFER_SMALL_SIZE>::release(this);
+			} else if (size_ == mediumClassPayload()) {
+				FastAllocator<PACKET_BUFFER_MEDIUM_SIZE>::release(this);
+			} else if (size_ == largeClassPayload()) {
+				FastAllocator<PACKET_BUFFER_LARGE_SIZE>::release(this);
+			} else {
+				delete[] reinterpret_cast<uint8_t*>(this);
+			}
 		}
 	}
 	int bytes_unwritten() const { return size_ - bytes_written; }
@@ -111,6 +111,67 @@ TEST_CASE("flow/serialize/Downgrade/WriteOld") {
 	return Void();
 }
 
+TEST_CASE("flow/serialize/FixedSizeWriter") {
+	// Output must be byte-identical to BinaryWriter for the same writes
+	for (int i = 0; i < 100; i++) {
+		uint64_t a = deterministicRandom()->randomUInt64();
+		uint32_t b = deterministicRandom()->randomUInt32();
+		uint8_t c = (uint8_t)deterministicRandom()->randomInt(0, 256);
+		std::string prefix = deterministicRandom()->randomAlphaNumeric(deterministicRandom()->randomInt(0, 16));
+
+		BinaryWriter bw(Unversioned());
+		bw.serializeBytes(StringRef(prefix));
+		bw << a << b << c;
+
+		FixedSizeWriter<32> fw(Unversioned());
+		fw.serializeBytes(StringRef(prefix));
+		fw << a << b << c;
+
+		ASSERT(fw.toValue() == bw.toValue());
+	}
+	return Void();
+}
+
+TEST_CASE("flow/serialize/OrderedKeyInteger") {
+	// Round trip, including boundary values
+	for (int64_t v : { std::numeric_limits<int64_t>::min(), int64_t(-1), int64_t(0), int64_t(1),
+	                   std::numeric_limits<int64_t>::max() }) {
+		uint8_t bytes[ORDERED_KEY_INTEGER_BYTES];
+		encodeOrderedKeyInteger(bytes, v);
+		ASSERT(decodeOrderedKeyInt64(bytes) == v);
+	}
+	for (uint64_t v : { uint64_t(0), uint64_t(1), std::numeric_limits<uint64_t>::max() }) {
+		uint8_t bytes[ORDERED_KEY_INTEGER_BYTES];
+		encodeOrderedKeyInteger(bytes, v);
+		ASSERT(decodeOrderedKeyUint64(bytes) == v);
+	}
+
+	// Byte-wise comparison of the encoded form must order exactly like the integers
+	for (int i = 0; i < 1000; i++) {
+		int64_t a = deterministicRandom()->randomInt64(std::numeric_limits<int64_t>::min(),
+		                                               std::numeric_limits<int64_t>::max());
+		int64_t b = deterministicRandom()->randomInt64(std::numeric_limits<int64_t>::min(),
+		                                               std::numeric_limits<int64_t>::max());
+		uint8_t ea[ORDERED_KEY_INTEGER_BYTES], eb[ORDERED_KEY_INTEGER_BYTES];
+		encodeOrderedKeyInteger(ea, a);
+		encodeOrderedKeyInteger(eb, b);
+		int cmp = memcmp(ea, eb, ORDERED_KEY_INTEGER_BYTES);
+		ASSERT((cmp < 0) == (a < b) && (cmp == 0) == (a == b));
+
+		uint64_t ua = deterministicRandom()->randomUInt64();
+		uint64_t ub = deterministicRandom()->randomUInt64();
+		encodeOrderedKeyInteger(ea, ua);
+		encodeOrderedKeyInteger(eb, ub);
+		cmp = memcmp(ea, eb, ORDERED_KEY_INTEGER_BYTES);
+		ASSERT((cmp < 0) == (ua < ub) && (cmp == 0) == (ua == ub));
+	}
+
+	// The Standalone form compares correctly through StringRef ordering too
+	ASSERT(orderedKeyInteger(int64_t(-2)) < orderedKeyInteger(int64_t(3)));
+	ASSERT(orderedKeyInteger(uint64_t(7)) < orderedKeyInteger(uint64_t(8)));
+	return Void();
+}
+
 // Verify that old code will still be able to read the values of the struct it knows about, even if we add a new field
 // and write a message with new code.
 TEST_CASE("flow/serialize/Downgrade/WriteNew") {
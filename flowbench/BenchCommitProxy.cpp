@@ -0,0 +1,83 @@
+/*
+ * BenchCommitProxy.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/benchmark.h"
+
+#include "fdbclient/CommitTransaction.h"
+#include "fdbclient/FDBTypes.h"
+#include "flow/Arena.h"
+#include "flow/ObjectSerializer.h"
+#include "flowbench/GlobalData.h"
+
+// Builds a CommitTransactionRef shaped like a typical OLTP transaction: a point read conflict range per
+// read, a point write conflict range and a set mutation per write.
+static CommitTransactionRef makeTransaction(Arena& arena, int reads, int writes, int keySize, int valueSize) {
+	CommitTransactionRef tr;
+	auto kv = getKV(keySize, valueSize);
+	for (int i = 0; i < reads; ++i) {
+		tr.read_conflict_ranges.push_back_deep(arena, singleKeyRange(kv.key, arena));
+	}
+	for (int i = 0; i < writes; ++i) {
+		tr.write_conflict_ranges.push_back_deep(arena, singleKeyRange(kv.key, arena));
+		tr.mutations.push_back_deep(arena, MutationRef(MutationRef::SetValue, kv.key, kv.value));
+	}
+	tr.read_snapshot = 100000;
+	return tr;
+}
+
+// Benchmarks serializing a commit transaction the way the client serializes a commit request, including its
+// conflict ranges; this is the dominant per-transaction serialization work on the commit path.
+static void bench_serializeCommitTransaction(benchmark::State& state) {
+	int reads = state.range(0);
+	int writes = state.range(1);
+	Arena arena;
+	CommitTransactionRef tr = makeTransaction(arena, reads, writes, 16, 64);
+	size_t size = 0;
+	while (state.KeepRunning()) {
+		Standalone<StringRef> msg = ObjectWriter::toValue(tr, Unversioned());
+		size = msg.size();
+		benchmark::DoNotOptimize(msg);
+	}
+	state.SetItemsProcessed(static_cast<long>(state.iterations()));
+	state.SetBytesProcessed(static_cast<long>(state.iterations()) * size);
+	state.counters.insert({ { "Reads", reads }, { "Writes", writes }, { "Size", size } });
+}
+
+// Benchmarks deserializing a commit transaction, which the commit proxy does once per transaction in every
+// batch it receives.
+static void bench_deserializeCommitTransaction(benchmark::State& state) {
+	int reads = state.range(0);
+	int writes = state.range(1);
+	Arena arena;
+	CommitTransactionRef tr = makeTransaction(arena, reads, writes, 16, 64);
+	Standalone<StringRef> msg = ObjectWriter::toValue(tr, Unversioned());
+	while (state.KeepRunning()) {
+		CommitTransactionRef deserialized;
+		ObjectReader rd(msg.begin(), Unversioned());
+		rd.deserialize(deserialized);
+		benchmark::DoNotOptimize(deserialized);
+	}
+	state.SetItemsProcessed(static_cast<long>(state.iterations()));
+	state.SetBytesProcessed(static_cast<long>(state.iterations()) * msg.size());
+	state.counters.insert({ { "Reads", reads }, { "Writes", writes } });
+}
+
+BENCHMARK(bench_serializeCommitTransaction)->Ranges({ { 1, 1 << 10 }, { 1, 1 << 10 } })->ReportAggregatesOnly(true);
+BENCHMARK(bench_deserializeCommitTransaction)->Ranges({ { 1, 1 << 10 }, { 1, 1 << 10 } })->ReportAggregatesOnly(true);
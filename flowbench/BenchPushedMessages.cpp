@@ -0,0 +1,123 @@
+/*
+ * BenchPushedMessages.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/benchmark.h"
+
+#include "fdbclient/CommitTransaction.h"
+#include "fdbclient/FDBTypes.h"
+#include "flow/Arena.h"
+#include "flow/serialize.h"
+#include "flowbench/GlobalData.h"
+
+#include <map>
+#include <vector>
+
+static constexpr bool CACHED_ROUTING = true;
+static constexpr bool UNCACHED_ROUTING = false;
+
+// Stand-in for the replication policy run that backs
+// ILogSystem::getPushLocations(): pick a deterministic primary location per
+// tag plus enough extra work to make recomputation visible.
+static void routeTags(const std::vector<Tag>& tags, int tLogCount, std::vector<int>& locations) {
+	locations.clear();
+	for (const auto& tag : tags) {
+		int loc = 0;
+		// Mimics the per-tag hashing and candidate scan done by the locality
+		// map when selecting replicas.
+		for (int i = 0; i < tLogCount; i++) {
+			loc = (loc * 31 + tag.id + i) % tLogCount;
+		}
+		locations.push_back(loc);
+	}
+	uniquify(locations);
+}
+
+// Benchmarks the proxy-side fan-out of tagged commit messages to per-tLog
+// message streams, as done by LogPushData::writeTypedMessage. Each mutation
+// carries one of a small number of distinct tag sets, matching how tag sets
+// repeat across the mutations of a version batch. The cached variant
+// memoizes tag set to locations, the uncached variant reroutes per mutation.
+template <bool cached>
+static void bench_pushed_messages(benchmark::State& state) {
+	int tLogCount = state.range(0);
+	int mutations = state.range(1);
+	constexpr int distinctTagSets = 16;
+
+	std::vector<std::vector<Tag>> tagSets;
+	for (int i = 0; i < distinctTagSets; i++) {
+		tagSets.push_back({ Tag(tagLocalityLogRouter, i % 4), Tag(0, i), Tag(0, (i * 7 + 1) % distinctTagSets) });
+	}
+
+	auto kv = getKV(32, 128);
+	MutationRef mutation(MutationRef::Type::SetValue, kv.key, kv.value);
+
+	while (state.KeepRunning()) {
+		std::vector<BinaryWriter> messagesWriter;
+		for (int i = 0; i < tLogCount; i++) {
+			messagesWriter.emplace_back(AssumeVersion(g_network->protocolVersion()));
+		}
+		std::map<std::vector<Tag>, std::vector<int>> cachedLocations;
+		std::vector<int> locations;
+		uint32_t subsequence = 1;
+		for (int m = 0; m < mutations; m++) {
+			const std::vector<Tag>& tags = tagSets[m % distinctTagSets];
+			if constexpr (cached) {
+				auto it = cachedLocations.find(tags);
+				if (it != cachedLocations.end()) {
+					locations = it->second;
+				} else {
+					routeTags(tags, tLogCount, locations);
+					cachedLocations[tags] = locations;
+				}
+			} else {
+				routeTags(tags, tLogCount, locations);
+			}
+
+			uint32_t subseq = subsequence++;
+			bool first = true;
+			int firstOffset = -1, firstLength = -1;
+			for (int loc : locations) {
+				BinaryWriter& wr = messagesWriter[loc];
+				if (first) {
+					firstOffset = wr.getLength();
+					wr << uint32_t(0) << subseq << uint16_t(tags.size());
+					for (const auto& tag : tags)
+						wr << tag;
+					wr << mutation;
+					firstLength = wr.getLength() - firstOffset;
+					*(uint32_t*)((uint8_t*)wr.getData() + firstOffset) = firstLength - sizeof(uint32_t);
+					first = false;
+				} else {
+					BinaryWriter& from = messagesWriter[locations[0]];
+					wr.serializeBytes((uint8_t*)from.getData() + firstOffset, firstLength);
+				}
+			}
+		}
+		benchmark::DoNotOptimize(messagesWriter);
+	}
+	state.SetItemsProcessed(mutations * static_cast<long>(state.iterations()));
+}
+
+BENCHMARK_TEMPLATE(bench_pushed_messages, CACHED_ROUTING)
+    ->Ranges({ { 4, 64 }, { 1 << 8, 1 << 14 } })
+    ->ReportAggregatesOnly(true);
+BENCHMARK_TEMPLATE(bench_pushed_messages, UNCACHED_ROUTING)
+    ->Ranges({ { 4, 64 }, { 1 << 8, 1 << 14 } })
+    ->ReportAggregatesOnly(true);
@@ -0,0 +1,73 @@
+/*
+ * BenchRYW.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/benchmark.h"
+
+#include "fdbclient/FDBTypes.h"
+#include "fdbclient/WriteMap.h"
+#include "flow/Arena.h"
+#include "flow/DeterministicRandom.h"
+
+#include <vector>
+
+static constexpr bool SEQUENTIAL = true;
+static constexpr bool RANDOM = false;
+
+// Builds a write map with the given number of distinct keys, mimicking the write set of a large
+// batch-import transaction. The returned keys are arena-backed and outlive the map.
+static std::vector<Key> populateWriteMap(WriteMap& writes, size_t items) {
+	std::vector<Key> keys;
+	keys.reserve(items);
+	for (int i = 0; i < items; ++i) {
+		keys.push_back(Key(format("key%08d", i)));
+	}
+	for (const auto& key : keys) {
+		writes.mutate(key, MutationRef::SetValue, "value"_sr, true);
+	}
+	return keys;
+}
+
+// Benchmarks repeated WriteMap::iterator::skip calls over a large write set, the pattern
+// ReadYourWrites follows when merging a read against pending writes. Sequential skips model range
+// reads over the written keys; random skips model point reads.
+template <bool sequential>
+static void bench_writeMapSkip(benchmark::State& state) {
+	size_t items = state.range(0);
+	Arena arena;
+	WriteMap writes(&arena);
+	auto keys = populateWriteMap(writes, items);
+	if (!sequential) {
+		DeterministicRandom rand(17);
+		for (int i = keys.size() - 1; i > 0; --i) {
+			std::swap(keys[i], keys[rand.randomInt(0, i + 1)]);
+		}
+	}
+	while (state.KeepRunning()) {
+		WriteMap::iterator it(&writes);
+		for (const auto& key : keys) {
+			it.skip(key);
+			benchmark::DoNotOptimize(it);
+		}
+	}
+	state.SetItemsProcessed(items * static_cast<long>(state.iterations()));
+}
+
+BENCHMARK_TEMPLATE(bench_writeMapSkip, SEQUENTIAL)->Range(1 << 8, 1 << 18)->ReportAggregatesOnly(true);
+BENCHMARK_TEMPLATE(bench_writeMapSkip, RANDOM)->Range(1 << 8, 1 << 18)->ReportAggregatesOnly(true);
@@ -0,0 +1,79 @@
+/*
+ * BenchVersionstampedQueue.cpp
+ *
+ * This source file is part of the FoundationDB open source project
+ *
+ * Copyright 2013-2022 Apple Inc. and the FoundationDB project authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include "benchmark/benchmark.h"
+
+#include "fdbclient/VersionstampedQueue.h"
+#include "flow/Arena.h"
+
+// Builds the committed form of a queue key: the enqueue key with the trailing offset stripped and the
+// versionstamp bytes filled in, as the resolver would leave it
+static Key committedKey(VersionstampedQueue& queue, int shard, int64_t version, uint16_t index) {
+	Key k = queue.encodeKey(shard, index);
+	Key committed(k.substr(0, k.size() - 4));
+	uint8_t* bytes = mutateString(committed);
+	int offset = committed.size() - VERSIONSTAMP_TUPLE_SIZE;
+	for (int i = 0; i < 8; ++i) {
+		bytes[offset + i] = uint8_t(version >> (8 * (7 - i)));
+	}
+	return committed;
+}
+
+// Benchmarks enqueue-side key construction
+static void bench_queueEncodeKey(benchmark::State& state) {
+	VersionstampedQueue queue(Subspace("bench/queue"_sr), state.range(0));
+	uint16_t index = 0;
+	while (state.KeepRunning()) {
+		Key k = queue.encodeKey(0, index++);
+		benchmark::DoNotOptimize(k);
+	}
+	state.SetItemsProcessed(static_cast<long>(state.iterations()));
+}
+
+// Benchmarks the consumer-side decode and merge of per-shard reads into commit order
+static void bench_queueDecodeMerge(benchmark::State& state) {
+	int shards = state.range(0);
+	int items = state.range(1);
+	VersionstampedQueue queue(Subspace("bench/queue"_sr), shards);
+
+	std::vector<Key> keys;
+	keys.reserve(items);
+	for (int i = 0; i < items; ++i) {
+		keys.push_back(committedKey(queue, i % shards, i, uint16_t(i)));
+	}
+
+	while (state.KeepRunning()) {
+		std::vector<Versionstamp> versions;
+		versions.reserve(keys.size());
+		for (const auto& k : keys) {
+			versions.push_back(queue.decodeKey(k));
+		}
+		std::sort(versions.begin(), versions.end(), [](auto const& a, auto const& b) {
+			return memcmp(a.begin(), b.begin(), VERSIONSTAMP_TUPLE_SIZE) < 0;
+		});
+		benchmark::DoNotOptimize(versions);
+	}
+	state.SetItemsProcessed(items * static_cast<long>(state.iterations()));
+}
+
+BENCHMARK(bench_queueEncodeKey)->Arg(1)->Arg(16)->ReportAggregatesOnly(true);
+BENCHMARK(bench_queueDecodeMerge)->Ranges({ { 1, 16 }, { 1 << 8, 1 << 14 } })->ReportAggregatesOnly(true);